@@ -69,6 +69,8 @@ LOCAL_C_INCLUDES += \
     external/tinyalsa/include \
     frameworks/wilhelm/include
 
+LOCAL_STATIC_LIBRARIES := libETC1
+
 LOCAL_SHARED_LIBRARIES := \
     libcutils \
     liblog \
@@ -29,9 +29,13 @@
 #include <signal.h>
 #include <time.h>
 
+#include <deque>
+
 #include <cutils/atomic.h>
 #include <cutils/properties.h>
 
+#include <ETC1/etc1.h>
+
 #include <androidfw/AssetManager.h>
 #include <binder/IPCThreadState.h>
 #include <utils/Errors.h>
@@ -190,7 +194,9 @@ status_t BootAnimation::initTexture(Texture* texture, AssetManager& assets,
     return NO_ERROR;
 }
 
-status_t BootAnimation::initTexture(FileMap* map, int* width, int* height)
+// Decodes a stored PNG entry into a bitmap. Decoding needs no GL context, so
+// this can run off the playback thread; the result only needs uploading.
+static SkBitmap decodeFrame(FileMap* map)
 {
     SkBitmap bitmap;
     sk_sp<SkData> data = SkData::MakeWithoutCopy(map->getDataPtr(),
@@ -199,10 +205,39 @@ status_t BootAnimation::initTexture(FileMap* map, int* width, int* height)
     image->asLegacyBitmap(&bitmap, SkImage::kRO_LegacyBitmapMode);
 
     // FileMap memory is never released until application exit.
-    // Release it now as the texture is already loaded and the memory used for
+    // Release it now as the bitmap is already decoded and the memory used for
     // the packed resource can be released.
     delete map;
 
+    return bitmap;
+}
+
+// Software fallback for ETC1 frames when the GL driver can't take the
+// compressed payload directly: decode to RGB 565 and feed the normal
+// upload path.
+static SkBitmap decodeEtc1Frame(FileMap* map)
+{
+    SkBitmap bitmap;
+    const etc1_byte* data = reinterpret_cast<const etc1_byte*>(map->getDataPtr());
+    if (map->getDataLength() >= ETC_PKM_HEADER_SIZE && etc1_pkm_is_valid(data)) {
+        const int w = etc1_pkm_get_width(data);
+        const int h = etc1_pkm_get_height(data);
+        if (map->getDataLength() >= ETC_PKM_HEADER_SIZE + etc1_get_encoded_data_size(w, h)
+                && bitmap.tryAllocPixels(SkImageInfo::Make(w, h,
+                        kRGB_565_SkColorType, kOpaque_SkAlphaType))) {
+            etc1_decode_image(data + ETC_PKM_HEADER_SIZE,
+                    reinterpret_cast<etc1_byte*>(bitmap.getPixels()), w, h,
+                    2 /* RGB 565 */, bitmap.rowBytes());
+        }
+    } else {
+        ALOGE("Invalid PKM header in .pkm frame");
+    }
+    delete map;
+    return bitmap;
+}
+
+status_t BootAnimation::initTexture(const SkBitmap& bitmap, int* width, int* height)
+{
     const int w = bitmap.width();
     const int h = bitmap.height();
     const void* p = bitmap.getPixels();
@@ -249,6 +284,41 @@ status_t BootAnimation::initTexture(FileMap* map, int* width, int* height)
     return NO_ERROR;
 }
 
+// Uploads an ETC1 .pkm frame straight from its compressed payload, skipping
+// decode and moving a quarter of the bytes of the equivalent RGB 565 upload.
+status_t BootAnimation::initEtc1Texture(FileMap* map, int* width, int* height)
+{
+    const etc1_byte* data = reinterpret_cast<const etc1_byte*>(map->getDataPtr());
+    if (map->getDataLength() < ETC_PKM_HEADER_SIZE || !etc1_pkm_is_valid(data)) {
+        ALOGE("Invalid PKM header in .pkm frame");
+        delete map;
+        return NO_INIT;
+    }
+
+    const int w = etc1_pkm_get_width(data);
+    const int h = etc1_pkm_get_height(data);
+    const GLsizei encodedSize = etc1_get_encoded_data_size(w, h);
+    if (map->getDataLength() < ETC_PKM_HEADER_SIZE + (size_t)encodedSize) {
+        ALOGE("Truncated .pkm frame");
+        delete map;
+        return NO_INIT;
+    }
+
+    GLint crop[4] = { 0, h, w, -h };
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_ETC1_RGB8_OES, w, h, 0,
+            encodedSize, data + ETC_PKM_HEADER_SIZE);
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_CROP_RECT_OES, crop);
+
+    // FileMap memory is never released until application exit.
+    // Release it now as the texture is already loaded.
+    delete map;
+
+    *width = w;
+    *height = h;
+
+    return NO_ERROR;
+}
+
 status_t BootAnimation::readyToRun() {
     mAssets.addDefaultAssets();
 
@@ -535,7 +605,7 @@ status_t BootAnimation::initFont(Font* font, const char* fallback) {
         glGenTextures(1, &font->texture.name);
         glBindTexture(GL_TEXTURE_2D, font->texture.name);
 
-        status = initTexture(font->map, &font->texture.w, &font->texture.h);
+        status = initTexture(decodeFrame(font->map), &font->texture.w, &font->texture.h);
 
         glTexParameterx(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         glTexParameterx(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -746,6 +816,7 @@ bool BootAnimation::preloadZip(Animation& animation)
                                     Animation::Frame frame;
                                     frame.name = leaf;
                                     frame.map = map;
+                                    frame.etc1 = (entryName.getPathExtension() == ".pkm");
                                     frame.trimWidth = animation.width;
                                     frame.trimHeight = animation.height;
                                     frame.trimX = 0;
@@ -812,8 +883,9 @@ bool BootAnimation::movie()
         mClockEnabled = false;
     }
 
-    // Check if npot textures are supported
+    // Check if npot and ETC1 compressed textures are supported
     mUseNpotTextures = false;
+    mUseEtc1Textures = false;
     String8 gl_extensions;
     const char* exts = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
     if (!exts) {
@@ -824,6 +896,9 @@ bool BootAnimation::movie()
             (gl_extensions.find("GL_OES_texture_npot") != -1)) {
             mUseNpotTextures = true;
         }
+        if (gl_extensions.find("GL_OES_compressed_ETC1_RGB8_texture") != -1) {
+            mUseEtc1Textures = true;
+        }
     }
 
     // Blend required to draw time on top of animation frames.
@@ -869,6 +944,81 @@ bool BootAnimation::movie()
     return false;
 }
 
+// Decodes a part's frames in play order on its own thread, keeping a small
+// bounded queue of bitmaps ready so the playback loop only uploads and draws.
+// The playback loop consumes exactly one bitmap per frame on the first pass
+// over a part; later passes reuse the textures uploaded then.
+class BootAnimation::FrameDecodeThread : public Thread {
+public:
+    FrameDecodeThread(const Animation::Part& part, bool hardwareEtc1)
+        : Thread(false), mPart(part), mHardwareEtc1(hardwareEtc1), mNextFrame(0) {
+    }
+
+    // Returns the decoded bitmap for the next frame in play order, waiting
+    // for the decoder to produce it if necessary.
+    SkBitmap nextFrame() {
+        Mutex::Autolock _l(mLock);
+        while (mDecoded.empty()) {
+            mCondition.wait(mLock);
+        }
+        SkBitmap bitmap = mDecoded.front();
+        mDecoded.pop_front();
+        mCondition.signal();
+        return bitmap;
+    }
+
+    // Unblocks the decoder so requestExitAndWait() can finish even if the
+    // playback loop stopped consuming frames early.
+    void abort() {
+        Mutex::Autolock _l(mLock);
+        requestExit();
+        mCondition.broadcast();
+    }
+
+private:
+    // Enough to absorb a decode overrunning the frame budget without holding
+    // many high-resolution bitmaps in memory at once.
+    static const size_t kMaxAheadFrames = 3;
+
+    virtual bool threadLoop() {
+        // ETC1 frames uploaded straight from their compressed payload need
+        // no decoding; the playback loop handles them without this queue.
+        while (mNextFrame < mPart.frames.size()
+                && mPart.frames[mNextFrame].etc1 && mHardwareEtc1) {
+            mNextFrame++;
+        }
+        if (mNextFrame >= mPart.frames.size()) {
+            return false;
+        }
+        { // wait for queue space
+            Mutex::Autolock _l(mLock);
+            while (mDecoded.size() >= kMaxAheadFrames && !exitPending()) {
+                mCondition.wait(mLock);
+            }
+            if (exitPending()) {
+                return false;
+            }
+        }
+        const Animation::Frame& frame(mPart.frames[mNextFrame]);
+        SkBitmap bitmap = frame.etc1 ? decodeEtc1Frame(frame.map) : decodeFrame(frame.map);
+        mNextFrame++;
+        {
+            Mutex::Autolock _l(mLock);
+            mDecoded.push_back(bitmap);
+            mCondition.signal();
+        }
+        return true;
+    }
+
+    const Animation::Part& mPart;
+    const bool mHardwareEtc1;
+    size_t mNextFrame;
+
+    Mutex mLock;
+    Condition mCondition;
+    std::deque<SkBitmap> mDecoded;
+};
+
 bool BootAnimation::playAnimation(const Animation& animation)
 {
     const size_t pcount = animation.parts.size();
@@ -891,6 +1041,14 @@ bool BootAnimation::playAnimation(const Animation& animation)
             continue; //to next part
         }
 
+        // Decode ahead of the playback loop; the first pass over the part
+        // consumes one decoded bitmap per frame, later passes reuse textures.
+        sp<FrameDecodeThread> decodeThread;
+        if (fcount > 0) {
+            decodeThread = new FrameDecodeThread(part, mUseEtc1Textures);
+            decodeThread->run("BootAnimation::FrameDecodeThread", PRIORITY_NORMAL);
+        }
+
         for (int r=0 ; !part.count || r<part.count ; r++) {
             // Exit any non playuntil complete parts immediately
             if(exitPending() && !part.playUntilComplete)
@@ -918,7 +1076,11 @@ bool BootAnimation::playAnimation(const Animation& animation)
                         glTexParameterx(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
                     }
                     int w, h;
-                    initTexture(frame.map, &w, &h);
+                    if (frame.etc1 && mUseEtc1Textures) {
+                        initEtc1Texture(frame.map, &w, &h);
+                    } else {
+                        initTexture(decodeThread->nextFrame(), &w, &h);
+                    }
                 }
 
                 const int xc = animationX + frame.trimX;
@@ -972,6 +1134,10 @@ bool BootAnimation::playAnimation(const Animation& animation)
                 break;
         }
 
+        if (decodeThread != nullptr) {
+            decodeThread->abort();
+            decodeThread->requestExitAndWait();
+        }
     }
 
     // Free textures created for looping parts now that the animation is done.
@@ -56,6 +56,7 @@ public:
         struct Frame {
             String8 name;
             FileMap* map;
+            bool etc1;  // stored as an ETC1 .pkm instead of a PNG
             int trimX;
             int trimY;
             int trimWidth;
@@ -125,6 +126,10 @@ private:
 
     bool                updateIsTimeAccurate();
 
+    // Decodes a part's frames ahead of the playback loop so uploads never
+    // wait on PNG decoding. Defined in BootAnimation.cpp.
+    class FrameDecodeThread;
+
     class TimeCheckThread : public Thread {
     public:
         TimeCheckThread(BootAnimation* bootAnimation);
@@ -142,7 +147,8 @@ private:
     };
 
     status_t initTexture(Texture* texture, AssetManager& asset, const char* name);
-    status_t initTexture(FileMap* map, int* width, int* height);
+    status_t initTexture(const SkBitmap& bitmap, int* width, int* height);
+    status_t initEtc1Texture(FileMap* map, int* width, int* height);
     status_t initFont(Font* font, const char* fallback);
     bool android();
     bool movie();
@@ -167,6 +173,7 @@ private:
     int         mCurrentInset;
     int         mTargetInset;
     bool        mUseNpotTextures = false;
+    bool        mUseEtc1Textures = false;
     EGLDisplay  mDisplay;
     EGLDisplay  mContext;
     EGLDisplay  mSurface;
@@ -5,7 +5,14 @@
 
 #include "idmap.h"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <androidfw/ResourceTypes.h>
 #include <androidfw/StreamingZipInflater.h>
 #include <androidfw/ZipFileRO.h>
@@ -96,7 +103,7 @@ namespace {
     }
 
     int parse_overlay_tag(const ResXMLTree& parser, const char *target_package_name,
-            bool* is_static_overlay)
+            bool* is_static_overlay, String8* out_prop_name, String8* out_prop_value)
     {
         const size_t N = parser.getAttributeCount();
         String16 target;
@@ -137,14 +144,11 @@ namespace {
             }
         }
 
-        // Note that conditional property enablement/exclusion only applies if
-        // the attribute is present. In its absence, all overlays are presumed enabled.
-        if (propName.size() > 0 && propValue.size() > 0) {
-            // if property set & equal to value, then include overlay - otherwise skip
-            if (!check_property(propName, propValue)) {
-                return NO_OVERLAY_TAG;
-            }
-        }
+        // The property condition is evaluated by the caller rather than here,
+        // so that parse results can be cached across boots and the (cheap)
+        // property check redone against the current property values.
+        *out_prop_name = String8(propName);
+        *out_prop_value = String8(propValue);
 
         if (target == String16(target_package_name)) {
             return priority;
@@ -152,7 +156,8 @@ namespace {
         return NO_OVERLAY_TAG;
     }
 
-    int parse_manifest(const void *data, size_t size, const char *target_package_name)
+    int parse_manifest(const void *data, size_t size, const char *target_package_name,
+            String8* out_prop_name, String8* out_prop_value)
     {
         ResXMLTree parser;
         parser.setTo(data, size);
@@ -170,7 +175,8 @@ namespace {
                 size_t len;
                 String16 tag(parser.getElementName(&len));
                 if (tag == String16("overlay")) {
-                    priority = parse_overlay_tag(parser, target_package_name, &is_static_overlay);
+                    priority = parse_overlay_tag(parser, target_package_name, &is_static_overlay,
+                            out_prop_name, out_prop_value);
                     break;
                 }
             }
@@ -182,7 +188,8 @@ namespace {
         return NO_OVERLAY_TAG;
     }
 
-    int parse_apk(const char *path, const char *target_package_name)
+    int parse_apk(const char *path, const char *target_package_name,
+            String8* out_prop_name, String8* out_prop_value)
     {
         std::unique_ptr<ZipFileRO> zip(ZipFileRO::open(path));
         if (zip.get() == NULL) {
@@ -223,11 +230,112 @@ namespace {
             return -1;
         }
 
-        int priority = parse_manifest(buf, static_cast<size_t>(uncompLen), target_package_name);
+        int priority = parse_manifest(buf, static_cast<size_t>(uncompLen), target_package_name,
+                out_prop_name, out_prop_value);
         delete[] buf;
         delete dataMap;
         return priority;
     }
+
+    // A scan candidate: an overlay APK plus its (possibly cached) parse result.
+    // priority is the manifest priority before the property condition is
+    // applied; NO_OVERLAY_TAG if the APK is not a static overlay of the target.
+    struct Candidate {
+        String8 apk_path;
+        int64_t mtime;
+        int64_t size;
+        int priority;
+        String8 prop_name;
+        String8 prop_value;
+        bool from_cache;
+    };
+
+    struct CacheEntry {
+        int64_t mtime;
+        int64_t size;
+        int priority;
+        String8 target;
+        String8 prop_name;
+        String8 prop_value;
+    };
+
+    // Applies a requiredSystemProperty{Name,Value} condition to a parse
+    // result. Note that conditional property enablement/exclusion only applies
+    // if the attribute is present. In its absence, all overlays are presumed
+    // enabled.
+    int apply_property_condition(int priority, const String8& prop_name,
+            const String8& prop_value)
+    {
+        if (prop_name.size() > 0 && prop_value.size() > 0) {
+            // if property set & equal to value, then include overlay - otherwise skip
+            if (!check_property(String16(prop_name), String16(prop_value))) {
+                return NO_OVERLAY_TAG;
+            }
+        }
+        return priority;
+    }
+
+    // The scan cache stores manifest parse results keyed by APK path, valid
+    // while the APK's mtime and size are unchanged. Property conditions are
+    // stored, not their outcome, so they are re-evaluated every scan. Lines:
+    // <mtime> <size> <priority> <target> <prop_name> <prop_value> <apk_path>
+    // with '-' for an absent property condition.
+    void load_scan_cache(const char *filename, std::map<std::string, CacheEntry>* cache)
+    {
+        FILE* fin = fopen(filename, "r");
+        if (fin == NULL) {
+            return;
+        }
+        char line[PATH_MAX + 512];
+        while (fgets(line, sizeof(line), fin) != NULL) {
+            CacheEntry entry;
+            char target[256];
+            char prop_name[256];
+            char prop_value[256];
+            char apk_path[PATH_MAX + 1];
+            if (sscanf(line, "%" SCNd64 " %" SCNd64 " %d %255s %255s %255s %4095s",
+                        &entry.mtime, &entry.size, &entry.priority, target,
+                        prop_name, prop_value, apk_path) != 7) {
+                continue;
+            }
+            entry.target = String8(target);
+            entry.prop_name = strcmp(prop_name, "-") == 0 ? String8() : String8(prop_name);
+            entry.prop_value = strcmp(prop_value, "-") == 0 ? String8() : String8(prop_value);
+            (*cache)[apk_path] = entry;
+        }
+        fclose(fin);
+    }
+
+    bool write_scan_cache(const char *filename, const std::map<std::string, CacheEntry>& cache)
+    {
+        // same locking discipline as overlays.list: open for append so the
+        // file isn't truncated before the flock is held
+        FILE* fout = fopen(filename, "a");
+        if (fout == NULL) {
+            return false;
+        }
+        if (TEMP_FAILURE_RETRY(flock(fileno(fout), LOCK_EX)) != 0) {
+            fclose(fout);
+            return false;
+        }
+        if (TEMP_FAILURE_RETRY(ftruncate(fileno(fout), 0)) != 0) {
+            TEMP_FAILURE_RETRY(flock(fileno(fout), LOCK_UN));
+            fclose(fout);
+            return false;
+        }
+        for (const auto& it : cache) {
+            const CacheEntry& entry = it.second;
+            fprintf(fout, "%" PRId64 " %" PRId64 " %d %s %s %s %s\n",
+                    entry.mtime, entry.size, entry.priority, entry.target.string(),
+                    entry.prop_name.size() > 0 ? entry.prop_name.string() : "-",
+                    entry.prop_value.size() > 0 ? entry.prop_value.string() : "-",
+                    it.first.c_str());
+        }
+        TEMP_FAILURE_RETRY(fflush(fout));
+        TEMP_FAILURE_RETRY(flock(fileno(fout), LOCK_UN));
+        fclose(fout);
+        return true;
+    }
 }
 
 int idmap_scan(const char *target_package_name, const char *target_apk_path,
@@ -236,7 +344,14 @@ int idmap_scan(const char *target_package_name, const char *target_apk_path,
     String8 filename = String8(idmap_dir);
     filename.appendPath("overlays.list");
 
-    SortedVector<Overlay> overlayVector;
+    String8 cache_filename = String8(idmap_dir);
+    cache_filename.appendPath("scan.cache");
+
+    std::map<std::string, CacheEntry> cache;
+    load_scan_cache(cache_filename.string(), &cache);
+
+    // Collect candidates first, satisfying what we can from the scan cache.
+    std::vector<Candidate> candidates;
     const size_t N = overlay_dirs->size();
     for (size_t i = 0; i < N; ++i) {
         const char *overlay_dir = overlay_dirs->itemAt(i);
@@ -257,28 +372,100 @@ int idmap_scan(const char *target_package_name, const char *target_apk_path,
                 continue;
             }
 
-            int priority = parse_apk(overlay_apk_path, target_package_name);
-            if (priority < 0) {
-                continue;
+            Candidate c;
+            c.apk_path = String8(overlay_apk_path);
+            c.mtime = static_cast<int64_t>(st.st_mtime);
+            c.size = static_cast<int64_t>(st.st_size);
+            c.priority = -1;
+            c.from_cache = false;
+
+            std::map<std::string, CacheEntry>::const_iterator it =
+                    cache.find(overlay_apk_path);
+            if (it != cache.end() && it->second.mtime == c.mtime && it->second.size == c.size
+                    && it->second.target == String8(target_package_name)) {
+                c.priority = it->second.priority;
+                c.prop_name = it->second.prop_name;
+                c.prop_value = it->second.prop_value;
+                c.from_cache = true;
             }
+            candidates.push_back(c);
+        }
 
-            String8 idmap_path(idmap_dir);
-            idmap_path.appendPath(flatten_path(overlay_apk_path + 1));
-            idmap_path.append("@idmap");
+        closedir(dir);
+    }
 
-            if (idmap_create_path(target_apk_path, overlay_apk_path, idmap_path.string()) != 0) {
-                ALOGE("error: failed to create idmap for target=%s overlay=%s idmap=%s\n",
-                        target_apk_path, overlay_apk_path, idmap_path.string());
-                continue;
+    // Parse the manifests the cache couldn't answer, spreading the APKs over
+    // a few worker threads; each APK is handled entirely by one worker.
+    size_t toParse = 0;
+    for (const Candidate& c : candidates) {
+        if (!c.from_cache) {
+            ++toParse;
+        }
+    }
+    if (toParse > 0) {
+        std::atomic<size_t> nextCandidate(0);
+        auto parseWorker = [&]() {
+            size_t idx;
+            while ((idx = nextCandidate.fetch_add(1)) < candidates.size()) {
+                Candidate& c = candidates[idx];
+                if (c.from_cache) {
+                    continue;
+                }
+                c.priority = parse_apk(c.apk_path.string(), target_package_name,
+                        &c.prop_name, &c.prop_value);
             }
+        };
+        size_t numWorkers = std::min<size_t>(toParse, 4);
+        if (numWorkers <= 1) {
+            parseWorker();
+        } else {
+            std::vector<std::thread> workers;
+            for (size_t i = 0; i < numWorkers; ++i) {
+                workers.emplace_back(parseWorker);
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+    }
 
-            Overlay overlay(String8(overlay_apk_path), idmap_path, priority);
-            overlayVector.add(overlay);
+    SortedVector<Overlay> overlayVector;
+    for (const Candidate& c : candidates) {
+        // Cache successful parses, including non-overlay APKs, so unchanged
+        // files skip parsing on the next scan. Errors (-1) stay uncached.
+        if (!c.from_cache && (c.priority >= 0 || c.priority == NO_OVERLAY_TAG)) {
+            CacheEntry entry;
+            entry.mtime = c.mtime;
+            entry.size = c.size;
+            entry.priority = c.priority;
+            entry.target = String8(target_package_name);
+            entry.prop_name = c.prop_name;
+            entry.prop_value = c.prop_value;
+            cache[c.apk_path.string()] = entry;
         }
 
-        closedir(dir);
+        int priority = apply_property_condition(c.priority, c.prop_name, c.prop_value);
+        if (priority < 0) {
+            continue;
+        }
+
+        String8 idmap_path(idmap_dir);
+        idmap_path.appendPath(flatten_path(c.apk_path.string() + 1));
+        idmap_path.append("@idmap");
+
+        if (idmap_create_path(target_apk_path, c.apk_path.string(), idmap_path.string()) != 0) {
+            ALOGE("error: failed to create idmap for target=%s overlay=%s idmap=%s\n",
+                    target_apk_path, c.apk_path.string(), idmap_path.string());
+            continue;
+        }
+
+        Overlay overlay(c.apk_path, idmap_path, priority);
+        overlayVector.add(overlay);
     }
 
+    // Failing to persist the cache only costs time on the next scan.
+    write_scan_cache(cache_filename.string(), cache);
+
     if (!writePackagesList(filename.string(), overlayVector)) {
         return EXIT_FAILURE;
     }
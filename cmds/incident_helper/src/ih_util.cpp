@@ -20,6 +20,8 @@
 
 #include <algorithm>
 #include <sstream>
+#include <string.h>
+#include <strings.h>
 #include <unistd.h>
 
 bool isValidChar(char c) {
@@ -38,18 +40,10 @@ std::string trim(const std::string& s, const std::string& charset) {
     return s.substr(head, tail - head + 1);
 }
 
-static inline std::string toLowerStr(const std::string& s) {
-    std::string res(s);
-    std::transform(res.begin(), res.end(), res.begin(), ::tolower);
-    return res;
-}
-
-static inline std::string trimDefault(const std::string& s) {
-    return trim(s, DEFAULT_WHITESPACE);
-}
-
-static inline std::string trimHeader(const std::string& s) {
-    return toLowerStr(trimDefault(s));
+// Narrows [begin, end) to exclude surrounding whitespace without making a copy.
+static inline void trimRange(const std::string& s, size_t* begin, size_t* end) {
+    while (*begin < *end && DEFAULT_WHITESPACE.find(s[*begin]) != std::string::npos) (*begin)++;
+    while (*end > *begin && DEFAULT_WHITESPACE.find(s[*end - 1]) != std::string::npos) (*end)--;
 }
 
 static inline bool isNumber(const std::string& s) {
@@ -59,18 +53,22 @@ static inline bool isNumber(const std::string& s) {
 }
 
 // This is similiar to Split in android-base/file.h, but it won't add empty string
+// and it trims each word in place so every kept word is allocated exactly once.
 static void split(const std::string& line, std::vector<std::string>& words,
-        const trans_func& func, const std::string& delimiters) {
+        const std::string& delimiters, bool lowercase = false) {
     words.clear();  // clear the buffer before split
 
     size_t base = 0;
     size_t found;
     while (true) {
         found = line.find_first_of(delimiters, base);
-        if (found != base) {
-            std::string word = (*func) (line.substr(base, found - base));
-            if (!word.empty()) {
-                words.push_back(word);
+        size_t end = (found == line.npos) ? line.size() : found;
+        trimRange(line, &base, &end);
+        if (end > base) {
+            words.emplace_back(line, base, end - base);
+            if (lowercase) {
+                std::string& word = words.back();
+                std::transform(word.begin(), word.end(), word.begin(), ::tolower);
             }
         }
         if (found == line.npos) break;
@@ -80,15 +78,13 @@ static void split(const std::string& line, std::vector<std::string>& words,
 
 header_t parseHeader(const std::string& line, const std::string& delimiters) {
     header_t header;
-    trans_func f = &trimHeader;
-    split(line, header, f, delimiters);
+    split(line, header, delimiters, true);
     return header;
 }
 
 record_t parseRecord(const std::string& line, const std::string& delimiters) {
     record_t record;
-    trans_func f = &trimDefault;
-    split(line, record, f, delimiters);
+    split(line, record, delimiters);
     return record;
 }
 
@@ -136,7 +132,9 @@ record_t parseRecordByColumns(const std::string& line, const std::vector<int>& i
             return record;
         }
         while (idx < lineSize && delimiters.find(line[idx++]) == std::string::npos);
-        record.push_back(trimDefault(line.substr(lastIndex, idx - lastIndex)));
+        size_t colBegin = lastIndex, colEnd = idx;
+        trimRange(line, &colBegin, &colEnd);
+        record.emplace_back(line, colBegin, colEnd - colBegin);
         lastBeginning = lastIndex;
         lastIndex = idx;
     }
@@ -148,7 +146,9 @@ record_t parseRecordByColumns(const std::string& line, const std::vector<int>& i
             record.pop_back();
             beginning = lastBeginning;
         }
-        record.push_back(trimDefault(line.substr(beginning, lineSize - beginning)));
+        size_t restBegin = beginning, restEnd = lineSize;
+        trimRange(line, &restBegin, &restEnd);
+        record.emplace_back(line, restBegin, restEnd - restBegin);
     }
     return record;
 }
@@ -183,7 +183,10 @@ bool stripPrefix(std::string* line, const char* key, bool endAtDelimiter) {
         if (j == len || isValidChar(line->at(j))) return false;
     }
 
-    line->assign(trimDefault(line->substr(j)));
+    size_t begin = j, end = line->size();
+    trimRange(*line, &begin, &end);
+    line->erase(end);
+    line->erase(0, begin);
     return true;
 }
 
@@ -204,20 +207,23 @@ bool stripSuffix(std::string* line, const char* key, bool endAtDelimiter) {
         if (j < 0 || isValidChar(line->at(j))) return false;
     }
 
-    line->assign(trimDefault(line->substr(0, j+1)));
+    size_t begin = 0, end = j + 1;
+    trimRange(*line, &begin, &end);
+    line->erase(end);
+    line->erase(0, begin);
     return true;
 }
 
 std::string behead(std::string* line, const char cut) {
     auto found = line->find_first_of(cut);
     if (found == std::string::npos) {
-        std::string head = line->substr(0);
-        line->assign("");
+        std::string head(std::move(*line));
+        line->clear();
         return head;
     }
     std::string head = line->substr(0, found);
     while(line->at(found) == cut) found++; // trim more cut of the rest
-    line->assign(line->substr(found));
+    line->erase(0, found);
     return head;
 }
 
@@ -237,27 +243,32 @@ double toDouble(const std::string& s) {
 Reader::Reader(const int fd)
 {
     mFile = fdopen(fd, "r");
+    mBuf = NULL;
+    mBufLen = 0;
     mStatus = mFile == NULL ? "Invalid fd " + std::to_string(fd) : "";
 }
 
 Reader::~Reader()
 {
     if (mFile != NULL) fclose(mFile);
+    free(mBuf);
 }
 
 bool Reader::readLine(std::string* line) {
     if (mFile == NULL) return false;
 
-    char* buf = NULL;
-    size_t len = 0;
-    ssize_t read = getline(&buf, &len, mFile);
+    // getline() reuses mBuf across calls and only grows it when a longer line
+    // shows up, so reading a large dump costs one allocation, not one per line.
+    ssize_t read = getline(&mBuf, &mBufLen, mFile);
     if (read != -1) {
-        std::string s(buf);
-        line->assign(trim(s, DEFAULT_NEWLINE));
+        size_t begin = 0;
+        size_t end = read;
+        while (end > begin && DEFAULT_NEWLINE.find(mBuf[end - 1]) != std::string::npos) end--;
+        while (begin < end && DEFAULT_NEWLINE.find(mBuf[begin]) != std::string::npos) begin++;
+        line->assign(mBuf + begin, end - begin);
     } else if (errno == EINVAL) {
         mStatus = "Bad Argument";
     }
-    free(buf);
     return read != -1;
 }
 
@@ -327,11 +338,11 @@ Table::insertField(ProtoOutputStream* proto, const std::string& name, const std:
             proto->write(found, toLongLong(value));
             break;
         case FIELD_COUNT_SINGLE | FIELD_TYPE_BOOL:
-            if (strcmp(toLowerStr(value).c_str(), "true") == 0 || strcmp(value.c_str(), "1") == 0) {
+            if (strcasecmp(value.c_str(), "true") == 0 || strcmp(value.c_str(), "1") == 0) {
                 proto->write(found, true);
                 break;
             }
-            if (strcmp(toLowerStr(value).c_str(), "false") == 0 || strcmp(value.c_str(), "0") == 0) {
+            if (strcasecmp(value.c_str(), "false") == 0 || strcmp(value.c_str(), "0") == 0) {
                 proto->write(found, false);
                 break;
             }
@@ -28,7 +28,6 @@ using namespace android::util;
 
 typedef std::vector<std::string> header_t;
 typedef std::vector<std::string> record_t;
-typedef std::string (*trans_func) (const std::string&);
 
 const std::string DEFAULT_WHITESPACE = " \t";
 const std::string DEFAULT_NEWLINE = "\r\n";
@@ -117,6 +116,9 @@ public:
 
 private:
     FILE* mFile;
+    // line buffer handed to getline(), reused across readLine calls.
+    char* mBuf;
+    size_t mBufLen;
     std::string mStatus;
 };
 
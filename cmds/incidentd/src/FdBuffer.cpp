@@ -140,6 +140,11 @@ status_t FdBuffer::readProcessedDataInStream(int fd, unique_fd toFd, unique_fd f
     size_t cirSize = 0;
     int rpos = 0, wpos = 0;
 
+    // Try to move bytes from fd to the parsing process kernel-side with splice(2) first,
+    // since toFd is always a pipe. Not every fd supports splice (sysfs is the usual
+    // offender), in which case we drop back to copying through cirBuf.
+    bool spliceAvailable = true;
+
     // This is the buffer used to store processed data
     while (true) {
         if (mBuffer.size() >= MAX_BUFFER_COUNT * BUFFER_SIZE) {
@@ -178,8 +183,27 @@ status_t FdBuffer::readProcessedDataInStream(int fd, unique_fd toFd, unique_fd f
             }
         }
 
+        // splice from fd straight into the pipe, no userspace copy
+        if (spliceAvailable && cirSize == 0 && pfds[0].fd != -1 && pfds[1].fd != -1) {
+            ssize_t amt =
+                    ::splice(fd, NULL, toFd.get(), NULL, BUFFER_SIZE,
+                             SPLICE_F_MORE | SPLICE_F_NONBLOCK);
+            if (amt < 0) {
+                if (errno == EINVAL || errno == ENOSYS) {
+                    VLOG("fd %d does not support splice, falling back to read/write", fd);
+                    spliceAvailable = false;
+                } else if (!(errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    VLOG("Fail to splice fd %d: %s", fd, strerror(errno));
+                    return -errno;
+                }  // otherwise just continue
+            } else if (amt == 0) {
+                VLOG("Reached EOF of input file %d", fd);
+                pfds[0].fd = -1;  // reach EOF so don't have to poll pfds[0].
+            }
+        }
+
         // read from fd
-        if (cirSize != BUFFER_SIZE && pfds[0].fd != -1) {
+        if (!spliceAvailable && cirSize != BUFFER_SIZE && pfds[0].fd != -1) {
             ssize_t amt;
             if (rpos >= wpos) {
                 amt = ::read(fd, cirBuf + rpos, BUFFER_SIZE - rpos);
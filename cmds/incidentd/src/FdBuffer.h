@@ -56,6 +56,9 @@ public:
      * reads original data in 'fd' and writes to parsing process through 'toFd', then it reads
      * and stores the processed data from 'fromFd' in memory for later usage.
      * This function behaves in a streaming fashion in order to save memory usage.
+     * Data is moved from 'fd' to 'toFd' with splice(2) when the kernel allows it, so those
+     * bytes never pass through userspace; sources that can't be spliced (e.g. sysfs) are
+     * copied through an internal buffer instead.
      * Returns NO_ERROR if there were no errors or if we timed out.
      *
      * Poll will return POLLERR if fd is from sysfs, handle this edge case.
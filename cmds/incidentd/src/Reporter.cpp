@@ -22,8 +22,10 @@
 #include "report_directory.h"
 #include "section_list.h"
 
+#include <android-base/file.h>
 #include <android-base/properties.h>
 #include <android/os/DropBoxManager.h>
+#include <android/util/protobuf.h>
 #include <private/android_filesystem_config.h>
 #include <utils/SystemClock.h>
 
@@ -32,13 +34,24 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
+
+#include <atomic>
 #include <string>
+#include <thread>
 
 /**
  * The directory where the incident reports are stored.
  */
 static const char* INCIDENT_DIRECTORY = "/data/misc/incidents/";
 
+/**
+ * How many sections can collect data at once. Sections mostly block on dumpsys
+ * and incident_helper, so a few threads go a long way without piling load on
+ * the services being dumped.
+ */
+static const size_t MAX_SECTION_THREADS = 4;
+
 namespace android {
 namespace os {
 namespace incidentd {
@@ -94,6 +107,7 @@ void ReportRequestSet::setMainDest(int dest) {
 bool ReportRequestSet::containsSection(int id) { return mSections.containsSection(id); }
 
 IncidentMetadata::SectionStats* ReportRequestSet::sectionStats(int id) {
+    unique_lock<mutex> lock(mLock);
     if (mSectionStats.find(id) == mSectionStats.end()) {
         IncidentMetadata::SectionStats stats;
         stats.set_id(id);
@@ -102,6 +116,30 @@ IncidentMetadata::SectionStats* ReportRequestSet::sectionStats(int id) {
     return &mSectionStats[id];
 }
 
+void ReportRequestSet::setSectionOrder(const vector<int>& ids) {
+    unique_lock<mutex> lock(mLock);
+    mSectionOrder = ids;
+    mDoneSections.clear();
+}
+
+void ReportRequestSet::waitForWriteTurn(int id) {
+    unique_lock<mutex> lock(mLock);
+    mSectionDoneCv.wait(lock, [this, id] {
+        for (int other : mSectionOrder) {
+            if (other == id) return true;
+            if (mDoneSections.count(other) == 0) return false;
+        }
+        // Not a scheduled section (header/metadata); no need to wait.
+        return true;
+    });
+}
+
+void ReportRequestSet::sectionDone(int id) {
+    unique_lock<mutex> lock(mLock);
+    mDoneSections.insert(id);
+    mSectionDoneCv.notify_all();
+}
+
 // ================================================================================
 Reporter::Reporter() : Reporter(INCIDENT_DIRECTORY) { isTest = false; };
 
@@ -176,45 +214,97 @@ Reporter::run_report_status_t Reporter::runReport(size_t* reportByteSize) {
     headers.Execute(&batch);
 
     // For each of the report fields, see if we need it, and if so, execute the command
-    // and report to those that care that we're doing it.
-    for (const Section** section = SECTION_LIST; *section; section++) {
-        const int id = (*section)->id;
-        if ((*section)->userdebugAndEngOnly && !isUserdebugOrEng) {
-            ALOGD("Skipping incident report section %d '%s' because it's limited to userdebug/eng",
-                  id, (*section)->name.string());
-            continue;
-        }
-        if (this->batch.containsSection(id)) {
-            ALOGD("Taking incident report section %d '%s'", id, (*section)->name.string());
-            for (ReportRequestSet::iterator it = batch.begin(); it != batch.end(); it++) {
-                if ((*it)->listener != NULL && (*it)->args.containsSection(id)) {
-                    (*it)->listener->onReportSectionStatus(
-                            id, IIncidentReportStatusListener::STATUS_STARTING);
-                }
+    // and report to those that care that we're doing it. Sections collect their data
+    // concurrently on a small pool, but their writes into the file descriptors happen
+    // one at a time and in SECTION_LIST order (see ReportRequestSet::waitForWriteTurn),
+    // so one hung dumpsys no longer stalls every section behind it.
+    {
+        vector<const Section*> sectionsToRun;
+        vector<int> sectionOrder;
+        for (const Section** section = SECTION_LIST; *section; section++) {
+            const int id = (*section)->id;
+            if ((*section)->userdebugAndEngOnly && !isUserdebugOrEng) {
+                ALOGD("Skipping incident report section %d '%s' because it's limited to "
+                      "userdebug/eng",
+                      id, (*section)->name.string());
+                continue;
             }
-
-            // Execute - go get the data and write it into the file descriptors.
-            IncidentMetadata::SectionStats* stats = batch.sectionStats(id);
-            int64_t startTime = uptimeMillis();
-            err = (*section)->Execute(&batch);
-            int64_t endTime = uptimeMillis();
-            stats->set_success(err == NO_ERROR);
-            stats->set_exec_duration_ms(endTime - startTime);
-            if (err != NO_ERROR) {
-                ALOGW("Incident section %s (%d) failed: %s. Stopping report.",
-                      (*section)->name.string(), id, strerror(-err));
-                goto DONE;
+            if (this->batch.containsSection(id)) {
+                sectionsToRun.push_back(*section);
+                sectionOrder.push_back(id);
             }
-            (*reportByteSize) += stats->report_size_bytes();
+        }
+        batch.setSectionOrder(sectionOrder);
+
+        atomic<size_t> nextSection(0);
+        atomic<status_t> sectionError(NO_ERROR);
+        atomic<size_t> sectionBytes(0);
+        auto runSections = [&]() {
+            while (true) {
+                const size_t i = nextSection.fetch_add(1);
+                if (i >= sectionsToRun.size()) break;
+                const Section* section = sectionsToRun[i];
+                const int id = section->id;
+                if (sectionError.load() != NO_ERROR) {
+                    // A section already failed; don't start new work, just unblock
+                    // anyone waiting for this section's write turn.
+                    batch.sectionDone(id);
+                    continue;
+                }
+                ALOGD("Taking incident report section %d '%s'", id, section->name.string());
+                for (ReportRequestSet::iterator it = batch.begin(); it != batch.end(); it++) {
+                    if ((*it)->listener != NULL && (*it)->args.containsSection(id)) {
+                        (*it)->listener->onReportSectionStatus(
+                                id, IIncidentReportStatusListener::STATUS_STARTING);
+                    }
+                }
 
-            // Notify listener of starting
-            for (ReportRequestSet::iterator it = batch.begin(); it != batch.end(); it++) {
-                if ((*it)->listener != NULL && (*it)->args.containsSection(id)) {
-                    (*it)->listener->onReportSectionStatus(
-                            id, IIncidentReportStatusListener::STATUS_FINISHED);
+                // Execute - go get the data and write it into the file descriptors.
+                IncidentMetadata::SectionStats* stats = batch.sectionStats(id);
+                int64_t startTime = uptimeMillis();
+                status_t sectionErr = section->Execute(&batch);
+                int64_t endTime = uptimeMillis();
+                stats->set_success(sectionErr == NO_ERROR);
+                stats->set_exec_duration_ms(endTime - startTime);
+                if (sectionErr != NO_ERROR) {
+                    ALOGW("Incident section %s (%d) failed: %s. Stopping report.",
+                          section->name.string(), id, strerror(-sectionErr));
+                    status_t expected = NO_ERROR;
+                    sectionError.compare_exchange_strong(expected, sectionErr);
+                    batch.sectionDone(id);
+                    continue;
+                }
+                sectionBytes += stats->report_size_bytes();
+
+                // Notify listener of finishing
+                for (ReportRequestSet::iterator it = batch.begin(); it != batch.end(); it++) {
+                    if ((*it)->listener != NULL && (*it)->args.containsSection(id)) {
+                        (*it)->listener->onReportSectionStatus(
+                                id, IIncidentReportStatusListener::STATUS_FINISHED);
+                    }
                 }
+                ALOGD("Finish incident report section %d '%s'", id, section->name.string());
+                batch.sectionDone(id);
+            }
+        };
+
+        const size_t poolSize = min(MAX_SECTION_THREADS, sectionsToRun.size());
+        if (poolSize <= 1) {
+            runSections();
+        } else {
+            vector<thread> workers;
+            for (size_t i = 0; i < poolSize; i++) {
+                workers.emplace_back(runSections);
+            }
+            for (thread& worker : workers) {
+                worker.join();
             }
-            ALOGD("Finish incident report section %d '%s'", id, (*section)->name.string());
+        }
+
+        (*reportByteSize) += sectionBytes.load();
+        err = sectionError.load();
+        if (err != NO_ERROR) {
+            goto DONE;
         }
     }
 
@@ -281,6 +371,52 @@ status_t Reporter::create_file(int* fd) {
     return NO_ERROR;
 }
 
+// Reads a base-128 varint out of buf at *pos, true on success.
+static bool read_varint(const string& buf, size_t* pos, uint64_t* val) {
+    uint64_t result = 0;
+    int shift = 0;
+    while (*pos < buf.size()) {
+        uint8_t byte = buf[(*pos)++];
+        result |= ((uint64_t)(byte & 0x7f)) << shift;
+        if ((byte & 0x80) == 0) {
+            *val = result;
+            return true;
+        }
+        shift += 7;
+        if (shift > 63) return false;
+    }
+    return false;
+}
+
+/**
+ * An incident report is a sequence of length-delimited proto fields, one per section.
+ * A report cut short by a crash or reboot can end with a partially written section,
+ * which makes parsers choke on the whole file. Walk the framing and drop any
+ * incomplete trailing section so the completed ones still make it to dropbox.
+ */
+static void repair_report_file(const char* filename) {
+    string content;
+    if (!android::base::ReadFileToString(filename, &content)) {
+        return;
+    }
+    size_t pos = 0;
+    size_t goodEnd = 0;
+    while (pos < content.size()) {
+        uint64_t tag, length;
+        if (!read_varint(content, &pos, &tag)) break;
+        if (read_wire_type(tag) != WIRE_TYPE_LENGTH_DELIMITED) break;
+        if (!read_varint(content, &pos, &length)) break;
+        if (content.size() - pos < length) break;
+        pos += length;
+        goodEnd = pos;
+    }
+    if (goodEnd < content.size()) {
+        ALOGW("Incident report %s ends with an incomplete section, dropping %zu trailing bytes",
+              filename, content.size() - goodEnd);
+        truncate(filename, goodEnd);
+    }
+}
+
 Reporter::run_report_status_t Reporter::upload_backlog() {
     DIR* dir;
     struct dirent* entry;
@@ -315,6 +451,10 @@ Reporter::run_report_status_t Reporter::upload_backlog() {
             continue;
         }
 
+        // These reports were left over by a crash or reboot; drop any half-written
+        // trailing section before handing them off.
+        repair_report_file(filename.string());
+
         Status status = dropbox->addFile(String16("incident"), filename.string(), 0);
         ALOGD("Incident report done. dropbox status=%s\n", status.toString8().string());
         if (!status.isOk()) {
@@ -21,7 +21,10 @@
 #include <android/os/IIncidentReportStatusListener.h>
 #include <android/os/IncidentReportArgs.h>
 
+#include <condition_variable>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -71,6 +74,16 @@ public:
     bool containsSection(int id);
     IncidentMetadata::SectionStats* sectionStats(int id);
 
+    /**
+     * Sections may collect data concurrently, but their output must hit the report
+     * fds one section at a time and in SECTION_LIST order. setSectionOrder names the
+     * sections that will run; waitForWriteTurn blocks until every earlier section is
+     * done; sectionDone marks a section finished (written or failed) and wakes waiters.
+     */
+    void setSectionOrder(const vector<int>& ids);
+    void waitForWriteTurn(int id);
+    void sectionDone(int id);
+
 private:
     vector<sp<ReportRequest>> mRequests;
     IncidentReportArgs mSections;
@@ -79,6 +92,11 @@ private:
 
     IncidentMetadata mMetadata;
     map<int, IncidentMetadata::SectionStats> mSectionStats;
+
+    mutex mLock;
+    condition_variable mSectionDoneCv;
+    vector<int> mSectionOrder;
+    set<int> mDoneSections;
 };
 
 // ================================================================================
@@ -20,7 +20,9 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <unistd.h>
 
+#include <memory>
 #include <mutex>
 #include <set>
 
@@ -80,6 +82,10 @@ static void write_section_stats(IncidentMetadata::SectionStats* stats, const FdB
 // Reads data from FdBuffer and writes it to the requests file descriptor.
 static status_t write_report_requests(const int id, const FdBuffer& buffer,
                                       ReportRequestSet* requests) {
+    // Sections may have collected concurrently; the report fds are written one
+    // section at a time, in SECTION_LIST order.
+    requests->waitForWriteTurn(id);
+
     status_t err = -EBADF;
     EncodedBuffer::iterator data = buffer.data();
     PrivacyBuffer privacyBuffer(get_privacy_of_section(id), data);
@@ -143,6 +149,9 @@ static status_t write_report_requests(const int id, const FdBuffer& buffer,
              requests->mainFd(), spec.dest);
         // Reports bytes of the section uploaded via dropbox after filtering.
         requests->sectionStats(id)->set_report_size_bytes(privacyBuffer.size());
+        // Make completed sections durable right away, so a crash loses at most the
+        // section that was in flight.
+        fdatasync(requests->mainFd());
     }
 
 DONE:
@@ -150,6 +159,50 @@ DONE:
     return writeable > 0 ? NO_ERROR : err;
 }
 
+// ================================================================================
+// Completed section buffers are retained briefly so overlapping or rapid-repeat
+// requests (e.g. the bugreport flow asking for two reports seconds apart) reuse
+// the data that was just collected instead of re-running the expensive dumps.
+// Only the raw, unfiltered capture is cached; write_report_requests still strips
+// it per request, so each request's privacy spec is honored.
+const int64_t SECTION_CACHE_FRESHNESS_NS = 10 * 1000000000LL;
+
+static mutex gSectionCacheLock;
+static map<int, pair<int64_t, shared_ptr<FdBuffer>>> gSectionCache;
+
+static shared_ptr<FdBuffer> get_cached_section(int id) {
+    unique_lock<mutex> lock(gSectionCacheLock);
+    auto found = gSectionCache.find(id);
+    if (found == gSectionCache.end()) {
+        return nullptr;
+    }
+    if (Nanotime() - found->second.first > SECTION_CACHE_FRESHNESS_NS) {
+        gSectionCache.erase(found);
+        return nullptr;
+    }
+    return found->second.second;
+}
+
+static void cache_section(int id, const shared_ptr<FdBuffer>& buffer) {
+    unique_lock<mutex> lock(gSectionCacheLock);
+    const int64_t now = Nanotime();
+    // Drop stale entries so old dumps aren't kept in memory longer than the
+    // freshness window.
+    for (auto it = gSectionCache.begin(); it != gSectionCache.end();) {
+        if (now - it->second.first > SECTION_CACHE_FRESHNESS_NS) {
+            it = gSectionCache.erase(it);
+        } else {
+            it++;
+        }
+    }
+    gSectionCache[id] = make_pair(now, buffer);
+}
+
+void clear_section_cache() {
+    unique_lock<mutex> lock(gSectionCacheLock);
+    gSectionCache.clear();
+}
+
 // ================================================================================
 Section::Section(int i, int64_t timeoutMs, bool userdebugAndEngOnly, bool deviceSpecific)
     : id(i),
@@ -250,6 +303,13 @@ FileSection::FileSection(int id, const char* filename, const bool deviceSpecific
 FileSection::~FileSection() {}
 
 status_t FileSection::Execute(ReportRequestSet* requests) const {
+    shared_ptr<FdBuffer> cached = get_cached_section(this->id);
+    if (cached != nullptr) {
+        VLOG("FileSection '%s' using cached data", this->name.string());
+        write_section_stats(requests->sectionStats(this->id), *cached);
+        return write_report_requests(this->id, *cached, requests);
+    }
+
     // read from mFilename first, make sure the file is available
     // add O_CLOEXEC to make sure it is closed when exec incident helper
     unique_fd fd(open(mFilename, O_RDONLY | O_CLOEXEC));
@@ -258,7 +318,8 @@ status_t FileSection::Execute(ReportRequestSet* requests) const {
         return this->deviceSpecific ? NO_ERROR : -errno;
     }
 
-    FdBuffer buffer;
+    shared_ptr<FdBuffer> bufferPtr = make_shared<FdBuffer>();
+    FdBuffer& buffer = *bufferPtr;
     Fpipe p2cPipe;
     Fpipe c2pPipe;
     // initiate pipes to pass data to/from incident_helper
@@ -294,6 +355,7 @@ status_t FileSection::Execute(ReportRequestSet* requests) const {
 
     VLOG("FileSection '%s' wrote %zd bytes in %d ms", this->name.string(), buffer.size(),
          (int)buffer.durationMs());
+    cache_section(this->id, bufferPtr);
     status_t err = write_report_requests(this->id, buffer, requests);
     if (err != NO_ERROR) {
         ALOGW("FileSection '%s' failed writing: %s", this->name.string(), strerror(-err));
@@ -318,6 +380,13 @@ GZipSection::GZipSection(int id, const char* filename, ...) : Section(id) {
 GZipSection::~GZipSection() { free(mFilenames); }
 
 status_t GZipSection::Execute(ReportRequestSet* requests) const {
+    shared_ptr<FdBuffer> cached = get_cached_section(this->id);
+    if (cached != nullptr) {
+        VLOG("GZipSection '%s' using cached data", this->name.string());
+        write_section_stats(requests->sectionStats(this->id), *cached);
+        return write_report_requests(this->id, *cached, requests);
+    }
+
     // Reads the files in order, use the first available one.
     int index = 0;
     unique_fd fd;
@@ -334,7 +403,8 @@ status_t GZipSection::Execute(ReportRequestSet* requests) const {
         ALOGW("GZipSection %s can't open all the files", this->name.string());
         return NO_ERROR;  // e.g. LAST_KMSG will reach here in user build.
     }
-    FdBuffer buffer;
+    shared_ptr<FdBuffer> bufferPtr = make_shared<FdBuffer>();
+    FdBuffer& buffer = *bufferPtr;
     Fpipe p2cPipe;
     Fpipe c2pPipe;
     // initiate pipes to pass data to/from gzip
@@ -391,6 +461,7 @@ status_t GZipSection::Execute(ReportRequestSet* requests) const {
     internalBuffer->copy(dataBeginAt, dataSize);
     VLOG("GZipSection '%s' wrote %zd bytes in %d ms, dataSize=%zd", this->name.string(),
          buffer.size(), (int)buffer.durationMs(), dataSize);
+    cache_section(this->id, bufferPtr);
     status_t err = write_report_requests(this->id, buffer, requests);
     if (err != NO_ERROR) {
         ALOGW("GZipSection '%s' failed writing: %s", this->name.string(), strerror(-err));
@@ -442,11 +513,19 @@ static void* worker_thread_func(void* cookie) {
 }
 
 status_t WorkerThreadSection::Execute(ReportRequestSet* requests) const {
+    shared_ptr<FdBuffer> cached = get_cached_section(this->id);
+    if (cached != nullptr) {
+        VLOG("WorkerThreadSection '%s' using cached data", this->name.string());
+        write_section_stats(requests->sectionStats(this->id), *cached);
+        return write_report_requests(this->id, *cached, requests);
+    }
+
     status_t err = NO_ERROR;
     pthread_t thread;
     pthread_attr_t attr;
     bool timedOut = false;
-    FdBuffer buffer;
+    shared_ptr<FdBuffer> bufferPtr = make_shared<FdBuffer>();
+    FdBuffer& buffer = *bufferPtr;
 
     // Data shared between this thread and the worker thread.
     sp<WorkerThreadData> data = new WorkerThreadData(this);
@@ -527,6 +606,7 @@ status_t WorkerThreadSection::Execute(ReportRequestSet* requests) const {
     // Write the data that was collected
     VLOG("WorkerThreadSection '%s' wrote %zd bytes in %d ms", name.string(), buffer.size(),
          (int)buffer.durationMs());
+    cache_section(this->id, bufferPtr);
     err = write_report_requests(this->id, buffer, requests);
     if (err != NO_ERROR) {
         ALOGW("WorkerThreadSection '%s' failed writing: '%s'", this->name.string(), strerror(-err));
@@ -565,7 +645,15 @@ CommandSection::CommandSection(int id, const char* command, ...) : Section(id) {
 CommandSection::~CommandSection() { free(mCommand); }
 
 status_t CommandSection::Execute(ReportRequestSet* requests) const {
-    FdBuffer buffer;
+    shared_ptr<FdBuffer> cached = get_cached_section(this->id);
+    if (cached != nullptr) {
+        VLOG("CommandSection '%s' using cached data", this->name.string());
+        write_section_stats(requests->sectionStats(this->id), *cached);
+        return write_report_requests(this->id, *cached, requests);
+    }
+
+    shared_ptr<FdBuffer> bufferPtr = make_shared<FdBuffer>();
+    FdBuffer& buffer = *bufferPtr;
     Fpipe cmdPipe;
     Fpipe ihPipe;
 
@@ -609,6 +697,7 @@ status_t CommandSection::Execute(ReportRequestSet* requests) const {
 
     VLOG("CommandSection '%s' wrote %zd bytes in %d ms", this->name.string(), buffer.size(),
          (int)buffer.durationMs());
+    cache_section(this->id, bufferPtr);
     status_t err = write_report_requests(this->id, buffer, requests);
     if (err != NO_ERROR) {
         ALOGW("CommandSection '%s' failed writing: %s", this->name.string(), strerror(-err));
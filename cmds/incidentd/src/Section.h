@@ -33,6 +33,13 @@ namespace incidentd {
 
 const int64_t REMOTE_CALL_TIMEOUT_MS = 30 * 1000;  // 30 seconds
 
+/**
+ * Completed section buffers are kept briefly so rapid repeat requests can reuse
+ * a freshly collected section instead of re-running the dump. This drops them,
+ * forcing the next request to collect everything again.
+ */
+void clear_section_cache();
+
 /**
  * Base class for sections
  */
@@ -49,7 +49,11 @@ const std::string FIX64_FIELD_3 = "\x19\xff\xff\xff\xff\xff\xff\xff\xff";  // -1
 // NOTICE: this test requires /system/bin/incident_helper is installed.
 class SectionTest : public Test {
 public:
-    virtual void SetUp() override { ASSERT_NE(tf.fd, -1); }
+    virtual void SetUp() override {
+        ASSERT_NE(tf.fd, -1);
+        // Sections in different tests share ids, don't let them reuse data.
+        clear_section_cache();
+    }
 
     void printDebugString(std::string s) {
         fprintf(stderr, "size: %zu\n", s.length());
@@ -143,6 +147,25 @@ TEST_F(SectionTest, FileSection) {
     EXPECT_THAT(GetCapturedStdout(), StrEq("\xa\vatadtsetmai"));
 }
 
+TEST_F(SectionTest, FileSectionReusesCachedData) {
+    FileSection fs(REVERSE_PARSER, tf.path);
+
+    ASSERT_TRUE(WriteStringToFile("iamtestdata", tf.path));
+
+    requests.setMainFd(STDOUT_FILENO);
+
+    CaptureStdout();
+    ASSERT_EQ(NO_ERROR, fs.Execute(&requests));
+    EXPECT_THAT(GetCapturedStdout(), StrEq("\xa\vatadtsetmai"));
+
+    // A second run within the freshness window reuses the first capture instead
+    // of re-reading the (now changed) file.
+    ASSERT_TRUE(WriteStringToFile("somethingelse", tf.path));
+    CaptureStdout();
+    ASSERT_EQ(NO_ERROR, fs.Execute(&requests));
+    EXPECT_THAT(GetCapturedStdout(), StrEq("\xa\vatadtsetmai"));
+}
+
 TEST_F(SectionTest, FileSectionNotExist) {
     FileSection fs1(NOOP_PARSER, "notexist", false, QUICK_TIMEOUT_MS);
     ASSERT_EQ(NAME_NOT_FOUND, fs1.Execute(&requests));
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "FieldValue.h"
+#include "HashableDimensionKey.h"
+#include "stats_log_util.h"
+
+namespace android {
+namespace os {
+namespace statsd {
+
+using android::util::ProtoOutputStream;
+using std::vector;
+
+// Builds keys shaped like a sliced metric over an attribution chain: a
+// two-level tuple (uid, tag) plus a top-level string, which is the layout the
+// encoder sees when flushing attribution-sliced buckets.
+static void createDimensionKeys(int numKeys, vector<HashableDimensionKey>* keys) {
+    keys->reserve(numKeys);
+    for (int i = 0; i < numKeys; i++) {
+        HashableDimensionKey key;
+        int posUid[] = {1, 1, 1};
+        key.addValue(FieldValue(Field(10, posUid, 2), Value(10000 + i)));
+        int posTag[] = {1, 1, 2};
+        key.addValue(FieldValue(Field(10, posTag, 2), Value(std::to_string(i))));
+        int posName[] = {2, 1, 1};
+        key.addValue(FieldValue(Field(10, posName, 0), Value(std::to_string(i % 100))));
+        keys->push_back(key);
+    }
+}
+
+// Serializes a high-cardinality bucket flush: 10k distinct dimension keys
+// written back to back, as onDumpReport does per sliced metric.
+static void BM_WriteDimensionToProto(benchmark::State& state) {
+    vector<HashableDimensionKey> keys;
+    createDimensionKeys(10000, &keys);
+
+    while (state.KeepRunning()) {
+        ProtoOutputStream protoOutput;
+        for (const auto& key : keys) {
+            writeDimensionToProto(key, nullptr /* str_set */, &protoOutput);
+        }
+        benchmark::DoNotOptimize(protoOutput.size());
+    }
+}
+
+BENCHMARK(BM_WriteDimensionToProto);
+
+static void BM_WriteDimensionToProtoWithStrHash(benchmark::State& state) {
+    vector<HashableDimensionKey> keys;
+    createDimensionKeys(10000, &keys);
+
+    while (state.KeepRunning()) {
+        ProtoOutputStream protoOutput;
+        std::set<std::string> strSet;
+        for (const auto& key : keys) {
+            writeDimensionToProto(key, &strSet, &protoOutput);
+        }
+        benchmark::DoNotOptimize(protoOutput.size());
+    }
+}
+
+BENCHMARK(BM_WriteDimensionToProtoWithStrHash);
+
+}  //  namespace statsd
+}  //  namespace os
+}  //  namespace android
@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace android {
+namespace os {
+namespace statsd {
+
+/**
+ * Open-addressing hash map used for the metric producers' current-bucket
+ * state, where std::unordered_map's node allocation per entry both bloats
+ * resident heap and costs a pointer chase per event.
+ *
+ * Entries live inline in one slot array; probing is linear with the hash
+ * cached per slot, so a miss compares integers and never touches the keys.
+ * Deletion uses tombstones rather than backward shifting, which keeps
+ * erase-while-iterating (erase(it) returns the next iterator) valid - the
+ * duration trackers rely on that. Tombstones are reclaimed on rehash.
+ *
+ * Key and T must be default constructible and movable; only the operations
+ * the producers actually use are provided.
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename Eq = std::equal_to<Key>>
+class FlatHashMap {
+public:
+    using value_type = std::pair<Key, T>;
+
+private:
+    enum State : uint8_t {
+        kEmpty = 0,
+        kOccupied = 1,
+        kDeleted = 2,
+    };
+
+    struct Slot {
+        size_t hash = 0;
+        State state = kEmpty;
+        value_type kv;
+    };
+
+    template <bool IsConst>
+    class Iterator {
+        using SlotPtr = typename std::conditional<IsConst, const Slot*, Slot*>::type;
+
+    public:
+        using reference =
+                typename std::conditional<IsConst, const value_type&, value_type&>::type;
+        using pointer = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+
+        Iterator() : mSlot(nullptr), mEnd(nullptr) {
+        }
+
+        Iterator(SlotPtr slot, SlotPtr end) : mSlot(slot), mEnd(end) {
+            skipToOccupied();
+        }
+
+        // A non-const iterator converts to a const one, as with std containers.
+        operator Iterator<true>() const {
+            return Iterator<true>(mSlot, mEnd);
+        }
+
+        reference operator*() const {
+            return mSlot->kv;
+        }
+
+        pointer operator->() const {
+            return &mSlot->kv;
+        }
+
+        Iterator& operator++() {
+            ++mSlot;
+            skipToOccupied();
+            return *this;
+        }
+
+        bool operator==(const Iterator& that) const {
+            return mSlot == that.mSlot;
+        }
+
+        bool operator!=(const Iterator& that) const {
+            return mSlot != that.mSlot;
+        }
+
+    private:
+        friend class FlatHashMap;
+
+        void skipToOccupied() {
+            while (mSlot != mEnd && mSlot->state != kOccupied) {
+                ++mSlot;
+            }
+        }
+
+        SlotPtr mSlot;
+        SlotPtr mEnd;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() {
+    }
+
+    FlatHashMap(std::initializer_list<value_type> init) {
+        reserve(init.size());
+        for (const value_type& kv : init) {
+            (*this)[kv.first] = kv.second;
+        }
+    }
+
+    iterator begin() {
+        return iterator(slotData(), slotData() + mSlots.size());
+    }
+
+    const_iterator begin() const {
+        return const_iterator(slotData(), slotData() + mSlots.size());
+    }
+
+    iterator end() {
+        return iterator(slotData() + mSlots.size(), slotData() + mSlots.size());
+    }
+
+    const_iterator end() const {
+        return const_iterator(slotData() + mSlots.size(), slotData() + mSlots.size());
+    }
+
+    size_t size() const {
+        return mSize;
+    }
+
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    void clear() {
+        mSlots.clear();
+        mSize = 0;
+        mTombstones = 0;
+    }
+
+    void reserve(size_t count) {
+        // Headroom so `count` inserts stay below the load factor.
+        size_t capacity = kMinCapacity;
+        while (capacity * 3 < count * 4) {
+            capacity <<= 1;
+        }
+        if (capacity > mSlots.size()) {
+            rehash(capacity);
+        }
+    }
+
+    iterator find(const Key& key) {
+        size_t index;
+        return findIndex(key, &index) ? makeIterator(index) : end();
+    }
+
+    const_iterator find(const Key& key) const {
+        size_t index;
+        return findIndex(key, &index) ? makeConstIterator(index) : end();
+    }
+
+    size_t count(const Key& key) const {
+        size_t index;
+        return findIndex(key, &index) ? 1 : 0;
+    }
+
+    T& operator[](const Key& key) {
+        return tryInsert(key).first->second;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& kv) {
+        std::pair<iterator, bool> result = tryInsert(kv.first);
+        if (result.second) {
+            result.first->second = kv.second;
+        }
+        return result;
+    }
+
+    std::pair<iterator, bool> insert(value_type&& kv) {
+        std::pair<iterator, bool> result = tryInsert(kv.first);
+        if (result.second) {
+            result.first->second = std::move(kv.second);
+        }
+        return result;
+    }
+
+    size_t erase(const Key& key) {
+        size_t index;
+        if (!findIndex(key, &index)) {
+            return 0;
+        }
+        eraseSlot(index);
+        return 1;
+    }
+
+    iterator erase(const_iterator position) {
+        size_t index = position.mSlot - slotData();
+        eraseSlot(index);
+        return makeIterator(index);
+    }
+
+private:
+    static const size_t kMinCapacity = 16;
+
+    Slot* slotData() {
+        return mSlots.data();
+    }
+
+    const Slot* slotData() const {
+        return mSlots.data();
+    }
+
+    iterator makeIterator(size_t index) {
+        return iterator(slotData() + index, slotData() + mSlots.size());
+    }
+
+    const_iterator makeConstIterator(size_t index) const {
+        return const_iterator(slotData() + index, slotData() + mSlots.size());
+    }
+
+    bool findIndex(const Key& key, size_t* outIndex) const {
+        if (mSlots.empty()) {
+            return false;
+        }
+        const size_t mask = mSlots.size() - 1;
+        const size_t hash = Hash()(key);
+        for (size_t index = hash & mask;; index = (index + 1) & mask) {
+            const Slot& slot = mSlots[index];
+            if (slot.state == kEmpty) {
+                return false;
+            }
+            if (slot.state == kOccupied && slot.hash == hash && Eq()(slot.kv.first, key)) {
+                *outIndex = index;
+                return true;
+            }
+        }
+    }
+
+    // Finds the key or claims a slot for it (reusing the first tombstone on
+    // the probe path). Returns the iterator plus whether a new entry was made.
+    std::pair<iterator, bool> tryInsert(const Key& key) {
+        // Keep occupied + tombstone slots at or below 3/4 of capacity.
+        if ((mSize + mTombstones + 1) * 4 > mSlots.size() * 3) {
+            // If most of the waste is tombstones, rehashing in place is enough.
+            rehash(mSize * 4 > mSlots.size()
+                           ? std::max(mSlots.size() * 2, static_cast<size_t>(kMinCapacity))
+                           : std::max(mSlots.size(), static_cast<size_t>(kMinCapacity)));
+        }
+        const size_t mask = mSlots.size() - 1;
+        const size_t hash = Hash()(key);
+        size_t insertIndex = mSlots.size();
+        for (size_t index = hash & mask;; index = (index + 1) & mask) {
+            Slot& slot = mSlots[index];
+            if (slot.state == kEmpty) {
+                if (insertIndex == mSlots.size()) {
+                    insertIndex = index;
+                }
+                break;
+            }
+            if (slot.state == kDeleted) {
+                if (insertIndex == mSlots.size()) {
+                    insertIndex = index;
+                }
+                continue;
+            }
+            if (slot.hash == hash && Eq()(slot.kv.first, key)) {
+                return {makeIterator(index), false};
+            }
+        }
+        Slot& slot = mSlots[insertIndex];
+        if (slot.state == kDeleted) {
+            mTombstones--;
+        }
+        slot.hash = hash;
+        slot.state = kOccupied;
+        slot.kv.first = key;
+        mSize++;
+        return {makeIterator(insertIndex), true};
+    }
+
+    void eraseSlot(size_t index) {
+        Slot& slot = mSlots[index];
+        slot.state = kDeleted;
+        // Release whatever the entry owned right away.
+        slot.kv = value_type();
+        mSize--;
+        mTombstones++;
+    }
+
+    void rehash(size_t newCapacity) {
+        std::vector<Slot> oldSlots;
+        oldSlots.swap(mSlots);
+        mSlots.resize(newCapacity);
+        mTombstones = 0;
+        const size_t mask = newCapacity - 1;
+        for (Slot& oldSlot : oldSlots) {
+            if (oldSlot.state != kOccupied) {
+                continue;
+            }
+            size_t index = oldSlot.hash & mask;
+            while (mSlots[index].state == kOccupied) {
+                index = (index + 1) & mask;
+            }
+            mSlots[index].hash = oldSlot.hash;
+            mSlots[index].state = kOccupied;
+            mSlots[index].kv = std::move(oldSlot.kv);
+        }
+    }
+
+    std::vector<Slot> mSlots;
+    size_t mSize = 0;
+    size_t mTombstones = 0;
+};
+
+}  // namespace statsd
+}  // namespace os
+}  // namespace android
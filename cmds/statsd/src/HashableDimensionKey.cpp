@@ -16,7 +16,9 @@
 #define DEBUG false  // STOPSHIP if true
 #include "Log.h"
 
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #include "HashableDimensionKey.h"
 #include "FieldValue.h"
@@ -28,9 +30,43 @@ namespace statsd {
 using std::string;
 using std::vector;
 
-android::hash_t hashDimension(const HashableDimensionKey& value) {
+namespace {
+
+/**
+ * Process-wide intern table mapping dimension tuples to canonical storage
+ * and a 64 bit id. Keyed by content hash; entries with colliding hashes
+ * chain in the multimap and are disambiguated by value comparison.
+ */
+struct InternedTuple {
+    std::shared_ptr<const vector<FieldValue>> tuple;
+    uint64_t id;
+};
+
+std::mutex gInternLock;
+std::unordered_multimap<android::hash_t, InternedTuple> gInternedTuples;
+uint64_t gNextTupleId = 0;
+
+// The dimension guardrails bound live keys per metric; this caps the table
+// against pathological configs. Past the cap keys keep their cached hash
+// but fall back to value comparison.
+constexpr size_t kMaxInternedTuples = 1 << 16;
+
+bool equalValues(const vector<FieldValue>& s1, const vector<FieldValue>& s2) {
+    if (s1.size() != s2.size()) {
+        return false;
+    }
+    size_t count = s1.size();
+    for (size_t i = 0; i < count; i++) {
+        if (s1[i] != s2[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+android::hash_t computeDimensionHash(const vector<FieldValue>& values) {
     android::hash_t hash = 0;
-    for (const auto& fieldValue : value.getValues()) {
+    for (const auto& fieldValue : values) {
         hash = android::JenkinsHashMix(hash, android::hash_type((int)fieldValue.mField.getField()));
         hash = android::JenkinsHashMix(hash, android::hash_type((int)fieldValue.mField.getTag()));
         hash = android::JenkinsHashMix(hash, android::hash_type((int)fieldValue.mValue.getType()));
@@ -59,6 +95,52 @@ android::hash_t hashDimension(const HashableDimensionKey& value) {
     return JenkinsHashWhiten(hash);
 }
 
+}  // namespace
+
+android::hash_t hashDimension(const HashableDimensionKey& value) {
+    // Hashing is the funnel every map operation goes through, so it is
+    // where lazy interning happens; afterwards the hash is a cached load.
+    value.intern();
+    return value.getCachedHash();
+}
+
+void HashableDimensionKey::intern() const {
+    if (mInterned != nullptr || mHashCached) {
+        return;
+    }
+    mCachedHash = computeDimensionHash(mValues);
+    mHashCached = true;
+
+    std::lock_guard<std::mutex> lock(gInternLock);
+    auto range = gInternedTuples.equal_range(mCachedHash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (equalValues(*(it->second.tuple), mValues)) {
+            mInterned = it->second.tuple;
+            mInternedId = it->second.id;
+            vector<FieldValue>().swap(mValues);
+            return;
+        }
+    }
+    if (gInternedTuples.size() >= kMaxInternedTuples) {
+        return;
+    }
+    auto tuple = std::make_shared<const vector<FieldValue>>(std::move(mValues));
+    mValues.clear();
+    mInterned = tuple;
+    mInternedId = ++gNextTupleId;
+    gInternedTuples.emplace(mCachedHash, InternedTuple{std::move(tuple), mInternedId});
+}
+
+void HashableDimensionKey::deintern() {
+    if (mInterned != nullptr) {
+        mValues = *mInterned;
+        mInterned.reset();
+        mInternedId = 0;
+    }
+    mCachedHash = 0;
+    mHashCached = false;
+}
+
 bool filterValues(const vector<Matcher>& matcherFields, const vector<FieldValue>& values,
                   HashableDimensionKey* output) {
     size_t num_matches = 0;
@@ -125,16 +207,13 @@ bool LessThan(const vector<FieldValue>& s1, const vector<FieldValue>& s2) {
 }
 
 bool HashableDimensionKey::operator==(const HashableDimensionKey& that) const {
-    if (mValues.size() != that.getValues().size()) {
-        return false;
+    // Canonical tuples are unique, so two interned keys match exactly when
+    // their ids do. Map lookups hash (and thus intern) both sides first,
+    // which makes this the common path.
+    if (mInternedId != 0 && that.mInternedId != 0) {
+        return mInternedId == that.mInternedId;
     }
-    size_t count = mValues.size();
-    for (size_t i = 0; i < count; i++) {
-        if (mValues[i] != (that.getValues())[i]) {
-            return false;
-        }
-    }
-    return true;
+    return equalValues(getValues(), that.getValues());
 };
 
 bool HashableDimensionKey::operator<(const HashableDimensionKey& that) const {
@@ -142,17 +221,17 @@ bool HashableDimensionKey::operator<(const HashableDimensionKey& that) const {
 };
 
 bool HashableDimensionKey::contains(const HashableDimensionKey& that) const {
-    if (mValues.size() < that.getValues().size()) {
+    if (getValues().size() < that.getValues().size()) {
         return false;
     }
 
-    if (mValues.size() == that.getValues().size()) {
+    if (getValues().size() == that.getValues().size()) {
         return (*this) == that;
     }
 
     for (const auto& value : that.getValues()) {
         bool found = false;
-        for (const auto& myValue : mValues) {
+        for (const auto& myValue : getValues()) {
             if (value.mField == myValue.mField && value.mValue == myValue.mValue) {
                 found = true;
                 break;
@@ -168,7 +247,7 @@ bool HashableDimensionKey::contains(const HashableDimensionKey& that) const {
 
 string HashableDimensionKey::toString() const {
     std::string output;
-    for (const auto& value : mValues) {
+    for (const auto& value : getValues()) {
         output += StringPrintf("(%d)%#x->%s ", value.mField.getTag(), value.mField.getField(),
                                value.mValue.toString().c_str());
     }
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <utils/JenkinsHash.h>
+#include <memory>
 #include <vector>
 #include "FieldValue.h"
 #include "android-base/stringprintf.h"
@@ -42,27 +43,51 @@ public:
 
     HashableDimensionKey() {};
 
-    HashableDimensionKey(const HashableDimensionKey& that) : mValues(that.getValues()){};
+    // Copying an interned key only bumps the refcount on the shared tuple;
+    // the member-wise default keeps that property.
+    HashableDimensionKey(const HashableDimensionKey& that) = default;
+
+    HashableDimensionKey& operator=(const HashableDimensionKey& that) = default;
 
     inline void addValue(const FieldValue& value) {
+        prepareMutation();
         mValues.push_back(value);
     }
 
     inline const std::vector<FieldValue>& getValues() const {
-        return mValues;
+        return mInterned != nullptr ? *mInterned : mValues;
     }
 
     inline std::vector<FieldValue>* mutableValues() {
+        prepareMutation();
         return &mValues;
     }
 
     inline FieldValue* mutableValue(size_t i) {
+        prepareMutation();
         if (i >= 0 && i < mValues.size()) {
             return &(mValues[i]);
         }
         return nullptr;
     }
 
+    /**
+     * Swaps the private value vector for a canonical tuple shared by every
+     * key with the same values, identified by a process-wide 64 bit id.
+     * Called lazily the first time the key is hashed, so per-event lookup
+     * keys and the map copies made from them end up sharing one allocation
+     * and comparing by id. Idempotent; a later mutation un-interns the key.
+     */
+    void intern() const;
+
+    inline uint64_t getInternedId() const {
+        return mInternedId;
+    }
+
+    inline android::hash_t getCachedHash() const {
+        return mCachedHash;
+    }
+
     std::string toString() const;
 
     bool operator==(const HashableDimensionKey& that) const;
@@ -72,7 +97,25 @@ public:
     bool contains(const HashableDimensionKey& that) const;
 
 private:
-    std::vector<FieldValue> mValues;
+    // Copies the canonical tuple back into private storage so it can be
+    // modified. Freshly built keys are never interned, so the common
+    // build path never takes this branch.
+    void deintern();
+
+    inline void prepareMutation() {
+        if (mInterned != nullptr || mHashCached) {
+            deintern();
+        }
+    }
+
+    // mValues holds the fields until the key is interned; afterwards the
+    // canonical tuple does and mValues stays empty. Mutable because
+    // interning is a caching operation triggered from const lookups.
+    mutable std::vector<FieldValue> mValues;
+    mutable std::shared_ptr<const std::vector<FieldValue>> mInterned;
+    mutable uint64_t mInternedId = 0;
+    mutable android::hash_t mCachedHash = 0;
+    mutable bool mHashCached = false;
 };
 
 class MetricDimensionKey {
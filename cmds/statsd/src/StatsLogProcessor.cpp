@@ -33,6 +33,8 @@
 #include <utils/Errors.h>
 #include <utils/SystemClock.h>
 
+#include <algorithm>
+
 using namespace android;
 using android::base::StringPrintf;
 using android::util::FIELD_COUNT_REPEATED;
@@ -69,8 +71,6 @@ const int FIELD_ID_STRINGS = 9;
 
 #define NS_PER_HOUR 3600 * NS_PER_SEC
 
-#define STATS_DATA_DIR "/data/misc/stats-data"
-
 // Cool down period for writing data to disk to avoid overwriting files.
 #define WRITE_DATA_COOL_DOWN_SEC 5
 
@@ -90,6 +90,92 @@ StatsLogProcessor::StatsLogProcessor(const sp<UidMap>& uidMap,
 }
 
 StatsLogProcessor::~StatsLogProcessor() {
+    for (auto& shard : mEventShards) {
+        std::lock_guard<std::mutex> lock(shard->lock);
+        shard->exit = true;
+        shard->cond.notify_one();
+    }
+    for (auto& shard : mEventShards) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+    }
+}
+
+void StatsLogProcessor::startEventShardsLocked() {
+    const size_t laneCount =
+            std::min<size_t>(4, std::max(1u, std::thread::hardware_concurrency()));
+    // The dispatching thread is the first lane; only the rest get threads.
+    for (size_t i = 1; i < laneCount; i++) {
+        auto shard = std::make_unique<EventShard>();
+        shard->thread = std::thread(&StatsLogProcessor::runEventShard, this, shard.get());
+        mEventShards.push_back(std::move(shard));
+    }
+}
+
+void StatsLogProcessor::runEventShard(EventShard* shard) {
+    std::unique_lock<std::mutex> lock(shard->lock);
+    while (true) {
+        shard->cond.wait(lock, [shard] { return shard->hasWork || shard->exit; });
+        if (shard->exit) {
+            return;
+        }
+
+        const LogEvent* event = shard->event;
+        lock.unlock();
+        for (MetricsManager* manager : shard->work) {
+            manager->onLogEvent(*event);
+        }
+        lock.lock();
+        shard->hasWork = false;
+
+        std::lock_guard<std::mutex> doneLock(mShardDoneLock);
+        if (--mShardsPending == 0) {
+            mShardDoneCondition.notify_one();
+        }
+    }
+}
+
+void StatsLogProcessor::processEventShardedLocked(LogEvent* event) {
+    // Materialize the event's fields once here; the lazy parse is not
+    // synchronized, so it must not race across shards.
+    event->getValues();
+
+    // Partition the managers round robin over the lanes. The sp references
+    // in mMetricsManagers outlive the join because mMetricsMutex is held.
+    const size_t laneCount = mEventShards.size() + 1;
+    std::vector<std::vector<MetricsManager*>> lanes(laneCount);
+    size_t next = 0;
+    for (auto& pair : mMetricsManagers) {
+        lanes[next++ % laneCount].push_back(pair.second.get());
+    }
+
+    {
+        std::lock_guard<std::mutex> doneLock(mShardDoneLock);
+        mShardsPending = mEventShards.size();
+    }
+    for (size_t i = 0; i < mEventShards.size(); i++) {
+        EventShard* shard = mEventShards[i].get();
+        std::lock_guard<std::mutex> lock(shard->lock);
+        shard->work = std::move(lanes[i + 1]);
+        shard->event = event;
+        shard->hasWork = true;
+        shard->cond.notify_one();
+    }
+
+    // Work the first lane on this thread, then wait for the others.
+    for (MetricsManager* manager : lanes[0]) {
+        manager->onLogEvent(*event);
+    }
+    {
+        std::unique_lock<std::mutex> doneLock(mShardDoneLock);
+        mShardDoneCondition.wait(doneLock, [this] { return mShardsPending == 0; });
+    }
+
+    // The flush checks mutate shared bookkeeping, so they stay here.
+    for (auto& pair : mMetricsManagers) {
+        flushIfNecessaryLocked(event->GetElapsedTimestampNs(), pair.first, *(pair.second));
+    }
 }
 
 void StatsLogProcessor::onAnomalyAlarmFired(
@@ -252,6 +338,16 @@ void StatsLogProcessor::OnLogEvent(LogEvent* event, bool reconnected) {
     }
 
     // pass the event to metrics managers.
+    if (mMetricsManagers.size() >= kMinConfigsForSharding) {
+        if (!mEventShardsStarted) {
+            startEventShardsLocked();
+            mEventShardsStarted = true;
+        }
+        if (!mEventShards.empty()) {
+            processEventShardedLocked(event);
+            return;
+        }
+    }
     for (auto& pair : mMetricsManagers) {
         pair.second->onLogEvent(*event);
         flushIfNecessaryLocked(event->GetElapsedTimestampNs(), pair.first, *(pair.second));
@@ -261,6 +357,15 @@ void StatsLogProcessor::OnLogEvent(LogEvent* event, bool reconnected) {
 void StatsLogProcessor::OnConfigUpdated(const int64_t timestampNs, const ConfigKey& key,
                                         const StatsdConfig& config) {
     std::lock_guard<std::mutex> lock(mMetricsMutex);
+    const auto it = mMetricsManagers.find(key);
+    if (it != mMetricsManagers.end() && it->second->sameConfig(config)) {
+        // The config server re-pushed a byte-identical config. Keep the
+        // existing trackers and producers, and the in-flight buckets they have
+        // accumulated, instead of rebuilding everything from scratch.
+        VLOG("Config %s unchanged, keeping existing metrics manager", key.ToString().c_str());
+        it->second->refreshTtl(timestampNs);
+        return;
+    }
     WriteDataToDiskLocked(key, timestampNs, CONFIG_UPDATED);
     OnConfigUpdatedLocked(timestampNs, key, config);
 }
@@ -360,6 +465,55 @@ void StatsLogProcessor::onDumpReport(const ConfigKey& key, const int64_t dumpTim
     StatsdStats::getInstance().noteMetricsReportSent(key, proto.size());
 }
 
+/*
+ * onDumpReport streams a serialized ConfigMetricsReportList to the fd. Each
+ * top-level section (config key, reports recovered from disk, the live
+ * report) is serialized into its own proto and flushed before the next one is
+ * built, so the whole report is never resident in memory at once.
+ */
+void StatsLogProcessor::onDumpReport(const ConfigKey& key, const int64_t dumpTimeStampNs,
+                                     const bool include_current_partial_bucket,
+                                     const DumpReportReason dumpReportReason, const int fd) {
+    std::lock_guard<std::mutex> lock(mMetricsMutex);
+
+    size_t reportSize = 0;
+    {
+        ProtoOutputStream proto;
+        uint64_t configKeyToken = proto.start(FIELD_TYPE_MESSAGE | FIELD_ID_CONFIG_KEY);
+        proto.write(FIELD_TYPE_INT32 | FIELD_ID_UID, key.GetUid());
+        proto.write(FIELD_TYPE_INT64 | FIELD_ID_ID, (long long)key.GetId());
+        proto.end(configKeyToken);
+        proto.flush(fd);
+        reportSize += proto.size();
+    }
+
+    {
+        // Reports persisted before previous shutdowns.
+        ProtoOutputStream proto;
+        StorageManager::appendConfigMetricsReport(key, &proto);
+        proto.flush(fd);
+        reportSize += proto.size();
+    }
+
+    auto it = mMetricsManagers.find(key);
+    if (it != mMetricsManagers.end()) {
+        mLastBroadcastTimes.erase(key);
+
+        ProtoOutputStream proto;
+        uint64_t reportsToken =
+                proto.start(FIELD_TYPE_MESSAGE | FIELD_COUNT_REPEATED | FIELD_ID_REPORTS);
+        onConfigMetricsReportLocked(key, dumpTimeStampNs, include_current_partial_bucket,
+                                    dumpReportReason, &proto);
+        proto.end(reportsToken);
+        proto.flush(fd);
+        reportSize += proto.size();
+    } else {
+        ALOGW("Config source %s does not exist", key.ToString().c_str());
+    }
+
+    StatsdStats::getInstance().noteMetricsReportSent(key, reportSize);
+}
+
 /*
  * onConfigMetricsReportLocked dumps serialized ConfigMetricsReport into outData.
  */
@@ -514,15 +668,17 @@ void StatsLogProcessor::WriteDataToDiskLocked(const ConfigKey& key,
     ProtoOutputStream proto;
     onConfigMetricsReportLocked(key, timestampNs, true /* include_current_partial_bucket*/,
                                 dumpReportReason, &proto);
-    string file_name = StringPrintf("%s/%ld_%d_%lld", STATS_DATA_DIR,
-         (long)getWallClockSec(), key.GetUid(), (long long)key.GetId());
-    android::base::unique_fd fd(open(file_name.c_str(),
-                                O_WRONLY | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR));
-    if (fd == -1) {
-        ALOGE("Attempt to write %s but failed", file_name.c_str());
-        return;
-    }
-    proto.flush(fd.get());
+    vector<uint8_t> buffer(proto.size());
+    size_t pos = 0;
+    auto iter = proto.data();
+    while (iter.readBuffer() != NULL) {
+        size_t toRead = iter.currentToRead();
+        std::memcpy(&(buffer[pos]), iter.readBuffer(), toRead);
+        pos += toRead;
+        iter.rp()->move(toRead);
+    }
+    // Append to the segment store instead of creating a file per report.
+    StorageManager::writeDataRecord(key, buffer.data(), buffer.size());
     // We were able to write the ConfigMetricsReport to disk, so we should trigger collection ASAP.
     mOnDiskDataConfigs.insert(key);
 }
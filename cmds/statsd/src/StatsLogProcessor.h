@@ -26,7 +26,12 @@
 #include "frameworks/base/cmds/statsd/src/statsd_config.pb.h"
 
 #include <stdio.h>
+
+#include <condition_variable>
+#include <memory>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace android {
 namespace os {
@@ -67,6 +72,15 @@ public:
                       const bool include_current_partial_bucket,
                       const DumpReportReason dumpReportReason, vector<uint8_t>* outData);
 
+    // Streams the report to the given fd section by section, so peak memory is
+    // bounded by the largest top-level section instead of the whole
+    // ConfigMetricsReportList. Use this for fd-backed consumers (adb dump);
+    // the binder getData path has to return a byte array and keeps the
+    // overload above.
+    void onDumpReport(const ConfigKey& key, const int64_t dumpTimeNs,
+                      const bool include_current_partial_bucket,
+                      const DumpReportReason dumpReportReason, const int fd);
+
     /* Tells MetricsManager that the alarms in alarmSet have fired. Modifies anomaly alarmSet. */
     void onAnomalyAlarmFired(
             const int64_t& timestampNs,
@@ -152,6 +166,44 @@ private:
     void flushIfNecessaryLocked(int64_t timestampNs, const ConfigKey& key,
                                 MetricsManager& metricsManager);
 
+    /**
+     * One lane of the event fan-out. The dispatching thread hands a shard
+     * its slice of the MetricsManagers for the current event and the shard
+     * runs their matching; the dispatcher itself works the first slice and
+     * then joins. Shards only ever run while the dispatcher holds
+     * mMetricsMutex, so the managers cannot change underneath them.
+     */
+    struct EventShard {
+        std::mutex lock;
+        std::condition_variable cond;
+        std::vector<MetricsManager*> work;
+        const LogEvent* event = nullptr;
+        bool hasWork = false;
+        bool exit = false;
+        std::thread thread;
+    };
+
+    // Below this many configs the fan-out overhead outweighs the win.
+    static const size_t kMinConfigsForSharding = 8;
+
+    // Starts the shard worker threads; no-op when one core is all we have.
+    void startEventShardsLocked();
+
+    // Worker body for one shard.
+    void runEventShard(EventShard* shard);
+
+    // Runs every manager's matching for the event across the shards, then
+    // does the per-config flush checks on the calling thread.
+    void processEventShardedLocked(LogEvent* event);
+
+    std::vector<std::unique_ptr<EventShard>> mEventShards;
+
+    bool mEventShardsStarted = false;
+
+    std::mutex mShardDoneLock;
+    std::condition_variable mShardDoneCondition;
+    size_t mShardsPending = 0;
+
     // Maps the isolated uid in the log event to host uid if the log event contains uid fields.
     void mapIsolatedUidToHostUidIfNecessaryLocked(LogEvent* event) const;
 
@@ -195,6 +247,7 @@ private:
     FRIEND_TEST(StatsLogProcessorTest, TestRateLimitByteSize);
     FRIEND_TEST(StatsLogProcessorTest, TestRateLimitBroadcast);
     FRIEND_TEST(StatsLogProcessorTest, TestDropWhenByteSizeTooLarge);
+    FRIEND_TEST(StatsLogProcessorTest, TestUnchangedConfigKeepsMetricsManager);
     FRIEND_TEST(WakelockDurationE2eTest, TestAggregatedPredicateDimensionsForSumDuration1);
     FRIEND_TEST(WakelockDurationE2eTest, TestAggregatedPredicateDimensionsForSumDuration2);
     FRIEND_TEST(WakelockDurationE2eTest, TestAggregatedPredicateDimensionsForSumDuration3);
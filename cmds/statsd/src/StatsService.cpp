@@ -600,15 +600,18 @@ status_t StatsService::cmd_dump_report(FILE* out, FILE* err, const Vector<String
             }
         }
         if (good) {
-            vector<uint8_t> data;
-            mProcessor->onDumpReport(ConfigKey(uid, StrToInt64(name)), getElapsedRealtimeNs(),
-                                     false /* include_current_bucket*/, ADB_DUMP, &data);
-            // TODO: print the returned StatsLogReport to file instead of printing to logcat.
             if (proto) {
-                for (size_t i = 0; i < data.size(); i ++) {
-                    fprintf(out, "%c", data[i]);
-                }
+                // Stream the serialized report straight to the output instead
+                // of buffering the whole thing in memory first.
+                fflush(out);
+                mProcessor->onDumpReport(ConfigKey(uid, StrToInt64(name)), getElapsedRealtimeNs(),
+                                         false /* include_current_bucket*/, ADB_DUMP,
+                                         fileno(out));
             } else {
+                vector<uint8_t> data;
+                mProcessor->onDumpReport(ConfigKey(uid, StrToInt64(name)), getElapsedRealtimeNs(),
+                                         false /* include_current_bucket*/, ADB_DUMP, &data);
+                // TODO: print the returned StatsLogReport to file instead of printing to logcat.
                 fprintf(out, "Dump report for Config [%d,%s]\n", uid, name.c_str());
                 fprintf(out, "See the StatsLogReport in logcat...\n");
             }
@@ -90,6 +90,52 @@ void AlarmMonitor::remove(sp<const InternalAlarm> alarm) {
     }
 }
 
+void AlarmMonitor::applyUpdates(const std::vector<sp<const InternalAlarm>>& removed,
+                                const std::vector<sp<const InternalAlarm>>& added) {
+    std::lock_guard<std::mutex> lock(mLock);
+    bool changed = false;
+    for (const sp<const InternalAlarm>& alarm : removed) {
+        if (alarm == nullptr) {
+            continue;
+        }
+        VLOG("Batch removing alarm with time %u", alarm->timestampSec);
+        changed |= mPq.remove(alarm);
+    }
+    for (const sp<const InternalAlarm>& alarm : added) {
+        if (alarm == nullptr) {
+            ALOGW("Asked to add a null alarm.");
+            continue;
+        }
+        if (alarm->timestampSec < 1) {
+            // forbidden since a timestamp 0 is used to indicate no alarm registered
+            ALOGW("Asked to add a 0-time alarm.");
+            continue;
+        }
+        VLOG("Batch adding alarm with time %u", alarm->timestampSec);
+        mPq.push(alarm);
+        changed = true;
+    }
+    if (!changed) {
+        return;
+    }
+    // Reconcile the registered alarm once for the whole batch; only
+    // re-program StatsCompanion if the soonest deadline actually moved.
+    if (mPq.empty()) {
+        if (mRegisteredAlarmTimeSec >= 1) {
+            VLOG("Queue is empty. Cancel any alarm.");
+            cancelRegisteredAlarmTime_l();
+        }
+        return;
+    }
+    uint32_t soonestAlarmTimeSec = mPq.top()->timestampSec;
+    VLOG("Soonest alarm is %u", soonestAlarmTimeSec);
+    if (mRegisteredAlarmTimeSec < 1 ||
+        soonestAlarmTimeSec + mMinUpdateTimeSec < mRegisteredAlarmTimeSec ||
+        soonestAlarmTimeSec > mRegisteredAlarmTimeSec + mMinUpdateTimeSec) {
+        updateRegisteredAlarmTime_l(soonestAlarmTimeSec);
+    }
+}
+
 // More efficient than repeatedly calling remove(mPq.top()) since it batches the
 // updates to the registered alarm.
 unordered_set<sp<const InternalAlarm>, SpHash<InternalAlarm>> AlarmMonitor::popSoonerThan(
@@ -90,6 +90,17 @@ public:
      */
     void remove(sp<const InternalAlarm> alarm);
 
+    /**
+     * Applies a batch of removals and additions to the queue under one lock,
+     * then reconciles the registered alarm once. The alarm registered with
+     * StatsCompanionService is only re-programmed if the soonest deadline
+     * moved by more than minDiffToUpdateRegisteredAlarmTimeSec, so staging a
+     * remove/add pair (or a wave of them) costs at most one binder call.
+     * Null alarms and alarms absent from the queue are ignored.
+     */
+    void applyUpdates(const std::vector<sp<const InternalAlarm>>& removed,
+                      const std::vector<sp<const InternalAlarm>>& added);
+
     /**
      * Returns and removes all alarms whose timestamp <= the given timestampSec.
      * Always updates the registered alarm if return is non-empty.
@@ -44,15 +44,18 @@ void DurationAnomalyTracker::startAlarm(const MetricDimensionKey& dimensionKey,
         return;
     }
 
+    sp<const InternalAlarm> oldAlarm;
     auto itr = mAlarms.find(dimensionKey);
-    if (itr != mAlarms.end() && mAlarmMonitor != nullptr) {
-        mAlarmMonitor->remove(itr->second);
+    if (itr != mAlarms.end()) {
+        oldAlarm = itr->second;
     }
 
     sp<const InternalAlarm> alarm = new InternalAlarm{timestampSec};
     mAlarms[dimensionKey] = alarm;
     if (mAlarmMonitor != nullptr) {
-        mAlarmMonitor->add(alarm);
+        // Stage the replacement as one batch so the registered alarm is
+        // reconciled once instead of on both the remove and the add.
+        mAlarmMonitor->applyUpdates({oldAlarm}, {alarm});
     }
 }
 
@@ -74,10 +77,15 @@ void DurationAnomalyTracker::stopAlarm(const MetricDimensionKey& dimensionKey,
 }
 
 void DurationAnomalyTracker::cancelAllAlarms() {
-    if (mAlarmMonitor != nullptr) {
+    if (mAlarmMonitor != nullptr && !mAlarms.empty()) {
+        std::vector<sp<const InternalAlarm>> removed;
+        removed.reserve(mAlarms.size());
         for (const auto& itr : mAlarms) {
-            mAlarmMonitor->remove(itr.second);
+            removed.push_back(itr.second);
         }
+        // One pass over the queue and at most one binder call, instead of a
+        // potential re-program per high-cardinality dimension.
+        mAlarmMonitor->applyUpdates(removed, {});
     }
     mAlarms.clear();
 }
@@ -55,10 +55,14 @@ void triggerSubscribers(const int64_t rule_id,
                 }
                 break;
             case Subscription::SubscriberInformationCase::kPerfettoDetails:
-                if (!CollectPerfettoTraceAndUploadToDropbox(subscription.perfetto_details(),
-                                                            rule_id, configKey)) {
-                    ALOGW("Failed to generate perfetto traces.");
-                }
+                // Queued to the trace collection thread so anomaly handling
+                // never blocks on the perfetto fork/exec and config handshake.
+                CollectPerfettoTraceAndUploadToDropboxAsync(
+                        subscription.perfetto_details(), rule_id, configKey, [](bool success) {
+                            if (!success) {
+                                ALOGW("Failed to generate perfetto traces.");
+                            }
+                        });
                 break;
             case Subscription::SubscriberInformationCase::kBroadcastSubscriberDetails:
                 SubscriberReporter::getInstance().alertBroadcastSubscriber(configKey, subscription,
@@ -38,59 +38,48 @@ using std::unordered_map;
 using std::vector;
 
 
-ConditionState evaluateCombinationCondition(const std::vector<int>& children,
-                                            const LogicalOperation& operation,
-                                            const std::vector<ConditionState>& conditionCache) {
-    ConditionState newCondition;
+namespace {
 
-    bool hasUnknown = false;
-    bool hasFalse = false;
-    bool hasTrue = false;
+// Child states are folded into a 4-bit occupancy mask, one bit per
+// ConditionState value (shifted by 2 so kNotEvaluated lands on bit 0), and
+// the combination result is a single table lookup on that mask. This keeps
+// the per-child work to a shift and an OR, with no branches, instead of the
+// flag bookkeeping and switch this function used to do per event.
+//
+// Mask bits: 1 = kNotEvaluated seen, 2 = kUnknown seen, 4 = kFalse seen,
+// 8 = kTrue seen. Any mask with the kUnknown bit set yields kUnknown; the
+// remaining entries encode the operation's truth table over the hasFalse and
+// hasTrue bits. NOT is restricted to a single child at init() time, which
+// makes its row identical to NAND.
+const int8_t kCombinationTable[LogicalOperation::NOR + 1][16] = {
+        // LOGICAL_OPERATION_UNSPECIFIED: always false.
+        {0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1},
+        // AND: false if any child is false.
+        {1, 1, -1, -1, 0, 0, -1, -1, 1, 1, -1, -1, 0, 0, -1, -1},
+        // OR: true if any child is true.
+        {0, 0, -1, -1, 0, 0, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1},
+        // NOT: true iff the single child is false.
+        {0, 0, -1, -1, 1, 1, -1, -1, 0, 0, -1, -1, 1, 1, -1, -1},
+        // NAND: true if any child is false.
+        {0, 0, -1, -1, 1, 1, -1, -1, 0, 0, -1, -1, 1, 1, -1, -1},
+        // NOR: false if any child is true.
+        {1, 1, -1, -1, 1, 1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1},
+};
 
-    for (auto childIndex : children) {
-        ConditionState childState = conditionCache[childIndex];
-        if (childState == ConditionState::kUnknown) {
-            hasUnknown = true;
-            break;
-        }
-        if (childState == ConditionState::kFalse) {
-            hasFalse = true;
-        }
-        if (childState == ConditionState::kTrue) {
-            hasTrue = true;
-        }
-    }
+}  // namespace
 
-    // If any child condition is in unknown state, the condition is unknown too.
-    if (hasUnknown) {
-        return ConditionState::kUnknown;
+ConditionState evaluateCombinationCondition(const std::vector<int>& children,
+                                            const LogicalOperation& operation,
+                                            const std::vector<ConditionState>& conditionCache) {
+    if (operation < LogicalOperation::LOGICAL_OPERATION_UNSPECIFIED ||
+        operation > LogicalOperation::NOR) {
+        return ConditionState::kFalse;
     }
-
-    switch (operation) {
-        case LogicalOperation::AND: {
-            newCondition = hasFalse ? ConditionState::kFalse : ConditionState::kTrue;
-            break;
-        }
-        case LogicalOperation::OR: {
-            newCondition = hasTrue ? ConditionState::kTrue : ConditionState::kFalse;
-            break;
-        }
-        case LogicalOperation::NOT:
-            newCondition = (conditionCache[children[0]] == ConditionState::kFalse)
-                                   ? ConditionState::kTrue
-                                   : ConditionState::kFalse;
-            break;
-        case LogicalOperation::NAND:
-            newCondition = hasFalse ? ConditionState::kTrue : ConditionState::kFalse;
-            break;
-        case LogicalOperation::NOR:
-            newCondition = hasTrue ? ConditionState::kFalse : ConditionState::kTrue;
-            break;
-        case LogicalOperation::LOGICAL_OPERATION_UNSPECIFIED:
-            newCondition = ConditionState::kFalse;
-            break;
+    uint32_t seen = 0;
+    for (const int childIndex : children) {
+        seen |= 1u << (conditionCache[childIndex] + 2);
     }
-    return newCondition;
+    return static_cast<ConditionState>(kCombinationTable[operation][seen]);
 }
 
 ConditionState operator|(ConditionState l, ConditionState r) {
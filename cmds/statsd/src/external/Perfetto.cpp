@@ -28,10 +28,20 @@
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace {
 const char kDropboxTag[] = "perfetto";
+
+// Bound on trace requests waiting for the collection thread. Anomalies can
+// fire in bursts; anything past this is dropped rather than queueing up a
+// backlog of fork/execs for traces that would mostly overlap anyway.
+const size_t kMaxPendingTraceRequests = 4;
 }
 
 namespace android {
@@ -135,6 +145,65 @@ bool CollectPerfettoTraceAndUploadToDropbox(const PerfettoDetails& config,
     return true;
 }
 
+namespace {
+
+// State shared with the trace collection thread. Heap-allocated and leaked on
+// purpose: the detached thread may still touch these during shutdown.
+struct TraceRequest {
+    PerfettoDetails config;
+    int64_t alert_id;
+    ConfigKey configKey;
+    std::function<void(bool)> callback;
+};
+
+std::mutex sTraceQueueLock;
+std::condition_variable sTraceQueueCondition;
+std::deque<TraceRequest>* sTraceQueue = new std::deque<TraceRequest>();
+bool sTraceThreadStarted = false;
+
+void traceCollectionLoop() {
+    while (true) {
+        TraceRequest request;
+        {
+            std::unique_lock<std::mutex> lock(sTraceQueueLock);
+            sTraceQueueCondition.wait(lock, [] { return !sTraceQueue->empty(); });
+            request = sTraceQueue->front();
+            sTraceQueue->pop_front();
+        }
+        bool success = CollectPerfettoTraceAndUploadToDropbox(request.config, request.alert_id,
+                                                              request.configKey);
+        if (request.callback) {
+            request.callback(success);
+        }
+    }
+}
+
+}  // namespace
+
+void CollectPerfettoTraceAndUploadToDropboxAsync(const PerfettoDetails& config,
+                                                 int64_t alert_id,
+                                                 const ConfigKey& configKey,
+                                                 std::function<void(bool success)> callback) {
+    {
+        std::unique_lock<std::mutex> lock(sTraceQueueLock);
+        if (sTraceQueue->size() >= kMaxPendingTraceRequests) {
+            ALOGW("Dropping perfetto trace request for alert %lld: %zu requests already pending",
+                  (long long)alert_id, sTraceQueue->size());
+            lock.unlock();
+            if (callback) {
+                callback(false);
+            }
+            return;
+        }
+        sTraceQueue->push_back({config, alert_id, configKey, std::move(callback)});
+        if (!sTraceThreadStarted) {
+            sTraceThreadStarted = true;
+            std::thread(traceCollectionLoop).detach();
+        }
+    }
+    sTraceQueueCondition.notify_one();
+}
+
 }  // namespace statsd
 }  // namespace os
 }  // namespace android
@@ -18,6 +18,8 @@
 
 #include <android/os/StatsLogEventWrapper.h>
 
+#include <functional>
+
 using android::os::StatsLogEventWrapper;
 
 namespace android {
@@ -35,6 +37,17 @@ bool CollectPerfettoTraceAndUploadToDropbox(const PerfettoDetails& config,
                                             int64_t alert_id,
                                             const ConfigKey& configKey);
 
+// Queues the trace collection to a dedicated thread and returns immediately,
+// so callers on the event-processing path never block on the fork/exec and
+// config handshake. Pending requests are bounded; when the queue is full the
+// request is dropped and |callback| runs immediately with false. Otherwise
+// |callback| (optional) is invoked from the collection thread with the
+// outcome of the trace start.
+void CollectPerfettoTraceAndUploadToDropboxAsync(const PerfettoDetails& config,
+                                                 int64_t alert_id,
+                                                 const ConfigKey& configKey,
+                                                 std::function<void(bool success)> callback);
+
 }  // namespace statsd
 }  // namespace os
 }  // namespace android
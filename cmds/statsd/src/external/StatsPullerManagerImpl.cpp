@@ -33,7 +33,10 @@
 #include "SubsystemSleepStatePuller.h"
 #include "statslog.h"
 
+#include <chrono>
+#include <future>
 #include <iostream>
+#include <thread>
 
 using std::make_shared;
 using std::map;
@@ -190,6 +193,33 @@ bool StatsPullerManagerImpl::Pull(const int tagId, const int64_t timeNs,
     }
 }
 
+bool StatsPullerManagerImpl::pullWithTimeout(const int tagId, const int64_t timeNs,
+                                             const int64_t timeoutNs,
+                                             vector<shared_ptr<LogEvent>>* data) {
+    // The promise/future pair (rather than std::async) lets us walk away from
+    // a stuck pull without the future's destructor blocking on it.
+    auto done = std::make_shared<std::promise<bool>>();
+    std::future<bool> doneFuture = done->get_future();
+    auto pulledData = std::make_shared<vector<shared_ptr<LogEvent>>>();
+    std::thread puller([this, tagId, timeNs, done, pulledData] {
+        done->set_value(Pull(tagId, timeNs, pulledData.get()));
+    });
+    if (doneFuture.wait_for(std::chrono::nanoseconds(timeoutNs)) != std::future_status::ready) {
+        // Likely wedged in a binder call. Abandon the thread; when the pull
+        // eventually finishes it lands in the puller's cache, but this round
+        // is reported as failed so receivers can invalidate their buckets.
+        puller.detach();
+        ALOGW("Pull for atom %d did not complete in %lld ns", tagId, (long long)timeoutNs);
+        return false;
+    }
+    puller.join();
+    if (!doneFuture.get()) {
+        return false;
+    }
+    *data = std::move(*pulledData);
+    return true;
+}
+
 StatsPullerManagerImpl& StatsPullerManagerImpl::GetInstance() {
     static StatsPullerManagerImpl instance;
     return instance;
@@ -303,9 +333,34 @@ void StatsPullerManagerImpl::OnAlarmFired(const int64_t currentTimeNs) {
         }
     }
 
-    for (const auto& pullInfo : needToPull) {
+    // Fan the pulls out so one slow puller does not serialize behind the
+    // others; the wait below is bounded by the largest per-puller timeout
+    // instead of the sum of every binder round trip.
+    struct PullResult {
+        bool success = false;
         vector<shared_ptr<LogEvent>> data;
-        if (Pull(pullInfo.first, currentTimeNs, &data)) {
+    };
+    vector<PullResult> pullResults(needToPull.size());
+    vector<std::thread> pullThreads;
+    for (size_t i = 0; i < needToPull.size(); i++) {
+        const int tagId = needToPull[i].first;
+        const auto& it = kAllPullAtomInfo.find(tagId);
+        const int64_t timeoutNs =
+                it != kAllPullAtomInfo.end() ? it->second.pullTimeoutNs : 0;
+        PullResult* result = &pullResults[i];
+        pullThreads.emplace_back([this, tagId, currentTimeNs, timeoutNs, result] {
+            result->success = pullWithTimeout(tagId, currentTimeNs, timeoutNs, &result->data);
+        });
+    }
+    for (auto& pullThread : pullThreads) {
+        pullThread.join();
+    }
+
+    // Deliver serially; receivers synchronize on their own producer locks.
+    for (size_t i = 0; i < needToPull.size(); i++) {
+        const auto& pullInfo = needToPull[i];
+        vector<shared_ptr<LogEvent>>& data = pullResults[i].data;
+        if (pullResults[i].success) {
             for (const auto& receiverInfo : pullInfo.second) {
                 sp<PullDataReceiver> receiverPtr = receiverInfo->receiver.promote();
                 if (receiverPtr != nullptr) {
@@ -44,6 +44,9 @@ typedef struct {
   int64_t coolDownNs = 1 * NS_PER_SEC;
   // The actual puller
   sp<StatsPuller> puller;
+  // How long a scheduled pull may take before it is abandoned and counted as
+  // failed. Keeps a wedged binder-backed puller from stalling the others.
+  int64_t pullTimeoutNs = 10 * NS_PER_SEC;
 } PullAtomInfo;
 
 class StatsPullerManagerImpl : public virtual RefBase {
@@ -89,6 +92,12 @@ public:
 
     void updateAlarmLocked();
 
+    // Runs Pull on its own thread and waits at most timeoutNs for it. On
+    // timeout the pull is abandoned (it completes into the puller's cache)
+    // and false is returned.
+    bool pullWithTimeout(const int tagId, const int64_t timeNs, const int64_t timeoutNs,
+                         vector<std::shared_ptr<LogEvent>>* data);
+
     int64_t mNextPullTimeNs;
 
     FRIEND_TEST(GaugeMetricE2eTest, TestRandomSamplePulledEvents);
@@ -19,6 +19,8 @@
 #include "StatsdStats.h"
 
 #include <android/util/ProtoOutputStream.h>
+#include <functional>
+#include <thread>
 #include "../stats_log_util.h"
 #include "statslog.h"
 #include "storage/StorageManager.h"
@@ -105,10 +107,21 @@ const std::map<int, std::pair<size_t, size_t>> StatsdStats::kAtomDimensionKeySiz
 
 // TODO: add stats for pulled atoms.
 StatsdStats::StatsdStats() {
-    mPushedAtomStats.resize(android::util::kMaxPushedAtomId + 1);
+    mPushedAtomStatsSize = android::util::kMaxPushedAtomId + 1;
+    // Value-initialized so every shard starts at zero.
+    mPushedAtomStats.reset(new std::atomic<int>[kAtomCounterShards * mPushedAtomStatsSize]());
     mStartTimeSec = getWallClockSec();
 }
 
+int StatsdStats::pushedAtomCount(size_t atomId) const {
+    int count = 0;
+    for (size_t shard = 0; shard < kAtomCounterShards; shard++) {
+        count += mPushedAtomStats[shard * mPushedAtomStatsSize + atomId].load(
+                std::memory_order_relaxed);
+    }
+    return count;
+}
+
 StatsdStats& StatsdStats::getInstance() {
     static StatsdStats statsInstance;
     return statsInstance;
@@ -346,14 +359,18 @@ void StatsdStats::notePullFromCache(int pullAtomId) {
 }
 
 void StatsdStats::noteAtomLogged(int atomId, int32_t timeSec) {
-    lock_guard<std::mutex> lock(mLock);
-
     if (atomId > android::util::kMaxPushedAtomId) {
         ALOGW("not interested in atom %d", atomId);
         return;
     }
 
-    mPushedAtomStats[atomId]++;
+    // Wait-free on the per-event hot path: no mutex, and each thread lands on
+    // its own shard so a storm of one atom does not bounce a single cache
+    // line between processing threads.
+    static thread_local const size_t shard =
+            std::hash<std::thread::id>()(std::this_thread::get_id()) % kAtomCounterShards;
+    mPushedAtomStats[shard * mPushedAtomStatsSize + atomId].fetch_add(1,
+                                                                      std::memory_order_relaxed);
 }
 
 void StatsdStats::noteSystemServerRestart(int32_t timeSec) {
@@ -383,7 +400,9 @@ void StatsdStats::resetInternalLocked() {
     // Reset the historical data, but keep the active ConfigStats
     mStartTimeSec = getWallClockSec();
     mIceBox.clear();
-    std::fill(mPushedAtomStats.begin(), mPushedAtomStats.end(), 0);
+    for (size_t i = 0; i < kAtomCounterShards * mPushedAtomStatsSize; i++) {
+        mPushedAtomStats[i].store(0, std::memory_order_relaxed);
+    }
     mAnomalyAlarmRegisteredStats = 0;
     mPeriodicAlarmRegisteredStats = 0;
     mLoggerErrors.clear();
@@ -488,10 +507,10 @@ void StatsdStats::dumpStats(FILE* out) const {
     fprintf(out, "********Disk Usage stats***********\n");
     StorageManager::printStats(out);
     fprintf(out, "********Pushed Atom stats***********\n");
-    const size_t atomCounts = mPushedAtomStats.size();
-    for (size_t i = 2; i < atomCounts; i++) {
-        if (mPushedAtomStats[i] > 0) {
-            fprintf(out, "Atom %lu->%d\n", (unsigned long)i, mPushedAtomStats[i]);
+    for (size_t i = 2; i < mPushedAtomStatsSize; i++) {
+        const int count = pushedAtomCount(i);
+        if (count > 0) {
+            fprintf(out, "Atom %lu->%d\n", (unsigned long)i, count);
         }
     }
 
@@ -641,13 +660,13 @@ void StatsdStats::dumpStats(std::vector<uint8_t>* output, bool reset) {
         addConfigStatsToProto(*(pair.second), &proto);
     }
 
-    const size_t atomCounts = mPushedAtomStats.size();
-    for (size_t i = 2; i < atomCounts; i++) {
-        if (mPushedAtomStats[i] > 0) {
+    for (size_t i = 2; i < mPushedAtomStatsSize; i++) {
+        const int count = pushedAtomCount(i);
+        if (count > 0) {
             uint64_t token =
                     proto.start(FIELD_TYPE_MESSAGE | FIELD_ID_ATOM_STATS | FIELD_COUNT_REPEATED);
             proto.write(FIELD_TYPE_INT32 | FIELD_ID_ATOM_STATS_TAG, (int32_t)i);
-            proto.write(FIELD_TYPE_INT32 | FIELD_ID_ATOM_STATS_COUNT, mPushedAtomStats[i]);
+            proto.write(FIELD_TYPE_INT32 | FIELD_ID_ATOM_STATS_COUNT, count);
             proto.end(token);
         }
     }
@@ -20,7 +20,9 @@
 
 #include <gtest/gtest_prod.h>
 #include <log/log_time.h>
+#include <atomic>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -331,10 +333,18 @@ private:
     std::list<const std::shared_ptr<ConfigStats>> mIceBox;
 
     // Stores the number of times a pushed atom is logged.
-    // The size of the vector is the largest pushed atom id in atoms.proto + 1. Atoms
-    // out of that range will be dropped (it's either pulled atoms or test atoms).
-    // This is a vector, not a map because it will be accessed A LOT -- for each stats log.
-    std::vector<int> mPushedAtomStats;
+    // Sized as kAtomCounterShards * (largest pushed atom id in atoms.proto + 1);
+    // atoms out of that range will be dropped (it's either pulled atoms or test
+    // atoms). This is a flat array, not a map, and each logging thread bumps a
+    // relaxed atomic in its own shard, because it is accessed A LOT -- for each
+    // stats log -- and must not contend with event processing. Shards are
+    // summed lazily when the stats are dumped.
+    static const size_t kAtomCounterShards = 8;
+    size_t mPushedAtomStatsSize = 0;
+    std::unique_ptr<std::atomic<int>[]> mPushedAtomStats;
+
+    // Sums one atom's counter across all shards.
+    int pushedAtomCount(size_t atomId) const;
 
     // Maps PullAtomId to its stats. The size is capped by the puller atom counts.
     std::map<int, PulledAtomStats> mPulledAtomStats;
@@ -29,14 +29,15 @@ using std::string;
 using std::vector;
 
 LogEvent::LogEvent(log_msg& msg) {
-    mContext =
-            create_android_log_parser(msg.msg() + sizeof(uint32_t), msg.len() - sizeof(uint32_t));
     mLogdTimestampNs = msg.entry_v1.sec * NS_PER_SEC + msg.entry_v1.nsec;
     mLogUid = msg.entry_v4.uid;
-    init(mContext);
-    if (mContext) {
-        // android_log_destroy will set mContext to NULL
-        android_log_destroy(&mContext);
+    mRawBuffer.assign(msg.msg() + sizeof(uint32_t), msg.len() - sizeof(uint32_t));
+    mParsed = false;
+    if (!parseHeader()) {
+        // Unexpected layout; fall back to an eager full parse, which also
+        // recovers the timestamp and tag id. Most events never get here and
+        // are discarded on the tag id alone without walking their elements.
+        ensureParsed();
     }
 }
 
@@ -62,6 +63,53 @@ LogEvent::LogEvent(int32_t tagId, int64_t timestampNs) {
     }
 }
 
+bool LogEvent::parseHeader() {
+    // Serialized form: a list header, then the elapsed timestamp as the first
+    // element and the tag id as the second.
+    if (mRawBuffer.size() < sizeof(android_event_list_t) + sizeof(android_event_long_t) +
+                                    sizeof(android_event_int_t)) {
+        return false;
+    }
+    const char* buf = mRawBuffer.data();
+
+    android_event_list_t list;
+    memcpy(&list, buf, sizeof(list));
+    if (list.type != EVENT_TYPE_LIST) {
+        return false;
+    }
+
+    android_event_long_t timestamp;
+    memcpy(&timestamp, buf + sizeof(list), sizeof(timestamp));
+    if (timestamp.type != EVENT_TYPE_LONG) {
+        return false;
+    }
+
+    android_event_int_t tag;
+    memcpy(&tag, buf + sizeof(list) + sizeof(timestamp), sizeof(tag));
+    if (tag.type != EVENT_TYPE_INT) {
+        return false;
+    }
+
+    mElapsedTimestampNs = timestamp.data;
+    mTagId = tag.data;
+    return true;
+}
+
+void LogEvent::ensureParsed() const {
+    if (mParsed) {
+        return;
+    }
+    LogEvent* self = const_cast<LogEvent*>(this);
+    self->mParsed = true;
+    android_log_context context =
+            create_android_log_parser(mRawBuffer.data(), mRawBuffer.size());
+    if (context) {
+        self->init(context);
+        // android_log_destroy will set context to NULL
+        android_log_destroy(&context);
+    }
+}
+
 void LogEvent::init() {
     if (mContext) {
         const char* buffer;
@@ -274,6 +322,7 @@ void LogEvent::init(android_log_context context) {
 
 int64_t LogEvent::GetLong(size_t key, status_t* err) const {
     // TODO: encapsulate the magical operations all in Field struct as a static function.
+    ensureParsed();
     int field = getSimpleField(key);
     for (const auto& value : mValues) {
         if (value.mField.getField() == field) {
@@ -296,6 +345,7 @@ int64_t LogEvent::GetLong(size_t key, status_t* err) const {
 }
 
 int LogEvent::GetInt(size_t key, status_t* err) const {
+    ensureParsed();
     int field = getSimpleField(key);
     for (const auto& value : mValues) {
         if (value.mField.getField() == field) {
@@ -316,6 +366,7 @@ int LogEvent::GetInt(size_t key, status_t* err) const {
 }
 
 const char* LogEvent::GetString(size_t key, status_t* err) const {
+    ensureParsed();
     int field = getSimpleField(key);
     for (const auto& value : mValues) {
         if (value.mField.getField() == field) {
@@ -336,6 +387,7 @@ const char* LogEvent::GetString(size_t key, status_t* err) const {
 }
 
 bool LogEvent::GetBool(size_t key, status_t* err) const {
+    ensureParsed();
     int field = getSimpleField(key);
     for (const auto& value : mValues) {
         if (value.mField.getField() == field) {
@@ -358,6 +410,7 @@ bool LogEvent::GetBool(size_t key, status_t* err) const {
 }
 
 float LogEvent::GetFloat(size_t key, status_t* err) const {
+    ensureParsed();
     int field = getSimpleField(key);
     for (const auto& value : mValues) {
         if (value.mField.getField() == field) {
@@ -378,6 +431,7 @@ float LogEvent::GetFloat(size_t key, status_t* err) const {
 }
 
 string LogEvent::ToString() const {
+    ensureParsed();
     string result;
     result += StringPrintf("{ %lld %lld (%d)", (long long)mLogdTimestampNs,
                            (long long)mElapsedTimestampNs, mTagId);
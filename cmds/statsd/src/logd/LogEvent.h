@@ -142,14 +142,17 @@ public:
     }
 
     inline int size() const {
+        ensureParsed();
         return mValues.size();
     }
 
     const std::vector<FieldValue>& getValues() const {
+        ensureParsed();
         return mValues;
     }
 
     std::vector<FieldValue>* getMutableValues() {
+        ensureParsed();
         return &mValues;
     }
 
@@ -165,9 +168,31 @@ private:
      */
     void init(android_log_context context);
 
+    /**
+     * Decodes only the elapsed timestamp and tag id from the head of the raw
+     * buffer. Returns false if the buffer does not start with the expected
+     * list/timestamp/tag header.
+     */
+    bool parseHeader();
+
+    /**
+     * Materializes mValues from the raw buffer on first access. Most events
+     * match no config and are dropped on the tag id alone, so the full
+     * element walk is deferred until a consumer actually needs the fields.
+     * Events are processed on a single thread, so no synchronization is
+     * needed around the deferred parse.
+     */
+    void ensureParsed() const;
+
     // The items are naturally sorted in DFS order as we read them. this allows us to do fast
     // matching.
-    std::vector<FieldValue> mValues;
+    mutable std::vector<FieldValue> mValues;
+
+    // The serialized element list, retained until mValues is materialized.
+    std::string mRawBuffer;
+
+    // Whether mValues reflects the raw buffer yet.
+    mutable bool mParsed = true;
 
     // This field is used when statsD wants to create log event object and write fields to it. After
     // calling init() function, this object would be destroyed to save memory usage.
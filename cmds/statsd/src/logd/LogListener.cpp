@@ -36,6 +36,13 @@ LogListener::LogListener() {
 LogListener::~LogListener() {
 }
 
+void LogListener::OnLogEvents(std::vector<std::unique_ptr<LogEvent>>& msgs,
+                              bool reconnectionStarts) {
+    for (size_t i = 0; i < msgs.size(); i++) {
+        OnLogEvent(msgs[i].get(), reconnectionStarts && i == 0);
+    }
+}
+
 }  // namespace statsd
 }  // namespace os
 }  // namespace android
@@ -19,6 +19,8 @@
 #include "logd/LogEvent.h"
 
 #include <utils/RefBase.h>
+
+#include <memory>
 #include <vector>
 
 namespace android {
@@ -34,6 +36,15 @@ public:
     virtual ~LogListener();
 
     virtual void OnLogEvent(LogEvent* msg, bool reconnectionStarts) = 0;
+
+    /**
+     * A batch of events drained from logd in one go, in timestamp order.
+     * The default implementation dispatches them one by one; listeners that
+     * can amortize locking across a batch may override this instead.
+     * reconnectionStarts applies to the first event of the batch.
+     */
+    virtual void OnLogEvents(std::vector<std::unique_ptr<LogEvent>>& msgs,
+                             bool reconnectionStarts);
 };
 
 }  // namespace statsd
@@ -17,11 +17,15 @@
 #include "logd/LogReader.h"
 
 #include "guardrail/StatsdStats.h"
+#include "stats_log_util.h"
 
 #include <time.h>
 #include <unistd.h>
 #include <utils/Errors.h>
 
+#include <algorithm>
+#include <memory>
+
 using namespace android;
 using namespace std;
 
@@ -32,6 +36,14 @@ namespace statsd {
 #define SNOOZE_INITIAL_MS 100
 #define SNOOZE_MAX_MS (10 * 60 * 1000)  // Ten minutes
 
+// If the message just read from logd is already this stale, more messages are
+// queued behind it; keep draining into the batch instead of dispatching.
+#define DRAIN_LAG_THRESHOLD_NS (500 * 1000000LL)
+
+// Cap on how many messages are drained before the batch is handed off, so the
+// listener sees events with bounded delay even during a sustained storm.
+#define DRAIN_MAX_BATCH_SIZE 128
+
 LogReader::LogReader(const sp<LogListener>& listener) : mListener(listener) {
 }
 
@@ -110,11 +122,24 @@ int LogReader::connect_and_read() {
             lineCount++;
 
             // Wrap it in a LogEvent object
-            LogEvent event(msg);
+            mBatch.push_back(std::make_unique<LogEvent>(msg));
+
+            // When we're behind (boot storms), logd has more queued behind the
+            // message we just read; keep draining so the whole run is handed
+            // to the listener in one call and per-message overhead amortizes.
+            // When live, the message is fresh and goes out immediately.
+            bool behind = getWallClockNs() - mBatch.back()->GetLogdTimestampNs() >
+                          DRAIN_LAG_THRESHOLD_NS;
+            if (behind && mBatch.size() < DRAIN_MAX_BATCH_SIZE) {
+                continue;
+            }
 
-            // Call the listener
-            mListener->OnLogEvent(&event,
-                                  lineCount == 1 /* indicate whether it's a new connection */);
+            dispatchBatch(lineCount);
+        }
+
+        // Hand off whatever was drained before the connection dropped.
+        if (!mBatch.empty()) {
+            dispatchBatch(lineCount);
         }
     }
 
@@ -124,6 +149,22 @@ int LogReader::connect_and_read() {
     return lineCount;
 }
 
+void LogReader::dispatchBatch(int lineCount) {
+    // logd interleaves its buffers, so a drained run is not guaranteed to be
+    // in order; sort once per batch rather than making consumers cope.
+    if (mBatch.size() > 1) {
+        std::stable_sort(mBatch.begin(), mBatch.end(),
+                         [](const std::unique_ptr<LogEvent>& a, const std::unique_ptr<LogEvent>& b) {
+                             return a->GetElapsedTimestampNs() < b->GetElapsedTimestampNs();
+                         });
+    }
+    mListener->OnLogEvents(mBatch,
+                           lineCount == (int)mBatch.size() /* new connection starts here */);
+    // clear() keeps the vector's capacity, so the batch storage is reused
+    // across drains.
+    mBatch.clear();
+}
+
 }  // namespace statsd
 }  // namespace os
 }  // namespace android
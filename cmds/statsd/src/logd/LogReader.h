@@ -53,6 +53,12 @@ private:
      */
     sp<LogListener> mListener;
 
+    /**
+     * Events drained from logd but not yet handed to the listener. Kept as a
+     * member so its storage is reused across batches and reconnects.
+     */
+    std::vector<std::unique_ptr<LogEvent>> mBatch;
+
     /**
      * Connect to a single instance of logd, and read until there's a read error.
      * Logd can crash, exit, be killed etc.
@@ -60,6 +66,12 @@ private:
      * Returns the number of lines that were read.
      */
     int connect_and_read();
+
+    /**
+     * Sorts the pending batch by elapsed timestamp and hands it to the
+     * listener in a single call, then clears it for reuse.
+     */
+    void dispatchBatch(int lineCount);
 };
 
 }  // namespace statsd
@@ -23,6 +23,8 @@
 
 #include <cutils/log.h>
 
+#include <algorithm>
+
 using android::util::FIELD_COUNT_REPEATED;
 using android::util::FIELD_TYPE_BOOL;
 using android::util::FIELD_TYPE_FLOAT;
@@ -68,6 +70,12 @@ const int FIELD_ID_BUCKET_NUM = 6;
 const int FIELD_ID_START_BUCKET_ELAPSED_MILLIS = 7;
 const int FIELD_ID_END_BUCKET_ELAPSED_MILLIS = 8;
 
+// How many recycled field vectors the pool may hold on to.
+const size_t kMaxPooledFieldVectors = 128;
+// Atom lists are reserved up front so pushes within the per-dimension limit
+// never reallocate; capped for configs with a very large limit.
+const size_t kMaxReservedGaugeAtoms = 32;
+
 GaugeMetricProducer::GaugeMetricProducer(const ConfigKey& key, const GaugeMetric& metric,
                                          const int conditionIndex,
                                          const sp<ConditionWizard>& wizard, const int pullTagId,
@@ -88,6 +96,7 @@ GaugeMetricProducer::GaugeMetricProducer(const ConfigKey& key, const GaugeMetric
       mGaugeAtomsPerDimensionLimit(metric.max_num_gauge_atoms_per_bucket()) {
     mCurrentSlicedBucket = std::make_shared<DimToGaugeAtomsMap>();
     mCurrentSlicedBucketForAnomaly = std::make_shared<DimToValMap>();
+    mFieldVectorPool = std::make_shared<FieldVectorPool>();
     int64_t bucketSizeMills = 0;
     if (metric.has_bucket()) {
         bucketSizeMills = TimeUnitToBucketSizeInMillisGuardrailed(key.GetUid(), metric.bucket());
@@ -370,14 +379,40 @@ void GaugeMetricProducer::onSlicedConditionMayChangeLocked(bool overallCondition
     }  // else: Push mode. No need to proactively pull the gauge data.
 }
 
+std::shared_ptr<vector<FieldValue>> GaugeMetricProducer::obtainFieldVector() {
+    std::shared_ptr<FieldVectorPool> pool = mFieldVectorPool;
+    vector<FieldValue>* fields = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pool->lock);
+        if (!pool->freeList.empty()) {
+            fields = pool->freeList.back().release();
+            pool->freeList.pop_back();
+        }
+    }
+    if (fields == nullptr) {
+        fields = new vector<FieldValue>();
+    }
+    // The deleter keeps the pool alive, so atoms may outlive the producer.
+    return std::shared_ptr<vector<FieldValue>>(fields, [pool](vector<FieldValue>* recycled) {
+        recycled->clear();
+        std::lock_guard<std::mutex> lock(pool->lock);
+        if (pool->freeList.size() < kMaxPooledFieldVectors) {
+            pool->freeList.emplace_back(recycled);
+        } else {
+            delete recycled;
+        }
+    });
+}
+
 std::shared_ptr<vector<FieldValue>> GaugeMetricProducer::getGaugeFields(const LogEvent& event) {
+    std::shared_ptr<vector<FieldValue>> gaugeFields = obtainFieldVector();
     if (mFieldMatchers.size() > 0) {
-        std::shared_ptr<vector<FieldValue>> gaugeFields = std::make_shared<vector<FieldValue>>();
         filterGaugeValues(mFieldMatchers, event.getValues(), gaugeFields.get());
-        return gaugeFields;
     } else {
-        return std::make_shared<vector<FieldValue>>(event.getValues());
+        // Assignment into the recycled vector reuses its capacity.
+        *gaugeFields = event.getValues();
     }
+    return gaugeFields;
 }
 
 void GaugeMetricProducer::onDataPulled(const std::vector<std::shared_ptr<LogEvent>>& allData) {
@@ -434,11 +469,17 @@ void GaugeMetricProducer::onMatchedLogEventInternalLocked(
     if (hitGuardRailLocked(eventKey)) {
         return;
     }
-    if ((*mCurrentSlicedBucket)[eventKey].size() >= mGaugeAtomsPerDimensionLimit) {
+    auto& atomList = (*mCurrentSlicedBucket)[eventKey];
+    if (atomList.size() >= mGaugeAtomsPerDimensionLimit) {
         return;
     }
+    if (atomList.capacity() == 0) {
+        // Size the list once; pushes within the per-dimension limit then
+        // never reallocate.
+        atomList.reserve(std::min(mGaugeAtomsPerDimensionLimit, kMaxReservedGaugeAtoms));
+    }
     GaugeAtom gaugeAtom(getGaugeFields(event), eventTimeNs, getWallClockNs());
-    (*mCurrentSlicedBucket)[eventKey].push_back(gaugeAtom);
+    atomList.push_back(gaugeAtom);
     // Anomaly detection on gauge metric only works when there is one numeric
     // field specified.
     if (mAnomalyTrackers.size() > 0) {
@@ -514,19 +555,9 @@ void GaugeMetricProducer::flushCurrentBucketLocked(const int64_t& eventTimeNs) {
         info.mBucketEndNs = fullBucketEndTimeNs;
     }
 
-    if (info.mBucketEndNs - mCurrentBucketStartTimeNs >= mMinBucketSizeNs) {
-        for (const auto& slice : *mCurrentSlicedBucket) {
-            info.mGaugeAtoms = slice.second;
-            auto& bucketList = mPastBuckets[slice.first];
-            bucketList.push_back(info);
-            VLOG("Gauge gauge metric %lld, dump key value: %s", (long long)mMetricId,
-                 slice.first.toString().c_str());
-        }
-    } else {
-        mSkippedBuckets.emplace_back(info.mBucketStartNs, info.mBucketEndNs);
-    }
-
     // If we have anomaly trackers, we need to update the partial bucket values.
+    // This must happen before the report loop below, which hands the atom
+    // lists over to the past buckets.
     if (mAnomalyTrackers.size() > 0) {
         updateCurrentSlicedBucketForAnomaly();
 
@@ -539,6 +570,23 @@ void GaugeMetricProducer::flushCurrentBucketLocked(const int64_t& eventTimeNs) {
         }
     }
 
+    if (info.mBucketEndNs - mCurrentBucketStartTimeNs >= mMinBucketSizeNs) {
+        for (auto& slice : *mCurrentSlicedBucket) {
+            // The sliced bucket is replaced below, so hand the atom list over
+            // instead of copying it.
+            GaugeBucket bucket;
+            bucket.mBucketStartNs = info.mBucketStartNs;
+            bucket.mBucketEndNs = info.mBucketEndNs;
+            bucket.mGaugeAtoms = std::move(slice.second);
+            auto& bucketList = mPastBuckets[slice.first];
+            bucketList.push_back(std::move(bucket));
+            VLOG("Gauge gauge metric %lld, dump key value: %s", (long long)mMetricId,
+                 slice.first.toString().c_str());
+        }
+    } else {
+        mSkippedBuckets.emplace_back(info.mBucketStartNs, info.mBucketEndNs);
+    }
+
     mCurrentSlicedBucket = std::make_shared<DimToGaugeAtomsMap>();
 }
 
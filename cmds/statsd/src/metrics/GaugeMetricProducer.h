@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <android/util/ProtoOutputStream.h>
 #include <gtest/gtest_prod.h>
@@ -155,6 +158,21 @@ private:
     // apply a whitelist on the original input
     std::shared_ptr<vector<FieldValue>> getGaugeFields(const LogEvent& event);
 
+    // Producer-level arena recycling the field vectors behind GaugeAtom, so a
+    // gauge storm reuses a bounded set of vectors (and their capacity) instead
+    // of allocating per atom. Held by shared_ptr because the atom deleters
+    // that return vectors here run whenever the last atom reference drops.
+    struct FieldVectorPool {
+        std::mutex lock;
+        std::vector<std::unique_ptr<vector<FieldValue>>> freeList;
+    };
+
+    std::shared_ptr<FieldVectorPool> mFieldVectorPool;
+
+    // Takes a cleared vector from the pool (or allocates one) wrapped in a
+    // shared_ptr whose deleter returns it to the pool.
+    std::shared_ptr<vector<FieldValue>> obtainFieldVector();
+
     // Util function to check whether the specified dimension hits the guardrail.
     bool hitGuardRailLocked(const MetricDimensionKey& newKey);
 
@@ -69,7 +69,8 @@ MetricsManager::MetricsManager(const ConfigKey& key, const StatsdConfig& config,
 
     mConfigValid =
             initStatsdConfig(key, config, *uidMap, anomalyAlarmMonitor, periodicAlarmMonitor,
-                             timeBaseNs, currentTimeNs, mTagIds, mAllAtomMatchers,
+                             timeBaseNs, currentTimeNs, mTagIds, mTagIdToMatchersMap,
+                             mAllAtomMatchers,
                              mAllConditionTrackers, mAllMetricProducers, mAllAnomalyTrackers,
                              mAllPeriodicAlarmTrackers, mConditionToMetricMap, mTrackerToMetricMap,
                              mTrackerToConditionMap, mNoReportMetricIds);
@@ -118,6 +119,12 @@ MetricsManager::MetricsManager(const ConfigKey& key, const StatsdConfig& config,
     StatsdStats::getInstance().noteConfigReceived(
             key, mAllMetricProducers.size(), mAllConditionTrackers.size(), mAllAtomMatchers.size(),
             mAllAnomalyTrackers.size(), mAnnotations, mConfigValid);
+
+    if (mConfigValid) {
+        // Keep the config bytes around so a later push of the same config can
+        // be recognized without tearing this manager down.
+        config.SerializeToString(&mSerializedConfig);
+    }
 }
 
 MetricsManager::~MetricsManager() {
@@ -144,6 +151,12 @@ bool MetricsManager::isConfigValid() const {
     return mConfigValid;
 }
 
+bool MetricsManager::sameConfig(const StatsdConfig& config) const {
+    // Both byte strings come from the same in-process proto serializer, so
+    // byte equality is a reliable equality check for the configs.
+    return mConfigValid && config.SerializeAsString() == mSerializedConfig;
+}
+
 void MetricsManager::notifyAppUpgrade(const int64_t& eventTimeNs, const string& apk, const int uid,
                                       const int64_t version) {
     // check if we care this package
@@ -299,15 +312,18 @@ void MetricsManager::onLogEvent(const LogEvent& event) {
 
     int tagId = event.GetTagId();
     int64_t eventTime = event.GetElapsedTimestampNs();
-    if (mTagIds.find(tagId) == mTagIds.end()) {
+    const auto matchersIt = mTagIdToMatchersMap.find(tagId);
+    if (matchersIt == mTagIdToMatchersMap.end()) {
         // not interesting...
         return;
     }
 
     vector<MatchingState> matcherCache(mAllAtomMatchers.size(), MatchingState::kNotComputed);
 
-    for (auto& matcher : mAllAtomMatchers) {
-        matcher->onLogEvent(event, mAllAtomMatchers, matcherCache);
+    // Only the matchers registered for this tag id can match; everyone else stays
+    // kNotComputed, which the downstream loops treat the same as kNotMatched.
+    for (const int matcherIndex : matchersIt->second) {
+        mAllAtomMatchers[matcherIndex]->onLogEvent(event, mAllAtomMatchers, matcherCache);
     }
 
     // A bitmap to see which ConditionTracker needs to be re-evaluated.
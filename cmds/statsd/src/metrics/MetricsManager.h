@@ -46,6 +46,12 @@ public:
     // Return whether the configuration is valid.
     bool isConfigValid() const;
 
+    // Returns true if this manager was built from a config that serializes to
+    // the same bytes as the given one. Used to recognize re-pushes of an
+    // unchanged config so the existing trackers and producers (and their
+    // in-flight buckets) can be kept instead of being rebuilt from scratch.
+    bool sameConfig(const StatsdConfig& config) const;
+
     void onLogEvent(const LogEvent& event);
 
     void onAnomalyAlarmFired(
@@ -122,6 +128,10 @@ private:
 
     bool mConfigValid = false;
 
+    // The bytes of the config this manager was built from, kept so a pushed
+    // config can be compared against the running one without re-initializing.
+    std::string mSerializedConfig;
+
     bool mHashStringsInReport = false;
 
     const int64_t mTtlNs;
@@ -149,6 +159,11 @@ private:
     // All event tags that are interesting to my metrics.
     std::set<int> mTagIds;
 
+    // Maps an event tag id to the indices in mAllAtomMatchers registered for that id,
+    // precompiled at config time. An incoming event is dispatched straight to the
+    // matchers for its tag, so matching cost stays flat as the config grows.
+    std::unordered_map<int, std::vector<int>> mTagIdToMatchersMap;
+
     // We only store the sp of LogMatchingTracker, MetricProducer, and ConditionTracker in
     // MetricsManager. There are relationships between them, and the relationships are denoted by
     // index instead of pointers. The reasons for this are: (1) the relationship between them are
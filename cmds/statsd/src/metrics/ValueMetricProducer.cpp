@@ -466,16 +466,33 @@ void ValueMetricProducer::flushCurrentBucketLocked(const int64_t& eventTimeNs) {
         info.mBucketEndNs = fullBucketEndTimeNs;
     }
 
+    // Gather the per-dimension state into the structure-of-arrays scratch in
+    // one map walk. The aggregation passes below then run over dense arrays
+    // instead of chasing the map again, and the taint reduction is a plain
+    // loop over contiguous ints the compiler can vectorize.
+    mFlushKeys.clear();
+    mFlushSums.clear();
+    mFlushHasValue.clear();
+    mFlushTainted.clear();
+    for (const auto& slice : mCurrentSlicedBucket) {
+        mFlushKeys.push_back(&slice.first);
+        mFlushSums.push_back(slice.second.sum);
+        mFlushHasValue.push_back(slice.second.hasValue ? 1 : 0);
+        mFlushTainted.push_back(slice.second.tainted + (slice.second.startUpdated ? 1 : 0));
+    }
+    const size_t sliceCount = mFlushKeys.size();
+
     if (info.mBucketEndNs - mCurrentBucketStartTimeNs >= mMinBucketSizeNs) {
         // The current bucket is large enough to keep.
         int tainted = 0;
-        for (const auto& slice : mCurrentSlicedBucket) {
-            tainted += slice.second.tainted;
-            tainted += slice.second.startUpdated;
-            if (slice.second.hasValue) {
-                info.mValue = slice.second.sum;
+        for (size_t i = 0; i < sliceCount; i++) {
+            tainted += mFlushTainted[i];
+        }
+        for (size_t i = 0; i < sliceCount; i++) {
+            if (mFlushHasValue[i]) {
+                info.mValue = mFlushSums[i];
                 // it will auto create new vector of ValuebucketInfo if the key is not found.
-                auto& bucketList = mPastBuckets[slice.first];
+                auto& bucketList = mPastBuckets[*mFlushKeys[i]];
                 bucketList.push_back(info);
             }
         }
@@ -487,8 +504,8 @@ void ValueMetricProducer::flushCurrentBucketLocked(const int64_t& eventTimeNs) {
     if (eventTimeNs > fullBucketEndTimeNs) {  // If full bucket, send to anomaly tracker.
         // Accumulate partial buckets with current value and then send to anomaly tracker.
         if (mCurrentFullBucket.size() > 0) {
-            for (const auto& slice : mCurrentSlicedBucket) {
-                mCurrentFullBucket[slice.first] += slice.second.sum;
+            for (size_t i = 0; i < sliceCount; i++) {
+                mCurrentFullBucket[*mFlushKeys[i]] += mFlushSums[i];
             }
             for (const auto& slice : mCurrentFullBucket) {
                 for (auto& tracker : mAnomalyTrackers) {
@@ -500,18 +517,18 @@ void ValueMetricProducer::flushCurrentBucketLocked(const int64_t& eventTimeNs) {
             mCurrentFullBucket.clear();
         } else {
             // Skip aggregating the partial buckets since there's no previous partial bucket.
-            for (const auto& slice : mCurrentSlicedBucket) {
+            for (size_t i = 0; i < sliceCount; i++) {
                 for (auto& tracker : mAnomalyTrackers) {
                     if (tracker != nullptr) {
-                        tracker->addPastBucket(slice.first, slice.second.sum, mCurrentBucketNum);
+                        tracker->addPastBucket(*mFlushKeys[i], mFlushSums[i], mCurrentBucketNum);
                     }
                 }
             }
         }
     } else {
         // Accumulate partial bucket.
-        for (const auto& slice : mCurrentSlicedBucket) {
-            mCurrentFullBucket[slice.first] += slice.second.sum;
+        for (size_t i = 0; i < sliceCount; i++) {
+            mCurrentFullBucket[*mFlushKeys[i]] += mFlushSums[i];
         }
     }
 
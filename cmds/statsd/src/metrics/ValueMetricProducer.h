@@ -19,6 +19,7 @@
 #include <gtest/gtest_prod.h>
 #include <utils/threads.h>
 #include <list>
+#include "../FlatHashMap.h"
 #include "../anomaly/AnomalyTracker.h"
 #include "../condition/ConditionTracker.h"
 #include "../external/PullDataReceiver.h"
@@ -144,9 +145,18 @@ private:
         bool hasValue;
     } Interval;
 
-    std::unordered_map<MetricDimensionKey, Interval> mCurrentSlicedBucket;
+    FlatHashMap<MetricDimensionKey, Interval> mCurrentSlicedBucket;
 
-    std::unordered_map<MetricDimensionKey, int64_t> mCurrentFullBucket;
+    FlatHashMap<MetricDimensionKey, int64_t> mCurrentFullBucket;
+
+    // Structure-of-arrays mirror of mCurrentSlicedBucket, filled at bucket
+    // flush so the aggregation passes run over dense arrays. Member scratch
+    // (cleared, never shrunk) so steady-state flushes do not allocate. The
+    // key pointers are only valid until the sliced bucket is cleared.
+    std::vector<const MetricDimensionKey*> mFlushKeys;
+    std::vector<int64_t> mFlushSums;
+    std::vector<uint8_t> mFlushHasValue;
+    std::vector<int32_t> mFlushTainted;
 
     // Save the past buckets and we can clear when the StatsLogReport is dumped.
     // TODO: Add a lock to mPastBuckets.
@@ -115,7 +115,8 @@ bool handleMetricWithConditions(
 
 bool initLogTrackers(const StatsdConfig& config, const UidMap& uidMap,
                      unordered_map<int64_t, int>& logTrackerMap,
-                     vector<sp<LogMatchingTracker>>& allAtomMatchers, set<int>& allTagIds) {
+                     vector<sp<LogMatchingTracker>>& allAtomMatchers, set<int>& allTagIds,
+                     unordered_map<int, std::vector<int>>& tagIdToMatchersMap) {
     vector<AtomMatcher> matcherConfigs;
     const int atomMatcherCount = config.atom_matcher_size();
     matcherConfigs.reserve(atomMatcherCount);
@@ -148,13 +149,19 @@ bool initLogTrackers(const StatsdConfig& config, const UidMap& uidMap,
     }
 
     vector<bool> stackTracker2(allAtomMatchers.size(), false);
-    for (auto& matcher : allAtomMatchers) {
+    for (size_t matcherIndex = 0; matcherIndex < allAtomMatchers.size(); matcherIndex++) {
+        auto& matcher = allAtomMatchers[matcherIndex];
         if (!matcher->init(matcherConfigs, allAtomMatchers, logTrackerMap, stackTracker2)) {
             return false;
         }
         // Collect all the tag ids that are interesting. TagIds exist in leaf nodes only.
         const set<int>& tagIds = matcher->getAtomIds();
         allTagIds.insert(tagIds.begin(), tagIds.end());
+        // Precompile the dispatch table: an incoming event only needs to visit the
+        // matchers registered for its tag id, not the whole config.
+        for (const int tagId : tagIds) {
+            tagIdToMatchersMap[tagId].push_back(matcherIndex);
+        }
     }
     return true;
 }
@@ -649,6 +656,7 @@ bool initStatsdConfig(const ConfigKey& key, const StatsdConfig& config, UidMap&
                       const sp<AlarmMonitor>& periodicAlarmMonitor,
                       const int64_t timeBaseNs, const int64_t currentTimeNs,
                       set<int>& allTagIds,
+                      unordered_map<int, std::vector<int>>& tagIdToMatchersMap,
                       vector<sp<LogMatchingTracker>>& allAtomMatchers,
                       vector<sp<ConditionTracker>>& allConditionTrackers,
                       vector<sp<MetricProducer>>& allMetricProducers,
@@ -662,7 +670,8 @@ bool initStatsdConfig(const ConfigKey& key, const StatsdConfig& config, UidMap&
     unordered_map<int64_t, int> conditionTrackerMap;
     unordered_map<int64_t, int> metricProducerMap;
 
-    if (!initLogTrackers(config, uidMap, logTrackerMap, allAtomMatchers, allTagIds)) {
+    if (!initLogTrackers(config, uidMap, logTrackerMap, allAtomMatchers, allTagIds,
+                         tagIdToMatchersMap)) {
         ALOGE("initLogMatchingTrackers failed");
         return false;
     }
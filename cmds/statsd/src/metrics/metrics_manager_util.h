@@ -45,11 +45,14 @@ namespace statsd {
 // [logTrackerMap]: this map should contain matcher name to index mapping
 // [allAtomMatchers]: should store the sp to all the LogMatchingTracker
 // [allTagIds]: contains the set of all interesting tag ids to this config.
+// [tagIdToMatchersMap]: maps each interesting tag id to the indices of the matchers
+//                       registered for it, so event dispatch only touches those.
 bool initLogTrackers(const StatsdConfig& config,
                      const UidMap& uidMap,
                      std::unordered_map<int64_t, int>& logTrackerMap,
                      std::vector<sp<LogMatchingTracker>>& allAtomMatchers,
-                     std::set<int>& allTagIds);
+                     std::set<int>& allTagIds,
+                     std::unordered_map<int, std::vector<int>>& tagIdToMatchersMap);
 
 // Initialize ConditionTrackers
 // input:
@@ -101,6 +104,7 @@ bool initStatsdConfig(const ConfigKey& key, const StatsdConfig& config, UidMap&
                       const sp<AlarmMonitor>& periodicAlarmMonitor,
                       const int64_t timeBaseNs, const int64_t currentTimeNs,
                       std::set<int>& allTagIds,
+                      std::unordered_map<int, std::vector<int>>& tagIdToMatchersMap,
                       std::vector<sp<LogMatchingTracker>>& allAtomMatchers,
                       std::vector<sp<ConditionTracker>>& allConditionTrackers,
                       std::vector<sp<MetricProducer>>& allMetricProducers,
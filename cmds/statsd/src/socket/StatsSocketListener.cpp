@@ -42,10 +42,26 @@ namespace statsd {
 static const int kLogMsgHeaderSize = 28;
 
 StatsSocketListener::StatsSocketListener(const sp<LogListener>& listener)
-    : SocketListener(getLogSocket(), false /*start listen*/), mListener(listener) {
+    : SocketListener(getLogSocket(), false /*start listen*/),
+      mListener(listener),
+      mReadBuffers(new ReadBuffer[kMaxMessagesPerRead]),
+      mQueueHead(0),
+      mQueueTail(0),
+      mDroppedEvents(0),
+      mSleeping(false),
+      mRunning(true) {
+    mProcessingThread = std::thread(&StatsSocketListener::processEvents, this);
 }
 
 StatsSocketListener::~StatsSocketListener() {
+    mRunning.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mWakeupLock);
+        mWakeupCondition.notify_one();
+    }
+    if (mProcessingThread.joinable()) {
+        mProcessingThread.join();
+    }
 }
 
 bool StatsSocketListener::onDataAvailable(SocketClient* cli) {
@@ -55,67 +71,129 @@ bool StatsSocketListener::onDataAvailable(SocketClient* cli) {
         name_set = true;
     }
 
-    // + 1 to ensure null terminator if MAX_PAYLOAD buffer is received
-    char buffer[sizeof_log_id_t + sizeof(uint16_t) + sizeof(log_time) + LOGGER_ENTRY_MAX_PAYLOAD +
-                1];
-    struct iovec iov = {buffer, sizeof(buffer) - 1};
-
-    alignas(4) char control[CMSG_SPACE(sizeof(struct ucred))];
-    struct msghdr hdr = {
-            NULL, 0, &iov, 1, control, sizeof(control), 0,
-    };
+    // Pull as many datagrams as the kernel has queued in one syscall; under
+    // event storms this is what keeps the socket buffer from overflowing.
+    struct mmsghdr msgs[kMaxMessagesPerRead];
+    struct iovec iovs[kMaxMessagesPerRead];
+    for (size_t i = 0; i < kMaxMessagesPerRead; i++) {
+        ReadBuffer& read = mReadBuffers[i];
+        iovs[i] = {read.buffer, sizeof(read.buffer) - 1};
+        memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = read.control;
+        msgs[i].msg_hdr.msg_controllen = sizeof(read.control);
+    }
 
     int socket = cli->getSocket();
 
-    // To clear the entire buffer is secure/safe, but this contributes to 1.68%
-    // overhead under logging load. We are safe because we check counts, but
-    // still need to clear null terminator
-    // memset(buffer, 0, sizeof(buffer));
-    ssize_t n = recvmsg(socket, &hdr, 0);
-    if (n <= (ssize_t)(sizeof(android_log_header_t))) {
+    // The poll already saw data; MSG_DONTWAIT only stops the drain once the
+    // queue is empty instead of blocking for a full batch.
+    int count = TEMP_FAILURE_RETRY(recvmmsg(socket, msgs, kMaxMessagesPerRead, MSG_DONTWAIT, NULL));
+    if (count <= 0) {
         return false;
     }
 
-    buffer[n] = 0;
+    for (int i = 0; i < count; i++) {
+        char* buffer = mReadBuffers[i].buffer;
+        ssize_t n = msgs[i].msg_len;
+        if (n <= (ssize_t)(sizeof(android_log_header_t))) {
+            continue;
+        }
+
+        buffer[n] = 0;
 
-    struct ucred* cred = NULL;
+        struct ucred* cred = NULL;
 
-    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
-    while (cmsg != NULL) {
-        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_CREDENTIALS) {
-            cred = (struct ucred*)CMSG_DATA(cmsg);
-            break;
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr);
+        while (cmsg != NULL) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_CREDENTIALS) {
+                cred = (struct ucred*)CMSG_DATA(cmsg);
+                break;
+            }
+            cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg);
         }
-        cmsg = CMSG_NXTHDR(&hdr, cmsg);
-    }
 
-    struct ucred fake_cred;
-    if (cred == NULL) {
-        cred = &fake_cred;
-        cred->pid = 0;
-        cred->uid = DEFAULT_OVERFLOWUID;
-    }
+        struct ucred fake_cred;
+        if (cred == NULL) {
+            cred = &fake_cred;
+            cred->pid = 0;
+            cred->uid = DEFAULT_OVERFLOWUID;
+        }
 
-    char* ptr = ((char*)buffer) + sizeof(android_log_header_t);
-    n -= sizeof(android_log_header_t);
+        char* ptr = ((char*)buffer) + sizeof(android_log_header_t);
+        n -= sizeof(android_log_header_t);
 
-    log_msg msg;
+        log_msg msg;
 
-    msg.entry.len = n;
-    msg.entry.hdr_size = kLogMsgHeaderSize;
-    msg.entry.sec = time(nullptr);
-    msg.entry.pid = cred->pid;
-    msg.entry.uid = cred->uid;
+        msg.entry.len = n;
+        msg.entry.hdr_size = kLogMsgHeaderSize;
+        msg.entry.sec = time(nullptr);
+        msg.entry.pid = cred->pid;
+        msg.entry.uid = cred->uid;
 
-    memcpy(msg.buf + kLogMsgHeaderSize, ptr, n + 1);
-    LogEvent event(msg);
+        memcpy(msg.buf + kLogMsgHeaderSize, ptr, n + 1);
 
-    // Call the listener
-    mListener->OnLogEvent(&event, false /*reconnected, N/A in statsd socket*/);
+        // Constructing the event only copies the payload and decodes its
+        // header; the field walk happens lazily on the processing thread.
+        enqueueEvent(std::make_unique<LogEvent>(msg));
+    }
 
     return true;
 }
 
+bool StatsSocketListener::enqueueEvent(std::unique_ptr<LogEvent> event) {
+    size_t head = mQueueHead.load(std::memory_order_relaxed);
+    size_t tail = mQueueTail.load(std::memory_order_acquire);
+    if (head - tail >= kEventQueueCapacity) {
+        size_t dropped = mDroppedEvents.fetch_add(1, std::memory_order_relaxed) + 1;
+        if ((dropped & 0x3ff) == 1) {
+            ALOGW("stats event queue full; %zu events dropped so far", dropped);
+        }
+        return false;
+    }
+
+    mEventQueue[head & (kEventQueueCapacity - 1)] = std::move(event);
+    // seq_cst on the head publish and the sleeping check pairs with the
+    // consumer's seq_cst sleeping store and head re-check: either the
+    // consumer sees the new head and doesn't block, or this thread sees
+    // mSleeping set and notifies. A wakeup can't fall between the two.
+    mQueueHead.store(head + 1, std::memory_order_seq_cst);
+
+    if (mSleeping.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(mWakeupLock);
+        mWakeupCondition.notify_one();
+    }
+    return true;
+}
+
+void StatsSocketListener::processEvents() {
+    prctl(PR_SET_NAME, "statsd.process");
+
+    while (mRunning.load(std::memory_order_relaxed)) {
+        size_t tail = mQueueTail.load(std::memory_order_relaxed);
+        if (tail == mQueueHead.load(std::memory_order_acquire)) {
+            std::unique_lock<std::mutex> lock(mWakeupLock);
+            // Advertise that we're about to block *before* re-checking the
+            // head in the wait predicate; see enqueueEvent.
+            mSleeping.store(true, std::memory_order_seq_cst);
+            mWakeupCondition.wait(lock, [this] {
+                return !mRunning.load(std::memory_order_relaxed) ||
+                       mQueueTail.load(std::memory_order_relaxed) !=
+                               mQueueHead.load(std::memory_order_seq_cst);
+            });
+            mSleeping.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        std::unique_ptr<LogEvent> event =
+                std::move(mEventQueue[tail & (kEventQueueCapacity - 1)]);
+        mQueueTail.store(tail + 1, std::memory_order_release);
+
+        mListener->OnLogEvent(event.get(), false /*reconnected, N/A in statsd socket*/);
+    }
+}
+
 int StatsSocketListener::getLogSocket() {
     static const char socketName[] = "statsdw";
     int sock = android_get_control_socket(socketName);
@@ -15,6 +15,14 @@
  */
 #pragma once
 
+#include <sys/socket.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include <sysutils/SocketListener.h>
 #include <utils/RefBase.h>
 #include "logd/LogListener.h"
@@ -43,11 +51,66 @@ protected:
     virtual bool onDataAvailable(SocketClient* cli);
 
 private:
+    /**
+     * Per-message receive buffer, reused across recvmmsg drains.
+     */
+    struct ReadBuffer {
+        // + 1 to ensure null terminator if MAX_PAYLOAD buffer is received
+        char buffer[sizeof_log_id_t + sizeof(uint16_t) + sizeof(log_time) +
+                    LOGGER_ENTRY_MAX_PAYLOAD + 1];
+        alignas(4) char control[CMSG_SPACE(sizeof(struct ucred))];
+    };
+
+    // How many datagrams one recvmmsg call may pull off the socket.
+    static const size_t kMaxMessagesPerRead = 32;
+
+    // Ring capacity; must be a power of two.
+    static const size_t kEventQueueCapacity = 256;
+
     static int getLogSocket();
+
+    /**
+     * Pushes an event into the ring. Returns false (dropping the event)
+     * when the processing thread has fallen kEventQueueCapacity behind.
+     */
+    bool enqueueEvent(std::unique_ptr<LogEvent> event);
+
+    /**
+     * Processing thread body: drains the ring and runs the listener.
+     */
+    void processEvents();
+
     /**
      * Who is going to get the events when they're read.
      */
     sp<LogListener> mListener;
+
+    std::unique_ptr<ReadBuffer[]> mReadBuffers;
+
+    /**
+     * Single-producer single-consumer ring carrying events from the socket
+     * thread to the processing thread. A slot belongs to the producer until
+     * mQueueHead is published past it and to the consumer until mQueueTail
+     * is; the indices advance monotonically and are masked on use. The
+     * wakeup mutex is only touched while the consumer is (going) asleep,
+     * so the handoff stays lock free while events are flowing.
+     */
+    std::unique_ptr<LogEvent> mEventQueue[kEventQueueCapacity];
+    std::atomic<size_t> mQueueHead;
+    std::atomic<size_t> mQueueTail;
+    std::atomic<size_t> mDroppedEvents;
+
+    std::mutex mWakeupLock;
+    std::condition_variable mWakeupCondition;
+    /**
+     * Set (under mWakeupLock) by the processing thread before it blocks on
+     * mWakeupCondition; checked by the producer after publishing a new head
+     * so a wakeup can never be missed. See enqueueEvent for the ordering
+     * argument.
+     */
+    std::atomic<bool> mSleeping;
+    std::atomic<bool> mRunning;
+    std::thread mProcessingThread;
 };
 }  // namespace statsd
 }  // namespace os
@@ -61,9 +61,24 @@ const int FIELD_ID_MIN_PULL_INTERVAL_SEC = 4;
 
 namespace {
 
+// A suspended tuple in the iterative dimension encoder: the proto tokens that
+// must be closed once the sub tree's contiguous values run out, plus the
+// depth/prefix to resume scanning at.
+struct DimensionEncoderFrame {
+    int depth;
+    int prefix;
+    uint64_t tupleToken;
+    uint64_t dimensionToken;
+};
+
 void writeDimensionToProtoHelper(const std::vector<FieldValue>& dims, size_t* index, int depth,
                                  int prefix, std::set<string> *str_set,
                                  ProtoOutputStream* protoOutput) {
+    // Iterative over an explicit frame stack. The scratch is thread_local so
+    // a report flush over thousands of dimension keys reuses one allocation
+    // instead of building call frames and temporaries per key.
+    static thread_local std::vector<DimensionEncoderFrame> frames;
+    frames.clear();
     size_t count = dims.size();
     while (*index < count) {
         const auto& dim = dims[*index];
@@ -72,7 +87,7 @@ void writeDimensionToProtoHelper(const std::vector<FieldValue>& dims, size_t* in
         const int fieldNum = dim.mField.getPosAtDepth(depth);
         if (valueDepth > 2) {
             ALOGE("Depth > 2 not supported");
-            return;
+            break;
         }
 
         if (depth == valueDepth && valuePrefix == prefix) {
@@ -111,21 +126,35 @@ void writeDimensionToProtoHelper(const std::vector<FieldValue>& dims, size_t* in
             }
             (*index)++;
         } else if (valueDepth > depth && valuePrefix == prefix) {
-            // Writing the sub tree
+            // Descending into a sub tree: open its tokens and suspend the
+            // current level on the frame stack.
             uint64_t dimensionToken = protoOutput->start(
                     FIELD_TYPE_MESSAGE | FIELD_COUNT_REPEATED | DIMENSIONS_VALUE_TUPLE_VALUE);
             protoOutput->write(FIELD_TYPE_INT32 | DIMENSIONS_VALUE_FIELD, fieldNum);
             uint64_t tupleToken =
                     protoOutput->start(FIELD_TYPE_MESSAGE | DIMENSIONS_VALUE_VALUE_TUPLE);
-            writeDimensionToProtoHelper(dims, index, valueDepth, dim.mField.getPrefix(valueDepth),
-                                        str_set, protoOutput);
-            protoOutput->end(tupleToken);
-            protoOutput->end(dimensionToken);
+            frames.push_back(DimensionEncoderFrame{depth, prefix, tupleToken, dimensionToken});
+            depth = valueDepth;
+            prefix = dim.mField.getPrefix(valueDepth);
         } else {
-            // Done with the prev sub tree
-            return;
+            // Done with the prev sub tree; resume the suspended level.
+            if (frames.empty()) {
+                return;
+            }
+            protoOutput->end(frames.back().tupleToken);
+            protoOutput->end(frames.back().dimensionToken);
+            depth = frames.back().depth;
+            prefix = frames.back().prefix;
+            frames.pop_back();
         }
     }
+    // Ran out of values (or hit an unsupported depth); close any still-open
+    // sub trees.
+    while (!frames.empty()) {
+        protoOutput->end(frames.back().tupleToken);
+        protoOutput->end(frames.back().dimensionToken);
+        frames.pop_back();
+    }
 }
 
 void writeDimensionLeafToProtoHelper(const std::vector<FieldValue>& dims,
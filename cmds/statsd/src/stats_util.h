@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "FlatHashMap.h"
 #include "HashableDimensionKey.h"
 #include "logd/LogReader.h"
 
@@ -30,7 +31,9 @@ const MetricDimensionKey DEFAULT_METRIC_DIMENSION_KEY = MetricDimensionKey();
 
 typedef std::map<int64_t, HashableDimensionKey> ConditionKey;
 
-typedef std::unordered_map<MetricDimensionKey, int64_t> DimToValMap;
+// Per-event counter state is the hottest map in statsd; the flat map keeps
+// its entries inline instead of paying a node allocation per dimension.
+typedef FlatHashMap<MetricDimensionKey, int64_t> DimToValMap;
 
 }  // namespace statsd
 }  // namespace os
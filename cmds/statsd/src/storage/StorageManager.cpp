@@ -25,6 +25,9 @@
 #include <android-base/file.h>
 #include <dirent.h>
 #include <private/android_filesystem_config.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <fstream>
 #include <iostream>
 
@@ -68,6 +71,130 @@ static string getFilePath(const char* path, int64_t timestamp, int64_t uid, int6
                         (long long)configID);
 }
 
+// ---- Append-only segment store for metric reports ----
+//
+// Reports are appended as records into fixed-size, mmap'd segment files named
+// "segment_<index>", so a periodic flush is a memcpy plus an async msync
+// instead of a file rewrite. Each record carries a CRC so a torn write only
+// invalidates that record, and a live flag that is cleared once the record
+// has been collected into a report. A segment with no live records left is
+// deleted; that is the compaction pass. Legacy one-file-per-report data is
+// still read (parseFileName skips segment files since they lack the
+// timestamp_uid_configID format), so reports written before an update are
+// not lost.
+
+static const char* kSegmentPrefix = "segment_";
+static const size_t kSegmentSize = 128 * 1024;
+static const uint32_t kRecordMagic = 0x0B5D17A5;
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t crc;           // over the payload bytes
+    uint32_t live;          // 1 until the record is consumed into a report
+    uint32_t payloadSize;
+    int64_t timestampSec;
+    int64_t configId;
+    int32_t uid;
+    int32_t padding;        // keeps record payloads 8-byte aligned
+};
+
+static uint32_t crc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+static size_t recordSize(uint32_t payloadSize) {
+    return sizeof(RecordHeader) + ((payloadSize + 7) & ~((size_t)7));
+}
+
+struct MappedSegment {
+    string path;
+    uint8_t* base = nullptr;
+
+    ~MappedSegment() {
+        if (base != nullptr) munmap(base, kSegmentSize);
+    }
+};
+
+static bool mapSegment(const string& path, bool createIfMissing, MappedSegment* seg) {
+    int flags = O_RDWR | O_CLOEXEC | (createIfMissing ? O_CREAT : 0);
+    int fd = open(path.c_str(), flags, S_IRUSR | S_IWUSR);
+    if (fd == -1) {
+        VLOG("Attempt to access %s but failed", path.c_str());
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    if ((size_t)st.st_size != kSegmentSize) {
+        // Only size a segment we just created; a short existing file is corrupt.
+        if (!createIfMissing || st.st_size != 0 || ftruncate(fd, kSegmentSize) != 0) {
+            close(fd);
+            return false;
+        }
+        if (fchown(fd, AID_STATSD, AID_STATSD)) {
+            VLOG("Failed to chown %s to statsd", path.c_str());
+        }
+    }
+    void* base = mmap(nullptr, kSegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);  // the mapping keeps the file open
+    if (base == MAP_FAILED) {
+        VLOG("Failed to mmap %s", path.c_str());
+        return false;
+    }
+    seg->path = path;
+    seg->base = reinterpret_cast<uint8_t*>(base);
+    return true;
+}
+
+// Walks the well-formed records in a segment and returns the offset of the
+// first free byte (where the next record would be appended).
+static size_t forEachRecord(uint8_t* base,
+                            const std::function<void(RecordHeader*, uint8_t*)>& visit) {
+    size_t off = 0;
+    while (off + sizeof(RecordHeader) <= kSegmentSize) {
+        RecordHeader* header = reinterpret_cast<RecordHeader*>(base + off);
+        if (header->magic != kRecordMagic) break;
+        if (header->payloadSize == 0 || off + recordSize(header->payloadSize) > kSegmentSize) {
+            break;
+        }
+        if (visit != nullptr) {
+            visit(header, base + off + sizeof(RecordHeader));
+        }
+        off += recordSize(header->payloadSize);
+    }
+    return off;
+}
+
+// Lists segment files under path, sorted by ascending index.
+static void getSegmentPaths(const char* path, vector<std::pair<long, string>>* out) {
+    unique_ptr<DIR, decltype(&closedir)> dir(opendir(path), closedir);
+    if (dir == NULL) return;
+    const size_t prefixLen = strlen(kSegmentPrefix);
+    dirent* de;
+    while ((de = readdir(dir.get()))) {
+        char* name = de->d_name;
+        if (strncmp(name, kSegmentPrefix, prefixLen) != 0) continue;
+        out->push_back(std::make_pair(strtol(name + prefixLen, nullptr, 10),
+                                      StringPrintf("%s/%s", path, name)));
+    }
+    sort(out->begin(), out->end());
+}
+
+static bool recordMatches(const RecordHeader* header, const uint8_t* payload,
+                          const ConfigKey& key) {
+    return header->live != 0 && header->uid == key.GetUid() && header->configId == key.GetId() &&
+           crc32(payload, header->payloadSize) == header->crc;
+}
+
 void StorageManager::writeFile(const char* file, const void* buffer, int numBytes) {
     int fd = open(file, O_WRONLY | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
     if (fd == -1) {
@@ -92,6 +219,59 @@ void StorageManager::writeFile(const char* file, const void* buffer, int numByte
     close(fd);
 }
 
+void StorageManager::writeDataRecord(const ConfigKey& key, const void* buffer, size_t numBytes) {
+    if (numBytes == 0) return;
+    if (sizeof(RecordHeader) + numBytes > kSegmentSize) {
+        // Too big for a segment; keep the legacy one-file-per-report path.
+        string file_name =
+                getFilePath(STATS_DATA_DIR, getWallClockSec(), key.GetUid(), key.GetId());
+        writeFile(file_name.c_str(), buffer, numBytes);
+        return;
+    }
+    trimToFit(STATS_DATA_DIR);
+
+    vector<std::pair<long, string>> segments;
+    getSegmentPaths(STATS_DATA_DIR, &segments);
+
+    // Append into the newest segment if the record fits, else open the next one.
+    MappedSegment seg;
+    size_t off = 0;
+    if (!segments.empty() && mapSegment(segments.back().second, false, &seg)) {
+        off = forEachRecord(seg.base, nullptr);
+        if (off + recordSize(static_cast<uint32_t>(numBytes)) > kSegmentSize) {
+            munmap(seg.base, kSegmentSize);
+            seg.base = nullptr;
+        }
+    }
+    if (seg.base == nullptr) {
+        long nextIndex = segments.empty() ? 0 : segments.back().first + 1;
+        string path = StringPrintf("%s/%s%ld", STATS_DATA_DIR, kSegmentPrefix, nextIndex);
+        if (!mapSegment(path, true, &seg)) {
+            ALOGE("Attempt to write segment %s but failed", path.c_str());
+            return;
+        }
+        off = 0;
+    }
+
+    RecordHeader* header = reinterpret_cast<RecordHeader*>(seg.base + off);
+    header->crc = crc32(reinterpret_cast<const uint8_t*>(buffer), numBytes);
+    header->live = 1;
+    header->payloadSize = static_cast<uint32_t>(numBytes);
+    header->timestampSec = getWallClockSec();
+    header->configId = key.GetId();
+    header->uid = key.GetUid();
+    header->padding = 0;
+    memcpy(seg.base + off + sizeof(RecordHeader), buffer, numBytes);
+    // Publish the record only once its payload is in place, so a concurrent
+    // or post-crash scan never walks past a half-written record.
+    __sync_synchronize();
+    header->magic = kRecordMagic;
+    if (msync(seg.base, kSegmentSize, MS_ASYNC) != 0) {
+        VLOG("Failed to msync %s", seg.path.c_str());
+    }
+    VLOG("Successfully appended %zu bytes to %s", numBytes, seg.path.c_str());
+}
+
 void StorageManager::deleteFile(const char* file) {
     if (remove(file) != 0) {
         VLOG("Attempt to delete %s but is not found", file);
@@ -158,6 +338,19 @@ void StorageManager::sendBroadcast(const char* path,
 
         sendBroadcast(ConfigKey((int)uid, configID));
     }
+
+    // Also announce data sitting in segment records.
+    vector<std::pair<long, string>> segments;
+    getSegmentPaths(path, &segments);
+    for (const auto& segment : segments) {
+        MappedSegment seg;
+        if (!mapSegment(segment.second, false, &seg)) continue;
+        forEachRecord(seg.base, [&sendBroadcast](RecordHeader* header, uint8_t* payload) {
+            if (header->live != 0 && crc32(payload, header->payloadSize) == header->crc) {
+                sendBroadcast(ConfigKey(header->uid, header->configId));
+            }
+        });
+    }
 }
 
 bool StorageManager::hasConfigMetricsReport(const ConfigKey& key) {
@@ -185,6 +378,18 @@ bool StorageManager::hasConfigMetricsReport(const ConfigKey& key) {
             return true;
         }
     }
+
+    vector<std::pair<long, string>> segments;
+    getSegmentPaths(STATS_DATA_DIR, &segments);
+    for (const auto& segment : segments) {
+        MappedSegment seg;
+        if (!mapSegment(segment.second, false, &seg)) continue;
+        bool found = false;
+        forEachRecord(seg.base, [&found, &key](RecordHeader* header, uint8_t* payload) {
+            found |= recordMatches(header, payload, key);
+        });
+        if (found) return true;
+    }
     return false;
 }
 
@@ -228,6 +433,37 @@ void StorageManager::appendConfigMetricsReport(const ConfigKey& key, ProtoOutput
             remove(file_name.c_str());
         }
     }
+
+    // Collect matching segment records, marking each one dead once read.
+    vector<std::pair<long, string>> segments;
+    getSegmentPaths(STATS_DATA_DIR, &segments);
+    for (const auto& segment : segments) {
+        MappedSegment seg;
+        if (!mapSegment(segment.second, false, &seg)) continue;
+        bool consumed = false;
+        int liveLeft = 0;
+        forEachRecord(seg.base,
+                      [&](RecordHeader* header, uint8_t* payload) {
+            if (recordMatches(header, payload, key)) {
+                proto->write(FIELD_TYPE_MESSAGE | FIELD_COUNT_REPEATED | FIELD_ID_REPORTS,
+                             reinterpret_cast<char*>(payload), header->payloadSize);
+                header->live = 0;
+                consumed = true;
+            } else if (header->live != 0) {
+                liveLeft++;
+            }
+        });
+        if (consumed) {
+            if (liveLeft == 0) {
+                // Compaction: every record in this segment has been read.
+                munmap(seg.base, kSegmentSize);
+                seg.base = nullptr;
+                deleteFile(segment.second.c_str());
+            } else if (msync(seg.base, kSegmentSize, MS_ASYNC) != 0) {
+                VLOG("Failed to msync %s", seg.path.c_str());
+            }
+        }
+    }
 }
 
 bool StorageManager::readFileToString(const char* file, string* content) {
@@ -337,6 +573,33 @@ void StorageManager::trimToFit(const char* path) {
         VLOG("Path %s does not exist", path);
         return;
     }
+
+    // Compaction for the segment store: expire old records and drop segments
+    // with no live records left.
+    vector<std::pair<long, string>> segments;
+    getSegmentPaths(path, &segments);
+    for (const auto& segment : segments) {
+        MappedSegment seg;
+        if (!mapSegment(segment.second, false, &seg)) continue;
+        int live = 0;
+        bool changed = false;
+        size_t used = forEachRecord(seg.base, [&live, &changed](RecordHeader* header, uint8_t*) {
+            if (header->live != 0 &&
+                getWallClockSec() - header->timestampSec > StatsdStats::kMaxAgeSecond) {
+                header->live = 0;
+                changed = true;
+            }
+            if (header->live != 0) live++;
+        });
+        if (live == 0 && used > 0) {
+            munmap(seg.base, kSegmentSize);
+            seg.base = nullptr;
+            deleteFile(segment.second.c_str());
+        } else if (changed && msync(seg.base, kSegmentSize, MS_ASYNC) != 0) {
+            VLOG("Failed to msync %s", seg.path.c_str());
+        }
+    }
+
     dirent* de;
     int totalFileSize = 0;
     vector<string> fileNames;
@@ -435,6 +698,22 @@ void StorageManager::printDirStats(FILE* out, const char* path) {
         fprintf(out, "\n");
         fileCount++;
     }
+
+    vector<std::pair<long, string>> segments;
+    getSegmentPaths(path, &segments);
+    for (const auto& segment : segments) {
+        MappedSegment seg;
+        if (!mapSegment(segment.second, false, &seg)) continue;
+        int liveRecords = 0;
+        size_t used = forEachRecord(seg.base, [&liveRecords](RecordHeader* header, uint8_t*) {
+            if (header->live != 0) liveRecords++;
+        });
+        fprintf(out, "\tSegment %s: %d live records, %zu of %zu bytes used\n",
+                segment.second.c_str(), liveRecords, used, kSegmentSize);
+        totalFileSize += (int)kSegmentSize;
+        fileCount++;
+    }
+
     fprintf(out, "\tTotal number of files: %d, Total size of files: %d bytes.\n",
             fileCount, totalFileSize);
 }
@@ -36,6 +36,16 @@ public:
      */
     static void writeFile(const char* file, const void* buffer, int numBytes);
 
+    /**
+     * Persists a serialized ConfigMetricsReport for the given config by
+     * appending it as a record into the current mmap'd segment file in the
+     * stats-data directory. Each record carries a CRC so torn writes are
+     * detected on read, and appending costs a memcpy plus an async msync
+     * instead of a file rewrite. Oversized reports fall back to their own
+     * file.
+     */
+    static void writeDataRecord(const ConfigKey& key, const void* buffer, size_t numBytes);
+
     /**
      * Reads the file content to the buffer.
      */
@@ -171,6 +171,52 @@ TEST(AtomMatcherTest, TestSubDimension) {
     EXPECT_TRUE(dim.contains(subDim4));
 }
 
+TEST(AtomMatcherTest, TestDimensionKeyInterning) {
+    int pos1[] = {1, 0, 0};
+    int pos2[] = {2, 0, 0};
+    Field field1(10, pos1, 0);
+    Field field2(10, pos2, 0);
+
+    Value value1((int32_t)10025);
+    Value value2("tag");
+
+    HashableDimensionKey dimA;
+    dimA.addValue(FieldValue(field1, value1));
+    dimA.addValue(FieldValue(field2, value2));
+
+    HashableDimensionKey dimB;
+    dimB.addValue(FieldValue(field1, value1));
+    dimB.addValue(FieldValue(field2, value2));
+
+    // Hashing interns the key; equal tuples share one id.
+    EXPECT_EQ(hashDimension(dimA), hashDimension(dimB));
+    EXPECT_NE((uint64_t)0, dimA.getInternedId());
+    EXPECT_EQ(dimA.getInternedId(), dimB.getInternedId());
+    EXPECT_TRUE(dimA == dimB);
+
+    // The values are still readable through the canonical tuple.
+    EXPECT_EQ((size_t)2, dimA.getValues().size());
+    EXPECT_EQ(10025, dimA.getValues()[0].mValue.int_value);
+
+    // Copies of an interned key stay interned and equal.
+    HashableDimensionKey dimCopy = dimA;
+    EXPECT_EQ(dimA.getInternedId(), dimCopy.getInternedId());
+    EXPECT_TRUE(dimCopy == dimB);
+
+    // A different tuple gets a different id.
+    HashableDimensionKey dimC;
+    dimC.addValue(FieldValue(field1, value1));
+    hashDimension(dimC);
+    EXPECT_NE(dimA.getInternedId(), dimC.getInternedId());
+    EXPECT_FALSE(dimA == dimC);
+
+    // Mutation un-interns the key; it compares by value again.
+    dimCopy.mutableValue(0)->mValue.setInt(10026);
+    EXPECT_EQ((uint64_t)0, dimCopy.getInternedId());
+    EXPECT_FALSE(dimCopy == dimA);
+    EXPECT_EQ(10026, dimCopy.getValues()[0].mValue.int_value);
+}
+
 TEST(AtomMatcherTest, TestMetric2ConditionLink) {
     AttributionNodeInternal attribution_node1;
     attribution_node1.set_uid(1111);
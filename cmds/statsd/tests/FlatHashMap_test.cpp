@@ -0,0 +1,116 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include "src/FlatHashMap.h"
+
+#ifdef __ANDROID__
+
+namespace android {
+namespace os {
+namespace statsd {
+
+TEST(FlatHashMapTest, TestInsertFindErase) {
+    FlatHashMap<int, int> map;
+    EXPECT_TRUE(map.empty());
+
+    map[1] = 10;
+    map[2] = 20;
+    map.insert({3, 30});
+    EXPECT_EQ((size_t)3, map.size());
+
+    auto it = map.find(2);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(20, it->second);
+    EXPECT_TRUE(map.find(4) == map.end());
+    EXPECT_EQ((size_t)1, map.count(1));
+    EXPECT_EQ((size_t)0, map.count(4));
+
+    // Duplicate insert does not overwrite; operator[] finds the entry.
+    auto result = map.insert({3, 99});
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(30, map[3]);
+
+    EXPECT_EQ((size_t)1, map.erase(1));
+    EXPECT_EQ((size_t)0, map.erase(1));
+    EXPECT_EQ((size_t)2, map.size());
+    EXPECT_TRUE(map.find(1) == map.end());
+
+    // The erased slot is reusable.
+    map[1] = 11;
+    EXPECT_EQ(11, map[1]);
+}
+
+TEST(FlatHashMapTest, TestGrowthKeepsEntries) {
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 1000; i++) {
+        map[i] = i * 2;
+    }
+    EXPECT_EQ((size_t)1000, map.size());
+    for (int i = 0; i < 1000; i++) {
+        auto it = map.find(i);
+        ASSERT_TRUE(it != map.end());
+        EXPECT_EQ(i * 2, it->second);
+    }
+
+    std::set<int> seen;
+    for (const auto& kv : map) {
+        seen.insert(kv.first);
+    }
+    EXPECT_EQ((size_t)1000, seen.size());
+}
+
+TEST(FlatHashMapTest, TestEraseWhileIterating) {
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; i++) {
+        map[i] = i;
+    }
+
+    // Drop the even keys the way the duration flush loops do.
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->first % 2 == 0) {
+            it = map.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ((size_t)50, map.size());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(i % 2 == 0 ? (size_t)0 : (size_t)1, map.count(i));
+    }
+}
+
+TEST(FlatHashMapTest, TestMoveOnlyValues) {
+    FlatHashMap<int, std::unique_ptr<int>> map;
+    map[5] = std::make_unique<int>(50);
+    map[6] = std::make_unique<int>(60);
+
+    auto it = map.find(5);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(50, *it->second);
+
+    map.erase(5);
+    EXPECT_TRUE(map.find(5) == map.end());
+    EXPECT_EQ((size_t)1, map.size());
+}
+
+}  // namespace statsd
+}  // namespace os
+}  // namespace android
+#else
+GTEST_LOG_(INFO) << "This test does nothing.\n";
+#endif
@@ -158,6 +158,60 @@ TEST(LogEventTest, TestLogParsing2) {
     EXPECT_EQ((float)1.1, item7.mValue.float_value);
 }
 
+TEST(LogEventTest, TestLazyParsingFromLogMsg) {
+    log_msg msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.entry_v4.hdr_size = sizeof(msg.entry_v4);
+    msg.entry_v4.sec = 1000;
+    msg.entry_v4.nsec = 999;
+    msg.entry_v4.uid = 1000;
+
+    // Serialize [timestamp, tag id, int value] the way the stats writer does.
+    char* payload = reinterpret_cast<char*>(msg.buf) + sizeof(msg.entry_v4);
+    const uint32_t statsEventTag = 1937006964;
+    memcpy(payload, &statsEventTag, sizeof(statsEventTag));
+    char* elements = payload + sizeof(statsEventTag);
+
+    android_event_list_t list;
+    list.type = EVENT_TYPE_LIST;
+    list.element_count = 3;
+    memcpy(elements, &list, sizeof(list));
+    elements += sizeof(list);
+
+    android_event_long_t timestamp;
+    timestamp.type = EVENT_TYPE_LONG;
+    timestamp.data = 123;
+    memcpy(elements, &timestamp, sizeof(timestamp));
+    elements += sizeof(timestamp);
+
+    android_event_int_t tag;
+    tag.type = EVENT_TYPE_INT;
+    tag.data = 42;
+    memcpy(elements, &tag, sizeof(tag));
+    elements += sizeof(tag);
+
+    android_event_int_t value;
+    value.type = EVENT_TYPE_INT;
+    value.data = 100;
+    memcpy(elements, &value, sizeof(value));
+    elements += sizeof(value);
+
+    msg.entry_v4.len = elements - payload;
+
+    LogEvent event(msg);
+
+    // The tag id and timestamps come from the header decode alone.
+    EXPECT_EQ(42, event.GetTagId());
+    EXPECT_EQ((int64_t)123, event.GetElapsedTimestampNs());
+    EXPECT_EQ((uint32_t)1000, event.GetUid());
+
+    // The first field access materializes the values.
+    status_t err = NO_ERROR;
+    EXPECT_EQ(100, event.GetInt(1, &err));
+    EXPECT_EQ(NO_ERROR, err);
+    EXPECT_EQ((size_t)1, event.getValues().size());
+}
+
 
 }  // namespace statsd
 }  // namespace os
@@ -140,6 +140,30 @@ StatsdConfig MakeConfig(bool includeMetric) {
     return config;
 }
 
+TEST(StatsLogProcessorTest, TestUnchangedConfigKeepsMetricsManager) {
+    sp<UidMap> m = new UidMap();
+    sp<AlarmMonitor> anomalyAlarmMonitor;
+    sp<AlarmMonitor> subscriberAlarmMonitor;
+    int broadcastCount = 0;
+    StatsLogProcessor p(m, anomalyAlarmMonitor, subscriberAlarmMonitor, 0,
+                        [&broadcastCount](const ConfigKey& key) { broadcastCount++; return true;});
+    ConfigKey key(3, 4);
+    StatsdConfig config = MakeConfig(true);
+    p.OnConfigUpdated(0, key, config);
+    sp<MetricsManager> firstManager = p.mMetricsManagers[key];
+
+    // Re-pushing the same config must not rebuild the manager (and lose its
+    // in-flight buckets).
+    p.OnConfigUpdated(1, key, config);
+    EXPECT_EQ(firstManager.get(), p.mMetricsManagers[key].get());
+
+    // An actual change still swaps in a new manager.
+    config.add_count_metric()->CopyFrom(config.count_metric(0));
+    config.mutable_count_metric(1)->set_id(StringToId("AppCrashes2"));
+    p.OnConfigUpdated(2, key, config);
+    EXPECT_NE(firstManager.get(), p.mMetricsManagers[key].get());
+}
+
 TEST(StatsLogProcessorTest, TestUidMapHasSnapshot) {
     // Setup simple config key corresponding to empty config.
     sp<UidMap> m = new UidMap();
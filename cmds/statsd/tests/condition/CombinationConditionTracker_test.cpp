@@ -155,6 +155,27 @@ TEST(ConditionTrackerTest, TestNorCondition) {
     EXPECT_FALSE(evaluateCombinationCondition(children, operation, conditionResults));
 }
 
+TEST(ConditionTrackerTest, TestNotEvaluatedCondition) {
+    // Children that were never evaluated don't count as unknown.
+    LogicalOperation operation = LogicalOperation::AND;
+
+    vector<int> children;
+    children.push_back(0);
+    children.push_back(1);
+
+    vector<ConditionState> conditionResults;
+    conditionResults.push_back(ConditionState::kNotEvaluated);
+    conditionResults.push_back(ConditionState::kTrue);
+
+    EXPECT_TRUE(evaluateCombinationCondition(children, operation, conditionResults));
+
+    conditionResults.clear();
+    conditionResults.push_back(ConditionState::kNotEvaluated);
+    conditionResults.push_back(ConditionState::kUnknown);
+    EXPECT_EQ(evaluateCombinationCondition(children, operation, conditionResults),
+              ConditionState::kUnknown);
+}
+
 #else
 GTEST_LOG_(INFO) << "This test does nothing.\n";
 #endif
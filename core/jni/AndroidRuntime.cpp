@@ -46,7 +46,9 @@
 #include <dirent.h>
 #include <assert.h>
 
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace android;
@@ -1341,12 +1343,83 @@ static int register_jni_procs(const RegJNIRec array[], size_t count, JNIEnv* env
     return 0;
 }
 
-static const RegJNIRec gRegJNI[] = {
+/*
+ * Run the registration procs in "array" on a handful of attached threads, with
+ * the calling thread participating.  Each proc only resolves and registers its
+ * own classes, so the procs are independent of each other and the final state
+ * doesn't depend on which thread runs which proc.  On failure the workers
+ * drain quickly and -1 is returned.
+ */
+static int register_jni_procs_parallel(const RegJNIRec array[], size_t count, JNIEnv* env)
+{
+    const unsigned hwThreads = std::thread::hardware_concurrency();
+    if (hwThreads <= 1 || count < 2) {
+        return register_jni_procs(array, count, env);
+    }
+
+    std::atomic<size_t> nextIndex(0);
+    std::atomic<bool> failed(false);
+
+    auto work = [&](JNIEnv* workerEnv) {
+        size_t i;
+        while (!failed.load(std::memory_order_relaxed) &&
+                (i = nextIndex.fetch_add(1, std::memory_order_relaxed)) < count) {
+            if (workerEnv->PushLocalFrame(32) < 0) {
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+            if (array[i].mProc(workerEnv) < 0) {
+#ifndef NDEBUG
+                ALOGD("----------!!! %s failed to load\n", array[i].mName);
+#endif
+                failed.store(true, std::memory_order_relaxed);
+            }
+            workerEnv->PopLocalFrame(NULL);
+        }
+    };
+
+    JavaVM* vm;
+    env->GetJavaVM(&vm);
+
+    const size_t workerCount = std::min(size_t(4), size_t(hwThreads)) - 1;
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.emplace_back([vm, &work, &failed]() {
+            JNIEnv* workerEnv = NULL;
+            JavaVMAttachArgs args;
+            args.version = JNI_VERSION_1_4;
+            args.name = "RegisterNatives";
+            args.group = NULL;
+            if (vm->AttachCurrentThread(&workerEnv, &args) != JNI_OK) {
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+            work(workerEnv);
+            vm->DetachCurrentThread();
+        });
+    }
+    work(env);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    return failed.load(std::memory_order_relaxed) ? -1 : 0;
+}
+
+/*
+ * Registered serially on the calling thread before everything else: the zygote's
+ * early startup and the error paths of registration itself depend on these.
+ */
+static const RegJNIRec gRegJNIEarly[] = {
     REG_JNI(register_com_android_internal_os_RuntimeInit),
     REG_JNI(register_com_android_internal_os_ZygoteInit_nativeZygoteInit),
     REG_JNI(register_android_os_SystemClock),
     REG_JNI(register_android_util_EventLog),
     REG_JNI(register_android_util_Log),
+};
+
+static const RegJNIRec gRegJNI[] = {
     REG_JNI(register_android_util_MemoryIntArray),
     REG_JNI(register_android_util_PathParser),
     REG_JNI(register_android_util_StatsLog),
@@ -1528,12 +1601,20 @@ static const RegJNIRec gRegJNI[] = {
      */
     env->PushLocalFrame(200);
 
-    if (register_jni_procs(gRegJNI, NELEM(gRegJNI), env) < 0) {
+    if (register_jni_procs(gRegJNIEarly, NELEM(gRegJNIEarly), env) < 0) {
         env->PopLocalFrame(NULL);
         return -1;
     }
     env->PopLocalFrame(NULL);
 
+    /*
+     * The bulk of the table is order independent, so spread it across a few
+     * threads; register_jni_procs_parallel manages a local frame per proc.
+     */
+    if (register_jni_procs_parallel(gRegJNI, NELEM(gRegJNI), env) < 0) {
+        return -1;
+    }
+
     //createJavaThread("fubar", quickTest, (void*) "hello");
 
     return 0;
@@ -1549,6 +1630,9 @@ AndroidRuntime* AndroidRuntime::getRuntime()
  * the framework.
  */
 extern "C" jint registerFrameworkNatives(JNIEnv* env) {
+    if (register_jni_procs(gRegJNIEarly, NELEM(gRegJNIEarly), env) < 0) {
+        return -1;
+    }
     return register_jni_procs(gRegJNI, NELEM(gRegJNI), env);
 }
 }   // namespace android
@@ -16,10 +16,17 @@
 #include "core_jni_helpers.h"
 
 #include <nativehelper/JNIHelp.h>
+#include <nativehelper/ScopedLocalRef.h>
 #include <androidfw/Asset.h>
 #include <androidfw/ResourceTypes.h>
 #include <cutils/compiler.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <netinet/in.h>
 #include <stdio.h>
 #include <sys/mman.h>
@@ -158,6 +165,94 @@ private:
     const unsigned int mSize;
 };
 
+// Pixels decoded on the scale and hardware paths are scratch: they are copied
+// into the final bitmap (or uploaded to gralloc) and freed again before the
+// decode returns.  Rather than paying a large malloc/free pair per decode,
+// scratch buffers are recycled through a process-wide pool of power-of-two
+// size classes.  The default path is deliberately not pooled; its storage
+// becomes the Java Bitmap's backing and lives for as long as the bitmap does.
+static const size_t kScratchMinClassBytes = 64 * 1024;
+static const size_t kScratchMaxClassBytes = 16 * 1024 * 1024;
+static const int kScratchClassCount = 9;  // 64KB, 128KB, ..., 16MB
+static const size_t kScratchPoolCapBytes = 32 * 1024 * 1024;
+
+static std::mutex gScratchPoolLock;
+static std::vector<void*> gScratchPool[kScratchClassCount];
+static size_t gScratchPoolBytes = 0;
+
+// Returns the size class index for a capacity, or -1 if it is not poolable.
+static int scratchClassForCapacity(size_t capacity) {
+    size_t classBytes = kScratchMinClassBytes;
+    for (int i = 0; i < kScratchClassCount; i++, classBytes <<= 1) {
+        if (capacity == classBytes) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void* acquireScratchPixels(size_t size, size_t* outCapacity) {
+    if (size <= kScratchMaxClassBytes) {
+        size_t classBytes = kScratchMinClassBytes;
+        int classIndex = 0;
+        while (classBytes < size) {
+            classBytes <<= 1;
+            classIndex++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(gScratchPoolLock);
+            if (!gScratchPool[classIndex].empty()) {
+                void* pixels = gScratchPool[classIndex].back();
+                gScratchPool[classIndex].pop_back();
+                gScratchPoolBytes -= classBytes;
+                *outCapacity = classBytes;
+                return pixels;
+            }
+        }
+        *outCapacity = classBytes;
+        return malloc(classBytes);
+    }
+    // Too large to recycle; fall back to a plain allocation.
+    *outCapacity = size;
+    return malloc(size);
+}
+
+static void releaseScratchPixels(void* pixels, void* context) {
+    const size_t capacity = reinterpret_cast<size_t>(context);
+    const int classIndex = scratchClassForCapacity(capacity);
+    if (classIndex >= 0) {
+        std::lock_guard<std::mutex> lock(gScratchPoolLock);
+        if (gScratchPoolBytes + capacity <= kScratchPoolCapBytes) {
+            gScratchPool[classIndex].push_back(pixels);
+            gScratchPoolBytes += capacity;
+            return;
+        }
+    }
+    free(pixels);
+}
+
+class ScratchPixelAllocator : public SkBitmap::Allocator {
+public:
+    virtual bool allocPixelRef(SkBitmap* bitmap) {
+        const SkImageInfo& info = bitmap->info();
+        if (info.colorType() == kUnknown_SkColorType) {
+            return false;
+        }
+        const size_t size = info.computeByteSize(bitmap->rowBytes());
+        if (size > SK_MaxS32) {
+            ALOGW("bitmap is too large");
+            return false;
+        }
+        size_t capacity;
+        void* pixels = acquireScratchPixels(size, &capacity);
+        if (!pixels) {
+            return false;
+        }
+        return bitmap->installPixels(info, pixels, bitmap->rowBytes(), releaseScratchPixels,
+                                     reinterpret_cast<void*>(capacity));
+    }
+};
+
 // Necessary for decodes when the native decoder cannot scale to appropriately match the sampleSize
 // (for example, RAW). If the sampleSize divides evenly into the dimension, we require that the
 // scale matches exactly. If sampleSize does not divide evenly, we allow the decoder to choose how
@@ -333,7 +428,7 @@ static jobject doDecode(JNIEnv* env, std::unique_ptr<SkStreamRewindable> stream,
     HeapAllocator defaultAllocator;
     RecyclingPixelAllocator recyclingAllocator(reuseBitmap, existingBufferSize);
     ScaleCheckingAllocator scaleCheckingAllocator(scale, existingBufferSize);
-    SkBitmap::HeapAllocator heapAllocator;
+    ScratchPixelAllocator scratchAllocator;
     SkBitmap::Allocator* decodeAllocator;
     if (javaBitmap != nullptr && willScale) {
         // This will allocate pixels using a HeapAllocator, since there will be an extra
@@ -343,10 +438,10 @@ static jobject doDecode(JNIEnv* env, std::unique_ptr<SkStreamRewindable> stream,
     } else if (javaBitmap != nullptr) {
         decodeAllocator = &recyclingAllocator;
     } else if (willScale || isHardware) {
-        // This will allocate pixels using a HeapAllocator,
+        // This will allocate short-lived pixels from the scratch pool,
         // for scale case: there will be an extra scaling step.
         // for hardware case: there will be extra swizzling & upload to gralloc step.
-        decodeAllocator = &heapAllocator;
+        decodeAllocator = &scratchAllocator;
     } else {
         decodeAllocator = &defaultAllocator;
     }
@@ -595,6 +690,142 @@ static jobject nativeDecodeByteArray(JNIEnv* env, jobject, jbyteArray byteArray,
                     nullptr, options);
 }
 
+// A small process-wide decode service.  Workers are spun up lazily on the
+// first submission, attach to the runtime once and then stay warm, so SkCodec
+// scratch state, the pixel pool above and the thread attachments all amortize
+// across batches.  Results are delivered by calling the listener's
+// onBitmapDecoded(int, Bitmap) on a worker thread; the managed side is
+// responsible for bouncing back to its own thread if it needs to.
+struct DecodeBatch {
+    jobject listener;       // global ref, released with the last job
+    jmethodID onDecoded;    // onBitmapDecoded(ILandroid/graphics/Bitmap;)V
+    std::atomic<int> remaining;
+};
+
+struct DecodeJob {
+    DecodeBatch* batch;
+    jint index;
+    std::vector<uint8_t> encoded;
+};
+
+static std::mutex gDecodePoolLock;
+static std::condition_variable gDecodePoolCondition;
+static std::deque<DecodeJob*> gDecodeQueue;
+static bool gDecodePoolStarted = false;
+
+static void decodeWorkerLoop() {
+    JNIEnv* env;
+    JavaVMAttachArgs args;
+    args.version = JNI_VERSION_1_4;
+    args.name = "BitmapDecodeWorker";
+    args.group = nullptr;
+    JavaVM* vm = AndroidRuntime::getJavaVM();
+    if (vm->AttachCurrentThread(&env, &args) != JNI_OK) {
+        ALOGE("could not attach decode worker to the runtime");
+        return;
+    }
+    while (true) {
+        DecodeJob* job;
+        {
+            std::unique_lock<std::mutex> lock(gDecodePoolLock);
+            while (gDecodeQueue.empty()) {
+                gDecodePoolCondition.wait(lock);
+            }
+            job = gDecodeQueue.front();
+            gDecodeQueue.pop_front();
+        }
+
+        DecodeBatch* batch = job->batch;
+        if (env->PushLocalFrame(16) == 0) {
+            jobject bitmap = doDecode(env,
+                    skstd::make_unique<SkMemoryStream>(job->encoded.data(), job->encoded.size(),
+                                                       false),
+                    nullptr, nullptr);
+            if (env->ExceptionCheck()) {
+                // Report decode failures as a null bitmap rather than an
+                // exception on a thread with no one to catch it.
+                jniLogException(env, ANDROID_LOG_WARN, LOG_TAG);
+                env->ExceptionClear();
+                bitmap = nullptr;
+            }
+            env->CallVoidMethod(batch->listener, batch->onDecoded, job->index, bitmap);
+            if (env->ExceptionCheck()) {
+                jniLogException(env, ANDROID_LOG_ERROR, LOG_TAG);
+                env->ExceptionClear();
+            }
+            env->PopLocalFrame(nullptr);
+        }
+
+        if (batch->remaining.fetch_sub(1) == 1) {
+            env->DeleteGlobalRef(batch->listener);
+            delete batch;
+        }
+        delete job;
+    }
+}
+
+static void startDecodePoolLocked() {
+    if (gDecodePoolStarted) {
+        return;
+    }
+    gDecodePoolStarted = true;
+    unsigned int workerCount = std::max(1u, std::thread::hardware_concurrency() / 2);
+    workerCount = std::min(workerCount, 4u);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        std::thread(decodeWorkerLoop).detach();
+    }
+}
+
+static void nativeDecodeByteArraysAsync(JNIEnv* env, jobject, jobjectArray sources,
+        jobject listener) {
+    NPE_CHECK_RETURN_VOID(env, sources);
+    NPE_CHECK_RETURN_VOID(env, listener);
+
+    const jsize count = env->GetArrayLength(sources);
+    if (count == 0) {
+        return;
+    }
+
+    ScopedLocalRef<jclass> listenerClass(env, env->GetObjectClass(listener));
+    jmethodID onDecoded = env->GetMethodID(listenerClass.get(), "onBitmapDecoded",
+            "(ILandroid/graphics/Bitmap;)V");
+    if (onDecoded == nullptr) {
+        return;  // NoSuchMethodError is pending
+    }
+
+    DecodeBatch* batch = new DecodeBatch();
+    batch->listener = env->NewGlobalRef(listener);
+    batch->onDecoded = onDecoded;
+    batch->remaining.store(count);
+
+    // Copy the encoded bytes on the caller's thread so the workers never touch
+    // the source arrays.
+    std::vector<DecodeJob*> jobs(count);
+    for (jsize i = 0; i < count; i++) {
+        DecodeJob* job = new DecodeJob();
+        job->batch = batch;
+        job->index = i;
+        ScopedLocalRef<jbyteArray> source(env,
+                static_cast<jbyteArray>(env->GetObjectArrayElement(sources, i)));
+        if (source.get() != nullptr) {
+            const jsize length = env->GetArrayLength(source.get());
+            job->encoded.resize(length);
+            env->GetByteArrayRegion(source.get(), 0, length,
+                    reinterpret_cast<jbyte*>(job->encoded.data()));
+        }
+        jobs[i] = job;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(gDecodePoolLock);
+        startDecodePoolLocked();
+        for (DecodeJob* job : jobs) {
+            gDecodeQueue.push_back(job);
+        }
+    }
+    gDecodePoolCondition.notify_all();
+}
+
 static jboolean nativeIsSeekable(JNIEnv* env, jobject, jobject fileDescriptor) {
     jint descriptor = jniGetFDFromFileDescriptor(env, fileDescriptor);
     return isSeekable(descriptor) ? JNI_TRUE : JNI_FALSE;
@@ -628,6 +859,11 @@ static const JNINativeMethod gMethods[] = {
         (void*)nativeDecodeByteArray
     },
 
+    {   "nativeDecodeByteArraysAsync",
+        "([[BLandroid/graphics/BitmapFactory$OnBitmapDecodedListener;)V",
+        (void*)nativeDecodeByteArraysAsync
+    },
+
     {   "nativeIsSeekable",
         "(Ljava/io/FileDescriptor;)Z",
         (void*)nativeIsSeekable
@@ -34,6 +34,8 @@
 #include <jni.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+
 using namespace android;
 
 static jclass    gImageDecoder_class;
@@ -473,6 +475,123 @@ static jobject ImageDecoder_nDecodeBitmap(JNIEnv* env, jobject /*clazz*/, jlong
                                 ninePatchInsets);
 }
 
+// Incremental decoding. Rather than materializing the whole image, the managed
+// side starts a scanline session, repeatedly pulls bands of rows into a small
+// reusable bitmap, and hands each band to its own callback (to draw it
+// progressively, downscale it, etc). Peak native memory is a single band
+// instead of the full-resolution image.
+static jint ImageDecoder_nStartScanlineDecode(JNIEnv* env, jobject /*clazz*/, jlong nativePtr,
+                                              jboolean requireUnpremul, jobject jcolorSpace) {
+    auto* decoder = reinterpret_cast<ImageDecoder*>(nativePtr);
+    SkAndroidCodec* codec = decoder->mCodec.get();
+    SkImageInfo decodeInfo = codec->getInfo();
+
+    switch (decodeInfo.alphaType()) {
+        case kUnpremul_SkAlphaType:
+            if (!requireUnpremul) {
+                decodeInfo = decodeInfo.makeAlphaType(kPremul_SkAlphaType);
+            }
+            break;
+        case kPremul_SkAlphaType:
+            if (requireUnpremul) {
+                decodeInfo = decodeInfo.makeAlphaType(kUnpremul_SkAlphaType);
+            }
+            break;
+        case kOpaque_SkAlphaType:
+            break;
+        case kUnknown_SkAlphaType:
+            doThrowIOE(env, "Unknown alpha type");
+            return -1;
+    }
+
+    SkColorType colorType = codec->computeOutputColorType(kN32_SkColorType);
+    sk_sp<SkColorSpace> colorSpace = GraphicsJNI::getNativeColorSpace(env, jcolorSpace);
+    colorSpace = codec->computeOutputColorSpace(colorType, colorSpace);
+    decodeInfo = decodeInfo.makeColorType(colorType).makeColorSpace(colorSpace);
+
+    SkCodec* scanlineCodec = codec->codec();
+    if (scanlineCodec->getScanlineOrder() != SkCodec::kTopDown_SkScanlineOrder) {
+        // Bottom-up sources (e.g. some BMPs) would deliver bands out of order;
+        // callers should fall back to nDecodeBitmap for those.
+        doThrowISE(env, "Image does not support top-down scanline decoding");
+        return -1;
+    }
+
+    SkCodec::Result result = scanlineCodec->startScanlineDecode(decodeInfo);
+    if (result != SkCodec::kSuccess) {
+        SkString msg;
+        msg.printf("startScanlineDecode failed with error %s", SkCodec::ResultToString(result));
+        doThrowIOE(env, msg.c_str());
+        return -1;
+    }
+
+    decoder->mScanlineInfo = decodeInfo;
+    decoder->mScanlineRow = 0;
+    decoder->mScanlineActive = true;
+    return decodeInfo.height();
+}
+
+static jint ImageDecoder_nGetScanlines(JNIEnv* env, jobject /*clazz*/, jlong nativePtr,
+                                       jobject jbitmap, jint rowCount) {
+    auto* decoder = reinterpret_cast<ImageDecoder*>(nativePtr);
+    if (!decoder->mScanlineActive) {
+        doThrowISE(env, "No scanline decode in progress");
+        return -1;
+    }
+
+    android::Bitmap& bitmap = bitmap::toBitmap(env, jbitmap);
+    if (bitmap.isImmutable()) {
+        doThrowIAE(env, "Band bitmap must be mutable");
+        return -1;
+    }
+    SkBitmap bm;
+    GraphicsJNI::getSkBitmap(env, jbitmap, &bm);
+    const SkImageInfo& info = decoder->mScanlineInfo;
+    if (bm.colorType() != info.colorType() || bm.width() < info.width()) {
+        doThrowIAE(env, "Band bitmap does not match the scanline session");
+        return -1;
+    }
+
+    rowCount = std::min(rowCount, bm.height());
+    rowCount = std::min(rowCount, info.height() - decoder->mScanlineRow);
+    if (rowCount <= 0) {
+        return 0;
+    }
+
+    const int decoded =
+            decoder->mCodec->codec()->getScanlines(bm.getPixels(), rowCount, bm.rowBytes());
+    decoder->mScanlineRow += decoded;
+    if (decoded > 0) {
+        bitmap.notifyPixelsChanged();
+    }
+    return decoded;
+}
+
+static jint ImageDecoder_nSkipScanlines(JNIEnv* env, jobject /*clazz*/, jlong nativePtr,
+                                        jint rowCount) {
+    auto* decoder = reinterpret_cast<ImageDecoder*>(nativePtr);
+    if (!decoder->mScanlineActive) {
+        doThrowISE(env, "No scanline decode in progress");
+        return -1;
+    }
+    rowCount = std::min(rowCount, decoder->mScanlineInfo.height() - decoder->mScanlineRow);
+    if (rowCount <= 0) {
+        return 0;
+    }
+    const bool skipped = decoder->mCodec->codec()->skipScanlines(rowCount);
+    if (!skipped) {
+        return 0;
+    }
+    decoder->mScanlineRow += rowCount;
+    return rowCount;
+}
+
+static void ImageDecoder_nEndScanlineDecode(JNIEnv* /*env*/, jobject /*clazz*/, jlong nativePtr) {
+    auto* decoder = reinterpret_cast<ImageDecoder*>(nativePtr);
+    decoder->mScanlineActive = false;
+    decoder->mScanlineRow = 0;
+}
+
 static jobject ImageDecoder_nGetSampledSize(JNIEnv* env, jobject /*clazz*/, jlong nativePtr,
                                             jint sampleSize) {
     auto* decoder = reinterpret_cast<ImageDecoder*>(nativePtr);
@@ -510,6 +629,11 @@ static const JNINativeMethod gImageDecoderMethods[] = {
     { "nCreate",        "(Ljava/io/FileDescriptor;Landroid/graphics/ImageDecoder$Source;)Landroid/graphics/ImageDecoder;", (void*) ImageDecoder_nCreateFd },
     { "nDecodeBitmap",  "(JLandroid/graphics/ImageDecoder;ZIILandroid/graphics/Rect;ZIZZZLandroid/graphics/ColorSpace;)Landroid/graphics/Bitmap;",
                                                                  (void*) ImageDecoder_nDecodeBitmap },
+    { "nStartScanlineDecode", "(JZLandroid/graphics/ColorSpace;)I",
+                                                                 (void*) ImageDecoder_nStartScanlineDecode },
+    { "nGetScanlines",  "(JLandroid/graphics/Bitmap;I)I",        (void*) ImageDecoder_nGetScanlines },
+    { "nSkipScanlines", "(JI)I",                                 (void*) ImageDecoder_nSkipScanlines },
+    { "nEndScanlineDecode", "(J)V",                              (void*) ImageDecoder_nEndScanlineDecode },
     { "nGetSampledSize","(JI)Landroid/util/Size;",               (void*) ImageDecoder_nGetSampledSize },
     { "nGetPadding",    "(JLandroid/graphics/Rect;)V",           (void*) ImageDecoder_nGetPadding },
     { "nClose",         "(J)V",                                  (void*) ImageDecoder_nClose},
@@ -18,6 +18,7 @@
 
 #include <hwui/Canvas.h>
 
+#include <SkImageInfo.h>
 #include <jni.h>
 
 class SkAndroidCodec;
@@ -50,6 +51,12 @@ struct ImageDecoder {
     std::unique_ptr<SkAndroidCodec> mCodec;
     sk_sp<NinePatchPeeker> mPeeker;
 
+    // State of an in-progress scanline decode session, if any.
+    // See ImageDecoder_nStartScanlineDecode.
+    SkImageInfo mScanlineInfo = SkImageInfo::MakeUnknown();
+    int mScanlineRow = 0;
+    bool mScanlineActive = false;
+
     ImageDecoder()
         :mPeeker(new NinePatchPeeker)
     {}
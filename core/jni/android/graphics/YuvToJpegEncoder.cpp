@@ -8,6 +8,87 @@
 
 #include <jni.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Splits one interleaved VU row (NV21 chroma) into planar U and V rows.
+static void deinterleaveVuRow(const uint8_t* vu, uint8_t* uRow, uint8_t* vRow, int pairs) {
+    int i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 16 <= pairs; i += 16) {
+        uint8x16x2_t pair = vld2q_u8(vu + 2 * i);
+        vst1q_u8(vRow + i, pair.val[0]);
+        vst1q_u8(uRow + i, pair.val[1]);
+    }
+#endif
+    for (; i < pairs; ++i) {
+        vRow[i] = vu[2 * i];
+        uRow[i] = vu[2 * i + 1];
+    }
+}
+
+// Splits one interleaved YUY2 row into planar Y, U and V rows.
+static void deinterleaveYuy2Row(const uint8_t* yuv, uint8_t* yRow, uint8_t* uRow, uint8_t* vRow,
+        int pairs) {
+    int i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 16 <= pairs; i += 16) {
+        uint8x16x4_t quad = vld4q_u8(yuv + 4 * i);
+        uint8x16x2_t ys;
+        ys.val[0] = quad.val[0];
+        ys.val[1] = quad.val[2];
+        vst2q_u8(yRow + 2 * i, ys);
+        vst1q_u8(uRow + i, quad.val[1]);
+        vst1q_u8(vRow + i, quad.val[3]);
+    }
+#endif
+    for (; i < pairs; ++i) {
+        yRow[2 * i] = yuv[4 * i];
+        yRow[2 * i + 1] = yuv[4 * i + 2];
+        uRow[i] = yuv[4 * i + 1];
+        vRow[i] = yuv[4 * i + 3];
+    }
+}
+
+// Fans independent row conversions out over a few worker threads, with the
+// caller's thread taking part. Rows are claimed in strips to keep workers on
+// separate cache lines.
+template <typename RowFn>
+static void convertRowsInParallel(int rowCount, const RowFn& convertRow) {
+    unsigned int threadCount = std::min(4u, std::max(1u, std::thread::hardware_concurrency()));
+    if (rowCount < 64) {
+        threadCount = 1;  // not worth the thread churn for small frames
+    }
+    std::atomic<int> nextRow(0);
+    auto work = [&]() {
+        static const int kStripRows = 16;
+        while (true) {
+            const int row = nextRow.fetch_add(kStripRows, std::memory_order_relaxed);
+            if (row >= rowCount) {
+                break;
+            }
+            const int end = std::min(row + kStripRows, rowCount);
+            for (int r = row; r < end; ++r) {
+                convertRow(r);
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
 YuvToJpegEncoder* YuvToJpegEncoder::create(int format, int* strides) {
     // Only ImageFormat.NV21 and ImageFormat.YUY2 are supported
     // for now.
@@ -100,49 +181,44 @@ void Yuv420SpToJpegEncoder::compress(jpeg_compress_struct* cinfo,
     int height = cinfo->image_height;
     uint8_t* yPlanar = yuv + offsets[0];
     uint8_t* vuPlanar = yuv + offsets[1]; //width * height;
-    uint8_t* uRows = new uint8_t [8 * (width >> 1)];
-    uint8_t* vRows = new uint8_t [8 * (width >> 1)];
 
+    // Deinterleave the whole chroma plane up front, fanned out over a worker
+    // pool. This costs width * height / 2 bytes of scratch (a quarter of the
+    // NV21 frame) but converts with all cores instead of one, and the write
+    // loop below then only marshals row pointers.
+    const int chromaWidth = width >> 1;
+    const int chromaRows = (height + 1) >> 1;
+    uint8_t* uPlane = new uint8_t[chromaRows * chromaWidth];
+    uint8_t* vPlane = new uint8_t[chromaRows * chromaWidth];
+    convertRowsInParallel(chromaRows, [&](int row) {
+        deinterleaveVuRow(vuPlanar + row * fStrides[1], uPlane + row * chromaWidth,
+                vPlane + row * chromaWidth, chromaWidth);
+    });
 
     // process 16 lines of Y and 8 lines of U/V each time.
     while (cinfo->next_scanline < cinfo->image_height) {
-        //deitnerleave u and v
-        deinterleave(vuPlanar, uRows, vRows, cinfo->next_scanline, width, height);
-
-        // Jpeg library ignores the rows whose indices are greater than height.
+        // Jpeg library ignores the rows whose indices are greater than height,
+        // but keep the pointers in bounds by clamping to the last row.
         for (int i = 0; i < 16; i++) {
             // y row
-            y[i] = yPlanar + (cinfo->next_scanline + i) * fStrides[0];
+            int yRow = cinfo->next_scanline + i;
+            if (yRow > height - 1) yRow = height - 1;
+            y[i] = yPlanar + yRow * fStrides[0];
 
-            // construct u row and v row
+            // u row and v row; height and width are both halved because of
+            // downsampling
             if ((i & 1) == 0) {
-                // height and width are both halved because of downsampling
-                int offset = (i >> 1) * (width >> 1);
-                cb[i/2] = uRows + offset;
-                cr[i/2] = vRows + offset;
+                int chromaRow = (cinfo->next_scanline >> 1) + (i >> 1);
+                if (chromaRow > chromaRows - 1) chromaRow = chromaRows - 1;
+                cb[i/2] = uPlane + chromaRow * chromaWidth;
+                cr[i/2] = vPlane + chromaRow * chromaWidth;
             }
           }
         jpeg_write_raw_data(cinfo, planes, 16);
     }
-    delete [] uRows;
-    delete [] vRows;
-
-}
+    delete [] uPlane;
+    delete [] vPlane;
 
-void Yuv420SpToJpegEncoder::deinterleave(uint8_t* vuPlanar, uint8_t* uRows,
-        uint8_t* vRows, int rowIndex, int width, int height) {
-    int numRows = (height - rowIndex) / 2;
-    if (numRows > 8) numRows = 8;
-    for (int row = 0; row < numRows; ++row) {
-        int offset = ((rowIndex >> 1) + row) * fStrides[1];
-        uint8_t* vu = vuPlanar + offset;
-        for (int i = 0; i < (width >> 1); ++i) {
-            int index = row * (width >> 1) + i;
-            uRows[index] = vu[1];
-            vRows[index] = vu[0];
-            vu += 2;
-        }
-    }
 }
 
 void Yuv420SpToJpegEncoder::configSamplingFactors(jpeg_compress_struct* cinfo) {
@@ -174,52 +250,41 @@ void Yuv422IToJpegEncoder::compress(jpeg_compress_struct* cinfo,
 
     int width = cinfo->image_width;
     int height = cinfo->image_height;
-    uint8_t* yRows = new uint8_t [16 * width];
-    uint8_t* uRows = new uint8_t [16 * (width >> 1)];
-    uint8_t* vRows = new uint8_t [16 * (width >> 1)];
-
     uint8_t* yuvOffset = yuv + offsets[0];
 
+    // Deinterleave the whole frame up front, fanned out over a worker pool.
+    // The planar scratch is the same size as the YUY2 input; the write loop
+    // below then only marshals row pointers.
+    const int chromaWidth = width >> 1;
+    uint8_t* yPlane = new uint8_t[height * width];
+    uint8_t* uPlane = new uint8_t[height * chromaWidth];
+    uint8_t* vPlane = new uint8_t[height * chromaWidth];
+    convertRowsInParallel(height, [&](int row) {
+        deinterleaveYuy2Row(yuvOffset + row * fStrides[0], yPlane + row * width,
+                uPlane + row * chromaWidth, vPlane + row * chromaWidth, chromaWidth);
+    });
+
     // process 16 lines of Y and 16 lines of U/V each time.
     while (cinfo->next_scanline < cinfo->image_height) {
-        deinterleave(yuvOffset, yRows, uRows, vRows, cinfo->next_scanline, width, height);
-
-        // Jpeg library ignores the rows whose indices are greater than height.
+        // Jpeg library ignores the rows whose indices are greater than height,
+        // but keep the pointers in bounds by clamping to the last row.
         for (int i = 0; i < 16; i++) {
+            int row = cinfo->next_scanline + i;
+            if (row > height - 1) row = height - 1;
+
             // y row
-            y[i] = yRows + i * width;
+            y[i] = yPlane + row * width;
 
-            // construct u row and v row
-            // width is halved because of downsampling
-            int offset = i * (width >> 1);
-            cb[i] = uRows + offset;
-            cr[i] = vRows + offset;
+            // u row and v row; width is halved because of downsampling
+            cb[i] = uPlane + row * chromaWidth;
+            cr[i] = vPlane + row * chromaWidth;
         }
 
         jpeg_write_raw_data(cinfo, planes, 16);
     }
-    delete [] yRows;
-    delete [] uRows;
-    delete [] vRows;
-}
-
-
-void Yuv422IToJpegEncoder::deinterleave(uint8_t* yuv, uint8_t* yRows, uint8_t* uRows,
-        uint8_t* vRows, int rowIndex, int width, int height) {
-    int numRows = height - rowIndex;
-    if (numRows > 16) numRows = 16;
-    for (int row = 0; row < numRows; ++row) {
-        uint8_t* yuvSeg = yuv + (rowIndex + row) * fStrides[0];
-        for (int i = 0; i < (width >> 1); ++i) {
-            int indexY = row * width + (i << 1);
-            int indexU = row * (width >> 1) + i;
-            yRows[indexY] = yuvSeg[0];
-            yRows[indexY + 1] = yuvSeg[2];
-            uRows[indexU] = yuvSeg[1];
-            vRows[indexU] = yuvSeg[3];
-            yuvSeg += 4;
-        }
-    }
+    delete [] yPlane;
+    delete [] uPlane;
+    delete [] vPlane;
 }
 
 void Yuv422IToJpegEncoder::configSamplingFactors(jpeg_compress_struct* cinfo) {
@@ -52,10 +52,6 @@ public:
 
 private:
     void configSamplingFactors(jpeg_compress_struct* cinfo);
-    void deinterleaveYuv(uint8_t* yuv, int width, int height,
-            uint8_t*& yPlanar, uint8_t*& uPlanar, uint8_t*& vPlanar);
-    void deinterleave(uint8_t* vuPlanar, uint8_t* uRows, uint8_t* vRows,
-            int rowIndex, int width, int height);
     void compress(jpeg_compress_struct* cinfo, uint8_t* yuv, int* offsets);
 };
 
@@ -67,8 +63,6 @@ public:
 private:
     void configSamplingFactors(jpeg_compress_struct* cinfo);
     void compress(jpeg_compress_struct* cinfo, uint8_t* yuv, int* offsets);
-    void deinterleave(uint8_t* yuv, uint8_t* yRows, uint8_t* uRows,
-            uint8_t* vRows, int rowIndex, int width, int height);
 };
 
 #endif  // _ANDROID_GRAPHICS_YUV_TO_JPEG_ENCODER_H_
@@ -40,6 +40,19 @@ static jlong NativeLoad(JNIEnv* env, jclass /*clazz*/, jstring java_path, jboole
 
   ATRACE_NAME(base::StringPrintf("LoadApkAssets(%s)", path.c_str()).c_str());
 
+  if (system && !overlay && !force_shared_lib) {
+    // System ApkAssets never change for the lifetime of the process. Load them through the
+    // process-wide cache so they are parsed at most once, no matter how many AssetManagers
+    // reference them. Cached instances are owned by the cache; see NativeDestroy.
+    const ApkAssets* cached_assets = ApkAssets::LoadCached(path.c_str());
+    if (cached_assets == nullptr) {
+      std::string error_msg = base::StringPrintf("Failed to load asset path %s", path.c_str());
+      jniThrowException(env, "java/io/IOException", error_msg.c_str());
+      return 0;
+    }
+    return reinterpret_cast<jlong>(cached_assets);
+  }
+
   std::unique_ptr<const ApkAssets> apk_assets;
   if (overlay) {
     apk_assets = ApkAssets::LoadOverlay(path.c_str(), system);
@@ -91,7 +104,12 @@ static jlong NativeLoadFromFd(JNIEnv* env, jclass /*clazz*/, jobject file_descri
 }
 
 static void NativeDestroy(JNIEnv* /*env*/, jclass /*clazz*/, jlong ptr) {
-  delete reinterpret_cast<ApkAssets*>(ptr);
+  ApkAssets* apk_assets = reinterpret_cast<ApkAssets*>(ptr);
+  if (ApkAssets::IsCached(apk_assets)) {
+    // Owned by the process-wide cache and shared with other AssetManagers.
+    return;
+  }
+  delete apk_assets;
 }
 
 static jstring NativeGetAssetPath(JNIEnv* env, jclass /*clazz*/, jlong ptr) {
@@ -251,10 +251,25 @@ static jstring nativeGetString(JNIEnv* env, jclass clazz, jlong windowPtr,
         if (sizeIncludingNull <= 1) {
             return gEmptyString;
         }
+        // For pure ASCII data, UTF-8 and the Modified UTF-8 that NewStringUTF
+        // expects are identical, so the string can be created straight from the
+        // window bytes without an intermediate conversion buffer. Database
+        // strings are overwhelmingly ASCII.
+        const size_t length = sizeIncludingNull - 1;
+        bool ascii = true;
+        for (size_t i = 0; i < length; i++) {
+            if (static_cast<uint8_t>(value[i]) >= 0x80) {
+                ascii = false;
+                break;
+            }
+        }
+        if (ascii) {
+            return env->NewStringUTF(value);
+        }
         // Convert to UTF-16 here instead of calling NewStringUTF.  NewStringUTF
         // doesn't like UTF-8 strings with high codepoints.  It actually expects
         // Modified UTF-8 with encoded surrogate pairs.
-        String16 utf16(value, sizeIncludingNull - 1);
+        String16 utf16(value, length);
         return env->NewString(reinterpret_cast<const jchar*>(utf16.string()), utf16.size());
     } else if (type == CursorWindow::FIELD_TYPE_INTEGER) {
         int64_t value = window->getFieldSlotValueLong(fieldSlot);
@@ -364,6 +379,103 @@ static void nativeCopyStringToBuffer(JNIEnv* env, jclass clazz, jlong windowPtr,
     }
 }
 
+// Copies a rectangular slice of the window into caller-provided arrays with a single JNI call,
+// instead of one nativeGet* transition per cell. For each cell, its type is written to `types`
+// and its payload to `data` at index row * columnCount + column (relative to the slice):
+// INTEGER cells store the value, FLOAT cells store the raw bit pattern of the double, NULL
+// cells store 0, and STRING/BLOB cells have their bytes appended to `heap` with
+// (heapOffset << 32) | byteLength stored in `data`. String bytes are UTF-8 without the
+// terminating null. Only whole rows are copied; if the heap fills up, copying stops at the
+// last complete row. Returns the number of rows copied, so the caller can resume from
+// startRow + result with a larger heap.
+static jint nativeCopyRows(JNIEnv* env, jclass clazz, jlong windowPtr,
+        jint startRow, jint rowCount, jint startColumn, jint columnCount,
+        jbyteArray typesObj, jlongArray dataObj, jbyteArray heapObj) {
+    CursorWindow* window = reinterpret_cast<CursorWindow*>(windowPtr);
+    LOG_WINDOW("Copying %dx%d cells starting at %d,%d from %p", rowCount, columnCount,
+            startRow, startColumn, window);
+
+    if (rowCount < 0 || columnCount < 0 ||
+            jlong(rowCount) * columnCount > env->GetArrayLength(typesObj) ||
+            jlong(rowCount) * columnCount > env->GetArrayLength(dataObj)) {
+        jniThrowException(env, "java/lang/IllegalArgumentException",
+                "Output arrays are too small for the requested slice.");
+        return 0;
+    }
+    const size_t heapSize = env->GetArrayLength(heapObj);
+
+    jbyte* types = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(typesObj, NULL));
+    jlong* data = static_cast<jlong*>(env->GetPrimitiveArrayCritical(dataObj, NULL));
+    jbyte* heap = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(heapObj, NULL));
+
+    // No JNI calls are allowed while the critical arrays are held; errors are
+    // recorded and thrown after the arrays have been released.
+    jint badRow = -1;
+    jint badColumn = -1;
+    size_t heapOffset = 0;
+    jint rowsCopied = 0;
+    for (jint r = 0; r < rowCount; r++) {
+        const size_t rowHeapStart = heapOffset;
+        bool rowFits = true;
+        for (jint c = 0; c < columnCount; c++) {
+            CursorWindow::FieldSlot* fieldSlot =
+                    window->getFieldSlot(startRow + r, startColumn + c);
+            if (!fieldSlot) {
+                badRow = startRow + r;
+                badColumn = startColumn + c;
+                break;
+            }
+
+            const jint i = r * columnCount + c;
+            const int32_t type = window->getFieldSlotType(fieldSlot);
+            types[i] = type;
+            if (type == CursorWindow::FIELD_TYPE_INTEGER) {
+                data[i] = window->getFieldSlotValueLong(fieldSlot);
+            } else if (type == CursorWindow::FIELD_TYPE_FLOAT) {
+                const double value = window->getFieldSlotValueDouble(fieldSlot);
+                jlong bits;
+                memcpy(&bits, &value, sizeof(bits));
+                data[i] = bits;
+            } else if (type == CursorWindow::FIELD_TYPE_NULL) {
+                data[i] = 0;
+            } else {
+                size_t size;
+                const void* value;
+                if (type == CursorWindow::FIELD_TYPE_STRING) {
+                    value = window->getFieldSlotValueString(fieldSlot, &size);
+                    size = size > 0 ? size - 1 : 0; // drop the null terminator
+                } else {
+                    value = window->getFieldSlotValueBlob(fieldSlot, &size);
+                }
+                if (size > heapSize - heapOffset) {
+                    rowFits = false;
+                    break;
+                }
+                if (size) {
+                    memcpy(heap + heapOffset, value, size);
+                }
+                data[i] = (jlong(heapOffset) << 32) | jlong(size);
+                heapOffset += size;
+            }
+        }
+        if (badRow >= 0 || !rowFits) {
+            heapOffset = rowHeapStart; // discard the partial row
+            break;
+        }
+        rowsCopied++;
+    }
+
+    env->ReleasePrimitiveArrayCritical(heapObj, heap, 0);
+    env->ReleasePrimitiveArrayCritical(dataObj, data, 0);
+    env->ReleasePrimitiveArrayCritical(typesObj, types, 0);
+
+    if (badRow >= 0) {
+        throwExceptionWithRowCol(env, badRow, badColumn);
+        return 0;
+    }
+    return rowsCopied;
+}
+
 static jlong nativeGetLong(JNIEnv* env, jclass clazz, jlong windowPtr,
         jint row, jint column) {
     CursorWindow* window = reinterpret_cast<CursorWindow*>(windowPtr);
@@ -448,21 +560,26 @@ static jboolean nativePutString(JNIEnv* env, jclass clazz, jlong windowPtr,
         jstring valueObj, jint row, jint column) {
     CursorWindow* window = reinterpret_cast<CursorWindow*>(windowPtr);
 
-    size_t sizeIncludingNull = env->GetStringUTFLength(valueObj) + 1;
-    const char* valueStr = env->GetStringUTFChars(valueObj, NULL);
+    // Convert the string directly into the window allocation instead of going
+    // through GetStringUTFChars, which would heap-allocate a Modified UTF-8 copy
+    // only for it to be copied into the window again. putUtf16String performs no
+    // JNI calls and does not block, so the critical section is safe.
+    jsize len = env->GetStringLength(valueObj);
+    const jchar* valueStr = env->GetStringCritical(valueObj, NULL);
     if (!valueStr) {
         LOG_WINDOW("value can't be transferred to UTFChars");
         return false;
     }
-    status_t status = window->putString(row, column, valueStr, sizeIncludingNull);
-    env->ReleaseStringUTFChars(valueObj, valueStr);
+    status_t status = window->putUtf16String(row, column,
+            reinterpret_cast<const char16_t*>(valueStr), len);
+    env->ReleaseStringCritical(valueObj, valueStr);
 
     if (status) {
         LOG_WINDOW("Failed to put string. error=%d", status);
         return false;
     }
 
-    LOG_WINDOW("%d,%d is TEXT with %u bytes", row, column, sizeIncludingNull);
+    LOG_WINDOW("%d,%d is TEXT with %u chars", row, column, len);
     return true;
 }
 
@@ -528,6 +645,8 @@ static const JNINativeMethod sMethods[] =
             (void*)nativeGetString },
     { "nativeCopyStringToBuffer", "(JIILandroid/database/CharArrayBuffer;)V",
             (void*)nativeCopyStringToBuffer },
+    { "nativeCopyRows", "(JIIII[B[J[B)I",
+            (void*)nativeCopyRows },
     { "nativePutBlob", "(J[BII)Z",
             (void*)nativePutBlob },
     { "nativePutString", "(JLjava/lang/String;II)Z",
@@ -30,6 +30,9 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <atomic>
+#include <thread>
+
 #include <androidfw/CursorWindow.h>
 
 #include <sqlite3.h>
@@ -86,8 +89,13 @@ struct SQLiteConnection {
 
     volatile bool canceled;
 
+    // Prefetch state for nativeExecuteForCursorWindow, if a prefetch has been
+    // started on this connection.  See CursorPrefetcher below.
+    struct CursorPrefetcher* prefetcher;
+
     SQLiteConnection(sqlite3* db, int openFlags, const String8& path, const String8& label) :
-        db(db), openFlags(openFlags), path(path), label(label), canceled(false) { }
+        db(db), openFlags(openFlags), path(path), label(label), canceled(false),
+        prefetcher(NULL) { }
 };
 
 // Called each time a statement begins execution, when tracing is enabled.
@@ -110,6 +118,145 @@ static int sqliteProgressHandlerCallback(void* data) {
     return connection->canceled;
 }
 
+enum CopyRowResult {
+    CPR_OK,
+    CPR_FULL,
+    CPR_ERROR,
+};
+
+static CopyRowResult copyRowInner(CursorWindow* window, sqlite3_stmt* statement,
+        int numColumns, int startPos, int addedRows);
+
+/* Background readahead for nativeExecuteForCursorWindow.
+ *
+ * After a window fill stops because the window is full, the statement is handed
+ * to a worker thread that keeps stepping it into a second, native-owned window
+ * ahead of the read cursor, so a sequential consumer finds its next page already
+ * filled instead of re-running the query from the start.
+ *
+ * SQLite connections must not be used from two threads at once, so the worker
+ * has exclusive use of the connection while it runs: every native entry point
+ * that touches the database or one of its statements calls discardPrefetch()
+ * first, which joins the worker (its work is bounded by one window) and resets
+ * the statement it left mid-stream.
+ */
+struct CursorPrefetcher {
+    sqlite3_stmt* statement;    // The statement being stepped; not reset while running.
+    CursorWindow* window;       // Native-owned window holding the prefetched rows.
+    int numColumns;
+    int startPos;               // Position of the first prefetched row.
+    int numRows;                // Rows copied into the window.
+    int totalRows;              // Exact result count; only valid when sawDone.
+    bool sawDone;               // The statement ran to SQLITE_DONE.
+    bool pendingRow;            // The statement sits on a row that did not fit.
+    int error;                  // SQLite error code, or SQLITE_OK.
+
+    std::atomic<bool> stopRequested;
+    std::thread thread;
+    bool running;
+
+    CursorPrefetcher() : statement(NULL), window(NULL), numColumns(0), startPos(0),
+            numRows(0), totalRows(0), sawDone(false), pendingRow(false), error(SQLITE_OK),
+            stopRequested(false), running(false) { }
+
+    ~CursorPrefetcher() {
+        delete window;
+    }
+};
+
+static void runCursorPrefetch(CursorPrefetcher* prefetcher) {
+    sqlite3_stmt* statement = prefetcher->statement;
+    CursorWindow* window = prefetcher->window;
+
+    if (prefetcher->pendingRow) {
+        // The statement is still sitting on the row that overflowed the previous
+        // window; copy it before stepping any further.
+        if (copyRowInner(window, statement, prefetcher->numColumns, prefetcher->startPos,
+                prefetcher->numRows) != CPR_OK) {
+            // A single row that does not fit into an empty window is too big.
+            prefetcher->error = SQLITE_TOOBIG;
+            return;
+        }
+        prefetcher->pendingRow = false;
+        prefetcher->numRows += 1;
+    }
+
+    int retryCount = 0;
+    for (;;) {
+        if (prefetcher->stopRequested.load(std::memory_order_relaxed)) {
+            return;
+        }
+        int err = sqlite3_step(statement);
+        if (err == SQLITE_ROW) {
+            retryCount = 0;
+            CopyRowResult cpr = copyRowInner(window, statement, prefetcher->numColumns,
+                    prefetcher->startPos, prefetcher->numRows);
+            if (cpr == CPR_OK) {
+                prefetcher->numRows += 1;
+            } else if (cpr == CPR_FULL) {
+                prefetcher->pendingRow = true;
+                return;
+            } else {
+                prefetcher->error = SQLITE_ERROR;
+                return;
+            }
+        } else if (err == SQLITE_DONE) {
+            prefetcher->sawDone = true;
+            prefetcher->totalRows = prefetcher->startPos + prefetcher->numRows;
+            return;
+        } else if (err == SQLITE_LOCKED || err == SQLITE_BUSY) {
+            // Do not spin forever against a locked table; let the consumer
+            // rediscover the contention and retry with its usual policy.
+            if (retryCount > 50) {
+                prefetcher->error = err;
+                return;
+            }
+            usleep(1000);
+            retryCount++;
+        } else {
+            prefetcher->error = err;
+            return;
+        }
+    }
+}
+
+// Joins the prefetch worker, if one is running.  Cheap when no prefetch was started.
+static void finishPrefetch(SQLiteConnection* connection) {
+    CursorPrefetcher* prefetcher = connection->prefetcher;
+    if (prefetcher && prefetcher->running) {
+        prefetcher->stopRequested.store(true, std::memory_order_relaxed);
+        prefetcher->thread.join();
+        prefetcher->running = false;
+    }
+}
+
+// Joins the prefetch worker and abandons any prefetched rows, resetting the
+// statement the worker left mid-stream.  Every native entry point that uses
+// the database or one of its statements must call this before doing so.
+static void discardPrefetch(SQLiteConnection* connection) {
+    CursorPrefetcher* prefetcher = connection->prefetcher;
+    if (prefetcher) {
+        finishPrefetch(connection);
+        if (prefetcher->statement) {
+            sqlite3_reset(prefetcher->statement);
+        }
+        connection->prefetcher = NULL;
+        delete prefetcher;
+    }
+}
+
+static void startPrefetch(SQLiteConnection* connection, sqlite3_stmt* statement,
+        CursorWindow* prefetchWindow, int numColumns, int startPos, bool pendingRow) {
+    CursorPrefetcher* prefetcher = new CursorPrefetcher();
+    prefetcher->statement = statement;
+    prefetcher->window = prefetchWindow;
+    prefetcher->numColumns = numColumns;
+    prefetcher->startPos = startPos;
+    prefetcher->pendingRow = pendingRow;
+    connection->prefetcher = prefetcher;
+    prefetcher->running = true;
+    prefetcher->thread = std::thread(runCursorPrefetch, prefetcher);
+}
 
 static jlong nativeOpen(JNIEnv* env, jclass clazz, jstring pathStr, jint openFlags,
         jstring labelStr, jboolean enableTrace, jboolean enableProfile, jint lookasideSz,
@@ -190,6 +337,7 @@ static void nativeClose(JNIEnv* env, jclass clazz, jlong connectionPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
 
     if (connection) {
+        discardPrefetch(connection);
         ALOGV("Closing connection %p", connection->db);
         int err = sqlite3_close(connection->db);
         if (err != SQLITE_OK) {
@@ -259,6 +407,7 @@ static void sqliteCustomFunctionDestructor(void* data) {
 static void nativeRegisterCustomFunction(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jobject functionObj) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
 
     jstring nameStr = jstring(env->GetObjectField(
             functionObj, gSQLiteCustomFunctionClassInfo.name));
@@ -283,6 +432,7 @@ static void nativeRegisterCustomFunction(JNIEnv* env, jclass clazz, jlong connec
 static void nativeRegisterLocalizedCollators(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jstring localeStr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
 
     const char* locale = env->GetStringUTFChars(localeStr, NULL);
     int err = register_localized_collators(connection->db, locale, UTF16_STORAGE);
@@ -296,6 +446,7 @@ static void nativeRegisterLocalizedCollators(JNIEnv* env, jclass clazz, jlong co
 static jlong nativePrepareStatement(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jstring sqlString) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
 
     jsize sqlLength = env->GetStringLength(sqlString);
     const jchar* sql = env->GetStringCritical(sqlString, NULL);
@@ -327,6 +478,7 @@ static jlong nativePrepareStatement(JNIEnv* env, jclass clazz, jlong connectionP
 static void nativeFinalizeStatement(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     // We ignore the result of sqlite3_finalize because it is really telling us about
@@ -338,6 +490,8 @@ static void nativeFinalizeStatement(JNIEnv* env, jclass clazz, jlong connectionP
 
 static jint nativeGetParameterCount(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr) {
+    SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     return sqlite3_bind_parameter_count(statement);
@@ -345,6 +499,8 @@ static jint nativeGetParameterCount(JNIEnv* env, jclass clazz, jlong connectionP
 
 static jboolean nativeIsReadOnly(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr) {
+    SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     return sqlite3_stmt_readonly(statement) != 0;
@@ -352,6 +508,8 @@ static jboolean nativeIsReadOnly(JNIEnv* env, jclass clazz, jlong connectionPtr,
 
 static jint nativeGetColumnCount(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr) {
+    SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     return sqlite3_column_count(statement);
@@ -359,6 +517,8 @@ static jint nativeGetColumnCount(JNIEnv* env, jclass clazz, jlong connectionPtr,
 
 static jstring nativeGetColumnName(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr, jint index) {
+    SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     const jchar* name = static_cast<const jchar*>(sqlite3_column_name16(statement, index));
@@ -375,6 +535,7 @@ static jstring nativeGetColumnName(JNIEnv* env, jclass clazz, jlong connectionPt
 static void nativeBindNull(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr, jint index) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = sqlite3_bind_null(statement, index);
@@ -386,6 +547,7 @@ static void nativeBindNull(JNIEnv* env, jclass clazz, jlong connectionPtr,
 static void nativeBindLong(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr, jint index, jlong value) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = sqlite3_bind_int64(statement, index, value);
@@ -397,6 +559,7 @@ static void nativeBindLong(JNIEnv* env, jclass clazz, jlong connectionPtr,
 static void nativeBindDouble(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr, jint index, jdouble value) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = sqlite3_bind_double(statement, index, value);
@@ -408,6 +571,7 @@ static void nativeBindDouble(JNIEnv* env, jclass clazz, jlong connectionPtr,
 static void nativeBindString(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr, jint index, jstring valueString) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     jsize valueLength = env->GetStringLength(valueString);
@@ -423,6 +587,7 @@ static void nativeBindString(JNIEnv* env, jclass clazz, jlong connectionPtr,
 static void nativeBindBlob(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr, jint index, jbyteArray valueArray) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     jsize valueLength = env->GetArrayLength(valueArray);
@@ -437,6 +602,7 @@ static void nativeBindBlob(JNIEnv* env, jclass clazz, jlong connectionPtr,
 static void nativeResetStatementAndClearBindings(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = sqlite3_reset(statement);
@@ -462,6 +628,7 @@ static int executeNonQuery(JNIEnv* env, SQLiteConnection* connection, sqlite3_st
 static void nativeExecute(JNIEnv* env, jclass clazz, jlong connectionPtr,
         jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     executeNonQuery(env, connection, statement);
@@ -470,6 +637,7 @@ static void nativeExecute(JNIEnv* env, jclass clazz, jlong connectionPtr,
 static jint nativeExecuteForChangedRowCount(JNIEnv* env, jclass clazz,
         jlong connectionPtr, jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = executeNonQuery(env, connection, statement);
@@ -479,6 +647,7 @@ static jint nativeExecuteForChangedRowCount(JNIEnv* env, jclass clazz,
 static jlong nativeExecuteForLastInsertedRowId(JNIEnv* env, jclass clazz,
         jlong connectionPtr, jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = executeNonQuery(env, connection, statement);
@@ -486,6 +655,161 @@ static jlong nativeExecuteForLastInsertedRowId(JNIEnv* env, jclass clazz,
             ? sqlite3_last_insert_rowid(connection->db) : -1;
 }
 
+/* Type codes for nativeExecuteBatch bind arguments.
+ * Must be kept in sync with the constants defined in SQLiteConnection.java.
+ */
+enum {
+    BATCH_BIND_NULL     = 0,
+    BATCH_BIND_LONG     = 1,
+    BATCH_BIND_DOUBLE   = 2,
+    BATCH_BIND_STRING   = 3,
+    BATCH_BIND_BLOB     = 4,
+};
+
+static bool bindBatchArgument(JNIEnv* env, SQLiteConnection* connection,
+        sqlite3_stmt* statement, int index, jbyte type, jlong numericValue,
+        jobject objectValue) {
+    int err;
+    switch (type) {
+        case BATCH_BIND_NULL:
+            err = sqlite3_bind_null(statement, index);
+            break;
+        case BATCH_BIND_LONG:
+            err = sqlite3_bind_int64(statement, index, numericValue);
+            break;
+        case BATCH_BIND_DOUBLE: {
+            double value;
+            memcpy(&value, &numericValue, sizeof(value));
+            err = sqlite3_bind_double(statement, index, value);
+            break;
+        }
+        case BATCH_BIND_STRING: {
+            jstring valueString = static_cast<jstring>(objectValue);
+            jsize valueLength = env->GetStringLength(valueString);
+            const jchar* value = env->GetStringCritical(valueString, NULL);
+            err = sqlite3_bind_text16(statement, index, value, valueLength * sizeof(jchar),
+                    SQLITE_TRANSIENT);
+            env->ReleaseStringCritical(valueString, value);
+            break;
+        }
+        case BATCH_BIND_BLOB: {
+            jbyteArray valueArray = static_cast<jbyteArray>(objectValue);
+            jsize valueLength = env->GetArrayLength(valueArray);
+            jbyte* value = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(valueArray, NULL));
+            err = sqlite3_bind_blob(statement, index, value, valueLength, SQLITE_TRANSIENT);
+            env->ReleasePrimitiveArrayCritical(valueArray, value, JNI_ABORT);
+            break;
+        }
+        default:
+            throw_sqlite3_exception(env, "Unknown batch bind argument type");
+            return false;
+    }
+    if (err != SQLITE_OK) {
+        throw_sqlite3_exception(env, connection->db, NULL);
+        return false;
+    }
+    return true;
+}
+
+/* Binds and executes a non-query statement once per row, entirely in native code,
+ * so that bulk writes pay a single JNI transition instead of one per bind and step.
+ *
+ * The arguments are columnar: for a statement with P parameters, row r binds
+ * parameter i from slot r * P + i of the argument arrays.  bindTypes holds a
+ * BATCH_BIND_* code per slot; longs and raw double bits are read from
+ * numericValues, strings and blobs from objectValues.  If outRowIds is not null,
+ * slot r receives the last inserted rowid for row r, or -1 if the row changed
+ * nothing.
+ *
+ * The batch is applied atomically through a savepoint, which composes with any
+ * transaction the session already has open, unlike BEGIN/COMMIT.  On error the
+ * savepoint is rolled back, an exception is thrown and -1 is returned; otherwise
+ * returns the total number of changed rows.
+ */
+static jint nativeExecuteBatch(JNIEnv* env, jclass clazz, jlong connectionPtr,
+        jlong statementPtr, jint numRows, jbyteArray bindTypes,
+        jlongArray numericValues, jobjectArray objectValues, jlongArray outRowIds) {
+    SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
+    sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
+
+    const jint parameterCount = sqlite3_bind_parameter_count(statement);
+    if (numRows < 0
+            || env->GetArrayLength(bindTypes) < numRows * parameterCount
+            || env->GetArrayLength(numericValues) < numRows * parameterCount
+            || (objectValues && env->GetArrayLength(objectValues) < numRows * parameterCount)
+            || (outRowIds && env->GetArrayLength(outRowIds) < numRows)) {
+        jniThrowException(env, "java/lang/IllegalArgumentException",
+                "batch argument arrays are smaller than numRows * parameter count");
+        return -1;
+    }
+
+    if (sqlite3_exec(connection->db, "SAVEPOINT batch", NULL, NULL, NULL) != SQLITE_OK) {
+        throw_sqlite3_exception(env, connection->db, NULL);
+        return -1;
+    }
+
+    jbyte* types = env->GetByteArrayElements(bindTypes, NULL);
+    jlong* numerics = env->GetLongArrayElements(numericValues, NULL);
+    jlong* rowIds = outRowIds ? env->GetLongArrayElements(outRowIds, NULL) : NULL;
+
+    jint changedRows = 0;
+    bool ok = true;
+    for (jint row = 0; row < numRows && ok; row++) {
+        const jint base = row * parameterCount;
+        for (jint i = 0; i < parameterCount && ok; i++) {
+            const jbyte type = types[base + i];
+            jobject objectValue = NULL;
+            if (type == BATCH_BIND_STRING || type == BATCH_BIND_BLOB) {
+                objectValue = env->GetObjectArrayElement(objectValues, base + i);
+            }
+            ok = bindBatchArgument(env, connection, statement, i + 1, type,
+                    numerics[base + i], objectValue);
+            if (objectValue) {
+                env->DeleteLocalRef(objectValue);
+            }
+        }
+        if (ok) {
+            int err = sqlite3_step(statement);
+            if (err == SQLITE_DONE) {
+                int changes = sqlite3_changes(connection->db);
+                changedRows += changes;
+                if (rowIds) {
+                    rowIds[row] = changes > 0 ? sqlite3_last_insert_rowid(connection->db) : -1;
+                }
+            } else if (err == SQLITE_ROW) {
+                throw_sqlite3_exception(env,
+                        "Queries can be performed using SQLiteDatabase query or rawQuery methods only.");
+                ok = false;
+            } else {
+                throw_sqlite3_exception(env, connection->db);
+                ok = false;
+            }
+            sqlite3_reset(statement);
+        }
+    }
+    sqlite3_clear_bindings(statement);
+
+    env->ReleaseByteArrayElements(bindTypes, types, JNI_ABORT);
+    env->ReleaseLongArrayElements(numericValues, numerics, JNI_ABORT);
+    if (rowIds) {
+        env->ReleaseLongArrayElements(outRowIds, rowIds, ok ? 0 : JNI_ABORT);
+    }
+
+    if (ok) {
+        if (sqlite3_exec(connection->db, "RELEASE batch", NULL, NULL, NULL) != SQLITE_OK) {
+            throw_sqlite3_exception(env, connection->db, NULL);
+            ok = false;
+        }
+    }
+    if (!ok) {
+        sqlite3_exec(connection->db, "ROLLBACK TO batch", NULL, NULL, NULL);
+        sqlite3_exec(connection->db, "RELEASE batch", NULL, NULL, NULL);
+        return -1;
+    }
+    return changedRows;
+}
+
 static int executeOneRowQuery(JNIEnv* env, SQLiteConnection* connection, sqlite3_stmt* statement) {
     int err = sqlite3_step(statement);
     if (err != SQLITE_ROW) {
@@ -497,6 +821,7 @@ static int executeOneRowQuery(JNIEnv* env, SQLiteConnection* connection, sqlite3
 static jlong nativeExecuteForLong(JNIEnv* env, jclass clazz,
         jlong connectionPtr, jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = executeOneRowQuery(env, connection, statement);
@@ -509,6 +834,7 @@ static jlong nativeExecuteForLong(JNIEnv* env, jclass clazz,
 static jstring nativeExecuteForString(JNIEnv* env, jclass clazz,
         jlong connectionPtr, jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = executeOneRowQuery(env, connection, statement);
@@ -559,6 +885,7 @@ static int createAshmemRegionWithData(JNIEnv* env, const void* data, size_t leng
 static jint nativeExecuteForBlobFileDescriptor(JNIEnv* env, jclass clazz,
         jlong connectionPtr, jlong statementPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     sqlite3_stmt* statement = reinterpret_cast<sqlite3_stmt*>(statementPtr);
 
     int err = executeOneRowQuery(env, connection, statement);
@@ -574,13 +901,7 @@ static jint nativeExecuteForBlobFileDescriptor(JNIEnv* env, jclass clazz,
     return -1;
 }
 
-enum CopyRowResult {
-    CPR_OK,
-    CPR_FULL,
-    CPR_ERROR,
-};
-
-static CopyRowResult copyRow(JNIEnv* env, CursorWindow* window,
+static CopyRowResult copyRowInner(CursorWindow* window,
         sqlite3_stmt* statement, int numColumns, int startPos, int addedRows) {
     // Allocate a new field directory for the row.
     status_t status = window->allocRow();
@@ -660,7 +981,6 @@ static CopyRowResult copyRow(JNIEnv* env, CursorWindow* window,
         } else {
             // Unknown data
             ALOGE("Unknown column type when filling database window");
-            throw_sqlite3_exception(env, "Unknown column type when filling window");
             result = CPR_ERROR;
             break;
         }
@@ -673,6 +993,78 @@ static CopyRowResult copyRow(JNIEnv* env, CursorWindow* window,
     return result;
 }
 
+static CopyRowResult copyRow(JNIEnv* env, CursorWindow* window,
+        sqlite3_stmt* statement, int numColumns, int startPos, int addedRows) {
+    CopyRowResult result = copyRowInner(window, statement, numColumns, startPos, addedRows);
+    if (result == CPR_ERROR) {
+        throw_sqlite3_exception(env, "Unknown column type when filling window");
+    }
+    return result;
+}
+
+// Copies rows from a prefetch window into the window handed in from Java.
+// Both windows were created with the same size, so this only fails if the
+// source is malformed.
+static status_t copyPrefetchedRows(CursorWindow* window, CursorWindow* source,
+        int numRows, int numColumns) {
+    for (int row = 0; row < numRows; row++) {
+        status_t status = window->allocRow();
+        if (status) {
+            return status;
+        }
+        for (int i = 0; i < numColumns; i++) {
+            CursorWindow::FieldSlot* fieldSlot = source->getFieldSlot(row, i);
+            if (!fieldSlot) {
+                return BAD_VALUE;
+            }
+            switch (source->getFieldSlotType(fieldSlot)) {
+                case CursorWindow::FIELD_TYPE_NULL:
+                    status = window->putNull(row, i);
+                    break;
+                case CursorWindow::FIELD_TYPE_INTEGER:
+                    status = window->putLong(row, i, source->getFieldSlotValueLong(fieldSlot));
+                    break;
+                case CursorWindow::FIELD_TYPE_FLOAT:
+                    status = window->putDouble(row, i,
+                            source->getFieldSlotValueDouble(fieldSlot));
+                    break;
+                case CursorWindow::FIELD_TYPE_STRING: {
+                    size_t sizeIncludingNull;
+                    const char* text = source->getFieldSlotValueString(fieldSlot,
+                            &sizeIncludingNull);
+                    status = window->putString(row, i, text, sizeIncludingNull);
+                    break;
+                }
+                case CursorWindow::FIELD_TYPE_BLOB: {
+                    size_t size;
+                    const void* blob = source->getFieldSlotValueBlob(fieldSlot, &size);
+                    status = window->putBlob(row, i, blob, size);
+                    break;
+                }
+                default:
+                    return BAD_VALUE;
+            }
+            if (status) {
+                return status;
+            }
+        }
+    }
+    return OK;
+}
+
+// Clears the prefetch window and sends the worker back out ahead of the rows
+// that were just handed to the reader.
+static void restartPrefetch(SQLiteConnection* connection) {
+    CursorPrefetcher* prefetcher = connection->prefetcher;
+    prefetcher->window->clear();
+    prefetcher->window->setNumColumns(prefetcher->numColumns);
+    prefetcher->startPos += prefetcher->numRows;
+    prefetcher->numRows = 0;
+    prefetcher->stopRequested.store(false, std::memory_order_relaxed);
+    prefetcher->running = true;
+    prefetcher->thread = std::thread(runCursorPrefetch, prefetcher);
+}
+
 static jlong nativeExecuteForCursorWindow(JNIEnv* env, jclass clazz,
         jlong connectionPtr, jlong statementPtr, jlong windowPtr,
         jint startPos, jint requiredPos, jboolean countAllRows) {
@@ -698,6 +1090,35 @@ static jlong nativeExecuteForCursorWindow(JNIEnv* env, jclass clazz,
         return 0;
     }
 
+    // Serve the request from the prefetch window when the worker already has
+    // the wanted rows, then immediately send it back out for the next page.
+    finishPrefetch(connection);
+    CursorPrefetcher* prefetcher = connection->prefetcher;
+    if (prefetcher != NULL && prefetcher->statement == statement
+            && prefetcher->error == SQLITE_OK && !countAllRows
+            && requiredPos >= prefetcher->startPos
+            && requiredPos < prefetcher->startPos + prefetcher->numRows
+            && copyPrefetchedRows(window, prefetcher->window, prefetcher->numRows,
+                    prefetcher->numColumns) == OK) {
+        const int prefetchStartPos = prefetcher->startPos;
+        int knownRows;
+        if (prefetcher->sawDone) {
+            knownRows = prefetcher->totalRows;
+            discardPrefetch(connection);
+        } else {
+            knownRows = prefetcher->startPos + prefetcher->numRows
+                    + (prefetcher->pendingRow ? 1 : 0);
+            restartPrefetch(connection);
+        }
+        return jlong(prefetchStartPos) << 32 | jlong(knownRows);
+    }
+
+    // Any leftover prefetch state cannot serve this request; reset the
+    // statement so the fill below starts from the first row.
+    discardPrefetch(connection);
+    window->clear();
+    window->setNumColumns(numColumns);
+
     int retryCount = 0;
     int totalRows = 0;
     int addedRows = 0;
@@ -759,7 +1180,23 @@ static jlong nativeExecuteForCursorWindow(JNIEnv* env, jclass clazz,
     LOG_WINDOW("Resetting statement %p after fetching %d rows and adding %d rows"
             "to the window in %d bytes",
             statement, totalRows, addedRows, window->size() - window->freeSpace());
-    sqlite3_reset(statement);
+
+    if (!countAllRows && windowFull && !gotException) {
+        // More rows remain and the statement is sitting on the first one that
+        // did not fit; keep stepping it into a second window on a worker
+        // thread so a sequential reader finds its next page already filled.
+        CursorWindow* prefetchWindow = NULL;
+        if (CursorWindow::create(String8("prefetch"), window->size(), &prefetchWindow) == OK
+                && prefetchWindow->setNumColumns(numColumns) == OK) {
+            startPrefetch(connection, statement, prefetchWindow, numColumns,
+                    startPos + addedRows, true /*pendingRow*/);
+        } else {
+            delete prefetchWindow;
+            sqlite3_reset(statement);
+        }
+    } else {
+        sqlite3_reset(statement);
+    }
 
     // Report the total number of rows on request.
     if (startPos > totalRows) {
@@ -779,6 +1216,7 @@ static jlong nativeExecuteForCursorWindow(JNIEnv* env, jclass clazz,
 
 static jint nativeGetDbLookaside(JNIEnv* env, jobject clazz, jlong connectionPtr) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
 
     int cur = -1;
     int unused;
@@ -794,6 +1232,7 @@ static void nativeCancel(JNIEnv* env, jobject clazz, jlong connectionPtr) {
 static void nativeResetCancel(JNIEnv* env, jobject clazz, jlong connectionPtr,
         jboolean cancelable) {
     SQLiteConnection* connection = reinterpret_cast<SQLiteConnection*>(connectionPtr);
+    discardPrefetch(connection);
     connection->canceled = false;
 
     if (cancelable) {
@@ -852,6 +1291,8 @@ static const JNINativeMethod sMethods[] =
             (void*)nativeExecuteForChangedRowCount },
     { "nativeExecuteForLastInsertedRowId", "(JJ)J",
             (void*)nativeExecuteForLastInsertedRowId },
+    { "nativeExecuteBatch", "(JJI[B[J[Ljava/lang/Object;[J)I",
+            (void*)nativeExecuteBatch },
     { "nativeExecuteForCursorWindow", "(JJJIIZ)J",
             (void*)nativeExecuteForCursorWindow },
     { "nativeGetDbLookaside", "(J)I",
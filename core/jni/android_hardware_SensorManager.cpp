@@ -34,6 +34,7 @@
 #include <utils/Vector.h>
 
 #include <map>
+#include <memory>
 
 namespace {
 
@@ -42,6 +43,7 @@ using namespace android;
 struct {
     jclass clazz;
     jmethodID dispatchSensorEvent;
+    jmethodID dispatchSensorEventBatch;  // optional, may be NULL
     jmethodID dispatchFlushCompleteEvent;
     jmethodID dispatchAdditionalInfoEvent;
 } gBaseEventQueueClassInfo;
@@ -290,12 +292,33 @@ static jint nativeSetOperationParameter(JNIEnv *_env, jclass _this, jlong sensor
 
 //----------------------------------------------------------------------------
 
+/*
+ * One packed record in the batched delivery ring. The layout must be kept in
+ * sync with SystemSensorManager.BaseEventQueue.dispatchSensorEventBatch,
+ * which reads records out of the direct ByteBuffer in native byte order.
+ */
+struct BatchedSensorEvent {
+    int64_t timestamp;
+    int32_t sensor;
+    int32_t status;
+    float data[16];
+};
+
 class Receiver : public LooperCallback {
+    static constexpr size_t kMaxBatchedEvents = 64;
+
     sp<SensorEventQueue> mSensorQueue;
     sp<MessageQueue> mMessageQueue;
     jobject mReceiverWeakGlobal;
     jfloatArray mFloatScratch;
     jintArray   mIntScratch;
+    // Persistent ring for batched delivery; plain sensor events accumulate
+    // here and reach Java in a single upcall per drained read instead of
+    // one JNI transition per sample. NULL when the managed side does not
+    // implement dispatchSensorEventBatch.
+    std::unique_ptr<BatchedSensorEvent[]> mBatchBuffer;
+    jobject mBatchBufferGlobal;
+    size_t mBatchedCount;
 public:
     Receiver(const sp<SensorEventQueue>& sensorQueue,
             const sp<MessageQueue>& messageQueue,
@@ -307,12 +330,23 @@ public:
 
         mIntScratch = (jintArray) env->NewGlobalRef(env->NewIntArray(16));
         mFloatScratch = (jfloatArray) env->NewGlobalRef(env->NewFloatArray(16));
+
+        mBatchBufferGlobal = NULL;
+        mBatchedCount = 0;
+        if (gBaseEventQueueClassInfo.dispatchSensorEventBatch != NULL) {
+            mBatchBuffer.reset(new BatchedSensorEvent[kMaxBatchedEvents]);
+            mBatchBufferGlobal = env->NewGlobalRef(env->NewDirectByteBuffer(
+                    mBatchBuffer.get(), kMaxBatchedEvents * sizeof(BatchedSensorEvent)));
+        }
     }
     ~Receiver() {
         JNIEnv* env = AndroidRuntime::getJNIEnv();
         env->DeleteGlobalRef(mReceiverWeakGlobal);
         env->DeleteGlobalRef(mFloatScratch);
         env->DeleteGlobalRef(mIntScratch);
+        if (mBatchBufferGlobal != NULL) {
+            env->DeleteGlobalRef(mBatchBufferGlobal);
+        }
     }
     sp<SensorEventQueue> getSensorEventQueue() const {
         return mSensorQueue;
@@ -329,6 +363,20 @@ private:
                 ALOOPER_EVENT_INPUT, this, mSensorQueue.get());
     }
 
+    // Delivers all accumulated ring records to Java in one upcall.
+    void flushBatchedEvents(JNIEnv* env, jobject receiverObj) {
+        if (mBatchedCount == 0) {
+            return;
+        }
+        const jint count = jint(mBatchedCount);
+        mBatchedCount = 0;
+        if (receiverObj != NULL) {
+            env->CallVoidMethod(receiverObj,
+                                gBaseEventQueueClassInfo.dispatchSensorEventBatch,
+                                mBatchBufferGlobal, count);
+        }
+    }
+
     virtual int handleEvent(int fd, int events, void* data) {
         JNIEnv* env = AndroidRuntime::getJNIEnv();
         sp<SensorEventQueue> q = reinterpret_cast<SensorEventQueue *>(data);
@@ -338,36 +386,23 @@ private:
         ASensorEvent buffer[16];
         while ((n = q->read(buffer, 16)) > 0) {
             for (int i=0 ; i<n ; i++) {
-                if (buffer[i].type == SENSOR_TYPE_STEP_COUNTER) {
-                    // step-counter returns a uint64, but the java API only deals with floats
-                    float value = float(buffer[i].u64.step_counter);
-                    env->SetFloatArrayRegion(mFloatScratch, 0, 1, &value);
-                } else if (buffer[i].type == SENSOR_TYPE_DYNAMIC_SENSOR_META) {
-                    float value[2];
-                    value[0] = buffer[i].dynamic_sensor_meta.connected ? 1.f: 0.f;
-                    value[1] = float(buffer[i].dynamic_sensor_meta.handle);
-                    env->SetFloatArrayRegion(mFloatScratch, 0, 2, value);
-                } else if (buffer[i].type == SENSOR_TYPE_ADDITIONAL_INFO) {
-                    env->SetIntArrayRegion(mIntScratch, 0, 14,
-                                           buffer[i].additional_info.data_int32);
-                    env->SetFloatArrayRegion(mFloatScratch, 0, 14,
-                                             buffer[i].additional_info.data_float);
-                } else {
-                    env->SetFloatArrayRegion(mFloatScratch, 0, 16, buffer[i].data);
-                }
-
                 if (buffer[i].type == SENSOR_TYPE_META_DATA) {
                     // This is a flush complete sensor event. Call dispatchFlushCompleteEvent
-                    // method.
-                    if (receiverObj.get()) {
+                    // method. Deliver pending batched events first to preserve ordering.
+                    flushBatchedEvents(env, receiverObj.get());
+                    if (receiverObj.get() && !env->ExceptionCheck()) {
                         env->CallVoidMethod(receiverObj.get(),
                                             gBaseEventQueueClassInfo.dispatchFlushCompleteEvent,
                                             buffer[i].meta_data.sensor);
                     }
                 } else if (buffer[i].type == SENSOR_TYPE_ADDITIONAL_INFO) {
-                    // This is a flush complete sensor event. Call dispatchAdditionalInfoEvent
-                    // method.
-                    if (receiverObj.get()) {
+                    // Call dispatchAdditionalInfoEvent method.
+                    flushBatchedEvents(env, receiverObj.get());
+                    if (receiverObj.get() && !env->ExceptionCheck()) {
+                        env->SetIntArrayRegion(mIntScratch, 0, 14,
+                                               buffer[i].additional_info.data_int32);
+                        env->SetFloatArrayRegion(mFloatScratch, 0, 14,
+                                                 buffer[i].additional_info.data_float);
                         int type = buffer[i].additional_info.type;
                         int serial = buffer[i].additional_info.serial;
                         env->CallVoidMethod(receiverObj.get(),
@@ -378,7 +413,7 @@ private:
                                             mIntScratch,
                                             buffer[i].timestamp);
                     }
-                }else {
+                } else {
                     int8_t status;
                     switch (buffer[i].type) {
                     case SENSOR_TYPE_ORIENTATION:
@@ -396,7 +431,40 @@ private:
                         status = SENSOR_STATUS_ACCURACY_HIGH;
                         break;
                     }
-                    if (receiverObj.get()) {
+                    if (mBatchBuffer != NULL) {
+                        BatchedSensorEvent& record = mBatchBuffer[mBatchedCount++];
+                        record.timestamp = buffer[i].timestamp;
+                        record.sensor = buffer[i].sensor;
+                        record.status = status;
+                        if (buffer[i].type == SENSOR_TYPE_STEP_COUNTER) {
+                            // step-counter returns a uint64, but the java API only deals
+                            // with floats
+                            memset(record.data, 0, sizeof(record.data));
+                            record.data[0] = float(buffer[i].u64.step_counter);
+                        } else if (buffer[i].type == SENSOR_TYPE_DYNAMIC_SENSOR_META) {
+                            memset(record.data, 0, sizeof(record.data));
+                            record.data[0] = buffer[i].dynamic_sensor_meta.connected ? 1.f : 0.f;
+                            record.data[1] = float(buffer[i].dynamic_sensor_meta.handle);
+                        } else {
+                            memcpy(record.data, buffer[i].data, sizeof(record.data));
+                        }
+                        if (mBatchedCount == kMaxBatchedEvents) {
+                            flushBatchedEvents(env, receiverObj.get());
+                        }
+                    } else if (receiverObj.get()) {
+                        if (buffer[i].type == SENSOR_TYPE_STEP_COUNTER) {
+                            // step-counter returns a uint64, but the java API only deals
+                            // with floats
+                            float value = float(buffer[i].u64.step_counter);
+                            env->SetFloatArrayRegion(mFloatScratch, 0, 1, &value);
+                        } else if (buffer[i].type == SENSOR_TYPE_DYNAMIC_SENSOR_META) {
+                            float value[2];
+                            value[0] = buffer[i].dynamic_sensor_meta.connected ? 1.f: 0.f;
+                            value[1] = float(buffer[i].dynamic_sensor_meta.handle);
+                            env->SetFloatArrayRegion(mFloatScratch, 0, 2, value);
+                        } else {
+                            env->SetFloatArrayRegion(mFloatScratch, 0, 16, buffer[i].data);
+                        }
                         env->CallVoidMethod(receiverObj.get(),
                                             gBaseEventQueueClassInfo.dispatchSensorEvent,
                                             buffer[i].sensor,
@@ -411,6 +479,13 @@ private:
                     return 1;
                 }
             }
+            // Deliver whatever this read accumulated before acking it.
+            flushBatchedEvents(env, receiverObj.get());
+            if (env->ExceptionCheck()) {
+                mSensorQueue->sendAck(buffer, n);
+                ALOGE("Exception dispatching input event.");
+                return 1;
+            }
             mSensorQueue->sendAck(buffer, n);
         }
         if (n<0 && n != -EAGAIN) {
@@ -558,6 +633,15 @@ int register_android_hardware_SensorManager(JNIEnv *env)
     gBaseEventQueueClassInfo.dispatchSensorEvent = GetMethodIDOrDie(env,
             gBaseEventQueueClassInfo.clazz, "dispatchSensorEvent", "(I[FIJ)V");
 
+    // Optional batched delivery; receivers fall back to per-event dispatch
+    // when the managed side does not implement it.
+    gBaseEventQueueClassInfo.dispatchSensorEventBatch = env->GetMethodID(
+            gBaseEventQueueClassInfo.clazz, "dispatchSensorEventBatch",
+            "(Ljava/nio/ByteBuffer;I)V");
+    if (gBaseEventQueueClassInfo.dispatchSensorEventBatch == NULL) {
+        env->ExceptionClear();
+    }
+
     gBaseEventQueueClassInfo.dispatchFlushCompleteEvent = GetMethodIDOrDie(env,
             gBaseEventQueueClassInfo.clazz, "dispatchFlushCompleteEvent", "(I)V");
 
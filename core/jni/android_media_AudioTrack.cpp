@@ -40,6 +40,7 @@
 #include "android_media_VolumeShaper.h"
 
 #include <cinttypes>
+#include <memory>
 
 // ----------------------------------------------------------------------------
 
@@ -722,6 +723,123 @@ static jint android_media_AudioTrack_write_native_bytes(JNIEnv *env,  jobject th
     return written;
 }
 
+// ----------------------------------------------------------------------------
+static jint android_media_AudioTrack_writev(JNIEnv *env, jobject thiz,
+        jobjectArray javaBuffers, jintArray javaOffsets, jintArray javaSizes,
+        jboolean isWriteBlocking) {
+    sp<AudioTrack> lpTrack = getAudioTrack(env, thiz);
+    if (lpTrack == NULL) {
+        jniThrowException(env, "java/lang/IllegalStateException",
+                "Unable to retrieve AudioTrack pointer for writev()");
+        return (jint)AUDIO_JAVA_INVALID_OPERATION;
+    }
+    if (lpTrack->sharedBuffer() != 0) {
+        // Static tracks are filled once through write(); gathering regions
+        // into the cblk only makes sense in streaming mode.
+        return (jint)AUDIO_JAVA_INVALID_OPERATION;
+    }
+    if (javaBuffers == NULL || javaOffsets == NULL || javaSizes == NULL) {
+        return (jint)AUDIO_JAVA_BAD_VALUE;
+    }
+
+    const jsize regionCount = env->GetArrayLength(javaBuffers);
+    if (env->GetArrayLength(javaOffsets) < regionCount
+            || env->GetArrayLength(javaSizes) < regionCount) {
+        return (jint)AUDIO_JAVA_BAD_VALUE;
+    }
+
+    jint* offsets = env->GetIntArrayElements(javaOffsets, NULL);
+    jint* sizes = env->GetIntArrayElements(javaSizes, NULL);
+    ssize_t totalWritten = 0;
+    jint status = AUDIO_JAVA_SUCCESS;
+
+    for (jsize i = 0; i < regionCount; i++) {
+        jobject javaBuffer = env->GetObjectArrayElement(javaBuffers, i);
+        if (javaBuffer == NULL) {
+            status = AUDIO_JAVA_BAD_VALUE;
+            break;
+        }
+        const jbyte* data = (const jbyte*)env->GetDirectBufferAddress(javaBuffer);
+        const jlong capacity = env->GetDirectBufferCapacity(javaBuffer);
+        env->DeleteLocalRef(javaBuffer);
+        if (data == NULL || offsets[i] < 0 || sizes[i] < 0
+                || (jlong)offsets[i] + sizes[i] > capacity) {
+            status = AUDIO_JAVA_BAD_VALUE;
+            break;
+        }
+
+        ssize_t written = lpTrack->write(data + offsets[i], sizes[i],
+                isWriteBlocking == JNI_TRUE /* blocking */);
+        if (written < 0) {
+            status = interpretWriteSizeError(written);
+            break;
+        }
+        totalWritten += written;
+        if (written < (ssize_t)sizes[i]) {
+            break;  // Track buffer full on a non-blocking write.
+        }
+    }
+
+    env->ReleaseIntArrayElements(javaOffsets, offsets, JNI_ABORT);
+    env->ReleaseIntArrayElements(javaSizes, sizes, JNI_ABORT);
+
+    if (totalWritten == 0 && status != AUDIO_JAVA_SUCCESS) {
+        return status;
+    }
+    return (jint)totalWritten;
+}
+
+// ----------------------------------------------------------------------------
+static jobject android_media_AudioTrack_obtain_buffer(JNIEnv *env, jobject thiz,
+        jint sizeInFrames, jboolean blocking, jlongArray javaNativeBufferOut) {
+    sp<AudioTrack> lpTrack = getAudioTrack(env, thiz);
+    if (lpTrack == NULL) {
+        jniThrowException(env, "java/lang/IllegalStateException",
+                "Unable to retrieve AudioTrack pointer for obtainBuffer()");
+        return NULL;
+    }
+    if (sizeInFrames <= 0 || javaNativeBufferOut == NULL
+            || env->GetArrayLength(javaNativeBufferOut) < 1) {
+        return NULL;
+    }
+
+    std::unique_ptr<AudioTrack::Buffer> audioBuffer(new AudioTrack::Buffer());
+    audioBuffer->frameCount = sizeInFrames;
+    status_t status = lpTrack->obtainBuffer(audioBuffer.get(),
+            blocking == JNI_TRUE ? -1 /* wait forever */ : 0 /* don't wait */);
+    if (status != NO_ERROR || audioBuffer->raw == NULL) {
+        return NULL;
+    }
+
+    jobject javaBuffer = env->NewDirectByteBuffer(audioBuffer->raw, audioBuffer->size);
+    if (javaBuffer == NULL) {
+        lpTrack->releaseBuffer(audioBuffer.get());
+        return NULL;
+    }
+
+    jlong nativeBuffer = reinterpret_cast<jlong>(audioBuffer.release());
+    env->SetLongArrayRegion(javaNativeBufferOut, 0, 1, &nativeBuffer);
+    return javaBuffer;
+}
+
+static jint android_media_AudioTrack_release_buffer(JNIEnv *env, jobject thiz,
+        jlong nativeBuffer, jint sizeInBytesWritten) {
+    sp<AudioTrack> lpTrack = getAudioTrack(env, thiz);
+    std::unique_ptr<AudioTrack::Buffer> audioBuffer(
+            reinterpret_cast<AudioTrack::Buffer*>(nativeBuffer));
+    if (lpTrack == NULL || audioBuffer == NULL) {
+        return (jint)AUDIO_JAVA_INVALID_OPERATION;
+    }
+    if (sizeInBytesWritten < 0 || (size_t)sizeInBytesWritten > audioBuffer->size) {
+        return (jint)AUDIO_JAVA_BAD_VALUE;
+    }
+
+    // Only the filled prefix of the obtained region is committed.
+    audioBuffer->size = sizeInBytesWritten;
+    lpTrack->releaseBuffer(audioBuffer.get());
+    return (jint)AUDIO_JAVA_SUCCESS;
+}
+
 // ----------------------------------------------------------------------------
 static jint android_media_AudioTrack_get_buffer_size_frames(JNIEnv *env,  jobject thiz) {
     sp<AudioTrack> lpTrack = getAudioTrack(env, thiz);
@@ -1290,6 +1408,11 @@ static const JNINativeMethod gMethods[] = {
     {"native_write_native_bytes",
                              "(Ljava/lang/Object;IIIZ)I",
                                          (void *)android_media_AudioTrack_write_native_bytes},
+    {"native_writev",        "([Ljava/nio/ByteBuffer;[I[IZ)I",
+                                         (void *)android_media_AudioTrack_writev},
+    {"native_obtain_buffer", "(IZ[J)Ljava/nio/ByteBuffer;",
+                                         (void *)android_media_AudioTrack_obtain_buffer},
+    {"native_release_buffer","(JI)I",    (void *)android_media_AudioTrack_release_buffer},
     {"native_write_short",   "([SIIIZ)I",(void *)android_media_AudioTrack_writeArray<jshortArray>},
     {"native_write_float",   "([FIIIZ)I",(void *)android_media_AudioTrack_writeArray<jfloatArray>},
     {"native_setVolume",     "(FF)V",    (void *)android_media_AudioTrack_set_volume},
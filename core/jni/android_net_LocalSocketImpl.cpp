@@ -453,6 +453,164 @@ static void socket_writeba (JNIEnv *env, jobject object,
     env->ReleaseByteArrayElements(buffer, byteBuffer, JNI_ABORT);
 }
 
+// Largest number of frames moved by one readmm/writemm call. Bounds the
+// stack-allocated mmsghdr/iovec tables.
+static const int MAX_BATCH_MESSAGES = 64;
+
+/*
+ * Validates a batch description: count frames inside buffer, each described
+ * by offsets[i] and lengths[i]. Copies the descriptions into the supplied
+ * native arrays. Returns false with an exception pending on bad input.
+ */
+static bool socket_get_batch(JNIEnv *env, jbyteArray buffer,
+        jintArray offsetsArray, jintArray lengthsArray, jint count,
+        jint *offsets, jint *lengths)
+{
+    if (buffer == NULL || offsetsArray == NULL || lengthsArray == NULL) {
+        jniThrowNullPointerException(env, NULL);
+        return false;
+    }
+
+    if (count <= 0 || count > MAX_BATCH_MESSAGES
+            || env->GetArrayLength(offsetsArray) < count
+            || env->GetArrayLength(lengthsArray) < count) {
+        jniThrowException(env, "java/lang/ArrayIndexOutOfBoundsException", NULL);
+        return false;
+    }
+
+    env->GetIntArrayRegion(offsetsArray, 0, count, offsets);
+    env->GetIntArrayRegion(lengthsArray, 0, count, lengths);
+
+    jsize bufferLen = env->GetArrayLength(buffer);
+    for (int i = 0; i < count; i++) {
+        if (offsets[i] < 0 || lengths[i] < 0 || (offsets[i] + lengths[i]) > bufferLen) {
+            jniThrowException(env, "java/lang/ArrayIndexOutOfBoundsException", NULL);
+            return false;
+        }
+    }
+    return true;
+}
+
+static jint socket_readmm (JNIEnv *env, jobject object,
+        jbyteArray buffer, jintArray offsetsArray, jintArray lengthsArray,
+        jint count, jobject fileDescriptor)
+{
+    if (fileDescriptor == NULL) {
+        jniThrowNullPointerException(env, NULL);
+        return (jint)-1;
+    }
+
+    jint offsets[MAX_BATCH_MESSAGES];
+    jint lengths[MAX_BATCH_MESSAGES];
+    if (!socket_get_batch(env, buffer, offsetsArray, lengthsArray, count,
+            offsets, lengths)) {
+        return (jint)-1;
+    }
+
+    int fd = jniGetFDFromFileDescriptor(env, fileDescriptor);
+    if (env->ExceptionCheck()) {
+        return (jint)-1;
+    }
+
+    jbyte* byteBuffer = env->GetByteArrayElements(buffer, NULL);
+    if (byteBuffer == NULL) {
+        return (jint)-1;
+    }
+
+    struct mmsghdr msgs[MAX_BATCH_MESSAGES];
+    struct iovec ivs[MAX_BATCH_MESSAGES];
+    memset(msgs, 0, count * sizeof(msgs[0]));
+    for (int i = 0; i < count; i++) {
+        ivs[i].iov_base = byteBuffer + offsets[i];
+        ivs[i].iov_len = lengths[i];
+        msgs[i].msg_hdr.msg_iov = &ivs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // Block for the first frame, then drain whatever else is pending in the
+    // same syscall.
+    int ret = TEMP_FAILURE_RETRY(recvmmsg(fd, msgs, count,
+            MSG_NOSIGNAL | MSG_WAITFORONE, NULL));
+
+    env->ReleaseByteArrayElements(buffer, byteBuffer, 0);
+
+    if (ret < 0) {
+        if (errno == EPIPE) {
+            // Treat this as an end of stream
+            return (jint)0;
+        }
+        jniThrowIOException(env, errno);
+        return (jint)-1;
+    }
+
+    for (int i = 0; i < ret; i++) {
+        if ((msgs[i].msg_hdr.msg_flags & (MSG_CTRUNC | MSG_OOB | MSG_ERRQUEUE)) != 0) {
+            jniThrowException(env, "java/io/IOException",
+                    "Unexpected error or truncation during recvmmsg()");
+            return (jint)-1;
+        }
+        lengths[i] = (jint)msgs[i].msg_len;
+    }
+    env->SetIntArrayRegion(lengthsArray, 0, ret, lengths);
+
+    return (jint)ret;
+}
+
+static jint socket_writemm (JNIEnv *env, jobject object,
+        jbyteArray buffer, jintArray offsetsArray, jintArray lengthsArray,
+        jint count, jobject fileDescriptor)
+{
+    if (fileDescriptor == NULL) {
+        jniThrowNullPointerException(env, NULL);
+        return (jint)-1;
+    }
+
+    jint offsets[MAX_BATCH_MESSAGES];
+    jint lengths[MAX_BATCH_MESSAGES];
+    if (!socket_get_batch(env, buffer, offsetsArray, lengthsArray, count,
+            offsets, lengths)) {
+        return (jint)-1;
+    }
+
+    int fd = jniGetFDFromFileDescriptor(env, fileDescriptor);
+    if (env->ExceptionCheck()) {
+        return (jint)-1;
+    }
+
+    jbyte* byteBuffer = env->GetByteArrayElements(buffer, NULL);
+    if (byteBuffer == NULL) {
+        return (jint)-1;
+    }
+
+    struct mmsghdr msgs[MAX_BATCH_MESSAGES];
+    struct iovec ivs[MAX_BATCH_MESSAGES];
+    memset(msgs, 0, count * sizeof(msgs[0]));
+    for (int i = 0; i < count; i++) {
+        ivs[i].iov_base = byteBuffer + offsets[i];
+        ivs[i].iov_len = lengths[i];
+        msgs[i].msg_hdr.msg_iov = &ivs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int ret = TEMP_FAILURE_RETRY(sendmmsg(fd, msgs, count, MSG_NOSIGNAL));
+
+    env->ReleaseByteArrayElements(buffer, byteBuffer, JNI_ABORT);
+
+    if (ret < 0) {
+        jniThrowIOException(env, errno);
+        return (jint)-1;
+    }
+
+    // Report how much of each frame actually went out; on a stream socket a
+    // frame can be sent short and the caller must resume from there.
+    for (int i = 0; i < ret; i++) {
+        lengths[i] = (jint)msgs[i].msg_len;
+    }
+    env->SetIntArrayRegion(lengthsArray, 0, ret, lengths);
+
+    return (jint)ret;
+}
+
 static jobject socket_get_peer_credentials(JNIEnv *env,
         jobject object, jobject fileDescriptor)
 {
@@ -502,6 +660,8 @@ static const JNINativeMethod gMethods[] = {
     {"readba_native", "([BIILjava/io/FileDescriptor;)I", (void*) socket_readba},
     {"writeba_native", "([BIILjava/io/FileDescriptor;)V", (void*) socket_writeba},
     {"write_native", "(ILjava/io/FileDescriptor;)V", (void*) socket_write},
+    {"readmm_native", "([B[I[IILjava/io/FileDescriptor;)I", (void*) socket_readmm},
+    {"writemm_native", "([B[I[IILjava/io/FileDescriptor;)I", (void*) socket_writemm},
     {"getPeerCredentials_native",
             "(Ljava/io/FileDescriptor;)Landroid/net/Credentials;",
             (void*) socket_get_peer_credentials}
@@ -31,7 +31,9 @@
 
 #include <atomic>
 #include <iomanip>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <android-base/stringprintf.h>
 #include <android-base/unique_fd.h>
@@ -243,7 +245,142 @@ static int read_memtrack_memory(int pid, struct graphics_memory_pss* graphics_me
     return err;
 }
 
-static void read_mapinfo(FILE *fp, stats_t* stats, bool* foundSwapPss)
+/*
+ * Buckets a mapping name into the heap enums above. The name must already
+ * have any " (deleted)" suffix trimmed. The previous mapping's end address
+ * and heap are needed to recognize the bss section of a shared library.
+ */
+static void classify_mapping(const char* name, int nameLen,
+        uint64_t start, uint64_t prevEnd, int prevHeap,
+        int* whichHeap, int* subHeap, bool* is_swappable)
+{
+    if ((strstr(name, "[heap]") == name)) {
+        *whichHeap = HEAP_NATIVE;
+    } else if (strncmp(name, "[anon:libc_malloc]", 18) == 0) {
+        *whichHeap = HEAP_NATIVE;
+    } else if (strncmp(name, "[stack", 6) == 0) {
+        *whichHeap = HEAP_STACK;
+    } else if (nameLen > 3 && strcmp(name+nameLen-3, ".so") == 0) {
+        *whichHeap = HEAP_SO;
+        *is_swappable = true;
+    } else if (nameLen > 4 && strcmp(name+nameLen-4, ".jar") == 0) {
+        *whichHeap = HEAP_JAR;
+        *is_swappable = true;
+    } else if (nameLen > 4 && strcmp(name+nameLen-4, ".apk") == 0) {
+        *whichHeap = HEAP_APK;
+        *is_swappable = true;
+    } else if (nameLen > 4 && strcmp(name+nameLen-4, ".ttf") == 0) {
+        *whichHeap = HEAP_TTF;
+        *is_swappable = true;
+    } else if ((nameLen > 4 && strstr(name, ".dex") != NULL) ||
+               (nameLen > 5 && strcmp(name+nameLen-5, ".odex") == 0)) {
+        *whichHeap = HEAP_DEX;
+        *subHeap = HEAP_DEX_APP_DEX;
+        *is_swappable = true;
+    } else if (nameLen > 5 && strcmp(name+nameLen-5, ".vdex") == 0) {
+        *whichHeap = HEAP_DEX;
+        // Handle system@framework@boot* and system/framework/boot*
+        if (strstr(name, "@boot") != NULL || strstr(name, "/boot") != NULL) {
+            *subHeap = HEAP_DEX_BOOT_VDEX;
+        } else {
+            *subHeap = HEAP_DEX_APP_VDEX;
+        }
+        *is_swappable = true;
+    } else if (nameLen > 4 && strcmp(name+nameLen-4, ".oat") == 0) {
+        *whichHeap = HEAP_OAT;
+        *is_swappable = true;
+    } else if (nameLen > 4 && strcmp(name+nameLen-4, ".art") == 0) {
+        *whichHeap = HEAP_ART;
+        // Handle system@framework@boot* and system/framework/boot*
+        if (strstr(name, "@boot") != NULL || strstr(name, "/boot") != NULL) {
+            *subHeap = HEAP_ART_BOOT;
+        } else {
+            *subHeap = HEAP_ART_APP;
+        }
+        *is_swappable = true;
+    } else if (strncmp(name, "/dev/", 5) == 0) {
+        if (strncmp(name, "/dev/kgsl-3d0", 13) == 0) {
+            *whichHeap = HEAP_GL_DEV;
+        } else if (strncmp(name, "/dev/ashmem", 11) == 0) {
+            if (strncmp(name, "/dev/ashmem/dalvik-", 19) == 0) {
+                *whichHeap = HEAP_DALVIK_OTHER;
+                if (strstr(name, "/dev/ashmem/dalvik-LinearAlloc") == name) {
+                    *subHeap = HEAP_DALVIK_OTHER_LINEARALLOC;
+                } else if ((strstr(name, "/dev/ashmem/dalvik-alloc space") == name) ||
+                           (strstr(name, "/dev/ashmem/dalvik-main space") == name)) {
+                    // This is the regular Dalvik heap.
+                    *whichHeap = HEAP_DALVIK;
+                    *subHeap = HEAP_DALVIK_NORMAL;
+                } else if (strstr(name, "/dev/ashmem/dalvik-large object space") == name ||
+                           strstr(name, "/dev/ashmem/dalvik-free list large object space")
+                               == name) {
+                    *whichHeap = HEAP_DALVIK;
+                    *subHeap = HEAP_DALVIK_LARGE;
+                } else if (strstr(name, "/dev/ashmem/dalvik-non moving space") == name) {
+                    *whichHeap = HEAP_DALVIK;
+                    *subHeap = HEAP_DALVIK_NON_MOVING;
+                } else if (strstr(name, "/dev/ashmem/dalvik-zygote space") == name) {
+                    *whichHeap = HEAP_DALVIK;
+                    *subHeap = HEAP_DALVIK_ZYGOTE;
+                } else if (strstr(name, "/dev/ashmem/dalvik-indirect ref") == name) {
+                    *subHeap = HEAP_DALVIK_OTHER_INDIRECT_REFERENCE_TABLE;
+                } else if (strstr(name, "/dev/ashmem/dalvik-jit-code-cache") == name ||
+                           strstr(name, "/dev/ashmem/dalvik-data-code-cache") == name) {
+                    *subHeap = HEAP_DALVIK_OTHER_CODE_CACHE;
+                } else if (strstr(name, "/dev/ashmem/dalvik-CompilerMetadata") == name) {
+                    *subHeap = HEAP_DALVIK_OTHER_COMPILER_METADATA;
+                } else {
+                    *subHeap = HEAP_DALVIK_OTHER_ACCOUNTING;  // Default to accounting.
+                }
+            } else if (strncmp(name, "/dev/ashmem/CursorWindow", 24) == 0) {
+                *whichHeap = HEAP_CURSOR;
+            } else if (strncmp(name, "/dev/ashmem/libc malloc", 23) == 0) {
+                *whichHeap = HEAP_NATIVE;
+            } else {
+                *whichHeap = HEAP_ASHMEM;
+            }
+        } else {
+            *whichHeap = HEAP_UNKNOWN_DEV;
+        }
+    } else if (strncmp(name, "[anon:", 6) == 0) {
+        *whichHeap = HEAP_UNKNOWN;
+    } else if (nameLen > 0) {
+        *whichHeap = HEAP_UNKNOWN_MAP;
+    } else if (start == prevEnd && prevHeap == HEAP_SO) {
+        // bss section of a shared library.
+        *whichHeap = HEAP_SO;
+    }
+}
+
+/*
+ * Cache of per-VMA classification verdicts for the current process, keyed by
+ * start address. The mapping layout changes far less often than our memory
+ * watchdogs poll it, so a re-poll usually validates the cached entry against
+ * the end address and name hash instead of rerunning the string-compare
+ * chain above. Stat values still have to be re-read every time; the kernel
+ * does not version them.
+ */
+struct VmaClassification {
+    uint64_t end;
+    size_t nameHash;
+    int whichHeap;
+    int subHeap;
+    bool isSwappable;
+};
+
+static std::mutex gVmaCacheLock;
+static std::unordered_map<uint64_t, VmaClassification> gVmaCache;
+
+static size_t hash_mapping_name(const char* name, int nameLen)
+{
+    size_t h = 5381;
+    for (int i = 0; i < nameLen; i++) {
+        h = h * 33 + size_t(name[i]);
+    }
+    return h;
+}
+
+static void read_mapinfo(FILE *fp, stats_t* stats, bool* foundSwapPss, bool isSelf)
 {
     char line[1024];
     int len, nameLen;
@@ -298,101 +435,33 @@ static void read_mapinfo(FILE *fp, stats_t* stats, bool* foundSwapPss)
                 nameLen -= strlen(deleted_str);
                 name[nameLen] = '\0';
             }
-            if ((strstr(name, "[heap]") == name)) {
-                whichHeap = HEAP_NATIVE;
-            } else if (strncmp(name, "[anon:libc_malloc]", 18) == 0) {
-                whichHeap = HEAP_NATIVE;
-            } else if (strncmp(name, "[stack", 6) == 0) {
-                whichHeap = HEAP_STACK;
-            } else if (nameLen > 3 && strcmp(name+nameLen-3, ".so") == 0) {
-                whichHeap = HEAP_SO;
-                is_swappable = true;
-            } else if (nameLen > 4 && strcmp(name+nameLen-4, ".jar") == 0) {
-                whichHeap = HEAP_JAR;
-                is_swappable = true;
-            } else if (nameLen > 4 && strcmp(name+nameLen-4, ".apk") == 0) {
-                whichHeap = HEAP_APK;
-                is_swappable = true;
-            } else if (nameLen > 4 && strcmp(name+nameLen-4, ".ttf") == 0) {
-                whichHeap = HEAP_TTF;
-                is_swappable = true;
-            } else if ((nameLen > 4 && strstr(name, ".dex") != NULL) ||
-                       (nameLen > 5 && strcmp(name+nameLen-5, ".odex") == 0)) {
-                whichHeap = HEAP_DEX;
-                subHeap = HEAP_DEX_APP_DEX;
-                is_swappable = true;
-            } else if (nameLen > 5 && strcmp(name+nameLen-5, ".vdex") == 0) {
-                whichHeap = HEAP_DEX;
-                // Handle system@framework@boot* and system/framework/boot*
-                if (strstr(name, "@boot") != NULL || strstr(name, "/boot") != NULL) {
-                    subHeap = HEAP_DEX_BOOT_VDEX;
-                } else {
-                    subHeap = HEAP_DEX_APP_VDEX;
+            if (isSelf && nameLen > 0) {
+                // Nameless mappings are classified from their neighbors, so
+                // only named ones are safe to remember.
+                size_t nameHash = hash_mapping_name(name, nameLen);
+                std::lock_guard<std::mutex> lock(gVmaCacheLock);
+                if (gVmaCache.size() > 4096) {
+                    // Heavy layout churn; drop stale entries wholesale rather
+                    // than tracking which start addresses disappeared.
+                    gVmaCache.clear();
                 }
-                is_swappable = true;
-            } else if (nameLen > 4 && strcmp(name+nameLen-4, ".oat") == 0) {
-                whichHeap = HEAP_OAT;
-                is_swappable = true;
-            } else if (nameLen > 4 && strcmp(name+nameLen-4, ".art") == 0) {
-                whichHeap = HEAP_ART;
-                // Handle system@framework@boot* and system/framework/boot*
-                if (strstr(name, "@boot") != NULL || strstr(name, "/boot") != NULL) {
-                    subHeap = HEAP_ART_BOOT;
-                } else {
-                    subHeap = HEAP_ART_APP;
-                }
-                is_swappable = true;
-            } else if (strncmp(name, "/dev/", 5) == 0) {
-                if (strncmp(name, "/dev/kgsl-3d0", 13) == 0) {
-                    whichHeap = HEAP_GL_DEV;
-                } else if (strncmp(name, "/dev/ashmem", 11) == 0) {
-                    if (strncmp(name, "/dev/ashmem/dalvik-", 19) == 0) {
-                        whichHeap = HEAP_DALVIK_OTHER;
-                        if (strstr(name, "/dev/ashmem/dalvik-LinearAlloc") == name) {
-                            subHeap = HEAP_DALVIK_OTHER_LINEARALLOC;
-                        } else if ((strstr(name, "/dev/ashmem/dalvik-alloc space") == name) ||
-                                   (strstr(name, "/dev/ashmem/dalvik-main space") == name)) {
-                            // This is the regular Dalvik heap.
-                            whichHeap = HEAP_DALVIK;
-                            subHeap = HEAP_DALVIK_NORMAL;
-                        } else if (strstr(name, "/dev/ashmem/dalvik-large object space") == name ||
-                                   strstr(name, "/dev/ashmem/dalvik-free list large object space")
-                                       == name) {
-                            whichHeap = HEAP_DALVIK;
-                            subHeap = HEAP_DALVIK_LARGE;
-                        } else if (strstr(name, "/dev/ashmem/dalvik-non moving space") == name) {
-                            whichHeap = HEAP_DALVIK;
-                            subHeap = HEAP_DALVIK_NON_MOVING;
-                        } else if (strstr(name, "/dev/ashmem/dalvik-zygote space") == name) {
-                            whichHeap = HEAP_DALVIK;
-                            subHeap = HEAP_DALVIK_ZYGOTE;
-                        } else if (strstr(name, "/dev/ashmem/dalvik-indirect ref") == name) {
-                            subHeap = HEAP_DALVIK_OTHER_INDIRECT_REFERENCE_TABLE;
-                        } else if (strstr(name, "/dev/ashmem/dalvik-jit-code-cache") == name ||
-                                   strstr(name, "/dev/ashmem/dalvik-data-code-cache") == name) {
-                            subHeap = HEAP_DALVIK_OTHER_CODE_CACHE;
-                        } else if (strstr(name, "/dev/ashmem/dalvik-CompilerMetadata") == name) {
-                            subHeap = HEAP_DALVIK_OTHER_COMPILER_METADATA;
-                        } else {
-                            subHeap = HEAP_DALVIK_OTHER_ACCOUNTING;  // Default to accounting.
-                        }
-                    } else if (strncmp(name, "/dev/ashmem/CursorWindow", 24) == 0) {
-                        whichHeap = HEAP_CURSOR;
-                    } else if (strncmp(name, "/dev/ashmem/libc malloc", 23) == 0) {
-                        whichHeap = HEAP_NATIVE;
-                    } else {
-                        whichHeap = HEAP_ASHMEM;
-                    }
+                VmaClassification& cached = gVmaCache[start];
+                if (cached.end == end && cached.nameHash == nameHash) {
+                    whichHeap = cached.whichHeap;
+                    subHeap = cached.subHeap;
+                    is_swappable = cached.isSwappable;
                 } else {
-                    whichHeap = HEAP_UNKNOWN_DEV;
+                    classify_mapping(name, nameLen, start, prevEnd, prevHeap,
+                            &whichHeap, &subHeap, &is_swappable);
+                    cached.end = end;
+                    cached.nameHash = nameHash;
+                    cached.whichHeap = whichHeap;
+                    cached.subHeap = subHeap;
+                    cached.isSwappable = is_swappable;
                 }
-            } else if (strncmp(name, "[anon:", 6) == 0) {
-                whichHeap = HEAP_UNKNOWN;
-            } else if (nameLen > 0) {
-                whichHeap = HEAP_UNKNOWN_MAP;
-            } else if (start == prevEnd && prevHeap == HEAP_SO) {
-                // bss section of a shared library.
-                whichHeap = HEAP_SO;
+            } else {
+                classify_mapping(name, nameLen, start, prevEnd, prevHeap,
+                        &whichHeap, &subHeap, &is_swappable);
             }
         }
 
@@ -484,17 +553,12 @@ static void load_maps(int pid, stats_t* stats, bool* foundSwapPss)
     UniqueFile fp = MakeUniqueFile(smaps_path.c_str(), "re");
     if (fp == nullptr) return;
 
-    read_mapinfo(fp.get(), stats, foundSwapPss);
+    read_mapinfo(fp.get(), stats, foundSwapPss, pid == getpid());
 }
 
-static void android_os_Debug_getDirtyPagesPid(JNIEnv *env, jobject clazz,
-        jint pid, jobject object)
+static void collect_memory_stats(int pid, stats_t* stats, bool* foundSwapPss)
 {
-    bool foundSwapPss;
-    stats_t stats[_NUM_HEAP];
-    memset(&stats, 0, sizeof(stats));
-
-    load_maps(pid, stats, &foundSwapPss);
+    load_maps(pid, stats, foundSwapPss);
 
     struct graphics_memory_pss graphics_mem;
     if (read_memtrack_memory(pid, &graphics_mem) == 0) {
@@ -520,7 +584,11 @@ static void android_os_Debug_getDirtyPagesPid(JNIEnv *env, jobject clazz,
         stats[HEAP_UNKNOWN].swappedOut += stats[i].swappedOut;
         stats[HEAP_UNKNOWN].swappedOutPss += stats[i].swappedOutPss;
     }
+}
 
+static void put_memory_stats(JNIEnv *env, jobject object, const stats_t* stats,
+        bool foundSwapPss)
+{
     for (int i=0; i<_NUM_CORE_HEAP; i++) {
         env->SetIntField(object, stat_fields[i].pss_field, stats[i].pss);
         env->SetIntField(object, stat_fields[i].pssSwappable_field, stats[i].swappablePss);
@@ -558,11 +626,55 @@ static void android_os_Debug_getDirtyPagesPid(JNIEnv *env, jobject clazz,
     env->ReleasePrimitiveArrayCritical(otherIntArray, otherArray, 0);
 }
 
+static void android_os_Debug_getDirtyPagesPid(JNIEnv *env, jobject clazz,
+        jint pid, jobject object)
+{
+    bool foundSwapPss;
+    stats_t stats[_NUM_HEAP];
+    memset(&stats, 0, sizeof(stats));
+
+    collect_memory_stats(pid, stats, &foundSwapPss);
+    put_memory_stats(env, object, stats, foundSwapPss);
+}
+
 static void android_os_Debug_getDirtyPages(JNIEnv *env, jobject clazz, jobject object)
 {
     android_os_Debug_getDirtyPagesPid(env, clazz, getpid(), object);
 }
 
+// Snapshot served by getMemoryInfoCached, so periodic monitors that can
+// tolerate slightly stale numbers skip the smaps walk entirely.
+static std::mutex gStatsCacheLock;
+static stats_t gStatsCache[_NUM_HEAP];
+static bool gStatsCacheSwapPss = false;
+static int64_t gStatsCacheUptimeMs = -1;
+
+static jboolean android_os_Debug_getMemoryInfoCached(JNIEnv *env, jobject clazz,
+        jint maxAgeMs, jobject object)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t nowMs = int64_t(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+
+    bool refreshed = false;
+    bool foundSwapPss;
+    stats_t stats[_NUM_HEAP];
+    {
+        std::lock_guard<std::mutex> lock(gStatsCacheLock);
+        if (gStatsCacheUptimeMs < 0 || maxAgeMs < 0
+                || nowMs - gStatsCacheUptimeMs > maxAgeMs) {
+            memset(gStatsCache, 0, sizeof(gStatsCache));
+            collect_memory_stats(getpid(), gStatsCache, &gStatsCacheSwapPss);
+            gStatsCacheUptimeMs = nowMs;
+            refreshed = true;
+        }
+        memcpy(stats, gStatsCache, sizeof(stats));
+        foundSwapPss = gStatsCacheSwapPss;
+    }
+    put_memory_stats(env, object, stats, foundSwapPss);
+    return refreshed;
+}
+
 UniqueFile OpenSmapsOrRollup(int pid)
 {
     enum pss_rollup_support rollup_support =
@@ -1188,6 +1300,8 @@ static const JNINativeMethod gMethods[] = {
             (void*) android_os_Debug_getDirtyPages },
     { "getMemoryInfo",          "(ILandroid/os/Debug$MemoryInfo;)V",
             (void*) android_os_Debug_getDirtyPagesPid },
+    { "getMemoryInfoCached",    "(ILandroid/os/Debug$MemoryInfo;)Z",
+            (void*) android_os_Debug_getMemoryInfoCached },
     { "getPss",                 "()J",
             (void*) android_os_Debug_getPss },
     { "getPss",                 "(I[J[J)J",
@@ -19,6 +19,8 @@
 #include <nativehelper/JNIHelp.h>
 #include <android_runtime/AndroidRuntime.h>
 
+#include <atomic>
+
 #include <utils/Looper.h>
 #include <utils/Log.h>
 #include "android_os_MessageQueue.h"
@@ -55,6 +57,11 @@ private:
     JNIEnv* mPollEnv;
     jobject mPollObj;
     jthrowable mExceptionObj;
+
+    // True while a wake write is pending in the Looper's wake fd, i.e. between
+    // a wake() and the next pollOnce() entry.  Lets a burst of enqueues pay for
+    // a single wake write instead of one syscall each.
+    std::atomic<bool> mWakePending;
 };
 
 
@@ -76,7 +83,7 @@ bool MessageQueue::raiseAndClearException(JNIEnv* env, const char* msg) {
 }
 
 NativeMessageQueue::NativeMessageQueue() :
-        mPollEnv(NULL), mPollObj(NULL), mExceptionObj(NULL) {
+        mPollEnv(NULL), mPollObj(NULL), mExceptionObj(NULL), mWakePending(false) {
     mLooper = Looper::getForThread();
     if (mLooper == NULL) {
         mLooper = new Looper(false);
@@ -111,6 +118,14 @@ void NativeMessageQueue::pollOnce(JNIEnv* env, jobject pollObj, int timeoutMilli
     mPollObj = NULL;
     mPollEnv = NULL;
 
+    // The poll above drained the wake fd, so clear the pending flag only now
+    // that the drain is done: a wake() arriving any later (in particular while
+    // Java dispatches messages and computes the next timeout) writes the wake
+    // fd itself and the next poll returns immediately.  A wake swallowed
+    // between the in-poll drain and this store happened before we return to
+    // Java, so the message it signals is seen by the queue read that follows.
+    mWakePending.store(false, std::memory_order_seq_cst);
+
     if (mExceptionObj) {
         env->Throw(mExceptionObj);
         env->DeleteLocalRef(mExceptionObj);
@@ -119,7 +134,12 @@ void NativeMessageQueue::pollOnce(JNIEnv* env, jobject pollObj, int timeoutMilli
 }
 
 void NativeMessageQueue::wake() {
-    mLooper->wake();
+    // Coalesce wake writes: once a wake is sitting unconsumed in the wake fd,
+    // further wakes before the next poll are no-ops.  N enqueues in a burst
+    // thus cause a single wakeup of the loop thread.
+    if (!mWakePending.exchange(true, std::memory_order_seq_cst)) {
+        mLooper->wake();
+    }
 }
 
 void NativeMessageQueue::setFileDescriptorEvents(int fd, int events) {
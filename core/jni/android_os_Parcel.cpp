@@ -230,6 +230,47 @@ static void android_os_Parcel_writeBlob(JNIEnv* env, jclass clazz, jlong nativeP
     blob.release();
 }
 
+static void android_os_Parcel_writeBlobBuffer(JNIEnv* env, jclass clazz, jlong nativePtr,
+                                              jobject buffer, jint offset, jint length)
+{
+    Parcel* parcel = reinterpret_cast<Parcel*>(nativePtr);
+    if (parcel == NULL) {
+        return;
+    }
+
+    if (buffer == NULL) {
+        const status_t err = parcel->writeInt32(-1);
+        if (err != NO_ERROR) {
+            signalExceptionForError(env, clazz, err);
+        }
+        return;
+    }
+
+    // Writing from a direct buffer skips the Java heap entirely: the payload moves
+    // straight from its native storage into the (possibly ashmem-backed) blob.
+    void* base = env->GetDirectBufferAddress(buffer);
+    if (base == NULL) {
+        signalExceptionForError(env, clazz, BAD_VALUE);
+        return;
+    }
+
+    const status_t err = parcel->writeInt32(length);
+    if (err != NO_ERROR) {
+        signalExceptionForError(env, clazz, err);
+        return;
+    }
+
+    android::Parcel::WritableBlob blob;
+    android::status_t err2 = parcel->writeBlob(length, false, &blob);
+    if (err2 != NO_ERROR) {
+        signalExceptionForError(env, clazz, err2);
+        return;
+    }
+
+    memcpy(blob.data(), static_cast<const uint8_t*>(base) + offset, length);
+    blob.release();
+}
+
 static void android_os_Parcel_writeInt(JNIEnv* env, jclass clazz, jlong nativePtr, jint val) {
     Parcel* parcel = reinterpret_cast<Parcel*>(nativePtr);
     if (parcel != NULL) {
@@ -398,6 +439,56 @@ static jbyteArray android_os_Parcel_readBlob(JNIEnv* env, jclass clazz, jlong na
     return ret;
 }
 
+// Reads a blob and exposes it as a direct ByteBuffer over the mapped data instead of
+// copying it into a byte[]. For large blobs the data is an ashmem mapping owned by the
+// returned handle; for small blobs it aliases the Parcel's own buffer, so the managed
+// caller must treat the buffer as valid only while the Parcel is. The blob's ownership is
+// written to blobHandle[0] and must be returned through nativeReleaseBlobBuffer once the
+// buffer is no longer used.
+static jobject android_os_Parcel_readBlobBuffer(JNIEnv* env, jclass clazz, jlong nativePtr,
+                                                jlongArray blobHandle)
+{
+    Parcel* parcel = reinterpret_cast<Parcel*>(nativePtr);
+    if (parcel == NULL) {
+        return NULL;
+    }
+
+    int32_t len = parcel->readInt32();
+    if (len < 0) {
+        return NULL;
+    }
+
+    android::Parcel::ReadableBlob* blob = new android::Parcel::ReadableBlob();
+    android::status_t err = parcel->readBlob(len, blob);
+    if (err != NO_ERROR) {
+        delete blob;
+        signalExceptionForError(env, clazz, err);
+        return NULL;
+    }
+
+    jobject buffer = env->NewDirectByteBuffer(const_cast<void*>(blob->data()), len);
+    if (buffer == NULL) {
+        // An OutOfMemoryError is already pending.
+        blob->release();
+        delete blob;
+        return NULL;
+    }
+
+    jlong handle = reinterpret_cast<jlong>(blob);
+    env->SetLongArrayRegion(blobHandle, 0, 1, &handle);
+    return buffer;
+}
+
+static void android_os_Parcel_releaseBlobBuffer(JNIEnv* env, jclass clazz, jlong blobHandle)
+{
+    android::Parcel::ReadableBlob* blob =
+            reinterpret_cast<android::Parcel::ReadableBlob*>(blobHandle);
+    if (blob != NULL) {
+        blob->release();
+        delete blob;
+    }
+}
+
 static jint android_os_Parcel_readInt(jlong nativePtr)
 {
     Parcel* parcel = reinterpret_cast<Parcel*>(nativePtr);
@@ -769,6 +860,7 @@ static const JNINativeMethod gParcelMethods[] = {
 
     {"nativeWriteByteArray",      "(J[BII)V", (void*)android_os_Parcel_writeByteArray},
     {"nativeWriteBlob",           "(J[BII)V", (void*)android_os_Parcel_writeBlob},
+    {"nativeWriteBlobBuffer",     "(JLjava/nio/ByteBuffer;II)V", (void*)android_os_Parcel_writeBlobBuffer},
     // @FastNative
     {"nativeWriteInt",            "(JI)V", (void*)android_os_Parcel_writeInt},
     // @FastNative
@@ -784,6 +876,8 @@ static const JNINativeMethod gParcelMethods[] = {
     {"nativeCreateByteArray",     "(J)[B", (void*)android_os_Parcel_createByteArray},
     {"nativeReadByteArray",       "(J[BI)Z", (void*)android_os_Parcel_readByteArray},
     {"nativeReadBlob",            "(J)[B", (void*)android_os_Parcel_readBlob},
+    {"nativeReadBlobBuffer",      "(J[J)Ljava/nio/ByteBuffer;", (void*)android_os_Parcel_readBlobBuffer},
+    {"nativeReleaseBlobBuffer",   "(J)V", (void*)android_os_Parcel_releaseBlobBuffer},
     // @CriticalNative
     {"nativeReadInt",             "(J)I", (void*)android_os_Parcel_readInt},
     // @CriticalNative
@@ -26,11 +26,92 @@
 
 #include <algorithm>
 #include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <limits>
+#include <stdio.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 namespace {
 
+/*
+ * Pool of whole ashmem regions, keyed by size. Region setup is a kernel
+ * round trip that shows up when shared memory is churned at high rate, so
+ * regions donated back through nRecycle are kept (unpinned, letting the
+ * kernel reclaim their pages under pressure) and handed out again to a
+ * create of the exact same size. Sub-allocating one region was considered
+ * and rejected: every SharedMemory must own a distinct fd whose region size
+ * and protection are its own.
+ *
+ * The managed side only donates regions it never shared with another
+ * process and whose protection mask is untouched; anything else must go
+ * through plain close().
+ */
+static std::mutex gRegionPoolLock;
+static std::map<size_t, std::vector<int>> gRegionPool;
+static size_t gRegionPoolBytes = 0;
+static const size_t kRegionPoolMaxBytes = 64 << 20;
+
+static struct {
+    uint64_t hits;          // creates served from the pool
+    uint64_t purgedHits;    // ... of which came back purged (already zero)
+    uint64_t misses;        // creates that went to the kernel
+    uint64_t recycled;      // regions accepted into the pool
+    uint64_t rejected;      // regions refused (pool full / not poolable)
+} gRegionPoolStats;
+
+// Returns a pinned, zeroed region of exactly `size` bytes from the pool, or
+// -1 when none is available.
+static int acquirePooledRegion(size_t size) {
+    int fd = -1;
+    {
+        std::lock_guard<std::mutex> lock(gRegionPoolLock);
+        auto it = gRegionPool.find(size);
+        if (it == gRegionPool.end() || it->second.empty()) {
+            gRegionPoolStats.misses++;
+            return -1;
+        }
+        fd = it->second.back();
+        it->second.pop_back();
+        gRegionPoolBytes -= size;
+    }
+
+    const int pinned = ashmem_pin_region(fd, 0, 0);
+    if (pinned < 0) {
+        close(fd);
+        std::lock_guard<std::mutex> lock(gRegionPoolLock);
+        gRegionPoolStats.misses++;
+        return -1;
+    }
+
+    if (pinned != ASHMEM_WAS_PURGED) {
+        // The kernel kept the old pages; scrub them so the region looks
+        // freshly created.
+        void* addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            std::lock_guard<std::mutex> lock(gRegionPoolLock);
+            gRegionPoolStats.misses++;
+            return -1;
+        }
+        memset(addr, 0, size);
+        munmap(addr, size);
+    }
+
+    std::lock_guard<std::mutex> lock(gRegionPoolLock);
+    gRegionPoolStats.hits++;
+    if (pinned == ASHMEM_WAS_PURGED) {
+        gRegionPoolStats.purgedHits++;
+    }
+    return fd;
+}
+
 static void throwErrnoException(JNIEnv* env, const char* functionName, int error) {
     static jmethodID ctor = env->GetMethodID(JniConstants::errnoExceptionClass,
             "<init>", "(Ljava/lang/String;I)V");
@@ -49,6 +130,15 @@ static void throwErrnoException(JNIEnv* env, const char* functionName, int error
 
 static jobject SharedMemory_create(JNIEnv* env, jobject, jstring jname, jint size) {
 
+    if (size > 0) {
+        int pooledFd = acquirePooledRegion(static_cast<size_t>(size));
+        if (pooledFd >= 0) {
+            // Pooled regions keep the name they were created with; the name
+            // is only ever used for debugging.
+            return jniCreateFileDescriptor(env, pooledFd);
+        }
+    }
+
     // Name is optional so we can't use ScopedUtfChars for this as it throws NPE on null
     const char* name = jname ? env->GetStringUTFChars(jname, nullptr) : nullptr;
 
@@ -87,10 +177,72 @@ static jint SharedMemory_setProt(JNIEnv* env, jobject, jobject fileDescriptor, j
     return err;
 }
 
+// Offers a region to the pool instead of destroying it. Returns true when
+// the pool took a reference; the caller closes its own fd either way. The
+// pooled duplicate is unpinned so the kernel is free to drop the pages
+// until the region is handed out again.
+static jboolean SharedMemory_recycle(JNIEnv* env, jobject, jobject fileDescriptor) {
+    int fd = jniGetFDFromFileDescriptor(env, fileDescriptor);
+    if (!ashmem_valid(fd)) {
+        return JNI_FALSE;
+    }
+    size_t size = ashmem_get_size_region(fd);
+    if (size == 0) {
+        return JNI_FALSE;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(gRegionPoolLock);
+        if (gRegionPoolBytes + size > kRegionPoolMaxBytes) {
+            gRegionPoolStats.rejected++;
+            return JNI_FALSE;
+        }
+    }
+
+    int pooledFd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (pooledFd < 0) {
+        return JNI_FALSE;
+    }
+    if (ashmem_unpin_region(pooledFd, 0, 0) < 0) {
+        close(pooledFd);
+        return JNI_FALSE;
+    }
+
+    std::lock_guard<std::mutex> lock(gRegionPoolLock);
+    if (gRegionPoolBytes + size > kRegionPoolMaxBytes) {
+        // Lost a race while duplicating the fd.
+        gRegionPoolStats.rejected++;
+        close(pooledFd);
+        return JNI_FALSE;
+    }
+    gRegionPool[size].push_back(pooledFd);
+    gRegionPoolBytes += size;
+    gRegionPoolStats.recycled++;
+    return JNI_TRUE;
+}
+
+// One-line pool summary for dumpsys.
+static jstring SharedMemory_getPoolStats(JNIEnv* env, jobject) {
+    char buf[256];
+    std::lock_guard<std::mutex> lock(gRegionPoolLock);
+    size_t entries = 0;
+    for (const auto& sizeClass : gRegionPool) {
+        entries += sizeClass.second.size();
+    }
+    snprintf(buf, sizeof(buf),
+             "pooled=%zu (%zu bytes) hits=%" PRIu64 " (purged %" PRIu64 ") misses=%" PRIu64
+             " recycled=%" PRIu64 " rejected=%" PRIu64,
+             entries, gRegionPoolBytes, gRegionPoolStats.hits, gRegionPoolStats.purgedHits,
+             gRegionPoolStats.misses, gRegionPoolStats.recycled, gRegionPoolStats.rejected);
+    return env->NewStringUTF(buf);
+}
+
 static const JNINativeMethod methods[] = {
     {"nCreate", "(Ljava/lang/String;I)Ljava/io/FileDescriptor;", (void*)SharedMemory_create},
     {"nGetSize", "(Ljava/io/FileDescriptor;)I", (void*)SharedMemory_getSize},
     {"nSetProt", "(Ljava/io/FileDescriptor;I)I", (void*)SharedMemory_setProt},
+    {"nRecycle", "(Ljava/io/FileDescriptor;)Z", (void*)SharedMemory_recycle},
+    {"nGetPoolStats", "()Ljava/lang/String;", (void*)SharedMemory_getPoolStats},
 };
 
 } // anonymous namespace
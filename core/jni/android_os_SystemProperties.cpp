@@ -18,6 +18,7 @@
 #define LOG_TAG "SysPropJNI"
 
 #include "android-base/logging.h"
+#include "android-base/parseint.h"
 #include "android-base/properties.h"
 #include "cutils/properties.h"
 #include "utils/misc.h"
@@ -28,11 +29,64 @@
 #include <nativehelper/ScopedPrimitiveArray.h>
 #include <nativehelper/ScopedUtfChars.h>
 
+#include <sys/system_properties.h>
+#include <sys/_system_properties.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace android
 {
 
 namespace {
 
+// Cache of resolved prop_info handles and their last-read values.
+//
+// prop_info pointers are stable for the lifetime of the process, so once a
+// key has been resolved a repeat read is a serial comparison instead of the
+// full name walk in __system_property_find. Properties that did not exist at
+// lookup time are remembered against the property area serial, which bumps
+// whenever a property is created, so their absence is revalidated cheaply too.
+struct PropertyCacheEntry {
+    const prop_info* info = nullptr;
+    uint32_t serial = 0;
+    std::string value;
+};
+
+std::mutex gPropertyCacheLock;
+std::unordered_map<std::string, PropertyCacheEntry> gPropertyCache;
+
+void PropertyCacheReadCallback(void* cookie, const char* /*name*/, const char* value,
+                               uint32_t serial) {
+    PropertyCacheEntry* entry = static_cast<PropertyCacheEntry*>(cookie);
+    entry->value = value;
+    entry->serial = serial;
+}
+
+std::string CachedGetProperty(const std::string& key) {
+    std::lock_guard<std::mutex> lock(gPropertyCacheLock);
+    PropertyCacheEntry& entry = gPropertyCache[key];
+    if (entry.info == nullptr) {
+        uint32_t areaSerial = __system_property_area_serial();
+        if (entry.serial != 0 && entry.serial == areaSerial) {
+            // Known to be absent and nothing has been created since.
+            return entry.value;
+        }
+        entry.info = __system_property_find(key.c_str());
+        if (entry.info == nullptr) {
+            entry.serial = areaSerial;
+            entry.value.clear();
+            return entry.value;
+        }
+        entry.serial = 0;
+    }
+    if (__system_property_serial(entry.info) != entry.serial) {
+        __system_property_read_callback(entry.info, PropertyCacheReadCallback, &entry);
+    }
+    return entry.value;
+}
+
 template <typename T, typename Handler>
 T ConvertKeyAndForward(JNIEnv *env, jstring keyJ, T defJ, Handler handler) {
     std::string key;
@@ -56,7 +110,7 @@ jstring SystemProperties_getSS(JNIEnv *env, jclass clazz, jstring keyJ,
     // Using ConvertKeyAndForward is sub-optimal for copying the key string,
     // but improves reuse and reasoning over code.
     auto handler = [&](const std::string& key, jstring defJ) {
-        std::string prop_val = android::base::GetProperty(key, "");
+        std::string prop_val = CachedGetProperty(key);
         if (!prop_val.empty()) {
             return env->NewStringUTF(prop_val.c_str());
         };
@@ -80,7 +134,13 @@ T SystemProperties_get_integral(JNIEnv *env, jclass, jstring keyJ,
                                        T defJ)
 {
     auto handler = [](const std::string& key, T defV) {
-        return android::base::GetIntProperty<T>(key, defV);
+        // Same parse as android::base::GetIntProperty, fed from the cache.
+        T result;
+        std::string value = CachedGetProperty(key);
+        if (!value.empty() && android::base::ParseInt(value, &result)) {
+            return result;
+        }
+        return defV;
     };
     return ConvertKeyAndForward(env, keyJ, defJ, handler);
 }
@@ -89,12 +149,58 @@ jboolean SystemProperties_get_boolean(JNIEnv *env, jclass, jstring keyJ,
                                       jboolean defJ)
 {
     auto handler = [](const std::string& key, jboolean defV) -> jboolean {
-        bool result = android::base::GetBoolProperty(key, defV);
-        return result ? JNI_TRUE : JNI_FALSE;
+        // Same accepted spellings as android::base::GetBoolProperty.
+        std::string value = CachedGetProperty(key);
+        if (value == "1" || value == "y" || value == "yes" || value == "on" ||
+                value == "true") {
+            return JNI_TRUE;
+        }
+        if (value == "0" || value == "n" || value == "no" || value == "off" ||
+                value == "false") {
+            return JNI_FALSE;
+        }
+        return defV;
     };
     return ConvertKeyAndForward(env, keyJ, defJ, handler);
 }
 
+jobjectArray SystemProperties_get_batch(JNIEnv *env, jclass, jobjectArray keysJ)
+{
+    if (keysJ == nullptr) {
+        jniThrowNullPointerException(env, "keys");
+        return nullptr;
+    }
+    jsize count = env->GetArrayLength(keysJ);
+    jclass stringClass = env->FindClass("java/lang/String");
+    jobjectArray result = env->NewObjectArray(count, stringClass, nullptr);
+    if (result == nullptr) {
+        return nullptr; // OOM
+    }
+    for (jsize i = 0; i < count; i++) {
+        jstring keyJ = jstring(env->GetObjectArrayElement(keysJ, i));
+        if (keyJ == nullptr) {
+            jniThrowNullPointerException(env, "keys element");
+            return nullptr;
+        }
+        std::string value;
+        {
+            ScopedUtfChars key_utf(env, keyJ);
+            if (key_utf.c_str() == nullptr) {
+                return nullptr;
+            }
+            value = CachedGetProperty(key_utf.c_str());
+        }
+        env->DeleteLocalRef(keyJ);
+        jstring valueJ = env->NewStringUTF(value.c_str());
+        if (valueJ == nullptr) {
+            return nullptr; // OOM
+        }
+        env->SetObjectArrayElement(result, i, valueJ);
+        env->DeleteLocalRef(valueJ);
+    }
+    return result;
+}
+
 void SystemProperties_set(JNIEnv *env, jobject clazz, jstring keyJ,
                           jstring valJ)
 {
@@ -168,6 +274,9 @@ int register_android_os_SystemProperties(JNIEnv *env)
           (void*) SystemProperties_get_integral<jlong> },
         { "native_get_boolean", "(Ljava/lang/String;Z)Z",
           (void*) SystemProperties_get_boolean },
+        { "native_get_batch",
+          "([Ljava/lang/String;)[Ljava/lang/String;",
+          (void*) SystemProperties_get_batch },
         { "native_set", "(Ljava/lang/String;Ljava/lang/String;)V",
           (void*) SystemProperties_set },
         { "native_add_change_callback", "()V",
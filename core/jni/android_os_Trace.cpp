@@ -18,6 +18,14 @@
 // #define LOG_NDEBUG 0
 
 #include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 #include <cutils/trace.h>
 #include <utils/String8.h>
@@ -41,6 +49,153 @@ static void sanitizeString(String8& utf8Chars) {
     utf8Chars.unlockBuffer();
 }
 
+// ----------------------------------------------------------------------------
+// Buffered user-space tracing.
+//
+// Every event normally becomes a write to the global trace_marker file, which
+// serializes concurrent tracers on a kernel lock.  In buffered mode, events are
+// instead appended to a per-thread ring buffer with their own monotonic
+// timestamps - no locks, no syscalls - and the rings are collected on demand
+// through nativeGetBufferedTrace as an in-process flight recorder.  A per-tag
+// sampling interval (record every Nth begin/end pair) applies in both modes so
+// production tracing can stay enabled at negligible overhead.
+
+static const size_t kTraceBufferSize = 32768;
+
+// Sampling intervals indexed by tag bit; 0 and 1 both mean every event.
+// gSamplingConfigured avoids touching the per-thread state when no interval
+// has been set, which is the common case.
+static std::atomic<uint32_t> gSamplingInterval[64];
+static std::atomic<bool> gSamplingConfigured(false);
+static std::atomic<bool> gBufferedTracing(false);
+
+struct ThreadTraceBuffer {
+    pid_t tid;
+    size_t pos;
+    bool wrapped;
+    uint32_t sampleCount[64];
+    uint32_t skipDepth[64];
+    char data[kTraceBufferSize];
+};
+
+// Registered buffers, for collection.  Writers never take this lock on the
+// record path; it is only held to register or unregister a thread's buffer
+// and while collecting.
+static std::mutex gTraceBufferRegistryLock;
+static std::vector<ThreadTraceBuffer*> gTraceBufferRegistry;
+
+class ThreadTraceBufferHolder {
+public:
+    ThreadTraceBuffer* buffer;
+
+    ThreadTraceBufferHolder() : buffer(NULL) { }
+
+    ~ThreadTraceBufferHolder() {
+        if (buffer) {
+            std::lock_guard<std::mutex> lock(gTraceBufferRegistryLock);
+            for (size_t i = 0; i < gTraceBufferRegistry.size(); i++) {
+                if (gTraceBufferRegistry[i] == buffer) {
+                    gTraceBufferRegistry.erase(gTraceBufferRegistry.begin() + i);
+                    break;
+                }
+            }
+            delete buffer;
+        }
+    }
+};
+
+static thread_local ThreadTraceBufferHolder gThreadTraceBuffer;
+
+static ThreadTraceBuffer* getThreadTraceBuffer() {
+    ThreadTraceBuffer* buffer = gThreadTraceBuffer.buffer;
+    if (buffer == NULL) {
+        buffer = new ThreadTraceBuffer();
+        memset(buffer, 0, sizeof(*buffer));
+        buffer->tid = gettid();
+        gThreadTraceBuffer.buffer = buffer;
+        std::lock_guard<std::mutex> lock(gTraceBufferRegistryLock);
+        gTraceBufferRegistry.push_back(buffer);
+    }
+    return buffer;
+}
+
+static inline int tagBit(uint64_t tag) {
+    return tag ? __builtin_ctzll(tag) : 0;
+}
+
+// Sampling keeps begin/end pairs coherent: when a begin is sampled out, the
+// skip depth for its tag is raised and the matching end is suppressed too.
+static bool shouldSampleBegin(ThreadTraceBuffer* buffer, uint64_t tag) {
+    int bit = tagBit(tag);
+    uint32_t interval = gSamplingInterval[bit].load(std::memory_order_relaxed);
+    if (interval <= 1 || buffer->sampleCount[bit]++ % interval == 0) {
+        return true;
+    }
+    buffer->skipDepth[bit]++;
+    return false;
+}
+
+static bool shouldSampleEnd(ThreadTraceBuffer* buffer, uint64_t tag) {
+    int bit = tagBit(tag);
+    if (buffer->skipDepth[bit] > 0) {
+        buffer->skipDepth[bit]--;
+        return false;
+    }
+    return true;
+}
+
+static bool shouldSampleEvent(ThreadTraceBuffer* buffer, uint64_t tag) {
+    int bit = tagBit(tag);
+    uint32_t interval = gSamplingInterval[bit].load(std::memory_order_relaxed);
+    return interval <= 1 || buffer->sampleCount[bit]++ % interval == 0;
+}
+
+// Appends one formatted event line to the owning thread's ring.  Only the
+// owner writes, so no synchronization is needed; when the line does not fit
+// the ring wraps and overwrites the oldest events, flight-recorder style.
+static void appendBufferedLine(ThreadTraceBuffer* buffer, const char* line, size_t len) {
+    if (len > kTraceBufferSize) {
+        return;
+    }
+    if (buffer->pos + len > kTraceBufferSize) {
+        buffer->wrapped = true;
+        buffer->pos = 0;
+    }
+    memcpy(buffer->data + buffer->pos, line, len);
+    buffer->pos += len;
+}
+
+static void recordBufferedEvent(ThreadTraceBuffer* buffer, char type, uint64_t tag,
+        const char* name, int32_t value, bool hasValue) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const uint64_t nanos = uint64_t(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+
+    char line[256];
+    int len;
+    if (name == NULL) {
+        len = snprintf(line, sizeof(line), "%" PRIu64 " %c|%" PRIx64 "\n", nanos, type, tag);
+    } else if (hasValue) {
+        len = snprintf(line, sizeof(line), "%" PRIu64 " %c|%" PRIx64 "|%s|%d\n",
+                nanos, type, tag, name, value);
+    } else {
+        len = snprintf(line, sizeof(line), "%" PRIu64 " %c|%" PRIx64 "|%s\n",
+                nanos, type, tag, name);
+    }
+    if (len > 0) {
+        appendBufferedLine(buffer, line, size_t(len) < sizeof(line) ? len : sizeof(line) - 1);
+    }
+}
+
+// True when events need the per-thread state, either because buffered mode is
+// on or because a sampling interval has been configured.
+static inline bool traceInterceptActive() {
+    return gBufferedTracing.load(std::memory_order_relaxed)
+            || gSamplingConfigured.load(std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+
 static jlong android_os_Trace_nativeGetEnabledTags(JNIEnv* env, jclass clazz) {
     return atrace_get_enabled_tags();
 }
@@ -50,6 +205,16 @@ static void android_os_Trace_nativeTraceCounter(JNIEnv* env, jclass clazz,
     ScopedUtfChars name(env, nameStr);
 
     ALOGV("%s: %" PRId64 " %s %d", __FUNCTION__, tag, name.c_str(), value);
+    if (traceInterceptActive()) {
+        ThreadTraceBuffer* buffer = getThreadTraceBuffer();
+        if (!shouldSampleEvent(buffer, tag)) {
+            return;
+        }
+        if (gBufferedTracing.load(std::memory_order_relaxed)) {
+            recordBufferedEvent(buffer, 'C', tag, name.c_str(), value, true);
+            return;
+        }
+    }
     atrace_int(tag, name.c_str(), value);
 }
 
@@ -60,6 +225,16 @@ static void android_os_Trace_nativeTraceBegin(JNIEnv* env, jclass clazz,
     sanitizeString(utf8Chars);
 
     ALOGV("%s: %" PRId64 " %s", __FUNCTION__, tag, utf8Chars.string());
+    if (traceInterceptActive()) {
+        ThreadTraceBuffer* buffer = getThreadTraceBuffer();
+        if (!shouldSampleBegin(buffer, tag)) {
+            return;
+        }
+        if (gBufferedTracing.load(std::memory_order_relaxed)) {
+            recordBufferedEvent(buffer, 'B', tag, utf8Chars.string(), 0, false);
+            return;
+        }
+    }
     atrace_begin(tag, utf8Chars.string());
 }
 
@@ -67,6 +242,16 @@ static void android_os_Trace_nativeTraceEnd(JNIEnv* env, jclass clazz,
         jlong tag) {
 
     ALOGV("%s: %" PRId64, __FUNCTION__, tag);
+    if (traceInterceptActive()) {
+        ThreadTraceBuffer* buffer = getThreadTraceBuffer();
+        if (!shouldSampleEnd(buffer, tag)) {
+            return;
+        }
+        if (gBufferedTracing.load(std::memory_order_relaxed)) {
+            recordBufferedEvent(buffer, 'E', tag, NULL, 0, false);
+            return;
+        }
+    }
     atrace_end(tag);
 }
 
@@ -77,6 +262,12 @@ static void android_os_Trace_nativeAsyncTraceBegin(JNIEnv* env, jclass clazz,
     sanitizeString(utf8Chars);
 
     ALOGV("%s: %" PRId64 " %s %d", __FUNCTION__, tag, utf8Chars.string(), cookie);
+    // Async events are not sampled: their begin/end pairs are matched by
+    // cookie, which a per-tag counter cannot keep coherent.
+    if (gBufferedTracing.load(std::memory_order_relaxed)) {
+        recordBufferedEvent(getThreadTraceBuffer(), 'S', tag, utf8Chars.string(), cookie, true);
+        return;
+    }
     atrace_async_begin(tag, utf8Chars.string(), cookie);
 }
 
@@ -87,6 +278,10 @@ static void android_os_Trace_nativeAsyncTraceEnd(JNIEnv* env, jclass clazz,
     sanitizeString(utf8Chars);
 
     ALOGV("%s: %" PRId64 " %s %d", __FUNCTION__, tag, utf8Chars.string(), cookie);
+    if (gBufferedTracing.load(std::memory_order_relaxed)) {
+        recordBufferedEvent(getThreadTraceBuffer(), 'F', tag, utf8Chars.string(), cookie, true);
+        return;
+    }
     atrace_async_end(tag, utf8Chars.string(), cookie);
 }
 
@@ -104,6 +299,56 @@ static void android_os_Trace_nativeSetTracingEnabled(JNIEnv* env,
     atrace_set_tracing_enabled(enabled);
 }
 
+static void android_os_Trace_nativeSetBufferedTracingEnabled(JNIEnv* env,
+        jclass clazz, jboolean enabled) {
+    ALOGV("%s: %d", __FUNCTION__, enabled);
+
+    gBufferedTracing.store(enabled, std::memory_order_relaxed);
+}
+
+static void android_os_Trace_nativeSetTraceSampling(JNIEnv* env, jclass clazz,
+        jlong tag, jint interval) {
+    ALOGV("%s: %" PRId64 " %d", __FUNCTION__, tag, interval);
+
+    if (interval < 0) {
+        interval = 0;
+    }
+    bool configured = false;
+    uint64_t bits = uint64_t(tag);
+    for (int bit = 0; bit < 64; bit++) {
+        if (bits & (1ull << bit)) {
+            gSamplingInterval[bit].store(interval, std::memory_order_relaxed);
+        }
+        if (gSamplingInterval[bit].load(std::memory_order_relaxed) > 1) {
+            configured = true;
+        }
+    }
+    gSamplingConfigured.store(configured, std::memory_order_relaxed);
+}
+
+static jstring android_os_Trace_nativeGetBufferedTrace(JNIEnv* env, jclass clazz) {
+    String8 out;
+
+    // Writers keep appending while we read; a torn line at a ring's write
+    // position is possible and tolerated - this is a diagnostic snapshot.
+    std::lock_guard<std::mutex> lock(gTraceBufferRegistryLock);
+    for (size_t n = 0; n < gTraceBufferRegistry.size(); n++) {
+        const ThreadTraceBuffer* buffer = gTraceBufferRegistry[n];
+        out.appendFormat("tid %d\n", buffer->tid);
+        if (buffer->wrapped) {
+            // Skip the partial line left where the ring last wrapped.
+            const char* tail = buffer->data + buffer->pos;
+            size_t tailLen = kTraceBufferSize - buffer->pos;
+            const char* newline = static_cast<const char*>(memchr(tail, '\n', tailLen));
+            if (newline) {
+                out.append(newline + 1, tailLen - (newline + 1 - tail));
+            }
+        }
+        out.append(buffer->data, buffer->pos);
+    }
+    return env->NewStringUTF(out.string());
+}
+
 static const JNINativeMethod gTraceMethods[] = {
     /* name, signature, funcPtr */
     { "nativeGetEnabledTags",
@@ -115,6 +360,15 @@ static const JNINativeMethod gTraceMethods[] = {
     { "nativeSetTracingEnabled",
             "(Z)V",
             (void*)android_os_Trace_nativeSetTracingEnabled },
+    { "nativeSetBufferedTracingEnabled",
+            "(Z)V",
+            (void*)android_os_Trace_nativeSetBufferedTracingEnabled },
+    { "nativeSetTraceSampling",
+            "(JI)V",
+            (void*)android_os_Trace_nativeSetTraceSampling },
+    { "nativeGetBufferedTrace",
+            "()Ljava/lang/String;",
+            (void*)android_os_Trace_nativeGetBufferedTrace },
 
     // ----------- @FastNative  ----------------
 
@@ -26,7 +26,9 @@
 #include <nativehelper/ScopedPrimitiveArray.h>
 #include <nativehelper/JNIHelp.h>
 #include "core_jni_helpers.h"
+#include <atomic>
 #include <cstdint>
+#include <thread>
 #include <vector>
 #include <list>
 #include <algorithm>
@@ -95,6 +97,74 @@ static jlong nBuildNativeMeasuredParagraph(JNIEnv* env, jclass /* unused */, jlo
                                                 computeLayout).release());
 }
 
+// Regular JNI
+//
+// Builds a batch of paragraphs at once, fanning the measure passes out over
+// worker threads.  Each entry of builderPtrs is consumed together with the
+// corresponding text; the result array holds the MeasuredText pointers in the
+// same order, with 0 for entries whose builder pointer was 0.  Minikin's
+// layout and hyphenation caches are internally synchronized, so the builds are
+// independent of each other.  The texts are copied out up front because the
+// workers must not touch JNI.
+static jlongArray nBuildNativeMeasuredParagraphs(JNIEnv* env, jclass /* unused */,
+                                      jlongArray builderPtrs, jobjectArray javaTexts,
+                                      jboolean computeHyphenation, jboolean computeLayout) {
+    ScopedLongArrayRO builders(env, builderPtrs);
+    const size_t count = builders.size();
+
+    std::vector<std::vector<uint16_t>> texts(count);
+    for (size_t i = 0; i < count; i++) {
+        jcharArray javaText =
+                static_cast<jcharArray>(env->GetObjectArrayElement(javaTexts, i));
+        if (javaText != nullptr) {
+            ScopedCharArrayRO text(env, javaText);
+            texts[i].assign(text.get(), text.get() + text.size());
+            env->DeleteLocalRef(javaText);
+        }
+    }
+
+    std::vector<jlong> results(count, 0);
+    std::atomic<size_t> nextIndex(0);
+    auto work = [&]() {
+        while (true) {
+            const size_t i = nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (i >= count) {
+                break;
+            }
+            minikin::MeasuredTextBuilder* builder = toBuilder(builders[i]);
+            if (builder == nullptr) {
+                continue;
+            }
+            const minikin::U16StringPiece textBuffer(texts[i].data(), texts[i].size());
+            // Pass the ownership to Java, as in nBuildNativeMeasuredParagraph.
+            results[i] = toJLong(
+                    builder->build(textBuffer, computeHyphenation, computeLayout).release());
+        }
+    };
+
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, count);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadCount; i++) {
+        workers.emplace_back(work);
+    }
+    work();  // The calling thread takes part instead of just waiting.
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    jlongArray resultArray = env->NewLongArray(count);
+    if (resultArray == nullptr) {
+        // OutOfMemoryError is pending; the built paragraphs would leak, so free them.
+        for (size_t i = 0; i < count; i++) {
+            delete toMeasuredParagraph(results[i]);
+        }
+        return nullptr;
+    }
+    env->SetLongArrayRegion(resultArray, 0, count, results.data());
+    return resultArray;
+}
+
 // Regular JNI
 static void nFreeBuilder(JNIEnv* env, jclass /* unused */, jlong builderPtr) {
     delete toBuilder(builderPtr);
@@ -145,6 +215,7 @@ static const JNINativeMethod gMethods[] = {
     {"nAddStyleRun", "(JJIIZ)V", (void*) nAddStyleRun},
     {"nAddReplacementRun", "(JJIIF)V", (void*) nAddReplacementRun},
     {"nBuildNativeMeasuredParagraph", "(J[CZZ)J", (void*) nBuildNativeMeasuredParagraph},
+    {"nBuildNativeMeasuredParagraphs", "([J[[CZZ)[J", (void*) nBuildNativeMeasuredParagraphs},
     {"nFreeBuilder", "(J)V", (void*) nFreeBuilder},
 
     // MeasuredParagraph native functions.
@@ -27,6 +27,8 @@
 #include "core_jni_helpers.h"
 #include "scoped_nullable_primitive_array.h"
 #include <cstdint>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <list>
 #include <algorithm>
@@ -66,22 +68,118 @@ static inline minikin::android::StaticLayoutNative* toNative(jlong ptr) {
     return reinterpret_cast<minikin::android::StaticLayoutNative*>(ptr);
 }
 
+// ---------------------------------------------------------------------------
+// Line break memoization.
+//
+// List-style UIs re-layout identical paragraphs across bind/measure cycles, so
+// a full Minikin break pass is frequently repeated on unchanged input.  The
+// results are memoized in a small process-wide LRU keyed by the text, the
+// layout widths and tab stops, the builder configuration, and a hash of the
+// measured per-cluster advances.  The advance hash stands in for a paint and
+// locale fingerprint: any style or locale change that could alter the breaks
+// also alters the measured widths.
+
+static uint64_t hashBytes(const void* data, size_t size,
+        uint64_t hash = 0xcbf29ce484222325ull) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+struct LineBreakCacheKey {
+    std::vector<uint16_t> text;
+    uint64_t textHash;
+    uint64_t measureHash;
+    uint64_t paramsHash;
+    float firstWidth;
+    int32_t firstWidthLineCount;
+    float restWidth;
+    int32_t indentsOffset;
+    int32_t defaultTabStop;
+    std::vector<jint> tabStops;
+
+    bool operator==(const LineBreakCacheKey& o) const {
+        return textHash == o.textHash && measureHash == o.measureHash
+                && paramsHash == o.paramsHash && firstWidth == o.firstWidth
+                && firstWidthLineCount == o.firstWidthLineCount && restWidth == o.restWidth
+                && indentsOffset == o.indentsOffset && defaultTabStop == o.defaultTabStop
+                && tabStops == o.tabStops && text == o.text;
+    }
+};
+
+struct LineBreakCacheKeyHash {
+    size_t operator()(const LineBreakCacheKey& key) const {
+        uint64_t hash = key.textHash ^ (key.measureHash * 31) ^ (key.paramsHash * 127);
+        hash = hashBytes(&key.firstWidth, sizeof(key.firstWidth), hash);
+        hash = hashBytes(&key.restWidth, sizeof(key.restWidth), hash);
+        hash ^= uint64_t(key.firstWidthLineCount) ^ (uint64_t(key.indentsOffset) << 16)
+                ^ (uint64_t(key.defaultTabStop) << 32);
+        if (!key.tabStops.empty()) {
+            hash = hashBytes(key.tabStops.data(), key.tabStops.size() * sizeof(jint), hash);
+        }
+        return hash;
+    }
+};
+
+struct LineBreakCacheEntry {
+    LineBreakCacheKey key;
+    decltype(minikin::LineBreakResult::breakPoints) breakPoints;
+    decltype(minikin::LineBreakResult::widths) widths;
+    decltype(minikin::LineBreakResult::ascents) ascents;
+    decltype(minikin::LineBreakResult::descents) descents;
+    decltype(minikin::LineBreakResult::flags) flags;
+};
+
+static const size_t kLineBreakCacheMaxEntries = 64;
+
+static std::mutex gLineBreakCacheLock;
+// Most recently used entries at the front; the index points into the list.
+static std::list<LineBreakCacheEntry> gLineBreakCache;
+static std::unordered_map<LineBreakCacheKey, std::list<LineBreakCacheEntry>::iterator,
+        LineBreakCacheKeyHash> gLineBreakCacheIndex;
+// Fingerprints of the nInit parameters per live builder, since
+// StaticLayoutNative does not expose its configuration.
+static std::unordered_map<jlong, uint64_t> gBuilderParamsHash;
+
 // set text and set a number of parameters for creating a layout (width, tabstops, strategy,
 // hyphenFrequency)
 static jlong nInit(JNIEnv* env, jclass /* unused */,
         jint breakStrategy, jint hyphenationFrequency, jboolean isJustified,
         jintArray indents, jintArray leftPaddings, jintArray rightPaddings) {
-    return reinterpret_cast<jlong>(new minikin::android::StaticLayoutNative(
+    std::vector<float> indentVec = jintArrayToFloatVector(env, indents);
+    std::vector<float> leftPaddingVec = jintArrayToFloatVector(env, leftPaddings);
+    std::vector<float> rightPaddingVec = jintArrayToFloatVector(env, rightPaddings);
+
+    uint64_t paramsHash = hashBytes(&breakStrategy, sizeof(breakStrategy));
+    paramsHash = hashBytes(&hyphenationFrequency, sizeof(hyphenationFrequency), paramsHash);
+    paramsHash = hashBytes(&isJustified, sizeof(isJustified), paramsHash);
+    paramsHash = hashBytes(indentVec.data(), indentVec.size() * sizeof(float), paramsHash);
+    paramsHash = hashBytes(leftPaddingVec.data(), leftPaddingVec.size() * sizeof(float),
+            paramsHash);
+    paramsHash = hashBytes(rightPaddingVec.data(), rightPaddingVec.size() * sizeof(float),
+            paramsHash);
+
+    jlong ptr = reinterpret_cast<jlong>(new minikin::android::StaticLayoutNative(
             static_cast<minikin::BreakStrategy>(breakStrategy),
             static_cast<minikin::HyphenationFrequency>(hyphenationFrequency),
             isJustified,
-            jintArrayToFloatVector(env, indents),
-            jintArrayToFloatVector(env, leftPaddings),
-            jintArrayToFloatVector(env, rightPaddings)));
+            std::move(indentVec),
+            std::move(leftPaddingVec),
+            std::move(rightPaddingVec)));
+
+    std::lock_guard<std::mutex> lock(gLineBreakCacheLock);
+    gBuilderParamsHash[ptr] = paramsHash;
+    return ptr;
 }
 
 // CriticalNative
 static void nFinish(jlong nativePtr) {
+    {
+        std::lock_guard<std::mutex> lock(gLineBreakCacheLock);
+        gBuilderParamsHash.erase(nativePtr);
+    }
     delete toNative(nativePtr);
 }
 
@@ -141,9 +239,62 @@ static jint nComputeLineBreaks(JNIEnv* env, jclass, jlong nativePtr,
 
     minikin::U16StringPiece u16Text(text.get(), length);
     minikin::MeasuredText* measuredText = reinterpret_cast<minikin::MeasuredText*>(measuredTextPtr);
-    minikin::LineBreakResult result = builder->computeBreaks(
-            u16Text, *measuredText, firstWidth, firstWidthLineCount, restWidth, indentsOffset,
-            tabStops.get(), tabStops.size(), defaultTabStop);
+
+    LineBreakCacheKey key;
+    key.text.assign(text.get(), text.get() + length);
+    key.textHash = hashBytes(key.text.data(), length * sizeof(uint16_t));
+    key.measureHash = hashBytes(measuredText->widths.data(),
+            measuredText->widths.size() * sizeof(float));
+    key.firstWidth = firstWidth;
+    key.firstWidthLineCount = firstWidthLineCount;
+    key.restWidth = restWidth;
+    key.indentsOffset = indentsOffset;
+    key.defaultTabStop = defaultTabStop;
+    if (tabStops.size() > 0) {
+        key.tabStops.assign(tabStops.get(), tabStops.get() + tabStops.size());
+    }
+
+    minikin::LineBreakResult result;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(gLineBreakCacheLock);
+        auto paramsIt = gBuilderParamsHash.find(nativePtr);
+        key.paramsHash = paramsIt != gBuilderParamsHash.end() ? paramsIt->second : 0;
+        auto it = gLineBreakCacheIndex.find(key);
+        if (it != gLineBreakCacheIndex.end()) {
+            gLineBreakCache.splice(gLineBreakCache.begin(), gLineBreakCache, it->second);
+            const LineBreakCacheEntry& entry = *it->second;
+            result.breakPoints = entry.breakPoints;
+            result.widths = entry.widths;
+            result.ascents = entry.ascents;
+            result.descents = entry.descents;
+            result.flags = entry.flags;
+            cached = true;
+        }
+    }
+
+    if (!cached) {
+        result = builder->computeBreaks(
+                u16Text, *measuredText, firstWidth, firstWidthLineCount, restWidth, indentsOffset,
+                tabStops.get(), tabStops.size(), defaultTabStop);
+
+        std::lock_guard<std::mutex> lock(gLineBreakCacheLock);
+        if (gLineBreakCacheIndex.find(key) == gLineBreakCacheIndex.end()) {
+            gLineBreakCache.emplace_front();
+            LineBreakCacheEntry& entry = gLineBreakCache.front();
+            entry.key = key;
+            entry.breakPoints = result.breakPoints;
+            entry.widths = result.widths;
+            entry.ascents = result.ascents;
+            entry.descents = result.descents;
+            entry.flags = result.flags;
+            gLineBreakCacheIndex[key] = gLineBreakCache.begin();
+            if (gLineBreakCache.size() > kLineBreakCacheMaxEntries) {
+                gLineBreakCacheIndex.erase(gLineBreakCache.back().key);
+                gLineBreakCache.pop_back();
+            }
+        }
+    }
 
     recycleCopy(env, recycle, recycleBreaks, recycleWidths, recycleAscents, recycleDescents,
             recycleFlags, recycleLength, result);
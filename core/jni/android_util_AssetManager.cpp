@@ -25,6 +25,8 @@
 #include <sys/types.h>
 #include <sys/wait.h>
 
+#include <vector>
+
 #include <private/android_filesystem_config.h> // for AID_SYSTEM
 
 #include "android-base/logging.h"
@@ -1053,6 +1055,43 @@ static void NativeApplyStyle(JNIEnv* env, jclass /*clazz*/, jlong ptr, jlong the
   env->ReleasePrimitiveArrayCritical(java_attrs, attrs, JNI_ABORT);
 }
 
+static void NativeApplyStyleBatch(JNIEnv* env, jclass /*clazz*/, jlong ptr, jlong theme_ptr,
+                                  jint def_style_attr, jint def_style_resid,
+                                  jlongArray java_xml_parsers, jintArray java_attrs,
+                                  jlong out_values_ptr, jlong out_indices_ptr) {
+  ScopedLock<AssetManager2> assetmanager(AssetManagerFromLong(ptr));
+  Theme* theme = reinterpret_cast<Theme*>(theme_ptr);
+  CHECK(theme->GetAssetManager() == &(*assetmanager));
+  (void) assetmanager;
+
+  uint32_t* out_values = reinterpret_cast<uint32_t*>(out_values_ptr);
+  uint32_t* out_indices = reinterpret_cast<uint32_t*>(out_indices_ptr);
+
+  // jlong is not a pointer type on 32-bit targets, so widen the parser handles into a local
+  // pointer array before handing them to the batch resolver.
+  const jsize parser_count = env->GetArrayLength(java_xml_parsers);
+  std::vector<ResXMLParser*> xml_parsers(parser_count);
+  jlong* parser_ptrs = env->GetLongArrayElements(java_xml_parsers, nullptr);
+  if (parser_ptrs == nullptr) {
+    return;
+  }
+  for (jsize i = 0; i < parser_count; i++) {
+    xml_parsers[i] = reinterpret_cast<ResXMLParser*>(parser_ptrs[i]);
+  }
+  env->ReleaseLongArrayElements(java_xml_parsers, parser_ptrs, JNI_ABORT);
+
+  jsize attrs_len = env->GetArrayLength(java_attrs);
+  jint* attrs = reinterpret_cast<jint*>(env->GetPrimitiveArrayCritical(java_attrs, nullptr));
+  if (attrs == nullptr) {
+    return;
+  }
+
+  ApplyStyleBatch(theme, xml_parsers.data(), static_cast<size_t>(parser_count),
+                  static_cast<uint32_t>(def_style_attr), static_cast<uint32_t>(def_style_resid),
+                  reinterpret_cast<uint32_t*>(attrs), attrs_len, out_values, out_indices);
+  env->ReleasePrimitiveArrayCritical(java_attrs, attrs, JNI_ABORT);
+}
+
 static jboolean NativeResolveAttrs(JNIEnv* env, jclass /*clazz*/, jlong ptr, jlong theme_ptr,
                                    jint def_style_attr, jint def_style_resid, jintArray java_values,
                                    jintArray java_attrs, jintArray out_java_values,
@@ -1366,6 +1405,7 @@ static const JNINativeMethod gAssetManagerMethods[] = {
 
     // Style attribute related methods.
     {"nativeApplyStyle", "(JJIIJ[IJJ)V", (void*)NativeApplyStyle},
+    {"nativeApplyStyleBatch", "(JJII[J[IJJ)V", (void*)NativeApplyStyleBatch},
     {"nativeResolveAttrs", "(JJII[I[I[I[I)Z", (void*)NativeResolveAttrs},
     {"nativeRetrieveAttributes", "(JJ[I[I[I)Z", (void*)NativeRetrieveAttributes},
 
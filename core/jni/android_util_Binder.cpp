@@ -42,6 +42,7 @@
 #include <utils/Log.h>
 #include <utils/String8.h>
 #include <utils/SystemClock.h>
+#include <utils/Timers.h>
 #include <utils/threads.h>
 
 #include <nativehelper/JNIHelp.h>
@@ -296,6 +297,167 @@ static void report_exception(JNIEnv* env, jthrowable excep, const char* msg)
     }
 }
 
+// ----------------------------------------------------------------------------
+
+// Opt-in binder transaction latency instrumentation.
+//
+// When enabled, the duration of every outbound transaction (BinderProxy
+// transactNative) and inbound transaction (Binder execTransact) is recorded
+// into a per-interface histogram with exponential buckets, so main-thread
+// stalls can be attributed to a specific binder interface without a full
+// trace. The record path is lock-free: each thread stages counts for the
+// histogram it last touched and pushes them out with relaxed atomic adds, so
+// binder threads are never serialized against each other or against a dump.
+
+static std::atomic<bool> gBinderLatencyTrackingEnabled(false);
+
+// Bucket i counts transactions whose duration fell in [2^i, 2^(i+1))
+// microseconds; the last bucket absorbs everything from ~2 seconds up.
+static constexpr size_t kBinderLatencyBuckets = 22;
+
+struct BinderLatencyHistogram {
+    enum Direction {
+        OUT = 0,    // BinderProxy.transactNative
+        IN = 1,     // Binder.execTransact
+    };
+
+    BinderLatencyHistogram() {
+        for (int dir = 0; dir < 2; dir++) {
+            mCount[dir].store(0, std::memory_order_relaxed);
+            mTotalMicros[dir].store(0, std::memory_order_relaxed);
+            for (size_t i = 0; i < kBinderLatencyBuckets; i++) {
+                mBuckets[dir][i].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::atomic<uint64_t> mBuckets[2][kBinderLatencyBuckets];
+    std::atomic<uint64_t> mCount[2];
+    std::atomic<uint64_t> mTotalMicros[2];
+};
+
+static Mutex gBinderLatencyLock;
+
+// Histograms live for the life of the process so that recording threads can
+// hold bare pointers to them without any reference counting. The map itself
+// is only touched on the first tracked transaction per interface and when
+// dumping; it is protected by gBinderLatencyLock.
+static DefaultKeyedVector<String8, BinderLatencyHistogram*>
+        gBinderLatencyHistograms(NULL);
+
+static BinderLatencyHistogram* binderLatencyHistogramFor(const String8& key)
+{
+    AutoMutex _l(gBinderLatencyLock);
+    BinderLatencyHistogram* histogram = gBinderLatencyHistograms.valueFor(key);
+    if (histogram == NULL) {
+        histogram = new BinderLatencyHistogram();
+        gBinderLatencyHistograms.add(key, histogram);
+    }
+    return histogram;
+}
+
+static size_t binderLatencyBucketFor(uint64_t micros)
+{
+    size_t bucket = 0;
+    while (micros > 1 && bucket < kBinderLatencyBuckets - 1) {
+        micros >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Per-thread staging for the histogram this thread recorded into last.
+// Binder threads tend to service the same interface repeatedly, so staging
+// keeps most records free of shared-cacheline traffic; the pending counts
+// are flushed once kBinderLatencyFlushThreshold records accumulate or the
+// thread moves to a different histogram or direction. A dump can therefore
+// trail each thread's most recent few records, which is fine for profiling.
+static constexpr uint32_t kBinderLatencyFlushThreshold = 32;
+
+struct BinderLatencyStage {
+    BinderLatencyHistogram* mHistogram = NULL;
+    int mDirection = 0;
+    uint32_t mPending[kBinderLatencyBuckets] = {};
+    uint32_t mPendingCount = 0;
+    uint64_t mPendingMicros = 0;
+};
+
+static thread_local BinderLatencyStage gBinderLatencyStage;
+
+static void flushBinderLatencyStage(BinderLatencyStage* stage)
+{
+    BinderLatencyHistogram* histogram = stage->mHistogram;
+    if (histogram == NULL || stage->mPendingCount == 0) {
+        return;
+    }
+    for (size_t i = 0; i < kBinderLatencyBuckets; i++) {
+        if (stage->mPending[i] != 0) {
+            histogram->mBuckets[stage->mDirection][i].fetch_add(
+                    stage->mPending[i], std::memory_order_relaxed);
+            stage->mPending[i] = 0;
+        }
+    }
+    histogram->mCount[stage->mDirection].fetch_add(stage->mPendingCount,
+            std::memory_order_relaxed);
+    histogram->mTotalMicros[stage->mDirection].fetch_add(stage->mPendingMicros,
+            std::memory_order_relaxed);
+    stage->mPendingCount = 0;
+    stage->mPendingMicros = 0;
+}
+
+static void recordBinderLatency(BinderLatencyHistogram* histogram, int direction,
+        uint64_t micros)
+{
+    if (histogram == NULL) {
+        return;
+    }
+    BinderLatencyStage* stage = &gBinderLatencyStage;
+    if (stage->mHistogram != histogram || stage->mDirection != direction) {
+        flushBinderLatencyStage(stage);
+        stage->mHistogram = histogram;
+        stage->mDirection = direction;
+    }
+    stage->mPending[binderLatencyBucketFor(micros)]++;
+    stage->mPendingCount++;
+    stage->mPendingMicros += micros;
+    if (stage->mPendingCount >= kBinderLatencyFlushThreshold) {
+        flushBinderLatencyStage(stage);
+    }
+}
+
+static void dumpBinderLatencyHistograms(String8& out)
+{
+    static const char* const kDirectionNames[2] = { "out", "in" };
+
+    AutoMutex _l(gBinderLatencyLock);
+    for (size_t n = 0; n < gBinderLatencyHistograms.size(); n++) {
+        const String8& key = gBinderLatencyHistograms.keyAt(n);
+        const BinderLatencyHistogram* histogram = gBinderLatencyHistograms.valueAt(n);
+        for (int dir = 0; dir < 2; dir++) {
+            const uint64_t count = histogram->mCount[dir].load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            const uint64_t totalMicros =
+                    histogram->mTotalMicros[dir].load(std::memory_order_relaxed);
+            out.appendFormat("%s (%s): %" PRIu64 " calls, avg %" PRIu64 "us\n ",
+                    key.string(), kDirectionNames[dir], count, count ? totalMicros / count : 0);
+            for (size_t i = 0; i < kBinderLatencyBuckets; i++) {
+                const uint64_t bucketCount =
+                        histogram->mBuckets[dir][i].load(std::memory_order_relaxed);
+                if (bucketCount != 0) {
+                    // Label each bucket with its lower bound.
+                    out.appendFormat(" %" PRIu64 "us:%" PRIu64,
+                            static_cast<uint64_t>(1) << i, bucketCount);
+                }
+            }
+            out.append("\n");
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 class JavaBBinderHolder;
 
 class JavaBBinder : public BBinder
@@ -335,6 +497,14 @@ protected:
 
         ALOGV("onTransact() on %p calling object %p in env %p vm %p\n", this, mObject, env, mVM);
 
+        const bool trackLatency = gBinderLatencyTrackingEnabled.load(std::memory_order_relaxed);
+        BinderLatencyHistogram* latencyHistogram = NULL;
+        int64_t latencyStartNanos = 0;
+        if (trackLatency) {
+            latencyHistogram = getLatencyHistogram(env);
+            latencyStartNanos = systemTime(SYSTEM_TIME_MONOTONIC);
+        }
+
         IPCThreadState* thread_state = IPCThreadState::self();
         const int32_t strict_policy_before = thread_state->getStrictModePolicy();
 
@@ -372,6 +542,11 @@ protected:
             BBinder::onTransact(code, data, reply, flags);
         }
 
+        if (trackLatency) {
+            recordBinderLatency(latencyHistogram, BinderLatencyHistogram::IN,
+                    (systemTime(SYSTEM_TIME_MONOTONIC) - latencyStartNanos) / 1000);
+        }
+
         //aout << "onTransact to Java code; result=" << res << endl
         //    << "Transact from " << this << " to Java code returning "
         //    << reply << ": " << *reply << endl;
@@ -384,8 +559,36 @@ protected:
     }
 
 private:
+    // Returns the latency histogram for this binder, resolving it on the
+    // first tracked transaction. JavaBBinder does not know the Java-side
+    // interface descriptor, so the histogram is keyed by the name of the
+    // concrete Binder subclass, which is what a stall gets attributed to
+    // anyway. Races between threads resolve to the same registry entry.
+    BinderLatencyHistogram* getLatencyHistogram(JNIEnv* env)
+    {
+        BinderLatencyHistogram* histogram =
+                mLatencyHistogram.load(std::memory_order_relaxed);
+        if (histogram == NULL) {
+            ScopedLocalRef<jclass> clazz(env, env->GetObjectClass(mObject));
+            ScopedLocalRef<jstring> name(env,
+                    (jstring) env->CallObjectMethod(clazz.get(), gClassOffsets.mGetName));
+            ScopedUtfChars nameUtf(env, name.get());
+            if (nameUtf.c_str() == NULL) {
+                env->ExceptionClear();
+                return NULL;
+            }
+            histogram = binderLatencyHistogramFor(String8(nameUtf.c_str()));
+            mLatencyHistogram.store(histogram, std::memory_order_relaxed);
+        }
+        return histogram;
+    }
+
     JavaVM* const   mVM;
     jobject const   mObject;  // GlobalRef to Java Binder
+
+    // Latency histogram for this binder; NULL until the first transaction
+    // recorded while tracking is enabled.
+    std::atomic<BinderLatencyHistogram*> mLatencyHistogram { NULL };
 };
 
 // ----------------------------------------------------------------------------
@@ -626,6 +829,11 @@ struct BinderProxyNativeData {
     // Death recipients for mObject. Reference counted only because DeathRecipients
     // hold a weak reference that can be temporarily promoted.
     sp<DeathRecipientList> mOrgue;  // Death recipients for mObject.
+
+    // Latency histogram for this proxy's interface; NULL until the first
+    // transaction recorded while tracking is enabled. Never reset: the
+    // gNativeDataCache node is only reused if its fields were never filled in.
+    std::atomic<BinderLatencyHistogram*> mLatencyHistogram { NULL };
 };
 
 BinderProxyNativeData* getBPNativeData(JNIEnv* env, jobject obj) {
@@ -915,6 +1123,19 @@ static void android_os_Binder_blockUntilThreadAvailable(JNIEnv* env, jobject cla
     return IPCThreadState::self()->blockUntilThreadAvailable();
 }
 
+static void android_os_Binder_setTransactionLatencyTrackingEnabled(JNIEnv* env, jobject clazz,
+        jboolean enabled)
+{
+    gBinderLatencyTrackingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+static jstring android_os_Binder_getTransactionLatencyDump(JNIEnv* env, jobject clazz)
+{
+    String8 out;
+    dumpBinderLatencyHistograms(out);
+    return env->NewStringUTF(out.string());
+}
+
 // ----------------------------------------------------------------------------
 
 static const JNINativeMethod gBinderMethods[] = {
@@ -928,7 +1149,11 @@ static const JNINativeMethod gBinderMethods[] = {
     { "flushPendingCommands", "()V", (void*)android_os_Binder_flushPendingCommands },
     { "getNativeBBinderHolder", "()J", (void*)android_os_Binder_getNativeBBinderHolder },
     { "getNativeFinalizer", "()J", (void*)android_os_Binder_getNativeFinalizer },
-    { "blockUntilThreadAvailable", "()V", (void*)android_os_Binder_blockUntilThreadAvailable }
+    { "blockUntilThreadAvailable", "()V", (void*)android_os_Binder_blockUntilThreadAvailable },
+    { "setTransactionLatencyTrackingEnabled", "(Z)V",
+        (void*)android_os_Binder_setTransactionLatencyTrackingEnabled },
+    { "getTransactionLatencyDump", "()Ljava/lang/String;",
+        (void*)android_os_Binder_getTransactionLatencyDump }
 };
 
 const char* const kBinderPathName = "android/os/Binder";
@@ -1249,7 +1474,8 @@ static jboolean android_os_BinderProxy_transact(JNIEnv* env, jobject obj,
         return JNI_FALSE;
     }
 
-    IBinder* target = getBPNativeData(env, obj)->mObject.get();
+    BinderProxyNativeData* nd = getBPNativeData(env, obj);
+    IBinder* target = nd->mObject.get();
     if (target == NULL) {
         jniThrowException(env, "java/lang/IllegalStateException", "Binder has been finalized!");
         return JNI_FALSE;
@@ -1259,6 +1485,12 @@ static jboolean android_os_BinderProxy_transact(JNIEnv* env, jobject obj,
             target, obj, code);
 
 
+    const bool trackLatency = gBinderLatencyTrackingEnabled.load(std::memory_order_relaxed);
+    int64_t latencyStartNanos = 0;
+    if (trackLatency) {
+        latencyStartNanos = systemTime(SYSTEM_TIME_MONOTONIC);
+    }
+
     bool time_binder_calls;
     int64_t start_millis;
     if (kEnableBinderSample) {
@@ -1281,6 +1513,19 @@ static jboolean android_os_BinderProxy_transact(JNIEnv* env, jobject obj,
         }
     }
 
+    if (trackLatency) {
+        const uint64_t micros =
+                (systemTime(SYSTEM_TIME_MONOTONIC) - latencyStartNanos) / 1000;
+        BinderLatencyHistogram* histogram = nd->mLatencyHistogram.load(std::memory_order_relaxed);
+        if (histogram == NULL) {
+            // BpBinder caches the descriptor, so at most the first tracked
+            // transaction per proxy pays for the extra round trip.
+            histogram = binderLatencyHistogramFor(String8(target->getInterfaceDescriptor()));
+            nd->mLatencyHistogram.store(histogram, std::memory_order_relaxed);
+        }
+        recordBinderLatency(histogram, BinderLatencyHistogram::OUT, micros);
+    }
+
     if (err == NO_ERROR) {
         return JNI_TRUE;
     } else if (err == UNKNOWN_TRANSACTION) {
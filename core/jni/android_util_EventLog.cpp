@@ -14,10 +14,22 @@
  * limitations under the License.
  */
 
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <mutex>
+
 #include <android-base/macros.h>
 #include <log/log_id.h>
+#include <private/android_logger.h>
 
 #include <nativehelper/JNIHelp.h>
+#include <nativehelper/ScopedPrimitiveArray.h>
 #include "jni.h"
 
 #include "core_jni_helpers.h"
@@ -29,6 +41,191 @@ constexpr char kEventLogEventClass[] = "android/util/EventLog$Event";
 template class EventLogHelper<log_id_t::LOG_ID_EVENTS, kEventLogEventClass>;
 using ELog = EventLogHelper<log_id_t::LOG_ID_EVENTS, kEventLogEventClass>;
 
+/*
+ * Batched event writing. logd consumes one datagram per event, so a burst of
+ * writeEvent calls costs one socket syscall each. The batch path serializes
+ * events onto a dedicated logdw socket and flushes a whole burst with a
+ * single sendmmsg(), one message (header + payload iovecs) per event.
+ */
+
+// A serialized single-value event: the same wire format liblog produces for
+// android_log_event_list(tag) << (int64_t)value.
+struct BatchedLogEvent {
+    android_log_header_t header;
+    android_event_header_t tag;
+    android_event_long_t value;
+} __attribute__((__packed__));
+
+static const size_t MAX_STAGED_EVENTS = 32;
+static const jlong MAX_STAGE_AGE_MS = 10;
+
+// Per-thread staging buffer; flushed on size, on age at the next write, or
+// explicitly from the managed side.
+struct EventStagingBuffer {
+    BatchedLogEvent events[MAX_STAGED_EVENTS];
+    size_t count = 0;
+    jlong firstStagedUptimeMs = 0;
+};
+static thread_local EventStagingBuffer gStagedEvents;
+
+static std::mutex gLogdSocketLock;
+static int gLogdSocket = -1;
+
+static int get_logd_socket() {
+    std::lock_guard<std::mutex> lock(gLogdSocketLock);
+    if (gLogdSocket >= 0) {
+        return gLogdSocket;
+    }
+    int sock = TEMP_FAILURE_RETRY(
+            socket(PF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0));
+    if (sock < 0) {
+        return -errno;
+    }
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strlcpy(addr.sun_path, "/dev/socket/logdw", sizeof(addr.sun_path));
+    if (TEMP_FAILURE_RETRY(connect(sock, reinterpret_cast<struct sockaddr*>(&addr),
+                                   sizeof(addr))) < 0) {
+        int err = -errno;
+        close(sock);
+        return err;
+    }
+    gLogdSocket = sock;
+    return sock;
+}
+
+static jlong uptime_millis() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000LL;
+}
+
+static void fill_batched_event(BatchedLogEvent* event, jint tag, jlong value) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    event->header.id = LOG_ID_EVENTS;
+    event->header.tid = gettid();
+    event->header.realtime.tv_sec = ts.tv_sec;
+    event->header.realtime.tv_nsec = ts.tv_nsec;
+    event->tag.tag = tag;
+    event->value.type = EVENT_TYPE_LONG;
+    event->value.data = value;
+}
+
+// Sends `count` pre-serialized events in as few syscalls as possible.
+// Returns 0 on success or -errno.
+static int send_batched_events(const BatchedLogEvent* events, size_t count) {
+    int sock = get_logd_socket();
+    if (sock < 0) {
+        return sock;
+    }
+
+    struct mmsghdr msgs[MAX_STAGED_EVENTS];
+    struct iovec iovs[MAX_STAGED_EVENTS];
+    size_t sent = 0;
+    while (sent < count) {
+        size_t batch = std::min(count - sent, MAX_STAGED_EVENTS);
+        for (size_t i = 0; i < batch; i++) {
+            iovs[i].iov_base = const_cast<BatchedLogEvent*>(&events[sent + i]);
+            iovs[i].iov_len = sizeof(BatchedLogEvent);
+            memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        int written = TEMP_FAILURE_RETRY(sendmmsg(sock, msgs, batch, MSG_NOSIGNAL));
+        if (written < 0) {
+            return -errno;
+        }
+        sent += written;
+    }
+    return 0;
+}
+
+static int flush_staged_events() {
+    EventStagingBuffer* staged = &gStagedEvents;
+    if (staged->count == 0) {
+        return 0;
+    }
+    int result = send_batched_events(staged->events, staged->count);
+    // Logging is best effort; staged events are dropped on failure just as
+    // liblog drops an event the logd socket refuses.
+    staged->count = 0;
+    return result;
+}
+
+/*
+ * In class android.util.EventLog:
+ *  static native int writeEventBuffered(int tag, long value)
+ *
+ * Stages an event in a per-thread buffer, flushing with a single syscall
+ * once the buffer fills or the oldest staged event exceeds its age budget.
+ */
+static jint android_util_EventLog_writeEventBuffered(JNIEnv* env ATTRIBUTE_UNUSED,
+                                                     jobject clazz ATTRIBUTE_UNUSED,
+                                                     jint tag, jlong value) {
+    EventStagingBuffer* staged = &gStagedEvents;
+    if (staged->count == 0) {
+        staged->firstStagedUptimeMs = uptime_millis();
+    }
+    fill_batched_event(&staged->events[staged->count++], tag, value);
+
+    if (staged->count >= MAX_STAGED_EVENTS
+            || uptime_millis() - staged->firstStagedUptimeMs >= MAX_STAGE_AGE_MS) {
+        return flush_staged_events();
+    }
+    return 0;
+}
+
+/*
+ * In class android.util.EventLog:
+ *  static native int flushEvents()
+ *
+ * Flushes the calling thread's staging buffer.
+ */
+static jint android_util_EventLog_flushEvents(JNIEnv* env ATTRIBUTE_UNUSED,
+                                              jobject clazz ATTRIBUTE_UNUSED) {
+    return flush_staged_events();
+}
+
+/*
+ * In class android.util.EventLog:
+ *  static native int writeEventsBatch(int[] tags, long[] values)
+ *
+ * Writes tags.length single-value events with one syscall per 32 events.
+ */
+static jint android_util_EventLog_writeEventsBatch(JNIEnv* env,
+                                                   jobject clazz ATTRIBUTE_UNUSED,
+                                                   jintArray tagsArray, jlongArray valuesArray) {
+    if (tagsArray == NULL || valuesArray == NULL) {
+        jniThrowNullPointerException(env, NULL);
+        return -EINVAL;
+    }
+    ScopedIntArrayRO tags(env, tagsArray);
+    ScopedLongArrayRO values(env, valuesArray);
+    if (tags.size() != values.size()) {
+        jniThrowException(env, "java/lang/IllegalArgumentException",
+                          "tags and values must have the same length");
+        return -EINVAL;
+    }
+
+    BatchedLogEvent events[MAX_STAGED_EVENTS];
+    size_t pending = tags.size();
+    size_t done = 0;
+    while (done < pending) {
+        size_t batch = std::min(pending - done, MAX_STAGED_EVENTS);
+        for (size_t i = 0; i < batch; i++) {
+            fill_batched_event(&events[i], tags[done + i], values[done + i]);
+        }
+        int result = send_batched_events(events, batch);
+        if (result < 0) {
+            return result;
+        }
+        done += batch;
+    }
+    return 0;
+}
+
 /*
  * In class android.util.EventLog:
  *  static native void readEvents(int[] tags, Collection<Event> output)
@@ -74,6 +271,9 @@ static const JNINativeMethod gRegisterMethods[] = {
     { "writeEvent", "(IF)I", (void*) ELog::writeEventFloat },
     { "writeEvent", "(ILjava/lang/String;)I", (void*) ELog::writeEventString },
     { "writeEvent", "(I[Ljava/lang/Object;)I", (void*) ELog::writeEventArray },
+    { "writeEventBuffered", "(IJ)I", (void*) android_util_EventLog_writeEventBuffered },
+    { "writeEventsBatch", "([I[J)I", (void*) android_util_EventLog_writeEventsBatch },
+    { "flushEvents", "()I", (void*) android_util_EventLog_flushEvents },
     { "readEvents",
       "([ILjava/util/Collection;)V",
       (void*) android_util_EventLog_readEvents
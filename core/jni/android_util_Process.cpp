@@ -31,6 +31,7 @@
 
 #include "android_util_Binder.h"
 #include <nativehelper/JNIHelp.h>
+#include <nativehelper/ScopedLocalRef.h>
 #include "android_os_Debug.h"
 
 #include <dirent.h>
@@ -45,6 +46,10 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #define GUARD_THREAD_PRIORITY 0
 
 using namespace android;
@@ -663,6 +668,86 @@ static jlong android_os_Process_getTotalMemory(JNIEnv* env, jobject clazz)
     return getFreeMemoryImpl(sums, sumsLen, 1);
 }
 
+/*
+ * Pollers re-read the same small /proc files over and over; opening and
+ * closing them each time costs two syscalls and a dentry walk per read.
+ * Descriptors for /proc files are kept open in a capped LRU cache and
+ * re-read with pread() from offset zero, which always yields fresh data.
+ * A descriptor for an exited process fails the pread; it is dropped and
+ * the path opened again so pid reuse is handled like a cold read.
+ */
+struct CachedProcFile {
+    int fd;
+    uint64_t lastUsed;
+};
+
+static std::mutex gProcFdCacheLock;
+static std::unordered_map<std::string, CachedProcFile> gProcFdCache;
+static uint64_t gProcFdCacheTick = 0;
+static const size_t PROC_FD_CACHE_MAX_ENTRIES = 256;
+
+// Reads the whole file into buffer, NUL-terminating it. Returns the number
+// of bytes read, or -1 when the file cannot be opened or read. The lock is
+// held across the pread so an eviction cannot close the descriptor mid-read;
+// these reads are one short copy out of the kernel.
+static ssize_t read_cached_proc_file(const char* path, char* buffer, size_t bufferSize) {
+    std::lock_guard<std::mutex> lock(gProcFdCacheLock);
+
+    auto it = gProcFdCache.find(path);
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (it == gProcFdCache.end()) {
+            int fd = open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return -1;
+            }
+            if (gProcFdCache.size() >= PROC_FD_CACHE_MAX_ENTRIES) {
+                auto oldest = gProcFdCache.begin();
+                for (auto candidate = gProcFdCache.begin(); candidate != gProcFdCache.end();
+                        ++candidate) {
+                    if (candidate->second.lastUsed < oldest->second.lastUsed) {
+                        oldest = candidate;
+                    }
+                }
+                close(oldest->second.fd);
+                gProcFdCache.erase(oldest);
+            }
+            it = gProcFdCache.emplace(path, CachedProcFile{fd, 0}).first;
+        }
+        it->second.lastUsed = ++gProcFdCacheTick;
+
+        ssize_t len = TEMP_FAILURE_RETRY(pread(it->second.fd, buffer, bufferSize - 1, 0));
+        if (len >= 0) {
+            buffer[len] = 0;
+            return len;
+        }
+
+        // The process behind the descriptor is likely gone; retry cold.
+        close(it->second.fd);
+        gProcFdCache.erase(it);
+        it = gProcFdCache.end();
+    }
+    return -1;
+}
+
+// Reads a file into buffer, caching the descriptor for files under /proc.
+static ssize_t read_proc_file_contents(const char* path, char* buffer, size_t bufferSize) {
+    if (strncmp(path, "/proc/", 6) == 0) {
+        return read_cached_proc_file(path, buffer, bufferSize);
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    ssize_t len = TEMP_FAILURE_RETRY(read(fd, buffer, bufferSize - 1));
+    close(fd);
+    if (len < 0) {
+        return -1;
+    }
+    buffer[len] = 0;
+    return len;
+}
+
 void android_os_Process_readProcLines(JNIEnv* env, jobject clazz, jstring fileStr,
                                       jobjectArray reqFields, jlongArray outFields)
 {
@@ -716,20 +801,11 @@ void android_os_Process_readProcLines(JNIEnv* env, jobject clazz, jstring fileSt
         sizesArray[i] = 0;
     }
 
-    int fd = open(file.string(), O_RDONLY | O_CLOEXEC);
-
-    if (fd >= 0) {
-        const size_t BUFFER_SIZE = 4096;
-        char* buffer = (char*)malloc(BUFFER_SIZE);
-        int len = read(fd, buffer, BUFFER_SIZE-1);
-        close(fd);
-
-        if (len < 0) {
-            ALOGW("Unable to read %s", file.string());
-            len = 0;
-        }
-        buffer[len] = 0;
+    const size_t BUFFER_SIZE = 4096;
+    char* buffer = (char*)malloc(BUFFER_SIZE);
+    ssize_t len = read_proc_file_contents(file.string(), buffer, BUFFER_SIZE);
 
+    if (len >= 0) {
         int foundCount = 0;
 
         char* p = buffer;
@@ -764,11 +840,10 @@ void android_os_Process_readProcLines(JNIEnv* env, jobject clazz, jstring fileSt
                 }
             }
         }
-
-        free(buffer);
     } else {
-        ALOGW("Unable to open %s", file.string());
+        ALOGW("Unable to read %s", file.string());
     }
+    free(buffer);
 
     //ALOGI("Done!");
     env->ReleaseLongArrayElements(outFields, sizesArray, 0);
@@ -1023,34 +1098,89 @@ jboolean android_os_Process_readProcFile(JNIEnv* env, jobject clazz,
         jniThrowException(env, "java/lang/OutOfMemoryError", NULL);
         return JNI_FALSE;
     }
-    int fd = open(file8, O_RDONLY | O_CLOEXEC);
-
-    if (fd < 0) {
-        if (kDebugProc) {
-            ALOGW("Unable to open process file: %s\n", file8);
-        }
-        env->ReleaseStringUTFChars(file, file8);
-        return JNI_FALSE;
-    }
-    env->ReleaseStringUTFChars(file, file8);
 
     char buffer[256];
-    const int len = read(fd, buffer, sizeof(buffer)-1);
-    close(fd);
+    const ssize_t len = read_proc_file_contents(file8, buffer, sizeof(buffer));
 
     if (len < 0) {
         if (kDebugProc) {
-            ALOGW("Unable to open process file: %s fd=%d\n", file8, fd);
+            ALOGW("Unable to read process file: %s\n", file8);
         }
+        env->ReleaseStringUTFChars(file, file8);
         return JNI_FALSE;
     }
-    buffer[len] = 0;
+    env->ReleaseStringUTFChars(file, file8);
 
     return android_os_Process_parseProcLineArray(env, clazz, buffer, 0, len,
             format, outStrings, outLongs, outFloats);
 
 }
 
+/*
+ * Batch form of readProcFile: reads and parses every requested file with a
+ * shared format in one native call, so a poll over hundreds of processes
+ * costs one JNI transition instead of one per pid. Per-file long and float
+ * rows are filled in place; string output is not supported on this path.
+ * Returns a per-file success mask.
+ */
+jbooleanArray android_os_Process_readProcFilesBatch(JNIEnv* env, jobject clazz,
+        jobjectArray files, jintArray format, jobjectArray outLongsRows,
+        jobjectArray outFloatsRows)
+{
+    if (files == NULL || format == NULL) {
+        jniThrowNullPointerException(env, NULL);
+        return NULL;
+    }
+
+    const jsize count = env->GetArrayLength(files);
+    if ((outLongsRows != NULL && env->GetArrayLength(outLongsRows) < count)
+            || (outFloatsRows != NULL && env->GetArrayLength(outFloatsRows) < count)) {
+        jniThrowException(env, "java/lang/IllegalArgumentException", "Array lengths differ");
+        return NULL;
+    }
+
+    jbooleanArray resultArray = env->NewBooleanArray(count);
+    if (resultArray == NULL) {
+        jniThrowException(env, "java/lang/OutOfMemoryError", NULL);
+        return NULL;
+    }
+
+    for (jsize i = 0; i < count; i++) {
+        ScopedLocalRef<jstring> fileStr(env,
+                (jstring) env->GetObjectArrayElement(files, i));
+        if (fileStr.get() == NULL) {
+            jniThrowNullPointerException(env, "Element in files");
+            return NULL;
+        }
+        const char* file8 = env->GetStringUTFChars(fileStr.get(), NULL);
+        if (file8 == NULL) {
+            jniThrowException(env, "java/lang/OutOfMemoryError", NULL);
+            return NULL;
+        }
+
+        char buffer[256];
+        const ssize_t len = read_proc_file_contents(file8, buffer, sizeof(buffer));
+        env->ReleaseStringUTFChars(fileStr.get(), file8);
+        if (len < 0) {
+            continue;
+        }
+
+        ScopedLocalRef<jlongArray> outLongs(env, outLongsRows != NULL
+                ? (jlongArray) env->GetObjectArrayElement(outLongsRows, i) : NULL);
+        ScopedLocalRef<jfloatArray> outFloats(env, outFloatsRows != NULL
+                ? (jfloatArray) env->GetObjectArrayElement(outFloatsRows, i) : NULL);
+
+        jboolean parsed = android_os_Process_parseProcLineArray(env, clazz, buffer, 0, len,
+                format, NULL, outLongs.get(), outFloats.get());
+        if (env->ExceptionCheck()) {
+            return NULL;
+        }
+        env->SetBooleanArrayRegion(resultArray, i, 1, &parsed);
+    }
+
+    return resultArray;
+}
+
 void android_os_Process_setApplicationObject(JNIEnv* env, jobject clazz,
                                              jobject binderObject)
 {
@@ -1234,6 +1364,7 @@ static const JNINativeMethod methods[] = {
     {"readProcLines", "(Ljava/lang/String;[Ljava/lang/String;[J)V", (void*)android_os_Process_readProcLines},
     {"getPids", "(Ljava/lang/String;[I)[I", (void*)android_os_Process_getPids},
     {"readProcFile", "(Ljava/lang/String;[I[Ljava/lang/String;[J[F)Z", (void*)android_os_Process_readProcFile},
+    {"readProcFilesBatch", "([Ljava/lang/String;[I[[J[[F)[Z", (void*)android_os_Process_readProcFilesBatch},
     {"parseProcLine", "([BII[I[Ljava/lang/String;[J[F)Z", (void*)android_os_Process_parseProcLine},
     {"getElapsedCpuTime", "()J", (void*)android_os_Process_getElapsedCpuTime},
     {"getPss", "(I)J", (void*)android_os_Process_getPss},
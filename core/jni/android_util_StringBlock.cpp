@@ -25,12 +25,47 @@
 
 #include <androidfw/ResourceTypes.h>
 
+#include "android_util_StringBlock.h"
+
 #include <stdio.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace android {
 
 // ----------------------------------------------------------------------------
 
+/*
+ * Intern table of Java strings per string pool, keyed by pool index. Layout
+ * inflation fetches the same handful of pool entries over and over; handing
+ * back the previously created jstring through a weak global reference avoids
+ * re-allocating an identical String on every access, while still letting the
+ * GC reclaim strings nobody holds. Entries are purged when the pool is
+ * destroyed, either by StringBlock itself or by the XmlBlock whose tree owns
+ * the pool.
+ */
+typedef std::unordered_map<uint32_t, jweak> PoolInternTable;
+
+static std::mutex gInternLock;
+static std::unordered_map<const ResStringPool*, PoolInternTable> gInternTables;
+
+void android_content_StringBlock_purgeStrings(JNIEnv* env, const ResStringPool* pool) {
+    PoolInternTable table;
+    {
+        std::lock_guard<std::mutex> lock(gInternLock);
+        auto it = gInternTables.find(pool);
+        if (it == gInternTables.end()) {
+            return;
+        }
+        table = std::move(it->second);
+        gInternTables.erase(it);
+    }
+    for (const auto& entry : table) {
+        env->DeleteWeakGlobalRef(entry.second);
+    }
+}
+
 static jlong android_content_StringBlock_nativeCreate(JNIEnv* env, jobject clazz,
                                                   jbyteArray bArray,
                                                   jint off, jint len)
@@ -80,19 +115,40 @@ static jstring android_content_StringBlock_nativeGetString(JNIEnv* env, jobject
         return 0;
     }
 
+    std::lock_guard<std::mutex> lock(gInternLock);
+    PoolInternTable& table = gInternTables[osb];
+    auto it = table.find(idx);
+    if (it != table.end()) {
+        jstring cached = jstring(env->NewLocalRef(it->second));
+        if (cached != NULL) {
+            return cached;
+        }
+        // The interned string was collected; drop the dead reference.
+        env->DeleteWeakGlobalRef(it->second);
+        table.erase(it);
+    }
+
+    jstring created;
     size_t len;
     const char* str8 = osb->string8At(idx, &len);
     if (str8 != NULL) {
-        return env->NewStringUTF(str8);
+        created = env->NewStringUTF(str8);
+    } else {
+        const char16_t* str = osb->stringAt(idx, &len);
+        if (str == NULL) {
+            jniThrowException(env, "java/lang/IndexOutOfBoundsException", NULL);
+            return 0;
+        }
+        created = env->NewString((const jchar*)str, len);
     }
 
-    const char16_t* str = osb->stringAt(idx, &len);
-    if (str == NULL) {
-        jniThrowException(env, "java/lang/IndexOutOfBoundsException", NULL);
-        return 0;
+    if (created != NULL) {
+        jweak ref = env->NewWeakGlobalRef(created);
+        if (ref != NULL) {
+            table.emplace(idx, ref);
+        }
     }
-
-    return env->NewString((const jchar*)str, len);
+    return created;
 }
 
 static jintArray android_content_StringBlock_nativeGetStyle(JNIEnv* env, jobject clazz,
@@ -147,6 +203,7 @@ static void android_content_StringBlock_nativeDestroy(JNIEnv* env, jobject clazz
         return;
     }
 
+    android_content_StringBlock_purgeStrings(env, osb);
     delete osb;
 }
 
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ANDROID_UTIL_STRINGBLOCK_H
+#define _ANDROID_UTIL_STRINGBLOCK_H
+
+#include "jni.h"
+
+namespace android {
+
+class ResStringPool;
+
+// Drops the interned Java strings of a string pool that is about to be
+// freed. Must be called by whoever owns the pool's storage; XmlBlock calls
+// it for the pool embedded in its ResXMLTree.
+void android_content_StringBlock_purgeStrings(JNIEnv* env, const ResStringPool* pool);
+
+} // namespace android
+
+#endif // _ANDROID_UTIL_STRINGBLOCK_H
@@ -25,6 +25,8 @@
 #include <utils/Log.h>
 #include <utils/misc.h>
 
+#include "android_util_StringBlock.h"
+
 #include <stdio.h>
 
 namespace android {
@@ -356,6 +358,9 @@ static void android_content_XmlBlock_nativeDestroy(JNIEnv* env, jobject clazz,
         return;
     }
 
+    // The tree owns the string pool handed out by nativeGetStringBlock;
+    // drop any strings interned against it before it goes away.
+    android_content_StringBlock_purgeStrings(env, &osb->getStrings());
     delete osb;
 }
 
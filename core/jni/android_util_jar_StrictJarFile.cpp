@@ -17,8 +17,17 @@
 
 #define LOG_TAG "StrictJarFile"
 
+#include <inttypes.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include <log/log.h>
 
@@ -156,11 +165,110 @@ static void StrictJarFile_nativeClose(JNIEnv*, jobject, jlong nativeHandle) {
   CloseArchive(reinterpret_cast<ZipArchiveHandle>(nativeHandle));
 }
 
+// Archives whose entry payloads have already checked out against their
+// stored CRCs, keyed by the identity and version of the backing file so an
+// unchanged file is never re-verified. dev/ino pin the file, mtime and size
+// catch rewrites in place.
+static std::mutex gVerifiedArchivesLock;
+static std::unordered_set<std::string> gVerifiedArchives;
+
+static bool archiveCacheKey(ZipArchiveHandle handle, std::string* outKey) {
+  struct stat sb;
+  if (fstat(GetFileDescriptor(handle), &sb) != 0) {
+    return false;
+  }
+  char buf[128];
+  snprintf(buf, sizeof(buf), "%" PRIu64 ":%" PRIu64 ":%" PRId64 ".%09ld:%" PRId64,
+           static_cast<uint64_t>(sb.st_dev), static_cast<uint64_t>(sb.st_ino),
+           static_cast<int64_t>(sb.st_mtim.tv_sec), sb.st_mtim.tv_nsec,
+           static_cast<int64_t>(sb.st_size));
+  *outKey = buf;
+  return true;
+}
+
+// Inflates every claimed entry and lets libziparchive compare the payload
+// against the central directory CRC. Entries are fanned across worker
+// threads with the caller participating; extraction only does pread() style
+// reads on the archive mapping, so concurrent workers are safe.
+static bool verifyArchiveEntries(ZipArchiveHandle handle) {
+  std::vector<ZipEntry> entries;
+  {
+    void* cookie = NULL;
+    if (StartIteration(handle, &cookie, NULL, NULL) != 0) {
+      return false;
+    }
+    ZipEntry entry;
+    ZipString name;
+    int32_t error;
+    while ((error = Next(cookie, &entry, &name)) == 0) {
+      if (entry.uncompressed_length > 0) {
+        entries.push_back(entry);
+      }
+    }
+    EndIteration(cookie);
+    if (error != -1) {  // -1 is end-of-iteration.
+      return false;
+    }
+  }
+
+  std::atomic<size_t> nextIndex(0);
+  std::atomic<bool> failed(false);
+  auto verifyEntries = [&] {
+    std::vector<uint8_t> buffer;
+    while (!failed.load(std::memory_order_relaxed)) {
+      size_t i = nextIndex.fetch_add(1, std::memory_order_relaxed);
+      if (i >= entries.size()) {
+        break;
+      }
+      buffer.resize(entries[i].uncompressed_length);
+      if (ExtractToMemory(handle, &entries[i], buffer.data(), buffer.size()) != 0) {
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  const unsigned int threadCount =
+      std::min(4u, std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::thread> workers;
+  for (unsigned int i = 1; i < threadCount; i++) {
+    workers.emplace_back(verifyEntries);
+  }
+  verifyEntries();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  return !failed.load(std::memory_order_relaxed);
+}
+
+static jboolean StrictJarFile_nativeVerifyEntries(JNIEnv* env, jobject, jlong nativeHandle) {
+  ZipArchiveHandle handle = reinterpret_cast<ZipArchiveHandle>(nativeHandle);
+
+  std::string key;
+  const bool haveKey = archiveCacheKey(handle, &key);
+  if (haveKey) {
+    std::lock_guard<std::mutex> lock(gVerifiedArchivesLock);
+    if (gVerifiedArchives.count(key) != 0) {
+      return JNI_TRUE;
+    }
+  }
+
+  if (!verifyArchiveEntries(handle)) {
+    return JNI_FALSE;
+  }
+
+  if (haveKey) {
+    std::lock_guard<std::mutex> lock(gVerifiedArchivesLock);
+    gVerifiedArchives.insert(key);
+  }
+  return JNI_TRUE;
+}
+
 static JNINativeMethod gMethods[] = {
   NATIVE_METHOD(StrictJarFile, nativeOpenJarFile, "(Ljava/lang/String;I)J"),
   NATIVE_METHOD(StrictJarFile, nativeStartIteration, "(JLjava/lang/String;)J"),
   NATIVE_METHOD(StrictJarFile, nativeNextEntry, "(J)Ljava/util/zip/ZipEntry;"),
   NATIVE_METHOD(StrictJarFile, nativeFindEntry, "(JLjava/lang/String;)Ljava/util/zip/ZipEntry;"),
+  NATIVE_METHOD(StrictJarFile, nativeVerifyEntries, "(J)Z"),
   NATIVE_METHOD(StrictJarFile, nativeClose, "(J)V"),
 };
 
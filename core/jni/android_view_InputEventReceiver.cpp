@@ -20,6 +20,8 @@
 
 #include <inttypes.h>
 
+#include <vector>
+
 #include <nativehelper/JNIHelp.h>
 
 #include <android_runtime/AndroidRuntime.h>
@@ -46,8 +48,15 @@ static struct {
 
     jmethodID dispatchInputEvent;
     jmethodID dispatchBatchedInputEventPending;
+    jmethodID dispatchBatchedInputEvents; // optional, may be NULL
 } gInputEventReceiverClassInfo;
 
+static jclass gInputEventClass;
+
+// Upper bound on events marshalled into one dispatchBatchedInputEvents
+// upcall, chosen to keep the number of outstanding local references sane.
+static const size_t MAX_EVENTS_PER_BATCH = 128;
+
 
 class NativeInputEventReceiver : public LooperCallback {
 public:
@@ -70,6 +79,15 @@ private:
         bool handled;
     };
 
+    struct PendingBatch {
+        std::vector<jint> seqs;
+        std::vector<jobject> eventObjs;
+        std::vector<jint> displayIds;
+
+        bool empty() const { return seqs.empty(); }
+        size_t size() const { return seqs.size(); }
+    };
+
     jobject mReceiverWeakGlobal;
     InputConsumer mInputConsumer;
     sp<MessageQueue> mMessageQueue;
@@ -79,6 +97,8 @@ private:
     Vector<Finish> mFinishQueue;
 
     void setFdEvents(int events);
+    bool dispatchEventBatch(JNIEnv* env, jobject receiverObj, PendingBatch* batch);
+    static void dropEventBatch(JNIEnv* env, PendingBatch* batch);
 
     const std::string getInputChannelName() {
         return mInputConsumer.getChannel()->getName();
@@ -216,6 +236,68 @@ int NativeInputEventReceiver::handleEvent(int receiveFd, int events, void* data)
     return 1;
 }
 
+// Hands all marshalled events to the receiver in a single upcall. The
+// receiver owns every seq it is given and must finish each of them even if
+// it fails part way through the batch. Returns false when the upcall threw.
+bool NativeInputEventReceiver::dispatchEventBatch(JNIEnv* env, jobject receiverObj,
+        PendingBatch* batch) {
+    if (batch->empty()) {
+        return true;
+    }
+
+    const jsize count = static_cast<jsize>(batch->size());
+    ScopedLocalRef<jintArray> seqArray(env, env->NewIntArray(count));
+    ScopedLocalRef<jobjectArray> eventArray(env,
+            env->NewObjectArray(count, gInputEventClass, NULL));
+    ScopedLocalRef<jintArray> displayIdArray(env, env->NewIntArray(count));
+    if (!seqArray.get() || !eventArray.get() || !displayIdArray.get()) {
+        ALOGE("Failed to allocate input event batch arrays.");
+        for (jint seq : batch->seqs) {
+            mInputConsumer.sendFinishedSignal(seq, false);
+        }
+        dropEventBatch(env, batch);
+        return false;
+    }
+
+    env->SetIntArrayRegion(seqArray.get(), 0, count, batch->seqs.data());
+    env->SetIntArrayRegion(displayIdArray.get(), 0, count, batch->displayIds.data());
+    for (jsize i = 0; i < count; i++) {
+        env->SetObjectArrayElement(eventArray.get(), i, batch->eventObjs[i]);
+        env->DeleteLocalRef(batch->eventObjs[i]);
+        batch->eventObjs[i] = NULL;
+    }
+
+    if (kDebugDispatchCycle) {
+        ALOGD("channel '%s' ~ Dispatching batch of %d input events.",
+                getInputChannelName().c_str(), count);
+    }
+    env->CallVoidMethod(receiverObj, gInputEventReceiverClassInfo.dispatchBatchedInputEvents,
+            seqArray.get(), eventArray.get(), displayIdArray.get(), count);
+
+    batch->seqs.clear();
+    batch->eventObjs.clear();
+    batch->displayIds.clear();
+
+    if (env->ExceptionCheck()) {
+        ALOGE("Exception dispatching batched input events.");
+        return false;
+    }
+    return true;
+}
+
+// Discards marshalled events without dispatching them; their finished
+// signals are sent by the caller.
+void NativeInputEventReceiver::dropEventBatch(JNIEnv* env, PendingBatch* batch) {
+    for (jobject eventObj : batch->eventObjs) {
+        if (eventObj) {
+            env->DeleteLocalRef(eventObj);
+        }
+    }
+    batch->seqs.clear();
+    batch->eventObjs.clear();
+    batch->displayIds.clear();
+}
+
 status_t NativeInputEventReceiver::consumeEvents(JNIEnv* env,
         bool consumeBatches, nsecs_t frameTime, bool* outConsumedBatch) {
     if (kDebugDispatchCycle) {
@@ -231,6 +313,13 @@ status_t NativeInputEventReceiver::consumeEvents(JNIEnv* env,
         *outConsumedBatch = false;
     }
 
+    // Frame-time consumption drains every event that became consumable for
+    // this frame; marshalling them into one upcall avoids a JNI transition
+    // per event. Ahead-of-frame delivery keeps the per-event path.
+    const bool batchDispatch = consumeBatches
+            && gInputEventReceiverClassInfo.dispatchBatchedInputEvents != NULL;
+    PendingBatch batch;
+
     ScopedLocalRef<jobject> receiverObj(env, NULL);
     bool skipCallbacks = false;
     for (;;) {
@@ -241,6 +330,10 @@ status_t NativeInputEventReceiver::consumeEvents(JNIEnv* env,
                 consumeBatches, frameTime, &seq, &inputEvent, &displayId);
         if (status) {
             if (status == WOULD_BLOCK) {
+                if (!batch.empty()
+                        && !dispatchEventBatch(env, receiverObj.get(), &batch)) {
+                    skipCallbacks = true;
+                }
                 if (!skipCallbacks && !mBatchedInputEventPending
                         && mInputConsumer.hasPendingBatch()) {
                     // There is a pending batch.  Come back later.
@@ -267,6 +360,9 @@ status_t NativeInputEventReceiver::consumeEvents(JNIEnv* env,
                 }
                 return OK;
             }
+            if (!batch.empty()) {
+                dispatchEventBatch(env, receiverObj.get(), &batch);
+            }
             ALOGE("channel '%s' ~ Failed to consume input event.  status=%d",
                     getInputChannelName().c_str(), status);
             return status;
@@ -311,17 +407,28 @@ status_t NativeInputEventReceiver::consumeEvents(JNIEnv* env,
             }
 
             if (inputEventObj) {
-                if (kDebugDispatchCycle) {
-                    ALOGD("channel '%s' ~ Dispatching input event.", getInputChannelName().c_str());
-                }
-                env->CallVoidMethod(receiverObj.get(),
-                        gInputEventReceiverClassInfo.dispatchInputEvent, seq, inputEventObj,
-                        displayId);
-                if (env->ExceptionCheck()) {
-                    ALOGE("Exception dispatching input event.");
-                    skipCallbacks = true;
+                if (batchDispatch) {
+                    batch.seqs.push_back(static_cast<jint>(seq));
+                    batch.eventObjs.push_back(inputEventObj);
+                    batch.displayIds.push_back(displayId);
+                    if (batch.size() >= MAX_EVENTS_PER_BATCH
+                            && !dispatchEventBatch(env, receiverObj.get(), &batch)) {
+                        skipCallbacks = true;
+                    }
+                } else {
+                    if (kDebugDispatchCycle) {
+                        ALOGD("channel '%s' ~ Dispatching input event.",
+                                getInputChannelName().c_str());
+                    }
+                    env->CallVoidMethod(receiverObj.get(),
+                            gInputEventReceiverClassInfo.dispatchInputEvent, seq, inputEventObj,
+                            displayId);
+                    if (env->ExceptionCheck()) {
+                        ALOGE("Exception dispatching input event.");
+                        skipCallbacks = true;
+                    }
+                    env->DeleteLocalRef(inputEventObj);
                 }
-                env->DeleteLocalRef(inputEventObj);
             } else {
                 ALOGW("channel '%s' ~ Failed to obtain event object.",
                         getInputChannelName().c_str());
@@ -427,6 +534,17 @@ int register_android_view_InputEventReceiver(JNIEnv* env) {
     gInputEventReceiverClassInfo.dispatchBatchedInputEventPending = GetMethodIDOrDie(env,
             gInputEventReceiverClassInfo.clazz, "dispatchBatchedInputEventPending", "()V");
 
+    // Optional; receivers without a batch entry point get per-event dispatch.
+    gInputEventReceiverClassInfo.dispatchBatchedInputEvents = env->GetMethodID(
+            gInputEventReceiverClassInfo.clazz, "dispatchBatchedInputEvents",
+            "([I[Landroid/view/InputEvent;[II)V");
+    if (gInputEventReceiverClassInfo.dispatchBatchedInputEvents == NULL) {
+        env->ExceptionClear();
+    }
+
+    jclass inputEventClazz = FindClassOrDie(env, "android/view/InputEvent");
+    gInputEventClass = MakeGlobalRefOrDie(env, inputEventClazz);
+
     return res;
 }
 
@@ -31,10 +31,47 @@
 
 #include "core_jni_helpers.h"
 
+#include <mutex>
+#include <vector>
+
 namespace android {
 
 // ----------------------------------------------------------------------------
 
+// Freelist of native MotionEvents. The Java object pool already reuses the
+// native event attached to a pooled Java event, but once the Java pool
+// overflows (steady 240Hz stylus input easily outruns it) every obtain paid a
+// fresh allocation here. A recycled native event keeps the heap capacity of
+// its sample vectors, so reuse also avoids regrowing them.
+static std::mutex gMotionEventPoolLock;
+static std::vector<MotionEvent*> gMotionEventPool;
+static const size_t kMotionEventPoolMaxSize = 16;
+
+static MotionEvent* obtainMotionEvent() {
+    {
+        std::lock_guard<std::mutex> lock(gMotionEventPoolLock);
+        if (!gMotionEventPool.empty()) {
+            MotionEvent* event = gMotionEventPool.back();
+            gMotionEventPool.pop_back();
+            return event;
+        }
+    }
+    return new MotionEvent();
+}
+
+static void releaseMotionEvent(MotionEvent* event) {
+    if (event) {
+        std::lock_guard<std::mutex> lock(gMotionEventPoolLock);
+        if (gMotionEventPool.size() < kMotionEventPoolMaxSize) {
+            gMotionEventPool.push_back(event);
+            return;
+        }
+    }
+    delete event;
+}
+
+// ----------------------------------------------------------------------------
+
 static struct {
     jclass clazz;
 
@@ -91,7 +128,7 @@ jobject android_view_MotionEvent_obtainAsCopy(JNIEnv* env, const MotionEvent* ev
 
     MotionEvent* destEvent = android_view_MotionEvent_getNativePtr(env, eventObj);
     if (!destEvent) {
-        destEvent = new MotionEvent();
+        destEvent = obtainMotionEvent();
         android_view_MotionEvent_setNativePtr(env, eventObj, destEvent);
     }
 
@@ -349,7 +386,7 @@ static jlong android_view_MotionEvent_nativeInitialize(JNIEnv* env, jclass clazz
     if (nativePtr) {
         event = reinterpret_cast<MotionEvent*>(nativePtr);
     } else {
-        event = new MotionEvent();
+        event = obtainMotionEvent();
     }
 
     PointerProperties pointerProperties[pointerCount];
@@ -380,7 +417,7 @@ static jlong android_view_MotionEvent_nativeInitialize(JNIEnv* env, jclass clazz
 
 Error:
     if (!nativePtr) {
-        delete event;
+        releaseMotionEvent(event);
     }
     return 0;
 }
@@ -388,7 +425,7 @@ Error:
 static void android_view_MotionEvent_nativeDispose(JNIEnv* env, jclass clazz,
         jlong nativePtr) {
     MotionEvent* event = reinterpret_cast<MotionEvent*>(nativePtr);
-    delete event;
+    releaseMotionEvent(event);
 }
 
 static void android_view_MotionEvent_nativeAddBatch(JNIEnv* env, jclass clazz,
@@ -457,7 +494,7 @@ static jlong android_view_MotionEvent_nativeReadFromParcel(JNIEnv* env, jclass c
         jlong nativePtr, jobject parcelObj) {
     MotionEvent* event = reinterpret_cast<MotionEvent*>(nativePtr);
     if (!event) {
-        event = new MotionEvent();
+        event = obtainMotionEvent();
     }
 
     Parcel* parcel = parcelForJavaObject(env, parcelObj);
@@ -465,7 +502,7 @@ static jlong android_view_MotionEvent_nativeReadFromParcel(JNIEnv* env, jclass c
     status_t status = event->readFromParcel(parcel);
     if (status) {
         if (!nativePtr) {
-            delete event;
+            releaseMotionEvent(event);
         }
         jniThrowRuntimeException(env, "Failed to read MotionEvent parcel.");
         return 0;
@@ -570,13 +607,61 @@ static jfloat android_view_MotionEvent_nativeGetAxisValue(JNIEnv* env, jclass cl
     }
 }
 
+static jint android_view_MotionEvent_nativeGetAxisValues(JNIEnv* env, jclass clazz,
+        jlong nativePtr, jint axis, jint pointerIndex,
+        jfloatArray outValuesArray, jlongArray outEventTimesArray) {
+    MotionEvent* event = reinterpret_cast<MotionEvent*>(nativePtr);
+    size_t pointerCount = event->getPointerCount();
+    if (!validatePointerIndex(env, pointerIndex, pointerCount)) {
+        return 0;
+    }
+    if (!outValuesArray) {
+        jniThrowNullPointerException(env, "outValues");
+        return 0;
+    }
+
+    // Historical samples in order, oldest first, followed by the current sample.
+    size_t historySize = event->getHistorySize();
+    size_t sampleCount = historySize + 1;
+    if (size_t(env->GetArrayLength(outValuesArray)) < sampleCount) {
+        jniThrowException(env, "java/lang/IllegalArgumentException",
+                "outValues array must be large enough to hold all samples");
+        return 0;
+    }
+    if (outEventTimesArray
+            && size_t(env->GetArrayLength(outEventTimesArray)) < sampleCount) {
+        jniThrowException(env, "java/lang/IllegalArgumentException",
+                "outEventTimes array must be large enough to hold all samples");
+        return 0;
+    }
+
+    jfloat* outValues = static_cast<jfloat*>(
+            env->GetPrimitiveArrayCritical(outValuesArray, NULL));
+    for (size_t h = 0; h < historySize; h++) {
+        outValues[h] = event->getHistoricalAxisValue(axis, pointerIndex, h);
+    }
+    outValues[historySize] = event->getAxisValue(axis, pointerIndex);
+    env->ReleasePrimitiveArrayCritical(outValuesArray, outValues, 0);
+
+    if (outEventTimesArray) {
+        jlong* outEventTimes = static_cast<jlong*>(
+                env->GetPrimitiveArrayCritical(outEventTimesArray, NULL));
+        for (size_t h = 0; h < historySize; h++) {
+            outEventTimes[h] = event->getHistoricalEventTime(h);
+        }
+        outEventTimes[historySize] = event->getEventTime();
+        env->ReleasePrimitiveArrayCritical(outEventTimesArray, outEventTimes, 0);
+    }
+    return jint(sampleCount);
+}
+
 // ----------------- @CriticalNative ------------------------------
 
 static jlong android_view_MotionEvent_nativeCopy(jlong destNativePtr, jlong sourceNativePtr,
         jboolean keepHistory) {
     MotionEvent* destEvent = reinterpret_cast<MotionEvent*>(destNativePtr);
     if (!destEvent) {
-        destEvent = new MotionEvent();
+        destEvent = obtainMotionEvent();
     }
     MotionEvent* sourceEvent = reinterpret_cast<MotionEvent*>(sourceNativePtr);
     destEvent->copyFrom(sourceEvent, keepHistory);
@@ -779,6 +864,9 @@ static const JNINativeMethod gMotionEventMethods[] = {
     { "nativeGetAxisValue",
             "(JIII)F",
             (void*)android_view_MotionEvent_nativeGetAxisValue },
+    { "nativeGetAxisValues",
+            "(JII[F[J)I",
+            (void*)android_view_MotionEvent_nativeGetAxisValues },
 
     // --------------- @CriticalNative ------------------
 
@@ -57,6 +57,7 @@
 #include <renderthread/RenderProxy.h>
 #include <renderthread/RenderTask.h>
 #include <renderthread/RenderThread.h>
+#include <ProgramBinaryCache.h>
 #include <pipeline/skia/ShaderCache.h>
 
 namespace android {
@@ -1087,6 +1088,30 @@ static jlong android_view_ThreadedRenderer_addFrameMetricsObserver(JNIEnv* env,
     return reinterpret_cast<jlong>(observer);
 }
 
+static jlong android_view_ThreadedRenderer_addFrameMetricsRingObserver(JNIEnv* env,
+        jclass clazz, jlong proxyPtr) {
+    renderthread::RenderProxy* renderProxy =
+            reinterpret_cast<renderthread::RenderProxy*>(proxyPtr);
+
+    // Shared-memory delivery: frames are written into the observer's ashmem
+    // ring and drained by the managed side on its own cadence, so there is no
+    // Looper message or Java upcall per frame.
+    sp<FrameMetricsObserver> observer = new FrameMetricsObserver();
+    if (observer->attachRing() < 0) {
+        return 0;
+    }
+    renderProxy->addFrameMetricsObserver(observer.get());
+    return reinterpret_cast<jlong>(observer.get());
+}
+
+static jint android_view_ThreadedRenderer_getFrameMetricsRingFd(JNIEnv* env, jclass clazz,
+        jlong observerPtr) {
+    FrameMetricsObserver* observer = reinterpret_cast<FrameMetricsObserver*>(observerPtr);
+    // The fd stays owned by the observer; the caller must dup it before
+    // wrapping it for the reader.
+    return observer->ringFd();
+}
+
 static void android_view_ThreadedRenderer_removeFrameMetricsObserver(JNIEnv* env, jclass clazz,
         jlong proxyPtr, jlong observerPtr) {
     FrameMetricsObserver* observer = reinterpret_cast<FrameMetricsObserver*>(observerPtr);
@@ -1104,6 +1129,9 @@ static void android_view_ThreadedRenderer_setupShadersDiskCache(JNIEnv* env, job
         jstring diskCachePath, jstring skiaDiskCachePath) {
     const char* cacheArray = env->GetStringUTFChars(diskCachePath, NULL);
     android::egl_set_cache_filename(cacheArray);
+    std::string programCachePath(cacheArray);
+    programCachePath += ".hwui_programs";
+    uirenderer::ProgramBinaryCache::get().setFilename(programCachePath.c_str());
     env->ReleaseStringUTFChars(diskCachePath, cacheArray);
 
     const char* skiaCacheArray = env->GetStringUTFChars(skiaDiskCachePath, NULL);
@@ -1166,6 +1194,12 @@ static const JNINativeMethod gMethods[] = {
     { "nAddFrameMetricsObserver",
             "(JLandroid/view/FrameMetricsObserver;)J",
             (void*)android_view_ThreadedRenderer_addFrameMetricsObserver },
+    { "nAddFrameMetricsRingObserver",
+            "(J)J",
+            (void*)android_view_ThreadedRenderer_addFrameMetricsRingObserver },
+    { "nGetFrameMetricsRingFd",
+            "(J)I",
+            (void*)android_view_ThreadedRenderer_getFrameMetricsRingFd },
     { "nRemoveFrameMetricsObserver",
             "(JJ)V",
             (void*)android_view_ThreadedRenderer_removeFrameMetricsObserver },
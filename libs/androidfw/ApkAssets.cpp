@@ -16,7 +16,17 @@
 
 #include "androidfw/ApkAssets.h"
 
+#include <sys/stat.h>
+
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "zlib.h"
 
 #include "android-base/errors.h"
 #include "android-base/file.h"
@@ -39,6 +49,65 @@ using base::unique_fd;
 
 static const std::string kResourcesArsc("resources.arsc");
 
+namespace {
+
+// Process-wide cache of parsed system ApkAssets, keyed by path. System APKs are immutable for
+// the lifetime of the process and are loaded by every AssetManager2 in it, so they are parsed
+// once and shared. Instances are never evicted. The backing store is intentionally leaked so
+// cached instances outlive static destruction order.
+struct CachedApkAssets {
+  std::mutex lock;
+  std::unordered_map<std::string, std::unique_ptr<const ApkAssets>> by_path;
+  std::unordered_set<const ApkAssets*> instances;
+};
+
+CachedApkAssets& GetCachedApkAssets() {
+  static CachedApkAssets* cache = new CachedApkAssets();
+  return *cache;
+}
+
+constexpr const char* kVerifiedSidecarSuffix = ".arsc-verified";
+constexpr uint32_t kVerifiedSidecarMagic = 0x56737241u;  // "ArsV"
+constexpr uint32_t kVerifiedSidecarVersion = 1u;
+
+// Attests that the resource table of the APK it sits next to passed a deep verification.
+// The APK is identified by its size and modification time, so reinstalling or rewriting the APK
+// invalidates the sidecar, and the table checksum guards the mapped data itself.
+struct VerifiedSidecar {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t arsc_crc;
+  uint32_t reserved;
+  int64_t apk_size;
+  int64_t apk_mtime;
+};
+
+// Returns true if a sidecar written by ApkAssets::PreVerify exists for the APK at `path` and
+// still matches it, meaning the resource table in `arsc_data` was already deeply verified.
+bool SidecarMatches(const std::string& path, const void* arsc_data, size_t arsc_len) {
+  std::string contents;
+  if (!base::ReadFileToString(path + kVerifiedSidecarSuffix, &contents) ||
+      contents.size() != sizeof(VerifiedSidecar)) {
+    return false;
+  }
+
+  VerifiedSidecar sidecar;
+  memcpy(&sidecar, contents.data(), sizeof(sidecar));
+  if (sidecar.magic != kVerifiedSidecarMagic || sidecar.version != kVerifiedSidecarVersion) {
+    return false;
+  }
+
+  struct stat sb;
+  if (::stat(path.c_str(), &sb) != 0 || static_cast<int64_t>(sb.st_size) != sidecar.apk_size ||
+      static_cast<int64_t>(sb.st_mtime) != sidecar.apk_mtime) {
+    return false;
+  }
+  return ::crc32(0L, reinterpret_cast<const Bytef*>(arsc_data), static_cast<uInt>(arsc_len)) ==
+         sidecar.arsc_crc;
+}
+
+}  // namespace
+
 ApkAssets::ApkAssets(void* unmanaged_handle, const std::string& path)
     : zip_handle_(unmanaged_handle, ::CloseArchive), path_(path) {
 }
@@ -47,6 +116,70 @@ std::unique_ptr<const ApkAssets> ApkAssets::Load(const std::string& path, bool s
   return LoadImpl({} /*fd*/, path, nullptr, nullptr, system, false /*load_as_shared_library*/);
 }
 
+const ApkAssets* ApkAssets::LoadCached(const std::string& path) {
+  CachedApkAssets& cache = GetCachedApkAssets();
+  {
+    std::lock_guard<std::mutex> scoped_lock(cache.lock);
+    auto iter = cache.by_path.find(path);
+    if (iter != cache.by_path.end()) {
+      return iter->second.get();
+    }
+  }
+
+  // Parse outside of the lock; opening and loading an APK can be slow.
+  std::unique_ptr<const ApkAssets> apk_assets = Load(path, true /*system*/);
+  if (apk_assets == nullptr) {
+    return nullptr;
+  }
+
+  // If another thread raced us here, keep its instance and drop ours.
+  std::lock_guard<std::mutex> scoped_lock(cache.lock);
+  auto result = cache.by_path.emplace(path, std::move(apk_assets));
+  const ApkAssets* shared_assets = result.first->second.get();
+  cache.instances.insert(shared_assets);
+  return shared_assets;
+}
+
+bool ApkAssets::IsCached(const ApkAssets* apk_assets) {
+  CachedApkAssets& cache = GetCachedApkAssets();
+  std::lock_guard<std::mutex> scoped_lock(cache.lock);
+  return cache.instances.count(apk_assets) != 0;
+}
+
+std::vector<std::unique_ptr<const ApkAssets>> ApkAssets::LoadParallel(
+    const std::vector<std::string>& paths, bool system) {
+  std::vector<std::unique_ptr<const ApkAssets>> results(paths.size());
+  const size_t worker_count =
+      std::min(paths.size(), static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+  if (worker_count <= 1) {
+    for (size_t i = 0; i < paths.size(); i++) {
+      results[i] = Load(paths[i], system);
+    }
+    return results;
+  }
+
+  // Each worker claims the next unloaded path and stores the result at that path's input
+  // index, so the returned order is deterministic regardless of scheduling.
+  std::atomic<size_t> next_index(0);
+  auto worker = [&paths, &results, &next_index, system]() {
+    size_t i;
+    while ((i = next_index.fetch_add(1, std::memory_order_relaxed)) < paths.size()) {
+      results[i] = Load(paths[i], system);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(worker_count - 1);
+  for (size_t i = 1; i < worker_count; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return results;
+}
+
 std::unique_ptr<const ApkAssets> ApkAssets::LoadAsSharedLibrary(const std::string& path,
                                                                 bool system) {
   return LoadImpl({} /*fd*/, path, nullptr, nullptr, system, true /*load_as_shared_library*/);
@@ -78,6 +211,47 @@ std::unique_ptr<const ApkAssets> ApkAssets::LoadFromFd(unique_fd fd,
                   system, force_shared_lib);
 }
 
+bool ApkAssets::PreVerify(const std::string& path) {
+  std::unique_ptr<const ApkAssets> apk_assets = Load(path);
+  if (apk_assets == nullptr) {
+    return false;
+  }
+
+  if (apk_assets->resources_asset_ == nullptr) {
+    // There is no resource table, so there is nothing to verify or attest.
+    return true;
+  }
+
+  // Force the type chunk verification that Load() defers until first use.
+  for (const auto& package : apk_assets->loaded_arsc_->GetPackages()) {
+    if (!package->VerifyAllTypeChunks()) {
+      LOG(ERROR) << "Failed to verify type chunks of APK '" << path << "'.";
+      return false;
+    }
+  }
+
+  struct stat sb;
+  if (::stat(path.c_str(), &sb) != 0) {
+    LOG(ERROR) << "Failed to stat APK '" << path << "': " << SystemErrorCodeToString(errno);
+    return false;
+  }
+
+  VerifiedSidecar sidecar;
+  sidecar.magic = kVerifiedSidecarMagic;
+  sidecar.version = kVerifiedSidecarVersion;
+  sidecar.arsc_crc =
+      ::crc32(0L,
+              reinterpret_cast<const Bytef*>(
+                  apk_assets->resources_asset_->getBuffer(true /*wordAligned*/)),
+              static_cast<uInt>(apk_assets->resources_asset_->getLength()));
+  sidecar.reserved = 0u;
+  sidecar.apk_size = static_cast<int64_t>(sb.st_size);
+  sidecar.apk_mtime = static_cast<int64_t>(sb.st_mtime);
+  return base::WriteStringToFile(
+      std::string(reinterpret_cast<const char*>(&sidecar), sizeof(sidecar)),
+      path + kVerifiedSidecarSuffix);
+}
+
 std::unique_ptr<Asset> ApkAssets::CreateAssetFromFile(const std::string& path) {
   unique_fd fd(base::utf8::open(path.c_str(), O_RDONLY | O_BINARY | O_CLOEXEC));
   if (fd == -1) {
@@ -146,8 +320,12 @@ std::unique_ptr<const ApkAssets> ApkAssets::LoadImpl(
   const StringPiece data(
       reinterpret_cast<const char*>(loaded_apk->resources_asset_->getBuffer(true /*wordAligned*/)),
       loaded_apk->resources_asset_->getLength());
+
+  // If the table was deeply verified at install time and the APK hasn't changed since, take the
+  // trusted fast path and skip per-chunk validation. See PreVerify().
+  const bool verify = !SidecarMatches(path, data.data(), data.size());
   loaded_apk->loaded_arsc_ =
-      LoadedArsc::Load(data, loaded_idmap.get(), system, load_as_shared_library);
+      LoadedArsc::Load(data, loaded_idmap.get(), system, load_as_shared_library, verify);
   if (loaded_apk->loaded_arsc_ == nullptr) {
     LOG(ERROR) << "Failed to load '" << kResourcesArsc << "' in APK '" << path << "'.";
     return {};
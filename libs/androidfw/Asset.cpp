@@ -36,6 +36,7 @@
 #include <fcntl.h>
 #include <memory.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -693,6 +694,78 @@ int _FileAsset::openFileDescriptor(off64_t* outStart, off64_t* outLength) const
     return open(mFileName, O_RDONLY | O_BINARY);
 }
 
+/*
+ * Forward an access-pattern hint to the backing storage.
+ */
+status_t _FileAsset::advise(AccessMode mode)
+{
+    if (mMap != NULL) {
+        FileMap::MapAdvice advice;
+        switch (mode) {
+        case ACCESS_RANDOM:
+            advice = FileMap::RANDOM;
+            break;
+        case ACCESS_STREAMING:
+            advice = FileMap::SEQUENTIAL;
+            break;
+        case ACCESS_BUFFER:
+            advice = FileMap::WILLNEED;
+            break;
+        default:
+            advice = FileMap::NORMAL;
+            break;
+        }
+        return mMap->advise(advice) == 0 ? NO_ERROR : UNKNOWN_ERROR;
+    }
+    if (mFp != NULL) {
+        int advice;
+        switch (mode) {
+        case ACCESS_RANDOM:
+            advice = POSIX_FADV_RANDOM;
+            break;
+        case ACCESS_STREAMING:
+            advice = POSIX_FADV_SEQUENTIAL;
+            break;
+        case ACCESS_BUFFER:
+            advice = POSIX_FADV_WILLNEED;
+            break;
+        default:
+            advice = POSIX_FADV_NORMAL;
+            break;
+        }
+        return posix_fadvise(fileno(mFp), mStart, mLength, advice) == 0
+                ? NO_ERROR : UNKNOWN_ERROR;
+    }
+    return INVALID_OPERATION;
+}
+
+/*
+ * Start asynchronous readahead of a range of the asset.
+ */
+status_t _FileAsset::prefetch(off64_t offset, off64_t length)
+{
+    if (offset < 0 || length <= 0 || offset >= mLength)
+        return BAD_VALUE;
+    if (length > mLength - offset)
+        length = mLength - offset;
+
+    if (mMap != NULL) {
+        /* madvise needs a page-aligned start address */
+        const size_t pageMask = getpagesize() - 1;
+        char* addr = (char*) mMap->getDataPtr() + offset;
+        size_t adjust = (uintptr_t) addr & pageMask;
+        addr -= adjust;
+        return madvise(addr, (size_t) length + adjust, MADV_WILLNEED) == 0
+                ? NO_ERROR : UNKNOWN_ERROR;
+    }
+    if (mFp != NULL) {
+        /* POSIX_FADV_WILLNEED kicks off readahead without blocking */
+        return posix_fadvise(fileno(mFp), mStart + offset, length, POSIX_FADV_WILLNEED) == 0
+                ? NO_ERROR : UNKNOWN_ERROR;
+    }
+    return INVALID_OPERATION;
+}
+
 const void* _FileAsset::ensureAlignment(FileMap* map)
 {
     void* data = map->getDataPtr();
@@ -1207,7 +1207,8 @@ bool AssetManager::scanAndMergeZipLocked(SortedVector<AssetDir::FileInfo>* pMerg
     SortedVector<AssetDir::FileInfo> contents;
     String8 sourceName, zipName, dirName;
 
-    pZip = mZipSet.getZip(ap.path);
+    const sp<SharedZip> sharedZip = mZipSet.getSharedZip(ap.path);
+    pZip = sharedZip->getZip();
     if (pZip == NULL) {
         ALOGW("Failure opening zip %s\n", ap.path.string());
         return false;
@@ -1219,6 +1220,17 @@ bool AssetManager::scanAndMergeZipLocked(SortedVector<AssetDir::FileInfo>* pMerg
     if (rootDir != NULL) dirName = rootDir;
     dirName.appendPath(baseDirName);
 
+    /*
+     * The listing of a directory in an open zip never changes, so scans are
+     * cached on the process-wide SharedZip and shared by every AssetManager
+     * that references this archive. The source names in the cached entries
+     * depend only on the archive path, so they are valid for all of them.
+     */
+    if (sharedZip->getCachedDirContents(dirName, &contents)) {
+        mergeInfoLocked(pMergedInfo, &contents);
+        return true;
+    }
+
     /*
      * Scan through the list of files, looking for a match.  The files in
      * the Zip table of contents are not in sorted order, so we have to
@@ -1305,6 +1317,8 @@ bool AssetManager::scanAndMergeZipLocked(SortedVector<AssetDir::FileInfo>* pMerg
         contents.add(info);
     }
 
+    sharedZip->setCachedDirContents(dirName, contents);
+
     mergeInfoLocked(pMergedInfo, &contents);
 
     return true;
@@ -1535,6 +1549,25 @@ bool AssetManager::SharedZip::getOverlay(size_t idx, asset_path* out) const
     return true;
 }
 
+bool AssetManager::SharedZip::getCachedDirContents(const String8& dirName,
+    SortedVector<AssetDir::FileInfo>* outContents) const
+{
+    AutoMutex _l(gLock);
+    ssize_t idx = mDirCache.indexOfKey(dirName);
+    if (idx < 0) {
+        return false;
+    }
+    *outContents = mDirCache.valueAt(idx);
+    return true;
+}
+
+void AssetManager::SharedZip::setCachedDirContents(const String8& dirName,
+    const SortedVector<AssetDir::FileInfo>& contents)
+{
+    AutoMutex _l(gLock);
+    mDirCache.replaceValueFor(dirName, contents);
+}
+
 AssetManager::SharedZip::~SharedZip()
 {
     if (kIsDebug) {
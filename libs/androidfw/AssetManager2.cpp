@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <mutex>
 #include <set>
 
 #include "android-base/logging.h"
@@ -62,6 +63,57 @@ struct FindEntryResult {
   StringPoolRef entry_string_ref;
 };
 
+// Process-wide cache of resolved bags, shared between AssetManager2 instances whose ordered
+// ApkAssets set and configuration fingerprints match. Bags are immutable once resolved and
+// fully self-contained (values are copied and the string pool pointers are always null in
+// AssetManager2-resolved bags), so instances can safely share them across threads. This keeps
+// the many AssetManager2 instances a multi-window system_server spawns from re-resolving the
+// same framework style bags during ApplyStyle.
+class SharedBagCache {
+ public:
+  static SharedBagCache& Get() {
+    static SharedBagCache instance;
+    return instance;
+  }
+
+  std::shared_ptr<const ResolvedBag> Find(uint64_t fingerprint, uint32_t resid) {
+    std::lock_guard<std::mutex> scoped_lock(lock_);
+    auto group_iter = bags_.find(fingerprint);
+    if (group_iter == bags_.end()) {
+      return nullptr;
+    }
+    auto bag_iter = group_iter->second.find(resid);
+    if (bag_iter == group_iter->second.end()) {
+      return nullptr;
+    }
+    return bag_iter->second;
+  }
+
+  void Store(uint64_t fingerprint, uint32_t resid, const std::shared_ptr<const ResolvedBag>& bag) {
+    std::lock_guard<std::mutex> scoped_lock(lock_);
+    if (bags_.find(fingerprint) == bags_.end() && bags_.size() >= kMaxFingerprintGroups) {
+      // Too many distinct ApkAssets/configuration combinations are alive, which mostly
+      // happens during configuration churn. Drop everything; instances keep their own
+      // copies and will repopulate the groups that are still in use.
+      bags_.clear();
+    }
+    bags_[fingerprint].emplace(resid, bag);
+  }
+
+ private:
+  constexpr static size_t kMaxFingerprintGroups = 8u;
+
+  std::mutex lock_;
+  std::unordered_map<uint64_t,
+                     std::unordered_map<uint32_t, std::shared_ptr<const ResolvedBag>>> bags_;
+};
+
+// Takes ownership of a freshly resolved, malloc-backed bag and makes it shareable.
+static std::shared_ptr<const ResolvedBag> MakeSharedBag(util::unique_cptr<ResolvedBag> bag) {
+  return std::shared_ptr<const ResolvedBag>(bag.release(),
+                                            [](const ResolvedBag* b) { free(const_cast<ResolvedBag*>(b)); });
+}
+
 AssetManager2::AssetManager2() {
   memset(&configuration_, 0, sizeof(configuration_));
 }
@@ -71,12 +123,34 @@ bool AssetManager2::SetApkAssets(const std::vector<const ApkAssets*>& apk_assets
   apk_assets_ = apk_assets;
   BuildDynamicRefTable();
   RebuildFilterList();
+  RebuildBagCacheFingerprint();
   if (invalidate_caches) {
     InvalidateCaches(static_cast<uint32_t>(-1));
   }
   return true;
 }
 
+void AssetManager2::RebuildBagCacheFingerprint() {
+  // 64 bit FNV-1a over the ordered ApkAssets identities and the configuration. Instances with
+  // equal fingerprints assign the same cookies and dynamic package IDs, so their resolved bags
+  // are interchangeable. The path is mixed in alongside the pointer so that an ApkAssets
+  // object recycled at the same address for a different APK cannot alias a stale group.
+  uint64_t hash = 14695981039346656037ull;
+  auto mix = [&hash](const void* data, size_t len) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < len; i++) {
+      hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+  };
+  for (const ApkAssets* apk : apk_assets_) {
+    mix(&apk, sizeof(apk));
+    const std::string& path = apk->GetPath();
+    mix(path.data(), path.size() + 1);  // include the terminator as a separator
+  }
+  mix(&configuration_, sizeof(configuration_));
+  bag_cache_fingerprint_ = hash;
+}
+
 void AssetManager2::BuildDynamicRefTable() {
   package_groups_.clear();
   package_ids_.fill(0xff);
@@ -200,6 +274,7 @@ void AssetManager2::SetConfiguration(const ResTable_config& configuration) {
 
   if (diff) {
     RebuildFilterList();
+    RebuildBagCacheFingerprint();
     InvalidateCaches(static_cast<uint32_t>(diff));
   }
 }
@@ -580,6 +655,19 @@ const ResolvedBag* AssetManager2::GetBag(uint32_t resid, std::vector<uint32_t>&
     return cached_iter->second.get();
   }
 
+  // Resolved bags are immutable and self-contained, so any AssetManager with the same
+  // ApkAssets set and configuration resolves an identical bag. Check the process-wide
+  // cache before doing the work ourselves.
+  if (bag_cache_fingerprint_ != 0u) {
+    std::shared_ptr<const ResolvedBag> shared =
+        SharedBagCache::Get().Find(bag_cache_fingerprint_, resid);
+    if (shared != nullptr) {
+      const ResolvedBag* result = shared.get();
+      cached_bags_[resid] = std::move(shared);
+      return result;
+    }
+  }
+
   FindEntryResult entry;
   ApkAssetsCookie cookie =
       FindEntry(resid, 0u /* density_override */, false /* stop_at_first_match */, &entry);
@@ -641,8 +729,12 @@ const ResolvedBag* AssetManager2::GetBag(uint32_t resid, std::vector<uint32_t>&
     }
     new_bag->type_spec_flags = entry.type_flags;
     new_bag->entry_count = static_cast<uint32_t>(entry_count);
-    ResolvedBag* result = new_bag.get();
-    cached_bags_[resid] = std::move(new_bag);
+    std::shared_ptr<const ResolvedBag> shared_bag = MakeSharedBag(std::move(new_bag));
+    const ResolvedBag* result = shared_bag.get();
+    if (bag_cache_fingerprint_ != 0u) {
+      SharedBagCache::Get().Store(bag_cache_fingerprint_, resid, shared_bag);
+    }
+    cached_bags_[resid] = std::move(shared_bag);
     return result;
   }
 
@@ -751,8 +843,12 @@ const ResolvedBag* AssetManager2::GetBag(uint32_t resid, std::vector<uint32_t>&
   // Combine flags from the parent and our own bag.
   new_bag->type_spec_flags = entry.type_flags | parent_bag->type_spec_flags;
   new_bag->entry_count = static_cast<uint32_t>(actual_count);
-  ResolvedBag* result = new_bag.get();
-  cached_bags_[resid] = std::move(new_bag);
+  std::shared_ptr<const ResolvedBag> shared_bag = MakeSharedBag(std::move(new_bag));
+  const ResolvedBag* result = shared_bag.get();
+  if (bag_cache_fingerprint_ != 0u) {
+    SharedBagCache::Get().Store(bag_cache_fingerprint_, resid, shared_bag);
+  }
+  cached_bags_[resid] = std::move(shared_bag);
   return result;
 }
 
@@ -205,18 +205,24 @@ bool ResolveAttrs(Theme* theme, uint32_t def_style_attr, uint32_t def_style_res,
 void ApplyStyle(Theme* theme, ResXMLParser* xml_parser, uint32_t def_style_attr,
                 uint32_t def_style_resid, const uint32_t* attrs, size_t attrs_length,
                 uint32_t* out_values, uint32_t* out_indices) {
+  ApplyStyleBatch(theme, &xml_parser, 1u, def_style_attr, def_style_resid, attrs, attrs_length,
+                  out_values, out_indices);
+}
+
+void ApplyStyleBatch(Theme* theme, ResXMLParser* const* xml_parsers, size_t parser_count,
+                     uint32_t def_style_attr, uint32_t def_style_resid, const uint32_t* attrs,
+                     size_t attrs_length, uint32_t* out_values, uint32_t* out_indices) {
   if (kDebugStyles) {
-    ALOGI("APPLY STYLE: theme=0x%p defStyleAttr=0x%x defStyleRes=0x%x xml=0x%p", theme,
-          def_style_attr, def_style_resid, xml_parser);
+    ALOGI("APPLY STYLE: theme=0x%p defStyleAttr=0x%x defStyleRes=0x%x views=%zu", theme,
+          def_style_attr, def_style_resid, parser_count);
   }
 
   AssetManager2* assetmanager = theme->GetAssetManager();
   ResTable_config config;
   Res_value value;
 
-  int indices_idx = 0;
-
-  // Load default style from attribute, if specified...
+  // The theme and default style are shared by every view in the batch, so resolve the default
+  // style and pin its bag once up front.
   uint32_t def_style_flags = 0u;
   if (def_style_attr != 0) {
     Res_value value;
@@ -227,25 +233,6 @@ void ApplyStyle(Theme* theme, ResXMLParser* xml_parser, uint32_t def_style_attr,
     }
   }
 
-  // Retrieve the style resource ID associated with the current XML tag's style attribute.
-  uint32_t style_resid = 0u;
-  uint32_t style_flags = 0u;
-  if (xml_parser != nullptr) {
-    ssize_t idx = xml_parser->indexOfStyle();
-    if (idx >= 0 && xml_parser->getAttributeValue(idx, &value) >= 0) {
-      if (value.dataType == value.TYPE_ATTRIBUTE) {
-        // Resolve the attribute with out theme.
-        if (theme->GetAttribute(value.data, &value, &style_flags) == kInvalidCookie) {
-          value.dataType = Res_value::TYPE_NULL;
-        }
-      }
-
-      if (value.dataType == value.TYPE_REFERENCE) {
-        style_resid = value.data;
-      }
-    }
-  }
-
   // Retrieve the default style bag, if requested.
   const ResolvedBag* default_style_bag = nullptr;
   if (def_style_resid != 0) {
@@ -255,145 +242,177 @@ void ApplyStyle(Theme* theme, ResXMLParser* xml_parser, uint32_t def_style_attr,
     }
   }
 
-  BagAttributeFinder def_style_attr_finder(default_style_bag);
-
-  // Retrieve the style class bag, if requested.
+  // The style bag of the previous view; sibling views almost always name the same style, so
+  // keep it pinned across iterations instead of looking it up again.
+  uint32_t last_style_resid = 0u;
   const ResolvedBag* xml_style_bag = nullptr;
-  if (style_resid != 0) {
-    xml_style_bag = assetmanager->GetBag(style_resid);
+
+  for (size_t view = 0; view < parser_count; view++) {
+    ResXMLParser* xml_parser = xml_parsers[view];
+
+    // Retrieve the style resource ID associated with the current XML tag's style attribute.
+    uint32_t style_resid = 0u;
+    uint32_t style_flags = 0u;
+    if (xml_parser != nullptr) {
+      ssize_t idx = xml_parser->indexOfStyle();
+      if (idx >= 0 && xml_parser->getAttributeValue(idx, &value) >= 0) {
+        if (value.dataType == value.TYPE_ATTRIBUTE) {
+          // Resolve the attribute with out theme.
+          if (theme->GetAttribute(value.data, &value, &style_flags) == kInvalidCookie) {
+            value.dataType = Res_value::TYPE_NULL;
+          }
+        }
+
+        if (value.dataType == value.TYPE_REFERENCE) {
+          style_resid = value.data;
+        }
+      }
+    }
+
+    // Retrieve the style class bag, if requested and not already pinned.
+    if (style_resid != last_style_resid) {
+      xml_style_bag = style_resid != 0 ? assetmanager->GetBag(style_resid) : nullptr;
+      last_style_resid = style_resid;
+    }
     if (xml_style_bag != nullptr) {
       style_flags |= xml_style_bag->type_spec_flags;
     }
-  }
 
-  BagAttributeFinder xml_style_attr_finder(xml_style_bag);
+    // Each view restarts its queries at the lowest requested attribute, so the backtracking
+    // cursors are re-seeded per view over the pinned bags.
+    BagAttributeFinder def_style_attr_finder(default_style_bag);
+    BagAttributeFinder xml_style_attr_finder(xml_style_bag);
 
-  // Retrieve the XML attributes, if requested.
-  XmlAttributeFinder xml_attr_finder(xml_parser);
+    // Retrieve the XML attributes, if requested.
+    XmlAttributeFinder xml_attr_finder(xml_parser);
 
-  // Now iterate through all of the attributes that the client has requested,
-  // filling in each with whatever data we can find.
-  for (size_t ii = 0; ii < attrs_length; ii++) {
-    const uint32_t cur_ident = attrs[ii];
+    int indices_idx = 0;
 
-    if (kDebugStyles) {
-      ALOGI("RETRIEVING ATTR 0x%08x...", cur_ident);
-    }
+    // Now iterate through all of the attributes that the client has requested,
+    // filling in each with whatever data we can find.
+    for (size_t ii = 0; ii < attrs_length; ii++) {
+      const uint32_t cur_ident = attrs[ii];
 
-    ApkAssetsCookie cookie = kInvalidCookie;
-    uint32_t type_set_flags = 0u;
+      if (kDebugStyles) {
+        ALOGI("RETRIEVING ATTR 0x%08x...", cur_ident);
+      }
 
-    value.dataType = Res_value::TYPE_NULL;
-    value.data = Res_value::DATA_NULL_UNDEFINED;
-    config.density = 0;
+      ApkAssetsCookie cookie = kInvalidCookie;
+      uint32_t type_set_flags = 0u;
 
-    // Try to find a value for this attribute...  we prioritize values
-    // coming from, first XML attributes, then XML style, then default
-    // style, and finally the theme.
+      value.dataType = Res_value::TYPE_NULL;
+      value.data = Res_value::DATA_NULL_UNDEFINED;
+      config.density = 0;
 
-    // Walk through the xml attributes looking for the requested attribute.
-    const size_t xml_attr_idx = xml_attr_finder.Find(cur_ident);
-    if (xml_attr_idx != xml_attr_finder.end()) {
-      // We found the attribute we were looking for.
-      xml_parser->getAttributeValue(xml_attr_idx, &value);
-      if (kDebugStyles) {
-        ALOGI("-> From XML: type=0x%x, data=0x%08x", value.dataType, value.data);
-      }
-    }
+      // Try to find a value for this attribute...  we prioritize values
+      // coming from, first XML attributes, then XML style, then default
+      // style, and finally the theme.
 
-    if (value.dataType == Res_value::TYPE_NULL && value.data != Res_value::DATA_NULL_EMPTY) {
-      // Walk through the style class values looking for the requested attribute.
-      const ResolvedBag::Entry* entry = xml_style_attr_finder.Find(cur_ident);
-      if (entry != xml_style_attr_finder.end()) {
+      // Walk through the xml attributes looking for the requested attribute.
+      const size_t xml_attr_idx = xml_attr_finder.Find(cur_ident);
+      if (xml_attr_idx != xml_attr_finder.end()) {
         // We found the attribute we were looking for.
-        cookie = entry->cookie;
-        type_set_flags = style_flags;
-        value = entry->value;
+        xml_parser->getAttributeValue(xml_attr_idx, &value);
         if (kDebugStyles) {
-          ALOGI("-> From style: type=0x%x, data=0x%08x", value.dataType, value.data);
+          ALOGI("-> From XML: type=0x%x, data=0x%08x", value.dataType, value.data);
         }
       }
-    }
 
-    if (value.dataType == Res_value::TYPE_NULL && value.data != Res_value::DATA_NULL_EMPTY) {
-      // Walk through the default style values looking for the requested attribute.
-      const ResolvedBag::Entry* entry = def_style_attr_finder.Find(cur_ident);
-      if (entry != def_style_attr_finder.end()) {
-        // We found the attribute we were looking for.
-        cookie = entry->cookie;
-        type_set_flags = def_style_flags;
-        value = entry->value;
-        if (kDebugStyles) {
-          ALOGI("-> From def style: type=0x%x, data=0x%08x", value.dataType, value.data);
+      if (value.dataType == Res_value::TYPE_NULL && value.data != Res_value::DATA_NULL_EMPTY) {
+        // Walk through the style class values looking for the requested attribute.
+        const ResolvedBag::Entry* entry = xml_style_attr_finder.Find(cur_ident);
+        if (entry != xml_style_attr_finder.end()) {
+          // We found the attribute we were looking for.
+          cookie = entry->cookie;
+          type_set_flags = style_flags;
+          value = entry->value;
+          if (kDebugStyles) {
+            ALOGI("-> From style: type=0x%x, data=0x%08x", value.dataType, value.data);
+          }
         }
       }
-    }
 
-    uint32_t resid = 0u;
-    if (value.dataType != Res_value::TYPE_NULL) {
-      // Take care of resolving the found resource to its final value.
-      ApkAssetsCookie new_cookie =
-          theme->ResolveAttributeReference(cookie, &value, &config, &type_set_flags, &resid);
-      if (new_cookie != kInvalidCookie) {
-        cookie = new_cookie;
+      if (value.dataType == Res_value::TYPE_NULL && value.data != Res_value::DATA_NULL_EMPTY) {
+        // Walk through the default style values looking for the requested attribute.
+        const ResolvedBag::Entry* entry = def_style_attr_finder.Find(cur_ident);
+        if (entry != def_style_attr_finder.end()) {
+          // We found the attribute we were looking for.
+          cookie = entry->cookie;
+          type_set_flags = def_style_flags;
+          value = entry->value;
+          if (kDebugStyles) {
+            ALOGI("-> From def style: type=0x%x, data=0x%08x", value.dataType, value.data);
+          }
+        }
       }
 
-      if (kDebugStyles) {
-        ALOGI("-> Resolved attr: type=0x%x, data=0x%08x", value.dataType, value.data);
-      }
-    } else if (value.data != Res_value::DATA_NULL_EMPTY) {
-      // If we still don't have a value for this attribute, try to find it in the theme!
-      ApkAssetsCookie new_cookie = theme->GetAttribute(cur_ident, &value, &type_set_flags);
-      if (new_cookie != kInvalidCookie) {
+      uint32_t resid = 0u;
+      if (value.dataType != Res_value::TYPE_NULL) {
+        // Take care of resolving the found resource to its final value.
+        ApkAssetsCookie new_cookie =
+            theme->ResolveAttributeReference(cookie, &value, &config, &type_set_flags, &resid);
+        if (new_cookie != kInvalidCookie) {
+          cookie = new_cookie;
+        }
+
         if (kDebugStyles) {
-          ALOGI("-> From theme: type=0x%x, data=0x%08x", value.dataType, value.data);
+          ALOGI("-> Resolved attr: type=0x%x, data=0x%08x", value.dataType, value.data);
         }
-        new_cookie =
-            assetmanager->ResolveReference(new_cookie, &value, &config, &type_set_flags, &resid);
+      } else if (value.data != Res_value::DATA_NULL_EMPTY) {
+        // If we still don't have a value for this attribute, try to find it in the theme!
+        ApkAssetsCookie new_cookie = theme->GetAttribute(cur_ident, &value, &type_set_flags);
         if (new_cookie != kInvalidCookie) {
-          cookie = new_cookie;
+          if (kDebugStyles) {
+            ALOGI("-> From theme: type=0x%x, data=0x%08x", value.dataType, value.data);
+          }
+          new_cookie =
+              assetmanager->ResolveReference(new_cookie, &value, &config, &type_set_flags, &resid);
+          if (new_cookie != kInvalidCookie) {
+            cookie = new_cookie;
+          }
+
+          if (kDebugStyles) {
+            ALOGI("-> Resolved theme: type=0x%x, data=0x%08x", value.dataType, value.data);
+          }
         }
+      }
 
+      // Deal with the special @null value -- it turns back to TYPE_NULL.
+      if (value.dataType == Res_value::TYPE_REFERENCE && value.data == 0) {
         if (kDebugStyles) {
-          ALOGI("-> Resolved theme: type=0x%x, data=0x%08x", value.dataType, value.data);
+          ALOGI("-> Setting to @null!");
         }
+        value.dataType = Res_value::TYPE_NULL;
+        value.data = Res_value::DATA_NULL_UNDEFINED;
+        cookie = kInvalidCookie;
       }
-    }
 
-    // Deal with the special @null value -- it turns back to TYPE_NULL.
-    if (value.dataType == Res_value::TYPE_REFERENCE && value.data == 0) {
       if (kDebugStyles) {
-        ALOGI("-> Setting to @null!");
+        ALOGI("Attribute 0x%08x: type=0x%x, data=0x%08x", cur_ident, value.dataType, value.data);
       }
-      value.dataType = Res_value::TYPE_NULL;
-      value.data = Res_value::DATA_NULL_UNDEFINED;
-      cookie = kInvalidCookie;
-    }
 
-    if (kDebugStyles) {
-      ALOGI("Attribute 0x%08x: type=0x%x, data=0x%08x", cur_ident, value.dataType, value.data);
-    }
+      // Write the final value back to Java.
+      out_values[STYLE_TYPE] = value.dataType;
+      out_values[STYLE_DATA] = value.data;
+      out_values[STYLE_ASSET_COOKIE] = ApkAssetsCookieToJavaCookie(cookie);
+      out_values[STYLE_RESOURCE_ID] = resid;
+      out_values[STYLE_CHANGING_CONFIGURATIONS] = type_set_flags;
+      out_values[STYLE_DENSITY] = config.density;
 
-    // Write the final value back to Java.
-    out_values[STYLE_TYPE] = value.dataType;
-    out_values[STYLE_DATA] = value.data;
-    out_values[STYLE_ASSET_COOKIE] = ApkAssetsCookieToJavaCookie(cookie);
-    out_values[STYLE_RESOURCE_ID] = resid;
-    out_values[STYLE_CHANGING_CONFIGURATIONS] = type_set_flags;
-    out_values[STYLE_DENSITY] = config.density;
+      if (value.dataType != Res_value::TYPE_NULL || value.data == Res_value::DATA_NULL_EMPTY) {
+        indices_idx++;
 
-    if (value.dataType != Res_value::TYPE_NULL || value.data == Res_value::DATA_NULL_EMPTY) {
-      indices_idx++;
+        // out_indices must NOT be nullptr.
+        out_indices[indices_idx] = ii;
+      }
 
-      // out_indices must NOT be nullptr.
-      out_indices[indices_idx] = ii;
+      out_values += STYLE_NUM_ENTRIES;
     }
 
-    out_values += STYLE_NUM_ENTRIES;
+    // out_indices must NOT be nullptr.
+    out_indices[0] = indices_idx;
+    out_indices += attrs_length + 1;
   }
-
-  // out_indices must NOT be nullptr.
-  out_indices[0] = indices_idx;
 }
 
 bool RetrieveAttributes(AssetManager2* assetmanager, ResXMLParser* xml_parser, uint32_t* attrs,
@@ -39,6 +39,7 @@ namespace android {
 
 #define MAGIC0 0x70616e53 // Snap
 #define MAGIC1 0x656c6946 // File
+#define MAGIC1_V2 0x326c6946 // Fil2 -- records carry per-chunk digests
 
 /*
  * File entity data format (v1):
@@ -82,8 +83,93 @@ round_up(int n)
     return n + ROUND_UP[n % 4];
 }
 
+/*
+ * Content-defined chunking parameters.  A chunk boundary is declared when the
+ * low bits of a gear-style rolling hash are all zero, which yields chunks of
+ * roughly 64KB on average while keeping boundaries stable across insertions
+ * and deletions.  The min and max bounds keep pathological inputs (long runs
+ * of a single byte, incompressible noise) from producing degenerate chunk
+ * lists.
+ */
+static const size_t CHUNK_SIZE_MIN = 16*1024;
+static const size_t CHUNK_SIZE_MAX = 256*1024;
+static const uint32_t CHUNK_BOUNDARY_MASK = 0xffff;
+
+static uint32_t gearTable[256];
+
+static struct GearTableInit {
+    GearTableInit() {
+        // Mix each byte value into a well-distributed 32-bit constant so that
+        // boundary placement is insensitive to the input byte distribution.
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t h = i + 0x9e3779b9u;
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35u;
+            h ^= h >> 16;
+            gearTable[i] = h;
+        }
+    }
+} gGearTableInit;
+
+/*
+ * Splits a byte stream into content-defined chunks and records a crc32 per
+ * chunk.  Feed data with update() in any buffer sizes, then call finish() to
+ * flush the trailing partial chunk.
+ */
+class ChunkDigester {
+public:
+    Vector<uint32_t> digests;
+
+    ChunkDigester()
+        : mHash(0), mChunkLen(0), mChunkCrc(crc32(0L, Z_NULL, 0)) {
+    }
+
+    void update(const uint8_t* buf, size_t len) {
+        size_t segStart = 0;
+        for (size_t i = 0; i < len; i++) {
+            mHash = (mHash << 1) + gearTable[buf[i]];
+            mChunkLen++;
+            if ((mChunkLen >= CHUNK_SIZE_MIN && (mHash & CHUNK_BOUNDARY_MASK) == 0)
+                    || mChunkLen >= CHUNK_SIZE_MAX) {
+                mChunkCrc = crc32(mChunkCrc, (const Bytef*)buf + segStart, i + 1 - segStart);
+                digests.add((uint32_t)mChunkCrc);
+                segStart = i + 1;
+                mHash = 0;
+                mChunkLen = 0;
+                mChunkCrc = crc32(0L, Z_NULL, 0);
+            }
+        }
+        if (segStart < len) {
+            mChunkCrc = crc32(mChunkCrc, (const Bytef*)buf + segStart, len - segStart);
+        }
+    }
+
+    void finish() {
+        if (mChunkLen > 0) {
+            digests.add((uint32_t)mChunkCrc);
+        }
+    }
+
+private:
+    uint32_t mHash;
+    size_t mChunkLen;
+    unsigned long mChunkCrc;
+};
+
+static bool
+chunk_digests_match(const Vector<uint32_t>& a, const Vector<uint32_t>& b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+    return a.size() == 0
+            || memcmp(a.array(), b.array(), a.size() * sizeof(uint32_t)) == 0;
+}
+
 static int
-read_snapshot_file(int fd, KeyedVector<String8,FileState>* snapshot)
+read_snapshot_file(int fd, KeyedVector<String8,FileRec>* snapshot)
 {
     int bytesRead = 0;
     int amt;
@@ -95,39 +181,77 @@ read_snapshot_file(int fd, KeyedVector<String8,FileState>* snapshot)
     }
     bytesRead += amt;
 
-    if (header.magic0 != MAGIC0 || header.magic1 != MAGIC1) {
+    if (header.magic0 != MAGIC0 || (header.magic1 != MAGIC1 && header.magic1 != MAGIC1_V2)) {
         ALOGW("read_snapshot_file header.magic0=0x%08x magic1=0x%08x", header.magic0, header.magic1);
         return 1;
     }
 
+    // v1 snapshots predate per-chunk digests; they are still accepted so the
+    // first pass after an update does a full digest computation rather than a
+    // full retransmit.
+    const bool hasChunkDigests = header.magic1 == MAGIC1_V2;
+
     for (int i=0; i<header.fileCount; i++) {
-        FileState file;
+        FileRec file;
         char filenameBuf[128];
 
-        amt = read(fd, &file, sizeof(FileState));
+        amt = read(fd, &file.s, sizeof(FileState));
         if (amt != sizeof(FileState)) {
             ALOGW("read_snapshot_file FileState truncated/error with read at %d bytes\n", bytesRead);
             return 1;
         }
         bytesRead += amt;
+        file.deleted = false;
 
         // filename is not NULL terminated, but it is padded
-        int nameBufSize = round_up(file.nameLen);
+        int nameBufSize = round_up(file.s.nameLen);
         char* filename = nameBufSize <= (int)sizeof(filenameBuf)
                 ? filenameBuf
                 : (char*)malloc(nameBufSize);
         amt = read(fd, filename, nameBufSize);
-        if (amt == nameBufSize) {
-            snapshot->add(String8(filename, file.nameLen), file);
-        }
         bytesRead += amt;
-        if (filename != filenameBuf) {
-            free(filename);
-        }
         if (amt != nameBufSize) {
+            if (filename != filenameBuf) {
+                free(filename);
+            }
             ALOGW("read_snapshot_file filename truncated/error with read at %d bytes\n", bytesRead);
             return 1;
         }
+        String8 name(filename, file.s.nameLen);
+        if (filename != filenameBuf) {
+            free(filename);
+        }
+
+        if (hasChunkDigests) {
+            uint32_t chunkCount;
+            amt = read(fd, &chunkCount, sizeof(chunkCount));
+            if (amt != sizeof(chunkCount)) {
+                ALOGW("read_snapshot_file chunk count truncated/error with read at %d bytes\n",
+                        bytesRead);
+                return 1;
+            }
+            bytesRead += amt;
+            // An empty file has no chunks; cap the count so a corrupt snapshot
+            // can't make us allocate unbounded memory.
+            if (chunkCount > (1u << 20)) {
+                ALOGW("read_snapshot_file implausible chunk count %u at %d bytes\n",
+                        chunkCount, bytesRead);
+                return 1;
+            }
+            if (chunkCount != 0) {
+                file.chunkDigests.resize(chunkCount);
+                const int digestBytes = chunkCount * sizeof(uint32_t);
+                amt = read(fd, file.chunkDigests.editArray(), digestBytes);
+                if (amt != digestBytes) {
+                    ALOGW("read_snapshot_file chunk digests truncated/error with read at %d "
+                            "bytes\n", bytesRead);
+                    return 1;
+                }
+                bytesRead += amt;
+            }
+        }
+
+        snapshot->add(name, file);
     }
 
     if (header.totalSize != bytesRead) {
@@ -150,7 +274,8 @@ write_snapshot_file(int fd, const KeyedVector<String8,FileRec>& snapshot)
         const FileRec& g = snapshot.valueAt(i);
         if (!g.deleted) {
             const String8& name = snapshot.keyAt(i);
-            bytesWritten += sizeof(FileState) + round_up(name.length());
+            bytesWritten += sizeof(FileState) + round_up(name.length())
+                    + sizeof(uint32_t) + g.chunkDigests.size() * sizeof(uint32_t);
             fileCount++;
         }
     }
@@ -158,7 +283,7 @@ write_snapshot_file(int fd, const KeyedVector<String8,FileRec>& snapshot)
     LOGP("write_snapshot_file fd=%d\n", fd);
 
     int amt;
-    SnapshotHeader header = { MAGIC0, fileCount, MAGIC1, bytesWritten };
+    SnapshotHeader header = { MAGIC0, fileCount, MAGIC1_V2, bytesWritten };
 
     amt = write(fd, &header, sizeof(header));
     if (amt != sizeof(header)) {
@@ -194,6 +319,21 @@ write_snapshot_file(int fd, const KeyedVector<String8,FileRec>& snapshot)
                     return 1;
                 }
             }
+
+            uint32_t chunkCount = r.chunkDigests.size();
+            amt = write(fd, &chunkCount, sizeof(chunkCount));
+            if (amt != sizeof(chunkCount)) {
+                ALOGW("write_snapshot_file error writing chunk count %s", strerror(errno));
+                return 1;
+            }
+            if (chunkCount != 0) {
+                const int digestBytes = chunkCount * sizeof(uint32_t);
+                amt = write(fd, r.chunkDigests.array(), digestBytes);
+                if (amt != digestBytes) {
+                    ALOGW("write_snapshot_file error writing chunk digests %s", strerror(errno));
+                    return 1;
+                }
+            }
         }
     }
 
@@ -304,7 +444,7 @@ write_update_file(BackupDataWriter* dataStream, const String8& key, char const*
 }
 
 static int
-compute_crc32(const char* file, FileRec* out) {
+compute_digests(const char* file, FileRec* out) {
     int fd = open(file, O_RDONLY);
     if (fd < 0) {
         return -1;
@@ -315,17 +455,21 @@ compute_crc32(const char* file, FileRec* out) {
 
     char* buf = (char*)malloc(bufsize);
     int crc = crc32(0L, Z_NULL, 0);
+    ChunkDigester chunker;
 
     lseek(fd, 0, SEEK_SET);
 
-    while ((amt = read(fd, buf, bufsize)) != 0) {
+    while ((amt = read(fd, buf, bufsize)) > 0) {
         crc = crc32(crc, (Bytef*)buf, amt);
+        chunker.update((const uint8_t*)buf, amt);
     }
 
     close(fd);
     free(buf);
+    chunker.finish();
 
     out->s.crc32 = crc;
+    out->chunkDigests = chunker.digests;
     return NO_ERROR;
 }
 
@@ -334,7 +478,7 @@ back_up_files(int oldSnapshotFD, BackupDataWriter* dataStream, int newSnapshotFD
         char const* const* files, char const* const* keys, int fileCount)
 {
     int err;
-    KeyedVector<String8,FileState> oldSnapshot;
+    KeyedVector<String8,FileRec> oldSnapshot;
     KeyedVector<String8,FileRec> newSnapshot;
 
     if (oldSnapshotFD != -1) {
@@ -369,8 +513,25 @@ back_up_files(int oldSnapshotFD, BackupDataWriter* dataStream, int newSnapshotFD
                 return -1;
             }
 
-            // compute the CRC
-            if (compute_crc32(file, &r) != NO_ERROR) {
+            // If the metadata is unchanged and the old snapshot carries chunk
+            // digests, reuse them instead of re-reading the whole file.
+            ssize_t oldIndex = oldSnapshot.indexOfKey(key);
+            if (oldIndex >= 0) {
+                const FileRec& old = oldSnapshot.valueAt(oldIndex);
+                if (old.s.modTime_sec == r.s.modTime_sec
+                        && old.s.modTime_nsec == r.s.modTime_nsec
+                        && old.s.mode == r.s.mode && old.s.size == r.s.size
+                        && old.chunkDigests.size() != 0) {
+                    LOGP("back_up_files reusing digests for '%s'", key.string());
+                    r.s.crc32 = old.s.crc32;
+                    r.chunkDigests = old.chunkDigests;
+                    newSnapshot.add(key, r);
+                    continue;
+                }
+            }
+
+            // compute the digests
+            if (compute_digests(file, &r) != NO_ERROR) {
                 ALOGW("Unable to open file %s", file);
                 continue;
             }
@@ -400,15 +561,42 @@ back_up_files(int oldSnapshotFD, BackupDataWriter* dataStream, int newSnapshotFD
             m++;
         } else {
             // same file exists in both old and new; check whether to update
-            const FileState& f = oldSnapshot.valueAt(n);
+            const FileRec& o = oldSnapshot.valueAt(n);
+            const FileState& f = o.s;
 
             LOGP("%s", q.string());
-            LOGP("  old: modTime=%d,%d mode=%04o size=%-3d crc32=0x%08x",
-                    f.modTime_sec, f.modTime_nsec, f.mode, f.size, f.crc32);
-            LOGP("  new: modTime=%d,%d mode=%04o size=%-3d crc32=0x%08x",
-                    g.s.modTime_sec, g.s.modTime_nsec, g.s.mode, g.s.size, g.s.crc32);
-            if (f.modTime_sec != g.s.modTime_sec || f.modTime_nsec != g.s.modTime_nsec
-                    || f.mode != g.s.mode || f.size != g.s.size || f.crc32 != g.s.crc32) {
+            LOGP("  old: modTime=%d,%d mode=%04o size=%-3d crc32=0x%08x chunks=%zu",
+                    f.modTime_sec, f.modTime_nsec, f.mode, f.size, f.crc32,
+                    o.chunkDigests.size());
+            LOGP("  new: modTime=%d,%d mode=%04o size=%-3d crc32=0x%08x chunks=%zu",
+                    g.s.modTime_sec, g.s.modTime_nsec, g.s.mode, g.s.size, g.s.crc32,
+                    g.chunkDigests.size());
+
+            bool changed;
+            if (o.chunkDigests.size() != 0) {
+                // The chunk digests compare contents authoritatively, so a
+                // bare mtime touch with identical bytes no longer retransmits.
+                changed = f.mode != g.s.mode || f.size != g.s.size || f.crc32 != g.s.crc32
+                        || !chunk_digests_match(o.chunkDigests, g.chunkDigests);
+            } else {
+                // Old snapshot has no digests (v1, or an empty file); fall
+                // back to the metadata comparison.
+                changed = f.modTime_sec != g.s.modTime_sec || f.modTime_nsec != g.s.modTime_nsec
+                        || f.mode != g.s.mode || f.size != g.s.size || f.crc32 != g.s.crc32;
+            }
+
+            if (changed) {
+                if (kIsDebug && o.chunkDigests.size() != 0) {
+                    size_t same = 0;
+                    const size_t common = o.chunkDigests.size() < g.chunkDigests.size()
+                            ? o.chunkDigests.size() : g.chunkDigests.size();
+                    for (size_t ci = 0; ci < common; ci++) {
+                        if (o.chunkDigests[ci] == g.chunkDigests[ci]) {
+                            same++;
+                        }
+                    }
+                    LOGP("  %zu of %zu chunks unchanged", same, g.chunkDigests.size());
+                }
                 int fd = open(g.file.string(), O_RDONLY);
                 if (fd < 0) {
                     ALOGE("Unable to read file for backup: %s", g.file.string());
@@ -777,8 +965,10 @@ RestoreHelperBase::WriteFile(const String8& filename, BackupDataReader* in)
     }
     mode = metadata.mode;
 
-    // Write the file and compute the crc
+    // Write the file and compute the digests, so the first backup pass after
+    // a restore doesn't have to re-read everything we just wrote.
     crc = crc32(0L, Z_NULL, 0);
+    ChunkDigester chunker;
     fd = open(filename.string(), O_CREAT|O_RDWR|O_TRUNC, mode);
     if (fd == -1) {
         ALOGW("Could not open file %s -- %s", filename.string(), strerror(errno));
@@ -793,9 +983,11 @@ RestoreHelperBase::WriteFile(const String8& filename, BackupDataReader* in)
             return errno;
         }
         crc = crc32(crc, (Bytef*)buf, amt);
+        chunker.update((const uint8_t*)buf, amt);
     }
 
     close(fd);
+    chunker.finish();
 
     // Record for the snapshot
     err = stat(filename.string(), &st);
@@ -812,6 +1004,7 @@ RestoreHelperBase::WriteFile(const String8& filename, BackupDataReader* in)
     r.s.mode = st.st_mode;
     r.s.size = st.st_size;
     r.s.crc32 = crc;
+    r.chunkDigests = chunker.digests;
 
     m_files.add(key, r);
 
@@ -929,7 +1122,7 @@ backup_helper_test_empty()
 
     static const unsigned char correct_data[] = {
         0x53, 0x6e, 0x61, 0x70,  0x00, 0x00, 0x00, 0x00,
-        0x46, 0x69, 0x6c, 0x65,  0x10, 0x00, 0x00, 0x00
+        0x46, 0x69, 0x6c, 0x32,  0x10, 0x00, 0x00, 0x00
     };
 
     err = compare_file(filename, correct_data, sizeof(correct_data));
@@ -944,7 +1137,7 @@ backup_helper_test_empty()
         return 1;
     }
 
-    KeyedVector<String8,FileState> readSnapshot;
+    KeyedVector<String8,FileRec> readSnapshot;
     err = read_snapshot_file(fd, &readSnapshot);
     if (err != 0) {
         fprintf(stderr, "read_snapshot_file failed %d\n", err);
@@ -989,8 +1182,12 @@ backup_helper_test_four()
     states[0].crc32 = 0x12345678;
     states[0].nameLen = -12;
     r.s = states[0];
+    r.chunkDigests.clear();
+    r.chunkDigests.add(0x11111111);
+    r.chunkDigests.add(0x22222222);
     filenames[0] = String8("bytes_of_padding");
     snapshot.add(filenames[0], r);
+    r.chunkDigests.clear();
 
     states[1].modTime_sec = 0x93400031;
     states[1].modTime_nsec = 0xdeadbeef;
@@ -1034,7 +1231,7 @@ backup_helper_test_four()
     static const unsigned char correct_data[] = {
         // header
         0x53, 0x6e, 0x61, 0x70,  0x04, 0x00, 0x00, 0x00,
-        0x46, 0x69, 0x6c, 0x65,  0xbc, 0x00, 0x00, 0x00,
+        0x46, 0x69, 0x6c, 0x32,  0xd4, 0x00, 0x00, 0x00,
 
         // bytes_of_padding
         0x98, 0xba, 0xdc, 0xfe,  0xef, 0xbe, 0xad, 0xde,
@@ -1042,6 +1239,8 @@ backup_helper_test_four()
         0x78, 0x56, 0x34, 0x12,  0x10, 0x00, 0x00, 0x00,
         0x62, 0x79, 0x74, 0x65,  0x73, 0x5f, 0x6f, 0x66,
         0x5f, 0x70, 0x61, 0x64,  0x64, 0x69, 0x6e, 0x67,
+        0x02, 0x00, 0x00, 0x00,  0x11, 0x11, 0x11, 0x11,
+        0x22, 0x22, 0x22, 0x22,
 
         // bytes_of_padding3
         0x31, 0x00, 0x40, 0x93,  0xef, 0xbe, 0xad, 0xde,
@@ -1049,7 +1248,7 @@ backup_helper_test_four()
         0x22, 0x44, 0x33, 0x22,  0x11, 0x00, 0x00, 0x00,
         0x62, 0x79, 0x74, 0x65,  0x73, 0x5f, 0x6f, 0x66,
         0x5f, 0x70, 0x61, 0x64,  0x64, 0x69, 0x6e, 0x67,
-        0x33, 0xab, 0xab, 0xab,
+        0x33, 0xab, 0xab, 0xab,  0x00, 0x00, 0x00, 0x00,
 
         // bytes of padding2
         0x44, 0x11, 0x22, 0x33,  0xef, 0xbe, 0xad, 0xde,
@@ -1057,7 +1256,7 @@ backup_helper_test_four()
         0x34, 0x23, 0x12, 0x01,  0x12, 0x00, 0x00, 0x00,
         0x62, 0x79, 0x74, 0x65,  0x73, 0x5f, 0x6f, 0x66,
         0x5f, 0x70, 0x61, 0x64,  0x64, 0x69, 0x6e, 0x67,
-        0x5f, 0x32, 0xab, 0xab,
+        0x5f, 0x32, 0xab, 0xab,  0x00, 0x00, 0x00, 0x00,
 
         // bytes of padding3
         0x44, 0x11, 0x22, 0x33,  0xef, 0xbe, 0xad, 0xde,
@@ -1065,7 +1264,7 @@ backup_helper_test_four()
         0x34, 0x23, 0x12, 0x01,  0x13, 0x00, 0x00, 0x00,
         0x62, 0x79, 0x74, 0x65,  0x73, 0x5f, 0x6f, 0x66,
         0x5f, 0x70, 0x61, 0x64,  0x64, 0x69, 0x6e, 0x67,
-        0x5f, 0x5f, 0x31, 0xab
+        0x5f, 0x5f, 0x31, 0xab,  0x00, 0x00, 0x00, 0x00
     };
 
     err = compare_file(filename, correct_data, sizeof(correct_data));
@@ -1081,7 +1280,7 @@ backup_helper_test_four()
     }
 
 
-    KeyedVector<String8,FileState> readSnapshot;
+    KeyedVector<String8,FileRec> readSnapshot;
     err = read_snapshot_file(fd, &readSnapshot);
     if (err != 0) {
         fprintf(stderr, "read_snapshot_file failed %d\n", err);
@@ -1093,10 +1292,18 @@ backup_helper_test_four()
         return 1;
     }
 
+    if (readSnapshot.valueAt(0).chunkDigests.size() != 2
+            || readSnapshot.valueAt(0).chunkDigests[0] != 0x11111111
+            || readSnapshot.valueAt(0).chunkDigests[1] != 0x22222222
+            || readSnapshot.valueAt(1).chunkDigests.size() != 0) {
+        fprintf(stderr, "chunk digests did not round trip\n");
+        return 1;
+    }
+
     bool matched = true;
     for (size_t i=0; i<readSnapshot.size(); i++) {
         const String8& name = readSnapshot.keyAt(i);
-        const FileState state = readSnapshot.valueAt(i);
+        const FileState state = readSnapshot.valueAt(i).s;
 
         if (name != filenames[i] || states[i].modTime_sec != state.modTime_sec
                 || states[i].modTime_nsec != state.modTime_nsec || states[i].mode != state.mode
@@ -32,7 +32,7 @@ Chunk ChunkIterator::Next() {
 
   if (len_ != 0) {
     // Prepare the next chunk.
-    if (VerifyNextChunkNonFatal()) {
+    if (VerifyNextChunkNonFatal() && verify_) {
       VerifyNextChunk();
     }
   }
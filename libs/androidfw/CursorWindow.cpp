@@ -20,6 +20,7 @@
 #include <androidfw/CursorWindow.h>
 #include <binder/Parcel.h>
 #include <utils/Log.h>
+#include <utils/Unicode.h>
 
 #include <cutils/ashmem.h>
 #include <sys/mman.h>
@@ -284,6 +285,41 @@ status_t CursorWindow::putString(uint32_t row, uint32_t column, const char* valu
     return putBlobOrString(row, column, value, sizeIncludingNull, FIELD_TYPE_STRING);
 }
 
+status_t CursorWindow::putUtf16String(uint32_t row, uint32_t column, const char16_t* value,
+        size_t len) {
+    if (mReadOnly) {
+        return INVALID_OPERATION;
+    }
+
+    FieldSlot* fieldSlot = getFieldSlot(row, column);
+    if (!fieldSlot) {
+        return BAD_VALUE;
+    }
+
+    ssize_t size = utf16_to_utf8_length(value, len);
+    if (size < 0) {
+        size = 0; // invalid UTF-16 string, store only the terminator
+    }
+    size_t sizeIncludingNull = size + 1;
+
+    uint32_t offset = alloc(sizeIncludingNull);
+    if (!offset) {
+        return NO_MEMORY;
+    }
+
+    char* dest = static_cast<char*>(offsetToPtr(offset));
+    if (size > 0) {
+        utf16_to_utf8(value, len, dest, sizeIncludingNull);
+    } else {
+        *dest = '\0';
+    }
+
+    fieldSlot->type = FIELD_TYPE_STRING;
+    fieldSlot->data.buffer.offset = offset;
+    fieldSlot->data.buffer.size = sizeIncludingNull;
+    return OK;
+}
+
 status_t CursorWindow::putBlobOrString(uint32_t row, uint32_t column,
         const void* value, size_t size, int32_t type) {
     if (mReadOnly) {
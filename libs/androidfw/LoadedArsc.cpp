@@ -262,6 +262,48 @@ const ResTable_entry* LoadedPackage::GetEntryFromOffset(const ResTable_type* typ
                                                  offset + dtohl(type_chunk->entriesStart));
 }
 
+const TypeSpec* LoadedPackage::GetTypeSpecByTypeIndex(uint8_t type_index) const {
+  // If the type IDs are offset in this package, we need to take that into account when searching
+  // for a type.
+  const size_t spec_idx = type_index - type_id_offset_;
+  const TypeSpec* type_spec = type_specs_[spec_idx].get();
+  if (type_spec != nullptr && UNLIKELY(!VerifyTypeChunks(spec_idx))) {
+    return nullptr;
+  }
+  return type_spec;
+}
+
+bool LoadedPackage::VerifyTypeChunks(size_t spec_idx) const {
+  if (!verify_) {
+    return true;
+  }
+
+  std::atomic<uint8_t>& verified = type_chunks_verified_[spec_idx];
+  if (verified.load(std::memory_order_relaxed) != 0) {
+    return true;
+  }
+
+  const TypeSpec* type_spec = type_specs_[spec_idx].get();
+  const auto iter_end = type_spec->types + type_spec->type_count;
+  for (auto iter = type_spec->types; iter != iter_end; ++iter) {
+    if (!VerifyResTableType(*iter)) {
+      return false;
+    }
+  }
+  verified.store(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool LoadedPackage::VerifyAllTypeChunks() const {
+  const size_t type_count = type_specs_.size();
+  for (size_t i = 0; i < type_count; i++) {
+    if (type_specs_[i] != nullptr && !VerifyTypeChunks(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void LoadedPackage::CollectConfigurations(bool exclude_mipmap,
                                           std::set<ResTable_config>* out_configs) const {
   const static std::u16string kMipMap = u"mipmap";
@@ -318,6 +360,36 @@ void LoadedPackage::CollectLocales(bool canonicalize, std::set<std::string>* out
   }
 }
 
+void LoadedPackage::BuildEntryNameIndex() const {
+  const size_t type_count = type_specs_.size();
+  for (size_t spec_idx = 0; spec_idx < type_count; spec_idx++) {
+    const TypeSpec* type_spec = type_specs_[spec_idx].get();
+    if (type_spec == nullptr || !VerifyTypeChunks(spec_idx)) {
+      continue;
+    }
+
+    const auto iter_end = type_spec->types + type_spec->type_count;
+    for (auto iter = type_spec->types; iter != iter_end; ++iter) {
+      const ResTable_type* type = *iter;
+      const size_t entry_count = dtohl(type->entryCount);
+      const uint32_t* entry_offsets = reinterpret_cast<const uint32_t*>(
+          reinterpret_cast<const uint8_t*>(type) + dtohs(type->header.headerSize));
+      for (size_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+        const uint32_t offset = dtohl(entry_offsets[entry_idx]);
+        if (offset == ResTable_type::NO_ENTRY) {
+          continue;
+        }
+        const ResTable_entry* entry = reinterpret_cast<const ResTable_entry*>(
+            reinterpret_cast<const uint8_t*>(type) + dtohl(type->entriesStart) + offset);
+        const uint64_t key = (static_cast<uint64_t>(spec_idx) << 32) | dtohl(entry->key.index);
+        // emplace() keeps the first configuration's entry, matching the old
+        // scan order.
+        entry_name_index_.emplace(key, static_cast<uint16_t>(entry_idx));
+      }
+    }
+  }
+}
+
 uint32_t LoadedPackage::FindEntryByName(const std::u16string& type_name,
                                         const std::u16string& entry_name) const {
   ssize_t type_idx = type_string_pool_.indexOfString(type_name.data(), type_name.size());
@@ -330,31 +402,17 @@ uint32_t LoadedPackage::FindEntryByName(const std::u16string& type_name,
     return 0u;
   }
 
-  const TypeSpec* type_spec = type_specs_[type_idx].get();
-  if (type_spec == nullptr) {
+  std::call_once(entry_name_index_once_, [this]() { BuildEntryNameIndex(); });
+
+  const auto iter = entry_name_index_.find((static_cast<uint64_t>(type_idx) << 32) |
+                                           static_cast<uint32_t>(key_idx));
+  if (iter == entry_name_index_.end()) {
     return 0u;
   }
 
-  const auto iter_end = type_spec->types + type_spec->type_count;
-  for (auto iter = type_spec->types; iter != iter_end; ++iter) {
-    const ResTable_type* type = *iter;
-    size_t entry_count = dtohl(type->entryCount);
-    for (size_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
-      const uint32_t* entry_offsets = reinterpret_cast<const uint32_t*>(
-          reinterpret_cast<const uint8_t*>(type) + dtohs(type->header.headerSize));
-      const uint32_t offset = dtohl(entry_offsets[entry_idx]);
-      if (offset != ResTable_type::NO_ENTRY) {
-        const ResTable_entry* entry = reinterpret_cast<const ResTable_entry*>(
-            reinterpret_cast<const uint8_t*>(type) + dtohl(type->entriesStart) + offset);
-        if (dtohl(entry->key.index) == static_cast<uint32_t>(key_idx)) {
-          // The package ID will be overridden by the caller (due to runtime assignment of package
-          // IDs for shared libraries).
-          return make_resid(0x00, type_idx + type_id_offset_ + 1, entry_idx);
-        }
-      }
-    }
-  }
-  return 0u;
+  // The package ID will be overridden by the caller (due to runtime assignment of package
+  // IDs for shared libraries).
+  return make_resid(0x00, type_idx + type_id_offset_ + 1, iter->second);
 }
 
 const LoadedPackage* LoadedArsc::GetPackageById(uint8_t package_id) const {
@@ -368,9 +426,11 @@ const LoadedPackage* LoadedArsc::GetPackageById(uint8_t package_id) const {
 
 std::unique_ptr<const LoadedPackage> LoadedPackage::Load(const Chunk& chunk,
                                                          const LoadedIdmap* loaded_idmap,
-                                                         bool system, bool load_as_shared_library) {
+                                                         bool system, bool load_as_shared_library,
+                                                         bool verify) {
   ATRACE_NAME("LoadedPackage::Load");
   std::unique_ptr<LoadedPackage> loaded_package(new LoadedPackage());
+  loaded_package->verify_ = verify;
 
   // typeIdOffset was added at some point, but we still must recognize apps built before this
   // was added.
@@ -414,7 +474,7 @@ std::unique_ptr<const LoadedPackage> LoadedPackage::Load(const Chunk& chunk,
   // contiguous block of memory that holds all the Types together with the TypeSpec.
   std::unordered_map<int, std::unique_ptr<TypeSpecPtrBuilder>> type_builder_map;
 
-  ChunkIterator iter(chunk.data_ptr(), chunk.data_size());
+  ChunkIterator iter(chunk.data_ptr(), chunk.data_size(), verify);
   while (iter.HasNext()) {
     const Chunk child_chunk = iter.Next();
     switch (child_chunk.type()) {
@@ -501,10 +561,14 @@ std::unique_ptr<const LoadedPackage> LoadedPackage::Load(const Chunk& chunk,
           return {};
         }
 
-        if (!VerifyResTableType(type)) {
+        if (type->id == 0) {
+          LOG(ERROR) << "RES_TABLE_TYPE_TYPE has invalid ID 0.";
           return {};
         }
 
+        // The rest of the verification of this chunk (entry count and offset tables) is
+        // deferred until the type is first looked up. See VerifyTypeChunks().
+
         // Type chunks must be preceded by their TypeSpec chunks.
         std::unique_ptr<TypeSpecPtrBuilder>& builder_ptr = type_builder_map[type->id - 1];
         if (builder_ptr != nullptr) {
@@ -589,7 +653,7 @@ std::unique_ptr<const LoadedPackage> LoadedPackage::Load(const Chunk& chunk,
 }
 
 bool LoadedArsc::LoadTable(const Chunk& chunk, const LoadedIdmap* loaded_idmap,
-                           bool load_as_shared_library) {
+                           bool load_as_shared_library, bool verify) {
   const ResTable_header* header = chunk.header<ResTable_header>();
   if (header == nullptr) {
     LOG(ERROR) << "RES_TABLE_TYPE too small.";
@@ -601,7 +665,7 @@ bool LoadedArsc::LoadTable(const Chunk& chunk, const LoadedIdmap* loaded_idmap,
 
   packages_.reserve(package_count);
 
-  ChunkIterator iter(chunk.data_ptr(), chunk.data_size());
+  ChunkIterator iter(chunk.data_ptr(), chunk.data_size(), verify);
   while (iter.HasNext()) {
     const Chunk child_chunk = iter.Next();
     switch (child_chunk.type()) {
@@ -628,7 +692,7 @@ bool LoadedArsc::LoadTable(const Chunk& chunk, const LoadedIdmap* loaded_idmap,
         packages_seen++;
 
         std::unique_ptr<const LoadedPackage> loaded_package =
-            LoadedPackage::Load(child_chunk, loaded_idmap, system_, load_as_shared_library);
+            LoadedPackage::Load(child_chunk, loaded_idmap, system_, load_as_shared_library, verify);
         if (!loaded_package) {
           return false;
         }
@@ -652,19 +716,19 @@ bool LoadedArsc::LoadTable(const Chunk& chunk, const LoadedIdmap* loaded_idmap,
 
 std::unique_ptr<const LoadedArsc> LoadedArsc::Load(const StringPiece& data,
                                                    const LoadedIdmap* loaded_idmap, bool system,
-                                                   bool load_as_shared_library) {
+                                                   bool load_as_shared_library, bool verify) {
   ATRACE_NAME("LoadedArsc::LoadTable");
 
   // Not using make_unique because the constructor is private.
   std::unique_ptr<LoadedArsc> loaded_arsc(new LoadedArsc());
   loaded_arsc->system_ = system;
 
-  ChunkIterator iter(data.data(), data.size());
+  ChunkIterator iter(data.data(), data.size(), verify);
   while (iter.HasNext()) {
     const Chunk chunk = iter.Next();
     switch (chunk.type()) {
       case RES_TABLE_TYPE:
-        if (!loaded_arsc->LoadTable(chunk, loaded_idmap, load_as_shared_library)) {
+        if (!loaded_arsc->LoadTable(chunk, loaded_idmap, load_as_shared_library, verify)) {
           return {};
         }
         break;
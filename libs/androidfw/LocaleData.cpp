@@ -19,8 +19,6 @@
 #include <cstdlib>
 #include <cstring>
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
 
 #include <androidfw/LocaleData.h>
 
@@ -49,10 +47,10 @@ uint32_t findParent(uint32_t packed_locale, const char* script) {
     if (hasRegion(packed_locale)) {
         for (size_t i = 0; i < SCRIPT_PARENTS_COUNT; i++) {
             if (memcmp(script, SCRIPT_PARENTS[i].script, SCRIPT_LENGTH) == 0) {
-                auto map = SCRIPT_PARENTS[i].map;
-                auto lookup_result = map->find(packed_locale);
-                if (lookup_result != map->end()) {
-                    return lookup_result->second;
+                const LocaleParentEntry* entry =
+                        localeParentLookup(*SCRIPT_PARENTS[i].map, packed_locale);
+                if (entry != nullptr) {
+                    return entry->parent;
                 }
                 break;
             }
@@ -119,7 +117,7 @@ inline bool isRepresentative(uint32_t language_and_region, const char* script) {
             (((uint64_t) script[2]) <<  8u) |
             ((uint64_t) script[3]));
 
-    return (REPRESENTATIVE_LOCALES.count(packed_locale) != 0);
+    return representativeLocaleLookup(packed_locale);
 }
 
 const uint32_t US_SPANISH = 0x65735553lu; // es-US
@@ -204,14 +202,14 @@ void localeDataComputeScript(char out[4], const char* language, const char* regi
         return;
     }
     uint32_t lookup_key = packLocale(language, region);
-    auto lookup_result = LIKELY_SCRIPTS.find(lookup_key);
-    if (lookup_result == LIKELY_SCRIPTS.end()) {
+    const LikelyScriptEntry* lookup_result = likelyScriptLookup(lookup_key);
+    if (lookup_result == nullptr) {
         // We couldn't find the locale. Let's try without the region
         if (region[0] != '\0') {
             lookup_key = dropRegion(lookup_key);
-            lookup_result = LIKELY_SCRIPTS.find(lookup_key);
-            if (lookup_result != LIKELY_SCRIPTS.end()) {
-                memcpy(out, SCRIPT_CODES[lookup_result->second], SCRIPT_LENGTH);
+            lookup_result = likelyScriptLookup(lookup_key);
+            if (lookup_result != nullptr) {
+                memcpy(out, SCRIPT_CODES[lookup_result->script], SCRIPT_LENGTH);
                 return;
             }
         }
@@ -220,7 +218,7 @@ void localeDataComputeScript(char out[4], const char* language, const char* regi
         return;
     } else {
         // We found the locale.
-        memcpy(out, SCRIPT_CODES[lookup_result->second], SCRIPT_LENGTH);
+        memcpy(out, SCRIPT_CODES[lookup_result->script], SCRIPT_LENGTH);
     }
 }
 
@@ -1,5 +1,4 @@
 // Auto-generated by ./tools/localedata/extract_icu_data.py
-
 const char SCRIPT_CODES[][4] = {
     /* 0  */ {'A', 'h', 'o', 'm'},
     /* 1  */ {'A', 'r', 'a', 'b'},
@@ -92,2232 +91,3717 @@ const char SCRIPT_CODES[][4] = {
     /* 88 */ {'~', '~', '~', 'B'},
 };
 
+// The tables below are displacement-based perfect hash tables: a lookup mixes
+// the key once to pick a per-bucket salt, mixes again with that salt to land
+// on the key's unique slot, and does one key compare. Every query is a
+// constant two dependent loads, there are no collision chains, and the tables
+// live in .rodata with no dynamic initialization.
 
-const std::unordered_map<uint32_t, uint8_t> LIKELY_SCRIPTS({
-    {0x61610000u, 40u}, // aa -> Latn
-    {0xA0000000u, 40u}, // aai -> Latn
-    {0xA8000000u, 40u}, // aak -> Latn
-    {0xD0000000u, 40u}, // aau -> Latn
-    {0x61620000u, 15u}, // ab -> Cyrl
-    {0xA0200000u, 40u}, // abi -> Latn
-    {0xC4200000u, 40u}, // abr -> Latn
-    {0xCC200000u, 40u}, // abt -> Latn
-    {0xE0200000u, 40u}, // aby -> Latn
-    {0x8C400000u, 40u}, // acd -> Latn
-    {0x90400000u, 40u}, // ace -> Latn
-    {0x9C400000u, 40u}, // ach -> Latn
-    {0x80600000u, 40u}, // ada -> Latn
-    {0x90600000u, 40u}, // ade -> Latn
-    {0xA4600000u, 40u}, // adj -> Latn
-    {0xE0600000u, 15u}, // ady -> Cyrl
-    {0xE4600000u, 40u}, // adz -> Latn
-    {0x61650000u,  4u}, // ae -> Avst
-    {0x84800000u,  1u}, // aeb -> Arab
-    {0xE0800000u, 40u}, // aey -> Latn
-    {0x61660000u, 40u}, // af -> Latn
-    {0x88C00000u, 40u}, // agc -> Latn
+constexpr uint32_t perfectHashSlot(uint64_t key, uint32_t salt, uint32_t mask) {
+    uint64_t h = (key + salt + 1u) * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 32u;
+    h *= 0xC2B2AE3D27D4EB4Full;
+    h ^= h >> 29u;
+    return static_cast<uint32_t>(h & mask);
+}
+
+struct LikelyScriptEntry {
+    uint32_t key;
+    uint8_t script;
+};
+
+struct LocaleParentEntry {
+    uint32_t key;
+    uint32_t parent;
+};
+
+struct LocaleParentTable {
+    uint32_t mask;
+    const uint16_t* salts;
+    const LocaleParentEntry* slots;
+};
+const uint32_t LIKELY_SCRIPTS_MASK = 0x7FFu;
+const uint16_t LIKELY_SCRIPTS_SALTS[2048] = {
+    2u, 0u, 1u, 1u, 1u, 0u, 1u, 4u, 0u, 0u, 2u, 3u,
+    0u, 0u, 0u, 3u, 0u, 3u, 1u, 0u, 1u, 0u, 0u, 0u,
+    1u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 1u, 0u, 2u,
+    2u, 1u, 3u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u,
+    5u, 0u, 0u, 3u, 0u, 1u, 0u, 6u, 0u, 0u, 0u, 2u,
+    2u, 0u, 2u, 0u, 0u, 1u, 3u, 0u, 0u, 2u, 1u, 0u,
+    1u, 1u, 0u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 0u,
+    0u, 0u, 0u, 2u, 1u, 3u, 1u, 1u, 1u, 0u, 0u, 1u,
+    0u, 1u, 1u, 0u, 2u, 0u, 0u, 0u, 0u, 6u, 1u, 0u,
+    0u, 0u, 0u, 2u, 0u, 2u, 1u, 0u, 3u, 3u, 0u, 1u,
+    1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 10u, 7u, 1u,
+    1u, 0u, 0u, 0u, 4u, 1u, 3u, 0u, 0u, 0u, 3u, 0u,
+    0u, 0u, 0u, 3u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 2u,
+    3u, 0u, 1u, 0u, 0u, 3u, 0u, 0u, 0u, 0u, 2u, 1u,
+    5u, 0u, 0u, 0u, 2u, 1u, 0u, 0u, 1u, 1u, 2u, 0u,
+    4u, 1u, 0u, 0u, 0u, 1u, 1u, 0u, 3u, 0u, 0u, 0u,
+    3u, 0u, 0u, 2u, 0u, 3u, 1u, 0u, 0u, 2u, 0u, 0u,
+    0u, 1u, 1u, 3u, 1u, 1u, 2u, 0u, 3u, 2u, 1u, 1u,
+    1u, 3u, 3u, 0u, 1u, 1u, 1u, 0u, 0u, 17u, 1u, 0u,
+    6u, 1u, 0u, 1u, 0u, 0u, 1u, 3u, 0u, 0u, 2u, 0u,
+    1u, 1u, 0u, 0u, 0u, 0u, 2u, 0u, 0u, 1u, 1u, 0u,
+    1u, 0u, 0u, 1u, 0u, 3u, 1u, 1u, 0u, 5u, 1u, 0u,
+    0u, 0u, 0u, 0u, 1u, 1u, 1u, 0u, 1u, 2u, 0u, 1u,
+    0u, 1u, 0u, 0u, 0u, 1u, 0u, 2u, 3u, 0u, 1u, 1u,
+    2u, 2u, 0u, 1u, 0u, 6u, 0u, 2u, 2u, 0u, 0u, 1u,
+    1u, 0u, 3u, 1u, 2u, 3u, 2u, 4u, 1u, 0u, 1u, 1u,
+    1u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 2u, 2u, 1u,
+    0u, 0u, 2u, 3u, 1u, 0u, 0u, 1u, 1u, 1u, 3u, 0u,
+    0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 3u, 2u, 1u,
+    2u, 2u, 1u, 0u, 0u, 0u, 0u, 2u, 1u, 0u, 0u, 0u,
+    0u, 0u, 1u, 0u, 1u, 3u, 0u, 4u, 2u, 0u, 0u, 0u,
+    0u, 0u, 1u, 2u, 0u, 3u, 1u, 0u, 0u, 1u, 2u, 1u,
+    1u, 0u, 2u, 0u, 2u, 1u, 2u, 0u, 1u, 1u, 0u, 0u,
+    4u, 0u, 4u, 0u, 0u, 7u, 1u, 0u, 0u, 0u, 1u, 1u,
+    0u, 0u, 0u, 0u, 4u, 1u, 0u, 0u, 2u, 0u, 1u, 0u,
+    0u, 0u, 0u, 2u, 3u, 0u, 1u, 2u, 0u, 0u, 0u, 0u,
+    1u, 0u, 0u, 1u, 1u, 0u, 0u, 1u, 0u, 3u, 0u, 4u,
+    1u, 2u, 4u, 1u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u,
+    0u, 0u, 0u, 5u, 0u, 2u, 0u, 3u, 2u, 0u, 0u, 3u,
+    1u, 1u, 2u, 2u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 1u,
+    0u, 0u, 2u, 2u, 1u, 0u, 2u, 0u, 0u, 1u, 1u, 0u,
+    5u, 0u, 0u, 1u, 0u, 4u, 0u, 2u, 0u, 0u, 0u, 2u,
+    2u, 0u, 0u, 0u, 2u, 1u, 0u, 0u, 2u, 0u, 1u, 3u,
+    2u, 2u, 1u, 0u, 3u, 0u, 1u, 0u, 0u, 0u, 0u, 1u,
+    1u, 0u, 1u, 0u, 1u, 3u, 1u, 1u, 0u, 4u, 0u, 1u,
+    0u, 0u, 1u, 1u, 1u, 1u, 0u, 4u, 0u, 0u, 0u, 0u,
+    0u, 6u, 1u, 2u, 0u, 5u, 0u, 0u, 0u, 0u, 0u, 2u,
+    0u, 0u, 0u, 0u, 3u, 0u, 0u, 3u, 0u, 0u, 0u, 1u,
+    1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u,
+    0u, 0u, 0u, 0u, 1u, 2u, 2u, 6u, 2u, 1u, 3u, 2u,
+    1u, 0u, 1u, 0u, 0u, 3u, 0u, 0u, 1u, 0u, 0u, 0u,
+    0u, 0u, 1u, 1u, 0u, 0u, 2u, 0u, 0u, 1u, 0u, 0u,
+    0u, 1u, 2u, 1u, 0u, 0u, 0u, 2u, 0u, 1u, 1u, 0u,
+    0u, 0u, 0u, 3u, 0u, 0u, 2u, 2u, 0u, 0u, 7u, 9u,
+    0u, 0u, 1u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u,
+    0u, 1u, 0u, 1u, 0u, 1u, 1u, 1u, 2u, 2u, 0u, 0u,
+    1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+    0u, 3u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+    3u, 0u, 0u, 1u, 2u, 1u, 1u, 2u, 0u, 0u, 3u, 0u,
+    0u, 0u, 0u, 2u, 2u, 2u, 0u, 2u, 0u, 1u, 0u, 0u,
+    6u, 0u, 2u, 1u, 0u, 0u, 1u, 0u, 0u, 1u, 2u, 2u,
+    3u, 2u, 2u, 3u, 0u, 0u, 2u, 2u, 0u, 1u, 0u, 0u,
+    5u, 0u, 3u, 1u, 3u, 0u, 0u, 2u, 2u, 0u, 0u, 0u,
+    0u, 2u, 0u, 2u, 0u, 1u, 0u, 0u, 0u, 5u, 0u, 3u,
+    2u, 0u, 3u, 8u, 1u, 0u, 1u, 1u, 1u, 1u, 1u, 0u,
+    2u, 7u, 1u, 0u, 2u, 0u, 0u, 0u, 1u, 0u, 0u, 1u,
+    0u, 2u, 0u, 2u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 2u,
+    4u, 0u, 0u, 1u, 1u, 3u, 0u, 1u, 0u, 1u, 0u, 1u,
+    6u, 0u, 1u, 0u, 1u, 0u, 0u, 3u, 0u, 1u, 1u, 1u,
+    0u, 3u, 0u, 0u, 1u, 1u, 0u, 0u, 2u, 2u, 1u, 1u,
+    0u, 0u, 0u, 1u, 1u, 2u, 0u, 1u, 3u, 0u, 2u, 6u,
+    1u, 1u, 3u, 0u, 0u, 1u, 3u, 5u, 2u, 0u, 2u, 0u,
+    1u, 0u, 0u, 1u, 1u, 0u, 0u, 1u, 1u, 0u, 1u, 2u,
+    0u, 1u, 1u, 1u, 0u, 1u, 0u, 1u, 1u, 0u, 0u, 1u,
+    7u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 2u, 7u, 0u, 2u,
+    2u, 0u, 4u, 2u, 0u, 1u, 0u, 0u, 1u, 0u, 1u, 1u,
+    0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 1u, 0u, 0u,
+    1u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u,
+    0u, 1u, 0u, 1u, 0u, 2u, 0u, 1u, 3u, 0u, 7u, 2u,
+    0u, 2u, 2u, 0u, 2u, 1u, 0u, 0u, 0u, 2u, 1u, 0u,
+    2u, 2u, 1u, 0u, 2u, 1u, 0u, 4u, 3u, 0u, 0u, 0u,
+    0u, 0u, 0u, 1u, 0u, 1u, 2u, 0u, 5u, 0u, 0u, 1u,
+    1u, 1u, 0u, 0u, 2u, 2u, 1u, 3u, 1u, 1u, 1u, 2u,
+    1u, 0u, 2u, 0u, 1u, 2u, 0u, 0u, 2u, 0u, 0u, 0u,
+    2u, 0u, 1u, 0u, 3u, 1u, 1u, 0u, 1u, 1u, 3u, 0u,
+    1u, 0u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 0u, 1u, 1u, 0u, 1u, 1u, 1u, 2u, 0u, 0u, 2u,
+    0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 1u, 0u, 0u, 7u,
+    0u, 0u, 0u, 6u, 2u, 1u, 2u, 1u, 1u, 0u, 1u, 6u,
+    1u, 0u, 5u, 3u, 1u, 0u, 0u, 0u, 3u, 0u, 0u, 1u,
+    2u, 0u, 2u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 2u, 2u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 2u,
+    0u, 1u, 0u, 2u, 1u, 0u, 2u, 0u, 1u, 1u, 0u, 0u,
+    0u, 0u, 1u, 2u, 0u, 0u, 0u, 0u, 6u, 4u, 0u, 0u,
+    1u, 3u, 0u, 1u, 2u, 0u, 0u, 1u, 1u, 1u, 1u, 8u,
+    1u, 0u, 0u, 1u, 1u, 3u, 0u, 1u, 2u, 1u, 0u, 2u,
+    0u, 0u, 1u, 0u, 1u, 0u, 1u, 2u, 1u, 0u, 2u, 2u,
+    1u, 1u, 3u, 6u, 0u, 0u, 0u, 1u, 0u, 0u, 2u, 1u,
+    0u, 1u, 4u, 0u, 0u, 2u, 1u, 0u, 1u, 0u, 1u, 0u,
+    2u, 0u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 2u,
+    1u, 1u, 2u, 0u, 1u, 0u, 0u, 1u, 0u, 1u, 1u, 3u,
+    0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 0u, 2u, 0u, 1u, 0u, 0u, 0u, 1u, 0u, 1u, 1u,
+    0u, 4u, 0u, 1u, 2u, 1u, 0u, 2u, 0u, 1u, 1u, 0u,
+    1u, 1u, 0u, 0u, 3u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 1u, 0u, 1u, 1u, 4u, 0u, 0u, 1u, 0u, 3u, 0u,
+    0u, 0u, 0u, 1u, 0u, 2u, 4u, 2u, 0u, 0u, 0u, 0u,
+    0u, 1u, 2u, 0u, 1u, 2u, 0u, 1u, 0u, 5u, 0u, 0u,
+    1u, 0u, 1u, 0u, 0u, 0u, 1u, 1u, 2u, 0u, 9u, 0u,
+    1u, 0u, 4u, 3u, 2u, 0u, 2u, 3u, 4u, 1u, 0u, 0u,
+    0u, 0u, 0u, 1u, 0u, 5u, 1u, 0u, 1u, 1u, 1u, 1u,
+    0u, 0u, 0u, 0u, 0u, 4u, 0u, 1u, 4u, 0u, 0u, 0u,
+    1u, 2u, 1u, 0u, 0u, 0u, 2u, 0u, 1u, 0u, 1u, 1u,
+    0u, 4u, 1u, 1u, 0u, 0u, 3u, 1u, 0u, 0u, 0u, 0u,
+    1u, 0u, 0u, 3u, 1u, 0u, 4u, 0u, 1u, 0u, 1u, 0u,
+    0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 3u, 4u, 0u, 0u,
+    1u, 1u, 2u, 0u, 1u, 0u, 0u, 1u, 0u, 1u, 1u, 1u,
+    0u, 0u, 0u, 1u, 8u, 0u, 0u, 1u, 0u, 0u, 2u, 3u,
+    1u, 0u, 0u, 2u, 0u, 1u, 3u, 2u, 2u, 1u, 1u, 0u,
+    2u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 1u,
+    0u, 0u, 1u, 1u, 9u, 0u, 1u, 0u, 0u, 0u, 0u, 1u,
+    0u, 0u, 0u, 2u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 2u,
+    1u, 1u, 0u, 1u, 1u, 0u, 1u, 0u, 1u, 1u, 1u, 0u,
+    1u, 2u, 2u, 1u, 0u, 2u, 1u, 1u, 5u, 3u, 2u, 0u,
+    1u, 5u, 0u, 7u, 0u, 0u, 0u, 3u, 1u, 1u, 1u, 0u,
+    1u, 2u, 0u, 0u, 2u, 1u, 0u, 0u, 1u, 1u, 0u, 2u,
+    1u, 2u, 2u, 0u, 2u, 0u, 1u, 0u, 0u, 0u, 0u, 0u,
+    1u, 0u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 2u,
+    1u, 0u, 1u, 1u, 0u, 0u, 0u, 2u, 4u, 1u, 3u, 1u,
+    0u, 0u, 0u, 5u, 1u, 0u, 0u, 1u, 1u, 1u, 4u, 1u,
+    1u, 0u, 6u, 1u, 1u, 2u, 0u, 1u, 0u, 1u, 0u, 0u,
+    1u, 1u, 0u, 0u, 1u, 0u, 1u, 1u, 1u, 4u, 0u, 2u,
+    0u, 2u, 9u, 1u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 0u,
+    5u, 0u, 0u, 0u, 1u, 1u, 5u, 1u, 1u, 1u, 2u, 0u,
+    1u, 4u, 1u, 0u, 0u, 0u, 3u, 0u, 1u, 0u, 0u, 0u,
+    0u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 0u,
+    1u, 0u, 0u, 2u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 2u,
+    1u, 1u, 1u, 0u, 2u, 0u, 2u, 2u, 2u, 1u, 0u, 1u,
+    0u, 0u, 2u, 4u, 5u, 1u, 0u, 0u, 0u, 0u, 2u, 3u,
+    0u, 2u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 0u,
+    1u, 0u, 0u, 1u, 0u, 1u, 2u, 2u, 0u, 0u, 0u, 0u,
+    1u, 1u, 0u, 0u, 0u, 5u, 0u, 0u, 2u, 0u, 1u, 1u,
+    3u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 3u, 2u, 1u,
+    4u, 8u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 1u,
+    0u, 0u, 0u, 1u, 0u, 0u, 1u, 1u, 1u, 1u, 1u, 0u,
+    0u, 0u, 0u, 0u, 1u, 0u, 3u, 2u, 1u, 3u, 0u, 0u,
+    1u, 0u, 2u, 6u, 0u, 0u, 0u, 0u, 0u, 2u, 1u, 0u,
+    1u, 0u, 0u, 1u, 1u, 2u, 1u, 1u, 0u, 0u, 0u, 1u,
+    3u, 1u, 1u, 1u, 1u, 5u, 0u, 0u, 0u, 0u, 0u, 1u,
+    1u, 0u, 0u, 2u, 1u, 2u, 0u, 1u, 0u, 0u, 1u, 0u,
+    1u, 0u, 2u, 0u, 1u, 0u, 6u, 2u, 0u, 0u, 2u, 1u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u,
+    1u, 0u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 2u, 2u, 0u,
+    1u, 2u, 1u, 0u, 1u, 0u, 0u, 3u, 1u, 0u, 1u, 0u,
+    1u, 0u, 0u, 2u, 0u, 1u, 5u, 0u, 0u, 3u, 1u, 0u,
+    0u, 0u, 0u, 3u, 1u, 0u, 0u, 5u, 0u, 0u, 0u, 1u,
+    1u, 0u, 0u, 0u, 2u, 0u, 1u, 2u, 1u, 1u, 1u, 0u,
+    2u, 1u, 1u, 0u, 3u, 3u, 1u, 3u, 0u, 0u, 0u, 0u,
+    2u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u,
+    3u, 0u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u,
+    0u, 0u, 2u, 0u, 1u, 0u, 2u, 0u, 0u, 2u, 0u, 0u,
+    0u, 0u, 1u, 2u, 0u, 0u, 0u, 0u, 2u, 0u, 0u, 0u,
+    0u, 2u, 0u, 0u, 0u, 0u, 0u, 2u, 2u, 0u, 0u, 0u,
+    0u, 0u, 0u, 0u, 2u, 0u, 0u, 6u, 4u, 0u, 0u, 2u,
+    0u, 0u, 1u, 0u, 0u, 1u, 5u, 0u, 0u, 0u, 0u, 0u,
+    0u, 1u, 0u, 1u, 1u, 1u, 0u, 0u, 8u, 1u, 1u, 4u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 2u,
+    0u, 0u, 1u, 2u, 0u, 1u, 0u, 0u, 2u, 0u, 1u, 1u,
+    2u, 1u, 0u, 1u, 0u, 0u, 0u, 1u, 6u, 1u, 1u, 0u,
+    0u, 0u, 1u, 0u, 0u, 2u, 0u, 0u,
+};
+
+const LikelyScriptEntry LIKELY_SCRIPTS_SLOTS[2048] = {
+    {0x00000000u, 0u},
     {0x8CC00000u, 40u}, // agd -> Latn
-    {0x98C00000u, 40u}, // agg -> Latn
-    {0xB0C00000u, 40u}, // agm -> Latn
-    {0xB8C00000u, 40u}, // ago -> Latn
-    {0xC0C00000u, 40u}, // agq -> Latn
-    {0x80E00000u, 40u}, // aha -> Latn
-    {0xACE00000u, 40u}, // ahl -> Latn
-    {0xB8E00000u,  0u}, // aho -> Ahom
-    {0x99200000u, 40u}, // ajg -> Latn
-    {0x616B0000u, 40u}, // ak -> Latn
-    {0xA9400000u, 85u}, // akk -> Xsux
-    {0x81600000u, 40u}, // ala -> Latn
-    {0xA1600000u, 40u}, // ali -> Latn
-    {0xB5600000u, 40u}, // aln -> Latn
-    {0xCD600000u, 15u}, // alt -> Cyrl
-    {0x616D0000u, 18u}, // am -> Ethi
-    {0xB1800000u, 40u}, // amm -> Latn
+    {0x6B6B4146u, 1u}, // kk-AF -> Arab
+    {0xE0670000u, 18u}, // hdy -> Ethi
+    {0x00000000u, 0u},
+    {0x6D6E0000u, 15u}, // mn -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xCD050000u, 40u}, // fit -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x61620000u, 15u}, // ab -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x944D0000u, 40u}, // ncf -> Latn
+    {0x00000000u, 0u},
+    {0x6B6B434Eu, 1u}, // kk-CN -> Arab
+    {0x00000000u, 0u},
+    {0xCC6A0000u, 80u}, // kdt -> Thai
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x84CD0000u, 40u}, // ngb -> Latn
+    {0x00000000u, 0u},
+    {0x726D0000u, 40u}, // rm -> Latn
+    {0xA50A0000u, 40u}, // kij -> Latn
+    {0xAD120000u, 40u}, // sil -> Latn
     {0xB5800000u, 40u}, // amn -> Latn
-    {0xB9800000u, 40u}, // amo -> Latn
-    {0xBD800000u, 40u}, // amp -> Latn
-    {0x89A00000u, 40u}, // anc -> Latn
-    {0xA9A00000u, 40u}, // ank -> Latn
-    {0xB5A00000u, 40u}, // ann -> Latn
-    {0xE1A00000u, 40u}, // any -> Latn
-    {0xA5C00000u, 40u}, // aoj -> Latn
-    {0xB1C00000u, 40u}, // aom -> Latn
-    {0xE5C00000u, 40u}, // aoz -> Latn
-    {0x89E00000u,  1u}, // apc -> Arab
-    {0x8DE00000u,  1u}, // apd -> Arab
-    {0x91E00000u, 40u}, // ape -> Latn
-    {0xC5E00000u, 40u}, // apr -> Latn
-    {0xC9E00000u, 40u}, // aps -> Latn
-    {0xE5E00000u, 40u}, // apz -> Latn
-    {0x61720000u,  1u}, // ar -> Arab
-    {0x61725842u, 88u}, // ar-XB -> ~~~B
-    {0x8A200000u,  2u}, // arc -> Armi
-    {0x9E200000u, 40u}, // arh -> Latn
-    {0xB6200000u, 40u}, // arn -> Latn
-    {0xBA200000u, 40u}, // aro -> Latn
-    {0xC2200000u,  1u}, // arq -> Arab
-    {0xE2200000u,  1u}, // ary -> Arab
-    {0xE6200000u,  1u}, // arz -> Arab
-    {0x61730000u,  7u}, // as -> Beng
-    {0x82400000u, 40u}, // asa -> Latn
-    {0x92400000u, 68u}, // ase -> Sgnw
-    {0x9A400000u, 40u}, // asg -> Latn
-    {0xBA400000u, 40u}, // aso -> Latn
-    {0xCE400000u, 40u}, // ast -> Latn
-    {0x82600000u, 40u}, // ata -> Latn
-    {0x9A600000u, 40u}, // atg -> Latn
-    {0xA6600000u, 40u}, // atj -> Latn
-    {0xE2800000u, 40u}, // auy -> Latn
-    {0x61760000u, 15u}, // av -> Cyrl
-    {0xAEA00000u,  1u}, // avl -> Arab
-    {0xB6A00000u, 40u}, // avn -> Latn
-    {0xCEA00000u, 40u}, // avt -> Latn
-    {0xD2A00000u, 40u}, // avu -> Latn
-    {0x82C00000u, 16u}, // awa -> Deva
-    {0x86C00000u, 40u}, // awb -> Latn
-    {0xBAC00000u, 40u}, // awo -> Latn
-    {0xDEC00000u, 40u}, // awx -> Latn
-    {0x61790000u, 40u}, // ay -> Latn
-    {0x87000000u, 40u}, // ayb -> Latn
-    {0x617A0000u, 40u}, // az -> Latn
-    {0x617A4951u,  1u}, // az-IQ -> Arab
-    {0x617A4952u,  1u}, // az-IR -> Arab
-    {0x617A5255u, 15u}, // az-RU -> Cyrl
-    {0x62610000u, 15u}, // ba -> Cyrl
-    {0xAC010000u,  1u}, // bal -> Arab
-    {0xB4010000u, 40u}, // ban -> Latn
-    {0xBC010000u, 16u}, // bap -> Deva
-    {0xC4010000u, 40u}, // bar -> Latn
-    {0xC8010000u, 40u}, // bas -> Latn
-    {0xD4010000u, 40u}, // bav -> Latn
-    {0xDC010000u,  5u}, // bax -> Bamu
-    {0x80210000u, 40u}, // bba -> Latn
-    {0x84210000u, 40u}, // bbb -> Latn
-    {0x88210000u, 40u}, // bbc -> Latn
+    {0xC9750000u, 40u}, // vls -> Latn
+    {0xB8D30000u, 40u}, // tgo -> Latn
+    {0xBC320000u, 40u}, // sbp -> Latn
+    {0x73720000u, 15u}, // sr -> Cyrl
+    {0x00000000u, 0u},
+    {0x8E810000u, 40u}, // bud -> Latn
+    {0xCE890000u, 40u}, // jut -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC8520000u, 40u}, // scs -> Latn
+    {0x00000000u, 0u},
+    {0xC8970000u, 40u}, // xes -> Latn
+    {0x00000000u, 0u},
+    {0xDD480000u, 40u}, // ikx -> Latn
+    {0xC98F0000u, 40u}, // pms -> Latn
+    {0x81070000u, 40u}, // hia -> Latn
+    {0x984A0000u, 40u}, // kcg -> Latn
+    {0x676C0000u, 40u}, // gl -> Latn
+    {0xB0070000u, 40u}, // ham -> Latn
+    {0x83390000u, 40u}, // zza -> Latn
+    {0x00000000u, 0u},
+    {0x908C0000u, 40u}, // mee -> Latn
+    {0xB8E20000u, 40u}, // cho -> Latn
+    {0xAA560000u, 40u}, // wsk -> Latn
+    {0x00000000u, 0u},
+    {0x94920000u, 40u}, // sef -> Latn
+    {0x00000000u, 0u},
+    {0x880D0000u, 40u}, // nac -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x61720000u, 1u}, // ar -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB50D0000u, 40u}, // nin -> Latn
+    {0xCAC80000u, 40u}, // iws -> Latn
+    {0xE2520000u, 40u}, // ssy -> Latn
+    {0x90660000u, 40u}, // gde -> Latn
+    {0xB4D10000u, 40u}, // rgn -> Latn
+    {0x8E520000u, 40u}, // ssd -> Latn
+    {0xC9C60000u, 40u}, // gos -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC6730000u, 40u}, // ttr -> Latn
+    {0x00000000u, 0u},
+    {0xB4130000u, 40u}, // tan -> Latn
+    {0xC0360000u, 77u}, // wbq -> Telu
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9A530000u, 40u}, // tsg -> Latn
+    {0x736F0000u, 40u}, // so -> Latn
+    {0xAE2A0000u, 40u}, // krl -> Latn
+    {0x00000000u, 0u},
+    {0xA80C0000u, 40u}, // mak -> Latn
+    {0xB4160000u, 40u}, // wan -> Latn
+    {0x00000000u, 0u},
+    {0x8C930000u, 40u}, // ted -> Latn
+    {0x82EA0000u, 40u}, // kxa -> Latn
+    {0x00000000u, 0u},
+    {0xC5F70000u, 63u}, // xpr -> Prti
+    {0xE0CC0000u, 40u}, // mgy -> Latn
+    {0x860A0000u, 40u}, // kqb -> Latn
+    {0xC2850000u, 40u}, // fuq -> Latn
+    {0xB0740000u, 15u}, // udm -> Cyrl
+    {0x00000000u, 0u},
+    {0x950C0000u, 40u}, // mif -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x84050000u, 40u}, // fab -> Latn
+    {0x62730000u, 40u}, // bs -> Latn
+    {0x8E8A0000u, 40u}, // kud -> Latn
+    {0x88720000u, 40u}, // sdc -> Latn
+    {0xD5860000u, 18u}, // gmv -> Ethi
+    {0x00000000u, 0u},
     {0x8C210000u, 40u}, // bbd -> Latn
-    {0xA4210000u, 40u}, // bbj -> Latn
-    {0xBC210000u, 40u}, // bbp -> Latn
-    {0xC4210000u, 40u}, // bbr -> Latn
-    {0x94410000u, 40u}, // bcf -> Latn
-    {0x9C410000u, 40u}, // bch -> Latn
-    {0xA0410000u, 40u}, // bci -> Latn
-    {0xB0410000u, 40u}, // bcm -> Latn
-    {0xB4410000u, 40u}, // bcn -> Latn
-    {0xB8410000u, 40u}, // bco -> Latn
-    {0xC0410000u, 18u}, // bcq -> Ethi
+    {0xCC200000u, 40u}, // abt -> Latn
+    {0xC8D20000u, 40u}, // sgs -> Latn
     {0xD0410000u, 40u}, // bcu -> Latn
-    {0x8C610000u, 40u}, // bdd -> Latn
-    {0x62650000u, 15u}, // be -> Cyrl
-    {0x94810000u, 40u}, // bef -> Latn
-    {0x9C810000u, 40u}, // beh -> Latn
-    {0xA4810000u,  1u}, // bej -> Arab
-    {0xB0810000u, 40u}, // bem -> Latn
-    {0xCC810000u, 40u}, // bet -> Latn
-    {0xD8810000u, 40u}, // bew -> Latn
-    {0xDC810000u, 40u}, // bex -> Latn
-    {0xE4810000u, 40u}, // bez -> Latn
-    {0x8CA10000u, 40u}, // bfd -> Latn
-    {0xC0A10000u, 74u}, // bfq -> Taml
-    {0xCCA10000u,  1u}, // bft -> Arab
-    {0xE0A10000u, 16u}, // bfy -> Deva
-    {0x62670000u, 15u}, // bg -> Cyrl
-    {0x88C10000u, 16u}, // bgc -> Deva
-    {0xB4C10000u,  1u}, // bgn -> Arab
-    {0xDCC10000u, 21u}, // bgx -> Grek
-    {0x84E10000u, 16u}, // bhb -> Deva
-    {0x98E10000u, 40u}, // bhg -> Latn
-    {0xA0E10000u, 16u}, // bhi -> Deva
-    {0xA8E10000u, 40u}, // bhk -> Latn
-    {0xACE10000u, 40u}, // bhl -> Latn
-    {0xB8E10000u, 16u}, // bho -> Deva
-    {0xE0E10000u, 40u}, // bhy -> Latn
-    {0x62690000u, 40u}, // bi -> Latn
+    {0x00000000u, 0u},
+    {0x69740000u, 40u}, // it -> Latn
+    {0x81600000u, 40u}, // ala -> Latn
+    {0xB4C10000u, 1u}, // bgn -> Arab
+    {0xC4660000u, 40u}, // gdr -> Latn
+    {0xB1860000u, 40u}, // gmm -> Latn
+    {0xB1120000u, 40u}, // sim -> Latn
+    {0x00000000u, 0u},
+    {0x9F280000u, 40u}, // izh -> Latn
+    {0xC9AE0000u, 40u}, // ons -> Latn
+    {0xD6330000u, 40u}, // trv -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE0380000u, 40u}, // yby -> Latn
+    {0xA62A0000u, 40u}, // krj -> Latn
+    {0x7061504Bu, 1u}, // pa-PK -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE2AC0000u, 1u}, // mvy -> Arab
+    {0xD0000000u, 40u}, // aau -> Latn
+    {0x00000000u, 0u},
+    {0xB4C60000u, 16u}, // ggn -> Deva
+    {0x76690000u, 40u}, // vi -> Latn
+    {0x00000000u, 0u},
+    {0xAC130000u, 40u}, // tal -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB9680000u, 40u}, // ilo -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x79690000u, 27u}, // yi -> Hebr
+    {0x00000000u, 0u},
+    {0xE6EA0000u, 40u}, // kxz -> Latn
+    {0x8C330000u, 40u}, // tbd -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6B790000u, 15u}, // ky -> Cyrl
+    {0x862D0000u, 40u}, // nrb -> Latn
+    {0x00000000u, 0u},
+    {0xDA420000u, 9u}, // csw -> Cans
+    {0x8A6C0000u, 40u}, // mtc -> Latn
+    {0x00000000u, 0u},
+    {0xCA230000u, 18u}, // drs -> Ethi
+    {0x8C8C0000u, 40u}, // med -> Latn
+    {0x00000000u, 0u},
+    {0x9DA80000u, 15u}, // inh -> Cyrl
+    {0xE72C0000u, 40u}, // mzz -> Latn
+    {0xC9EC0000u, 40u}, // mps -> Latn
+    {0x00000000u, 0u},
     {0x85010000u, 40u}, // bib -> Latn
-    {0x99010000u, 40u}, // big -> Latn
-    {0xA9010000u, 40u}, // bik -> Latn
-    {0xB1010000u, 40u}, // bim -> Latn
-    {0xB5010000u, 40u}, // bin -> Latn
-    {0xB9010000u, 40u}, // bio -> Latn
-    {0xC1010000u, 40u}, // biq -> Latn
-    {0x9D210000u, 40u}, // bjh -> Latn
-    {0xA1210000u, 18u}, // bji -> Ethi
-    {0xA5210000u, 16u}, // bjj -> Deva
-    {0xB5210000u, 40u}, // bjn -> Latn
-    {0xB9210000u, 40u}, // bjo -> Latn
-    {0xC5210000u, 40u}, // bjr -> Latn
-    {0xE5210000u, 40u}, // bjz -> Latn
-    {0x89410000u, 40u}, // bkc -> Latn
-    {0xB1410000u, 40u}, // bkm -> Latn
-    {0xC1410000u, 40u}, // bkq -> Latn
-    {0xD1410000u, 40u}, // bku -> Latn
-    {0xD5410000u, 40u}, // bkv -> Latn
-    {0xCD610000u, 76u}, // blt -> Tavt
-    {0x626D0000u, 40u}, // bm -> Latn
-    {0x9D810000u, 40u}, // bmh -> Latn
-    {0xA9810000u, 40u}, // bmk -> Latn
-    {0xC1810000u, 40u}, // bmq -> Latn
-    {0xD1810000u, 40u}, // bmu -> Latn
-    {0x626E0000u,  7u}, // bn -> Beng
-    {0x99A10000u, 40u}, // bng -> Latn
-    {0xB1A10000u, 40u}, // bnm -> Latn
-    {0xBDA10000u, 40u}, // bnp -> Latn
-    {0x626F0000u, 81u}, // bo -> Tibt
-    {0xA5C10000u, 40u}, // boj -> Latn
-    {0xB1C10000u, 40u}, // bom -> Latn
-    {0xB5C10000u, 40u}, // bon -> Latn
-    {0xE1E10000u,  7u}, // bpy -> Beng
-    {0x8A010000u, 40u}, // bqc -> Latn
-    {0xA2010000u,  1u}, // bqi -> Arab
-    {0xBE010000u, 40u}, // bqp -> Latn
-    {0xD6010000u, 40u}, // bqv -> Latn
-    {0x62720000u, 40u}, // br -> Latn
-    {0x82210000u, 16u}, // bra -> Deva
-    {0x9E210000u,  1u}, // brh -> Arab
-    {0xDE210000u, 16u}, // brx -> Deva
-    {0xE6210000u, 40u}, // brz -> Latn
-    {0x62730000u, 40u}, // bs -> Latn
-    {0xA6410000u, 40u}, // bsj -> Latn
-    {0xC2410000u,  6u}, // bsq -> Bass
-    {0xCA410000u, 40u}, // bss -> Latn
-    {0xCE410000u, 18u}, // bst -> Ethi
-    {0xBA610000u, 40u}, // bto -> Latn
-    {0xCE610000u, 40u}, // btt -> Latn
-    {0xD6610000u, 16u}, // btv -> Deva
-    {0x82810000u, 15u}, // bua -> Cyrl
-    {0x8A810000u, 40u}, // buc -> Latn
-    {0x8E810000u, 40u}, // bud -> Latn
-    {0x9A810000u, 40u}, // bug -> Latn
-    {0xAA810000u, 40u}, // buk -> Latn
-    {0xB2810000u, 40u}, // bum -> Latn
-    {0xBA810000u, 40u}, // buo -> Latn
-    {0xCA810000u, 40u}, // bus -> Latn
-    {0xD2810000u, 40u}, // buu -> Latn
-    {0x86A10000u, 40u}, // bvb -> Latn
-    {0x8EC10000u, 40u}, // bwd -> Latn
-    {0xC6C10000u, 40u}, // bwr -> Latn
-    {0x9EE10000u, 40u}, // bxh -> Latn
-    {0x93010000u, 40u}, // bye -> Latn
-    {0xB7010000u, 18u}, // byn -> Ethi
-    {0xC7010000u, 40u}, // byr -> Latn
-    {0xCB010000u, 40u}, // bys -> Latn
-    {0xD7010000u, 40u}, // byv -> Latn
-    {0xDF010000u, 40u}, // byx -> Latn
-    {0x83210000u, 40u}, // bza -> Latn
+    {0xC6920000u, 40u}, // sur -> Latn
+    {0x00000000u, 0u},
+    {0xAE0C0000u, 40u}, // mql -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x940D0000u, 40u}, // naf -> Latn
+    {0x00000000u, 0u},
+    {0x806C0000u, 40u}, // mda -> Latn
+    {0x00000000u, 0u},
+    {0xB5920000u, 40u}, // smn -> Latn
+    {0xBED20000u, 40u}, // swp -> Latn
     {0x93210000u, 40u}, // bze -> Latn
-    {0x97210000u, 40u}, // bzf -> Latn
-    {0x9F210000u, 40u}, // bzh -> Latn
-    {0xDB210000u, 40u}, // bzw -> Latn
-    {0x63610000u, 40u}, // ca -> Latn
-    {0xB4020000u, 40u}, // can -> Latn
-    {0xA4220000u, 40u}, // cbj -> Latn
-    {0x9C420000u, 40u}, // cch -> Latn
-    {0xBC420000u,  7u}, // ccp -> Beng
-    {0x63650000u, 15u}, // ce -> Cyrl
-    {0x84820000u, 40u}, // ceb -> Latn
-    {0x80A20000u, 40u}, // cfa -> Latn
-    {0x98C20000u, 40u}, // cgg -> Latn
-    {0x63680000u, 40u}, // ch -> Latn
-    {0xA8E20000u, 40u}, // chk -> Latn
-    {0xB0E20000u, 15u}, // chm -> Cyrl
-    {0xB8E20000u, 40u}, // cho -> Latn
-    {0xBCE20000u, 40u}, // chp -> Latn
-    {0xC4E20000u, 12u}, // chr -> Cher
-    {0x81220000u,  1u}, // cja -> Arab
-    {0xB1220000u, 11u}, // cjm -> Cham
-    {0xD5220000u, 40u}, // cjv -> Latn
-    {0x85420000u,  1u}, // ckb -> Arab
-    {0xAD420000u, 40u}, // ckl -> Latn
-    {0xB9420000u, 40u}, // cko -> Latn
-    {0xE1420000u, 40u}, // cky -> Latn
-    {0x81620000u, 40u}, // cla -> Latn
-    {0x91820000u, 40u}, // cme -> Latn
-    {0x636F0000u, 40u}, // co -> Latn
-    {0xBDC20000u, 13u}, // cop -> Copt
-    {0xC9E20000u, 40u}, // cps -> Latn
-    {0x63720000u,  9u}, // cr -> Cans
-    {0xA6220000u,  9u}, // crj -> Cans
-    {0xAA220000u,  9u}, // crk -> Cans
-    {0xAE220000u,  9u}, // crl -> Cans
-    {0xB2220000u,  9u}, // crm -> Cans
-    {0xCA220000u, 40u}, // crs -> Latn
-    {0x63730000u, 40u}, // cs -> Latn
-    {0x86420000u, 40u}, // csb -> Latn
-    {0xDA420000u,  9u}, // csw -> Cans
-    {0x8E620000u, 59u}, // ctd -> Pauc
-    {0x63750000u, 15u}, // cu -> Cyrl
-    {0x63760000u, 15u}, // cv -> Cyrl
-    {0x63790000u, 40u}, // cy -> Latn
-    {0x64610000u, 40u}, // da -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x8C0C0000u, 40u}, // mad -> Latn
+    {0x8D870000u, 62u}, // hmd -> Plrd
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6D6C0000u, 49u}, // ml -> Mlym
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x826E0000u, 1u}, // ota -> Arab
+    {0x00000000u, 0u},
+    {0x8DA60000u, 40u}, // gnd -> Latn
+    {0x00000000u, 0u},
+    {0x92D70000u, 40u}, // xwe -> Latn
+    {0x8E850000u, 40u}, // fud -> Latn
+    {0xC0EA0000u, 40u}, // khq -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xDAEA0000u, 40u}, // kxw -> Latn
+    {0x776F0000u, 40u}, // wo -> Latn
+    {0xE1A00000u, 40u}, // any -> Latn
+    {0x7A684D59u, 25u}, // zh-MY -> Hant
+    {0xDF0C0000u, 40u}, // myx -> Latn
+    {0x74740000u, 15u}, // tt -> Cyrl
+    {0x00000000u, 0u},
+    {0xB8180000u, 40u}, // yao -> Latn
+    {0xCC4A0000u, 40u}, // kct -> Latn
+    {0xB50C0000u, 40u}, // min -> Latn
+    {0x7A68564Eu, 25u}, // zh-VN -> Hant
+    {0xC2720000u, 40u}, // stq -> Latn
+    {0x70740000u, 40u}, // pt -> Latn
+    {0x00000000u, 0u},
+    {0xB6950000u, 40u}, // vun -> Latn
+    {0x6D740000u, 40u}, // mt -> Latn
+    {0xBDEC0000u, 40u}, // mpp -> Latn
+    {0x8DC60000u, 40u}, // god -> Latn
+    {0x00000000u, 0u},
+    {0x88330000u, 40u}, // tbc -> Latn
+    {0xD8ED0000u, 40u}, // nhw -> Latn
+    {0xB5AF0000u, 40u}, // pnn -> Latn
+    {0xA9B20000u, 40u}, // snk -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x81CC0000u, 40u}, // moa -> Latn
+    {0xCA050000u, 40u}, // fqs -> Latn
+    {0x6D734944u, 1u}, // ms-ID -> Arab
     {0x8C030000u, 40u}, // dad -> Latn
-    {0x94030000u, 40u}, // daf -> Latn
-    {0x98030000u, 40u}, // dag -> Latn
-    {0x9C030000u, 40u}, // dah -> Latn
-    {0xA8030000u, 40u}, // dak -> Latn
-    {0xC4030000u, 15u}, // dar -> Cyrl
-    {0xD4030000u, 40u}, // dav -> Latn
-    {0x8C230000u, 40u}, // dbd -> Latn
+    {0xD1910000u, 40u}, // rmu -> Latn
+    {0x61650000u, 4u}, // ae -> Avst
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0xC0230000u, 40u}, // dbq -> Latn
-    {0x88430000u,  1u}, // dcc -> Arab
-    {0xB4630000u, 40u}, // ddn -> Latn
-    {0x64650000u, 40u}, // de -> Latn
-    {0x8C830000u, 40u}, // ded -> Latn
-    {0xB4830000u, 40u}, // den -> Latn
-    {0x80C30000u, 40u}, // dga -> Latn
-    {0x9CC30000u, 40u}, // dgh -> Latn
-    {0xA0C30000u, 40u}, // dgi -> Latn
-    {0xACC30000u,  1u}, // dgl -> Arab
-    {0xC4C30000u, 40u}, // dgr -> Latn
-    {0xE4C30000u, 40u}, // dgz -> Latn
-    {0x81030000u, 40u}, // dia -> Latn
-    {0x91230000u, 40u}, // dje -> Latn
-    {0xA5A30000u, 40u}, // dnj -> Latn
-    {0x85C30000u, 40u}, // dob -> Latn
-    {0xA1C30000u,  1u}, // doi -> Arab
-    {0xBDC30000u, 40u}, // dop -> Latn
-    {0xD9C30000u, 40u}, // dow -> Latn
-    {0xA2230000u, 40u}, // dri -> Latn
-    {0xCA230000u, 18u}, // drs -> Ethi
+    {0xB1A10000u, 40u}, // bnm -> Latn
+    {0xA32D0000u, 40u}, // nzi -> Latn
+    {0xE0060000u, 40u}, // gay -> Latn
+    {0x00000000u, 0u},
+    {0xB8AC0000u, 40u}, // mfo -> Latn
+    {0x00000000u, 0u},
+    {0xD2960000u, 24u}, // wuu -> Hans
+    {0xB40C0000u, 40u}, // man -> Latn
+    {0xD1810000u, 40u}, // bmu -> Latn
+    {0x687A0000u, 40u}, // hz -> Latn
+    {0xD1C80000u, 40u}, // iou -> Latn
+    {0x6D790000u, 52u}, // my -> Mymr
+    {0xB5260000u, 40u}, // gjn -> Latn
+    {0x00000000u, 0u},
+    {0xA0150000u, 83u}, // vai -> Vaii
+    {0x00000000u, 0u},
+    {0xBD850000u, 40u}, // fmp -> Latn
+    {0xD54E0000u, 40u}, // okv -> Latn
+    {0xC92A0000u, 40u}, // kjs -> Latn
+    {0xB8C90000u, 40u}, // jgo -> Latn
+    {0x00000000u, 0u},
+    {0x75720000u, 1u}, // ur -> Arab
+    {0x816F0000u, 40u}, // pla -> Latn
+    {0x6A690000u, 27u}, // ji -> Hebr
+    {0x00000000u, 0u},
+    {0x6D690000u, 40u}, // mi -> Latn
+    {0xACCC0000u, 40u}, // mgl -> Latn
+    {0xC02A0000u, 40u}, // kbq -> Latn
     {0x86430000u, 40u}, // dsb -> Latn
-    {0xB2630000u, 40u}, // dtm -> Latn
-    {0xBE630000u, 40u}, // dtp -> Latn
-    {0xCA630000u, 40u}, // dts -> Latn
-    {0xE2630000u, 16u}, // dty -> Deva
-    {0x82830000u, 40u}, // dua -> Latn
-    {0x8A830000u, 40u}, // duc -> Latn
-    {0x8E830000u, 40u}, // dud -> Latn
-    {0x9A830000u, 40u}, // dug -> Latn
-    {0x64760000u, 79u}, // dv -> Thaa
-    {0x82A30000u, 40u}, // dva -> Latn
-    {0xDAC30000u, 40u}, // dww -> Latn
-    {0xBB030000u, 40u}, // dyo -> Latn
-    {0xD3030000u, 40u}, // dyu -> Latn
-    {0x647A0000u, 81u}, // dz -> Tibt
-    {0x9B230000u, 40u}, // dzg -> Latn
-    {0xD0240000u, 40u}, // ebu -> Latn
-    {0x65650000u, 40u}, // ee -> Latn
-    {0xA0A40000u, 40u}, // efi -> Latn
-    {0xACC40000u, 40u}, // egl -> Latn
-    {0xE0C40000u, 17u}, // egy -> Egyp
-    {0xE1440000u, 32u}, // eky -> Kali
-    {0x656C0000u, 21u}, // el -> Grek
-    {0x81840000u, 40u}, // ema -> Latn
-    {0xA1840000u, 40u}, // emi -> Latn
-    {0x656E0000u, 40u}, // en -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB5A70000u, 40u}, // hnn -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x82920000u, 40u}, // sua -> Latn
+    {0x00000000u, 0u},
+    {0x9EE10000u, 40u}, // bxh -> Latn
+    {0xD0340000u, 40u}, // ubu -> Latn
+    {0xB3330000u, 40u}, // tzm -> Latn
+    {0x6B754952u, 1u}, // ku-IR -> Arab
+    {0x61660000u, 40u}, // af -> Latn
+    {0xC6570000u, 16u}, // xsr -> Deva
+    {0x736D0000u, 40u}, // sm -> Latn
+    {0xA46C0000u, 40u}, // mdj -> Latn
+    {0x00000000u, 0u},
+    {0x80D40000u, 82u}, // uga -> Ugar
+    {0x00000000u, 0u},
     {0x656E5841u, 87u}, // en-XA -> ~~~A
-    {0xB5A40000u, 40u}, // enn -> Latn
-    {0xC1A40000u, 40u}, // enq -> Latn
-    {0x656F0000u, 40u}, // eo -> Latn
-    {0xA2240000u, 40u}, // eri -> Latn
+    {0x9F2B0000u, 24u}, // lzh -> Hans
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x94510000u, 40u}, // rcf -> Latn
+    {0xDE210000u, 16u}, // brx -> Deva
+    {0x00000000u, 0u},
+    {0x86D20000u, 1u}, // swb -> Arab
+    {0xD1260000u, 1u}, // gju -> Arab
+    {0x00000000u, 0u},
+    {0xE4180000u, 40u}, // yaz -> Latn
+    {0x99A10000u, 40u}, // bng -> Latn
+    {0xD5220000u, 40u}, // cjv -> Latn
+    {0xD9480000u, 40u}, // ikw -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9D810000u, 40u}, // bmh -> Latn
+    {0x00000000u, 0u},
+    {0xDEC00000u, 40u}, // awx -> Latn
+    {0xC48C0000u, 40u}, // mer -> Latn
+    {0x617A4952u, 1u}, // az-IR -> Arab
+    {0x00000000u, 0u},
     {0x65730000u, 40u}, // es -> Latn
-    {0xD2440000u, 40u}, // esu -> Latn
-    {0x65740000u, 40u}, // et -> Latn
-    {0xC6640000u, 40u}, // etr -> Latn
-    {0xCE640000u, 30u}, // ett -> Ital
-    {0xD2640000u, 40u}, // etu -> Latn
-    {0xDE640000u, 40u}, // etx -> Latn
-    {0x65750000u, 40u}, // eu -> Latn
-    {0xBAC40000u, 40u}, // ewo -> Latn
-    {0xCEE40000u, 40u}, // ext -> Latn
-    {0x66610000u,  1u}, // fa -> Arab
+    {0xC4E20000u, 12u}, // chr -> Cher
+    {0x9C6C0000u, 40u}, // mdh -> Latn
+    {0xDA340000u, 40u}, // urw -> Latn
+    {0x89890000u, 40u}, // jmc -> Latn
+    {0x8AC60000u, 1u}, // gwc -> Arab
+    {0x74730000u, 40u}, // ts -> Latn
+    {0xAC910000u, 40u}, // rel -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x90C80000u, 40u}, // ige -> Latn
+    {0xC5530000u, 40u}, // tkr -> Latn
+    {0x00000000u, 0u},
+    {0xC90B0000u, 43u}, // lis -> Lisu
+    {0xD6960000u, 40u}, // wuv -> Latn
+    {0x617A5255u, 15u}, // az-RU -> Cyrl
+    {0x00000000u, 0u},
+    {0xC2200000u, 1u}, // arq -> Arab
+    {0x00000000u, 0u},
+    {0xD7010000u, 40u}, // byv -> Latn
+    {0xA26C0000u, 40u}, // mti -> Latn
+    {0x81030000u, 40u}, // dia -> Latn
+    {0x7A684746u, 25u}, // zh-GF -> Hant
+    {0x00000000u, 0u},
+    {0x7A684742u, 25u}, // zh-GB -> Hant
+    {0xD0290000u, 40u}, // jbu -> Latn
+    {0x98330000u, 40u}, // tbg -> Latn
+    {0x00000000u, 0u},
+    {0xD08B0000u, 40u}, // leu -> Latn
+    {0xB4830000u, 40u}, // den -> Latn
+    {0xA0D60000u, 40u}, // wgi -> Latn
+    {0xCA810000u, 40u}, // bus -> Latn
+    {0xC80C0000u, 40u}, // mas -> Latn
+    {0x00000000u, 0u},
+    {0xA1B60000u, 1u}, // wni -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xDE8D0000u, 40u}, // nux -> Latn
+    {0xE4330000u, 40u}, // tbz -> Latn
+    {0x6861434Du, 1u}, // ha-CM -> Arab
+    {0x00000000u, 0u},
+    {0x6E760000u, 40u}, // nv -> Latn
+    {0x824E0000u, 58u}, // osa -> Osge
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6E620000u, 40u}, // nb -> Latn
+    {0xACC40000u, 40u}, // egl -> Latn
+    {0x966C0000u, 40u}, // mtf -> Latn
+    {0x85D60000u, 40u}, // wob -> Latn
+    {0x86470000u, 40u}, // hsb -> Latn
+    {0x95EA0000u, 40u}, // kpf -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xAA810000u, 40u}, // buk -> Latn
     {0x80050000u, 40u}, // faa -> Latn
-    {0x84050000u, 40u}, // fab -> Latn
-    {0x98050000u, 40u}, // fag -> Latn
-    {0xA0050000u, 40u}, // fai -> Latn
-    {0xB4050000u, 40u}, // fan -> Latn
-    {0x66660000u, 40u}, // ff -> Latn
-    {0xA0A50000u, 40u}, // ffi -> Latn
-    {0xB0A50000u, 40u}, // ffm -> Latn
-    {0x66690000u, 40u}, // fi -> Latn
-    {0x81050000u,  1u}, // fia -> Arab
-    {0xAD050000u, 40u}, // fil -> Latn
-    {0xCD050000u, 40u}, // fit -> Latn
-    {0x666A0000u, 40u}, // fj -> Latn
-    {0xC5650000u, 40u}, // flr -> Latn
-    {0xBD850000u, 40u}, // fmp -> Latn
-    {0x666F0000u, 40u}, // fo -> Latn
-    {0x8DC50000u, 40u}, // fod -> Latn
-    {0xB5C50000u, 40u}, // fon -> Latn
-    {0xC5C50000u, 40u}, // for -> Latn
-    {0x91E50000u, 40u}, // fpe -> Latn
-    {0xCA050000u, 40u}, // fqs -> Latn
-    {0x66720000u, 40u}, // fr -> Latn
-    {0x8A250000u, 40u}, // frc -> Latn
-    {0xBE250000u, 40u}, // frp -> Latn
-    {0xC6250000u, 40u}, // frr -> Latn
-    {0xCA250000u, 40u}, // frs -> Latn
-    {0x86850000u,  1u}, // fub -> Arab
-    {0x8E850000u, 40u}, // fud -> Latn
-    {0x92850000u, 40u}, // fue -> Latn
-    {0x96850000u, 40u}, // fuf -> Latn
-    {0x9E850000u, 40u}, // fuh -> Latn
-    {0xC2850000u, 40u}, // fuq -> Latn
-    {0xC6850000u, 40u}, // fur -> Latn
-    {0xD6850000u, 40u}, // fuv -> Latn
-    {0xE2850000u, 40u}, // fuy -> Latn
+    {0xAA720000u, 40u}, // stk -> Latn
+    {0x64610000u, 40u}, // da -> Latn
+    {0xA4220000u, 40u}, // cbj -> Latn
+    {0xBE630000u, 40u}, // dtp -> Latn
+    {0x7A684944u, 25u}, // zh-ID -> Hant
+    {0x9E200000u, 40u}, // arh -> Latn
+    {0xDF010000u, 40u}, // byx -> Latn
+    {0x73650000u, 40u}, // se -> Latn
+    {0x00000000u, 0u},
+    {0x616B0000u, 40u}, // ak -> Latn
+    {0xBC8B0000u, 41u}, // lep -> Lepc
+    {0xA4130000u, 16u}, // taj -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x696B0000u, 40u}, // ik -> Latn
+    {0x00000000u, 0u},
+    {0x80480000u, 40u}, // ica -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x82AC0000u, 40u}, // mva -> Latn
+    {0x6C6F0000u, 39u}, // lo -> Laoo
+    {0x00000000u, 0u},
+    {0xA9010000u, 40u}, // bik -> Latn
+    {0x8C0B0000u, 27u}, // lad -> Hebr
+    {0x99120000u, 40u}, // sig -> Latn
+    {0x6C760000u, 40u}, // lv -> Latn
+    {0xD6D20000u, 16u}, // swv -> Deva
+    {0x00000000u, 0u},
+    {0x98070000u, 40u}, // hag -> Latn
+    {0xD04C0000u, 40u}, // mcu -> Latn
+    {0x00000000u, 0u},
+    {0x80AC0000u, 1u}, // mfa -> Arab
+    {0x00000000u, 0u},
+    {0xB98B0000u, 40u}, // lmo -> Latn
+    {0x706C0000u, 40u}, // pl -> Latn
+    {0x75674B5Au, 15u}, // ug-KZ -> Cyrl
+    {0x00000000u, 0u},
+    {0xA9A00000u, 40u}, // ank -> Latn
+    {0x00000000u, 0u},
+    {0x980F0000u, 40u}, // pag -> Latn
+    {0xC7120000u, 71u}, // syr -> Syrc
+    {0xCE730000u, 40u}, // ttt -> Latn
+    {0x91230000u, 40u}, // dje -> Latn
+    {0xB1AD0000u, 40u}, // nnm -> Latn
+    {0x63610000u, 40u}, // ca -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE0530000u, 36u}, // tcy -> Knda
+    {0x6B6F0000u, 37u}, // ko -> Kore
+    {0xD18C0000u, 40u}, // mmu -> Latn
+    {0x00000000u, 0u},
+    {0xE5CB0000u, 40u}, // loz -> Latn
+    {0xBA810000u, 40u}, // buo -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB04B0000u, 40u}, // lcm -> Latn
+    {0x848D0000u, 40u}, // neb -> Latn
+    {0xB5D70000u, 40u}, // xon -> Latn
+    {0x85090000u, 40u}, // jib -> Latn
+    {0xAF320000u, 40u}, // szl -> Latn
+    {0xB9910000u, 40u}, // rmo -> Latn
+    {0x880A0000u, 40u}, // kac -> Latn
+    {0x00000000u, 0u},
+    {0x80280000u, 40u}, // iba -> Latn
+    {0xA6220000u, 9u}, // crj -> Cans
+    {0x7A68424Eu, 25u}, // zh-BN -> Hant
+    {0x73724D45u, 40u}, // sr-ME -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0xC6A50000u, 40u}, // fvr -> Latn
-    {0x66790000u, 40u}, // fy -> Latn
-    {0x67610000u, 40u}, // ga -> Latn
-    {0x80060000u, 40u}, // gaa -> Latn
-    {0x94060000u, 40u}, // gaf -> Latn
-    {0x98060000u, 40u}, // gag -> Latn
-    {0x9C060000u, 40u}, // gah -> Latn
-    {0xA4060000u, 40u}, // gaj -> Latn
-    {0xB0060000u, 40u}, // gam -> Latn
-    {0xB4060000u, 24u}, // gan -> Hans
+    {0xA9260000u, 1u}, // gjk -> Arab
+    {0x00000000u, 0u},
+    {0xA1600000u, 40u}, // ali -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xDA460000u, 40u}, // gsw -> Latn
+    {0x6B6D0000u, 35u}, // km -> Khmr
+    {0xE4600000u, 40u}, // adz -> Latn
+    {0xC0AC0000u, 40u}, // mfq -> Latn
+    {0x00000000u, 0u},
+    {0xC80D0000u, 40u}, // nas -> Latn
+    {0x00000000u, 0u},
+    {0xC8180000u, 40u}, // yas -> Latn
+    {0x00000000u, 0u},
+    {0x6F720000u, 57u}, // or -> Orya
+    {0x6E720000u, 40u}, // nr -> Latn
+    {0x91CC0000u, 40u}, // moe -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x89770000u, 44u}, // xlc -> Lyci
+    {0xB94F0000u, 40u}, // pko -> Latn
+    {0x66720000u, 40u}, // fr -> Latn
+    {0x84820000u, 40u}, // ceb -> Latn
+    {0x8EB30000u, 40u}, // tvd -> Latn
+    {0x00000000u, 0u},
+    {0xC9CA0000u, 40u}, // kos -> Latn
+    {0x85420000u, 1u}, // ckb -> Arab
+    {0x00000000u, 0u},
     {0xD8060000u, 40u}, // gaw -> Latn
-    {0xE0060000u, 40u}, // gay -> Latn
-    {0x94260000u, 40u}, // gbf -> Latn
-    {0xB0260000u, 16u}, // gbm -> Deva
-    {0xE0260000u, 40u}, // gby -> Latn
-    {0xE4260000u,  1u}, // gbz -> Arab
-    {0xC4460000u, 40u}, // gcr -> Latn
-    {0x67640000u, 40u}, // gd -> Latn
-    {0x90660000u, 40u}, // gde -> Latn
-    {0xB4660000u, 40u}, // gdn -> Latn
-    {0xC4660000u, 40u}, // gdr -> Latn
-    {0x84860000u, 40u}, // geb -> Latn
-    {0xA4860000u, 40u}, // gej -> Latn
-    {0xAC860000u, 40u}, // gel -> Latn
-    {0xE4860000u, 18u}, // gez -> Ethi
-    {0xA8A60000u, 40u}, // gfk -> Latn
-    {0xB4C60000u, 16u}, // ggn -> Deva
-    {0xC8E60000u, 40u}, // ghs -> Latn
+    {0xD1AB0000u, 40u}, // lnu -> Latn
     {0xAD060000u, 40u}, // gil -> Latn
-    {0xB1060000u, 40u}, // gim -> Latn
-    {0xA9260000u,  1u}, // gjk -> Arab
-    {0xB5260000u, 40u}, // gjn -> Latn
-    {0xD1260000u,  1u}, // gju -> Arab
-    {0xB5460000u, 40u}, // gkn -> Latn
-    {0xBD460000u, 40u}, // gkp -> Latn
-    {0x676C0000u, 40u}, // gl -> Latn
-    {0xA9660000u,  1u}, // glk -> Arab
-    {0xB1860000u, 40u}, // gmm -> Latn
-    {0xD5860000u, 18u}, // gmv -> Ethi
-    {0x676E0000u, 40u}, // gn -> Latn
-    {0x8DA60000u, 40u}, // gnd -> Latn
-    {0x99A60000u, 40u}, // gng -> Latn
-    {0x8DC60000u, 40u}, // god -> Latn
-    {0x95C60000u, 18u}, // gof -> Ethi
-    {0xA1C60000u, 40u}, // goi -> Latn
-    {0xB1C60000u, 16u}, // gom -> Deva
-    {0xB5C60000u, 77u}, // gon -> Telu
-    {0xC5C60000u, 40u}, // gor -> Latn
-    {0xC9C60000u, 40u}, // gos -> Latn
+    {0x8AD20000u, 40u}, // swc -> Latn
+    {0x6E790000u, 40u}, // ny -> Latn
+    {0x7A684D4Fu, 25u}, // zh-MO -> Hant
+    {0xA0370000u, 40u}, // xbi -> Latn
+    {0xC1810000u, 40u}, // bmq -> Latn
+    {0x906C0000u, 1u}, // mde -> Arab
+    {0x00000000u, 0u},
+    {0x99070000u, 40u}, // hig -> Latn
+    {0xC98A0000u, 40u}, // kms -> Latn
+    {0xE0AA0000u, 16u}, // kfy -> Deva
+    {0xBC4C0000u, 40u}, // mcp -> Latn
+    {0xC1010000u, 40u}, // biq -> Latn
+    {0x62720000u, 40u}, // br -> Latn
+    {0x00000000u, 0u},
     {0xCDC60000u, 20u}, // got -> Goth
-    {0x8A260000u, 14u}, // grc -> Cprt
-    {0xCE260000u,  7u}, // grt -> Beng
-    {0xDA260000u, 40u}, // grw -> Latn
-    {0xDA460000u, 40u}, // gsw -> Latn
-    {0x67750000u, 22u}, // gu -> Gujr
-    {0x86860000u, 40u}, // gub -> Latn
-    {0x8A860000u, 40u}, // guc -> Latn
-    {0x8E860000u, 40u}, // gud -> Latn
-    {0xC6860000u, 40u}, // gur -> Latn
-    {0xDA860000u, 40u}, // guw -> Latn
-    {0xDE860000u, 40u}, // gux -> Latn
-    {0xE6860000u, 40u}, // guz -> Latn
-    {0x67760000u, 40u}, // gv -> Latn
-    {0x96A60000u, 40u}, // gvf -> Latn
-    {0xC6A60000u, 16u}, // gvr -> Deva
-    {0xCAA60000u, 40u}, // gvs -> Latn
-    {0x8AC60000u,  1u}, // gwc -> Arab
-    {0xA2C60000u, 40u}, // gwi -> Latn
-    {0xCEC60000u,  1u}, // gwt -> Arab
-    {0xA3060000u, 40u}, // gyi -> Latn
-    {0x68610000u, 40u}, // ha -> Latn
-    {0x6861434Du,  1u}, // ha-CM -> Arab
-    {0x68615344u,  1u}, // ha-SD -> Arab
-    {0x98070000u, 40u}, // hag -> Latn
-    {0xA8070000u, 24u}, // hak -> Hans
-    {0xB0070000u, 40u}, // ham -> Latn
-    {0xD8070000u, 40u}, // haw -> Latn
-    {0xE4070000u,  1u}, // haz -> Arab
-    {0x84270000u, 40u}, // hbb -> Latn
-    {0xE0670000u, 18u}, // hdy -> Ethi
+    {0xA50D0000u, 40u}, // nij -> Latn
+    {0xD1D20000u, 80u}, // sou -> Thai
+    {0x8CA10000u, 40u}, // bfd -> Latn
+    {0xA88C0000u, 40u}, // mek -> Latn
+    {0x00000000u, 0u},
+    {0xC4010000u, 40u}, // bar -> Latn
+    {0x92980000u, 25u}, // yue -> Hant
+    {0x77610000u, 40u}, // wa -> Latn
+    {0xC0C00000u, 40u}, // agq -> Latn
+    {0x7467504Bu, 1u}, // tg-PK -> Arab
+    {0x90320000u, 40u}, // sbe -> Latn
+    {0xACC30000u, 1u}, // dgl -> Arab
+    {0x00000000u, 0u},
+    {0x6B6B0000u, 15u}, // kk -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x8C230000u, 40u}, // dbd -> Latn
+    {0x6B750000u, 40u}, // ku -> Latn
+    {0x69750000u, 9u}, // iu -> Cans
+    {0x8DA70000u, 1u}, // hnd -> Arab
+    {0xE4260000u, 1u}, // gbz -> Arab
+    {0xC0120000u, 40u}, // saq -> Latn
+    {0x00000000u, 0u},
+    {0xCE400000u, 40u}, // ast -> Latn
+    {0xA9660000u, 1u}, // glk -> Arab
+    {0xC4080000u, 40u}, // iar -> Latn
+    {0xC9920000u, 40u}, // sms -> Latn
+    {0x00000000u, 0u},
+    {0x88210000u, 40u}, // bbc -> Latn
+    {0x95AC0000u, 40u}, // mnf -> Latn
+    {0x00000000u, 0u},
+    {0xA1C60000u, 40u}, // goi -> Latn
+    {0x00000000u, 0u},
+    {0xBD6C0000u, 40u}, // mlp -> Latn
+    {0xB8520000u, 40u}, // sco -> Latn
+    {0xC90C0000u, 26u}, // mis -> Hatr
     {0x68650000u, 27u}, // he -> Hebr
-    {0xE0E70000u, 40u}, // hhy -> Latn
+    {0x88430000u, 1u}, // dcc -> Arab
+    {0x7A68484Bu, 25u}, // zh-HK -> Hant
+    {0xA6730000u, 40u}, // ttj -> Latn
+    {0x00000000u, 0u},
+    {0xB26D0000u, 40u}, // ntm -> Latn
+    {0xB30C0000u, 18u}, // mym -> Ethi
+    {0x00000000u, 0u},
+    {0x80060000u, 40u}, // gaa -> Latn
+    {0xD18A0000u, 40u}, // kmu -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x8A260000u, 14u}, // grc -> Cprt
+    {0x00000000u, 0u},
+    {0x626D0000u, 40u}, // bm -> Latn
+    {0x63730000u, 40u}, // cs -> Latn
+    {0x00000000u, 0u},
+    {0xBC2A0000u, 40u}, // kbp -> Latn
+    {0x00000000u, 0u},
+    {0xAF120000u, 7u}, // syl -> Beng
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xDA530000u, 40u}, // tsw -> Latn
+    {0x00000000u, 0u},
+    {0x63650000u, 15u}, // ce -> Cyrl
+    {0xAA920000u, 40u}, // suk -> Latn
+    {0x00000000u, 0u},
+    {0x78680000u, 40u}, // xh -> Latn
+    {0xA6530000u, 81u}, // tsj -> Tibt
+    {0xC5650000u, 40u}, // flr -> Latn
+    {0x886D0000u, 40u}, // ndc -> Latn
+    {0xA4810000u, 1u}, // bej -> Arab
+    {0xE5F30000u, 40u}, // tpz -> Latn
+    {0xB9210000u, 40u}, // bjo -> Latn
+    {0x828C0000u, 40u}, // mua -> Latn
+    {0xC66C0000u, 16u}, // mtr -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB8E00000u, 0u}, // aho -> Ahom
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x73610000u, 16u}, // sa -> Deva
+    {0x9A600000u, 40u}, // atg -> Latn
+    {0x00000000u, 0u},
+    {0x6B730000u, 1u}, // ks -> Arab
+    {0x00000000u, 0u},
+    {0x89C70000u, 16u}, // hoc -> Deva
+    {0x94410000u, 40u}, // bcf -> Latn
+    {0x00000000u, 0u},
+    {0xB0A50000u, 40u}, // ffm -> Latn
+    {0x00000000u, 0u},
+    {0xB8330000u, 40u}, // tbo -> Latn
+    {0xC4200000u, 40u}, // abr -> Latn
+    {0x9CD90000u, 78u}, // zgh -> Tfng
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x82290000u, 40u}, // jra -> Latn
+    {0xC96C0000u, 40u}, // mls -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x74790000u, 40u}, // ty -> Latn
+    {0xBA130000u, 40u}, // tqo -> Latn
+    {0x00000000u, 0u},
+    {0x9A6B0000u, 40u}, // ltg -> Latn
+    {0xE4C30000u, 40u}, // dgz -> Latn
+    {0xBC420000u, 7u}, // ccp -> Beng
+    {0xB8C00000u, 40u}, // ago -> Latn
+    {0x75670000u, 1u}, // ug -> Arab
+    {0xD82C0000u, 40u}, // mbw -> Latn
+    {0x64650000u, 40u}, // de -> Latn
+    {0x950B0000u, 16u}, // lif -> Deva
+    {0xC1A40000u, 40u}, // enq -> Latn
+    {0xBD460000u, 40u}, // gkp -> Latn
+    {0xCE610000u, 40u}, // btt -> Latn
+    {0x00000000u, 0u},
+    {0xB9010000u, 40u}, // bio -> Latn
+    {0x6D670000u, 40u}, // mg -> Latn
+    {0xD22A0000u, 16u}, // kru -> Deva
+    {0x00000000u, 0u},
+    {0xB02A0000u, 40u}, // kbm -> Latn
+    {0x00000000u, 0u},
+    {0xE0C40000u, 17u}, // egy -> Egyp
+    {0x89520000u, 40u}, // skc -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x84E10000u, 16u}, // bhb -> Deva
+    {0x6F730000u, 15u}, // os -> Cyrl
+    {0xCA730000u, 80u}, // tts -> Thai
+    {0xAA4D0000u, 9u}, // nsk -> Cans
+    {0xD0D30000u, 40u}, // tgu -> Latn
+    {0x6C620000u, 40u}, // lb -> Latn
+    {0x74670000u, 15u}, // tg -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x726E0000u, 40u}, // rn -> Latn
+    {0x6E610000u, 40u}, // na -> Latn
     {0x68690000u, 16u}, // hi -> Deva
-    {0x81070000u, 40u}, // hia -> Latn
-    {0x95070000u, 40u}, // hif -> Latn
-    {0x99070000u, 40u}, // hig -> Latn
-    {0x9D070000u, 40u}, // hih -> Latn
-    {0xAD070000u, 40u}, // hil -> Latn
-    {0x81670000u, 40u}, // hla -> Latn
-    {0xD1670000u, 28u}, // hlu -> Hluw
-    {0x8D870000u, 62u}, // hmd -> Plrd
-    {0xCD870000u, 40u}, // hmt -> Latn
-    {0x8DA70000u,  1u}, // hnd -> Arab
-    {0x91A70000u, 16u}, // hne -> Deva
-    {0xA5A70000u, 29u}, // hnj -> Hmng
-    {0xB5A70000u, 40u}, // hnn -> Latn
-    {0xB9A70000u,  1u}, // hno -> Arab
+    {0x00000000u, 0u},
+    {0xC6A60000u, 16u}, // gvr -> Deva
+    {0x8A2A0000u, 15u}, // krc -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC66D0000u, 40u}, // ntr -> Latn
+    {0xC5C60000u, 40u}, // gor -> Latn
+    {0xA62C0000u, 15u}, // mrj -> Cyrl
+    {0xDDB40000u, 7u}, // unx -> Beng
+    {0x00000000u, 0u},
+    {0x8E530000u, 21u}, // tsd -> Grek
+    {0xB5C60000u, 77u}, // gon -> Telu
     {0x686F0000u, 40u}, // ho -> Latn
-    {0x89C70000u, 16u}, // hoc -> Deva
+    {0x00000000u, 0u},
+    {0x696E0000u, 40u}, // in -> Latn
+    {0x99A60000u, 40u}, // gng -> Latn
+    {0xA5C10000u, 40u}, // boj -> Latn
+    {0x894A0000u, 40u}, // kkc -> Latn
+    {0x00000000u, 0u},
+    {0x99D30000u, 40u}, // tog -> Latn
+    {0x00000000u, 0u},
+    {0x92850000u, 40u}, // fue -> Latn
+    {0x92910000u, 15u}, // rue -> Cyrl
+    {0x94120000u, 40u}, // saf -> Latn
+    {0x90400000u, 40u}, // ace -> Latn
+    {0xE6210000u, 40u}, // brz -> Latn
+    {0x00000000u, 0u},
+    {0xE50D0000u, 40u}, // niz -> Latn
+    {0xB2220000u, 9u}, // crm -> Cans
     {0xA5C70000u, 16u}, // hoj -> Deva
-    {0xCDC70000u, 40u}, // hot -> Latn
-    {0x68720000u, 40u}, // hr -> Latn
-    {0x86470000u, 40u}, // hsb -> Latn
-    {0xB6470000u, 24u}, // hsn -> Hans
-    {0x68740000u, 40u}, // ht -> Latn
-    {0x68750000u, 40u}, // hu -> Latn
-    {0xA2870000u, 40u}, // hui -> Latn
-    {0x68790000u,  3u}, // hy -> Armn
-    {0x687A0000u, 40u}, // hz -> Latn
-    {0x69610000u, 40u}, // ia -> Latn
-    {0xB4080000u, 40u}, // ian -> Latn
-    {0xC4080000u, 40u}, // iar -> Latn
-    {0x80280000u, 40u}, // iba -> Latn
-    {0x84280000u, 40u}, // ibb -> Latn
-    {0xE0280000u, 40u}, // iby -> Latn
-    {0x80480000u, 40u}, // ica -> Latn
-    {0x9C480000u, 40u}, // ich -> Latn
-    {0x69640000u, 40u}, // id -> Latn
-    {0x8C680000u, 40u}, // idd -> Latn
-    {0xA0680000u, 40u}, // idi -> Latn
-    {0xD0680000u, 40u}, // idu -> Latn
-    {0x69670000u, 40u}, // ig -> Latn
-    {0x84C80000u, 40u}, // igb -> Latn
-    {0x90C80000u, 40u}, // ige -> Latn
-    {0x69690000u, 86u}, // ii -> Yiii
+    {0x950D0000u, 40u}, // nif -> Latn
+    {0xB6A00000u, 40u}, // avn -> Latn
+    {0x00000000u, 0u},
+    {0xA2230000u, 40u}, // dri -> Latn
+    {0x92920000u, 40u}, // sue -> Latn
+    {0x00000000u, 0u},
+    {0xAD720000u, 40u}, // sll -> Latn
+    {0x66610000u, 1u}, // fa -> Arab
+    {0x00000000u, 0u},
+    {0xB0060000u, 40u}, // gam -> Latn
+    {0x99780000u, 40u}, // ylg -> Latn
     {0xA5280000u, 40u}, // ijj -> Latn
-    {0x696B0000u, 40u}, // ik -> Latn
-    {0xA9480000u, 40u}, // ikk -> Latn
-    {0xCD480000u, 40u}, // ikt -> Latn
-    {0xD9480000u, 40u}, // ikw -> Latn
-    {0xDD480000u, 40u}, // ikx -> Latn
-    {0xB9680000u, 40u}, // ilo -> Latn
-    {0xB9880000u, 40u}, // imo -> Latn
-    {0x696E0000u, 40u}, // in -> Latn
-    {0x9DA80000u, 15u}, // inh -> Cyrl
-    {0xD1C80000u, 40u}, // iou -> Latn
-    {0xA2280000u, 40u}, // iri -> Latn
-    {0x69730000u, 40u}, // is -> Latn
-    {0x69740000u, 40u}, // it -> Latn
-    {0x69750000u,  9u}, // iu -> Cans
-    {0x69770000u, 27u}, // iw -> Hebr
-    {0xB2C80000u, 40u}, // iwm -> Latn
-    {0xCAC80000u, 40u}, // iws -> Latn
-    {0x9F280000u, 40u}, // izh -> Latn
-    {0xA3280000u, 40u}, // izi -> Latn
-    {0x6A610000u, 31u}, // ja -> Jpan
-    {0x84090000u, 40u}, // jab -> Latn
-    {0xB0090000u, 40u}, // jam -> Latn
-    {0xD0290000u, 40u}, // jbu -> Latn
-    {0xB4890000u, 40u}, // jen -> Latn
-    {0xA8C90000u, 40u}, // jgk -> Latn
-    {0xB8C90000u, 40u}, // jgo -> Latn
-    {0x6A690000u, 27u}, // ji -> Hebr
-    {0x85090000u, 40u}, // jib -> Latn
-    {0x89890000u, 40u}, // jmc -> Latn
-    {0xAD890000u, 16u}, // jml -> Deva
-    {0x82290000u, 40u}, // jra -> Latn
-    {0xCE890000u, 40u}, // jut -> Latn
-    {0x6A760000u, 40u}, // jv -> Latn
-    {0x6A770000u, 40u}, // jw -> Latn
-    {0x6B610000u, 19u}, // ka -> Geor
+    {0x00000000u, 0u},
+    {0x98030000u, 40u}, // dag -> Latn
+    {0x00000000u, 0u},
+    {0xCE640000u, 30u}, // ett -> Ital
+    {0x95D10000u, 40u}, // rof -> Latn
+    {0x00000000u, 0u},
+    {0xE20A0000u, 18u}, // kqy -> Ethi
+    {0x946C0000u, 15u}, // mdf -> Cyrl
+    {0x00000000u, 0u},
+    {0xD6610000u, 16u}, // btv -> Deva
+    {0x902B0000u, 15u}, // lbe -> Cyrl
+    {0x00000000u, 0u},
+    {0x65750000u, 40u}, // eu -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x66790000u, 40u}, // fy -> Latn
+    {0x98150000u, 40u}, // vag -> Latn
+    {0x00000000u, 0u},
+    {0xE0E70000u, 40u}, // hhy -> Latn
+    {0xD8330000u, 40u}, // tbw -> Latn
+    {0xC6CC0000u, 16u}, // mwr -> Deva
+    {0xBA350000u, 40u}, // vro -> Latn
+    {0x91EA0000u, 40u}, // kpe -> Latn
+    {0xE4D20000u, 40u}, // sgz -> Latn
+    {0xB4EF0000u, 61u}, // phn -> Phnx
+    {0xD0680000u, 40u}, // idu -> Latn
+    {0xE48A0000u, 40u}, // kez -> Latn
     {0x800A0000u, 15u}, // kaa -> Cyrl
-    {0x840A0000u, 40u}, // kab -> Latn
-    {0x880A0000u, 40u}, // kac -> Latn
-    {0x8C0A0000u, 40u}, // kad -> Latn
-    {0xA00A0000u, 40u}, // kai -> Latn
-    {0xA40A0000u, 40u}, // kaj -> Latn
-    {0xB00A0000u, 40u}, // kam -> Latn
-    {0xB80A0000u, 40u}, // kao -> Latn
-    {0x8C2A0000u, 15u}, // kbd -> Cyrl
-    {0xB02A0000u, 40u}, // kbm -> Latn
-    {0xBC2A0000u, 40u}, // kbp -> Latn
-    {0xC02A0000u, 40u}, // kbq -> Latn
-    {0xDC2A0000u, 40u}, // kbx -> Latn
-    {0xE02A0000u,  1u}, // kby -> Arab
-    {0x984A0000u, 40u}, // kcg -> Latn
+    {0x00000000u, 0u},
+    {0x6B754C42u, 1u}, // ku-LB -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xCC8C0000u, 40u}, // met -> Latn
+    {0x86420000u, 40u}, // csb -> Latn
+    {0x98050000u, 40u}, // fag -> Latn
+    {0x980C0000u, 16u}, // mag -> Deva
+    {0x00000000u, 0u},
+    {0x86380000u, 40u}, // yrb -> Latn
+    {0xC8E60000u, 40u}, // ghs -> Latn
+    {0x00000000u, 0u},
+    {0x81220000u, 1u}, // cja -> Arab
+    {0xB5460000u, 40u}, // gkn -> Latn
+    {0x960A0000u, 40u}, // kqf -> Latn
+    {0x00000000u, 0u},
+    {0xA5920000u, 40u}, // smj -> Latn
+    {0xB4020000u, 40u}, // can -> Latn
+    {0x00000000u, 0u},
+    {0xD22E0000u, 1u}, // oru -> Arab
+    {0xB5C50000u, 40u}, // fon -> Latn
+    {0x00000000u, 0u},
+    {0xCC180000u, 40u}, // yat -> Latn
+    {0xA1720000u, 40u}, // sli -> Latn
+    {0xB0810000u, 40u}, // bem -> Latn
+    {0xCCA10000u, 1u}, // bft -> Arab
+    {0x8D120000u, 40u}, // sid -> Latn
+    {0x980B0000u, 40u}, // lag -> Latn
+    {0x00000000u, 0u},
+    {0xA6CA0000u, 40u}, // kwj -> Latn
+    {0x00000000u, 0u},
+    {0x9AD20000u, 40u}, // swg -> Latn
+    {0x73710000u, 40u}, // sq -> Latn
+    {0xE58D0000u, 40u}, // nmz -> Latn
+    {0xCD510000u, 7u}, // rkt -> Beng
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x91E50000u, 40u}, // fpe -> Latn
+    {0x84800000u, 1u}, // aeb -> Arab
+    {0x9A830000u, 40u}, // dug -> Latn
+    {0x00000000u, 0u},
+    {0xE4120000u, 67u}, // saz -> Saur
+    {0xD5160000u, 40u}, // wiv -> Latn
+    {0x95AD0000u, 40u}, // nnf -> Latn
+    {0xD2B30000u, 40u}, // tvu -> Latn
+    {0xCA8D0000u, 40u}, // nus -> Latn
+    {0x74610000u, 74u}, // ta -> Taml
+    {0x00000000u, 0u},
+    {0xBE250000u, 40u}, // frp -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xADCB0000u, 40u}, // lol -> Latn
+    {0x8A200000u, 2u}, // arc -> Armi
+    {0xA3060000u, 40u}, // gyi -> Latn
+    {0x92400000u, 68u}, // ase -> Sgnw
+    {0x66660000u, 40u}, // ff -> Latn
+    {0xB9580000u, 40u}, // yko -> Latn
+    {0xBDC30000u, 40u}, // dop -> Latn
+    {0xCEA00000u, 40u}, // avt -> Latn
+    {0x00000000u, 0u},
+    {0xDC010000u, 5u}, // bax -> Bamu
+    {0x82830000u, 40u}, // dua -> Latn
+    {0x6B6C0000u, 40u}, // kl -> Latn
+    {0x7A685457u, 25u}, // zh-TW -> Hant
+    {0x80320000u, 40u}, // sba -> Latn
+    {0xA0A40000u, 40u}, // efi -> Latn
+    {0x00000000u, 0u},
+    {0x95070000u, 40u}, // hif -> Latn
+    {0x6B690000u, 40u}, // ki -> Latn
+    {0x96850000u, 40u}, // fuf -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB5D80000u, 40u}, // yon -> Latn
+    {0xB0410000u, 40u}, // bcm -> Latn
+    {0xB1C00000u, 40u}, // aom -> Latn
+    {0x00000000u, 0u},
+    {0xA50B0000u, 40u}, // lij -> Latn
+    {0x74720000u, 40u}, // tr -> Latn
+    {0xC0410000u, 18u}, // bcq -> Ethi
+    {0x94810000u, 40u}, // bef -> Latn
+    {0x9C730000u, 16u}, // tdh -> Deva
+    {0x746B0000u, 40u}, // tk -> Latn
+    {0x00000000u, 0u},
+    {0xA10D0000u, 40u}, // nii -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC4030000u, 15u}, // dar -> Cyrl
+    {0xD6010000u, 40u}, // bqv -> Latn
+    {0xB5600000u, 40u}, // aln -> Latn
+    {0x00000000u, 0u},
+    {0xC0A10000u, 74u}, // bfq -> Taml
+    {0xB8CC0000u, 40u}, // mgo -> Latn
+    {0x00000000u, 0u},
+    {0xC8010000u, 40u}, // bas -> Latn
+    {0xC6AA0000u, 40u}, // kvr -> Latn
+    {0x00000000u, 0u},
+    {0xB0180000u, 40u}, // yam -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xD1410000u, 40u}, // bku -> Latn
     {0xA84A0000u, 40u}, // kck -> Latn
-    {0xAC4A0000u, 40u}, // kcl -> Latn
-    {0xCC4A0000u, 40u}, // kct -> Latn
-    {0x906A0000u, 40u}, // kde -> Latn
-    {0x9C6A0000u,  1u}, // kdh -> Arab
-    {0xAC6A0000u, 40u}, // kdl -> Latn
-    {0xCC6A0000u, 80u}, // kdt -> Thai
+    {0x89150000u, 40u}, // vic -> Latn
+    {0x00000000u, 0u},
+    {0xAB2C0000u, 40u}, // mzk -> Latn
+    {0xCA8A0000u, 40u}, // kus -> Latn
+    {0x757A434Eu, 15u}, // uz-CN -> Cyrl
+    {0x822F0000u, 34u}, // pra -> Khar
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9E4A0000u, 40u}, // ksh -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xA00A0000u, 40u}, // kai -> Latn
+    {0x757A0000u, 40u}, // uz -> Latn
+    {0x8E730000u, 40u}, // ttd -> Latn
+    {0x00000000u, 0u},
+    {0x6D720000u, 16u}, // mr -> Deva
+    {0x00000000u, 0u},
+    {0xAACC0000u, 40u}, // mwk -> Latn
+    {0xB2760000u, 16u}, // wtm -> Deva
+    {0x98F60000u, 40u}, // whg -> Latn
+    {0x9C410000u, 40u}, // bch -> Latn
+    {0xC4960000u, 40u}, // wer -> Latn
     {0x808A0000u, 40u}, // kea -> Latn
-    {0xB48A0000u, 40u}, // ken -> Latn
-    {0xE48A0000u, 40u}, // kez -> Latn
-    {0xB8AA0000u, 40u}, // kfo -> Latn
-    {0xC4AA0000u, 16u}, // kfr -> Deva
-    {0xE0AA0000u, 16u}, // kfy -> Deva
-    {0x6B670000u, 40u}, // kg -> Latn
-    {0x90CA0000u, 40u}, // kge -> Latn
-    {0x94CA0000u, 40u}, // kgf -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE4070000u, 1u}, // haz -> Arab
+    {0x9AAA0000u, 40u}, // kvg -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xDE320000u, 16u}, // srx -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x99AE0000u, 40u}, // ong -> Latn
+    {0xA6410000u, 40u}, // bsj -> Latn
+    {0x00000000u, 0u},
+    {0xDA260000u, 40u}, // grw -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0xBCCA0000u, 40u}, // kgp -> Latn
-    {0x80EA0000u, 40u}, // kha -> Latn
-    {0x84EA0000u, 73u}, // khb -> Talu
-    {0xB4EA0000u, 16u}, // khn -> Deva
-    {0xC0EA0000u, 40u}, // khq -> Latn
-    {0xC8EA0000u, 40u}, // khs -> Latn
+    {0xB2EC0000u, 40u}, // mxm -> Latn
+    {0x726F0000u, 40u}, // ro -> Latn
+    {0xA9D20000u, 40u}, // sok -> Latn
+    {0x756B0000u, 15u}, // uk -> Cyrl
+    {0xB56B0000u, 40u}, // lln -> Latn
+    {0xA8520000u, 16u}, // sck -> Deva
     {0xCCEA0000u, 52u}, // kht -> Mymr
-    {0xD8EA0000u,  1u}, // khw -> Arab
-    {0xE4EA0000u, 40u}, // khz -> Latn
-    {0x6B690000u, 40u}, // ki -> Latn
-    {0xA50A0000u, 40u}, // kij -> Latn
-    {0xD10A0000u, 40u}, // kiu -> Latn
-    {0xD90A0000u, 40u}, // kiw -> Latn
-    {0x6B6A0000u, 40u}, // kj -> Latn
-    {0x8D2A0000u, 40u}, // kjd -> Latn
-    {0x992A0000u, 39u}, // kjg -> Laoo
-    {0xC92A0000u, 40u}, // kjs -> Latn
-    {0xE12A0000u, 40u}, // kjy -> Latn
-    {0x6B6B0000u, 15u}, // kk -> Cyrl
-    {0x6B6B4146u,  1u}, // kk-AF -> Arab
-    {0x6B6B434Eu,  1u}, // kk-CN -> Arab
-    {0x6B6B4952u,  1u}, // kk-IR -> Arab
-    {0x6B6B4D4Eu,  1u}, // kk-MN -> Arab
-    {0x894A0000u, 40u}, // kkc -> Latn
-    {0xA54A0000u, 40u}, // kkj -> Latn
-    {0x6B6C0000u, 40u}, // kl -> Latn
-    {0xB56A0000u, 40u}, // kln -> Latn
-    {0xC16A0000u, 40u}, // klq -> Latn
-    {0xCD6A0000u, 40u}, // klt -> Latn
-    {0xDD6A0000u, 40u}, // klx -> Latn
-    {0x6B6D0000u, 35u}, // km -> Khmr
-    {0x858A0000u, 40u}, // kmb -> Latn
-    {0x9D8A0000u, 40u}, // kmh -> Latn
-    {0xB98A0000u, 40u}, // kmo -> Latn
-    {0xC98A0000u, 40u}, // kms -> Latn
-    {0xD18A0000u, 40u}, // kmu -> Latn
-    {0xD98A0000u, 40u}, // kmw -> Latn
-    {0x6B6E0000u, 36u}, // kn -> Knda
-    {0xBDAA0000u, 40u}, // knp -> Latn
-    {0x6B6F0000u, 37u}, // ko -> Kore
-    {0xA1CA0000u, 15u}, // koi -> Cyrl
-    {0xA9CA0000u, 16u}, // kok -> Deva
-    {0xADCA0000u, 40u}, // kol -> Latn
-    {0xC9CA0000u, 40u}, // kos -> Latn
-    {0xE5CA0000u, 40u}, // koz -> Latn
-    {0x91EA0000u, 40u}, // kpe -> Latn
-    {0x95EA0000u, 40u}, // kpf -> Latn
-    {0xB9EA0000u, 40u}, // kpo -> Latn
-    {0xC5EA0000u, 40u}, // kpr -> Latn
-    {0xDDEA0000u, 40u}, // kpx -> Latn
-    {0x860A0000u, 40u}, // kqb -> Latn
-    {0x960A0000u, 40u}, // kqf -> Latn
-    {0xCA0A0000u, 40u}, // kqs -> Latn
-    {0xE20A0000u, 18u}, // kqy -> Ethi
-    {0x8A2A0000u, 15u}, // krc -> Cyrl
-    {0xA22A0000u, 40u}, // kri -> Latn
-    {0xA62A0000u, 40u}, // krj -> Latn
-    {0xAE2A0000u, 40u}, // krl -> Latn
-    {0xCA2A0000u, 40u}, // krs -> Latn
-    {0xD22A0000u, 16u}, // kru -> Deva
-    {0x6B730000u,  1u}, // ks -> Arab
-    {0x864A0000u, 40u}, // ksb -> Latn
-    {0x8E4A0000u, 40u}, // ksd -> Latn
-    {0x964A0000u, 40u}, // ksf -> Latn
-    {0x9E4A0000u, 40u}, // ksh -> Latn
-    {0xA64A0000u, 40u}, // ksj -> Latn
-    {0xC64A0000u, 40u}, // ksr -> Latn
-    {0x866A0000u, 18u}, // ktb -> Ethi
-    {0xB26A0000u, 40u}, // ktm -> Latn
-    {0xBA6A0000u, 40u}, // kto -> Latn
-    {0x6B750000u, 40u}, // ku -> Latn
-    {0x6B754952u,  1u}, // ku-IR -> Arab
-    {0x6B754C42u,  1u}, // ku-LB -> Arab
-    {0x868A0000u, 40u}, // kub -> Latn
-    {0x8E8A0000u, 40u}, // kud -> Latn
+    {0xAC010000u, 1u}, // bal -> Arab
+    {0xBE8D0000u, 40u}, // nup -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xCA4D0000u, 40u}, // nss -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xDA860000u, 40u}, // guw -> Latn
+    {0x00000000u, 0u},
+    {0xCAA60000u, 40u}, // gvs -> Latn
+    {0xB4050000u, 40u}, // fan -> Latn
+    {0xB8410000u, 40u}, // bco -> Latn
+    {0x00000000u, 0u},
+    {0x86CD0000u, 40u}, // nwb -> Latn
+    {0xB2810000u, 40u}, // bum -> Latn
+    {0xBC950000u, 40u}, // vep -> Latn
+    {0x00000000u, 0u},
+    {0xC5B70000u, 16u}, // xnr -> Deva
+    {0x8C610000u, 40u}, // bdd -> Latn
+    {0x00000000u, 0u},
+    {0xAE380000u, 40u}, // yrl -> Latn
+    {0xC8120000u, 40u}, // sas -> Latn
+    {0xAC0F0000u, 60u}, // pal -> Phli
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x80C30000u, 40u}, // dga -> Latn
+    {0xBD800000u, 40u}, // amp -> Latn
+    {0xAC860000u, 40u}, // gel -> Latn
+    {0xB8E10000u, 16u}, // bho -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE1B20000u, 40u}, // sny -> Latn
+    {0x00000000u, 0u},
+    {0x940C0000u, 40u}, // maf -> Latn
+    {0x98190000u, 40u}, // zag -> Latn
+    {0xB1220000u, 11u}, // cjm -> Cham
+    {0x00000000u, 0u},
+    {0xC1D30000u, 40u}, // toq -> Latn
+    {0xC9520000u, 40u}, // sks -> Latn
+    {0xE72B0000u, 40u}, // lzz -> Latn
+    {0x00000000u, 0u},
+    {0xA2280000u, 40u}, // iri -> Latn
+    {0xE0260000u, 40u}, // gby -> Latn
+    {0x69670000u, 40u}, // ig -> Latn
+    {0x00000000u, 0u},
+    {0xE2200000u, 1u}, // ary -> Arab
+    {0x80380000u, 40u}, // yba -> Latn
+    {0x814F0000u, 8u}, // pka -> Brah
+    {0x6D734343u, 1u}, // ms-CC -> Arab
+    {0x00000000u, 0u},
+    {0x70730000u, 1u}, // ps -> Arab
+    {0x9C6A0000u, 1u}, // kdh -> Arab
+    {0xCA0A0000u, 40u}, // kqs -> Latn
+    {0xC4570000u, 10u}, // xcr -> Cari
+    {0x7A685041u, 25u}, // zh-PA -> Hant
+    {0xD4170000u, 40u}, // xav -> Latn
+    {0x00000000u, 0u},
+    {0xB1F30000u, 40u}, // tpm -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xCA630000u, 40u}, // dts -> Latn
+    {0x68790000u, 3u}, // hy -> Armn
+    {0x85940000u, 40u}, // umb -> Latn
+    {0x92730000u, 40u}, // tte -> Latn
+    {0x00000000u, 0u},
+    {0xC4160000u, 40u}, // war -> Latn
+    {0xC54E0000u, 40u}, // okr -> Latn
+    {0x994D0000u, 40u}, // nkg -> Latn
+    {0xB94D0000u, 40u}, // nko -> Latn
+    {0x00000000u, 0u},
+    {0x91780000u, 40u}, // yle -> Latn
     {0x928A0000u, 40u}, // kue -> Latn
-    {0xA68A0000u, 40u}, // kuj -> Latn
-    {0xB28A0000u, 15u}, // kum -> Cyrl
-    {0xB68A0000u, 40u}, // kun -> Latn
-    {0xBE8A0000u, 40u}, // kup -> Latn
-    {0xCA8A0000u, 40u}, // kus -> Latn
-    {0x6B760000u, 15u}, // kv -> Cyrl
-    {0x9AAA0000u, 40u}, // kvg -> Latn
-    {0xC6AA0000u, 40u}, // kvr -> Latn
-    {0xDEAA0000u,  1u}, // kvx -> Arab
-    {0x6B770000u, 40u}, // kw -> Latn
-    {0xA6CA0000u, 40u}, // kwj -> Latn
-    {0xBACA0000u, 40u}, // kwo -> Latn
-    {0x82EA0000u, 40u}, // kxa -> Latn
-    {0x8AEA0000u, 18u}, // kxc -> Ethi
-    {0xB2EA0000u, 80u}, // kxm -> Thai
-    {0xBEEA0000u,  1u}, // kxp -> Arab
-    {0xDAEA0000u, 40u}, // kxw -> Latn
-    {0xE6EA0000u, 40u}, // kxz -> Latn
-    {0x6B790000u, 15u}, // ky -> Cyrl
-    {0x6B79434Eu,  1u}, // ky-CN -> Arab
-    {0x6B795452u, 40u}, // ky-TR -> Latn
-    {0x930A0000u, 40u}, // kye -> Latn
-    {0xDF0A0000u, 40u}, // kyx -> Latn
-    {0xC72A0000u, 40u}, // kzr -> Latn
-    {0x6C610000u, 40u}, // la -> Latn
-    {0x840B0000u, 42u}, // lab -> Lina
-    {0x8C0B0000u, 27u}, // lad -> Hebr
-    {0x980B0000u, 40u}, // lag -> Latn
-    {0x9C0B0000u,  1u}, // lah -> Arab
-    {0xA40B0000u, 40u}, // laj -> Latn
-    {0xC80B0000u, 40u}, // las -> Latn
-    {0x6C620000u, 40u}, // lb -> Latn
-    {0x902B0000u, 15u}, // lbe -> Cyrl
-    {0xD02B0000u, 40u}, // lbu -> Latn
-    {0xD82B0000u, 40u}, // lbw -> Latn
-    {0xB04B0000u, 40u}, // lcm -> Latn
-    {0xBC4B0000u, 80u}, // lcp -> Thai
-    {0x846B0000u, 40u}, // ldb -> Latn
-    {0x8C8B0000u, 40u}, // led -> Latn
-    {0x908B0000u, 40u}, // lee -> Latn
-    {0xB08B0000u, 40u}, // lem -> Latn
-    {0xBC8B0000u, 41u}, // lep -> Lepc
-    {0xC08B0000u, 40u}, // leq -> Latn
-    {0xD08B0000u, 40u}, // leu -> Latn
-    {0xE48B0000u, 15u}, // lez -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x616D0000u, 18u}, // am -> Ethi
+    {0xB1790000u, 40u}, // zlm -> Latn
+    {0xCDD50000u, 40u}, // vot -> Latn
+    {0x6B670000u, 40u}, // kg -> Latn
+    {0xDD6A0000u, 40u}, // klx -> Latn
     {0x6C670000u, 40u}, // lg -> Latn
-    {0x98CB0000u, 40u}, // lgg -> Latn
-    {0x6C690000u, 40u}, // li -> Latn
+    {0x00000000u, 0u},
+    {0x908B0000u, 40u}, // lee -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x8C400000u, 40u}, // acd -> Latn
+    {0x9E930000u, 40u}, // tuh -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x82980000u, 40u}, // yua -> Latn
+    {0x8DE00000u, 1u}, // apd -> Arab
+    {0x746E0000u, 40u}, // tn -> Latn
     {0x810B0000u, 40u}, // lia -> Latn
-    {0x8D0B0000u, 40u}, // lid -> Latn
-    {0x950B0000u, 16u}, // lif -> Deva
-    {0x990B0000u, 40u}, // lig -> Latn
-    {0x9D0B0000u, 40u}, // lih -> Latn
-    {0xA50B0000u, 40u}, // lij -> Latn
-    {0xC90B0000u, 43u}, // lis -> Lisu
-    {0xBD2B0000u, 40u}, // ljp -> Latn
-    {0xA14B0000u,  1u}, // lki -> Arab
-    {0xCD4B0000u, 40u}, // lkt -> Latn
-    {0x916B0000u, 40u}, // lle -> Latn
-    {0xB56B0000u, 40u}, // lln -> Latn
-    {0xB58B0000u, 77u}, // lmn -> Telu
-    {0xB98B0000u, 40u}, // lmo -> Latn
-    {0xBD8B0000u, 40u}, // lmp -> Latn
-    {0x6C6E0000u, 40u}, // ln -> Latn
-    {0xC9AB0000u, 40u}, // lns -> Latn
-    {0xD1AB0000u, 40u}, // lnu -> Latn
-    {0x6C6F0000u, 39u}, // lo -> Laoo
+    {0xA4860000u, 40u}, // gej -> Latn
+    {0x95D30000u, 40u}, // tof -> Latn
+    {0x00000000u, 0u},
+    {0x8E2F0000u, 1u}, // prd -> Arab
+    {0xAD980000u, 40u}, // yml -> Latn
+    {0x90160000u, 40u}, // wae -> Latn
+    {0xA0050000u, 40u}, // fai -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xA8E20000u, 40u}, // chk -> Latn
+    {0xDE860000u, 40u}, // gux -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xBDCD0000u, 40u}, // nop -> Latn
+    {0x82570000u, 66u}, // xsa -> Sarb
+    {0x00000000u, 0u},
+    {0x9A2F0000u, 40u}, // prg -> Latn
+    {0x9298434Eu, 24u}, // yue-CN -> Hans
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x72770000u, 40u}, // rw -> Latn
+    {0xE2800000u, 40u}, // auy -> Latn
+    {0xA1CA0000u, 15u}, // koi -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC9E00000u, 40u}, // aps -> Latn
+    {0xA1F30000u, 40u}, // tpi -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB08B0000u, 40u}, // lem -> Latn
+    {0x00000000u, 0u},
+    {0x7A685352u, 25u}, // zh-SR -> Hant
+    {0x94030000u, 40u}, // daf -> Latn
+    {0x72750000u, 15u}, // ru -> Cyrl
+    {0xDCC10000u, 21u}, // bgx -> Grek
+    {0x656E0000u, 40u}, // en -> Latn
+    {0x00000000u, 0u},
+    {0x61725842u, 88u}, // ar-XB -> ~~~B
+    {0xB9880000u, 40u}, // imo -> Latn
+    {0x00000000u, 0u},
+    {0xC9CC0000u, 40u}, // mos -> Latn
+    {0x8A860000u, 40u}, // guc -> Latn
+    {0x866A0000u, 18u}, // ktb -> Ethi
+    {0xB92D0000u, 40u}, // njo -> Latn
+    {0x91A70000u, 16u}, // hne -> Deva
+    {0xA4210000u, 40u}, // bbj -> Latn
+    {0x80EA0000u, 40u}, // kha -> Latn
+    {0x8A830000u, 40u}, // duc -> Latn
+    {0x9DAD0000u, 40u}, // nnh -> Latn
+    {0x8A810000u, 40u}, // buc -> Latn
+    {0x00000000u, 0u},
+    {0x89410000u, 40u}, // bkc -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE68B0000u, 1u}, // luz -> Arab
+    {0xA1740000u, 40u}, // uli -> Latn
+    {0xD70C0000u, 15u}, // myv -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xCC6F0000u, 40u}, // pdt -> Latn
+    {0x00000000u, 0u},
+    {0xA4600000u, 40u}, // adj -> Latn
+    {0xC6320000u, 40u}, // srr -> Latn
+    {0xBC180000u, 40u}, // yap -> Latn
+    {0x6E670000u, 40u}, // ng -> Latn
+    {0x00000000u, 0u},
+    {0xCB010000u, 40u}, // bys -> Latn
+    {0xB5010000u, 40u}, // bin -> Latn
+    {0x00000000u, 0u},
     {0xA5CB0000u, 40u}, // loj -> Latn
+    {0x00000000u, 0u},
+    {0xC2410000u, 6u}, // bsq -> Bass
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xA0560000u, 40u}, // wci -> Latn
+    {0x9CCC0000u, 40u}, // mgh -> Latn
+    {0xCD910000u, 1u}, // rmt -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x676E0000u, 40u}, // gn -> Latn
+    {0x00000000u, 0u},
+    {0xD0240000u, 40u}, // ebu -> Latn
+    {0xD94C0000u, 40u}, // mkw -> Latn
+    {0xB48C0000u, 40u}, // men -> Latn
+    {0xCA410000u, 40u}, // bss -> Latn
+    {0xCA250000u, 40u}, // frs -> Latn
+    {0x73730000u, 40u}, // ss -> Latn
+    {0xC46C0000u, 40u}, // mdr -> Latn
+    {0xB4150000u, 40u}, // van -> Latn
+    {0x69640000u, 40u}, // id -> Latn
+    {0x91820000u, 40u}, // cme -> Latn
+    {0xBA4D0000u, 40u}, // nso -> Latn
+    {0x6B6B4D4Eu, 1u}, // kk-MN -> Arab
+    {0x00000000u, 0u},
+    {0xC9AB0000u, 40u}, // lns -> Latn
+    {0xA1AC0000u, 7u}, // mni -> Beng
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC08B0000u, 40u}, // leq -> Latn
+    {0x00000000u, 0u},
+    {0xD8070000u, 40u}, // haw -> Latn
+    {0x00000000u, 0u},
+    {0xC9760000u, 40u}, // wls -> Latn
+    {0xA1990000u, 40u}, // zmi -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x86860000u, 40u}, // gub -> Latn
+    {0x00000000u, 0u},
+    {0xC4980000u, 40u}, // yer -> Latn
+    {0x00000000u, 0u},
     {0xA9CB0000u, 40u}, // lok -> Latn
-    {0xADCB0000u, 40u}, // lol -> Latn
+    {0x00000000u, 0u},
+    {0x90AC0000u, 40u}, // mfe -> Latn
+    {0xA0E10000u, 16u}, // bhi -> Deva
+    {0xB2C80000u, 40u}, // iwm -> Latn
+    {0x9C720000u, 1u}, // sdh -> Arab
+    {0x73725255u, 40u}, // sr-RU -> Latn
+    {0x89E00000u, 1u}, // apc -> Arab
+    {0xB4660000u, 40u}, // gdn -> Latn
+    {0xCC120000u, 40u}, // sat -> Latn
+    {0x00000000u, 0u},
+    {0x8E860000u, 40u}, // gud -> Latn
+    {0x00000000u, 0u},
+    {0xC8EA0000u, 40u}, // khs -> Latn
+    {0x00000000u, 0u},
+    {0x6E6C0000u, 40u}, // nl -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB1C60000u, 16u}, // gom -> Deva
+    {0x656F0000u, 40u}, // eo -> Latn
+    {0xCA220000u, 40u}, // crs -> Latn
+    {0x97210000u, 40u}, // bzf -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB0930000u, 40u}, // tem -> Latn
+    {0x00000000u, 0u},
+    {0x916C0000u, 40u}, // mle -> Latn
+    {0x00000000u, 0u},
+    {0xD2330000u, 40u}, // tru -> Latn
+    {0x80E00000u, 40u}, // aha -> Latn
+    {0xB5CD0000u, 64u}, // non -> Runr
+    {0xA4790000u, 1u}, // zdj -> Arab
+    {0x00000000u, 0u},
+    {0xC9F20000u, 40u}, // sps -> Latn
+    {0x00000000u, 0u},
+    {0xBA200000u, 40u}, // aro -> Latn
+    {0x6C610000u, 40u}, // la -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB30D0000u, 40u}, // nym -> Latn
+    {0x91E00000u, 40u}, // ape -> Latn
     {0xC5CB0000u, 40u}, // lor -> Latn
-    {0xC9CB0000u, 40u}, // los -> Latn
-    {0xE5CB0000u, 40u}, // loz -> Latn
-    {0x8A2B0000u,  1u}, // lrc -> Arab
-    {0x6C740000u, 40u}, // lt -> Latn
-    {0x9A6B0000u, 40u}, // ltg -> Latn
-    {0x6C750000u, 40u}, // lu -> Latn
-    {0x828B0000u, 40u}, // lua -> Latn
-    {0xBA8B0000u, 40u}, // luo -> Latn
-    {0xE28B0000u, 40u}, // luy -> Latn
-    {0xE68B0000u,  1u}, // luz -> Arab
-    {0x6C760000u, 40u}, // lv -> Latn
-    {0xAECB0000u, 80u}, // lwl -> Thai
-    {0x9F2B0000u, 24u}, // lzh -> Hans
-    {0xE72B0000u, 40u}, // lzz -> Latn
-    {0x8C0C0000u, 40u}, // mad -> Latn
-    {0x940C0000u, 40u}, // maf -> Latn
-    {0x980C0000u, 16u}, // mag -> Deva
+    {0xDC8F0000u, 40u}, // pex -> Latn
+    {0xC6250000u, 40u}, // frr -> Latn
+    {0x00000000u, 0u},
+    {0xDA980000u, 40u}, // yuw -> Latn
+    {0xDB210000u, 40u}, // bzw -> Latn
+    {0x8E620000u, 59u}, // ctd -> Pauc
+    {0x00000000u, 0u},
+    {0xACAF0000u, 40u}, // pfl -> Latn
+    {0x990B0000u, 40u}, // lig -> Latn
+    {0x998D0000u, 40u}, // nmg -> Latn
+    {0xA68A0000u, 40u}, // kuj -> Latn
+    {0xB48A0000u, 40u}, // ken -> Latn
+    {0xAEB40000u, 40u}, // uvl -> Latn
+    {0x00000000u, 0u},
+    {0xC64A0000u, 40u}, // ksr -> Latn
+    {0xCD600000u, 15u}, // alt -> Cyrl
+    {0x74650000u, 77u}, // te -> Telu
     {0xA00C0000u, 16u}, // mai -> Deva
-    {0xA80C0000u, 40u}, // mak -> Latn
-    {0xB40C0000u, 40u}, // man -> Latn
-    {0xB40C474Eu, 54u}, // man-GN -> Nkoo
-    {0xC80C0000u, 40u}, // mas -> Latn
-    {0xD80C0000u, 40u}, // maw -> Latn
-    {0xE40C0000u, 40u}, // maz -> Latn
-    {0x9C2C0000u, 40u}, // mbh -> Latn
-    {0xB82C0000u, 40u}, // mbo -> Latn
-    {0xC02C0000u, 40u}, // mbq -> Latn
-    {0xD02C0000u, 40u}, // mbu -> Latn
-    {0xD82C0000u, 40u}, // mbw -> Latn
-    {0xA04C0000u, 40u}, // mci -> Latn
-    {0xBC4C0000u, 40u}, // mcp -> Latn
-    {0xC04C0000u, 40u}, // mcq -> Latn
-    {0xC44C0000u, 40u}, // mcr -> Latn
-    {0xD04C0000u, 40u}, // mcu -> Latn
-    {0x806C0000u, 40u}, // mda -> Latn
-    {0x906C0000u,  1u}, // mde -> Arab
-    {0x946C0000u, 15u}, // mdf -> Cyrl
-    {0x9C6C0000u, 40u}, // mdh -> Latn
-    {0xA46C0000u, 40u}, // mdj -> Latn
-    {0xC46C0000u, 40u}, // mdr -> Latn
-    {0xDC6C0000u, 18u}, // mdx -> Ethi
-    {0x8C8C0000u, 40u}, // med -> Latn
-    {0x908C0000u, 40u}, // mee -> Latn
-    {0xA88C0000u, 40u}, // mek -> Latn
-    {0xB48C0000u, 40u}, // men -> Latn
-    {0xC48C0000u, 40u}, // mer -> Latn
-    {0xCC8C0000u, 40u}, // met -> Latn
-    {0xD08C0000u, 40u}, // meu -> Latn
-    {0x80AC0000u,  1u}, // mfa -> Arab
-    {0x90AC0000u, 40u}, // mfe -> Latn
-    {0xB4AC0000u, 40u}, // mfn -> Latn
-    {0xB8AC0000u, 40u}, // mfo -> Latn
-    {0xC0AC0000u, 40u}, // mfq -> Latn
-    {0x6D670000u, 40u}, // mg -> Latn
-    {0x9CCC0000u, 40u}, // mgh -> Latn
-    {0xACCC0000u, 40u}, // mgl -> Latn
-    {0xB8CC0000u, 40u}, // mgo -> Latn
-    {0xBCCC0000u, 16u}, // mgp -> Deva
-    {0xE0CC0000u, 40u}, // mgy -> Latn
-    {0x6D680000u, 40u}, // mh -> Latn
-    {0xA0EC0000u, 40u}, // mhi -> Latn
-    {0xACEC0000u, 40u}, // mhl -> Latn
-    {0x6D690000u, 40u}, // mi -> Latn
-    {0x950C0000u, 40u}, // mif -> Latn
-    {0xB50C0000u, 40u}, // min -> Latn
-    {0xC90C0000u, 26u}, // mis -> Hatr
-    {0xD90C0000u, 40u}, // miw -> Latn
-    {0x6D6B0000u, 15u}, // mk -> Cyrl
-    {0xA14C0000u,  1u}, // mki -> Arab
-    {0xAD4C0000u, 40u}, // mkl -> Latn
-    {0xBD4C0000u, 40u}, // mkp -> Latn
-    {0xD94C0000u, 40u}, // mkw -> Latn
-    {0x6D6C0000u, 49u}, // ml -> Mlym
-    {0x916C0000u, 40u}, // mle -> Latn
-    {0xBD6C0000u, 40u}, // mlp -> Latn
-    {0xC96C0000u, 40u}, // mls -> Latn
-    {0xB98C0000u, 40u}, // mmo -> Latn
-    {0xD18C0000u, 40u}, // mmu -> Latn
-    {0xDD8C0000u, 40u}, // mmx -> Latn
-    {0x6D6E0000u, 15u}, // mn -> Cyrl
-    {0x6D6E434Eu, 50u}, // mn-CN -> Mong
-    {0x81AC0000u, 40u}, // mna -> Latn
-    {0x95AC0000u, 40u}, // mnf -> Latn
-    {0xA1AC0000u,  7u}, // mni -> Beng
-    {0xD9AC0000u, 52u}, // mnw -> Mymr
-    {0x81CC0000u, 40u}, // moa -> Latn
-    {0x91CC0000u, 40u}, // moe -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC6ED0000u, 40u}, // nxr -> Latn
+    {0xB6200000u, 40u}, // arn -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xD68D0000u, 40u}, // nuv -> Latn
+    {0x00000000u, 0u},
+    {0x80990000u, 40u}, // zea -> Latn
+    {0x9A520000u, 40u}, // ssg -> Latn
+    {0xB98A0000u, 40u}, // kmo -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x95130000u, 40u}, // tif -> Latn
+    {0x8D0B0000u, 40u}, // lid -> Latn
+    {0x00000000u, 0u},
+    {0xE1D20000u, 40u}, // soy -> Latn
+    {0x00000000u, 0u},
+    {0xDB0C0000u, 40u}, // myw -> Latn
+    {0x828B0000u, 40u}, // lua -> Latn
+    {0xD9C30000u, 40u}, // dow -> Latn
+    {0xE1720000u, 40u}, // sly -> Latn
+    {0x90600000u, 40u}, // ade -> Latn
+    {0xA8000000u, 40u}, // aak -> Latn
+    {0xCC810000u, 40u}, // bet -> Latn
+    {0x82400000u, 40u}, // asa -> Latn
+    {0x6C750000u, 40u}, // lu -> Latn
+    {0xC16A0000u, 40u}, // klq -> Latn
+    {0x00000000u, 0u},
+    {0x82C00000u, 16u}, // awa -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x8E4A0000u, 40u}, // ksd -> Latn
+    {0x62610000u, 15u}, // ba -> Cyrl
+    {0x00000000u, 0u},
+    {0xCA920000u, 40u}, // sus -> Latn
+    {0xA8E10000u, 40u}, // bhk -> Latn
+    {0x00000000u, 0u},
+    {0xC4210000u, 40u}, // bbr -> Latn
+    {0xA04C0000u, 40u}, // mci -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0x9DCC0000u, 40u}, // moh -> Latn
-    {0xC9CC0000u, 40u}, // mos -> Latn
-    {0xDDCC0000u, 40u}, // mox -> Latn
-    {0xBDEC0000u, 40u}, // mpp -> Latn
-    {0xC9EC0000u, 40u}, // mps -> Latn
+    {0x80210000u, 40u}, // bba -> Latn
+    {0xAEB30000u, 40u}, // tvl -> Latn
+    {0xD88D0000u, 16u}, // new -> Deva
+    {0x9D210000u, 40u}, // bjh -> Latn
+    {0x73670000u, 40u}, // sg -> Latn
+    {0x868A0000u, 40u}, // kub -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6B610000u, 19u}, // ka -> Geor
+    {0xE48B0000u, 15u}, // lez -> Cyrl
+    {0x00000000u, 0u},
     {0xCDEC0000u, 40u}, // mpt -> Latn
-    {0xDDEC0000u, 40u}, // mpx -> Latn
-    {0xAE0C0000u, 40u}, // mql -> Latn
-    {0x6D720000u, 16u}, // mr -> Deva
-    {0x8E2C0000u, 16u}, // mrd -> Deva
-    {0xA62C0000u, 15u}, // mrj -> Cyrl
-    {0xBA2C0000u, 51u}, // mro -> Mroo
-    {0x6D730000u, 40u}, // ms -> Latn
-    {0x6D734343u,  1u}, // ms-CC -> Arab
-    {0x6D734944u,  1u}, // ms-ID -> Arab
-    {0x6D740000u, 40u}, // mt -> Latn
-    {0x8A6C0000u, 40u}, // mtc -> Latn
-    {0x966C0000u, 40u}, // mtf -> Latn
-    {0xA26C0000u, 40u}, // mti -> Latn
-    {0xC66C0000u, 16u}, // mtr -> Deva
-    {0x828C0000u, 40u}, // mua -> Latn
+    {0xACEC0000u, 40u}, // mhl -> Latn
+    {0x00000000u, 0u},
+    {0xA8F20000u, 40u}, // shk -> Latn
+    {0x00000000u, 0u},
+    {0xB1010000u, 40u}, // bim -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xA6980000u, 40u}, // yuj -> Latn
+    {0x00000000u, 0u},
+    {0x6B6A0000u, 40u}, // kj -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xAC4A0000u, 40u}, // kcl -> Latn
+    {0x00000000u, 0u},
+    {0xD02C0000u, 40u}, // mbu -> Latn
+    {0x00000000u, 0u},
+    {0x71750000u, 40u}, // qu -> Latn
+    {0x00000000u, 0u},
+    {0xA5210000u, 16u}, // bjj -> Deva
+    {0xACF30000u, 16u}, // thl -> Deva
+    {0x84EA0000u, 73u}, // khb -> Talu
+    {0x80D20000u, 55u}, // sga -> Ogam
+    {0xC9D60000u, 40u}, // wos -> Latn
+    {0x864A0000u, 40u}, // ksb -> Latn
+    {0x00000000u, 0u},
     {0xC68C0000u, 40u}, // mur -> Latn
-    {0xCA8C0000u, 40u}, // mus -> Latn
-    {0x82AC0000u, 40u}, // mva -> Latn
-    {0xB6AC0000u, 40u}, // mvn -> Latn
-    {0xE2AC0000u,  1u}, // mvy -> Arab
-    {0xAACC0000u, 40u}, // mwk -> Latn
-    {0xC6CC0000u, 16u}, // mwr -> Deva
-    {0xD6CC0000u, 40u}, // mwv -> Latn
-    {0x8AEC0000u, 40u}, // mxc -> Latn
-    {0xB2EC0000u, 40u}, // mxm -> Latn
-    {0x6D790000u, 52u}, // my -> Mymr
-    {0xAB0C0000u, 40u}, // myk -> Latn
-    {0xB30C0000u, 18u}, // mym -> Ethi
-    {0xD70C0000u, 15u}, // myv -> Cyrl
-    {0xDB0C0000u, 40u}, // myw -> Latn
-    {0xDF0C0000u, 40u}, // myx -> Latn
-    {0xE70C0000u, 46u}, // myz -> Mand
-    {0xAB2C0000u, 40u}, // mzk -> Latn
-    {0xB32C0000u, 40u}, // mzm -> Latn
-    {0xB72C0000u,  1u}, // mzn -> Arab
-    {0xBF2C0000u, 40u}, // mzp -> Latn
-    {0xDB2C0000u, 40u}, // mzw -> Latn
-    {0xE72C0000u, 40u}, // mzz -> Latn
-    {0x6E610000u, 40u}, // na -> Latn
-    {0x880D0000u, 40u}, // nac -> Latn
-    {0x940D0000u, 40u}, // naf -> Latn
-    {0xA80D0000u, 40u}, // nak -> Latn
-    {0xB40D0000u, 24u}, // nan -> Hans
-    {0xBC0D0000u, 40u}, // nap -> Latn
-    {0xC00D0000u, 40u}, // naq -> Latn
-    {0xC80D0000u, 40u}, // nas -> Latn
-    {0x6E620000u, 40u}, // nb -> Latn
-    {0x804D0000u, 40u}, // nca -> Latn
     {0x904D0000u, 40u}, // nce -> Latn
-    {0x944D0000u, 40u}, // ncf -> Latn
-    {0x9C4D0000u, 40u}, // nch -> Latn
-    {0xB84D0000u, 40u}, // nco -> Latn
-    {0xD04D0000u, 40u}, // ncu -> Latn
-    {0x6E640000u, 40u}, // nd -> Latn
-    {0x886D0000u, 40u}, // ndc -> Latn
-    {0xC86D0000u, 40u}, // nds -> Latn
-    {0x6E650000u, 16u}, // ne -> Deva
-    {0x848D0000u, 40u}, // neb -> Latn
-    {0xD88D0000u, 16u}, // new -> Deva
-    {0xDC8D0000u, 40u}, // nex -> Latn
-    {0xC4AD0000u, 40u}, // nfr -> Latn
-    {0x6E670000u, 40u}, // ng -> Latn
-    {0x80CD0000u, 40u}, // nga -> Latn
-    {0x84CD0000u, 40u}, // ngb -> Latn
-    {0xACCD0000u, 40u}, // ngl -> Latn
-    {0x84ED0000u, 40u}, // nhb -> Latn
-    {0x90ED0000u, 40u}, // nhe -> Latn
-    {0xD8ED0000u, 40u}, // nhw -> Latn
-    {0x950D0000u, 40u}, // nif -> Latn
-    {0xA10D0000u, 40u}, // nii -> Latn
-    {0xA50D0000u, 40u}, // nij -> Latn
-    {0xB50D0000u, 40u}, // nin -> Latn
-    {0xD10D0000u, 40u}, // niu -> Latn
-    {0xE10D0000u, 40u}, // niy -> Latn
-    {0xE50D0000u, 40u}, // niz -> Latn
-    {0xB92D0000u, 40u}, // njo -> Latn
-    {0x994D0000u, 40u}, // nkg -> Latn
-    {0xB94D0000u, 40u}, // nko -> Latn
-    {0x6E6C0000u, 40u}, // nl -> Latn
-    {0x998D0000u, 40u}, // nmg -> Latn
-    {0xE58D0000u, 40u}, // nmz -> Latn
-    {0x6E6E0000u, 40u}, // nn -> Latn
-    {0x95AD0000u, 40u}, // nnf -> Latn
-    {0x9DAD0000u, 40u}, // nnh -> Latn
-    {0xA9AD0000u, 40u}, // nnk -> Latn
-    {0xB1AD0000u, 40u}, // nnm -> Latn
+    {0xBA2C0000u, 51u}, // mro -> Mroo
+    {0xC1D20000u, 40u}, // soq -> Latn
+    {0xE1E10000u, 7u}, // bpy -> Beng
+    {0x81360000u, 40u}, // wja -> Latn
+    {0x796F0000u, 40u}, // yo -> Latn
+    {0x6D6E434Eu, 50u}, // mn-CN -> Mong
+    {0x84380000u, 40u}, // ybb -> Latn
+    {0x65740000u, 40u}, // et -> Latn
+    {0x74680000u, 80u}, // th -> Thai
+    {0x00000000u, 0u},
+    {0x88C10000u, 16u}, // bgc -> Deva
+    {0x98C20000u, 40u}, // cgg -> Latn
+    {0xACE10000u, 40u}, // bhl -> Latn
+    {0xB6F20000u, 40u}, // sxn -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xA40A0000u, 40u}, // kaj -> Latn
+    {0x00000000u, 0u},
+    {0xA8C90000u, 40u}, // jgk -> Latn
+    {0x6D6B0000u, 15u}, // mk -> Cyrl
+    {0xE70C0000u, 46u}, // myz -> Mand
     {0x6E6F0000u, 40u}, // no -> Latn
-    {0x8DCD0000u, 38u}, // nod -> Lana
-    {0x91CD0000u, 16u}, // noe -> Deva
-    {0xB5CD0000u, 64u}, // non -> Runr
-    {0xBDCD0000u, 40u}, // nop -> Latn
-    {0xD1CD0000u, 40u}, // nou -> Latn
-    {0xBA0D0000u, 54u}, // nqo -> Nkoo
-    {0x6E720000u, 40u}, // nr -> Latn
-    {0x862D0000u, 40u}, // nrb -> Latn
-    {0xAA4D0000u,  9u}, // nsk -> Cans
-    {0xB64D0000u, 40u}, // nsn -> Latn
-    {0xBA4D0000u, 40u}, // nso -> Latn
-    {0xCA4D0000u, 40u}, // nss -> Latn
-    {0xB26D0000u, 40u}, // ntm -> Latn
-    {0xC66D0000u, 40u}, // ntr -> Latn
-    {0xA28D0000u, 40u}, // nui -> Latn
-    {0xBE8D0000u, 40u}, // nup -> Latn
-    {0xCA8D0000u, 40u}, // nus -> Latn
-    {0xD68D0000u, 40u}, // nuv -> Latn
-    {0xDE8D0000u, 40u}, // nux -> Latn
-    {0x6E760000u, 40u}, // nv -> Latn
-    {0x86CD0000u, 40u}, // nwb -> Latn
-    {0xC2ED0000u, 40u}, // nxq -> Latn
-    {0xC6ED0000u, 40u}, // nxr -> Latn
-    {0x6E790000u, 40u}, // ny -> Latn
-    {0xB30D0000u, 40u}, // nym -> Latn
-    {0xB70D0000u, 40u}, // nyn -> Latn
-    {0xA32D0000u, 40u}, // nzi -> Latn
-    {0x6F630000u, 40u}, // oc -> Latn
-    {0x88CE0000u, 40u}, // ogc -> Latn
-    {0xC54E0000u, 40u}, // okr -> Latn
-    {0xD54E0000u, 40u}, // okv -> Latn
-    {0x6F6D0000u, 40u}, // om -> Latn
-    {0x99AE0000u, 40u}, // ong -> Latn
-    {0xB5AE0000u, 40u}, // onn -> Latn
-    {0xC9AE0000u, 40u}, // ons -> Latn
+    {0xE12A0000u, 40u}, // kjy -> Latn
+    {0xB9EF0000u, 40u}, // ppo -> Latn
+    {0x00000000u, 0u},
+    {0xAE220000u, 9u}, // crl -> Cans
+    {0xA0110000u, 40u}, // rai -> Latn
+    {0xD1670000u, 28u}, // hlu -> Hluw
+    {0xBA310000u, 40u}, // rro -> Latn
+    {0xB6470000u, 24u}, // hsn -> Hans
+    {0x7A684155u, 25u}, // zh-AU -> Hant
+    {0xC5C50000u, 40u}, // for -> Latn
+    {0xCD480000u, 40u}, // ikt -> Latn
+    {0xC2D30000u, 40u}, // twq -> Latn
+    {0xE40C0000u, 40u}, // maz -> Latn
+    {0xDC8D0000u, 40u}, // nex -> Latn
+    {0x6E650000u, 16u}, // ne -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB2570000u, 40u}, // xsm -> Latn
     {0xB1EE0000u, 40u}, // opm -> Latn
-    {0x6F720000u, 57u}, // or -> Orya
-    {0xBA2E0000u, 40u}, // oro -> Latn
-    {0xD22E0000u,  1u}, // oru -> Arab
-    {0x6F730000u, 15u}, // os -> Cyrl
-    {0x824E0000u, 58u}, // osa -> Osge
-    {0x826E0000u,  1u}, // ota -> Arab
-    {0xAA6E0000u, 56u}, // otk -> Orkh
-    {0xB32E0000u, 40u}, // ozm -> Latn
-    {0x70610000u, 23u}, // pa -> Guru
-    {0x7061504Bu,  1u}, // pa-PK -> Arab
-    {0x980F0000u, 40u}, // pag -> Latn
-    {0xAC0F0000u, 60u}, // pal -> Phli
-    {0xB00F0000u, 40u}, // pam -> Latn
-    {0xBC0F0000u, 40u}, // pap -> Latn
-    {0xD00F0000u, 40u}, // pau -> Latn
-    {0xA02F0000u, 40u}, // pbi -> Latn
-    {0x8C4F0000u, 40u}, // pcd -> Latn
-    {0xB04F0000u, 40u}, // pcm -> Latn
-    {0x886F0000u, 40u}, // pdc -> Latn
-    {0xCC6F0000u, 40u}, // pdt -> Latn
-    {0x8C8F0000u, 40u}, // ped -> Latn
-    {0xB88F0000u, 84u}, // peo -> Xpeo
-    {0xDC8F0000u, 40u}, // pex -> Latn
-    {0xACAF0000u, 40u}, // pfl -> Latn
-    {0xACEF0000u,  1u}, // phl -> Arab
-    {0xB4EF0000u, 61u}, // phn -> Phnx
-    {0xAD0F0000u, 40u}, // pil -> Latn
-    {0xBD0F0000u, 40u}, // pip -> Latn
-    {0x814F0000u,  8u}, // pka -> Brah
-    {0xB94F0000u, 40u}, // pko -> Latn
-    {0x706C0000u, 40u}, // pl -> Latn
-    {0x816F0000u, 40u}, // pla -> Latn
-    {0xC98F0000u, 40u}, // pms -> Latn
-    {0x99AF0000u, 40u}, // png -> Latn
-    {0xB5AF0000u, 40u}, // pnn -> Latn
-    {0xCDAF0000u, 21u}, // pnt -> Grek
-    {0xB5CF0000u, 40u}, // pon -> Latn
-    {0xB9EF0000u, 40u}, // ppo -> Latn
-    {0x822F0000u, 34u}, // pra -> Khar
-    {0x8E2F0000u,  1u}, // prd -> Arab
-    {0x9A2F0000u, 40u}, // prg -> Latn
-    {0x70730000u,  1u}, // ps -> Arab
-    {0xCA4F0000u, 40u}, // pss -> Latn
-    {0x70740000u, 40u}, // pt -> Latn
-    {0xBE6F0000u, 40u}, // ptp -> Latn
-    {0xD28F0000u, 40u}, // puu -> Latn
+    {0xAD890000u, 16u}, // jml -> Deva
+    {0xC0F30000u, 16u}, // thq -> Deva
+    {0x00000000u, 0u},
+    {0xE1730000u, 40u}, // tly -> Latn
+    {0xB4EA0000u, 16u}, // khn -> Deva
+    {0x6D730000u, 40u}, // ms -> Latn
+    {0x00000000u, 0u},
+    {0xBDA10000u, 40u}, // bnp -> Latn
+    {0xB4010000u, 40u}, // ban -> Latn
+    {0x8AEA0000u, 18u}, // kxc -> Ethi
+    {0x00000000u, 0u},
+    {0xB2EA0000u, 80u}, // kxm -> Thai
+    {0xCE980000u, 40u}, // yut -> Latn
+    {0x00000000u, 0u},
+    {0xB7010000u, 18u}, // byn -> Ethi
+    {0xC4D80000u, 40u}, // ygr -> Latn
+    {0xC6C10000u, 40u}, // bwr -> Latn
+    {0x00000000u, 0u},
+    {0xCD530000u, 16u}, // tkt -> Deva
+    {0xDDCC0000u, 40u}, // mox -> Latn
+    {0x7A685046u, 25u}, // zh-PF -> Hant
+    {0xBDB20000u, 40u}, // snp -> Latn
+    {0xD4180000u, 40u}, // yav -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6A760000u, 40u}, // jv -> Latn
+    {0xA40B0000u, 40u}, // laj -> Latn
+    {0x6B6E0000u, 36u}, // kn -> Knda
+    {0xDD8C0000u, 40u}, // mmx -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9C030000u, 40u}, // dah -> Latn
+    {0xB9420000u, 40u}, // cko -> Latn
+    {0x6D680000u, 40u}, // mh -> Latn
+    {0x00000000u, 0u},
+    {0xB82C0000u, 40u}, // mbo -> Latn
+    {0x00000000u, 0u},
     {0x82CF0000u, 40u}, // pwa -> Latn
-    {0x71750000u, 40u}, // qu -> Latn
-    {0x8A900000u, 40u}, // quc -> Latn
-    {0x9A900000u, 40u}, // qug -> Latn
-    {0xA0110000u, 40u}, // rai -> Latn
-    {0xA4110000u, 16u}, // raj -> Deva
-    {0xB8110000u, 40u}, // rao -> Latn
-    {0x94510000u, 40u}, // rcf -> Latn
+    {0x930A0000u, 40u}, // kye -> Latn
+    {0xA54A0000u, 40u}, // kkj -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x626F0000u, 81u}, // bo -> Tibt
+    {0x80A20000u, 40u}, // cfa -> Latn
+    {0xD02B0000u, 40u}, // lbu -> Latn
+    {0x757A4146u, 1u}, // uz-AF -> Arab
+    {0x00000000u, 0u},
+    {0xE1420000u, 40u}, // cky -> Latn
+    {0x00000000u, 0u},
+    {0xA28D0000u, 40u}, // nui -> Latn
+    {0xD2810000u, 40u}, // buu -> Latn
+    {0x00000000u, 0u},
+    {0xAC520000u, 1u}, // scl -> Arab
+    {0x00000000u, 0u},
+    {0xCE260000u, 7u}, // grt -> Beng
+    {0xCEE40000u, 40u}, // ext -> Latn
+    {0xA9CA0000u, 16u}, // kok -> Deva
+    {0x73690000u, 69u}, // si -> Sinh
+    {0x9C420000u, 40u}, // cch -> Latn
+    {0xD90A0000u, 40u}, // kiw -> Latn
+    {0x00000000u, 0u},
+    {0xA14B0000u, 1u}, // lki -> Arab
+    {0xE5C00000u, 40u}, // aoz -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC7010000u, 40u}, // byr -> Latn
+    {0x8C680000u, 40u}, // idd -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x98F10000u, 1u}, // rhg -> Arab
+    {0xD3030000u, 40u}, // dyu -> Latn
+    {0xA0EC0000u, 40u}, // mhi -> Latn
+    {0x00000000u, 0u},
+    {0xD2440000u, 40u}, // esu -> Latn
+    {0xB4890000u, 40u}, // jen -> Latn
+    {0x8EC10000u, 40u}, // bwd -> Latn
+    {0x00000000u, 0u},
+    {0x99130000u, 18u}, // tig -> Ethi
+    {0x00000000u, 0u},
+    {0xC6740000u, 40u}, // utr -> Latn
+    {0x84210000u, 40u}, // bbb -> Latn
+    {0x00000000u, 0u},
+    {0x840B0000u, 42u}, // lab -> Lina
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6B770000u, 40u}, // kw -> Latn
+    {0x746F0000u, 40u}, // to -> Latn
+    {0xCE340000u, 40u}, // urt -> Latn
+    {0xAA6E0000u, 56u}, // otk -> Orkh
+    {0x69610000u, 40u}, // ia -> Latn
+    {0xB2630000u, 40u}, // dtm -> Latn
+    {0xAE930000u, 40u}, // tul -> Latn
+    {0x00000000u, 0u},
+    {0xB00F0000u, 40u}, // pam -> Latn
+    {0xB00A0000u, 40u}, // kam -> Latn
+    {0x63750000u, 15u}, // cu -> Cyrl
+    {0x00000000u, 0u},
+    {0x91CD0000u, 16u}, // noe -> Deva
+    {0xD3110000u, 33u}, // ryu -> Kana
+    {0x84C80000u, 40u}, // igb -> Latn
+    {0x61760000u, 15u}, // av -> Cyrl
+    {0x00000000u, 0u},
     {0xA4910000u, 40u}, // rej -> Latn
-    {0xAC910000u, 40u}, // rel -> Latn
+    {0xA9AD0000u, 40u}, // nnk -> Latn
+    {0xCA4F0000u, 40u}, // pss -> Latn
+    {0x83210000u, 40u}, // bza -> Latn
+    {0x99D70000u, 40u}, // xog -> Latn
+    {0xC0130000u, 40u}, // taq -> Latn
+    {0xAD780000u, 40u}, // yll -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x8C8F0000u, 40u}, // ped -> Latn
     {0xC8910000u, 40u}, // res -> Latn
-    {0xB4D10000u, 40u}, // rgn -> Latn
-    {0x98F10000u,  1u}, // rhg -> Arab
-    {0x81110000u, 40u}, // ria -> Latn
-    {0x95110000u, 78u}, // rif -> Tfng
-    {0x95114E4Cu, 40u}, // rif-NL -> Latn
-    {0xC9310000u, 16u}, // rjs -> Deva
-    {0xCD510000u,  7u}, // rkt -> Beng
-    {0x726D0000u, 40u}, // rm -> Latn
-    {0x95910000u, 40u}, // rmf -> Latn
-    {0xB9910000u, 40u}, // rmo -> Latn
-    {0xCD910000u,  1u}, // rmt -> Arab
-    {0xD1910000u, 40u}, // rmu -> Latn
-    {0x726E0000u, 40u}, // rn -> Latn
-    {0x81B10000u, 40u}, // rna -> Latn
-    {0x99B10000u, 40u}, // rng -> Latn
-    {0x726F0000u, 40u}, // ro -> Latn
-    {0x85D10000u, 40u}, // rob -> Latn
-    {0x95D10000u, 40u}, // rof -> Latn
-    {0xB9D10000u, 40u}, // roo -> Latn
-    {0xBA310000u, 40u}, // rro -> Latn
-    {0xB2710000u, 40u}, // rtm -> Latn
-    {0x72750000u, 15u}, // ru -> Cyrl
-    {0x92910000u, 15u}, // rue -> Cyrl
-    {0x9A910000u, 40u}, // rug -> Latn
-    {0x72770000u, 40u}, // rw -> Latn
-    {0xAAD10000u, 40u}, // rwk -> Latn
-    {0xBAD10000u, 40u}, // rwo -> Latn
-    {0xD3110000u, 33u}, // ryu -> Kana
-    {0x73610000u, 16u}, // sa -> Deva
-    {0x94120000u, 40u}, // saf -> Latn
-    {0x9C120000u, 15u}, // sah -> Cyrl
-    {0xC0120000u, 40u}, // saq -> Latn
-    {0xC8120000u, 40u}, // sas -> Latn
-    {0xCC120000u, 40u}, // sat -> Latn
-    {0xE4120000u, 67u}, // saz -> Saur
-    {0x80320000u, 40u}, // sba -> Latn
-    {0x90320000u, 40u}, // sbe -> Latn
-    {0xBC320000u, 40u}, // sbp -> Latn
+    {0x6B760000u, 15u}, // kv -> Cyrl
+    {0x00000000u, 0u},
+    {0x86A10000u, 40u}, // bvb -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x84280000u, 40u}, // ibb -> Latn
+    {0xCD6A0000u, 40u}, // klt -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9B230000u, 40u}, // dzg -> Latn
+    {0xD2A00000u, 40u}, // avu -> Latn
+    {0x00000000u, 0u},
+    {0xA1360000u, 40u}, // wji -> Latn
+    {0x00000000u, 0u},
+    {0x62670000u, 15u}, // bg -> Cyrl
+    {0x80CD0000u, 40u}, // nga -> Latn
+    {0xB6320000u, 40u}, // srn -> Latn
+    {0x81670000u, 40u}, // hla -> Latn
+    {0xA5A70000u, 29u}, // hnj -> Hmng
+    {0x8AEC0000u, 40u}, // mxc -> Latn
+    {0xBAC00000u, 40u}, // awo -> Latn
+    {0x00000000u, 0u},
+    {0xE10D0000u, 40u}, // niy -> Latn
+    {0xAC6A0000u, 40u}, // kdl -> Latn
+    {0x00000000u, 0u},
+    {0xE5E00000u, 40u}, // apz -> Latn
+    {0x666F0000u, 40u}, // fo -> Latn
+    {0xC6850000u, 40u}, // fur -> Latn
+    {0xC4AD0000u, 40u}, // nfr -> Latn
+    {0x70610000u, 23u}, // pa -> Guru
+    {0x00000000u, 0u},
+    {0x95950000u, 40u}, // vmf -> Latn
+    {0x6C690000u, 40u}, // li -> Latn
+    {0xCD610000u, 76u}, // blt -> Tavt
+    {0x00000000u, 0u},
+    {0xAC160000u, 18u}, // wal -> Ethi
+    {0x89A00000u, 40u}, // anc -> Latn
+    {0xAD050000u, 40u}, // fil -> Latn
+    {0x7A685448u, 25u}, // zh-TH -> Hant
+    {0xBB030000u, 40u}, // dyo -> Latn
+    {0xBC4B0000u, 80u}, // lcp -> Thai
+    {0x636F0000u, 40u}, // co -> Latn
     {0x73630000u, 40u}, // sc -> Latn
-    {0xA8520000u, 16u}, // sck -> Deva
-    {0xAC520000u,  1u}, // scl -> Arab
-    {0xB4520000u, 40u}, // scn -> Latn
-    {0xB8520000u, 40u}, // sco -> Latn
-    {0xC8520000u, 40u}, // scs -> Latn
-    {0x73640000u,  1u}, // sd -> Arab
-    {0x88720000u, 40u}, // sdc -> Latn
-    {0x9C720000u,  1u}, // sdh -> Arab
-    {0x73650000u, 40u}, // se -> Latn
-    {0x94920000u, 40u}, // sef -> Latn
-    {0x9C920000u, 40u}, // seh -> Latn
-    {0xA0920000u, 40u}, // sei -> Latn
-    {0xC8920000u, 40u}, // ses -> Latn
-    {0x73670000u, 40u}, // sg -> Latn
-    {0x80D20000u, 55u}, // sga -> Ogam
-    {0xC8D20000u, 40u}, // sgs -> Latn
-    {0xD8D20000u, 18u}, // sgw -> Ethi
-    {0xE4D20000u, 40u}, // sgz -> Latn
-    {0x73680000u, 40u}, // sh -> Latn
-    {0xA0F20000u, 78u}, // shi -> Tfng
-    {0xA8F20000u, 40u}, // shk -> Latn
-    {0xB4F20000u, 52u}, // shn -> Mymr
-    {0xD0F20000u,  1u}, // shu -> Arab
-    {0x73690000u, 69u}, // si -> Sinh
-    {0x8D120000u, 40u}, // sid -> Latn
-    {0x99120000u, 40u}, // sig -> Latn
-    {0xAD120000u, 40u}, // sil -> Latn
-    {0xB1120000u, 40u}, // sim -> Latn
-    {0xC5320000u, 40u}, // sjr -> Latn
-    {0x736B0000u, 40u}, // sk -> Latn
-    {0x89520000u, 40u}, // skc -> Latn
-    {0xC5520000u,  1u}, // skr -> Arab
-    {0xC9520000u, 40u}, // sks -> Latn
-    {0x736C0000u, 40u}, // sl -> Latn
-    {0x8D720000u, 40u}, // sld -> Latn
-    {0xA1720000u, 40u}, // sli -> Latn
-    {0xAD720000u, 40u}, // sll -> Latn
-    {0xE1720000u, 40u}, // sly -> Latn
-    {0x736D0000u, 40u}, // sm -> Latn
-    {0x81920000u, 40u}, // sma -> Latn
-    {0xA5920000u, 40u}, // smj -> Latn
-    {0xB5920000u, 40u}, // smn -> Latn
-    {0xBD920000u, 65u}, // smp -> Samr
-    {0xC1920000u, 40u}, // smq -> Latn
-    {0xC9920000u, 40u}, // sms -> Latn
+    {0x00000000u, 0u},
+    {0x81050000u, 1u}, // fia -> Arab
+    {0x9E210000u, 1u}, // brh -> Arab
+    {0x00000000u, 0u},
+    {0xDF0A0000u, 40u}, // kyx -> Latn
+    {0xB58B0000u, 77u}, // lmn -> Telu
+    {0xB1800000u, 40u}, // amm -> Latn
     {0x736E0000u, 40u}, // sn -> Latn
-    {0x89B20000u, 40u}, // snc -> Latn
-    {0xA9B20000u, 40u}, // snk -> Latn
-    {0xBDB20000u, 40u}, // snp -> Latn
-    {0xDDB20000u, 40u}, // snx -> Latn
-    {0xE1B20000u, 40u}, // sny -> Latn
-    {0x736F0000u, 40u}, // so -> Latn
-    {0xA9D20000u, 40u}, // sok -> Latn
-    {0xC1D20000u, 40u}, // soq -> Latn
-    {0xD1D20000u, 80u}, // sou -> Thai
-    {0xE1D20000u, 40u}, // soy -> Latn
-    {0x8DF20000u, 40u}, // spd -> Latn
-    {0xADF20000u, 40u}, // spl -> Latn
-    {0xC9F20000u, 40u}, // sps -> Latn
-    {0x73710000u, 40u}, // sq -> Latn
-    {0x73720000u, 15u}, // sr -> Cyrl
-    {0x73724D45u, 40u}, // sr-ME -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x98C00000u, 40u}, // agg -> Latn
+    {0xA5A30000u, 40u}, // dnj -> Latn
+    {0x00000000u, 0u},
+    {0xB5970000u, 47u}, // xmn -> Mani
+    {0xC4C30000u, 40u}, // dgr -> Latn
+    {0x8D2A0000u, 40u}, // kjd -> Latn
+    {0x67750000u, 22u}, // gu -> Gujr
     {0x7372524Fu, 40u}, // sr-RO -> Latn
-    {0x73725255u, 40u}, // sr-RU -> Latn
-    {0x73725452u, 40u}, // sr-TR -> Latn
-    {0x86320000u, 70u}, // srb -> Sora
-    {0xB6320000u, 40u}, // srn -> Latn
-    {0xC6320000u, 40u}, // srr -> Latn
-    {0xDE320000u, 16u}, // srx -> Deva
-    {0x73730000u, 40u}, // ss -> Latn
-    {0x8E520000u, 40u}, // ssd -> Latn
-    {0x9A520000u, 40u}, // ssg -> Latn
-    {0xE2520000u, 40u}, // ssy -> Latn
-    {0x73740000u, 40u}, // st -> Latn
-    {0xAA720000u, 40u}, // stk -> Latn
-    {0xC2720000u, 40u}, // stq -> Latn
-    {0x73750000u, 40u}, // su -> Latn
-    {0x82920000u, 40u}, // sua -> Latn
-    {0x92920000u, 40u}, // sue -> Latn
-    {0xAA920000u, 40u}, // suk -> Latn
-    {0xC6920000u, 40u}, // sur -> Latn
-    {0xCA920000u, 40u}, // sus -> Latn
-    {0x73760000u, 40u}, // sv -> Latn
-    {0x73770000u, 40u}, // sw -> Latn
-    {0x86D20000u,  1u}, // swb -> Arab
-    {0x8AD20000u, 40u}, // swc -> Latn
-    {0x9AD20000u, 40u}, // swg -> Latn
-    {0xBED20000u, 40u}, // swp -> Latn
-    {0xD6D20000u, 16u}, // swv -> Deva
-    {0xB6F20000u, 40u}, // sxn -> Latn
-    {0xDAF20000u, 40u}, // sxw -> Latn
-    {0xAF120000u,  7u}, // syl -> Beng
-    {0xC7120000u, 71u}, // syr -> Syrc
-    {0xAF320000u, 40u}, // szl -> Latn
-    {0x74610000u, 74u}, // ta -> Taml
-    {0xA4130000u, 16u}, // taj -> Deva
-    {0xAC130000u, 40u}, // tal -> Latn
-    {0xB4130000u, 40u}, // tan -> Latn
-    {0xC0130000u, 40u}, // taq -> Latn
-    {0x88330000u, 40u}, // tbc -> Latn
-    {0x8C330000u, 40u}, // tbd -> Latn
-    {0x94330000u, 40u}, // tbf -> Latn
-    {0x98330000u, 40u}, // tbg -> Latn
-    {0xB8330000u, 40u}, // tbo -> Latn
-    {0xD8330000u, 40u}, // tbw -> Latn
-    {0xE4330000u, 40u}, // tbz -> Latn
-    {0xA0530000u, 40u}, // tci -> Latn
-    {0xE0530000u, 36u}, // tcy -> Knda
-    {0x8C730000u, 72u}, // tdd -> Tale
-    {0x98730000u, 16u}, // tdg -> Deva
-    {0x9C730000u, 16u}, // tdh -> Deva
-    {0x74650000u, 77u}, // te -> Telu
-    {0x8C930000u, 40u}, // ted -> Latn
-    {0xB0930000u, 40u}, // tem -> Latn
-    {0xB8930000u, 40u}, // teo -> Latn
-    {0xCC930000u, 40u}, // tet -> Latn
-    {0xA0B30000u, 40u}, // tfi -> Latn
-    {0x74670000u, 15u}, // tg -> Cyrl
-    {0x7467504Bu,  1u}, // tg-PK -> Arab
-    {0x88D30000u, 40u}, // tgc -> Latn
-    {0xB8D30000u, 40u}, // tgo -> Latn
-    {0xD0D30000u, 40u}, // tgu -> Latn
-    {0x74680000u, 80u}, // th -> Thai
-    {0xACF30000u, 16u}, // thl -> Deva
-    {0xC0F30000u, 16u}, // thq -> Deva
+    {0x766F0000u, 40u}, // vo -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC80B0000u, 40u}, // las -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xCA2A0000u, 40u}, // krs -> Latn
+    {0x00000000u, 0u},
+    {0x82600000u, 40u}, // ata -> Latn
+    {0xD1160000u, 40u}, // wiu -> Latn
+    {0x00000000u, 0u},
+    {0x6B6B4952u, 1u}, // kk-IR -> Arab
+    {0xBE8A0000u, 40u}, // kup -> Latn
     {0xC4F30000u, 16u}, // thr -> Deva
-    {0x74690000u, 18u}, // ti -> Ethi
-    {0x95130000u, 40u}, // tif -> Latn
-    {0x99130000u, 18u}, // tig -> Ethi
-    {0xA9130000u, 40u}, // tik -> Latn
-    {0xB1130000u, 40u}, // tim -> Latn
+    {0xAD420000u, 40u}, // ckl -> Latn
+    {0x736B0000u, 40u}, // sk -> Latn
+    {0x00000000u, 0u},
+    {0xB5A40000u, 40u}, // enn -> Latn
+    {0x00000000u, 0u},
+    {0xA8A60000u, 40u}, // gfk -> Latn
+    {0xD9AC0000u, 52u}, // mnw -> Mymr
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9E850000u, 40u}, // fuh -> Latn
+    {0x82540000u, 40u}, // usa -> Latn
+    {0xB70D0000u, 40u}, // nyn -> Latn
+    {0x9C920000u, 40u}, // seh -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9CC30000u, 40u}, // dgh -> Latn
+    {0xE2630000u, 16u}, // dty -> Deva
+    {0xC5320000u, 40u}, // sjr -> Latn
+    {0x6A770000u, 40u}, // jw -> Latn
+    {0xDB2C0000u, 40u}, // mzw -> Latn
+    {0xA0410000u, 40u}, // bci -> Latn
+    {0xD8D80000u, 40u}, // ygw -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x94260000u, 40u}, // gbf -> Latn
+    {0x00000000u, 0u},
+    {0xC5970000u, 48u}, // xmr -> Merc
+    {0x00000000u, 0u},
+    {0x98730000u, 16u}, // tdg -> Deva
+    {0x67640000u, 40u}, // gd -> Latn
+    {0xC5210000u, 40u}, // bjr -> Latn
+    {0x00000000u, 0u},
+    {0x9A810000u, 40u}, // bug -> Latn
+    {0x65650000u, 40u}, // ee -> Latn
+    {0xB0090000u, 40u}, // jam -> Latn
+    {0xDAF20000u, 40u}, // sxw -> Latn
+    {0xB2710000u, 40u}, // rtm -> Latn
     {0xB9130000u, 40u}, // tio -> Latn
-    {0xD5130000u, 40u}, // tiv -> Latn
-    {0x746B0000u, 40u}, // tk -> Latn
-    {0xAD530000u, 40u}, // tkl -> Latn
-    {0xC5530000u, 40u}, // tkr -> Latn
-    {0xCD530000u, 16u}, // tkt -> Deva
-    {0x746C0000u, 40u}, // tl -> Latn
-    {0x95730000u, 40u}, // tlf -> Latn
-    {0xDD730000u, 40u}, // tlx -> Latn
-    {0xE1730000u, 40u}, // tly -> Latn
-    {0x9D930000u, 40u}, // tmh -> Latn
+    {0xA9810000u, 40u}, // bmk -> Latn
+    {0x9D8A0000u, 40u}, // kmh -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xADCA0000u, 40u}, // kol -> Latn
+    {0x69770000u, 27u}, // iw -> Hebr
+    {0x964A0000u, 40u}, // ksf -> Latn
+    {0xE4860000u, 18u}, // gez -> Ethi
+    {0x00000000u, 0u},
+    {0xB5210000u, 40u}, // bjn -> Latn
+    {0x00000000u, 0u},
+    {0x9D070000u, 40u}, // hih -> Latn
+    {0x00000000u, 0u},
+    {0x95C60000u, 18u}, // gof -> Ethi
+    {0x00000000u, 0u},
+    {0x95970000u, 19u}, // xmf -> Geor
+    {0x00000000u, 0u},
+    {0x82D60000u, 40u}, // wwa -> Latn
+    {0x8DC50000u, 40u}, // fod -> Latn
+    {0xB98C0000u, 40u}, // mmo -> Latn
+    {0xBC210000u, 40u}, // bbp -> Latn
+    {0xBF2C0000u, 40u}, // mzp -> Latn
+    {0xA80D0000u, 40u}, // nak -> Latn
+    {0xAD4C0000u, 40u}, // mkl -> Latn
+    {0xB04F0000u, 40u}, // pcm -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xBA2E0000u, 40u}, // oro -> Latn
+    {0x7A610000u, 40u}, // za -> Latn
+    {0xBE6F0000u, 40u}, // ptp -> Latn
+    {0x7A680000u, 24u}, // zh -> Hans
+    {0xB4410000u, 40u}, // bcn -> Latn
+    {0xB1130000u, 40u}, // tim -> Latn
+    {0xAD0F0000u, 40u}, // pil -> Latn
+    {0xC5EA0000u, 40u}, // kpr -> Latn
+    {0x6E640000u, 40u}, // nd -> Latn
+    {0xBD920000u, 65u}, // smp -> Samr
+    {0xC02C0000u, 40u}, // mbq -> Latn
+    {0xC6640000u, 40u}, // etr -> Latn
+    {0x886F0000u, 40u}, // pdc -> Latn
+    {0xA4110000u, 16u}, // raj -> Deva
+    {0x85D10000u, 40u}, // rob -> Latn
+    {0xDE640000u, 40u}, // etx -> Latn
+    {0x00000000u, 0u},
+    {0xA0920000u, 40u}, // sei -> Latn
+    {0x73725452u, 40u}, // sr-TR -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x81B10000u, 40u}, // rna -> Latn
+    {0xC6860000u, 40u}, // gur -> Latn
+    {0xA9130000u, 40u}, // tik -> Latn
+    {0xC86D0000u, 40u}, // nds -> Latn
     {0xE1930000u, 40u}, // tmy -> Latn
-    {0x746E0000u, 40u}, // tn -> Latn
-    {0x9DB30000u, 40u}, // tnh -> Latn
-    {0x746F0000u, 40u}, // to -> Latn
-    {0x95D30000u, 40u}, // tof -> Latn
-    {0x99D30000u, 40u}, // tog -> Latn
-    {0xC1D30000u, 40u}, // toq -> Latn
-    {0xA1F30000u, 40u}, // tpi -> Latn
-    {0xB1F30000u, 40u}, // tpm -> Latn
-    {0xE5F30000u, 40u}, // tpz -> Latn
-    {0xBA130000u, 40u}, // tqo -> Latn
-    {0x74720000u, 40u}, // tr -> Latn
-    {0xD2330000u, 40u}, // tru -> Latn
-    {0xD6330000u, 40u}, // trv -> Latn
-    {0xDA330000u,  1u}, // trw -> Arab
-    {0x74730000u, 40u}, // ts -> Latn
-    {0x8E530000u, 21u}, // tsd -> Grek
-    {0x96530000u, 16u}, // tsf -> Deva
-    {0x9A530000u, 40u}, // tsg -> Latn
-    {0xA6530000u, 81u}, // tsj -> Tibt
-    {0xDA530000u, 40u}, // tsw -> Latn
-    {0x74740000u, 15u}, // tt -> Cyrl
-    {0x8E730000u, 40u}, // ttd -> Latn
-    {0x92730000u, 40u}, // tte -> Latn
-    {0xA6730000u, 40u}, // ttj -> Latn
-    {0xC6730000u, 40u}, // ttr -> Latn
-    {0xCA730000u, 80u}, // tts -> Thai
-    {0xCE730000u, 40u}, // ttt -> Latn
-    {0x9E930000u, 40u}, // tuh -> Latn
-    {0xAE930000u, 40u}, // tul -> Latn
-    {0xB2930000u, 40u}, // tum -> Latn
-    {0xC2930000u, 40u}, // tuq -> Latn
-    {0x8EB30000u, 40u}, // tvd -> Latn
-    {0xAEB30000u, 40u}, // tvl -> Latn
-    {0xD2B30000u, 40u}, // tvu -> Latn
-    {0x9ED30000u, 40u}, // twh -> Latn
-    {0xC2D30000u, 40u}, // twq -> Latn
-    {0x9AF30000u, 75u}, // txg -> Tang
-    {0x74790000u, 40u}, // ty -> Latn
-    {0x83130000u, 40u}, // tya -> Latn
-    {0xD7130000u, 15u}, // tyv -> Cyrl
-    {0xB3330000u, 40u}, // tzm -> Latn
-    {0xD0340000u, 40u}, // ubu -> Latn
-    {0xB0740000u, 15u}, // udm -> Cyrl
-    {0x75670000u,  1u}, // ug -> Arab
-    {0x75674B5Au, 15u}, // ug-KZ -> Cyrl
-    {0x75674D4Eu, 15u}, // ug-MN -> Cyrl
-    {0x80D40000u, 82u}, // uga -> Ugar
-    {0x756B0000u, 15u}, // uk -> Cyrl
-    {0xA1740000u, 40u}, // uli -> Latn
-    {0x85940000u, 40u}, // umb -> Latn
-    {0xC5B40000u,  7u}, // unr -> Beng
-    {0xC5B44E50u, 16u}, // unr-NP -> Deva
-    {0xDDB40000u,  7u}, // unx -> Beng
-    {0x75720000u,  1u}, // ur -> Arab
-    {0xA2340000u, 40u}, // uri -> Latn
-    {0xCE340000u, 40u}, // urt -> Latn
-    {0xDA340000u, 40u}, // urw -> Latn
-    {0x82540000u, 40u}, // usa -> Latn
-    {0xC6740000u, 40u}, // utr -> Latn
-    {0x9EB40000u, 40u}, // uvh -> Latn
-    {0xAEB40000u, 40u}, // uvl -> Latn
-    {0x757A0000u, 40u}, // uz -> Latn
-    {0x757A4146u,  1u}, // uz-AF -> Arab
-    {0x757A434Eu, 15u}, // uz-CN -> Cyrl
-    {0x98150000u, 40u}, // vag -> Latn
-    {0xA0150000u, 83u}, // vai -> Vaii
-    {0xB4150000u, 40u}, // van -> Latn
-    {0x76650000u, 40u}, // ve -> Latn
+    {0xB4520000u, 40u}, // scn -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB4F20000u, 52u}, // shn -> Mymr
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB8AA0000u, 40u}, // kfo -> Latn
+    {0xB28A0000u, 15u}, // kum -> Cyrl
+    {0x00000000u, 0u},
+    {0xB4080000u, 40u}, // ian -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB84D0000u, 40u}, // nco -> Latn
+    {0xA2570000u, 40u}, // xsi -> Latn
+    {0x9A400000u, 40u}, // asg -> Latn
+    {0x00000000u, 0u},
+    {0xAB0C0000u, 40u}, // myk -> Latn
+    {0x00000000u, 0u},
+    {0x6F6D0000u, 40u}, // om -> Latn
+    {0x99010000u, 40u}, // big -> Latn
+    {0xB0C00000u, 40u}, // agm -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB56A0000u, 40u}, // kln -> Latn
+    {0x647A0000u, 81u}, // dz -> Tibt
+    {0x00000000u, 0u},
+    {0x84270000u, 40u}, // hbb -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x858A0000u, 40u}, // kmb -> Latn
+    {0xB32E0000u, 40u}, // ozm -> Latn
+    {0xAD530000u, 40u}, // tkl -> Latn
+    {0x85C30000u, 40u}, // dob -> Latn
+    {0xD8810000u, 40u}, // bew -> Latn
+    {0x00000000u, 0u},
+    {0xAEA00000u, 1u}, // avl -> Arab
+    {0xD4030000u, 40u}, // dav -> Latn
+    {0xCEC60000u, 1u}, // gwt -> Arab
+    {0x68720000u, 40u}, // hr -> Latn
+    {0x96A60000u, 40u}, // gvf -> Latn
+    {0xB1C10000u, 40u}, // bom -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x63680000u, 40u}, // ch -> Latn
+    {0x64760000u, 79u}, // dv -> Thaa
+    {0x81110000u, 40u}, // ria -> Latn
+    {0x666A0000u, 40u}, // fj -> Latn
+    {0xC5E00000u, 40u}, // apr -> Latn
+    {0xA14C0000u, 1u}, // mki -> Arab
+    {0x95110000u, 78u}, // rif -> Tfng
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0x88950000u, 40u}, // vec -> Latn
-    {0xBC950000u, 40u}, // vep -> Latn
-    {0x76690000u, 40u}, // vi -> Latn
-    {0x89150000u, 40u}, // vic -> Latn
-    {0xD5150000u, 40u}, // viv -> Latn
-    {0xC9750000u, 40u}, // vls -> Latn
-    {0x95950000u, 40u}, // vmf -> Latn
-    {0xD9950000u, 40u}, // vmw -> Latn
-    {0x766F0000u, 40u}, // vo -> Latn
-    {0xCDD50000u, 40u}, // vot -> Latn
-    {0xBA350000u, 40u}, // vro -> Latn
-    {0xB6950000u, 40u}, // vun -> Latn
-    {0xCE950000u, 40u}, // vut -> Latn
-    {0x77610000u, 40u}, // wa -> Latn
-    {0x90160000u, 40u}, // wae -> Latn
-    {0xA4160000u, 40u}, // waj -> Latn
-    {0xAC160000u, 18u}, // wal -> Ethi
-    {0xB4160000u, 40u}, // wan -> Latn
-    {0xC4160000u, 40u}, // war -> Latn
-    {0xBC360000u, 40u}, // wbp -> Latn
-    {0xC0360000u, 77u}, // wbq -> Telu
-    {0xC4360000u, 16u}, // wbr -> Deva
-    {0xA0560000u, 40u}, // wci -> Latn
-    {0xC4960000u, 40u}, // wer -> Latn
-    {0xA0D60000u, 40u}, // wgi -> Latn
-    {0x98F60000u, 40u}, // whg -> Latn
+    {0x00000000u, 0u},
+    {0x82810000u, 15u}, // bua -> Cyrl
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x81620000u, 40u}, // cla -> Latn
+    {0x8A250000u, 40u}, // frc -> Latn
+    {0xA2870000u, 40u}, // hui -> Latn
+    {0xBCCC0000u, 16u}, // mgp -> Deva
+    {0x6C6E0000u, 40u}, // ln -> Latn
+    {0xBD4C0000u, 40u}, // mkp -> Latn
+    {0x9EB40000u, 40u}, // uvh -> Latn
+    {0xB9D10000u, 40u}, // roo -> Latn
+    {0x00000000u, 0u},
+    {0xCA580000u, 40u}, // yss -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB26A0000u, 40u}, // ktm -> Latn
+    {0x00000000u, 0u},
+    {0x8C4F0000u, 40u}, // pcd -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x73770000u, 40u}, // sw -> Latn
+    {0x00000000u, 0u},
+    {0xC9CB0000u, 40u}, // los -> Latn
+    {0xE0E10000u, 40u}, // bhy -> Latn
+    {0x88D30000u, 40u}, // tgc -> Latn
+    {0x906A0000u, 40u}, // kde -> Latn
+    {0xA3280000u, 40u}, // izi -> Latn
+    {0xB5CF0000u, 40u}, // pon -> Latn
+    {0xC00D0000u, 40u}, // naq -> Latn
+    {0xA2010000u, 1u}, // bqi -> Arab
+    {0x00000000u, 0u},
+    {0xA5C00000u, 40u}, // aoj -> Latn
+    {0xDC2A0000u, 40u}, // kbx -> Latn
+    {0xADF20000u, 40u}, // spl -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC8920000u, 40u}, // ses -> Latn
+    {0xBA6A0000u, 40u}, // kto -> Latn
+    {0x00000000u, 0u},
+    {0xB88F0000u, 84u}, // peo -> Xpeo
+    {0xCD4B0000u, 40u}, // lkt -> Latn
+    {0x00000000u, 0u},
+    {0x98E10000u, 40u}, // bhg -> Latn
+    {0xA0C30000u, 40u}, // dgi -> Latn
+    {0xB64D0000u, 40u}, // nsn -> Latn
+    {0x00000000u, 0u},
+    {0xA0200000u, 40u}, // abi -> Latn
+    {0xD8D20000u, 18u}, // sgw -> Ethi
+    {0x87000000u, 40u}, // ayb -> Latn
+    {0x98CB0000u, 40u}, // lgg -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0x85160000u, 40u}, // wib -> Latn
-    {0xD1160000u, 40u}, // wiu -> Latn
-    {0xD5160000u, 40u}, // wiv -> Latn
-    {0x81360000u, 40u}, // wja -> Latn
-    {0xA1360000u, 40u}, // wji -> Latn
-    {0xC9760000u, 40u}, // wls -> Latn
+    {0xBACA0000u, 40u}, // kwo -> Latn
+    {0xD4010000u, 40u}, // bav -> Latn
+    {0x00000000u, 0u},
+    {0x9AF30000u, 75u}, // txg -> Tang
+    {0xBD0F0000u, 40u}, // pip -> Latn
+    {0xBC0F0000u, 40u}, // pap -> Latn
+    {0x736C0000u, 40u}, // sl -> Latn
+    {0x9C120000u, 15u}, // sah -> Cyrl
+    {0xC2930000u, 40u}, // tuq -> Latn
+    {0x8D720000u, 40u}, // sld -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x98060000u, 40u}, // gag -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x81B70000u, 53u}, // xna -> Narb
+    {0x81770000u, 40u}, // xla -> Latn
+    {0x00000000u, 0u},
+    {0xD2640000u, 40u}, // etu -> Latn
+    {0x00000000u, 0u},
+    {0xB5A00000u, 40u}, // ann -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xE0280000u, 40u}, // iby -> Latn
+    {0xBD2B0000u, 40u}, // ljp -> Latn
+    {0x95910000u, 40u}, // rmf -> Latn
+    {0x00000000u, 0u},
+    {0xA4160000u, 40u}, // waj -> Latn
+    {0x62690000u, 40u}, // bi -> Latn
+    {0x00000000u, 0u},
+    {0x75674D4Eu, 15u}, // ug-MN -> Cyrl
+    {0xE0180000u, 40u}, // yay -> Latn
+    {0x88C00000u, 40u}, // agc -> Latn
     {0xB9960000u, 40u}, // wmo -> Latn
+    {0xA0000000u, 40u}, // aai -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xBC010000u, 16u}, // bap -> Deva
+    {0x68750000u, 40u}, // hu -> Latn
+    {0x00000000u, 0u},
+    {0xDAC30000u, 40u}, // dww -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x6E6E0000u, 40u}, // nn -> Latn
+    {0xD6850000u, 40u}, // fuv -> Latn
+    {0x00000000u, 0u},
+    {0x84090000u, 40u}, // jab -> Latn
+    {0x00000000u, 0u},
+    {0xA02F0000u, 40u}, // pbi -> Latn
+    {0x746C0000u, 40u}, // tl -> Latn
+    {0xDDB20000u, 40u}, // snx -> Latn
+    {0x68615344u, 1u}, // ha-SD -> Arab
+    {0x00000000u, 0u},
+    {0xE0800000u, 40u}, // aey -> Latn
+    {0x90CA0000u, 40u}, // kge -> Latn
+    {0xC4360000u, 16u}, // wbr -> Deva
+    {0xB40C474Eu, 54u}, // man-GN -> Nkoo
     {0x89B60000u, 40u}, // wnc -> Latn
-    {0xA1B60000u,  1u}, // wni -> Arab
-    {0xD1B60000u, 40u}, // wnu -> Latn
-    {0x776F0000u, 40u}, // wo -> Latn
-    {0x85D60000u, 40u}, // wob -> Latn
-    {0xC9D60000u, 40u}, // wos -> Latn
+    {0xB72C0000u, 1u}, // mzn -> Arab
+    {0x7A685553u, 25u}, // zh-US -> Hant
+    {0xD5410000u, 40u}, // bkv -> Latn
+    {0xE02A0000u, 1u}, // kby -> Arab
+    {0x94CA0000u, 40u}, // kgf -> Latn
+    {0x916B0000u, 40u}, // lle -> Latn
+    {0xB1060000u, 40u}, // gim -> Latn
+    {0xB9EA0000u, 40u}, // kpo -> Latn
+    {0x00000000u, 0u},
+    {0xD1CD0000u, 40u}, // nou -> Latn
+    {0x6C740000u, 40u}, // lt -> Latn
+    {0x66690000u, 40u}, // fi -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x617A4951u, 1u}, // az-IQ -> Arab
+    {0xA0530000u, 40u}, // tci -> Latn
+    {0xCA8C0000u, 40u}, // mus -> Latn
+    {0x95114E4Cu, 40u}, // rif-NL -> Latn
+    {0x9C2C0000u, 40u}, // mbh -> Latn
+    {0xBA0D0000u, 54u}, // nqo -> Nkoo
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xA8070000u, 24u}, // hak -> Hans
+    {0x82A30000u, 40u}, // dva -> Latn
+    {0x9F210000u, 40u}, // bzh -> Latn
+    {0x69690000u, 86u}, // ii -> Yiii
+    {0x00000000u, 0u},
+    {0x95730000u, 40u}, // tlf -> Latn
+    {0xA2240000u, 40u}, // eri -> Latn
+    {0x8DCD0000u, 38u}, // nod -> Lana
+    {0x00000000u, 0u},
+    {0xBE010000u, 40u}, // bqp -> Latn
+    {0xBDAA0000u, 40u}, // knp -> Latn
+    {0xA8030000u, 40u}, // dak -> Latn
+    {0xACCD0000u, 40u}, // ngl -> Latn
+    {0x6A610000u, 31u}, // ja -> Jpan
+    {0x8A2B0000u, 1u}, // lrc -> Arab
+    {0xB68A0000u, 40u}, // kun -> Latn
+    {0x73760000u, 40u}, // sv -> Latn
+    {0x67610000u, 40u}, // ga -> Latn
+    {0x00000000u, 0u},
+    {0x96530000u, 16u}, // tsf -> Deva
+    {0xBD8B0000u, 40u}, // lmp -> Latn
     {0xCA360000u, 40u}, // wrs -> Latn
-    {0xAA560000u, 40u}, // wsk -> Latn
-    {0xB2760000u, 16u}, // wtm -> Deva
-    {0xD2960000u, 24u}, // wuu -> Hans
-    {0xD6960000u, 40u}, // wuv -> Latn
-    {0x82D60000u, 40u}, // wwa -> Latn
-    {0xD4170000u, 40u}, // xav -> Latn
-    {0xA0370000u, 40u}, // xbi -> Latn
-    {0xC4570000u, 10u}, // xcr -> Cari
-    {0xC8970000u, 40u}, // xes -> Latn
-    {0x78680000u, 40u}, // xh -> Latn
-    {0x81770000u, 40u}, // xla -> Latn
-    {0x89770000u, 44u}, // xlc -> Lyci
-    {0x8D770000u, 45u}, // xld -> Lydi
-    {0x95970000u, 19u}, // xmf -> Geor
-    {0xB5970000u, 47u}, // xmn -> Mani
-    {0xC5970000u, 48u}, // xmr -> Merc
-    {0x81B70000u, 53u}, // xna -> Narb
-    {0xC5B70000u, 16u}, // xnr -> Deva
-    {0x99D70000u, 40u}, // xog -> Latn
-    {0xB5D70000u, 40u}, // xon -> Latn
-    {0xC5F70000u, 63u}, // xpr -> Prti
+    {0x00000000u, 0u},
+    {0xC9E20000u, 40u}, // cps -> Latn
+    {0x00000000u, 0u},
+    {0x81840000u, 40u}, // ema -> Latn
+    {0xA64A0000u, 40u}, // ksj -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xBC360000u, 40u}, // wbp -> Latn
+    {0x8C730000u, 72u}, // tdd -> Tale
+    {0x8C2A0000u, 15u}, // kbd -> Cyrl
+    {0x9D0B0000u, 40u}, // lih -> Latn
+    {0x8DF20000u, 40u}, // spd -> Latn
+    {0x88CE0000u, 40u}, // ogc -> Latn
+    {0xBDC20000u, 13u}, // cop -> Copt
+    {0x73680000u, 40u}, // sh -> Latn
+    {0x00000000u, 0u},
+    {0xC04C0000u, 40u}, // mcq -> Latn
+    {0x8A900000u, 40u}, // quc -> Latn
+    {0x9C4D0000u, 40u}, // nch -> Latn
+    {0x73640000u, 1u}, // sd -> Arab
+    {0xB1410000u, 40u}, // bkm -> Latn
+    {0xB40D0000u, 24u}, // nan -> Hans
+    {0xBCE20000u, 40u}, // chp -> Latn
+    {0x73740000u, 40u}, // st -> Latn
+    {0xA1210000u, 18u}, // bji -> Ethi
+    {0x00000000u, 0u},
+    {0xB80A0000u, 40u}, // kao -> Latn
+    {0xC9310000u, 16u}, // rjs -> Deva
+    {0x9D930000u, 40u}, // tmh -> Latn
+    {0x00000000u, 0u},
+    {0xDEAA0000u, 1u}, // kvx -> Arab
+    {0x90ED0000u, 40u}, // nhe -> Latn
+    {0x00000000u, 0u},
+    {0x61730000u, 7u}, // as -> Beng
+    {0x00000000u, 0u},
+    {0xB5AE0000u, 40u}, // onn -> Latn
+    {0xD82B0000u, 40u}, // lbw -> Latn
+    {0x00000000u, 0u},
+    {0xB8110000u, 40u}, // rao -> Latn
+    {0xDDEA0000u, 40u}, // kpx -> Latn
+    {0x00000000u, 0u},
+    {0xCC930000u, 40u}, // tet -> Latn
+    {0x00000000u, 0u},
+    {0xA2C60000u, 40u}, // gwi -> Latn
+    {0x00000000u, 0u},
+    {0xB9A70000u, 1u}, // hno -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xD08C0000u, 40u}, // meu -> Latn
+    {0xA9400000u, 85u}, // akk -> Xsux
+    {0x84ED0000u, 40u}, // nhb -> Latn
+    {0x00000000u, 0u},
+    {0xC1920000u, 40u}, // smq -> Latn
+    {0x00000000u, 0u},
+    {0xA2340000u, 40u}, // uri -> Latn
+    {0x8C0A0000u, 40u}, // kad -> Latn
+    {0x00000000u, 0u},
+    {0x86850000u, 1u}, // fub -> Arab
+    {0xA0F20000u, 78u}, // shi -> Tfng
+    {0xD7130000u, 15u}, // tyv -> Cyrl
+    {0x00000000u, 0u},
+    {0x63760000u, 15u}, // cv -> Cyrl
+    {0xC72A0000u, 40u}, // kzr -> Latn
+    {0x9C0B0000u, 1u}, // lah -> Arab
+    {0xE6860000u, 40u}, // guz -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x81AC0000u, 40u}, // mna -> Latn
+    {0xD00F0000u, 40u}, // pau -> Latn
+    {0x992A0000u, 39u}, // kjg -> Laoo
+    {0x00000000u, 0u},
+    {0xD10D0000u, 40u}, // niu -> Latn
+    {0xD28F0000u, 40u}, // puu -> Latn
+    {0x61790000u, 40u}, // ay -> Latn
+    {0xD0F20000u, 1u}, // shu -> Arab
+    {0xDDEC0000u, 40u}, // mpx -> Latn
+    {0xACE00000u, 40u}, // ahl -> Latn
+    {0x00000000u, 0u},
     {0x86370000u, 40u}, // xrb -> Latn
-    {0x82570000u, 66u}, // xsa -> Sarb
-    {0xA2570000u, 40u}, // xsi -> Latn
-    {0xB2570000u, 40u}, // xsm -> Latn
-    {0xC6570000u, 16u}, // xsr -> Deva
-    {0x92D70000u, 40u}, // xwe -> Latn
-    {0xB0180000u, 40u}, // yam -> Latn
-    {0xB8180000u, 40u}, // yao -> Latn
-    {0xBC180000u, 40u}, // yap -> Latn
-    {0xC8180000u, 40u}, // yas -> Latn
-    {0xCC180000u, 40u}, // yat -> Latn
-    {0xD4180000u, 40u}, // yav -> Latn
-    {0xE0180000u, 40u}, // yay -> Latn
-    {0xE4180000u, 40u}, // yaz -> Latn
-    {0x80380000u, 40u}, // yba -> Latn
-    {0x84380000u, 40u}, // ybb -> Latn
-    {0xE0380000u, 40u}, // yby -> Latn
-    {0xC4980000u, 40u}, // yer -> Latn
-    {0xC4D80000u, 40u}, // ygr -> Latn
-    {0xD8D80000u, 40u}, // ygw -> Latn
-    {0x79690000u, 27u}, // yi -> Hebr
-    {0xB9580000u, 40u}, // yko -> Latn
-    {0x91780000u, 40u}, // yle -> Latn
-    {0x99780000u, 40u}, // ylg -> Latn
-    {0xAD780000u, 40u}, // yll -> Latn
-    {0xAD980000u, 40u}, // yml -> Latn
-    {0x796F0000u, 40u}, // yo -> Latn
-    {0xB5D80000u, 40u}, // yon -> Latn
-    {0x86380000u, 40u}, // yrb -> Latn
-    {0x92380000u, 40u}, // yre -> Latn
-    {0xAE380000u, 40u}, // yrl -> Latn
-    {0xCA580000u, 40u}, // yss -> Latn
-    {0x82980000u, 40u}, // yua -> Latn
-    {0x92980000u, 25u}, // yue -> Hant
-    {0x9298434Eu, 24u}, // yue-CN -> Hans
-    {0xA6980000u, 40u}, // yuj -> Latn
-    {0xCE980000u, 40u}, // yut -> Latn
-    {0xDA980000u, 40u}, // yuw -> Latn
-    {0x7A610000u, 40u}, // za -> Latn
-    {0x98190000u, 40u}, // zag -> Latn
-    {0xA4790000u,  1u}, // zdj -> Arab
-    {0x80990000u, 40u}, // zea -> Latn
-    {0x9CD90000u, 78u}, // zgh -> Tfng
-    {0x7A680000u, 24u}, // zh -> Hans
-    {0x7A684155u, 25u}, // zh-AU -> Hant
-    {0x7A68424Eu, 25u}, // zh-BN -> Hant
-    {0x7A684742u, 25u}, // zh-GB -> Hant
-    {0x7A684746u, 25u}, // zh-GF -> Hant
-    {0x7A68484Bu, 25u}, // zh-HK -> Hant
-    {0x7A684944u, 25u}, // zh-ID -> Hant
-    {0x7A684D4Fu, 25u}, // zh-MO -> Hant
-    {0x7A684D59u, 25u}, // zh-MY -> Hant
-    {0x7A685041u, 25u}, // zh-PA -> Hant
-    {0x7A685046u, 25u}, // zh-PF -> Hant
+    {0x00000000u, 0u},
+    {0xE0A10000u, 16u}, // bfy -> Deva
+    {0xD90C0000u, 40u}, // miw -> Latn
+    {0x9A900000u, 40u}, // qug -> Latn
+    {0xBA400000u, 40u}, // aso -> Latn
+    {0xE28B0000u, 40u}, // luy -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x83130000u, 40u}, // tya -> Latn
+    {0xDC810000u, 40u}, // bex -> Latn
+    {0xC4AA0000u, 16u}, // kfr -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0x7A685048u, 25u}, // zh-PH -> Hant
-    {0x7A685352u, 25u}, // zh-SR -> Hant
-    {0x7A685448u, 25u}, // zh-TH -> Hant
-    {0x7A685457u, 25u}, // zh-TW -> Hant
-    {0x7A685553u, 25u}, // zh-US -> Hant
-    {0x7A68564Eu, 25u}, // zh-VN -> Hant
+    {0x61610000u, 40u}, // aa -> Latn
+    {0x00000000u, 0u},
+    {0xC44C0000u, 40u}, // mcr -> Latn
+    {0xAD070000u, 40u}, // hil -> Latn
+    {0x00000000u, 0u},
+    {0xA1C30000u, 1u}, // doi -> Arab
+    {0xB5C10000u, 40u}, // bon -> Latn
+    {0x00000000u, 0u},
+    {0x68740000u, 40u}, // ht -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x63720000u, 9u}, // cr -> Cans
+    {0x89B20000u, 40u}, // snc -> Latn
+    {0xC5520000u, 1u}, // skr -> Arab
+    {0x9C480000u, 40u}, // ich -> Latn
+    {0x00000000u, 0u},
+    {0xA4060000u, 40u}, // gaj -> Latn
+    {0x6B795452u, 40u}, // ky-TR -> Latn
+    {0x626E0000u, 7u}, // bn -> Beng
+    {0x8E2C0000u, 16u}, // mrd -> Deva
+    {0xBC0D0000u, 40u}, // nap -> Latn
+    {0xBA8B0000u, 40u}, // luo -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xD8EA0000u, 1u}, // khw -> Arab
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xB4AC0000u, 40u}, // mfn -> Latn
+    {0x00000000u, 0u},
+    {0x76650000u, 40u}, // ve -> Latn
+    {0xAAD10000u, 40u}, // rwk -> Latn
+    {0x8D770000u, 45u}, // xld -> Lydi
+    {0x617A0000u, 40u}, // az -> Latn
+    {0xE4EA0000u, 40u}, // khz -> Latn
+    {0x8C8B0000u, 40u}, // led -> Latn
+    {0xB2930000u, 40u}, // tum -> Latn
+    {0xE5210000u, 40u}, // bjz -> Latn
+    {0xD1B60000u, 40u}, // wnu -> Latn
+    {0xCDC70000u, 40u}, // hot -> Latn
+    {0x7A750000u, 40u}, // zu -> Latn
+    {0x00000000u, 0u},
+    {0x80600000u, 40u}, // ada -> Latn
+    {0xA0B30000u, 40u}, // tfi -> Latn
+    {0x00000000u, 0u},
+    {0x9DB30000u, 40u}, // tnh -> Latn
+    {0x99200000u, 40u}, // ajg -> Latn
+    {0x6B79434Eu, 1u}, // ky-CN -> Arab
     {0x81190000u, 40u}, // zia -> Latn
-    {0xB1790000u, 40u}, // zlm -> Latn
-    {0xA1990000u, 40u}, // zmi -> Latn
+    {0x63790000u, 40u}, // cy -> Latn
+    {0xD04D0000u, 40u}, // ncu -> Latn
+    {0xA1840000u, 40u}, // emi -> Latn
+    {0x67760000u, 40u}, // gv -> Latn
+    {0x9ED30000u, 40u}, // twh -> Latn
+    {0x00000000u, 0u},
+    {0xC4460000u, 40u}, // gcr -> Latn
+    {0xD9950000u, 40u}, // vmw -> Latn
+    {0x00000000u, 0u},
+    {0x8E830000u, 40u}, // dud -> Latn
+    {0x6F630000u, 40u}, // oc -> Latn
+    {0x84860000u, 40u}, // geb -> Latn
+    {0xB4060000u, 24u}, // gan -> Hans
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xBAC40000u, 40u}, // ewo -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x656C0000u, 21u}, // el -> Grek
+    {0x94060000u, 40u}, // gaf -> Latn
+    {0x9C400000u, 40u}, // ach -> Latn
+    {0x94330000u, 40u}, // tbf -> Latn
+    {0x00000000u, 0u},
+    {0xA6600000u, 40u}, // atj -> Latn
+    {0xE2850000u, 40u}, // fuy -> Latn
+    {0xD98A0000u, 40u}, // kmw -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x74690000u, 18u}, // ti -> Ethi
+    {0xE4810000u, 40u}, // bez -> Latn
+    {0x99B10000u, 40u}, // rng -> Latn
+    {0xDA330000u, 1u}, // trw -> Arab
+    {0xCE950000u, 40u}, // vut -> Latn
+    {0xE1440000u, 32u}, // eky -> Kali
+    {0x00000000u, 0u},
+    {0xE0600000u, 15u}, // ady -> Cyrl
+    {0x00000000u, 0u},
+    {0xA9480000u, 40u}, // ikk -> Latn
+    {0x00000000u, 0u},
+    {0xDC6C0000u, 18u}, // mdx -> Ethi
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
     {0x91B90000u, 40u}, // zne -> Latn
-    {0x7A750000u, 40u}, // zu -> Latn
-    {0x83390000u, 40u}, // zza -> Latn
-});
+    {0xBA610000u, 40u}, // bto -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x9C060000u, 40u}, // gah -> Latn
+    {0xB0E20000u, 15u}, // chm -> Cyrl
+    {0xE6200000u, 1u}, // arz -> Arab
+    {0xD5150000u, 40u}, // viv -> Latn
+    {0xC2ED0000u, 40u}, // nxq -> Latn
+    {0xACEF0000u, 1u}, // phl -> Arab
+    {0xB6AC0000u, 40u}, // mvn -> Latn
+    {0x846B0000u, 40u}, // ldb -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x840A0000u, 40u}, // kab -> Latn
+    {0xB32C0000u, 40u}, // mzm -> Latn
+    {0x86320000u, 70u}, // srb -> Sora
+    {0xD80C0000u, 40u}, // maw -> Latn
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0xC1410000u, 40u}, // bkq -> Latn
+    {0xA0A50000u, 40u}, // ffi -> Latn
+    {0x00000000u, 0u},
+    {0x62650000u, 15u}, // be -> Cyrl
+    {0x00000000u, 0u},
+    {0xD6CC0000u, 40u}, // mwv -> Latn
+    {0xA22A0000u, 40u}, // kri -> Latn
+    {0x00000000u, 0u},
+    {0x9C810000u, 40u}, // beh -> Latn
+    {0x00000000u, 0u},
+    {0x68610000u, 40u}, // ha -> Latn
+    {0xB9800000u, 40u}, // amo -> Latn
+    {0x00000000u, 0u},
+    {0x99AF0000u, 40u}, // png -> Latn
+    {0x92380000u, 40u}, // yre -> Latn
+    {0xAA220000u, 9u}, // crk -> Cans
+    {0xAECB0000u, 80u}, // lwl -> Thai
+    {0x82210000u, 16u}, // bra -> Deva
+    {0x8C830000u, 40u}, // ded -> Latn
+    {0x00000000u, 0u},
+    {0x93010000u, 40u}, // bye -> Latn
+    {0x00000000u, 0u},
+    {0xC5B44E50u, 16u}, // unr-NP -> Deva
+    {0x00000000u, 0u},
+    {0x00000000u, 0u},
+    {0x86C00000u, 40u}, // awb -> Latn
+    {0x8A010000u, 40u}, // bqc -> Latn
+    {0x00000000u, 0u},
+    {0xA0680000u, 40u}, // idi -> Latn
+    {0x69730000u, 40u}, // is -> Latn
+    {0xDD730000u, 40u}, // tlx -> Latn
+    {0x00000000u, 0u},
+    {0xB0260000u, 16u}, // gbm -> Deva
+    {0xBEEA0000u, 1u}, // kxp -> Arab
+    {0xB8930000u, 40u}, // teo -> Latn
+    {0xC5B40000u, 7u}, // unr -> Beng
+    {0xCDAF0000u, 21u}, // pnt -> Grek
+    {0xE5CA0000u, 40u}, // koz -> Latn
+    {0xCE410000u, 18u}, // bst -> Ethi
+    {0x73750000u, 40u}, // su -> Latn
+    {0xD5130000u, 40u}, // tiv -> Latn
+    {0xCD870000u, 40u}, // hmt -> Latn
+    {0x00000000u, 0u},
+    {0xB4630000u, 40u}, // ddn -> Latn
+    {0x81920000u, 40u}, // sma -> Latn
+    {0x9A910000u, 40u}, // rug -> Latn
+    {0xBAD10000u, 40u}, // rwo -> Latn
+    {0xE0200000u, 40u}, // aby -> Latn
+    {0xD10A0000u, 40u}, // kiu -> Latn
+    {0x804D0000u, 40u}, // nca -> Latn
+    {0x00000000u, 0u},
+};
 
-std::unordered_set<uint64_t> REPRESENTATIVE_LOCALES({
-    0x616145544C61746Ellu, // aa_Latn_ET
+inline const LikelyScriptEntry* likelyScriptLookup(uint32_t key) {
+    const uint32_t bucket = perfectHashSlot(key, 0u, LIKELY_SCRIPTS_MASK);
+    const uint32_t slot =
+            perfectHashSlot(key, LIKELY_SCRIPTS_SALTS[bucket], LIKELY_SCRIPTS_MASK);
+    return LIKELY_SCRIPTS_SLOTS[slot].key == key ? &LIKELY_SCRIPTS_SLOTS[slot] : nullptr;
+}
+
+const uint64_t REPRESENTATIVE_LOCALES_MASK = 0x3FFu;
+const uint16_t REPRESENTATIVE_LOCALES_SALTS[1024] = {
+    0u, 0u, 0u, 0u, 1u, 1u, 3u, 0u, 0u, 1u, 3u, 0u,
+    2u, 0u, 1u, 2u, 0u, 0u, 3u, 6u, 2u, 0u, 2u, 1u,
+    0u, 0u, 1u, 4u, 1u, 0u, 0u, 2u, 0u, 0u, 2u, 5u,
+    1u, 0u, 0u, 5u, 0u, 0u, 0u, 2u, 3u, 0u, 0u, 0u,
+    1u, 0u, 0u, 3u, 2u, 0u, 1u, 1u, 1u, 0u, 0u, 1u,
+    2u, 1u, 1u, 0u, 0u, 1u, 10u, 2u, 0u, 1u, 0u, 0u,
+    1u, 0u, 0u, 0u, 0u, 2u, 1u, 0u, 3u, 1u, 0u, 11u,
+    0u, 4u, 0u, 5u, 0u, 0u, 1u, 2u, 0u, 1u, 4u, 0u,
+    1u, 4u, 0u, 1u, 4u, 0u, 0u, 0u, 0u, 0u, 1u, 0u,
+    1u, 3u, 2u, 0u, 3u, 3u, 0u, 0u, 0u, 1u, 0u, 3u,
+    0u, 1u, 0u, 0u, 1u, 1u, 1u, 4u, 0u, 1u, 1u, 1u,
+    0u, 5u, 1u, 2u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 5u, 0u, 3u, 0u,
+    0u, 1u, 0u, 4u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u,
+    0u, 0u, 0u, 0u, 1u, 9u, 0u, 1u, 1u, 4u, 0u, 1u,
+    1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 2u, 0u,
+    0u, 0u, 1u, 2u, 3u, 0u, 0u, 2u, 0u, 0u, 1u, 4u,
+    1u, 2u, 0u, 2u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u,
+    1u, 2u, 2u, 14u, 1u, 0u, 1u, 1u, 0u, 2u, 2u, 1u,
+    0u, 0u, 6u, 0u, 3u, 0u, 1u, 0u, 4u, 0u, 0u, 1u,
+    0u, 1u, 2u, 1u, 0u, 0u, 2u, 0u, 0u, 3u, 1u, 0u,
+    1u, 0u, 0u, 2u, 2u, 3u, 3u, 0u, 0u, 2u, 0u, 0u,
+    1u, 0u, 3u, 0u, 1u, 0u, 0u, 2u, 1u, 1u, 2u, 2u,
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 5u, 0u, 1u, 3u,
+    0u, 2u, 2u, 0u, 2u, 0u, 0u, 2u, 0u, 0u, 0u, 3u,
+    6u, 4u, 1u, 0u, 3u, 1u, 0u, 2u, 1u, 0u, 1u, 5u,
+    1u, 0u, 6u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u,
+    1u, 0u, 0u, 0u, 1u, 1u, 2u, 3u, 0u, 3u, 0u, 3u,
+    0u, 2u, 1u, 2u, 2u, 0u, 0u, 0u, 1u, 0u, 7u, 1u,
+    0u, 1u, 1u, 1u, 5u, 1u, 0u, 4u, 0u, 0u, 2u, 1u,
+    0u, 1u, 0u, 3u, 0u, 2u, 0u, 0u, 0u, 2u, 0u, 2u,
+    0u, 0u, 1u, 4u, 1u, 0u, 0u, 3u, 1u, 2u, 4u, 1u,
+    0u, 0u, 1u, 0u, 1u, 0u, 0u, 2u, 0u, 1u, 1u, 0u,
+    1u, 1u, 0u, 3u, 8u, 0u, 0u, 1u, 1u, 0u, 0u, 0u,
+    1u, 0u, 1u, 0u, 5u, 1u, 1u, 0u, 3u, 2u, 0u, 0u,
+    4u, 1u, 1u, 0u, 0u, 0u, 1u, 2u, 0u, 0u, 1u, 1u,
+    0u, 1u, 0u, 0u, 4u, 0u, 0u, 0u, 0u, 0u, 0u, 2u,
+    0u, 0u, 3u, 0u, 0u, 1u, 2u, 1u, 0u, 0u, 6u, 1u,
+    0u, 1u, 1u, 2u, 1u, 5u, 0u, 1u, 2u, 1u, 0u, 1u,
+    2u, 0u, 2u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2u,
+    1u, 0u, 0u, 0u, 0u, 0u, 3u, 0u, 1u, 0u, 1u, 1u,
+    4u, 1u, 0u, 3u, 0u, 1u, 0u, 0u, 0u, 3u, 0u, 1u,
+    0u, 2u, 0u, 5u, 0u, 5u, 0u, 1u, 0u, 2u, 0u, 9u,
+    0u, 2u, 3u, 3u, 0u, 1u, 2u, 1u, 0u, 0u, 5u, 0u,
+    0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u, 2u, 1u, 0u,
+    1u, 0u, 0u, 0u, 1u, 1u, 0u, 2u, 0u, 1u, 0u, 3u,
+    2u, 2u, 2u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 3u,
+    0u, 1u, 0u, 0u, 1u, 2u, 1u, 7u, 3u, 1u, 0u, 0u,
+    1u, 0u, 0u, 0u, 9u, 1u, 0u, 0u, 5u, 1u, 0u, 0u,
+    2u, 0u, 0u, 0u, 2u, 7u, 0u, 0u, 0u, 0u, 0u, 1u,
+    2u, 1u, 0u, 0u, 0u, 1u, 0u, 4u, 0u, 0u, 1u, 1u,
+    1u, 0u, 0u, 0u, 1u, 0u, 5u, 2u, 3u, 1u, 0u, 1u,
+    0u, 2u, 11u, 2u, 1u, 5u, 1u, 2u, 1u, 1u, 1u, 0u,
+    0u, 1u, 2u, 3u, 0u, 0u, 0u, 0u, 0u, 2u, 3u, 0u,
+    3u, 0u, 0u, 0u, 1u, 0u, 2u, 0u, 2u, 1u, 0u, 1u,
+    0u, 0u, 2u, 0u, 1u, 0u, 7u, 1u, 1u, 0u, 0u, 1u,
+    1u, 1u, 3u, 2u, 0u, 0u, 2u, 0u, 2u, 0u, 0u, 1u,
+    0u, 1u, 0u, 1u, 2u, 1u, 1u, 0u, 1u, 1u, 0u, 1u,
+    1u, 0u, 0u, 0u, 0u, 9u, 0u, 1u, 2u, 0u, 1u, 0u,
+    6u, 1u, 0u, 5u, 1u, 0u, 0u, 7u, 1u, 1u, 0u, 0u,
+    3u, 0u, 1u, 1u, 4u, 0u, 1u, 0u, 1u, 1u, 0u, 1u,
+    2u, 6u, 1u, 1u, 0u, 1u, 0u, 3u, 1u, 1u, 0u, 4u,
+    0u, 0u, 0u, 0u, 2u, 0u, 4u, 1u, 0u, 12u, 0u, 0u,
+    0u, 2u, 0u, 2u, 1u, 4u, 1u, 1u, 1u, 0u, 0u, 0u,
+    0u, 0u, 0u, 0u, 1u, 3u, 2u, 0u, 0u, 0u, 0u, 2u,
+    0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u,
+    2u, 1u, 1u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u,
+    4u, 0u, 0u, 2u, 1u, 1u, 3u, 0u, 1u, 0u, 0u, 0u,
+    1u, 0u, 1u, 0u, 0u, 0u, 2u, 2u, 2u, 0u, 1u, 1u,
+    2u, 1u, 0u, 0u, 0u, 0u, 2u, 1u, 0u, 2u, 0u, 0u,
+    3u, 0u, 1u, 3u, 3u, 0u, 0u, 0u, 0u, 1u, 1u, 3u,
+    1u, 2u, 0u, 0u, 0u, 3u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 0u, 1u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u,
+    3u, 2u, 0u, 1u, 0u, 1u, 2u, 1u, 1u, 2u, 1u, 1u,
+    0u, 0u, 0u, 0u, 4u, 0u, 1u, 0u, 0u, 1u, 2u, 1u,
+    1u, 1u, 3u, 1u, 2u, 0u, 2u, 0u, 0u, 0u, 0u, 1u,
+    2u, 1u, 0u, 7u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u,
+    0u, 0u, 1u, 0u, 0u, 0u, 2u, 1u, 0u, 2u, 1u, 0u,
+    0u, 0u, 1u, 0u, 1u, 1u, 0u, 1u, 0u, 0u, 0u, 0u,
+    0u, 0u, 1u, 0u, 0u, 0u, 1u, 0u, 3u, 0u, 6u, 0u,
+    0u, 0u, 0u, 0u, 2u, 0u, 0u, 1u, 0u, 3u, 1u, 0u,
+    0u, 0u, 0u, 0u, 0u, 1u, 3u, 0u, 3u, 0u, 3u, 0u,
+    0u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 3u, 0u, 0u, 0u,
+    1u, 3u, 5u, 2u, 0u, 3u, 2u, 0u, 5u, 0u, 0u, 1u,
+    0u, 1u, 2u, 5u, 0u, 5u, 1u, 2u, 0u, 0u, 0u, 1u,
+    1u, 0u, 0u, 0u,
+};
+
+const uint64_t REPRESENTATIVE_LOCALES_SLOTS[1024] = {
+    0xB2634D4C4C61746Ellu, // dtm_Latn_ML
+    0xA5A343494C61746Ellu, // dnj_Latn_CI
+    0xE426495241726162llu, // gbz_Arab_IR
     0x616247454379726Cllu, // ab_Cyrl_GE
-    0xC42047484C61746Ellu, // abr_Latn_GH
-    0x904049444C61746Ellu, // ace_Latn_ID
-    0x9C4055474C61746Ellu, // ach_Latn_UG
-    0x806047484C61746Ellu, // ada_Latn_GH
-    0xE06052554379726Cllu, // ady_Cyrl_RU
-    0x6165495241767374llu, // ae_Avst_IR
-    0x8480544E41726162llu, // aeb_Arab_TN
-    0x61665A414C61746Ellu, // af_Latn_ZA
-    0xC0C0434D4C61746Ellu, // agq_Latn_CM
-    0xB8E0494E41686F6Dllu, // aho_Ahom_IN
-    0x616B47484C61746Ellu, // ak_Latn_GH
-    0xA940495158737578llu, // akk_Xsux_IQ
-    0xB560584B4C61746Ellu, // aln_Latn_XK
-    0xCD6052554379726Cllu, // alt_Cyrl_RU
-    0x616D455445746869llu, // am_Ethi_ET
-    0xB9804E474C61746Ellu, // amo_Latn_NG
-    0xE5C049444C61746Ellu, // aoz_Latn_ID
-    0x8DE0544741726162llu, // apd_Arab_TG
-    0x6172454741726162llu, // ar_Arab_EG
-    0x8A20495241726D69llu, // arc_Armi_IR
-    0x8A204A4F4E626174llu, // arc_Nbat_JO
-    0x8A20535950616C6Dllu, // arc_Palm_SY
-    0xB620434C4C61746Ellu, // arn_Latn_CL
-    0xBA20424F4C61746Ellu, // aro_Latn_BO
-    0xC220445A41726162llu, // arq_Arab_DZ
-    0xE2204D4141726162llu, // ary_Arab_MA
-    0xE620454741726162llu, // arz_Arab_EG
-    0x6173494E42656E67llu, // as_Beng_IN
-    0x8240545A4C61746Ellu, // asa_Latn_TZ
-    0x9240555353676E77llu, // ase_Sgnw_US
-    0xCE4045534C61746Ellu, // ast_Latn_ES
-    0xA66043414C61746Ellu, // atj_Latn_CA
-    0x617652554379726Cllu, // av_Cyrl_RU
-    0x82C0494E44657661llu, // awa_Deva_IN
-    0x6179424F4C61746Ellu, // ay_Latn_BO
-    0x617A495241726162llu, // az_Arab_IR
-    0x617A415A4C61746Ellu, // az_Latn_AZ
-    0x626152554379726Cllu, // ba_Cyrl_RU
-    0xAC01504B41726162llu, // bal_Arab_PK
-    0xB40149444C61746Ellu, // ban_Latn_ID
-    0xBC014E5044657661llu, // bap_Deva_NP
-    0xC40141544C61746Ellu, // bar_Latn_AT
-    0xC801434D4C61746Ellu, // bas_Latn_CM
-    0xDC01434D42616D75llu, // bax_Bamu_CM
-    0x882149444C61746Ellu, // bbc_Latn_ID
-    0xA421434D4C61746Ellu, // bbj_Latn_CM
-    0xA04143494C61746Ellu, // bci_Latn_CI
-    0x626542594379726Cllu, // be_Cyrl_BY
-    0xA481534441726162llu, // bej_Arab_SD
-    0xB0815A4D4C61746Ellu, // bem_Latn_ZM
-    0xD88149444C61746Ellu, // bew_Latn_ID
-    0xE481545A4C61746Ellu, // bez_Latn_TZ
-    0x8CA1434D4C61746Ellu, // bfd_Latn_CM
-    0xC0A1494E54616D6Cllu, // bfq_Taml_IN
-    0xCCA1504B41726162llu, // bft_Arab_PK
-    0xE0A1494E44657661llu, // bfy_Deva_IN
-    0x626742474379726Cllu, // bg_Cyrl_BG
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x687448544C61746Ellu, // ht_Latn_HT
+    0xB5C6494E54656C75llu, // gon_Telu_IN
+    0xA174464D4C61746Ellu, // uli_Latn_FM
+    0x950B4E5044657661llu, // lif_Deva_NP
+    0xBA8B4B454C61746Ellu, // luo_Latn_KE
+    0x0000000000000000llu,
+    0x6B6C474C4C61746Ellu, // kl_Latn_GL
+    0x0000000000000000llu,
+    0xA00C494E44657661llu, // mai_Deva_IN
+    0xB80A4D4C4C61746Ellu, // kao_Latn_ML
+    0xD83350484C61746Ellu, // tbw_Latn_PH
+    0x9A5350484C61746Ellu, // tsg_Latn_PH
+    0x0000000000000000llu,
+    0xB92D494E4C61746Ellu, // njo_Latn_IN
+    0x0000000000000000llu,
+    0x736B534B4C61746Ellu, // sk_Latn_SK
+    0xD126504B41726162llu, // gju_Arab_PK
+    0x8A2647524C696E62llu, // grc_Linb_GR
+    0xC5B7494E44657661llu, // xnr_Deva_IN
+    0x0000000000000000llu,
+    0xC2ED434E4C61746Ellu, // nxq_Latn_CN
+    0x6E6E4E4F4C61746Ellu, // nn_Latn_NO
+    0x0000000000000000llu,
+    0xA04143494C61746Ellu, // bci_Latn_CI
+    0x6173494E42656E67llu, // as_Beng_IN
+    0x0000000000000000llu,
+    0xD5134E474C61746Ellu, // tiv_Latn_NG
+    0xAE2A52554C61746Ellu, // krl_Latn_RU
+    0x91CD494E44657661llu, // noe_Deva_IN
+    0x0000000000000000llu,
+    0x886D4D5A4C61746Ellu, // ndc_Latn_MZ
+    0xDDB4494E42656E67llu, // unx_Beng_IN
     0x88C1494E44657661llu, // bgc_Deva_IN
-    0xB4C1504B41726162llu, // bgn_Arab_PK
-    0xDCC154524772656Bllu, // bgx_Grek_TR
-    0x84E1494E44657661llu, // bhb_Deva_IN
-    0xA0E1494E44657661llu, // bhi_Deva_IN
-    0xA8E150484C61746Ellu, // bhk_Latn_PH
-    0xB8E1494E44657661llu, // bho_Deva_IN
-    0x626956554C61746Ellu, // bi_Latn_VU
-    0xA90150484C61746Ellu, // bik_Latn_PH
-    0xB5014E474C61746Ellu, // bin_Latn_NG
-    0xA521494E44657661llu, // bjj_Deva_IN
-    0xB52149444C61746Ellu, // bjn_Latn_ID
-    0xB141434D4C61746Ellu, // bkm_Latn_CM
-    0xD14150484C61746Ellu, // bku_Latn_PH
-    0xCD61564E54617674llu, // blt_Tavt_VN
-    0x626D4D4C4C61746Ellu, // bm_Latn_ML
-    0xC1814D4C4C61746Ellu, // bmq_Latn_ML
-    0x626E424442656E67llu, // bn_Beng_BD
-    0x626F434E54696274llu, // bo_Tibt_CN
-    0xE1E1494E42656E67llu, // bpy_Beng_IN
-    0xA201495241726162llu, // bqi_Arab_IR
-    0xD60143494C61746Ellu, // bqv_Latn_CI
-    0x627246524C61746Ellu, // br_Latn_FR
-    0x8221494E44657661llu, // bra_Deva_IN
-    0x9E21504B41726162llu, // brh_Arab_PK
-    0xDE21494E44657661llu, // brx_Deva_IN
-    0x627342414C61746Ellu, // bs_Latn_BA
-    0xC2414C5242617373llu, // bsq_Bass_LR
-    0xCA41434D4C61746Ellu, // bss_Latn_CM
-    0xBA6150484C61746Ellu, // bto_Latn_PH
-    0xD661504B44657661llu, // btv_Deva_PK
-    0x828152554379726Cllu, // bua_Cyrl_RU
-    0x8A8159544C61746Ellu, // buc_Latn_YT
-    0x9A8149444C61746Ellu, // bug_Latn_ID
+    0x736E5A574C61746Ellu, // sn_Latn_ZW
+    0x676E50594C61746Ellu, // gn_Latn_PY
+    0x8685434D41726162llu, // fub_Arab_CM
+    0x0000000000000000llu,
+    0xCEE445534C61746Ellu, // ext_Latn_ES
+    0x6977494C48656272llu, // iw_Hebr_IL
     0xB281434D4C61746Ellu, // bum_Latn_CM
-    0x86A147514C61746Ellu, // bvb_Latn_GQ
-    0xB701455245746869llu, // byn_Ethi_ER
-    0xD701434D4C61746Ellu, // byv_Latn_CM
-    0x93214D4C4C61746Ellu, // bze_Latn_ML
-    0x636145534C61746Ellu, // ca_Latn_ES
-    0x9C424E474C61746Ellu, // cch_Latn_NG
-    0xBC42494E42656E67llu, // ccp_Beng_IN
-    0xBC42424443616B6Dllu, // ccp_Cakm_BD
-    0x636552554379726Cllu, // ce_Cyrl_RU
-    0x848250484C61746Ellu, // ceb_Latn_PH
-    0x98C255474C61746Ellu, // cgg_Latn_UG
-    0x636847554C61746Ellu, // ch_Latn_GU
-    0xA8E2464D4C61746Ellu, // chk_Latn_FM
-    0xB0E252554379726Cllu, // chm_Cyrl_RU
-    0xB8E255534C61746Ellu, // cho_Latn_US
-    0xBCE243414C61746Ellu, // chp_Latn_CA
-    0xC4E2555343686572llu, // chr_Cher_US
-    0x81224B4841726162llu, // cja_Arab_KH
-    0xB122564E4368616Dllu, // cjm_Cham_VN
-    0x8542495141726162llu, // ckb_Arab_IQ
-    0x636F46524C61746Ellu, // co_Latn_FR
-    0xBDC24547436F7074llu, // cop_Copt_EG
-    0xC9E250484C61746Ellu, // cps_Latn_PH
-    0x6372434143616E73llu, // cr_Cans_CA
-    0xA622434143616E73llu, // crj_Cans_CA
-    0xAA22434143616E73llu, // crk_Cans_CA
-    0xAE22434143616E73llu, // crl_Cans_CA
-    0xB222434143616E73llu, // crm_Cans_CA
-    0xCA2253434C61746Ellu, // crs_Latn_SC
-    0x6373435A4C61746Ellu, // cs_Latn_CZ
-    0x8642504C4C61746Ellu, // csb_Latn_PL
-    0xDA42434143616E73llu, // csw_Cans_CA
-    0x8E624D4D50617563llu, // ctd_Pauc_MM
-    0x637552554379726Cllu, // cu_Cyrl_RU
+    0x0000000000000000llu,
+    0xC1814D4C4C61746Ellu, // bmq_Latn_ML
+    0xCCA1504B41726162llu, // bft_Arab_PK
+    0x9DCC43414C61746Ellu, // moh_Latn_CA
+    0x737252534379726Cllu, // sr_Cyrl_RS
+    0x0000000000000000llu,
+    0x800647484C61746Ellu, // gaa_Latn_GH
+    0xB5014E474C61746Ellu, // bin_Latn_NG
+    0x6B73494E41726162llu, // ks_Arab_IN
+    0xE0A1494E44657661llu, // bfy_Deva_IN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x941247484C61746Ellu, // saf_Latn_GH
     0x63754247476C6167llu, // cu_Glag_BG
-    0x637652554379726Cllu, // cv_Cyrl_RU
+    0xBE2546524C61746Ellu, // frp_Latn_FR
+    0x828B43444C61746Ellu, // lua_Latn_CD
+    0x82984D584C61746Ellu, // yua_Latn_MX
+    0x0000000000000000llu,
+    0x8E2C4E5044657661llu, // mrd_Deva_NP
+    0x8A2555534C61746Ellu, // frc_Latn_US
+    0xC8D24C544C61746Ellu, // sgs_Latn_LT
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x6A7649444C61746Ellu, // jv_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x65734D584C61746Ellu, // es_Latn_MX
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x9597474547656F72llu, // xmf_Geor_GE
+    0x0000000000000000llu,
     0x637947424C61746Ellu, // cy_Latn_GB
-    0x6461444B4C61746Ellu, // da_Latn_DK
-    0xA80355534C61746Ellu, // dak_Latn_US
-    0xC40352554379726Cllu, // dar_Cyrl_RU
-    0xD4034B454C61746Ellu, // dav_Latn_KE
-    0x8843494E41726162llu, // dcc_Arab_IN
-    0x646544454C61746Ellu, // de_Latn_DE
-    0xB48343414C61746Ellu, // den_Latn_CA
-    0xC4C343414C61746Ellu, // dgr_Latn_CA
-    0x91234E454C61746Ellu, // dje_Latn_NE
-    0xA5A343494C61746Ellu, // dnj_Latn_CI
-    0xA1C3494E41726162llu, // doi_Arab_IN
-    0x864344454C61746Ellu, // dsb_Latn_DE
-    0xB2634D4C4C61746Ellu, // dtm_Latn_ML
-    0xBE634D594C61746Ellu, // dtp_Latn_MY
-    0xE2634E5044657661llu, // dty_Deva_NP
-    0x8283434D4C61746Ellu, // dua_Latn_CM
-    0x64764D5654686161llu, // dv_Thaa_MV
-    0xBB03534E4C61746Ellu, // dyo_Latn_SN
-    0xD30342464C61746Ellu, // dyu_Latn_BF
-    0x647A425454696274llu, // dz_Tibt_BT
-    0xD0244B454C61746Ellu, // ebu_Latn_KE
-    0x656547484C61746Ellu, // ee_Latn_GH
-    0xA0A44E474C61746Ellu, // efi_Latn_NG
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xD82B49444C61746Ellu, // lbw_Latn_ID
+    0x0000000000000000llu,
+    0x95114D4154666E67llu, // rif_Tfng_MA
+    0x0000000000000000llu,
+    0xB1C6494E44657661llu, // gom_Deva_IN
+    0xC97657464C61746Ellu, // wls_Latn_WF
+    0x0000000000000000llu,
     0xACC449544C61746Ellu, // egl_Latn_IT
-    0xE0C4454745677970llu, // egy_Egyp_EG
-    0xE1444D4D4B616C69llu, // eky_Kali_MM
-    0x656C47524772656Bllu, // el_Grek_GR
-    0x656E47424C61746Ellu, // en_Latn_GB
-    0x656E55534C61746Ellu, // en_Latn_US
-    0x656E474253686177llu, // en_Shaw_GB
-    0x657345534C61746Ellu, // es_Latn_ES
-    0x65734D584C61746Ellu, // es_Latn_MX
-    0x657355534C61746Ellu, // es_Latn_US
-    0xD24455534C61746Ellu, // esu_Latn_US
-    0x657445454C61746Ellu, // et_Latn_EE
-    0xCE6449544974616Cllu, // ett_Ital_IT
-    0x657545534C61746Ellu, // eu_Latn_ES
-    0xBAC4434D4C61746Ellu, // ewo_Latn_CM
-    0xCEE445534C61746Ellu, // ext_Latn_ES
-    0x6661495241726162llu, // fa_Arab_IR
-    0xB40547514C61746Ellu, // fan_Latn_GQ
-    0x6666474E41646C6Dllu, // ff_Adlm_GN
+    0x73654E4F4C61746Ellu, // se_Latn_NO
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x91EA4C524C61746Ellu, // kpe_Latn_LR
+    0x7567434E41726162llu, // ug_Arab_CN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x6D6E434E4D6F6E67llu, // mn_Mong_CN
+    0xC90B434E4C697375llu, // lis_Lisu_CN
+    0xA0F24D4154666E67llu, // shi_Tfng_MA
+    0x0000000000000000llu,
+    0xCC6F43414C61746Ellu, // pdt_Latn_CA
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x6B6E494E4B6E6461llu, // kn_Knda_IN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x80D249454F67616Dllu, // sga_Ogam_IE
+    0x9CD94D4154666E67llu, // zgh_Tfng_MA
     0x6666534E4C61746Ellu, // ff_Latn_SN
-    0xB0A54D4C4C61746Ellu, // ffm_Latn_ML
-    0x666946494C61746Ellu, // fi_Latn_FI
-    0x8105534441726162llu, // fia_Arab_SD
-    0xAD0550484C61746Ellu, // fil_Latn_PH
-    0xCD0553454C61746Ellu, // fit_Latn_SE
-    0x666A464A4C61746Ellu, // fj_Latn_FJ
-    0x666F464F4C61746Ellu, // fo_Latn_FO
-    0xB5C5424A4C61746Ellu, // fon_Latn_BJ
-    0x667246524C61746Ellu, // fr_Latn_FR
-    0x8A2555534C61746Ellu, // frc_Latn_US
-    0xBE2546524C61746Ellu, // frp_Latn_FR
-    0xC62544454C61746Ellu, // frr_Latn_DE
-    0xCA2544454C61746Ellu, // frs_Latn_DE
-    0x8685434D41726162llu, // fub_Arab_CM
-    0x8E8557464C61746Ellu, // fud_Latn_WF
-    0x9685474E4C61746Ellu, // fuf_Latn_GN
-    0xC2854E454C61746Ellu, // fuq_Latn_NE
-    0xC68549544C61746Ellu, // fur_Latn_IT
-    0xD6854E474C61746Ellu, // fuv_Latn_NG
-    0xC6A553444C61746Ellu, // fvr_Latn_SD
-    0x66794E4C4C61746Ellu, // fy_Latn_NL
-    0x676149454C61746Ellu, // ga_Latn_IE
-    0x800647484C61746Ellu, // gaa_Latn_GH
-    0x98064D444C61746Ellu, // gag_Latn_MD
-    0xB406434E48616E73llu, // gan_Hans_CN
-    0xE00649444C61746Ellu, // gay_Latn_ID
-    0xB026494E44657661llu, // gbm_Deva_IN
-    0xE426495241726162llu, // gbz_Arab_IR
-    0xC44647464C61746Ellu, // gcr_Latn_GF
-    0x676447424C61746Ellu, // gd_Latn_GB
-    0xE486455445746869llu, // gez_Ethi_ET
-    0xB4C64E5044657661llu, // ggn_Deva_NP
-    0xAD064B494C61746Ellu, // gil_Latn_KI
-    0xA926504B41726162llu, // gjk_Arab_PK
-    0xD126504B41726162llu, // gju_Arab_PK
-    0x676C45534C61746Ellu, // gl_Latn_ES
-    0xA966495241726162llu, // glk_Arab_IR
-    0x676E50594C61746Ellu, // gn_Latn_PY
-    0xB1C6494E44657661llu, // gom_Deva_IN
-    0xB5C6494E54656C75llu, // gon_Telu_IN
-    0xC5C649444C61746Ellu, // gor_Latn_ID
-    0xC9C64E4C4C61746Ellu, // gos_Latn_NL
-    0xCDC65541476F7468llu, // got_Goth_UA
-    0x8A26435943707274llu, // grc_Cprt_CY
-    0x8A2647524C696E62llu, // grc_Linb_GR
-    0xCE26494E42656E67llu, // grt_Beng_IN
-    0xDA4643484C61746Ellu, // gsw_Latn_CH
-    0x6775494E47756A72llu, // gu_Gujr_IN
-    0x868642524C61746Ellu, // gub_Latn_BR
-    0x8A86434F4C61746Ellu, // guc_Latn_CO
-    0xC68647484C61746Ellu, // gur_Latn_GH
-    0xE6864B454C61746Ellu, // guz_Latn_KE
-    0x6776494D4C61746Ellu, // gv_Latn_IM
-    0xC6A64E5044657661llu, // gvr_Deva_NP
-    0xA2C643414C61746Ellu, // gwi_Latn_CA
-    0x68614E474C61746Ellu, // ha_Latn_NG
-    0xA807434E48616E73llu, // hak_Hans_CN
-    0xD80755534C61746Ellu, // haw_Latn_US
-    0xE407414641726162llu, // haz_Arab_AF
-    0x6865494C48656272llu, // he_Hebr_IL
-    0x6869494E44657661llu, // hi_Deva_IN
-    0x9507464A4C61746Ellu, // hif_Latn_FJ
-    0xAD0750484C61746Ellu, // hil_Latn_PH
-    0xD1675452486C7577llu, // hlu_Hluw_TR
-    0x8D87434E506C7264llu, // hmd_Plrd_CN
-    0x8DA7504B41726162llu, // hnd_Arab_PK
-    0x91A7494E44657661llu, // hne_Deva_IN
-    0xA5A74C41486D6E67llu, // hnj_Hmng_LA
-    0xB5A750484C61746Ellu, // hnn_Latn_PH
-    0xB9A7504B41726162llu, // hno_Arab_PK
-    0x686F50474C61746Ellu, // ho_Latn_PG
-    0x89C7494E44657661llu, // hoc_Deva_IN
-    0xA5C7494E44657661llu, // hoj_Deva_IN
-    0x687248524C61746Ellu, // hr_Latn_HR
-    0x864744454C61746Ellu, // hsb_Latn_DE
-    0xB647434E48616E73llu, // hsn_Hans_CN
-    0x687448544C61746Ellu, // ht_Latn_HT
-    0x687548554C61746Ellu, // hu_Latn_HU
-    0x6879414D41726D6Ellu, // hy_Armn_AM
-    0x687A4E414C61746Ellu, // hz_Latn_NA
-    0x696146524C61746Ellu, // ia_Latn_FR
-    0x80284D594C61746Ellu, // iba_Latn_MY
-    0x84284E474C61746Ellu, // ibb_Latn_NG
-    0x696449444C61746Ellu, // id_Latn_ID
-    0x69674E474C61746Ellu, // ig_Latn_NG
-    0x6969434E59696969llu, // ii_Yiii_CN
-    0x696B55534C61746Ellu, // ik_Latn_US
-    0xCD4843414C61746Ellu, // ikt_Latn_CA
-    0xB96850484C61746Ellu, // ilo_Latn_PH
-    0x696E49444C61746Ellu, // in_Latn_ID
-    0x9DA852554379726Cllu, // inh_Cyrl_RU
-    0x697349534C61746Ellu, // is_Latn_IS
+    0x646544454C61746Ellu, // de_Latn_DE
+    0xE02A4E4541726162llu, // kby_Arab_NE
+    0x0000000000000000llu,
+    0xB6F249444C61746Ellu, // sxn_Latn_ID
+    0xD701434D4C61746Ellu, // byv_Latn_CM
+    0x6165495241767374llu, // ae_Avst_IR
+    0x0000000000000000llu,
+    0xC40141544C61746Ellu, // bar_Latn_AT
+    0x0000000000000000llu,
+    0x736743464C61746Ellu, // sg_Latn_CF
+    0x73694C4B53696E68llu, // si_Sinh_LK
+    0x889549544C61746Ellu, // vec_Latn_IT
+    0x6D674D474C61746Ellu, // mg_Latn_MG
+    0x0000000000000000llu,
+    0x6D744D544C61746Ellu, // mt_Latn_MT
+    0xAC01504B41726162llu, // bal_Arab_PK
+    0xC48C4B454C61746Ellu, // mer_Latn_KE
+    0x0000000000000000llu,
+    0xC9314E5044657661llu, // rjs_Deva_NP
+    0x84EA434E54616C75llu, // khb_Talu_CN
+    0x706C504C4C61746Ellu, // pl_Latn_PL
+    0xC41650484C61746Ellu, // war_Latn_PH
+    0x736F534F4C61746Ellu, // so_Latn_SO
+    0x6B7652554379726Cllu, // kv_Cyrl_RU
+    0xC2D34E454C61746Ellu, // twq_Latn_NE
     0x697449544C61746Ellu, // it_Latn_IT
-    0x6975434143616E73llu, // iu_Cans_CA
-    0x6977494C48656272llu, // iw_Hebr_IL
-    0x9F2852554C61746Ellu, // izh_Latn_RU
-    0x6A614A504A70616Ellu, // ja_Jpan_JP
-    0xB0094A4D4C61746Ellu, // jam_Latn_JM
-    0xB8C9434D4C61746Ellu, // jgo_Latn_CM
-    0x8989545A4C61746Ellu, // jmc_Latn_TZ
-    0xAD894E5044657661llu, // jml_Deva_NP
-    0xCE89444B4C61746Ellu, // jut_Latn_DK
-    0x6A7649444C61746Ellu, // jv_Latn_ID
+    0x0000000000000000llu,
+    0x9C0B504B41726162llu, // lah_Arab_PK
+    0x0000000000000000llu,
+    0xCC93544C4C61746Ellu, // tet_Latn_TL
+    0x6F7347454379726Cllu, // os_Cyrl_GE
+    0x0000000000000000llu,
+    0x717550454C61746Ellu, // qu_Latn_PE
+    0x6B79434E41726162llu, // ky_Arab_CN
+    0xCDD552554C61746Ellu, // vot_Latn_RU
+    0x0000000000000000llu,
+    0xC9CC42464C61746Ellu, // mos_Latn_BF
+    0x6373435A4C61746Ellu, // cs_Latn_CZ
+    0xACAF44454C61746Ellu, // pfl_Latn_DE
+    0x0000000000000000llu,
+    0x616145544C61746Ellu, // aa_Latn_ET
+    0x9C424E474C61746Ellu, // cch_Latn_NG
+    0x747254524C61746Ellu, // tr_Latn_TR
+    0xB48A434D4C61746Ellu, // ken_Latn_CM
+    0xD418434D4C61746Ellu, // yav_Latn_CM
+    0xC220445A41726162llu, // arq_Arab_DZ
+    0xB9804E474C61746Ellu, // amo_Latn_NG
+    0xC2854E454C61746Ellu, // fuq_Latn_NE
     0x6A7749444C61746Ellu, // jw_Latn_ID
-    0x6B61474547656F72llu, // ka_Geor_GE
-    0x800A555A4379726Cllu, // kaa_Cyrl_UZ
-    0x840A445A4C61746Ellu, // kab_Latn_DZ
-    0x880A4D4D4C61746Ellu, // kac_Latn_MM
-    0xA40A4E474C61746Ellu, // kaj_Latn_NG
-    0xB00A4B454C61746Ellu, // kam_Latn_KE
-    0xB80A4D4C4C61746Ellu, // kao_Latn_ML
+    0xDF0C55474C61746Ellu, // myx_Latn_UG
+    0x0000000000000000llu,
+    0xB9A7504B41726162llu, // hno_Arab_PK
+    0xC00D4E414C61746Ellu, // naq_Latn_NA
+    0xDA4643484C61746Ellu, // gsw_Latn_CH
+    0x0000000000000000llu,
+    0xB4F24D4D4D796D72llu, // shn_Mymr_MM
+    0x95D1545A4C61746Ellu, // rof_Latn_TZ
+    0xB4C64E5044657661llu, // ggn_Deva_NP
+    0x627246524C61746Ellu, // br_Latn_FR
+    0xA0E1494E44657661llu, // bhi_Deva_IN
+    0x8E2F495241726162llu, // prd_Arab_IR
+    0x0000000000000000llu,
+    0xB89355474C61746Ellu, // teo_Latn_UG
+    0x833954524C61746Ellu, // zza_Latn_TR
     0x8C2A52554379726Cllu, // kbd_Cyrl_RU
-    0xE02A4E4541726162llu, // kby_Arab_NE
-    0x984A4E474C61746Ellu, // kcg_Latn_NG
-    0xA84A5A574C61746Ellu, // kck_Latn_ZW
+    0x0000000000000000llu,
+    0x9CCC4D5A4C61746Ellu, // mgh_Latn_MZ
+    0x90AC4D554C61746Ellu, // mfe_Latn_MU
+    0x6975434143616E73llu, // iu_Cans_CA
+    0x6D734D594C61746Ellu, // ms_Latn_MY
+    0xA40B55474C61746Ellu, // laj_Latn_UG
+    0xA9B24D4C4C61746Ellu, // snk_Latn_ML
+    0xC712495153797263llu, // syr_Syrc_IQ
+    0x0000000000000000llu,
+    0x840B47524C696E61llu, // lab_Lina_GR
+    0xB5CF464D4C61746Ellu, // pon_Latn_FM
+    0x0000000000000000llu,
+    0x940C434D4C61746Ellu, // maf_Latn_CM
+    0xCE26494E42656E67llu, // grt_Beng_IN
+    0xC46C49444C61746Ellu, // mdr_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x9A8149444C61746Ellu, // bug_Latn_ID
+    0x0000000000000000llu,
+    0x8542495141726162llu, // ckb_Arab_IQ
+    0x0000000000000000llu,
+    0x796F4E474C61746Ellu, // yo_Latn_NG
+    0x9F2B434E48616E73llu, // lzh_Hans_CN
+    0xA481534441726162llu, // bej_Arab_SD
+    0x0000000000000000llu,
+    0xE620454741726162llu, // arz_Arab_EG
+    0xD88D4E5044657661llu, // new_Deva_NP
+    0x0000000000000000llu,
+    0xC552504B41726162llu, // skr_Arab_PK
+    0x0000000000000000llu,
+    0xB8CC434D4C61746Ellu, // mgo_Latn_CM
+    0xCC12494E4C61746Ellu, // sat_Latn_IN
+    0x897754524C796369llu, // xlc_Lyci_TR
+    0x6E624E4F4C61746Ellu, // nb_Latn_NO
+    0x0000000000000000llu,
+    0xA1994D594C61746Ellu, // zmi_Latn_MY
+    0x0000000000000000llu,
+    0x6E6F4E4F4C61746Ellu, // no_Latn_NO
+    0x6E654E5044657661llu, // ne_Deva_NP
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xDE21494E44657661llu, // brx_Deva_IN
+    0x84284E474C61746Ellu, // ibb_Latn_NG
+    0x828152554379726Cllu, // bua_Cyrl_RU
+    0xE2AC504B41726162llu, // mvy_Arab_PK
+    0xD80755534C61746Ellu, // haw_Latn_US
+    0x0000000000000000llu,
+    0xB59246494C61746Ellu, // smn_Latn_FI
+    0x8CA1434D4C61746Ellu, // bfd_Latn_CM
+    0x6179424F4C61746Ellu, // ay_Latn_BO
+    0xCD51424442656E67llu, // rkt_Beng_BD
+    0x687A4E414C61746Ellu, // hz_Latn_NA
     0x906A545A4C61746Ellu, // kde_Latn_TZ
-    0x9C6A544741726162llu, // kdh_Arab_TG
-    0xCC6A544854686169llu, // kdt_Thai_TH
-    0x808A43564C61746Ellu, // kea_Latn_CV
-    0xB48A434D4C61746Ellu, // ken_Latn_CM
-    0xB8AA43494C61746Ellu, // kfo_Latn_CI
-    0xC4AA494E44657661llu, // kfr_Deva_IN
-    0xE0AA494E44657661llu, // kfy_Deva_IN
-    0x6B6743444C61746Ellu, // kg_Latn_CD
-    0x90CA49444C61746Ellu, // kge_Latn_ID
+    0xBC0F41574C61746Ellu, // pap_Latn_AW
+    0x6775494E47756A72llu, // gu_Gujr_IN
+    0xB560584B4C61746Ellu, // aln_Latn_XK
+    0x636847554C61746Ellu, // ch_Latn_GU
+    0xBA20424F4C61746Ellu, // aro_Latn_BO
+    0xBC42424443616B6Dllu, // ccp_Cakm_BD
+    0x0000000000000000llu,
+    0xC97542454C61746Ellu, // vls_Latn_BE
+    0x627342414C61746Ellu, // bs_Latn_BA
+    0x0000000000000000llu,
+    0x887249544C61746Ellu, // sdc_Latn_IT
+    0xB40547514C61746Ellu, // fan_Latn_GQ
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xD23354524C61746Ellu, // tru_Latn_TR
     0xBCCA42524C61746Ellu, // kgp_Latn_BR
-    0x80EA494E4C61746Ellu, // kha_Latn_IN
-    0x84EA434E54616C75llu, // khb_Talu_CN
-    0xB4EA494E44657661llu, // khn_Deva_IN
-    0xC0EA4D4C4C61746Ellu, // khq_Latn_ML
-    0xCCEA494E4D796D72llu, // kht_Mymr_IN
-    0xD8EA504B41726162llu, // khw_Arab_PK
-    0x6B694B454C61746Ellu, // ki_Latn_KE
-    0xD10A54524C61746Ellu, // kiu_Latn_TR
-    0x6B6A4E414C61746Ellu, // kj_Latn_NA
-    0x992A4C414C616F6Fllu, // kjg_Laoo_LA
-    0x6B6B434E41726162llu, // kk_Arab_CN
-    0x6B6B4B5A4379726Cllu, // kk_Cyrl_KZ
-    0xA54A434D4C61746Ellu, // kkj_Latn_CM
-    0x6B6C474C4C61746Ellu, // kl_Latn_GL
-    0xB56A4B454C61746Ellu, // kln_Latn_KE
-    0x6B6D4B484B686D72llu, // km_Khmr_KH
-    0x858A414F4C61746Ellu, // kmb_Latn_AO
-    0x6B6E494E4B6E6461llu, // kn_Knda_IN
-    0x6B6F4B524B6F7265llu, // ko_Kore_KR
-    0xA1CA52554379726Cllu, // koi_Cyrl_RU
-    0xA9CA494E44657661llu, // kok_Deva_IN
-    0xC9CA464D4C61746Ellu, // kos_Latn_FM
-    0x91EA4C524C61746Ellu, // kpe_Latn_LR
-    0x8A2A52554379726Cllu, // krc_Cyrl_RU
-    0xA22A534C4C61746Ellu, // kri_Latn_SL
-    0xA62A50484C61746Ellu, // krj_Latn_PH
-    0xAE2A52554C61746Ellu, // krl_Latn_RU
-    0xD22A494E44657661llu, // kru_Deva_IN
-    0x6B73494E41726162llu, // ks_Arab_IN
-    0x864A545A4C61746Ellu, // ksb_Latn_TZ
-    0x964A434D4C61746Ellu, // ksf_Latn_CM
-    0x9E4A44454C61746Ellu, // ksh_Latn_DE
-    0x6B75495141726162llu, // ku_Arab_IQ
-    0x6B7554524C61746Ellu, // ku_Latn_TR
+    0x0000000000000000llu,
+    0xB8C9434D4C61746Ellu, // jgo_Latn_CM
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x901643484C61746Ellu, // wae_Latn_CH
+    0x9AD244454C61746Ellu, // swg_Latn_DE
+    0x8257594553617262llu, // xsa_Sarb_YE
+    0x80994E4C4C61746Ellu, // zea_Latn_NL
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xC036494E54656C75llu, // wbq_Telu_IN
+    0xBC0D49544C61746Ellu, // nap_Latn_IT
+    0x736C53494C61746Ellu, // sl_Latn_SI
+    0x667246524C61746Ellu, // fr_Latn_FR
+    0x626742474379726Cllu, // bg_Cyrl_BG
+    0xB093534C4C61746Ellu, // tem_Latn_SL
+    0x945152454C61746Ellu, // rcf_Latn_RE
+    0xAD064B494C61746Ellu, // gil_Latn_KI
+    0x0000000000000000llu,
+    0x8E5347524772656Bllu, // tsd_Grek_GR
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x85D149444C61746Ellu, // rob_Latn_ID
+    0xE2204D4141726162llu, // ary_Arab_MA
+    0x7061494E47757275llu, // pa_Guru_IN
+    0x980F50484C61746Ellu, // pag_Latn_PH
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB8E0494E41686F6Dllu, // aho_Ahom_IN
+    0x0000000000000000llu,
+    0x74735A414C61746Ellu, // ts_Latn_ZA
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x998D434D4C61746Ellu, // nmg_Latn_CM
+    0x0000000000000000llu,
+    0xA80355534C61746Ellu, // dak_Latn_US
+    0x726E42494C61746Ellu, // rn_Latn_BI
+    0xB0E252554379726Cllu, // chm_Cyrl_RU
+    0xC68549544C61746Ellu, // fur_Latn_IT
+    0xBC9552554C61746Ellu, // vep_Latn_RU
+    0x7364494E53696E64llu, // sd_Sind_IN
+    0x6F6D45544C61746Ellu, // om_Latn_ET
+    0x656C47524772656Bllu, // el_Grek_GR
+    0xAD53544B4C61746Ellu, // tkl_Latn_TK
+    0x0000000000000000llu,
+    0x8221494E44657661llu, // bra_Deva_IN
+    0xC632534E4C61746Ellu, // srr_Latn_SN
+    0x686F50474C61746Ellu, // ho_Latn_PG
+    0x8DA7504B41726162llu, // hnd_Arab_PK
+    0x0000000000000000llu,
+    0x6776494D4C61746Ellu, // gv_Latn_IM
+    0x0000000000000000llu,
+    0xC99246494C61746Ellu, // sms_Latn_FI
+    0x7361494E44657661llu, // sa_Deva_IN
     0xB28A52554379726Cllu, // kum_Cyrl_RU
-    0x6B7652554379726Cllu, // kv_Cyrl_RU
-    0xC6AA49444C61746Ellu, // kvr_Latn_ID
-    0xDEAA504B41726162llu, // kvx_Arab_PK
-    0x6B7747424C61746Ellu, // kw_Latn_GB
-    0xB2EA544854686169llu, // kxm_Thai_TH
-    0xBEEA504B41726162llu, // kxp_Arab_PK
-    0x6B79434E41726162llu, // ky_Arab_CN
-    0x6B794B474379726Cllu, // ky_Cyrl_KG
-    0x6B7954524C61746Ellu, // ky_Latn_TR
-    0x6C6156414C61746Ellu, // la_Latn_VA
-    0x840B47524C696E61llu, // lab_Lina_GR
-    0x8C0B494C48656272llu, // lad_Hebr_IL
-    0x980B545A4C61746Ellu, // lag_Latn_TZ
-    0x9C0B504B41726162llu, // lah_Arab_PK
-    0xA40B55474C61746Ellu, // laj_Latn_UG
-    0x6C624C554C61746Ellu, // lb_Latn_LU
-    0x902B52554379726Cllu, // lbe_Cyrl_RU
-    0xD82B49444C61746Ellu, // lbw_Latn_ID
-    0xBC4B434E54686169llu, // lcp_Thai_CN
-    0xBC8B494E4C657063llu, // lep_Lepc_IN
+    0xCD534E5044657661llu, // tkt_Deva_NP
+    0x0000000000000000llu,
+    0xA521494E44657661llu, // bjj_Deva_IN
+    0x626F434E54696274llu, // bo_Tibt_CN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB701455245746869llu, // byn_Ethi_ER
+    0x8240545A4C61746Ellu, // asa_Latn_TZ
+    0x7061504B41726162llu, // pa_Arab_PK
+    0x726D43484C61746Ellu, // rm_Latn_CH
+    0x0000000000000000llu,
     0xE48B52554379726Cllu, // lez_Cyrl_RU
-    0x6C6755474C61746Ellu, // lg_Latn_UG
-    0x6C694E4C4C61746Ellu, // li_Latn_NL
-    0x950B4E5044657661llu, // lif_Deva_NP
-    0x950B494E4C696D62llu, // lif_Limb_IN
-    0xA50B49544C61746Ellu, // lij_Latn_IT
-    0xC90B434E4C697375llu, // lis_Lisu_CN
-    0xBD2B49444C61746Ellu, // ljp_Latn_ID
-    0xA14B495241726162llu, // lki_Arab_IR
-    0xCD4B55534C61746Ellu, // lkt_Latn_US
-    0xB58B494E54656C75llu, // lmn_Telu_IN
-    0xB98B49544C61746Ellu, // lmo_Latn_IT
-    0x6C6E43444C61746Ellu, // ln_Latn_CD
-    0x6C6F4C414C616F6Fllu, // lo_Laoo_LA
-    0xADCB43444C61746Ellu, // lol_Latn_CD
-    0xE5CB5A4D4C61746Ellu, // loz_Latn_ZM
-    0x8A2B495241726162llu, // lrc_Arab_IR
-    0x6C744C544C61746Ellu, // lt_Latn_LT
     0x9A6B4C564C61746Ellu, // ltg_Latn_LV
-    0x6C7543444C61746Ellu, // lu_Latn_CD
-    0x828B43444C61746Ellu, // lua_Latn_CD
-    0xBA8B4B454C61746Ellu, // luo_Latn_KE
-    0xE28B4B454C61746Ellu, // luy_Latn_KE
-    0xE68B495241726162llu, // luz_Arab_IR
-    0x6C764C564C61746Ellu, // lv_Latn_LV
-    0xAECB544854686169llu, // lwl_Thai_TH
-    0x9F2B434E48616E73llu, // lzh_Hans_CN
-    0xE72B54524C61746Ellu, // lzz_Latn_TR
-    0x8C0C49444C61746Ellu, // mad_Latn_ID
-    0x940C434D4C61746Ellu, // maf_Latn_CM
-    0x980C494E44657661llu, // mag_Deva_IN
-    0xA00C494E44657661llu, // mai_Deva_IN
-    0xA80C49444C61746Ellu, // mak_Latn_ID
+    0xAD894E5044657661llu, // jml_Deva_NP
+    0xA50D49444C61746Ellu, // nij_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x86A147514C61746Ellu, // bvb_Latn_GQ
+    0x747452554379726Cllu, // tt_Cyrl_RU
+    0xD63354574C61746Ellu, // trv_Latn_TW
+    0x0000000000000000llu,
+    0xC4E2555343686572llu, // chr_Cher_US
+    0xAE22434143616E73llu, // crl_Cans_CA
+    0x0000000000000000llu,
+    0x6E674E414C61746Ellu, // ng_Latn_NA
+    0x6F6346524C61746Ellu, // oc_Latn_FR
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x819253454C61746Ellu, // sma_Latn_SE
+    0xB3334D414C61746Ellu, // tzm_Latn_MA
+    0xD9954D5A4C61746Ellu, // vmw_Latn_MZ
+    0x6661495241726162llu, // fa_Arab_IR
+    0xC6AA49444C61746Ellu, // kvr_Latn_ID
+    0xC44647464C61746Ellu, // gcr_Latn_GF
+    0x617A415A4C61746Ellu, // az_Latn_AZ
+    0xD296434E48616E73llu, // wuu_Hans_CN
+    0x746F544F4C61746Ellu, // to_Latn_TO
+    0x78685A414C61746Ellu, // xh_Latn_ZA
+    0x6B6B4B5A4379726Cllu, // kk_Cyrl_KZ
+    0x0000000000000000llu,
+    0x6B6D4B484B686D72llu, // km_Khmr_KH
+    0x0000000000000000llu,
+    0xB620434C4C61746Ellu, // arn_Latn_CL
+    0x9507464A4C61746Ellu, // hif_Latn_FJ
     0xB40C474D4C61746Ellu, // man_Latn_GM
-    0xB40C474E4E6B6F6Fllu, // man_Nkoo_GN
-    0xC80C4B454C61746Ellu, // mas_Latn_KE
-    0xE40C4D584C61746Ellu, // maz_Latn_MX
-    0x946C52554379726Cllu, // mdf_Cyrl_RU
-    0x9C6C50484C61746Ellu, // mdh_Latn_PH
-    0xC46C49444C61746Ellu, // mdr_Latn_ID
-    0xB48C534C4C61746Ellu, // men_Latn_SL
-    0xC48C4B454C61746Ellu, // mer_Latn_KE
-    0x80AC544841726162llu, // mfa_Arab_TH
-    0x90AC4D554C61746Ellu, // mfe_Latn_MU
-    0x6D674D474C61746Ellu, // mg_Latn_MG
-    0x9CCC4D5A4C61746Ellu, // mgh_Latn_MZ
-    0xB8CC434D4C61746Ellu, // mgo_Latn_CM
-    0xBCCC4E5044657661llu, // mgp_Deva_NP
-    0xE0CC545A4C61746Ellu, // mgy_Latn_TZ
-    0x6D684D484C61746Ellu, // mh_Latn_MH
-    0x6D694E5A4C61746Ellu, // mi_Latn_NZ
-    0xB50C49444C61746Ellu, // min_Latn_ID
-    0xC90C495148617472llu, // mis_Hatr_IQ
+    0xD28F47414C61746Ellu, // puu_Latn_GA
+    0xD30342464C61746Ellu, // dyu_Latn_BF
+    0xA852494E44657661llu, // sck_Deva_IN
+    0xAA4D434143616E73llu, // nsk_Cans_CA
+    0xC5C649444C61746Ellu, // gor_Latn_ID
+    0xC5F7495250727469llu, // xpr_Prti_IR
+    0xCA2253434C61746Ellu, // crs_Latn_SC
+    0x626542594379726Cllu, // be_Cyrl_BY
+    0xACF34E5044657661llu, // thl_Deva_NP
+    0x0000000000000000llu,
+    0x959146494C61746Ellu, // rmf_Latn_FI
+    0xB07452554379726Cllu, // udm_Cyrl_RU
+    0x980C494E44657661llu, // mag_Deva_IN
+    0x637552554379726Cllu, // cu_Cyrl_RU
+    0x98734E5044657661llu, // tdg_Deva_NP
+    0xE28B4B454C61746Ellu, // luy_Latn_KE
+    0xA201495241726162llu, // bqi_Arab_IR
+    0xA84A5A574C61746Ellu, // kck_Latn_ZW
+    0x8A86434F4C61746Ellu, // guc_Latn_CO
+    0xCA2544454C61746Ellu, // frs_Latn_DE
+    0x0000000000000000llu,
+    0xC98F49544C61746Ellu, // pms_Latn_IT
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xC9C64E4C4C61746Ellu, // gos_Latn_NL
+    0x626152554379726Cllu, // ba_Cyrl_RU
+    0xC0A1494E54616D6Cllu, // bfq_Taml_IN
+    0xB45249544C61746Ellu, // scn_Latn_IT
+    0x81224B4841726162llu, // cja_Arab_KH
+    0xD71352554379726Cllu, // tyv_Cyrl_RU
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x8E8557464C61746Ellu, // fud_Latn_WF
+    0xC9E250484C61746Ellu, // cps_Latn_PH
+    0xA421434D4C61746Ellu, // bbj_Latn_CM
+    0xCE73415A4C61746Ellu, // ttt_Latn_AZ
+    0x776F534E4C61746Ellu, // wo_Latn_SN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x737549444C61746Ellu, // su_Latn_ID
+    0x9240555353676E77llu, // ase_Sgnw_US
     0x6D6B4D4B4379726Cllu, // mk_Cyrl_MK
-    0x6D6C494E4D6C796Dllu, // ml_Mlym_IN
-    0xC96C53444C61746Ellu, // mls_Latn_SD
-    0x6D6E4D4E4379726Cllu, // mn_Cyrl_MN
-    0x6D6E434E4D6F6E67llu, // mn_Mong_CN
-    0xA1AC494E42656E67llu, // mni_Beng_IN
-    0xD9AC4D4D4D796D72llu, // mnw_Mymr_MM
-    0x91CC43414C61746Ellu, // moe_Latn_CA
-    0x9DCC43414C61746Ellu, // moh_Latn_CA
-    0xC9CC42464C61746Ellu, // mos_Latn_BF
-    0x6D72494E44657661llu, // mr_Deva_IN
-    0x8E2C4E5044657661llu, // mrd_Deva_NP
-    0xA62C52554379726Cllu, // mrj_Cyrl_RU
-    0xBA2C42444D726F6Fllu, // mro_Mroo_BD
-    0x6D734D594C61746Ellu, // ms_Latn_MY
-    0x6D744D544C61746Ellu, // mt_Latn_MT
-    0xC66C494E44657661llu, // mtr_Deva_IN
-    0x828C434D4C61746Ellu, // mua_Latn_CM
-    0xCA8C55534C61746Ellu, // mus_Latn_US
-    0xE2AC504B41726162llu, // mvy_Arab_PK
-    0xAACC4D4C4C61746Ellu, // mwk_Latn_ML
-    0xC6CC494E44657661llu, // mwr_Deva_IN
-    0xD6CC49444C61746Ellu, // mwv_Latn_ID
-    0x8AEC5A574C61746Ellu, // mxc_Latn_ZW
-    0x6D794D4D4D796D72llu, // my_Mymr_MM
-    0xD70C52554379726Cllu, // myv_Cyrl_RU
-    0xDF0C55474C61746Ellu, // myx_Latn_UG
-    0xE70C49524D616E64llu, // myz_Mand_IR
-    0xB72C495241726162llu, // mzn_Arab_IR
-    0x6E614E524C61746Ellu, // na_Latn_NR
-    0xB40D434E48616E73llu, // nan_Hans_CN
-    0xBC0D49544C61746Ellu, // nap_Latn_IT
-    0xC00D4E414C61746Ellu, // naq_Latn_NA
-    0x6E624E4F4C61746Ellu, // nb_Latn_NO
     0x9C4D4D584C61746Ellu, // nch_Latn_MX
-    0x6E645A574C61746Ellu, // nd_Latn_ZW
-    0x886D4D5A4C61746Ellu, // ndc_Latn_MZ
+    0x0000000000000000llu,
     0xC86D44454C61746Ellu, // nds_Latn_DE
-    0x6E654E5044657661llu, // ne_Deva_NP
-    0xD88D4E5044657661llu, // new_Deva_NP
-    0x6E674E414C61746Ellu, // ng_Latn_NA
-    0xACCD4D5A4C61746Ellu, // ngl_Latn_MZ
-    0x90ED4D584C61746Ellu, // nhe_Latn_MX
-    0xD8ED4D584C61746Ellu, // nhw_Latn_MX
-    0xA50D49444C61746Ellu, // nij_Latn_ID
-    0xD10D4E554C61746Ellu, // niu_Latn_NU
-    0xB92D494E4C61746Ellu, // njo_Latn_IN
-    0x6E6C4E4C4C61746Ellu, // nl_Latn_NL
-    0x998D434D4C61746Ellu, // nmg_Latn_CM
-    0x6E6E4E4F4C61746Ellu, // nn_Latn_NO
-    0x9DAD434D4C61746Ellu, // nnh_Latn_CM
-    0x6E6F4E4F4C61746Ellu, // no_Latn_NO
-    0x8DCD54484C616E61llu, // nod_Lana_TH
-    0x91CD494E44657661llu, // noe_Deva_IN
-    0xB5CD534552756E72llu, // non_Runr_SE
-    0xBA0D474E4E6B6F6Fllu, // nqo_Nkoo_GN
-    0x6E725A414C61746Ellu, // nr_Latn_ZA
-    0xAA4D434143616E73llu, // nsk_Cans_CA
-    0xBA4D5A414C61746Ellu, // nso_Latn_ZA
-    0xCA8D53534C61746Ellu, // nus_Latn_SS
-    0x6E7655534C61746Ellu, // nv_Latn_US
-    0xC2ED434E4C61746Ellu, // nxq_Latn_CN
-    0x6E794D574C61746Ellu, // ny_Latn_MW
+    0xA8E150484C61746Ellu, // bhk_Latn_PH
+    0x0000000000000000llu,
+    0x6B75495141726162llu, // ku_Arab_IQ
+    0x746E5A414C61746Ellu, // tn_Latn_ZA
+    0xE70C49524D616E64llu, // myz_Mand_IR
+    0xC801434D4C61746Ellu, // bas_Latn_CM
+    0x626D4D4C4C61746Ellu, // bm_Latn_ML
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xE053494E4B6E6461llu, // tcy_Knda_IN
     0xB30D545A4C61746Ellu, // nym_Latn_TZ
-    0xB70D55474C61746Ellu, // nyn_Latn_UG
-    0xA32D47484C61746Ellu, // nzi_Latn_GH
-    0x6F6346524C61746Ellu, // oc_Latn_FR
-    0x6F6D45544C61746Ellu, // om_Latn_ET
-    0x6F72494E4F727961llu, // or_Orya_IN
-    0x6F7347454379726Cllu, // os_Cyrl_GE
-    0x824E55534F736765llu, // osa_Osge_US
+    0x0000000000000000llu,
+    0x9913455245746869llu, // tig_Ethi_ER
+    0xB99143484C61746Ellu, // rmo_Latn_CH
+    0xA1C3494E41726162llu, // doi_Arab_IN
+    0x902B52554379726Cllu, // lbe_Cyrl_RU
+    0xBA6150484C61746Ellu, // bto_Latn_PH
+    0x6D794D4D4D796D72llu, // my_Mymr_MM
+    0x6C6156414C61746Ellu, // la_Latn_VA
+    0xC6574E5044657661llu, // xsr_Deva_NP
     0xAA6E4D4E4F726B68llu, // otk_Orkh_MN
-    0x7061504B41726162llu, // pa_Arab_PK
-    0x7061494E47757275llu, // pa_Guru_IN
-    0x980F50484C61746Ellu, // pag_Latn_PH
-    0xAC0F495250686C69llu, // pal_Phli_IR
-    0xAC0F434E50686C70llu, // pal_Phlp_CN
-    0xB00F50484C61746Ellu, // pam_Latn_PH
-    0xBC0F41574C61746Ellu, // pap_Latn_AW
-    0xD00F50574C61746Ellu, // pau_Latn_PW
-    0x8C4F46524C61746Ellu, // pcd_Latn_FR
-    0xB04F4E474C61746Ellu, // pcm_Latn_NG
-    0x886F55534C61746Ellu, // pdc_Latn_US
-    0xCC6F43414C61746Ellu, // pdt_Latn_CA
-    0xB88F49525870656Fllu, // peo_Xpeo_IR
-    0xACAF44454C61746Ellu, // pfl_Latn_DE
-    0xB4EF4C4250686E78llu, // phn_Phnx_LB
-    0x814F494E42726168llu, // pka_Brah_IN
-    0xB94F4B454C61746Ellu, // pko_Latn_KE
-    0x706C504C4C61746Ellu, // pl_Latn_PL
-    0xC98F49544C61746Ellu, // pms_Latn_IT
-    0xCDAF47524772656Bllu, // pnt_Grek_GR
-    0xB5CF464D4C61746Ellu, // pon_Latn_FM
+    0x0000000000000000llu,
+    0x626E424442656E67llu, // bn_Beng_BD
+    0xB0815A4D4C61746Ellu, // bem_Latn_ZM
+    0x0000000000000000llu,
+    0xAEB354564C61746Ellu, // tvl_Latn_TV
+    0x8AEC5A574C61746Ellu, // mxc_Latn_ZW
+    0x0000000000000000llu,
+    0xD10D4E554C61746Ellu, // niu_Latn_NU
+    0xE1444D4D4B616C69llu, // eky_Kali_MM
+    0xC9CA464D4C61746Ellu, // kos_Latn_FM
+    0x656E474253686177llu, // en_Shaw_GB
+    0x0000000000000000llu,
+    0xAAD1545A4C61746Ellu, // rwk_Latn_TZ
+    0xBB03534E4C61746Ellu, // dyo_Latn_SN
+    0xC4AA494E44657661llu, // kfr_Deva_IN
+    0xCD4B55534C61746Ellu, // lkt_Latn_US
+    0xB4D149544C61746Ellu, // rgn_Latn_IT
     0x822F504B4B686172llu, // pra_Khar_PK
-    0x8E2F495241726162llu, // prd_Arab_IR
-    0x7073414641726162llu, // ps_Arab_AF
-    0x707442524C61746Ellu, // pt_Latn_BR
-    0xD28F47414C61746Ellu, // puu_Latn_GA
-    0x717550454C61746Ellu, // qu_Latn_PE
-    0x8A9047544C61746Ellu, // quc_Latn_GT
-    0x9A9045434C61746Ellu, // qug_Latn_EC
-    0xA411494E44657661llu, // raj_Deva_IN
-    0x945152454C61746Ellu, // rcf_Latn_RE
+    0x0000000000000000llu,
+    0xBC4B434E54686169llu, // lcp_Thai_CN
+    0x0000000000000000llu,
+    0x8283434D4C61746Ellu, // dua_Latn_CM
+    0xBC42494E42656E67llu, // ccp_Beng_IN
+    0xD10A54524C61746Ellu, // kiu_Latn_TR
+    0x0000000000000000llu,
     0xA49149444C61746Ellu, // rej_Latn_ID
-    0xB4D149544C61746Ellu, // rgn_Latn_IT
-    0x8111494E4C61746Ellu, // ria_Latn_IN
-    0x95114D4154666E67llu, // rif_Tfng_MA
-    0xC9314E5044657661llu, // rjs_Deva_NP
-    0xCD51424442656E67llu, // rkt_Beng_BD
-    0x726D43484C61746Ellu, // rm_Latn_CH
-    0x959146494C61746Ellu, // rmf_Latn_FI
-    0xB99143484C61746Ellu, // rmo_Latn_CH
-    0xCD91495241726162llu, // rmt_Arab_IR
-    0xD19153454C61746Ellu, // rmu_Latn_SE
-    0x726E42494C61746Ellu, // rn_Latn_BI
-    0x99B14D5A4C61746Ellu, // rng_Latn_MZ
+    0x9C924D5A4C61746Ellu, // seh_Latn_MZ
+    0x0000000000000000llu,
+    0x980B545A4C61746Ellu, // lag_Latn_TZ
+    0x6E7655534C61746Ellu, // nv_Latn_US
+    0x757A414641726162llu, // uz_Arab_AF
+    0x8480544E41726162llu, // aeb_Arab_TN
+    0xD6CC49444C61746Ellu, // mwv_Latn_ID
+    0x0000000000000000llu,
+    0x90CA49444C61746Ellu, // kge_Latn_ID
+    0xD0244B454C61746Ellu, // ebu_Latn_KE
+    0xBA2C42444D726F6Fllu, // mro_Mroo_BD
+    0xBE634D594C61746Ellu, // dtp_Latn_MY
+    0x8A20535950616C6Dllu, // arc_Palm_SY
+    0x0000000000000000llu,
+    0x8642504C4C61746Ellu, // csb_Latn_PL
+    0x0000000000000000llu,
+    0x6461444B4C61746Ellu, // da_Latn_DK
+    0xB63253524C61746Ellu, // srn_Latn_SR
+    0xAC16455445746869llu, // wal_Ethi_ET
+    0xA9CA494E44657661llu, // kok_Deva_IN
+    0xBEEA504B41726162llu, // kxp_Arab_PK
     0x726F524F4C61746Ellu, // ro_Latn_RO
-    0x85D149444C61746Ellu, // rob_Latn_ID
-    0x95D1545A4C61746Ellu, // rof_Latn_TZ
-    0xB271464A4C61746Ellu, // rtm_Latn_FJ
+    0x0000000000000000llu,
+    0x637652554379726Cllu, // cv_Cyrl_RU
+    0x64764D5654686161llu, // dv_Thaa_MV
+    0xBC32545A4C61746Ellu, // sbp_Latn_TZ
+    0x0000000000000000llu,
+    0x8594414F4C61746Ellu, // umb_Latn_AO
+    0x0000000000000000llu,
+    0x6D72494E44657661llu, // mr_Deva_IN
+    0xCA41434D4C61746Ellu, // bss_Latn_CM
+    0x6B7554524C61746Ellu, // ku_Latn_TR
+    0x6B6B434E41726162llu, // kk_Arab_CN
+    0x636552554379726Cllu, // ce_Cyrl_RU
+    0x656E55534C61746Ellu, // en_Latn_US
+    0x9C1252554379726Cllu, // sah_Cyrl_RU
+    0x8A20495241726D69llu, // arc_Armi_IR
+    0xBC18464D4C61746Ellu, // yap_Latn_FM
+    0x0000000000000000llu,
+    0x666946494C61746Ellu, // fi_Latn_FI
+    0xCE6449544974616Cllu, // ett_Ital_IT
+    0xC4C343414C61746Ellu, // dgr_Latn_CA
+    0x7A685457426F706Fllu, // zh_Bopo_TW
+    0x0000000000000000llu,
+    0xAE3842524C61746Ellu, // yrl_Latn_BR
+    0xA5C7494E44657661llu, // hoj_Deva_IN
+    0xB70D55474C61746Ellu, // nyn_Latn_UG
+    0x707442524C61746Ellu, // pt_Latn_BR
+    0x0000000000000000llu,
+    0x9C6A544741726162llu, // kdh_Arab_TG
+    0x81B753414E617262llu, // xna_Narb_SA
+    0xC96C53444C61746Ellu, // mls_Latn_SD
+    0xB5A750484C61746Ellu, // hnn_Latn_PH
+    0x0000000000000000llu,
+    0x657345534C61746Ellu, // es_Latn_ES
+    0x0000000000000000llu,
+    0xA966495241726162llu, // glk_Arab_IR
+    0x656547484C61746Ellu, // ee_Latn_GH
+    0xD1675452486C7577llu, // hlu_Hluw_TR
+    0xB5C5424A4C61746Ellu, // fon_Latn_BJ
+    0xB40D434E48616E73llu, // nan_Hans_CN
+    0x0000000000000000llu,
+    0xE412494E53617572llu, // saz_Saur_IN
+    0x90ED4D584C61746Ellu, // nhe_Latn_MX
+    0x80AC544841726162llu, // mfa_Arab_TH
+    0xC0124B454C61746Ellu, // saq_Latn_KE
+    0x0000000000000000llu,
+    0xD6D2494E44657661llu, // swv_Deva_IN
+    0x0000000000000000llu,
+    0x61665A414C61746Ellu, // af_Latn_ZA
+    0xB4EF4C4250686E78llu, // phn_Phnx_LB
+    0xDA42434143616E73llu, // csw_Cans_CA
+    0x0000000000000000llu,
+    0x8A204A4F4E626174llu, // arc_Nbat_JO
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x676447424C61746Ellu, // gd_Latn_GB
     0x727552554379726Cllu, // ru_Cyrl_RU
+    0x6B6F4B524B6F7265llu, // ko_Kore_KR
+    0x0000000000000000llu,
+    0x6879414D41726D6Ellu, // hy_Armn_AM
+    0xC6A64E5044657661llu, // gvr_Deva_NP
+    0xDC01434D42616D75llu, // bax_Bamu_CM
+    0xBA0D474E4E6B6F6Fllu, // nqo_Nkoo_GN
+    0x8989545A4C61746Ellu, // jmc_Latn_TZ
+    0xE0AA494E44657661llu, // kfy_Deva_IN
+    0x0000000000000000llu,
+    0xB94F4B454C61746Ellu, // pko_Latn_KE
+    0x0000000000000000llu,
+    0xCA8D53534C61746Ellu, // nus_Latn_SS
+    0xCD91495241726162llu, // rmt_Arab_IR
+    0x0000000000000000llu,
+    0x656E47424C61746Ellu, // en_Latn_GB
+    0xE1E1494E42656E67llu, // bpy_Beng_IN
+    0x0000000000000000llu,
+    0xA62A50484C61746Ellu, // krj_Latn_PH
+    0x0000000000000000llu,
+    0xA8E2464D4C61746Ellu, // chk_Latn_FM
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x984A4E474C61746Ellu, // kcg_Latn_NG
+    0x687548554C61746Ellu, // hu_Latn_HU
+    0xC59753444D657263llu, // xmr_Merc_SD
+    0x737653454C61746Ellu, // sv_Latn_SE
+    0x0000000000000000llu,
     0x929155414379726Cllu, // rue_Cyrl_UA
-    0x9A9153424C61746Ellu, // rug_Latn_SB
-    0x727752574C61746Ellu, // rw_Latn_RW
-    0xAAD1545A4C61746Ellu, // rwk_Latn_TZ
-    0xD3114A504B616E61llu, // ryu_Kana_JP
-    0x7361494E44657661llu, // sa_Deva_IN
-    0x941247484C61746Ellu, // saf_Latn_GH
-    0x9C1252554379726Cllu, // sah_Cyrl_RU
-    0xC0124B454C61746Ellu, // saq_Latn_KE
-    0xC81249444C61746Ellu, // sas_Latn_ID
-    0xCC12494E4C61746Ellu, // sat_Latn_IN
-    0xE412494E53617572llu, // saz_Saur_IN
-    0xBC32545A4C61746Ellu, // sbp_Latn_TZ
-    0x736349544C61746Ellu, // sc_Latn_IT
-    0xA852494E44657661llu, // sck_Deva_IN
-    0xB45249544C61746Ellu, // scn_Latn_IT
-    0xB85247424C61746Ellu, // sco_Latn_GB
-    0xC85243414C61746Ellu, // scs_Latn_CA
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB222434143616E73llu, // crm_Cans_CA
+    0x0000000000000000llu,
+    0xB122564E4368616Dllu, // cjm_Cham_VN
+    0x864344454C61746Ellu, // dsb_Latn_DE
+    0xCA73544854686169llu, // tts_Thai_TH
+    0xC553415A4C61746Ellu, // tkr_Latn_AZ
+    0xC457545243617269llu, // xcr_Cari_TR
+    0x6C6F4C414C616F6Fllu, // lo_Laoo_LA
+    0x6E6C4E4C4C61746Ellu, // nl_Latn_NL
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB50C49444C61746Ellu, // min_Latn_ID
     0x7364504B41726162llu, // sd_Arab_PK
-    0x7364494E44657661llu, // sd_Deva_IN
+    0x746B544D4C61746Ellu, // tk_Latn_TM
+    0xC42047484C61746Ellu, // abr_Latn_GH
+    0xD661504B44657661llu, // btv_Deva_PK
+    0x6C6E43444C61746Ellu, // ln_Latn_CD
+    0x0000000000000000llu,
+    0x7377545A4C61746Ellu, // sw_Latn_TZ
+    0xA1AC494E42656E67llu, // mni_Beng_IN
+    0x8A26435943707274llu, // grc_Cprt_CY
+    0x8DE0544741726162llu, // apd_Arab_TG
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB647434E48616E73llu, // hsn_Hans_CN
+    0x8D7754524C796469llu, // xld_Lydi_TR
+    0xE06052554379726Cllu, // ady_Cyrl_RU
+    0x75674B5A4379726Cllu, // ug_Cyrl_KZ
+    0x8A2A52554379726Cllu, // krc_Cyrl_RU
+    0xCE89444B4C61746Ellu, // jut_Latn_DK
+    0x0000000000000000llu,
+    0xB026494E44657661llu, // gbm_Deva_IN
+    0x6C744C544C61746Ellu, // lt_Latn_LT
+    0x9C4055474C61746Ellu, // ach_Latn_UG
+    0xE173415A4C61746Ellu, // tly_Latn_AZ
+    0xCDAF47524772656Bllu, // pnt_Grek_GR
+    0x0000000000000000llu,
+    0x8C4F46524C61746Ellu, // pcd_Latn_FR
+    0xB276494E44657661llu, // wtm_Deva_IN
+    0xC4F34E5044657661llu, // thr_Deva_NP
+    0xA940495158737578llu, // akk_Xsux_IQ
+    0xC90C495148617472llu, // mis_Hatr_IQ
+    0x0000000000000000llu,
+    0xD60143494C61746Ellu, // bqv_Latn_CI
     0x7364494E4B686F6Allu, // sd_Khoj_IN
-    0x7364494E53696E64llu, // sd_Sind_IN
-    0x887249544C61746Ellu, // sdc_Latn_IT
-    0x9C72495241726162llu, // sdh_Arab_IR
-    0x73654E4F4C61746Ellu, // se_Latn_NO
-    0x949243494C61746Ellu, // sef_Latn_CI
-    0x9C924D5A4C61746Ellu, // seh_Latn_MZ
-    0xA0924D584C61746Ellu, // sei_Latn_MX
+    0xC81249444C61746Ellu, // sas_Latn_ID
+    0xD9AC4D4D4D796D72llu, // mnw_Mymr_MM
+    0xCD61564E54617674llu, // blt_Tavt_VN
+    0x99D755474C61746Ellu, // xog_Latn_UG
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x696146524C61746Ellu, // ia_Latn_FR
+    0x6B6A4E414C61746Ellu, // kj_Latn_NA
+    0x0000000000000000llu,
+    0x964A434D4C61746Ellu, // ksf_Latn_CM
+    0xA40A4E474C61746Ellu, // kaj_Latn_NG
+    0x7465494E54656C75llu, // te_Telu_IN
+    0x0000000000000000llu,
+    0x9685474E4C61746Ellu, // fuf_Latn_GN
+    0x676C45534C61746Ellu, // gl_Latn_ES
+    0xB4C1504B41726162llu, // bgn_Arab_PK
+    0x0000000000000000llu,
+    0xC5B44E5044657661llu, // unr_Deva_NP
+    0x89C7494E44657661llu, // hoc_Deva_IN
+    0x6B6743444C61746Ellu, // kg_Latn_CD
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xE486455445746869llu, // gez_Ethi_ET
+    0xD41742524C61746Ellu, // xav_Latn_BR
+    0xE0CC545A4C61746Ellu, // mgy_Latn_TZ
+    0x82C0494E44657661llu, // awa_Deva_IN
+    0x0000000000000000llu,
+    0x9DA852554379726Cllu, // inh_Cyrl_RU
+    0x616B47484C61746Ellu, // ak_Latn_GH
+    0x0000000000000000llu,
     0xC8924D4C4C61746Ellu, // ses_Latn_ML
-    0x736743464C61746Ellu, // sg_Latn_CF
-    0x80D249454F67616Dllu, // sga_Ogam_IE
-    0xC8D24C544C61746Ellu, // sgs_Latn_LT
-    0xA0F24D4154666E67llu, // shi_Tfng_MA
-    0xB4F24D4D4D796D72llu, // shn_Mymr_MM
-    0x73694C4B53696E68llu, // si_Sinh_LK
-    0x8D1245544C61746Ellu, // sid_Latn_ET
-    0x736B534B4C61746Ellu, // sk_Latn_SK
-    0xC552504B41726162llu, // skr_Arab_PK
-    0x736C53494C61746Ellu, // sl_Latn_SI
-    0xA172504C4C61746Ellu, // sli_Latn_PL
-    0xE17249444C61746Ellu, // sly_Latn_ID
-    0x736D57534C61746Ellu, // sm_Latn_WS
-    0x819253454C61746Ellu, // sma_Latn_SE
+    0xC6CC494E44657661llu, // mwr_Deva_IN
+    0xB98B49544C61746Ellu, // lmo_Latn_IT
+    0x0000000000000000llu,
     0xA59253454C61746Ellu, // smj_Latn_SE
-    0xB59246494C61746Ellu, // smn_Latn_FI
+    0x0000000000000000llu,
+    0x864A545A4C61746Ellu, // ksb_Latn_TZ
+    0x848250484C61746Ellu, // ceb_Latn_PH
+    0x776142454C61746Ellu, // wa_Latn_BE
+    0x7A68545748616E74llu, // zh_Hant_TW
+    0x8AD243444C61746Ellu, // swc_Latn_CD
+    0xBC3641554C61746Ellu, // wbp_Latn_AU
+    0xA67355474C61746Ellu, // ttj_Latn_UG
+    0xE68B495241726162llu, // luz_Arab_IR
+    0xC0EA4D4C4C61746Ellu, // khq_Latn_ML
+    0x727752574C61746Ellu, // rw_Latn_RW
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x6865494C48656272llu, // he_Hebr_IL
+    0x6869494E44657661llu, // hi_Deva_IN
+    0x992A4C414C616F6Fllu, // kjg_Laoo_LA
+    0xA90150484C61746Ellu, // bik_Latn_PH
+    0xB00A4B454C61746Ellu, // kam_Latn_KE
+    0x7073414641726162llu, // ps_Arab_AF
+    0x0000000000000000llu,
+    0x6666474E41646C6Dllu, // ff_Adlm_GN
+    0x0000000000000000llu,
+    0x6172454741726162llu, // ar_Arab_EG
+    0x657445454C61746Ellu, // et_Latn_EE
+    0x6B7747424C61746Ellu, // kw_Latn_GB
+    0x0000000000000000llu,
+    0x891553584C61746Ellu, // vic_Latn_SX
+    0x0000000000000000llu,
+    0x864744454C61746Ellu, // hsb_Latn_DE
+    0xB406434E48616E73llu, // gan_Hans_CN
+    0x0000000000000000llu,
+    0xCA92474E4C61746Ellu, // sus_Latn_GN
+    0xB17954474C61746Ellu, // zlm_Latn_TG
+    0xAF12424442656E67llu, // syl_Beng_BD
+    0x0000000000000000llu,
+    0x98C255474C61746Ellu, // cgg_Latn_UG
+    0x6F72494E4F727961llu, // or_Orya_IN
+    0x666F464F4C61746Ellu, // fo_Latn_FO
+    0xCD0553454C61746Ellu, // fit_Latn_SE
+    0x69674E474C61746Ellu, // ig_Latn_NG
+    0x0000000000000000llu,
+    0x959544454C61746Ellu, // vmf_Latn_DE
+    0xA807434E48616E73llu, // hak_Hans_CN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x98064D444C61746Ellu, // gag_Latn_MD
+    0x808A43564C61746Ellu, // kea_Latn_CV
+    0xE40C4D584C61746Ellu, // maz_Latn_MX
+    0x84E1494E44657661llu, // bhb_Deva_IN
+    0xB2934D574C61746Ellu, // tum_Latn_MW
+    0xBD2B49444C61746Ellu, // ljp_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x800A555A4379726Cllu, // kaa_Cyrl_UZ
+    0xCD6052554379726Cllu, // alt_Cyrl_RU
+    0xD00F50574C61746Ellu, // pau_Latn_PW
+    0x0000000000000000llu,
+    0xB04F4E474C61746Ellu, // pcm_Latn_NG
+    0xA66043414C61746Ellu, // atj_Latn_CA
+    0xCC6A544854686169llu, // kdt_Thai_TH
+    0x0000000000000000llu,
+    0xD4034B454C61746Ellu, // dav_Latn_KE
+    0xC436494E44657661llu, // wbr_Deva_IN
+    0xD8ED4D584C61746Ellu, // nhw_Latn_MX
+    0x0000000000000000llu,
+    0xD8EA504B41726162llu, // khw_Arab_PK
+    0x8111494E4C61746Ellu, // ria_Latn_IN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xAA92545A4C61746Ellu, // suk_Latn_TZ
+    0x80D4535955676172llu, // uga_Ugar_SY
+    0x0000000000000000llu,
+    0x6B794B474379726Cllu, // ky_Cyrl_KG
+    0xA62C52554379726Cllu, // mrj_Cyrl_RU
+    0xD6854E474C61746Ellu, // fuv_Latn_NG
+    0x9C734E5044657661llu, // tdh_Deva_NP
+    0xBDC24547436F7074llu, // cop_Copt_EG
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x6B694B454C61746Ellu, // ki_Latn_KE
+    0xD88149444C61746Ellu, // bew_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x880A4D4D4C61746Ellu, // kac_Latn_MM
+    0xC85243414C61746Ellu, // scs_Latn_CA
+    0x99D34D574C61746Ellu, // tog_Latn_MW
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x8D1245544C61746Ellu, // sid_Latn_ET
+    0x746C50484C61746Ellu, // tl_Latn_PH
+    0xAACC4D4C4C61746Ellu, // mwk_Latn_ML
+    0x6A614A504A70616Ellu, // ja_Jpan_JP
+    0xB48C534C4C61746Ellu, // men_Latn_SL
+    0x0000000000000000llu,
+    0x7A61434E4C61746Ellu, // za_Latn_CN
+    0x73745A414C61746Ellu, // st_Latn_ZA
+    0x0000000000000000llu,
+    0xCE4045534C61746Ellu, // ast_Latn_ES
+    0x736349544C61746Ellu, // sc_Latn_IT
+    0x91234E454C61746Ellu, // dje_Latn_NE
+    0xACCD4D5A4C61746Ellu, // ngl_Latn_MZ
+    0xB52149444C61746Ellu, // bjn_Latn_ID
+    0x757A555A4C61746Ellu, // uz_Latn_UZ
+    0xA1B64B4D41726162llu, // wni_Arab_KM
+    0x0000000000000000llu,
+    0x8D87434E506C7264llu, // hmd_Plrd_CN
+    0xD19153454C61746Ellu, // rmu_Latn_SE
+    0x0000000000000000llu,
+    0x80EA494E4C61746Ellu, // kha_Latn_IN
+    0x0000000000000000llu,
+    0xA0924D584C61746Ellu, // sei_Latn_MX
+    0x0000000000000000llu,
+    0x9A9045434C61746Ellu, // qug_Latn_EC
+    0x0000000000000000llu,
+    0xB8E1494E44657661llu, // bho_Deva_IN
+    0x8105534441726162llu, // fia_Arab_SD
+    0x696B55534C61746Ellu, // ik_Latn_US
+    0xB695545A4C61746Ellu, // vun_Latn_TZ
+    0x886F55534C61746Ellu, // pdc_Latn_US
+    0xA50B49544C61746Ellu, // lij_Latn_IT
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x946C52554379726Cllu, // mdf_Cyrl_RU
+    0xCCEA494E4D796D72llu, // kht_Mymr_IN
+    0x0000000000000000llu,
+    0x666A464A4C61746Ellu, // fj_Latn_FJ
+    0x6D684D484C61746Ellu, // mh_Latn_MH
+    0x6C694E4C4C61746Ellu, // li_Latn_NL
+    0xA0A44E474C61746Ellu, // efi_Latn_NG
+    0xE25245524C61746Ellu, // ssy_Latn_ER
     0xBD92494C53616D72llu, // smp_Samr_IL
-    0xC99246494C61746Ellu, // sms_Latn_FI
-    0x736E5A574C61746Ellu, // sn_Latn_ZW
-    0xA9B24D4C4C61746Ellu, // snk_Latn_ML
-    0x736F534F4C61746Ellu, // so_Latn_SO
-    0xD1D2544854686169llu, // sou_Thai_TH
-    0x7371414C4C61746Ellu, // sq_Latn_AL
-    0x737252534379726Cllu, // sr_Cyrl_RS
-    0x737252534C61746Ellu, // sr_Latn_RS
-    0x8632494E536F7261llu, // srb_Sora_IN
-    0xB63253524C61746Ellu, // srn_Latn_SR
-    0xC632534E4C61746Ellu, // srr_Latn_SN
-    0xDE32494E44657661llu, // srx_Deva_IN
+    0x0000000000000000llu,
+    0x736D57534C61746Ellu, // sm_Latn_WS
+    0x882149444C61746Ellu, // bbc_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB88F49525870656Fllu, // peo_Xpeo_IR
+    0x0000000000000000llu,
+    0x80284D594C61746Ellu, // iba_Latn_MY
+    0x0000000000000000llu,
     0x73735A414C61746Ellu, // ss_Latn_ZA
-    0xE25245524C61746Ellu, // ssy_Latn_ER
-    0x73745A414C61746Ellu, // st_Latn_ZA
+    0x8DCD54484C616E61llu, // nod_Lana_TH
+    0x0000000000000000llu,
+    0x950B494E4C696D62llu, // lif_Limb_IN
+    0x737252534C61746Ellu, // sr_Latn_RS
+    0x9F2852554C61746Ellu, // izh_Latn_RU
+    0xA2C643414C61746Ellu, // gwi_Latn_CA
+    0xD3114A504B616E61llu, // ryu_Kana_JP
+    0x657545534C61746Ellu, // eu_Latn_ES
+    0x9E4A44454C61746Ellu, // ksh_Latn_DE
+    0x6C6755474C61746Ellu, // lg_Latn_UG
+    0xE6864B454C61746Ellu, // guz_Latn_KE
+    0x6C764C564C61746Ellu, // lv_Latn_LV
+    0x0000000000000000llu,
+    0x68614E474C61746Ellu, // ha_Latn_NG
+    0x9298434E48616E73llu, // yue_Hans_CN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x9DAD434D4C61746Ellu, // nnh_Latn_CM
+    0xB85247424C61746Ellu, // sco_Latn_GB
+    0xB5CD534552756E72llu, // non_Runr_SE
+    0x0000000000000000llu,
+    0xB0094A4D4C61746Ellu, // jam_Latn_JM
+    0xB72C495241726162llu, // mzn_Arab_IR
+    0xA80C49444C61746Ellu, // mak_Latn_ID
+    0x687248524C61746Ellu, // hr_Latn_HR
+    0x840A445A4C61746Ellu, // kab_Latn_DZ
+    0x0000000000000000llu,
+    0xB8E255534C61746Ellu, // cho_Latn_US
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x868642524C61746Ellu, // gub_Latn_BR
+    0x0000000000000000llu,
+    0xC66C494E44657661llu, // mtr_Deva_IN
+    0x0000000000000000llu,
+    0xB4EA494E44657661llu, // khn_Deva_IN
+    0x91CC43414C61746Ellu, // moe_Latn_CA
+    0xBA4D5A414C61746Ellu, // nso_Latn_ZA
+    0x0000000000000000llu,
+    0x7A68545748616E62llu, // zh_Hanb_TW
+    0xC68647484C61746Ellu, // gur_Latn_GH
+    0xB40C474E4E6B6F6Fllu, // man_Nkoo_GN
     0xC27244454C61746Ellu, // stq_Latn_DE
-    0x737549444C61746Ellu, // su_Latn_ID
-    0xAA92545A4C61746Ellu, // suk_Latn_TZ
-    0xCA92474E4C61746Ellu, // sus_Latn_GN
-    0x737653454C61746Ellu, // sv_Latn_SE
-    0x7377545A4C61746Ellu, // sw_Latn_TZ
+    0xE2634E5044657661llu, // dty_Deva_NP
+    0x6B61474547656F72llu, // ka_Geor_GE
+    0xBC8B494E4C657063llu, // lep_Lepc_IN
+    0x0000000000000000llu,
+    0x828C434D4C61746Ellu, // mua_Latn_CM
+    0x0000000000000000llu,
+    0x756B55414379726Cllu, // uk_Cyrl_UA
     0x86D2595441726162llu, // swb_Arab_YT
-    0x8AD243444C61746Ellu, // swc_Latn_CD
-    0x9AD244454C61746Ellu, // swg_Latn_DE
-    0xD6D2494E44657661llu, // swv_Deva_IN
-    0xB6F249444C61746Ellu, // sxn_Latn_ID
-    0xAF12424442656E67llu, // syl_Beng_BD
-    0xC712495153797263llu, // syr_Syrc_IQ
-    0xAF32504C4C61746Ellu, // szl_Latn_PL
-    0x7461494E54616D6Cllu, // ta_Taml_IN
-    0xA4134E5044657661llu, // taj_Deva_NP
-    0xD83350484C61746Ellu, // tbw_Latn_PH
-    0xE053494E4B6E6461llu, // tcy_Knda_IN
+    0x6D694E5A4C61746Ellu, // mi_Latn_NZ
+    0x93214D4C4C61746Ellu, // bze_Latn_ML
+    0x0000000000000000llu,
+    0xA622434143616E73llu, // crj_Cans_CA
+    0x0000000000000000llu,
+    0x7572504B41726162llu, // ur_Arab_PK
+    0xB56A4B454C61746Ellu, // kln_Latn_KE
+    0x6E645A574C61746Ellu, // nd_Latn_ZW
+    0x8E624D4D50617563llu, // ctd_Pauc_MM
+    0xAD0550484C61746Ellu, // fil_Latn_PH
+    0x9AF3434E54616E67llu, // txg_Tang_CN
+    0xD22A494E44657661llu, // kru_Deva_IN
+    0xC6A553444C61746Ellu, // fvr_Latn_SD
+    0xE5CB5A4D4C61746Ellu, // loz_Latn_ZM
+    0x697349534C61746Ellu, // is_Latn_IS
+    0x91A7494E44657661llu, // hne_Deva_IN
+    0x6D6C494E4D6C796Dllu, // ml_Mlym_IN
+    0xA32D47484C61746Ellu, // nzi_Latn_GH
+    0x99B14D5A4C61746Ellu, // rng_Latn_MZ
+    0x9298484B48616E74llu, // yue_Hant_HK
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xE72B54524C61746Ellu, // lzz_Latn_TR
+    0xB58B494E54656C75llu, // lmn_Telu_IN
+    0x0000000000000000llu,
+    0xB48343414C61746Ellu, // den_Latn_CA
+    0x7371414C4C61746Ellu, // sq_Latn_AL
+    0xDE32494E44657661llu, // srx_Deva_IN
+    0xA172504C4C61746Ellu, // sli_Latn_PL
+    0xB141434D4C61746Ellu, // bkm_Latn_CM
+    0x9C72495241726162llu, // sdh_Arab_IR
+    0xB0A54D4C4C61746Ellu, // ffm_Latn_ML
+    0xAC0F434E50686C70llu, // pal_Phlp_CN
+    0x76655A414C61746Ellu, // ve_Latn_ZA
+    0xE5C049444C61746Ellu, // aoz_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x8A9047544C61746Ellu, // quc_Latn_GT
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x696E49444C61746Ellu, // in_Latn_ID
+    0xC5B4494E42656E67llu, // unr_Beng_IN
+    0x0000000000000000llu,
+    0x8C0C49444C61746Ellu, // mad_Latn_ID
+    0xD1D2544854686169llu, // sou_Thai_TH
+    0x8C0B494C48656272llu, // lad_Hebr_IL
+    0xD14150484C61746Ellu, // bku_Latn_PH
+    0x0000000000000000llu,
+    0xB271464A4C61746Ellu, // rtm_Latn_FJ
     0x8C73434E54616C65llu, // tdd_Tale_CN
-    0x98734E5044657661llu, // tdg_Deva_NP
-    0x9C734E5044657661llu, // tdh_Deva_NP
-    0x7465494E54656C75llu, // te_Telu_IN
-    0xB093534C4C61746Ellu, // tem_Latn_SL
-    0xB89355474C61746Ellu, // teo_Latn_UG
-    0xCC93544C4C61746Ellu, // tet_Latn_TL
-    0x7467504B41726162llu, // tg_Arab_PK
-    0x7467544A4379726Cllu, // tg_Cyrl_TJ
-    0x7468544854686169llu, // th_Thai_TH
-    0xACF34E5044657661llu, // thl_Deva_NP
+    0x676149454C61746Ellu, // ga_Latn_IE
+    0xDCC154524772656Bllu, // bgx_Grek_TR
+    0x949243494C61746Ellu, // sef_Latn_CI
+    0x0000000000000000llu,
+    0xDEAA504B41726162llu, // kvx_Arab_PK
+    0x0000000000000000llu,
+    0x981953444C61746Ellu, // zag_Latn_SD
+    0xA926504B41726162llu, // gjk_Arab_PK
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x7364494E44657661llu, // sd_Deva_IN
+    0x7461494E54616D6Cllu, // ta_Taml_IN
+    0xCD4843414C61746Ellu, // ikt_Latn_CA
     0xC0F34E5044657661llu, // thq_Deva_NP
-    0xC4F34E5044657661llu, // thr_Deva_NP
-    0x7469455445746869llu, // ti_Ethi_ET
-    0x9913455245746869llu, // tig_Ethi_ER
-    0xD5134E474C61746Ellu, // tiv_Latn_NG
-    0x746B544D4C61746Ellu, // tk_Latn_TM
-    0xAD53544B4C61746Ellu, // tkl_Latn_TK
-    0xC553415A4C61746Ellu, // tkr_Latn_AZ
-    0xCD534E5044657661llu, // tkt_Deva_NP
-    0x746C50484C61746Ellu, // tl_Latn_PH
-    0xE173415A4C61746Ellu, // tly_Latn_AZ
-    0x9D934E454C61746Ellu, // tmh_Latn_NE
-    0x746E5A414C61746Ellu, // tn_Latn_ZA
-    0x746F544F4C61746Ellu, // to_Latn_TO
-    0x99D34D574C61746Ellu, // tog_Latn_MW
-    0xA1F350474C61746Ellu, // tpi_Latn_PG
-    0x747254524C61746Ellu, // tr_Latn_TR
-    0xD23354524C61746Ellu, // tru_Latn_TR
-    0xD63354574C61746Ellu, // trv_Latn_TW
-    0x74735A414C61746Ellu, // ts_Latn_ZA
-    0x8E5347524772656Bllu, // tsd_Grek_GR
-    0x96534E5044657661llu, // tsf_Deva_NP
-    0x9A5350484C61746Ellu, // tsg_Latn_PH
+    0x858A414F4C61746Ellu, // kmb_Latn_AO
+    0x617A495241726162llu, // az_Arab_IR
+    0xAD0750484C61746Ellu, // hil_Latn_PH
+    0x0000000000000000llu,
+    0xB96850484C61746Ellu, // ilo_Latn_PH
+    0x616D455445746869llu, // am_Ethi_ET
+    0xA5A74C41486D6E67llu, // hnj_Hmng_LA
+    0xB597434E4D616E69llu, // xmn_Mani_CN
+    0x904049444C61746Ellu, // ace_Latn_ID
+    0x6D6E4D4E4379726Cllu, // mn_Cyrl_MN
+    0x9A9153424C61746Ellu, // rug_Latn_SB
+    0x0000000000000000llu,
+    0x617652554379726Cllu, // av_Cyrl_RU
+    0xB8184D5A4C61746Ellu, // yao_Latn_MZ
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xBCCC4E5044657661llu, // mgp_Deva_NP
+    0x7A755A414C61746Ellu, // zu_Latn_ZA
+    0x0000000000000000llu,
     0xA653425454696274llu, // tsj_Tibt_BT
-    0x747452554379726Cllu, // tt_Cyrl_RU
-    0xA67355474C61746Ellu, // ttj_Latn_UG
-    0xCA73544854686169llu, // tts_Thai_TH
-    0xCE73415A4C61746Ellu, // ttt_Latn_AZ
-    0xB2934D574C61746Ellu, // tum_Latn_MW
-    0xAEB354564C61746Ellu, // tvl_Latn_TV
-    0xC2D34E454C61746Ellu, // twq_Latn_NE
-    0x9AF3434E54616E67llu, // txg_Tang_CN
-    0x747950464C61746Ellu, // ty_Latn_PF
-    0xD71352554379726Cllu, // tyv_Cyrl_RU
-    0xB3334D414C61746Ellu, // tzm_Latn_MA
-    0xB07452554379726Cllu, // udm_Cyrl_RU
-    0x7567434E41726162llu, // ug_Arab_CN
-    0x75674B5A4379726Cllu, // ug_Cyrl_KZ
-    0x80D4535955676172llu, // uga_Ugar_SY
-    0x756B55414379726Cllu, // uk_Cyrl_UA
-    0xA174464D4C61746Ellu, // uli_Latn_FM
-    0x8594414F4C61746Ellu, // umb_Latn_AO
-    0xC5B4494E42656E67llu, // unr_Beng_IN
-    0xC5B44E5044657661llu, // unr_Deva_NP
-    0xDDB4494E42656E67llu, // unx_Beng_IN
-    0x7572504B41726162llu, // ur_Arab_PK
-    0x757A414641726162llu, // uz_Arab_AF
-    0x757A555A4C61746Ellu, // uz_Latn_UZ
+    0x7468544854686169llu, // th_Thai_TH
+    0x0000000000000000llu,
+    0xBAC4434D4C61746Ellu, // ewo_Latn_CM
+    0xA4134E5044657661llu, // taj_Deva_NP
+    0x636145534C61746Ellu, // ca_Latn_ES
+    0xE00649444C61746Ellu, // gay_Latn_ID
+    0x66794E4C4C61746Ellu, // fy_Latn_NL
     0xA0154C5256616969llu, // vai_Vaii_LR
-    0x76655A414C61746Ellu, // ve_Latn_ZA
-    0x889549544C61746Ellu, // vec_Latn_IT
-    0xBC9552554C61746Ellu, // vep_Latn_RU
+    0xE0C4454745677970llu, // egy_Egyp_EG
+    0xB2EA544854686169llu, // kxm_Thai_TH
+    0x747950464C61746Ellu, // ty_Latn_PF
+    0x6E725A414C61746Ellu, // nr_Latn_ZA
+    0xAF32504C4C61746Ellu, // szl_Latn_PL
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x96534E5044657661llu, // tsf_Deva_NP
+    0xBCE243414C61746Ellu, // chp_Latn_CA
+    0x657355534C61746Ellu, // es_Latn_US
+    0x806047484C61746Ellu, // ada_Latn_GH
+    0x0000000000000000llu,
+    0x9E21504B41726162llu, // brh_Arab_PK
+    0xE407414641726162llu, // haz_Arab_AF
+    0xC80C4B454C61746Ellu, // mas_Latn_KE
+    0xA1CA52554379726Cllu, // koi_Cyrl_RU
+    0x0000000000000000llu,
+    0xA1F350474C61746Ellu, // tpi_Latn_PG
+    0x0000000000000000llu,
+    0x6C624C554C61746Ellu, // lb_Latn_LU
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x6E614E524C61746Ellu, // na_Latn_NR
+    0xCA8C55534C61746Ellu, // mus_Latn_US
+    0x0000000000000000llu,
+    0x626956554C61746Ellu, // bi_Latn_VU
+    0x0000000000000000llu,
+    0xA54A434D4C61746Ellu, // kkj_Latn_CM
+    0xCDC65541476F7468llu, // got_Goth_UA
+    0x7A68434E48616E73llu, // zh_Hans_CN
+    0xE17249444C61746Ellu, // sly_Latn_ID
+    0x0000000000000000llu,
+    0x0000000000000000llu,
     0x7669564E4C61746Ellu, // vi_Latn_VN
-    0x891553584C61746Ellu, // vic_Latn_SX
-    0xC97542454C61746Ellu, // vls_Latn_BE
-    0x959544454C61746Ellu, // vmf_Latn_DE
-    0xD9954D5A4C61746Ellu, // vmw_Latn_MZ
-    0xCDD552554C61746Ellu, // vot_Latn_RU
-    0xBA3545454C61746Ellu, // vro_Latn_EE
-    0xB695545A4C61746Ellu, // vun_Latn_TZ
-    0x776142454C61746Ellu, // wa_Latn_BE
-    0x901643484C61746Ellu, // wae_Latn_CH
-    0xAC16455445746869llu, // wal_Ethi_ET
-    0xC41650484C61746Ellu, // war_Latn_PH
-    0xBC3641554C61746Ellu, // wbp_Latn_AU
-    0xC036494E54656C75llu, // wbq_Telu_IN
-    0xC436494E44657661llu, // wbr_Deva_IN
-    0xC97657464C61746Ellu, // wls_Latn_WF
-    0xA1B64B4D41726162llu, // wni_Arab_KM
-    0x776F534E4C61746Ellu, // wo_Latn_SN
-    0xB276494E44657661llu, // wtm_Deva_IN
-    0xD296434E48616E73llu, // wuu_Hans_CN
-    0xD41742524C61746Ellu, // xav_Latn_BR
-    0xC457545243617269llu, // xcr_Cari_TR
-    0x78685A414C61746Ellu, // xh_Latn_ZA
-    0x897754524C796369llu, // xlc_Lyci_TR
-    0x8D7754524C796469llu, // xld_Lydi_TR
-    0x9597474547656F72llu, // xmf_Geor_GE
-    0xB597434E4D616E69llu, // xmn_Mani_CN
-    0xC59753444D657263llu, // xmr_Merc_SD
-    0x81B753414E617262llu, // xna_Narb_SA
-    0xC5B7494E44657661llu, // xnr_Deva_IN
-    0x99D755474C61746Ellu, // xog_Latn_UG
-    0xC5F7495250727469llu, // xpr_Prti_IR
-    0x8257594553617262llu, // xsa_Sarb_YE
-    0xC6574E5044657661llu, // xsr_Deva_NP
-    0xB8184D5A4C61746Ellu, // yao_Latn_MZ
-    0xBC18464D4C61746Ellu, // yap_Latn_FM
-    0xD418434D4C61746Ellu, // yav_Latn_CM
+    0x636F46524C61746Ellu, // co_Latn_FR
+    0x0000000000000000llu,
+    0x9C6C50484C61746Ellu, // mdh_Latn_PH
+    0xAECB544854686169llu, // lwl_Thai_TH
+    0xB00F50484C61746Ellu, // pam_Latn_PH
     0x8438434D4C61746Ellu, // ybb_Latn_CM
-    0x796F4E474C61746Ellu, // yo_Latn_NG
-    0xAE3842524C61746Ellu, // yrl_Latn_BR
-    0x82984D584C61746Ellu, // yua_Latn_MX
-    0x9298434E48616E73llu, // yue_Hans_CN
-    0x9298484B48616E74llu, // yue_Hant_HK
-    0x7A61434E4C61746Ellu, // za_Latn_CN
-    0x981953444C61746Ellu, // zag_Latn_SD
-    0xA4794B4D41726162llu, // zdj_Arab_KM
-    0x80994E4C4C61746Ellu, // zea_Latn_NL
-    0x9CD94D4154666E67llu, // zgh_Tfng_MA
-    0x7A685457426F706Fllu, // zh_Bopo_TW
-    0x7A68545748616E62llu, // zh_Hanb_TW
-    0x7A68434E48616E73llu, // zh_Hans_CN
-    0x7A68545748616E74llu, // zh_Hant_TW
-    0xB17954474C61746Ellu, // zlm_Latn_TG
-    0xA1994D594C61746Ellu, // zmi_Latn_MY
-    0x7A755A414C61746Ellu, // zu_Latn_ZA
-    0x833954524C61746Ellu, // zza_Latn_TR
-});
+    0x8843494E41726162llu, // dcc_Arab_IN
+    0x7467504B41726162llu, // tg_Arab_PK
+    0xB40149444C61746Ellu, // ban_Latn_ID
+    0x6E794D574C61746Ellu, // ny_Latn_MW
+    0x0000000000000000llu,
+    0xC0C0434D4C61746Ellu, // agq_Latn_CM
+    0x0000000000000000llu,
+    0x647A425454696274llu, // dz_Tibt_BT
+    0xA411494E44657661llu, // raj_Deva_IN
+    0x0000000000000000llu,
+    0xC40352554379726Cllu, // dar_Cyrl_RU
+    0x8632494E536F7261llu, // srb_Sora_IN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0x8A8159544C61746Ellu, // buc_Latn_YT
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xC62544454C61746Ellu, // frr_Latn_DE
+    0x6969434E59696969llu, // ii_Yiii_CN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xB8AA43494C61746Ellu, // kfo_Latn_CI
+    0xD70C52554379726Cllu, // myv_Cyrl_RU
+    0x0000000000000000llu,
+    0x696449444C61746Ellu, // id_Latn_ID
+    0x0000000000000000llu,
+    0xE481545A4C61746Ellu, // bez_Latn_TZ
+    0xADCB43444C61746Ellu, // lol_Latn_CD
+    0x7467544A4379726Cllu, // tg_Cyrl_TJ
+    0xA22A534C4C61746Ellu, // kri_Latn_SL
+    0x0000000000000000llu,
+    0x6372434143616E73llu, // cr_Cans_CA
+    0xA4794B4D41726162llu, // zdj_Arab_KM
+    0x0000000000000000llu,
+    0x814F494E42726168llu, // pka_Brah_IN
+    0x0000000000000000llu,
+    0x0000000000000000llu,
+    0xBA3545454C61746Ellu, // vro_Latn_EE
+    0x0000000000000000llu,
+    0xD24455534C61746Ellu, // esu_Latn_US
+    0xBC014E5044657661llu, // bap_Deva_NP
+    0xAC0F495250686C69llu, // pal_Phli_IR
+    0x9D934E454C61746Ellu, // tmh_Latn_NE
+    0x6C7543444C61746Ellu, // lu_Latn_CD
+    0x6B7954524C61746Ellu, // ky_Latn_TR
+    0x0000000000000000llu,
+    0xAA22434143616E73llu, // crk_Cans_CA
+    0x0000000000000000llu,
+    0x824E55534F736765llu, // osa_Osge_US
+    0x0000000000000000llu,
+    0xA14B495241726162llu, // lki_Arab_IR
+    0xC2414C5242617373llu, // bsq_Bass_LR
+    0x8A2B495241726162llu, // lrc_Arab_IR
+    0x7469455445746869llu, // ti_Ethi_ET
+};
+
+inline bool representativeLocaleLookup(uint64_t key) {
+    const uint32_t bucket = perfectHashSlot(
+            key, 0u, static_cast<uint32_t>(REPRESENTATIVE_LOCALES_MASK));
+    const uint32_t slot = perfectHashSlot(key, REPRESENTATIVE_LOCALES_SALTS[bucket],
+            static_cast<uint32_t>(REPRESENTATIVE_LOCALES_MASK));
+    return REPRESENTATIVE_LOCALES_SLOTS[slot] == key;
+}
+
+const uint16_t ARAB_PARENTS_SALTS[8] = {
+    0u, 2u, 3u, 0u, 1u, 0u, 1u, 0u,
+};
 
-const std::unordered_map<uint32_t, uint32_t> ARAB_PARENTS({
+const LocaleParentEntry ARAB_PARENTS_SLOTS[8] = {
+    {0x6172544Eu, 0x61729420u}, // ar-TN -> ar-015
+    {0x61724D41u, 0x61729420u}, // ar-MA -> ar-015
     {0x6172445Au, 0x61729420u}, // ar-DZ -> ar-015
-    {0x61724548u, 0x61729420u}, // ar-EH -> ar-015
     {0x61724C59u, 0x61729420u}, // ar-LY -> ar-015
-    {0x61724D41u, 0x61729420u}, // ar-MA -> ar-015
-    {0x6172544Eu, 0x61729420u}, // ar-TN -> ar-015
-});
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x61724548u, 0x61729420u}, // ar-EH -> ar-015
+    {0x00000000u, 0x00000000u},
+};
 
-const std::unordered_map<uint32_t, uint32_t> HANT_PARENTS({
+const LocaleParentTable ARAB_PARENTS = {0x7u, ARAB_PARENTS_SALTS, ARAB_PARENTS_SLOTS};
+
+const uint16_t HANT_PARENTS_SALTS[2] = {
+    1u, 0u,
+};
+
+const LocaleParentEntry HANT_PARENTS_SLOTS[2] = {
     {0x7A684D4Fu, 0x7A68484Bu}, // zh-Hant-MO -> zh-Hant-HK
-});
+    {0x00000000u, 0x00000000u},
+};
 
-const std::unordered_map<uint32_t, uint32_t> LATN_PARENTS({
-    {0x656E80A1u, 0x656E8400u}, // en-150 -> en-001
-    {0x656E4147u, 0x656E8400u}, // en-AG -> en-001
-    {0x656E4149u, 0x656E8400u}, // en-AI -> en-001
-    {0x656E4154u, 0x656E80A1u}, // en-AT -> en-150
-    {0x656E4155u, 0x656E8400u}, // en-AU -> en-001
-    {0x656E4242u, 0x656E8400u}, // en-BB -> en-001
-    {0x656E4245u, 0x656E8400u}, // en-BE -> en-001
-    {0x656E424Du, 0x656E8400u}, // en-BM -> en-001
-    {0x656E4253u, 0x656E8400u}, // en-BS -> en-001
-    {0x656E4257u, 0x656E8400u}, // en-BW -> en-001
-    {0x656E425Au, 0x656E8400u}, // en-BZ -> en-001
-    {0x656E4341u, 0x656E8400u}, // en-CA -> en-001
-    {0x656E4343u, 0x656E8400u}, // en-CC -> en-001
-    {0x656E4348u, 0x656E80A1u}, // en-CH -> en-150
-    {0x656E434Bu, 0x656E8400u}, // en-CK -> en-001
-    {0x656E434Du, 0x656E8400u}, // en-CM -> en-001
-    {0x656E4358u, 0x656E8400u}, // en-CX -> en-001
-    {0x656E4359u, 0x656E8400u}, // en-CY -> en-001
+const LocaleParentTable HANT_PARENTS = {0x1u, HANT_PARENTS_SALTS, HANT_PARENTS_SLOTS};
+
+const uint16_t LATN_PARENTS_SALTS[256] = {
+    1u, 0u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 4u,
+    0u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 1u,
+    2u, 0u, 0u, 1u, 1u, 1u, 1u, 3u, 0u, 0u, 0u, 1u,
+    0u, 0u, 0u, 3u, 0u, 3u, 0u, 0u, 2u, 1u, 0u, 2u,
+    0u, 1u, 0u, 0u, 0u, 1u, 0u, 1u, 0u, 2u, 0u, 2u,
+    1u, 2u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 0u,
+    1u, 0u, 1u, 0u, 1u, 0u, 1u, 1u, 0u, 1u, 1u, 0u,
+    0u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u,
+    1u, 0u, 5u, 0u, 0u, 1u, 0u, 3u, 0u, 1u, 0u, 0u,
+    1u, 0u, 0u, 1u, 2u, 0u, 0u, 0u, 1u, 2u, 0u, 0u,
+    0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u,
+    0u, 1u, 1u, 0u, 0u, 0u, 2u, 0u, 1u, 2u, 1u, 1u,
+    1u, 7u, 0u, 0u, 0u, 2u, 1u, 0u, 0u, 1u, 0u, 0u,
+    1u, 1u, 0u, 0u, 0u, 0u, 2u, 1u, 1u, 0u, 0u, 1u,
+    1u, 0u, 1u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+    0u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u,
+    0u, 0u, 0u, 0u, 0u, 1u, 0u, 3u, 3u, 0u, 1u, 0u,
+    0u, 0u, 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 1u,
+    1u, 2u, 0u, 1u, 0u, 1u, 1u, 3u, 1u, 0u, 0u, 0u,
+    0u, 0u, 1u, 2u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 0u,
+    0u, 0u, 2u, 4u, 0u, 1u, 0u, 0u, 0u, 2u, 0u, 0u,
+    0u, 1u, 1u, 1u,
+};
+
+const LocaleParentEntry LATN_PARENTS_SLOTS[256] = {
+    {0x656E4749u, 0x656E8400u}, // en-GI -> en-001
+    {0x656E5349u, 0x656E80A1u}, // en-SI -> en-150
+    {0x70744348u, 0x70745054u}, // pt-CH -> pt-PT
+    {0x656E5048u, 0x656E8400u}, // en-PH -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E5344u, 0x656E8400u}, // en-SD -> en-001
+    {0x656E4E41u, 0x656E8400u}, // en-NA -> en-001
+    {0x656E5057u, 0x656E8400u}, // en-PW -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E4D4Fu, 0x656E8400u}, // en-MO -> en-001
     {0x656E4445u, 0x656E80A1u}, // en-DE -> en-150
-    {0x656E4447u, 0x656E8400u}, // en-DG -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x6573434Fu, 0x6573A424u}, // es-CO -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x656E5643u, 0x656E8400u}, // en-VC -> en-001
+    {0x656E434Bu, 0x656E8400u}, // en-CK -> en-001
+    {0x656E504Bu, 0x656E8400u}, // en-PK -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x65735041u, 0x6573A424u}, // es-PA -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x65735356u, 0x6573A424u}, // es-SV -> es-419
     {0x656E444Bu, 0x656E80A1u}, // en-DK -> en-150
-    {0x656E444Du, 0x656E8400u}, // en-DM -> en-001
-    {0x656E4552u, 0x656E8400u}, // en-ER -> en-001
-    {0x656E4649u, 0x656E80A1u}, // en-FI -> en-150
-    {0x656E464Au, 0x656E8400u}, // en-FJ -> en-001
-    {0x656E464Bu, 0x656E8400u}, // en-FK -> en-001
-    {0x656E464Du, 0x656E8400u}, // en-FM -> en-001
-    {0x656E4742u, 0x656E8400u}, // en-GB -> en-001
-    {0x656E4744u, 0x656E8400u}, // en-GD -> en-001
-    {0x656E4747u, 0x656E8400u}, // en-GG -> en-001
-    {0x656E4748u, 0x656E8400u}, // en-GH -> en-001
-    {0x656E4749u, 0x656E8400u}, // en-GI -> en-001
-    {0x656E474Du, 0x656E8400u}, // en-GM -> en-001
-    {0x656E4759u, 0x656E8400u}, // en-GY -> en-001
-    {0x656E484Bu, 0x656E8400u}, // en-HK -> en-001
-    {0x656E4945u, 0x656E8400u}, // en-IE -> en-001
-    {0x656E494Cu, 0x656E8400u}, // en-IL -> en-001
-    {0x656E494Du, 0x656E8400u}, // en-IM -> en-001
-    {0x656E494Eu, 0x656E8400u}, // en-IN -> en-001
-    {0x656E494Fu, 0x656E8400u}, // en-IO -> en-001
-    {0x656E4A45u, 0x656E8400u}, // en-JE -> en-001
-    {0x656E4A4Du, 0x656E8400u}, // en-JM -> en-001
-    {0x656E4B45u, 0x656E8400u}, // en-KE -> en-001
-    {0x656E4B49u, 0x656E8400u}, // en-KI -> en-001
-    {0x656E4B4Eu, 0x656E8400u}, // en-KN -> en-001
     {0x656E4B59u, 0x656E8400u}, // en-KY -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E444Du, 0x656E8400u}, // en-DM -> en-001
+    {0x00000000u, 0x00000000u},
     {0x656E4C43u, 0x656E8400u}, // en-LC -> en-001
-    {0x656E4C52u, 0x656E8400u}, // en-LR -> en-001
-    {0x656E4C53u, 0x656E8400u}, // en-LS -> en-001
-    {0x656E4D47u, 0x656E8400u}, // en-MG -> en-001
-    {0x656E4D4Fu, 0x656E8400u}, // en-MO -> en-001
-    {0x656E4D53u, 0x656E8400u}, // en-MS -> en-001
-    {0x656E4D54u, 0x656E8400u}, // en-MT -> en-001
-    {0x656E4D55u, 0x656E8400u}, // en-MU -> en-001
-    {0x656E4D57u, 0x656E8400u}, // en-MW -> en-001
+    {0x70744D5Au, 0x70745054u}, // pt-MZ -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x656E4D59u, 0x656E8400u}, // en-MY -> en-001
-    {0x656E4E41u, 0x656E8400u}, // en-NA -> en-001
+    {0x656E4C53u, 0x656E8400u}, // en-LS -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x656E4E46u, 0x656E8400u}, // en-NF -> en-001
-    {0x656E4E47u, 0x656E8400u}, // en-NG -> en-001
-    {0x656E4E4Cu, 0x656E80A1u}, // en-NL -> en-150
-    {0x656E4E52u, 0x656E8400u}, // en-NR -> en-001
-    {0x656E4E55u, 0x656E8400u}, // en-NU -> en-001
-    {0x656E4E5Au, 0x656E8400u}, // en-NZ -> en-001
-    {0x656E5047u, 0x656E8400u}, // en-PG -> en-001
-    {0x656E5048u, 0x656E8400u}, // en-PH -> en-001
-    {0x656E504Bu, 0x656E8400u}, // en-PK -> en-001
-    {0x656E504Eu, 0x656E8400u}, // en-PN -> en-001
-    {0x656E5057u, 0x656E8400u}, // en-PW -> en-001
-    {0x656E5257u, 0x656E8400u}, // en-RW -> en-001
-    {0x656E5342u, 0x656E8400u}, // en-SB -> en-001
-    {0x656E5343u, 0x656E8400u}, // en-SC -> en-001
-    {0x656E5344u, 0x656E8400u}, // en-SD -> en-001
-    {0x656E5345u, 0x656E80A1u}, // en-SE -> en-150
-    {0x656E5347u, 0x656E8400u}, // en-SG -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x65735045u, 0x6573A424u}, // es-PE -> es-419
+    {0x656E4343u, 0x656E8400u}, // en-CC -> en-001
+    {0x656E4742u, 0x656E8400u}, // en-GB -> en-001
+    {0x6573484Eu, 0x6573A424u}, // es-HN -> es-419
+    {0x656E464Du, 0x656E8400u}, // en-FM -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E4257u, 0x656E8400u}, // en-BW -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4348u, 0x656E80A1u}, // en-CH -> en-150
+    {0x656E4D57u, 0x656E8400u}, // en-MW -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4B45u, 0x656E8400u}, // en-KE -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x65735059u, 0x6573A424u}, // es-PY -> es-419
+    {0x656E5456u, 0x656E8400u}, // en-TV -> en-001
+    {0x656E4A4Du, 0x656E8400u}, // en-JM -> en-001
     {0x656E5348u, 0x656E8400u}, // en-SH -> en-001
-    {0x656E5349u, 0x656E80A1u}, // en-SI -> en-150
-    {0x656E534Cu, 0x656E8400u}, // en-SL -> en-001
-    {0x656E5353u, 0x656E8400u}, // en-SS -> en-001
-    {0x656E5358u, 0x656E8400u}, // en-SX -> en-001
-    {0x656E535Au, 0x656E8400u}, // en-SZ -> en-001
-    {0x656E5443u, 0x656E8400u}, // en-TC -> en-001
-    {0x656E544Bu, 0x656E8400u}, // en-TK -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4341u, 0x656E8400u}, // en-CA -> en-001
+    {0x656E494Fu, 0x656E8400u}, // en-IO -> en-001
+    {0x656E474Du, 0x656E8400u}, // en-GM -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x656E544Fu, 0x656E8400u}, // en-TO -> en-001
-    {0x656E5454u, 0x656E8400u}, // en-TT -> en-001
-    {0x656E5456u, 0x656E8400u}, // en-TV -> en-001
-    {0x656E545Au, 0x656E8400u}, // en-TZ -> en-001
-    {0x656E5547u, 0x656E8400u}, // en-UG -> en-001
-    {0x656E5643u, 0x656E8400u}, // en-VC -> en-001
-    {0x656E5647u, 0x656E8400u}, // en-VG -> en-001
-    {0x656E5655u, 0x656E8400u}, // en-VU -> en-001
-    {0x656E5753u, 0x656E8400u}, // en-WS -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x656E5A41u, 0x656E8400u}, // en-ZA -> en-001
-    {0x656E5A4Du, 0x656E8400u}, // en-ZM -> en-001
-    {0x656E5A57u, 0x656E8400u}, // en-ZW -> en-001
-    {0x65734152u, 0x6573A424u}, // es-AR -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x70744D4Fu, 0x70745054u}, // pt-MO -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x656E4149u, 0x656E8400u}, // en-AI -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x6573424Fu, 0x6573A424u}, // es-BO -> es-419
-    {0x65734252u, 0x6573A424u}, // es-BR -> es-419
-    {0x6573434Cu, 0x6573A424u}, // es-CL -> es-419
-    {0x6573434Fu, 0x6573A424u}, // es-CO -> es-419
+    {0x656E5257u, 0x656E8400u}, // en-RW -> en-001
+    {0x65735559u, 0x6573A424u}, // es-UY -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4D53u, 0x656E8400u}, // en-MS -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4253u, 0x656E8400u}, // en-BS -> en-001
+    {0x656E425Au, 0x656E8400u}, // en-BZ -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E5353u, 0x656E8400u}, // en-SS -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x70744C55u, 0x70745054u}, // pt-LU -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x656E545Au, 0x656E8400u}, // en-TZ -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E535Au, 0x656E8400u}, // en-SZ -> en-001
+    {0x65734E49u, 0x6573A424u}, // es-NI -> es-419
+    {0x656E5047u, 0x656E8400u}, // en-PG -> en-001
+    {0x656E4147u, 0x656E8400u}, // en-AG -> en-001
+    {0x656E424Du, 0x656E8400u}, // en-BM -> en-001
+    {0x65734152u, 0x6573A424u}, // es-AR -> es-419
     {0x65734352u, 0x6573A424u}, // es-CR -> es-419
-    {0x65734355u, 0x6573A424u}, // es-CU -> es-419
+    {0x70744751u, 0x70745054u}, // pt-GQ -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4B4Eu, 0x656E8400u}, // en-KN -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E80A1u, 0x656E8400u}, // en-150 -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4D47u, 0x656E8400u}, // en-MG -> en-001
+    {0x656E464Bu, 0x656E8400u}, // en-FK -> en-001
+    {0x656E4D55u, 0x656E8400u}, // en-MU -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x7074544Cu, 0x70745054u}, // pt-TL -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4B49u, 0x656E8400u}, // en-KI -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E5358u, 0x656E8400u}, // en-SX -> en-001
     {0x6573444Fu, 0x6573A424u}, // es-DO -> es-419
-    {0x65734543u, 0x6573A424u}, // es-EC -> es-419
-    {0x65734754u, 0x6573A424u}, // es-GT -> es-419
-    {0x6573484Eu, 0x6573A424u}, // es-HN -> es-419
+    {0x656E4245u, 0x656E8400u}, // en-BE -> en-001
+    {0x656E4649u, 0x656E80A1u}, // en-FI -> en-150
+    {0x656E5347u, 0x656E8400u}, // en-SG -> en-001
+    {0x00000000u, 0x00000000u},
     {0x65734D58u, 0x6573A424u}, // es-MX -> es-419
-    {0x65734E49u, 0x6573A424u}, // es-NI -> es-419
-    {0x65735041u, 0x6573A424u}, // es-PA -> es-419
-    {0x65735045u, 0x6573A424u}, // es-PE -> es-419
-    {0x65735052u, 0x6573A424u}, // es-PR -> es-419
-    {0x65735059u, 0x6573A424u}, // es-PY -> es-419
-    {0x65735356u, 0x6573A424u}, // es-SV -> es-419
-    {0x65735553u, 0x6573A424u}, // es-US -> es-419
-    {0x65735559u, 0x6573A424u}, // es-UY -> es-419
-    {0x65735645u, 0x6573A424u}, // es-VE -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x656E5655u, 0x656E8400u}, // en-VU -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E544Bu, 0x656E8400u}, // en-TK -> en-001
+    {0x656E4E5Au, 0x656E8400u}, // en-NZ -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x7074414Fu, 0x70745054u}, // pt-AO -> pt-PT
-    {0x70744348u, 0x70745054u}, // pt-CH -> pt-PT
+    {0x656E5443u, 0x656E8400u}, // en-TC -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x65735645u, 0x6573A424u}, // es-VE -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E484Bu, 0x656E8400u}, // en-HK -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4D54u, 0x656E8400u}, // en-MT -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E4C52u, 0x656E8400u}, // en-LR -> en-001
+    {0x656E5647u, 0x656E8400u}, // en-VG -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E504Eu, 0x656E8400u}, // en-PN -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x65734355u, 0x6573A424u}, // es-CU -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
     {0x70744356u, 0x70745054u}, // pt-CV -> pt-PT
-    {0x70744751u, 0x70745054u}, // pt-GQ -> pt-PT
-    {0x70744757u, 0x70745054u}, // pt-GW -> pt-PT
-    {0x70744C55u, 0x70745054u}, // pt-LU -> pt-PT
-    {0x70744D4Fu, 0x70745054u}, // pt-MO -> pt-PT
-    {0x70744D5Au, 0x70745054u}, // pt-MZ -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x656E4358u, 0x656E8400u}, // en-CX -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E5547u, 0x656E8400u}, // en-UG -> en-001
+    {0x656E464Au, 0x656E8400u}, // en-FJ -> en-001
     {0x70745354u, 0x70745054u}, // pt-ST -> pt-PT
-    {0x7074544Cu, 0x70745054u}, // pt-TL -> pt-PT
-});
+    {0x656E4447u, 0x656E8400u}, // en-DG -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x65735553u, 0x6573A424u}, // es-US -> es-419
+    {0x656E4E55u, 0x656E8400u}, // en-NU -> en-001
+    {0x70744757u, 0x70745054u}, // pt-GW -> pt-PT
+    {0x00000000u, 0x00000000u},
+    {0x656E5753u, 0x656E8400u}, // en-WS -> en-001
+    {0x656E5343u, 0x656E8400u}, // en-SC -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E494Cu, 0x656E8400u}, // en-IL -> en-001
+    {0x656E494Eu, 0x656E8400u}, // en-IN -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E5A4Du, 0x656E8400u}, // en-ZM -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E434Du, 0x656E8400u}, // en-CM -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4359u, 0x656E8400u}, // en-CY -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4747u, 0x656E8400u}, // en-GG -> en-001
+    {0x656E4759u, 0x656E8400u}, // en-GY -> en-001
+    {0x65734754u, 0x6573A424u}, // es-GT -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4154u, 0x656E80A1u}, // en-AT -> en-150
+    {0x65734543u, 0x6573A424u}, // es-EC -> es-419
+    {0x00000000u, 0x00000000u},
+    {0x656E4E52u, 0x656E8400u}, // en-NR -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4242u, 0x656E8400u}, // en-BB -> en-001
+    {0x656E5A57u, 0x656E8400u}, // en-ZW -> en-001
+    {0x656E5342u, 0x656E8400u}, // en-SB -> en-001
+    {0x65735052u, 0x6573A424u}, // es-PR -> es-419
+    {0x656E4748u, 0x656E8400u}, // en-GH -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x656E4E4Cu, 0x656E80A1u}, // en-NL -> en-150
+    {0x656E4552u, 0x656E8400u}, // en-ER -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x00000000u, 0x00000000u},
+    {0x6573434Cu, 0x6573A424u}, // es-CL -> es-419
+    {0x656E5345u, 0x656E80A1u}, // en-SE -> en-150
+    {0x00000000u, 0x00000000u},
+    {0x656E534Cu, 0x656E8400u}, // en-SL -> en-001
+    {0x656E494Du, 0x656E8400u}, // en-IM -> en-001
+    {0x656E4945u, 0x656E8400u}, // en-IE -> en-001
+    {0x00000000u, 0x00000000u},
+    {0x656E4E47u, 0x656E8400u}, // en-NG -> en-001
+    {0x656E4A45u, 0x656E8400u}, // en-JE -> en-001
+    {0x656E4744u, 0x656E8400u}, // en-GD -> en-001
+    {0x656E5454u, 0x656E8400u}, // en-TT -> en-001
+    {0x656E4155u, 0x656E8400u}, // en-AU -> en-001
+    {0x65734252u, 0x6573A424u}, // es-BR -> es-419
+};
+
+const LocaleParentTable LATN_PARENTS = {0xFFu, LATN_PARENTS_SALTS, LATN_PARENTS_SLOTS};
+
+inline const LocaleParentEntry* localeParentLookup(const LocaleParentTable& table,
+                                                  uint32_t key) {
+    const uint32_t bucket = perfectHashSlot(key, 0u, table.mask);
+    const uint32_t slot = perfectHashSlot(key, table.salts[bucket], table.mask);
+    return table.slots[slot].key == key ? &table.slots[slot] : nullptr;
+}
 
 const struct {
     const char script[4];
-    const std::unordered_map<uint32_t, uint32_t>* map;
+    const LocaleParentTable* map;
 } SCRIPT_PARENTS[] = {
     {{'A', 'r', 'a', 'b'}, &ARAB_PARENTS},
     {{'H', 'a', 'n', 't'}, &HANT_PARENTS},
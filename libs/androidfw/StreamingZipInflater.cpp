@@ -114,6 +114,12 @@ void StreamingZipInflater::initInflateState() {
     if (mDataMap == NULL) {
         ::lseek(mFd, mInFileStart, SEEK_SET);
         mInflateState.avail_in = 0; // set when a chunk is read in
+#ifdef POSIX_FADV_WILLNEED
+        // Start paging in the first compressed chunk now; the first read() often
+        // happens well after the asset is opened.
+        ::posix_fadvise(mFd, mInFileStart, min_of(mInBufSize, mInTotalSize),
+                POSIX_FADV_WILLNEED);
+#endif
     } else {
         mInflateState.avail_in = mInBufSize;
     }
@@ -221,6 +227,15 @@ int StreamingZipInflater::readNextChunk() {
                 mInNextChunkOffset += didRead;
                 mInflateState.next_in = (Bytef*) mInBuf;
                 mInflateState.avail_in = didRead;
+#ifdef POSIX_FADV_WILLNEED
+                // Ask the kernel to page in the next compressed chunk while this
+                // one inflates, so the next call doesn't stall on disk.
+                if (mInNextChunkOffset < mInTotalSize) {
+                    ::posix_fadvise(mFd, mInFileStart + mInNextChunkOffset,
+                            min_of(mInBufSize, mInTotalSize - mInNextChunkOffset),
+                            POSIX_FADV_WILLNEED);
+                }
+#endif
             }
         }
     }
@@ -232,6 +247,16 @@ int StreamingZipInflater::readNextChunk() {
 // position to the destination.
 off64_t StreamingZipInflater::seekAbsolute(off64_t absoluteInputPosition) {
     if (absoluteInputPosition < mOutCurPosition) {
+        // If the target still lies within the window of decoded data in mOutBuf,
+        // just move the delivery cursor backwards instead of re-inflating the
+        // whole stream from the beginning.
+        const off64_t windowStart = mOutCurPosition - mOutDeliverable;
+        if (absoluteInputPosition >= windowStart) {
+            mOutDeliverable = absoluteInputPosition - windowStart;
+            mOutCurPosition = absoluteInputPosition;
+            return absoluteInputPosition;
+        }
+
         // rewind and reprocess the data from the beginning
         if (!mStreamNeedsInit) {
             ::inflateEnd(&mInflateState);
@@ -36,16 +36,49 @@ TypeVariant::TypeVariant(const ResTable_type* data) : data(data), mLength(dtohl(
     }
 }
 
+static bool keyCompare(uint32_t entry, uint16_t index) {
+  return dtohs(ResTable_sparseTypeEntry{entry}.idx) < index;
+}
+
+void TypeVariant::iterator::initSparseIndex() {
+    const ResTable_type* type = mTypeVariant->data;
+    if (!(type->flags & ResTable_type::FLAG_SPARSE) || mTypeVariant->mLength == 0) {
+        return;
+    }
+
+    // The extent of the entry indices was validated by the TypeVariant constructor.
+    const uint32_t entryCount = dtohl(type->entryCount);
+    if (mIndex >= mTypeVariant->mLength) {
+        mSparseIndex = entryCount;
+        return;
+    }
+
+    const uint32_t* const entryIndices = reinterpret_cast<const uint32_t*>(
+            reinterpret_cast<uintptr_t>(type) + dtohs(type->header.headerSize));
+    mSparseIndex = std::lower_bound(entryIndices, entryIndices + entryCount, mIndex, keyCompare)
+            - entryIndices;
+}
+
 TypeVariant::iterator& TypeVariant::iterator::operator++() {
     mIndex++;
     if (mIndex > mTypeVariant->mLength) {
         mIndex = mTypeVariant->mLength;
     }
-    return *this;
-}
 
-static bool keyCompare(uint32_t entry, uint16_t index) {
-  return dtohs(ResTable_sparseTypeEntry{entry}.idx) < index;
+    const ResTable_type* type = mTypeVariant->data;
+    if ((type->flags & ResTable_type::FLAG_SPARSE) && mTypeVariant->mLength != 0) {
+        // Keep mSparseIndex at the first sparse entry whose index is >= mIndex. Since
+        // the sparse entries are sorted, this advances by at most one entry per step
+        // over the course of a full iteration.
+        const uint32_t entryCount = dtohl(type->entryCount);
+        const uint32_t* const entryIndices = reinterpret_cast<const uint32_t*>(
+                reinterpret_cast<uintptr_t>(type) + dtohs(type->header.headerSize));
+        while (mSparseIndex < entryCount
+                && dtohs(ResTable_sparseTypeEntry{entryIndices[mSparseIndex]}.idx) < mIndex) {
+            mSparseIndex++;
+        }
+    }
+    return *this;
 }
 
 const ResTable_entry* TypeVariant::iterator::operator*() const {
@@ -66,13 +99,13 @@ const ResTable_entry* TypeVariant::iterator::operator*() const {
 
     uint32_t entryOffset;
     if (type->flags & ResTable_type::FLAG_SPARSE) {
-      auto iter = std::lower_bound(entryIndices, entryIndices + entryCount, mIndex, keyCompare);
-      if (iter == entryIndices + entryCount
-              || dtohs(ResTable_sparseTypeEntry{*iter}.idx) != mIndex) {
+      if (mSparseIndex >= entryCount
+              || dtohs(ResTable_sparseTypeEntry{entryIndices[mSparseIndex]}.idx) != mIndex) {
         return NULL;
       }
 
-      entryOffset = static_cast<uint32_t>(dtohs(ResTable_sparseTypeEntry{*iter}.offset)) * 4u;
+      entryOffset = static_cast<uint32_t>(
+              dtohs(ResTable_sparseTypeEntry{entryIndices[mSparseIndex]}.offset)) * 4u;
     } else {
       entryOffset = dtohl(entryIndices[mIndex]);
     }
@@ -94,16 +94,21 @@ ZipFileRO::~ZipFileRO() {
 
 ZipEntryRO ZipFileRO::findEntryByName(const char* entryName) const
 {
-    _ZipEntryRO* data = new _ZipEntryRO;
-
-    data->name = ZipString(entryName);
+    // Resolve the entry against the archive's central directory hash table before
+    // allocating anything; misses are common when several archives are probed for
+    // the same asset name.
+    ZipString name(entryName);
+    ZipEntry entry;
 
-    const int32_t error = FindEntry(mHandle, data->name, &(data->entry));
+    const int32_t error = FindEntry(mHandle, name, &entry);
     if (error) {
-        delete data;
         return NULL;
     }
 
+    _ZipEntryRO* data = new _ZipEntryRO;
+    data->name = name;
+    data->entry = entry;
+
     return (ZipEntryRO) data;
 }
 
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "android-base/macros.h"
 #include "android-base/unique_fd.h"
@@ -39,6 +40,25 @@ class ApkAssets {
   // filter out this package when computing what configurations/resources are available.
   static std::unique_ptr<const ApkAssets> Load(const std::string& path, bool system = false);
 
+  // Loads the system APK at the given path through a process-wide cache, parsing its central
+  // directory and resource table at most once per process. The returned instance is owned by
+  // the cache and lives for the lifetime of the process; use IsCached() to tell such instances
+  // apart from uniquely owned ones. When the cache is primed in the zygote before forking,
+  // child processes adopt the parsed tables as clean copy-on-write pages instead of
+  // re-parsing them.
+  static const ApkAssets* LoadCached(const std::string& path);
+
+  // Returns true if the instance is owned by the process-wide cache and must not be deleted.
+  static bool IsCached(const ApkAssets* apk_assets);
+
+  // Loads several APKs concurrently on a small pool of threads, one Load() per path. The
+  // returned vector has the same size and order as `paths` regardless of scheduling; entries
+  // whose APK failed to load are null. Useful at app start where dozens of splits and overlays
+  // would otherwise be parsed serially.
+  // If `system` is true, every package is marked as a system package.
+  static std::vector<std::unique_ptr<const ApkAssets>> LoadParallel(
+      const std::vector<std::string>& paths, bool system = false);
+
   // Creates an ApkAssets, but forces any package with ID 0x7f to be loaded as a shared library.
   // If `system` is true, the package is marked as a system package, and allows some functions to
   // filter out this package when computing what configurations/resources are available.
@@ -62,6 +82,15 @@ class ApkAssets {
                                                      const std::string& friendly_name, bool system,
                                                      bool force_shared_lib);
 
+  // Performs a one-time deep verification of the APK's resource table, including the type chunk
+  // checks that Load() normally defers until first use, and writes a checksum sidecar next to
+  // the APK. Subsequent calls to Load() that find a sidecar matching the APK's size,
+  // modification time and resource table checksum skip per-chunk validation entirely.
+  // Intended to be called by the installer after an APK has been staged.
+  // Returns false if the APK could not be loaded, failed verification, or the sidecar could not
+  // be written.
+  static bool PreVerify(const std::string& path);
+
   std::unique_ptr<Asset> Open(const std::string& path,
                               Asset::AccessMode mode = Asset::AccessMode::ACCESS_RANDOM) const;
 
@@ -112,6 +112,25 @@ public:
      */
     virtual bool isAllocated(void) const { return false; }
 
+    /*
+     * Hint at the expected access pattern for the asset's backing storage.
+     * Memory-mapped assets forward the hint to madvise(); file-backed
+     * assets forward it to posix_fadvise().  The default implementation
+     * ignores the hint.  Returns NO_ERROR if the hint was applied.
+     */
+    virtual status_t advise(AccessMode /*mode*/) { return INVALID_OPERATION; }
+
+    /*
+     * Ask the OS to start warming the page cache for the given range of
+     * the asset, so a subsequent reader doesn't fault the pages in
+     * serially.  The readahead is asynchronous; the call returns without
+     * waiting for the pages.  The range is clamped to the asset's bounds.
+     * Returns NO_ERROR if a prefetch was issued.
+     */
+    virtual status_t prefetch(off64_t /*offset*/, off64_t /*length*/) {
+        return INVALID_OPERATION;
+    }
+
     /*
      * Get a string identifying the asset's source.  This might be a full
      * path, it might be a colon-separated list of identifiers.
@@ -266,6 +285,8 @@ public:
     virtual off64_t getRemainingLength(void) const { return mLength-mOffset; }
     virtual int openFileDescriptor(off64_t* outStart, off64_t* outLength) const;
     virtual bool isAllocated(void) const { return mBuf != NULL; }
+    virtual status_t advise(AccessMode mode);
+    virtual status_t prefetch(off64_t offset, off64_t length);
 
 private:
     off64_t     mStart;         // absolute file offset of start of chunk
@@ -273,6 +273,13 @@ private:
         void addOverlay(const asset_path& ap);
         bool getOverlay(size_t idx, asset_path* out) const;
 
+        // Returns true and copies the cached listing of `dirName` into `outContents` if a
+        // previous scan of this archive cached it.
+        bool getCachedDirContents(const String8& dirName,
+                SortedVector<AssetDir::FileInfo>* outContents) const;
+        void setCachedDirContents(const String8& dirName,
+                const SortedVector<AssetDir::FileInfo>& contents);
+
     protected:
         ~SharedZip();
 
@@ -290,6 +297,11 @@ private:
 
         Vector<asset_path> mOverlays;
 
+        // Directory listings scanned out of this archive, keyed by directory name. A zip's
+        // contents never change while it is open, so listings are computed once and shared
+        // read-only by every AssetManager using this archive.
+        DefaultKeyedVector<String8, SortedVector<AssetDir::FileInfo> > mDirCache;
+
         static Mutex gLock;
         static DefaultKeyedVector<String8, wp<SharedZip> > gOpen;
     };
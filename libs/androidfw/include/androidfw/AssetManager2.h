@@ -21,6 +21,7 @@
 
 #include <array>
 #include <limits>
+#include <memory>
 #include <set>
 #include <unordered_map>
 
@@ -280,6 +281,11 @@ class AssetManager2 {
   // been seen while traversing bag parents.
   const ResolvedBag* GetBag(uint32_t resid, std::vector<uint32_t>& child_resids);
 
+  // Recomputes the fingerprint that identifies this AssetManager's view of resources
+  // (ordered ApkAssets set and current configuration) for the process-wide shared bag cache.
+  // Must be called whenever the ApkAssets or the configuration change.
+  void RebuildBagCacheFingerprint();
+
   // The ordered list of ApkAssets to search. These are not owned by the AssetManager, and must
   // have a longer lifetime.
   std::vector<const ApkAssets*> apk_assets_;
@@ -331,8 +337,14 @@ class AssetManager2 {
   ResTable_config configuration_;
 
   // Cached set of bags. These are cached because they can inherit keys from parent bags,
-  // which involves some calculation.
-  std::unordered_map<uint32_t, util::unique_cptr<ResolvedBag>> cached_bags_;
+  // which involves some calculation. Bags are immutable once resolved and may be shared
+  // with other AssetManager2 instances through the process-wide bag cache.
+  std::unordered_map<uint32_t, std::shared_ptr<const ResolvedBag>> cached_bags_;
+
+  // Identifies the ordered ApkAssets set and configuration of this AssetManager for the
+  // process-wide shared bag cache. Instances with equal fingerprints resolve every bag
+  // identically. 0 means the fingerprint is unknown and sharing is disabled.
+  uint64_t bag_cache_fingerprint_ = 0u;
 };
 
 class Theme {
@@ -53,6 +53,15 @@ void ApplyStyle(Theme* theme, ResXMLParser* xml_parser, uint32_t def_style_attr,
                 uint32_t def_style_resid, const uint32_t* attrs, size_t attrs_length,
                 uint32_t* out_values, uint32_t* out_indices);
 
+// Applies a style to `parser_count` sibling views in one pass. All views share the theme and
+// default style, so the default style is resolved and its bag pinned once for the whole batch,
+// and the per-view style bag is reused whenever consecutive parsers name the same style.
+// `out_values` holds attrs_length * STYLE_NUM_ENTRIES entries per view, back to back.
+// `out_indices` holds attrs_length + 1 entries per view, back to back. Neither may be nullptr.
+void ApplyStyleBatch(Theme* theme, ResXMLParser* const* xml_parsers, size_t parser_count,
+                     uint32_t def_style_attr, uint32_t def_style_resid, const uint32_t* attrs,
+                     size_t attrs_length, uint32_t* out_values, uint32_t* out_indices);
+
 // `out_values` must NOT be nullptr.
 // `out_indices` may be nullptr.
 bool RetrieveAttributes(AssetManager2* assetmanager, ResXMLParser* xml_parser, uint32_t* attrs,
@@ -22,6 +22,7 @@
 #include <utils/Errors.h>
 #include <utils/String8.h>
 #include <utils/KeyedVector.h>
+#include <utils/Vector.h>
 
 namespace android {
 
@@ -55,6 +56,10 @@ struct FileRec {
     String8 file;
     bool deleted;
     FileState s;
+    // Content-defined chunk digests for the file (v2 snapshots).  Lets the
+    // backup pass reuse digests for untouched files and verify whether a file
+    // whose mtime changed actually has different contents.
+    Vector<uint32_t> chunkDigests;
 };
 
 
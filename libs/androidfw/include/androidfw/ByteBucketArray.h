@@ -27,11 +27,19 @@ namespace android {
 /**
  * Stores a sparsely populated array. Has a fixed size of 256
  * (number of entries that a byte can represent).
+ *
+ * Once enough buckets have been allocated to show the index space is dense,
+ * the buckets are collapsed into one flat contiguous array. Lookups then
+ * index it directly instead of chasing a bucket pointer, which matters on
+ * hot paths like resource entry resolution where framework packages populate
+ * nearly the whole space.
  */
 template <typename T>
 class ByteBucketArray {
  public:
-  ByteBucketArray() : default_() { memset(buckets_, 0, sizeof(buckets_)); }
+  ByteBucketArray() : flat_(NULL), allocated_buckets_(0), default_() {
+    memset(buckets_, 0, sizeof(buckets_));
+  }
 
   ~ByteBucketArray() {
     for (size_t i = 0; i < kNumBuckets; i++) {
@@ -40,6 +48,8 @@ class ByteBucketArray {
       }
     }
     memset(buckets_, 0, sizeof(buckets_));
+    delete[] flat_;
+    flat_ = NULL;
   }
 
   inline size_t size() const { return kNumBuckets * kBucketSize; }
@@ -51,6 +61,10 @@ class ByteBucketArray {
       return default_;
     }
 
+    if (flat_ != NULL) {
+      return flat_[static_cast<uint8_t>(index)];
+    }
+
     uint8_t bucket_index = static_cast<uint8_t>(index) >> 4;
     T* bucket = buckets_[bucket_index];
     if (bucket == NULL) {
@@ -63,10 +77,19 @@ class ByteBucketArray {
     CHECK(index < size()) << "ByteBucketArray.getOrCreate(index=" << index
                           << ") with size=" << size();
 
+    if (flat_ != NULL) {
+      return flat_[static_cast<uint8_t>(index)];
+    }
+
     uint8_t bucket_index = static_cast<uint8_t>(index) >> 4;
     T* bucket = buckets_[bucket_index];
     if (bucket == NULL) {
+      if (allocated_buckets_ + 1 >= kCollapseThreshold) {
+        collapse();
+        return flat_[static_cast<uint8_t>(index)];
+      }
       bucket = buckets_[bucket_index] = new T[kBucketSize]();
+      allocated_buckets_++;
     }
     return bucket[0x0f & static_cast<uint8_t>(index)];
   }
@@ -81,9 +104,28 @@ class ByteBucketArray {
   }
 
  private:
-  enum { kNumBuckets = 16, kBucketSize = 16 };
+  enum { kNumBuckets = 16, kBucketSize = 16, kCollapseThreshold = 12 };
+
+  // Copies every allocated bucket into one contiguous array and frees the
+  // buckets. Unallocated slots stay default-constructed, so reads observe the
+  // same values as before.
+  void collapse() {
+    flat_ = new T[kNumBuckets * kBucketSize]();
+    for (size_t i = 0; i < kNumBuckets; i++) {
+      if (buckets_[i] != NULL) {
+        for (size_t j = 0; j < kBucketSize; j++) {
+          flat_[(i * kBucketSize) + j] = buckets_[i][j];
+        }
+        delete[] buckets_[i];
+        buckets_[i] = NULL;
+      }
+    }
+    allocated_buckets_ = 0;
+  }
 
   T* buckets_[kNumBuckets];
+  T* flat_;
+  size_t allocated_buckets_;
   T default_;
 };
 
@@ -84,12 +84,20 @@ class Chunk {
 //
 class ChunkIterator {
  public:
-  ChunkIterator(const void* data, size_t len)
+  // If `verify` is false, only the minimal bounds checks needed to walk the chunk list safely
+  // are performed. This is meant for data that has already been deeply verified, such as an
+  // APK whose resource table passed install-time pre-verification.
+  ChunkIterator(const void* data, size_t len, bool verify = true)
       : next_chunk_(reinterpret_cast<const ResChunk_header*>(data)),
         len_(len),
-        last_error_(nullptr) {
+        last_error_(nullptr),
+        verify_(verify) {
     CHECK(next_chunk_ != nullptr) << "data can't be nullptr";
-    VerifyNextChunk();
+    if (verify_) {
+      VerifyNextChunk();
+    } else {
+      VerifyNextChunkNonFatal();
+    }
   }
 
   Chunk Next();
@@ -115,6 +123,7 @@ class ChunkIterator {
   size_t len_;
   const char* last_error_;
   bool last_error_was_fatal_ = true;
+  bool verify_ = true;
 };
 
 }  // namespace android
@@ -104,6 +104,12 @@ public:
 
     status_t putBlob(uint32_t row, uint32_t column, const void* value, size_t size);
     status_t putString(uint32_t row, uint32_t column, const char* value, size_t sizeIncludingNull);
+
+    /**
+     * Stores a UTF-16 string as standard UTF-8, converting directly into the
+     * window allocation without an intermediate copy of the encoded bytes.
+     */
+    status_t putUtf16String(uint32_t row, uint32_t column, const char16_t* value, size_t len);
     status_t putLong(uint32_t row, uint32_t column, int64_t value);
     status_t putDouble(uint32_t row, uint32_t column, double value);
     status_t putNull(uint32_t row, uint32_t column);
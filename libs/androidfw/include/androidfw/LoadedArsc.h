@@ -17,8 +17,12 @@
 #ifndef LOADEDARSC_H_
 #define LOADEDARSC_H_
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "android-base/macros.h"
@@ -80,15 +84,16 @@ class LoadedPackage {
  public:
   static std::unique_ptr<const LoadedPackage> Load(const Chunk& chunk,
                                                    const LoadedIdmap* loaded_idmap, bool system,
-                                                   bool load_as_shared_library);
+                                                   bool load_as_shared_library, bool verify);
 
   ~LoadedPackage();
 
   // Finds the entry with the specified type name and entry name. The names are in UTF-16 because
   // the underlying ResStringPool API expects this. For now this is acceptable, but since
   // the default policy in AAPT2 is to build UTF-8 string pools, this needs to change.
-  // Returns a partial resource ID, with the package ID left as 0x00. The caller is responsible
-  // for patching the correct package ID to the resource ID.
+  // The first call builds a reverse index over the package's entries; subsequent lookups are
+  // constant-time. Returns a partial resource ID, with the package ID left as 0x00. The caller
+  // is responsible for patching the correct package ID to the resource ID.
   uint32_t FindEntryByName(const std::u16string& type_name, const std::u16string& entry_name) const;
 
   static const ResTable_entry* GetEntry(const ResTable_type* type_chunk, uint16_t entry_index);
@@ -147,11 +152,14 @@ class LoadedPackage {
   void CollectLocales(bool canonicalize, std::set<std::string>* out_locales) const;
 
   // type_idx is TT - 1 from 0xPPTTEEEE.
-  inline const TypeSpec* GetTypeSpecByTypeIndex(uint8_t type_index) const {
-    // If the type IDs are offset in this package, we need to take that into account when searching
-    // for a type.
-    return type_specs_[type_index - type_id_offset_].get();
-  }
+  // The layout of the ResTable_type chunks of a type is verified on the first call for that
+  // type. Returns nullptr if the type doesn't exist or any of its chunks are corrupt.
+  const TypeSpec* GetTypeSpecByTypeIndex(uint8_t type_index) const;
+
+  // Eagerly verifies the ResTable_type chunks of every type in the package. Used by
+  // install-time pre-verification so subsequent loads can skip per-chunk validation.
+  // Returns false if any chunk is corrupt.
+  bool VerifyAllTypeChunks() const;
 
   template <typename Func>
   void ForEachTypeSpec(Func f) const {
@@ -172,6 +180,15 @@ class LoadedPackage {
 
   LoadedPackage();
 
+  // Verifies the ResTable_type chunks of the TypeSpec stored at spec_idx in type_specs_,
+  // remembering the result so each type is verified at most once. Verification of type chunks
+  // is deferred from load time to first use so that loading a table doesn't pay for types the
+  // process never looks up. Returns false if any chunk is corrupt.
+  bool VerifyTypeChunks(size_t spec_idx) const;
+
+  // Builds entry_name_index_; only called through entry_name_index_once_.
+  void BuildEntryNameIndex() const;
+
   ResStringPool type_string_pool_;
   ResStringPool key_string_pool_;
   std::string package_name_;
@@ -181,7 +198,23 @@ class LoadedPackage {
   bool system_ = false;
   bool overlay_ = false;
 
+  // When false, the chunk data was verified before load (see ApkAssets::PreVerify) and the
+  // deferred type chunk verification in VerifyTypeChunks() is skipped.
+  bool verify_ = true;
+
   ByteBucketArray<TypeSpecPtr> type_specs_;
+
+  // Whether the type chunks of the TypeSpec at the same index in type_specs_ have passed
+  // verification. The chunks are immutable mmapped data and verification is idempotent, so a
+  // racing duplicate verification is harmless and relaxed atomics are sufficient.
+  mutable std::array<std::atomic<uint8_t>, 256> type_chunks_verified_{};
+
+  // Reverse lookup index for FindEntryByName: (type index << 32 | key string index) -> entry
+  // index. Materialized on the first reverse lookup since most processes never resolve names,
+  // and shared by every AssetManager2 referencing this LoadedPackage.
+  mutable std::unordered_map<uint64_t, uint16_t> entry_name_index_;
+  mutable std::once_flag entry_name_index_once_;
+
   std::vector<DynamicPackageEntry> dynamic_package_map_;
 };
 
@@ -195,10 +228,14 @@ class LoadedArsc {
   // If `load_as_shared_library` is set to true, the application package (0x7f) is treated
   // as a shared library (0x00). When loaded into an AssetManager, the package will be assigned an
   // ID.
+  // If `verify` is set to false, per-chunk validation is skipped. This must only be done for
+  // data that has already been deeply verified, such as an APK whose resource table passed
+  // install-time pre-verification (see ApkAssets::PreVerify).
   static std::unique_ptr<const LoadedArsc> Load(const StringPiece& data,
                                                 const LoadedIdmap* loaded_idmap = nullptr,
                                                 bool system = false,
-                                                bool load_as_shared_library = false);
+                                                bool load_as_shared_library = false,
+                                                bool verify = true);
 
   // Create an empty LoadedArsc. This is used when an APK has no resources.arsc.
   static std::unique_ptr<const LoadedArsc> CreateEmpty();
@@ -227,7 +264,8 @@ class LoadedArsc {
   DISALLOW_COPY_AND_ASSIGN(LoadedArsc);
 
   LoadedArsc() = default;
-  bool LoadTable(const Chunk& chunk, const LoadedIdmap* loaded_idmap, bool load_as_shared_library);
+  bool LoadTable(const Chunk& chunk, const LoadedIdmap* loaded_idmap, bool load_as_shared_library,
+                 bool verify);
 
   ResStringPool global_string_pool_;
   std::vector<std::unique_ptr<const LoadedPackage>> packages_;
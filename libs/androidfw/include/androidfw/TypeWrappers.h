@@ -30,6 +30,7 @@ struct TypeVariant {
         iterator& operator=(const iterator& rhs) {
             mTypeVariant = rhs.mTypeVariant;
             mIndex = rhs.mIndex;
+            mSparseIndex = rhs.mSparseIndex;
             return *this;
         }
 
@@ -61,9 +62,16 @@ struct TypeVariant {
     private:
         friend struct TypeVariant;
         iterator(const TypeVariant* tv, uint32_t index)
-            : mTypeVariant(tv), mIndex(index) {}
+            : mTypeVariant(tv), mIndex(index), mSparseIndex(0) {
+            initSparseIndex();
+        }
+        void initSparseIndex();
         const TypeVariant* mTypeVariant;
         uint32_t mIndex;
+        // For types with FLAG_SPARSE, the position in the sparse entry array of the
+        // first entry whose index is >= mIndex. Maintained incrementally by operator++
+        // so that iteration doesn't redo a binary search for every entry.
+        uint32_t mSparseIndex;
     };
 
     iterator beginEntries() const {
@@ -28,6 +28,7 @@ using ::android::base::unique_fd;
 using ::com::android::basic::R;
 using ::testing::Eq;
 using ::testing::Ge;
+using ::testing::IsNull;
 using ::testing::NotNull;
 using ::testing::SizeIs;
 using ::testing::StrEq;
@@ -45,6 +46,40 @@ TEST(ApkAssetsTest, LoadApk) {
   ASSERT_THAT(loaded_apk->Open("res/layout/main.xml"), NotNull());
 }
 
+TEST(ApkAssetsTest, LoadApkCached) {
+  const std::string path = GetTestDataPath() + "/basic/basic.apk";
+
+  const ApkAssets* cached_apk = ApkAssets::LoadCached(path);
+  ASSERT_THAT(cached_apk, NotNull());
+  EXPECT_TRUE(ApkAssets::IsCached(cached_apk));
+
+  // Loading the same path again must not parse the APK a second time.
+  EXPECT_THAT(ApkAssets::LoadCached(path), Eq(cached_apk));
+
+  // Uniquely owned instances are not part of the cache.
+  std::unique_ptr<const ApkAssets> loaded_apk = ApkAssets::Load(path);
+  ASSERT_THAT(loaded_apk, NotNull());
+  EXPECT_FALSE(ApkAssets::IsCached(loaded_apk.get()));
+}
+
+TEST(ApkAssetsTest, LoadApkParallel) {
+  const std::vector<std::string> paths = {
+      GetTestDataPath() + "/basic/basic.apk",
+      GetTestDataPath() + "/does/not/exist.apk",
+      GetTestDataPath() + "/styles/styles.apk",
+  };
+
+  std::vector<std::unique_ptr<const ApkAssets>> results = ApkAssets::LoadParallel(paths);
+  ASSERT_THAT(results, SizeIs(3u));
+
+  // Results must line up with the input paths, with failures surfacing as null entries.
+  ASSERT_THAT(results[0], NotNull());
+  EXPECT_THAT(results[0]->GetPath(), StrEq(paths[0]));
+  EXPECT_THAT(results[1], IsNull());
+  ASSERT_THAT(results[2], NotNull());
+  EXPECT_THAT(results[2]->GetPath(), StrEq(paths[2]));
+}
+
 TEST(ApkAssetsTest, LoadApkFromFd) {
   const std::string path = GetTestDataPath() + "/basic/basic.apk";
   unique_fd fd(::open(path.c_str(), O_RDONLY | O_BINARY));
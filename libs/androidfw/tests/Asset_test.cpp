@@ -28,6 +28,13 @@ TEST(AssetTest, FileAssetRegistersItself) {
   EXPECT_EQ(count, Asset::getGlobalCount());
 }
 
+TEST(AssetTest, HintsRejectedWithoutBackingStorage) {
+  _FileAsset asset;
+  EXPECT_EQ(INVALID_OPERATION, asset.advise(Asset::ACCESS_STREAMING));
+  EXPECT_EQ(BAD_VALUE, asset.prefetch(0, 4096));
+  EXPECT_EQ(BAD_VALUE, asset.prefetch(-1, 4096));
+}
+
 TEST(AssetTest, CompressedAssetRegistersItself) {
   const int32_t count = Asset::getGlobalCount();
   Asset* asset = new _CompressedAsset();
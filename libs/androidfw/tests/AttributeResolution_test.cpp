@@ -16,6 +16,7 @@
 
 #include "androidfw/AttributeResolution.h"
 
+#include <algorithm>
 #include <array>
 
 #include "android-base/file.h"
@@ -272,5 +273,37 @@ TEST_F(AttributeResolutionXmlTest, ThemeAndXmlParser) {
   EXPECT_EQ(expected_indices, indices);
 }
 
+TEST_F(AttributeResolutionXmlTest, BatchMatchesSingleViewApplyStyle) {
+  std::unique_ptr<Theme> theme = assetmanager_.NewTheme();
+  ASSERT_TRUE(theme->ApplyStyle(R::style::StyleTwo));
+
+  std::array<uint32_t, 6> attrs{{R::attr::attr_one, R::attr::attr_two, R::attr::attr_three,
+                                 R::attr::attr_four, R::attr::attr_five, R::attr::attr_empty}};
+  std::array<uint32_t, attrs.size() * STYLE_NUM_ENTRIES> expected_values;
+  std::array<uint32_t, attrs.size() + 1> expected_indices;
+  ApplyStyle(theme.get(), &xml_parser_, 0u /*def_style_attr*/, 0u /*def_style_res*/, attrs.data(),
+             attrs.size(), expected_values.data(), expected_indices.data());
+
+  constexpr size_t kViewCount = 3;
+  std::array<ResXMLParser*, kViewCount> parsers;
+  parsers.fill(&xml_parser_);
+  std::array<uint32_t, kViewCount * attrs.size() * STYLE_NUM_ENTRIES> values;
+  std::array<uint32_t, kViewCount * (attrs.size() + 1)> indices;
+
+  ApplyStyleBatch(theme.get(), parsers.data(), kViewCount, 0u /*def_style_attr*/,
+                  0u /*def_style_res*/, attrs.data(), attrs.size(), values.data(), indices.data());
+
+  // Every sibling view must resolve exactly as it would through a standalone ApplyStyle call.
+  for (size_t view = 0; view < kViewCount; view++) {
+    const uint32_t* values_cursor = values.data() + (view * attrs.size() * STYLE_NUM_ENTRIES);
+    EXPECT_TRUE(std::equal(expected_values.begin(), expected_values.end(), values_cursor))
+        << "values mismatch for view " << view;
+
+    const uint32_t* indices_cursor = indices.data() + (view * (attrs.size() + 1));
+    EXPECT_TRUE(std::equal(expected_indices.begin(), expected_indices.end(), indices_cursor))
+        << "indices mismatch for view " << view;
+  }
+}
+
 } // namespace android
 
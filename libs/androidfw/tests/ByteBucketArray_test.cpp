@@ -52,4 +52,21 @@ TEST(ByteBucketArrayTest, TestSparseInsertion) {
   }
 }
 
+TEST(ByteBucketArrayTest, TestDenseInsertion) {
+  ByteBucketArray<int> bba;
+  // Populate every slot so the array collapses to its flat representation.
+  for (size_t i = 0; i < bba.size(); i++) {
+    ASSERT_TRUE(bba.set(i, static_cast<int>(i) + 1));
+  }
+
+  for (size_t i = 0; i < bba.size(); i++) {
+    EXPECT_EQ(static_cast<int>(i) + 1, bba[i]);
+  }
+
+  // Values written before the collapse must survive it.
+  ASSERT_TRUE(bba.set(0, 1000));
+  EXPECT_EQ(1000, bba[0]);
+  EXPECT_EQ(256, bba[255]);
+}
+
 }  // namespace android
@@ -235,8 +235,22 @@ void BaseRenderNodeAnimator::transitionToRunning(AnimationContext& context) {
 }
 
 bool BaseRenderNodeAnimator::animate(AnimationContext& context) {
+    float fraction;
+    switch (startFrame(context, &fraction)) {
+        case FrameResult::Finished:
+            return true;
+        case FrameResult::Waiting:
+            return false;
+        case FrameResult::NeedsInterpolation:
+            break;
+    }
+    return finishFrame(context, mInterpolator->interpolate(fraction));
+}
+
+BaseRenderNodeAnimator::FrameResult BaseRenderNodeAnimator::startFrame(AnimationContext& context,
+                                                                       float* outFraction) {
     if (mPlayState < PlayState::Running) {
-        return false;
+        return FrameResult::Waiting;
     }
     if (mPlayState == PlayState::Finished) {
         if (mPendingActionUponFinish == Action::Reset) {
@@ -248,13 +262,37 @@ bool BaseRenderNodeAnimator::animate(AnimationContext& context) {
         }
         // Reset pending action.
         mPendingActionUponFinish = Action::None;
-        return true;
+        return FrameResult::Finished;
     }
 
     // This should be set before setValue() so animators can query this time when setValue
     // is called.
     nsecs_t currentPlayTime = context.frameTimeMs() - mStartTime;
-    bool finished = updatePlayTime(currentPlayTime);
+    mPlayTime = mPlayState == PlayState::Reversing ? mDuration - currentPlayTime : currentPlayTime;
+    onPlayTimeChanged(mPlayTime);
+    // If BaseRenderNodeAnimator is handling the delay (not typical), then
+    // because the staging properties reflect the final value, we always need
+    // to call setValue even if the animation isn't yet running or is still
+    // being delayed as we need to override the staging value
+    if (currentPlayTime < 0) {
+        setValue(mTarget, mFromValue);
+        return FrameResult::Waiting;
+    }
+
+    float fraction = 1.0f;
+    if ((mPlayState == PlayState::Running || mPlayState == PlayState::Reversing) && mDuration > 0) {
+        fraction = mPlayTime / (float)mDuration;
+    }
+    *outFraction = MathUtils::clamp(fraction, 0.0f, 1.0f);
+    return FrameResult::NeedsInterpolation;
+}
+
+bool BaseRenderNodeAnimator::finishFrame(AnimationContext& context, float easedFraction) {
+    setValue(mTarget, mFromValue + (mDeltaValue * easedFraction));
+
+    nsecs_t currentPlayTime =
+            mPlayState == PlayState::Reversing ? mDuration - mPlayTime : mPlayTime;
+    bool finished = currentPlayTime >= mDuration;
     if (finished && mPlayState != PlayState::Finished) {
         mPlayState = PlayState::Finished;
         callOnFinishedListener(context);
@@ -80,6 +80,28 @@ public:
     ANDROID_API void pushStaging(AnimationContext& context);
     ANDROID_API bool animate(AnimationContext& context);
 
+    // Result of startFrame() for one animation pulse.
+    enum class FrameResult {
+        // The animator finished and should be removed from its manager.
+        Finished,
+        // No value needs easing this frame (not started yet, or still in the start
+        // delay); keep the animator.
+        Waiting,
+        // *outFraction holds the clamped progress that still needs to be eased by the
+        // interpolator; the caller must follow up with finishFrame().
+        NeedsInterpolation,
+    };
+
+    // First phase of an animation pulse: advances the play state and computes the
+    // progress for this frame. Corner cases (start delay, pending finish actions)
+    // apply their value directly. Splitting the pulse lets AnimatorManager ease many
+    // animators from packed data; animate() is the single-animator equivalent.
+    FrameResult startFrame(AnimationContext& context, float* outFraction);
+    // Second phase: applies the eased fraction and finishes the pulse bookkeeping.
+    // Returns true if the animator finished and should be removed.
+    bool finishFrame(AnimationContext& context, float easedFraction);
+    Interpolator* interpolator() { return mInterpolator.get(); }
+
     // Returns the remaining time in ms for the animation. Note this should only be called during
     // an animation on RenderThread.
     ANDROID_API nsecs_t getRemainingPlayTime();
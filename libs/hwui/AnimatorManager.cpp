@@ -20,7 +20,9 @@
 #include "AnimationContext.h"
 #include "Animator.h"
 #include "DamageAccumulator.h"
+#include "Interpolator.h"
 #include "RenderNode.h"
+#include "utils/FatVector.h"
 
 namespace android {
 namespace uirenderer {
@@ -92,33 +94,6 @@ void AnimatorManager::onAnimatorTargetChanged(BaseRenderNodeAnimator* animator)
     mAnimators.erase(std::remove(mAnimators.begin(), mAnimators.end(), animator), mAnimators.end());
 }
 
-class AnimateFunctor {
-public:
-    AnimateFunctor(TreeInfo& info, AnimationContext& context, uint32_t* outDirtyMask)
-            : mInfo(info), mContext(context), mDirtyMask(outDirtyMask) {}
-
-    bool operator()(sp<BaseRenderNodeAnimator>& animator) {
-        *mDirtyMask |= animator->dirtyMask();
-        bool remove = animator->animate(mContext);
-        if (remove) {
-            animator->detach();
-        } else {
-            if (animator->isRunning()) {
-                mInfo.out.hasAnimations = true;
-            }
-            if (CC_UNLIKELY(!animator->mayRunAsync())) {
-                mInfo.out.requiresUiRedraw = true;
-            }
-        }
-        return remove;
-    }
-
-private:
-    TreeInfo& mInfo;
-    AnimationContext& mContext;
-    uint32_t* mDirtyMask;
-};
-
 uint32_t AnimatorManager::animate(TreeInfo& info) {
     if (!mAnimators.size()) return 0;
 
@@ -142,9 +117,75 @@ void AnimatorManager::animateNoDamage(TreeInfo& info) {
 
 uint32_t AnimatorManager::animateCommon(TreeInfo& info) {
     uint32_t dirtyMask = 0;
-    AnimateFunctor functor(info, mAnimationHandle->context(), &dirtyMask);
-    auto newEnd = std::remove_if(mAnimators.begin(), mAnimators.end(), functor);
-    mAnimators.erase(newEnd, mAnimators.end());
+    AnimationContext& context = mAnimationHandle->context();
+    const size_t count = mAnimators.size();
+
+    // Phase 1: advance every animator's play state and pack the fractions that still
+    // need easing into structure-of-arrays batches. Keeping the data packed lets
+    // phase 2 evaluate the common interpolator types without chasing the animator and
+    // interpolator pointers again; only custom curves fall back to virtual dispatch.
+    FatVector<float, 16> fractions;
+    FatVector<float, 16> params;
+    FatVector<Interpolator::Type, 16> types;
+    FatVector<size_t, 16> batchedAnimators;
+    FatVector<uint8_t, 16> removed(count);  // zero-initialized by resize
+    for (size_t i = 0; i < count; i++) {
+        BaseRenderNodeAnimator& animator = *mAnimators[i];
+        dirtyMask |= animator.dirtyMask();
+        float fraction;
+        switch (animator.startFrame(context, &fraction)) {
+            case BaseRenderNodeAnimator::FrameResult::Finished:
+                removed[i] = true;
+                break;
+            case BaseRenderNodeAnimator::FrameResult::Waiting:
+                break;
+            case BaseRenderNodeAnimator::FrameResult::NeedsInterpolation:
+                fractions.push_back(fraction);
+                types.push_back(animator.interpolator()->type());
+                params.push_back(animator.interpolator()->param());
+                batchedAnimators.push_back(i);
+                break;
+        }
+    }
+
+    // Phase 2: ease the packed fractions.
+    for (size_t i = 0; i < fractions.size(); i++) {
+        if (CC_UNLIKELY(types[i] == Interpolator::Type::Custom)) {
+            fractions[i] =
+                    mAnimators[batchedAnimators[i]]->interpolator()->interpolate(fractions[i]);
+        } else {
+            fractions[i] = Interpolator::evaluate(types[i], params[i], fractions[i]);
+        }
+    }
+
+    // Phase 3: apply the eased values and finish each pulse.
+    for (size_t i = 0; i < fractions.size(); i++) {
+        size_t index = batchedAnimators[i];
+        removed[index] = mAnimators[index]->finishFrame(context, fractions[i]);
+    }
+
+    // Phase 4: detach the finished animators and compact the list, propagating the
+    // frame flags of the animators that remain.
+    size_t newEnd = 0;
+    for (size_t i = 0; i < count; i++) {
+        sp<BaseRenderNodeAnimator>& animator = mAnimators[i];
+        if (removed[i]) {
+            animator->detach();
+            continue;
+        }
+        if (animator->isRunning()) {
+            info.out.hasAnimations = true;
+        }
+        if (CC_UNLIKELY(!animator->mayRunAsync())) {
+            info.out.requiresUiRedraw = true;
+        }
+        if (newEnd != i) {
+            mAnimators[newEnd] = std::move(animator);
+        }
+        newEnd++;
+    }
+    mAnimators.erase(mAnimators.begin() + newEnd, mAnimators.end());
+
     mAnimationHandle->notifyAnimationsRan();
     mParent.mProperties.updateMatrix();
     return dirtyMask;
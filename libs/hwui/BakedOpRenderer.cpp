@@ -25,6 +25,7 @@
 #include "utils/GLUtils.h"
 
 #include <algorithm>
+#include <math.h>
 
 namespace android {
 namespace uirenderer {
@@ -81,10 +82,11 @@ void BakedOpRenderer::startRepaintLayer(OffscreenBuffer* offscreenBuffer, const
 
 void BakedOpRenderer::endLayer() {
     if (mRenderTarget.stencil) {
-        // if stencil was used for clipping, detach it and return it to pool
+        // if stencil was used for clipping, detach it and keep it with the
+        // layer so pool reuse comes with a warm, correctly sized stencil
         glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, 0);
         GL_CHECKPOINT(MODERATE);
-        mCaches.renderBufferCache.put(mRenderTarget.stencil);
+        mRenderTarget.offscreenBuffer->stencil = mRenderTarget.stencil;
         mRenderTarget.stencil = nullptr;
     }
     mRenderTarget.lastStencilClip = nullptr;
@@ -117,7 +119,20 @@ OffscreenBuffer* BakedOpRenderer::copyToLayer(const Rect& area) {
 void BakedOpRenderer::startFrame(uint32_t width, uint32_t height, const Rect& repaintRect) {
     LOG_ALWAYS_FATAL_IF(mRenderTarget.frameBufferId != 0, "primary framebufferId must be 0");
     mRenderState.bindFramebuffer(0);
-    setViewport(width, height);
+    if (CC_UNLIKELY(mRenderScale != 1.0f)) {
+        // Ops and clips stay in logical coordinates; the ortho projection maps
+        // them to NDC at logical size, while the GL viewport (and scissor
+        // rects, via the scissor's render scale) cover the smaller buffer.
+        mRenderTarget.viewportWidth = width;
+        mRenderTarget.viewportHeight = height;
+        mRenderTarget.orthoMatrix.loadOrtho(width, height);
+        mRenderState.setViewport((GLsizei)ceilf(width * mRenderScale),
+                                 (GLsizei)ceilf(height * mRenderScale));
+        mRenderState.blend().syncEnabled();
+        mRenderState.scissor().setRenderScale(mRenderScale);
+    } else {
+        setViewport(width, height);
+    }
 
     if (!mOpaque) {
         clearColorBuffer(repaintRect);
@@ -155,6 +170,10 @@ void BakedOpRenderer::endFrame(const Rect& repaintRect) {
         mRenderState.stencil().disable();
     }
 
+    if (CC_UNLIKELY(mRenderScale != 1.0f)) {
+        mRenderState.scissor().setRenderScale(1.0f);
+    }
+
     // Note: we leave FBO 0 renderable here, for post-frame-content decoration
 }
 
@@ -261,10 +280,8 @@ void BakedOpRenderer::setupStencilRectList(const ClipBase* clip) {
         rectangleVertices.push_back(Vertex{bounds.right, bounds.bottom});
 
         if (!transform.rectToRect()) {
-            // If not rectToRect, must map each point individually
-            for (auto cur = rectangleVertices.end() - 4; cur < rectangleVertices.end(); cur++) {
-                transform.mapPoint(cur->x, cur->y);
-            }
+            // If not rectToRect, must map the corner points individually
+            transform.mapPoints(&*(rectangleVertices.end() - 4), 4);
         }
     }
     setupStencilQuads(rectangleVertices, rectList.getTransformedRectanglesCount());
@@ -306,9 +323,15 @@ void BakedOpRenderer::prepareRender(const Rect* dirtyBounds, const ClipBase* cli
 
                 if (mRenderTarget.frameBufferId != 0 && !mRenderTarget.stencil) {
                     OffscreenBuffer* layer = mRenderTarget.offscreenBuffer;
-                    mRenderTarget.stencil = mCaches.renderBufferCache.get(
-                            Stencil::getLayerStencilFormat(), layer->texture.width(),
-                            layer->texture.height());
+                    if (layer->stencil) {
+                        // the layer kept its stencil from an earlier pass
+                        mRenderTarget.stencil = layer->stencil;
+                        layer->stencil = nullptr;
+                    } else {
+                        mRenderTarget.stencil = mCaches.renderBufferCache.get(
+                                Stencil::getLayerStencilFormat(), layer->texture.width(),
+                                layer->texture.height());
+                    }
                     // stencil is bound + allocated - associate it with current FBO
                     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT,
                                               GL_RENDERBUFFER, mRenderTarget.stencil->getName());
@@ -64,6 +64,15 @@ public:
     RenderState& renderState() { return mRenderState; }
     Caches& caches() { return mCaches; }
 
+    /**
+     * Sets the scale between the logical frame size ops were recorded against
+     * and the actual buffer backing fbo0. Applied by startFrame: the ortho
+     * projection stays logical while the GL viewport and scissor rects are
+     * scaled down, so the rasterizer shrinks the content into the buffer.
+     * Offscreen layers are unaffected.
+     */
+    void setRenderScale(float renderScale) { mRenderScale = renderScale; }
+
     void startFrame(uint32_t width, uint32_t height, const Rect& repaintRect);
     void endFrame(const Rect& repaintRect);
     WARN_UNUSED_RESULT OffscreenBuffer* startTemporaryLayer(uint32_t width, uint32_t height);
@@ -118,6 +127,7 @@ private:
     bool mOpaque;
     bool mWideColorGamut;
     bool mHasDrawn = false;
+    float mRenderScale = 1.0f;
 
     // render target state - setup by start/end layer/frame
     // only valid to use in between start/end pairs.
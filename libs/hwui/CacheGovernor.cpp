@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CacheGovernor.h"
+
+#include "Caches.h"
+
+#include <algorithm>
+
+namespace android {
+namespace uirenderer {
+
+// How many frames to let lookups accumulate between rebalances. At 60fps this
+// revisits the split every couple of seconds, fast enough to follow a content
+// change but too slow for a single busy frame to swing the budgets.
+static const uint32_t kRebalanceFrameInterval = 120;
+
+// Don't rebalance on fewer lookups than this; the miss rates would be noise.
+// This also keeps the governor inert under the Skia pipelines, which create
+// Caches for the GL context but never populate these caches.
+static const uint32_t kMinLookupsPerWindow = 64;
+
+// Each cache always keeps at least this fraction of its static size, so a
+// temporarily idle cache doesn't have to refill from nothing when its
+// workload returns.
+static const uint32_t kFloorDivider = 4;
+
+CacheGovernor::CacheGovernor(Caches& caches) : mCaches(caches) {
+    mBaseSize[0] = caches.textureCache.getMaxSize();
+    mBaseSize[1] = caches.pathCache.getMaxSize();
+    mBaseSize[2] = caches.tessellationCache.getMaxSize();
+    for (int i = 0; i < kGovernedCacheCount; i++) {
+        mBudget[i] = mBaseSize[i];
+    }
+}
+
+size_t CacheGovernor::totalBudget() const {
+    size_t total = 0;
+    for (int i = 0; i < kGovernedCacheCount; i++) {
+        total += mBudget[i];
+    }
+    return total;
+}
+
+void CacheGovernor::onFrameCompleted() {
+    if (++mFramesSinceRebalance >= kRebalanceFrameInterval) {
+        rebalance();
+        mFramesSinceRebalance = 0;
+    }
+}
+
+void CacheGovernor::setMemoryCeiling(size_t ceilingBytes) {
+    if (ceilingBytes == mMemoryCeiling) return;
+    mMemoryCeiling = ceilingBytes;
+    // Apply the new ceiling right away rather than waiting out the window;
+    // shrinking is the case the caller cares about.
+    rebalance();
+    mFramesSinceRebalance = 0;
+}
+
+void CacheGovernor::rebalance() {
+    const uint32_t hits[kGovernedCacheCount] = {
+            mCaches.textureCache.hitCount(),
+            mCaches.pathCache.hitCount(),
+            mCaches.tessellationCache.hitCount(),
+    };
+    const uint32_t misses[kGovernedCacheCount] = {
+            mCaches.textureCache.missCount(),
+            mCaches.pathCache.missCount(),
+            mCaches.tessellationCache.missCount(),
+    };
+
+    size_t total = 0;
+    uint32_t lookups = 0;
+    for (int i = 0; i < kGovernedCacheCount; i++) {
+        total += mBaseSize[i];
+        lookups += hits[i] + misses[i];
+    }
+    if (mMemoryCeiling) {
+        total = std::min(total, mMemoryCeiling);
+    }
+
+    // Too little traffic to trust the miss rates; keep accumulating. Still
+    // honor a ceiling change, which must not wait for rendering to pick up.
+    if (lookups < kMinLookupsPerWindow && total >= totalBudget()) {
+        return;
+    }
+
+    // Every cache keeps a floor; the remaining pool is split proportionally
+    // to each cache's static size scaled by its miss rate, so a cache
+    // missing on every lookup can claim up to 4x the weight of one that
+    // never misses.
+    size_t floors = 0;
+    float weights[kGovernedCacheCount];
+    float totalWeight = 0;
+    for (int i = 0; i < kGovernedCacheCount; i++) {
+        floors += mBaseSize[i] / kFloorDivider;
+        float missRate = 0;
+        if (hits[i] + misses[i] > 0) {
+            missRate = misses[i] / float(hits[i] + misses[i]);
+        }
+        weights[i] = mBaseSize[i] * (1.0f + 3.0f * missRate);
+        totalWeight += weights[i];
+    }
+
+    const size_t pool = total > floors ? total - floors : 0;
+    for (int i = 0; i < kGovernedCacheCount; i++) {
+        uint32_t target = mBaseSize[i] / kFloorDivider +
+                          uint32_t(pool * (weights[i] / totalWeight));
+        // Shrink immediately so a ceiling takes effect this frame, but only
+        // grow halfway to the target to keep the budgets from oscillating
+        // when the workload alternates between cache types.
+        mBudget[i] = target < mBudget[i] ? target : (mBudget[i] + target) / 2;
+    }
+
+    mCaches.textureCache.setMaxSize(mBudget[0]);
+    mCaches.pathCache.setMaxSize(mBudget[1]);
+    mCaches.tessellationCache.setMaxSize(mBudget[2]);
+
+    mCaches.textureCache.resetHitStats();
+    mCaches.pathCache.resetHitStats();
+    mCaches.tessellationCache.resetHitStats();
+}
+
+};  // namespace uirenderer
+};  // namespace android
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace android {
+namespace uirenderer {
+
+class Caches;
+
+/**
+ * Dynamically rebalances the byte budgets of the LRU caches owned by Caches.
+ *
+ * Each governed cache starts at its statically configured size, but the split
+ * is revisited every few seconds of rendering: caches that miss often grow at
+ * the expense of caches sitting on cold entries, while the combined budget
+ * never exceeds the sum of the static sizes. A workload that churns through
+ * bitmaps therefore gets texture memory that an idle path cache would
+ * otherwise pin, and vice versa.
+ *
+ * The total budget can additionally be capped with setMemoryCeiling(), in
+ * which case every cache shrinks proportionally before the miss-rate
+ * rebalancing applies.
+ *
+ * All methods must be called on the thread owning the GL context.
+ */
+class CacheGovernor {
+public:
+    /**
+     * Number of caches whose budgets are governed. The glyph and gradient
+     * caches are excluded: their backing textures are not individually
+     * evictable, so their limits cannot shrink without a full clear.
+     */
+    static constexpr int kGovernedCacheCount = 3;
+
+    explicit CacheGovernor(Caches& caches);
+
+    /**
+     * Called once per completed frame; rebalances the cache budgets when
+     * enough lookups have accumulated since the previous rebalance.
+     */
+    void onFrameCompleted();
+
+    /**
+     * Caps the combined size of the governed caches. Pass 0 to remove the
+     * cap and return to the statically configured budgets.
+     */
+    void setMemoryCeiling(size_t ceilingBytes);
+
+    /**
+     * Returns the combined budget currently distributed across the governed
+     * caches, in bytes.
+     */
+    size_t totalBudget() const;
+
+private:
+    void rebalance();
+
+    Caches& mCaches;
+
+    // Statically configured size of each cache, captured at construction
+    uint32_t mBaseSize[kGovernedCacheCount];
+    // Budget currently assigned to each cache
+    uint32_t mBudget[kGovernedCacheCount];
+
+    size_t mMemoryCeiling = 0;
+    uint32_t mFramesSinceRebalance = 0;
+};  // class CacheGovernor
+
+};  // namespace uirenderer
+};  // namespace android
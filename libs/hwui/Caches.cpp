@@ -53,6 +53,8 @@ Caches::Caches(RenderState& renderState)
         : gradientCache(extensions())
         , patchCache(renderState)
         , programCache(extensions())
+        , shadowBlur(renderState)
+        , cacheGovernor(*this)
         , mRenderState(&renderState)
         , mInitialized(false) {
     INIT_LOGD("Creating OpenGL renderer caches");
@@ -108,6 +110,8 @@ void Caches::terminate() {
 
     fboCache.clear();
 
+    shadowBlur.terminate();
+
     programCache.clear();
     mProgram = nullptr;
 
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include "CacheGovernor.h"
 #include "DeviceInfo.h"
 #include "Extensions.h"
 #include "FboCache.h"
 #include "GammaFontRenderer.h"
+#include "GlShadowBlur.h"
 #include "GradientCache.h"
 #include "PatchCache.h"
 #include "PathCache.h"
@@ -151,9 +153,14 @@ public:
     TessellationCache tessellationCache;
     TextDropShadowCache dropShadowCache;
     FboCache fboCache;
+    GlShadowBlur shadowBlur;
 
     GammaFontRenderer fontRenderer;
 
+    // Declared after the caches it governs so their limits exist when it
+    // captures them
+    CacheGovernor cacheGovernor;
+
     TaskManager tasks;
 
     bool gpuPixelBuffersEnabled;
@@ -22,19 +22,17 @@ namespace android {
 namespace uirenderer {
 
 CanvasState::CanvasState(CanvasStateClient& renderer)
-        : mWidth(-1), mHeight(-1), mSaveCount(1), mCanvas(renderer), mSnapshot(&mFirstSnapshot) {}
+        : mWidth(-1)
+        , mHeight(-1)
+        , mSaveCount(1)
+        , mCanvas(renderer)
+        , mSnapshot(&mFirstSnapshot)
+        , mSnapshotAllocator(std::make_unique<LinearAllocator>()) {}
 
 CanvasState::~CanvasState() {
-    // First call freeSnapshot on all but mFirstSnapshot
-    // to invoke all the dtors
+    // Run the dtors on all but mFirstSnapshot; the allocator releases
+    // the backing pages when it is destroyed.
     freeAllSnapshots();
-
-    // Now actually release the memory
-    while (mSnapshotPool) {
-        void* temp = mSnapshotPool;
-        mSnapshotPool = mSnapshotPool->previous;
-        free(temp);
-    }
 }
 
 void CanvasState::initializeRecordingSaveStack(int viewportWidth, int viewportHeight) {
@@ -46,6 +44,7 @@ void CanvasState::initializeRecordingSaveStack(int viewportWidth, int viewportHe
     }
 
     freeAllSnapshots();
+    mSnapshotAllocator = std::make_unique<LinearAllocator>();
     mSnapshot = allocSnapshot(&mFirstSnapshot, SaveFlags::MatrixClip);
     mSnapshot->setRelativeLightCenter(Vector3());
     mSaveCount = 1;
@@ -62,6 +61,7 @@ void CanvasState::initializeSaveStack(int viewportWidth, int viewportHeight, flo
     }
 
     freeAllSnapshots();
+    mSnapshotAllocator = std::make_unique<LinearAllocator>();
     mSnapshot = allocSnapshot(&mFirstSnapshot, SaveFlags::MatrixClip);
     mSnapshot->setClip(clipLeft, clipTop, clipRight, clipBottom);
     mSnapshot->fbo = mCanvas.getTargetFbo();
@@ -70,27 +70,13 @@ void CanvasState::initializeSaveStack(int viewportWidth, int viewportHeight, flo
 }
 
 Snapshot* CanvasState::allocSnapshot(Snapshot* previous, int savecount) {
-    void* memory;
-    if (mSnapshotPool) {
-        memory = mSnapshotPool;
-        mSnapshotPool = mSnapshotPool->previous;
-        mSnapshotPoolCount--;
-    } else {
-        memory = malloc(sizeof(Snapshot));
-    }
-    return new (memory) Snapshot(previous, savecount);
+    return mSnapshotAllocator->create<Snapshot>(previous, savecount);
 }
 
 void CanvasState::freeSnapshot(Snapshot* snapshot) {
-    snapshot->~Snapshot();
-    // Arbitrary number, just don't let this grown unbounded
-    if (mSnapshotPoolCount > 10) {
-        free((void*)snapshot);
-    } else {
-        snapshot->previous = mSnapshotPool;
-        mSnapshotPool = snapshot;
-        mSnapshotPoolCount++;
-    }
+    // Snapshots are freed in LIFO order, so this runs the dtor and gives
+    // the storage straight back to the bump allocator.
+    mSnapshotAllocator->rewindIfLastAlloc(snapshot);
 }
 
 void CanvasState::freeAllSnapshots() {
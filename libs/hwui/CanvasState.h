@@ -17,12 +17,15 @@
 #pragma once
 
 #include "Snapshot.h"
+#include "utils/LinearAllocator.h"
 
 #include <SkClipOp.h>
 #include <SkMatrix.h>
 #include <SkPath.h>
 #include <SkRegion.h>
 
+#include <memory>
+
 namespace android {
 namespace uirenderer {
 
@@ -184,10 +187,12 @@ private:
     /// Current state
     Snapshot* mSnapshot;
 
-    // Pool of allocated snapshots to re-use
-    // NOTE: The dtors have already been invoked!
-    Snapshot* mSnapshotPool = nullptr;
-    int mSnapshotPoolCount = 0;
+    // Bump allocator backing the snapshot stack. save/restore is strictly
+    // LIFO, so every free rewinds the allocator and steady state stays in
+    // the first page; the allocator is swapped for a fresh one when the
+    // save stack is re-initialized at the start of a frame, returning its
+    // pages to the shared page pool.
+    std::unique_ptr<LinearAllocator> mSnapshotAllocator;
 
 };  // class CanvasState
 
@@ -18,26 +18,21 @@
 #include "utils/LinearAllocator.h"
 
 #include <SkPath.h>
-#include <limits>
 #include <type_traits>
 
 namespace android {
 namespace uirenderer {
 
-static void handlePoint(Rect& transformedBounds, const Matrix4& transform, float x, float y) {
-    Vertex v = {x, y};
-    transform.mapPoint(v.x, v.y);
-    transformedBounds.expandToCover(v.x, v.y);
-}
-
 Rect transformAndCalculateBounds(const Rect& r, const Matrix4& transform) {
-    const float kMinFloat = std::numeric_limits<float>::lowest();
-    const float kMaxFloat = std::numeric_limits<float>::max();
-    Rect transformedBounds = {kMaxFloat, kMaxFloat, kMinFloat, kMinFloat};
-    handlePoint(transformedBounds, transform, r.left, r.top);
-    handlePoint(transformedBounds, transform, r.right, r.top);
-    handlePoint(transformedBounds, transform, r.left, r.bottom);
-    handlePoint(transformedBounds, transform, r.right, r.bottom);
+    // Map all four corners in a single call so that simple transforms can
+    // take the batched, vectorized Matrix4::mapPoints() path
+    Vertex corners[4] = {
+            {r.left, r.top}, {r.right, r.top}, {r.left, r.bottom}, {r.right, r.bottom}};
+    transform.mapPoints(corners, 4);
+    Rect transformedBounds = {corners[0].x, corners[0].y, corners[0].x, corners[0].y};
+    for (int i = 1; i < 4; i++) {
+        transformedBounds.expandToCover(corners[i].x, corners[i].y);
+    }
     return transformedBounds;
 }
 
@@ -153,13 +148,20 @@ SkRegion RectangleList::convertToRegion(const SkRegion& clip) const {
     SkRegion rectangleListAsRegion;
     for (int index = 0; index < mTransformedRectanglesCount; index++) {
         const TransformedRectangle& tr(mTransformedRectangles[index]);
-        SkPath rectPathTransformed =
-                pathFromTransformedRectangle(tr.getBounds(), tr.getTransform());
-        if (index == 0) {
-            rectangleListAsRegion.setPath(rectPathTransformed, clip);
+        SkRegion rectRegion;
+        if (CC_LIKELY(tr.getTransform().rectToRect())) {
+            // simple transform, skip creating and scan converting an SkPath
+            Rect transformed(tr.getBounds());
+            tr.getTransform().mapRect(transformed);
+            rectRegion.op(transformed.toSkIRect(), clip, SkRegion::kIntersect_Op);
         } else {
-            SkRegion rectRegion;
+            SkPath rectPathTransformed =
+                    pathFromTransformedRectangle(tr.getBounds(), tr.getTransform());
             rectRegion.setPath(rectPathTransformed, clip);
+        }
+        if (index == 0) {
+            rectangleListAsRegion.swap(rectRegion);
+        } else {
             rectangleListAsRegion.op(rectRegion, SkRegion::kIntersect_Op);
         }
     }
@@ -318,9 +320,17 @@ void ClipArea::enterRegionMode() {
 
 void ClipArea::regionModeClipRectWithTransform(const Rect& r, const mat4* transform,
                                                SkRegion::Op op) {
-    SkPath transformedRect = pathFromTransformedRectangle(r, *transform);
     SkRegion transformedRectRegion;
-    regionFromPath(transformedRect, transformedRectRegion);
+    if (CC_LIKELY(transform->rectToRect())) {
+        // simple transform, skip creating and scan converting an SkPath
+        Rect transformed(r);
+        transform->mapRect(transformed);
+        transformedRectRegion.op(transformed.toSkIRect(), createViewportRegion(),
+                                 SkRegion::kIntersect_Op);
+    } else {
+        SkPath transformedRect = pathFromTransformedRectangle(r, *transform);
+        regionFromPath(transformedRect, transformedRectRegion);
+    }
     mClipRegion.op(transformedRectRegion, op);
     onClipRegionUpdated();
 }
@@ -40,6 +40,17 @@ struct DirtyStack {
     // When this frame is pop'd, this rect is mapped through the above transform
     // and applied to the previous (aka parent) frame
     SkRect pendingDirty;
+    // The individual rects making up pendingDirty, so damage that lands in
+    // distinct areas is not smeared into one bounding box on the way up. A
+    // count of 0 with a non-empty pendingDirty means tracking collapsed to
+    // the union (too many rects, or a case rects cannot represent).
+    SkRect dirtyRects[DamageAccumulator::kMaxDamageRects];
+    size_t dirtyRectCount;
+    // World transform accumulated from the root down to and including this
+    // frame, filled in lazily by computeCurrentTransform() and reused until
+    // the frame is recycled by the next push
+    Matrix4 worldTransform;
+    bool worldTransformValid;
     DirtyStack* prev;
     DirtyStack* next;
 };
@@ -50,18 +61,22 @@ DamageAccumulator::DamageAccumulator() {
     // Create a root that we will not pop off
     mHead->prev = mHead;
     mHead->type = TransformNone;
+    // The root is never pushed again, so its transform is always identity
+    mHead->worldTransform.loadIdentity();
+    mHead->worldTransformValid = true;
 }
 
-static void computeTransformImpl(const DirtyStack* currentFrame, Matrix4* outMatrix) {
-    if (currentFrame->prev != currentFrame) {
-        computeTransformImpl(currentFrame->prev, outMatrix);
+static const Matrix4* computeWorldTransform(DirtyStack* currentFrame) {
+    if (currentFrame->worldTransformValid) {
+        return &currentFrame->worldTransform;
     }
+    currentFrame->worldTransform = *computeWorldTransform(currentFrame->prev);
     switch (currentFrame->type) {
         case TransformRenderNode:
-            currentFrame->renderNode->applyViewPropertyTransforms(*outMatrix);
+            currentFrame->renderNode->applyViewPropertyTransforms(currentFrame->worldTransform);
             break;
         case TransformMatrix4:
-            outMatrix->multiply(*currentFrame->matrix4);
+            currentFrame->worldTransform.multiply(*currentFrame->matrix4);
             break;
         case TransformNone:
             // nothing to be done
@@ -70,11 +85,30 @@ static void computeTransformImpl(const DirtyStack* currentFrame, Matrix4* outMat
             LOG_ALWAYS_FATAL("Tried to compute transform with an invalid type: %d",
                              currentFrame->type);
     }
+    currentFrame->worldTransformValid = true;
+    return &currentFrame->worldTransform;
 }
 
 void DamageAccumulator::computeCurrentTransform(Matrix4* outMatrix) const {
-    outMatrix->loadIdentity();
-    computeTransformImpl(mHead, outMatrix);
+    // Recursion terminates at the nearest ancestor frame with a cached
+    // transform, so repeated queries (layers, position listeners) only pay
+    // for the frames pushed since the last one
+    *outMatrix = *computeWorldTransform(mHead);
+}
+
+// Joins rect into the frame's dirty area, tracking it in the frame's rect
+// list while the list can still exactly cover pendingDirty
+static void joinDirty(DirtyStack* frame, const SkRect& rect) {
+    if (rect.isEmpty()) return;
+    const bool collapsed = !frame->pendingDirty.isEmpty() && frame->dirtyRectCount == 0;
+    frame->pendingDirty.join(rect);
+    if (collapsed) return;
+    if (frame->dirtyRectCount >= DamageAccumulator::kMaxDamageRects) {
+        // Too fragmented to be worth tracking precisely; fall back to the union
+        frame->dirtyRectCount = 0;
+        return;
+    }
+    frame->dirtyRects[frame->dirtyRectCount++] = rect;
 }
 
 void DamageAccumulator::pushCommon() {
@@ -86,6 +120,8 @@ void DamageAccumulator::pushCommon() {
     }
     mHead = mHead->next;
     mHead->pendingDirty.setEmpty();
+    mHead->dirtyRectCount = 0;
+    mHead->worldTransformValid = false;
 }
 
 void DamageAccumulator::pushTransform(const RenderNode* transform) {
@@ -112,7 +148,13 @@ void DamageAccumulator::popTransform() {
             applyMatrix4Transform(dirtyFrame);
             break;
         case TransformNone:
-            mHead->pendingDirty.join(dirtyFrame->pendingDirty);
+            if (dirtyFrame->dirtyRectCount > 0) {
+                for (size_t i = 0; i < dirtyFrame->dirtyRectCount; i++) {
+                    joinDirty(mHead, dirtyFrame->dirtyRects[i]);
+                }
+            } else {
+                joinDirty(mHead, dirtyFrame->pendingDirty);
+            }
             break;
         default:
             LOG_ALWAYS_FATAL("Tried to pop an invalid type: %d", dirtyFrame->type);
@@ -134,7 +176,17 @@ static inline void mapRect(const Matrix4* matrix, const SkRect& in, SkRect* out)
 }
 
 void DamageAccumulator::applyMatrix4Transform(DirtyStack* frame) {
-    mapRect(frame->matrix4, frame->pendingDirty, &mHead->pendingDirty);
+    if (frame->dirtyRectCount > 0) {
+        for (size_t i = 0; i < frame->dirtyRectCount; i++) {
+            SkRect mapped = SkRect::MakeEmpty();
+            mapRect(frame->matrix4, frame->dirtyRects[i], &mapped);
+            joinDirty(mHead, mapped);
+        }
+    } else {
+        SkRect mapped = SkRect::MakeEmpty();
+        mapRect(frame->matrix4, frame->pendingDirty, &mapped);
+        joinDirty(mHead, mapped);
+    }
 }
 
 static inline void mapRect(const RenderProperties& props, const SkRect& in, SkRect* out) {
@@ -199,15 +251,38 @@ void DamageAccumulator::applyRenderNodeTransform(DirtyStack* frame) {
         return;
     }
 
+    // Projected damage ends up in an unrelated frame, which the rect list
+    // cannot represent; collapse to the union for this subtree
+    if (props.getProjectBackwards()) {
+        frame->dirtyRectCount = 0;
+    }
+
     // Perform clipping
     if (props.getClipDamageToBounds() && !frame->pendingDirty.isEmpty()) {
         if (!frame->pendingDirty.intersect(0, 0, props.getWidth(), props.getHeight())) {
             frame->pendingDirty.setEmpty();
         }
+        size_t kept = 0;
+        for (size_t i = 0; i < frame->dirtyRectCount; i++) {
+            if (frame->dirtyRects[i].intersect(0, 0, props.getWidth(), props.getHeight())) {
+                frame->dirtyRects[kept++] = frame->dirtyRects[i];
+            }
+        }
+        frame->dirtyRectCount = kept;
     }
 
     // apply all transforms
-    mapRect(props, frame->pendingDirty, &mHead->pendingDirty);
+    if (frame->dirtyRectCount > 0) {
+        for (size_t i = 0; i < frame->dirtyRectCount; i++) {
+            SkRect mapped = SkRect::MakeEmpty();
+            mapRect(props, frame->dirtyRects[i], &mapped);
+            joinDirty(mHead, mapped);
+        }
+    } else {
+        SkRect mapped = SkRect::MakeEmpty();
+        mapRect(props, frame->pendingDirty, &mapped);
+        joinDirty(mHead, mapped);
+    }
 
     // project backwards if necessary
     if (props.getProjectBackwards() && !frame->pendingDirty.isEmpty()) {
@@ -225,20 +300,29 @@ void DamageAccumulator::applyRenderNodeTransform(DirtyStack* frame) {
 }
 
 void DamageAccumulator::dirty(float left, float top, float right, float bottom) {
-    mHead->pendingDirty.join(left, top, right, bottom);
+    joinDirty(mHead, SkRect::MakeLTRB(left, top, right, bottom));
 }
 
 void DamageAccumulator::peekAtDirty(SkRect* dest) const {
     *dest = mHead->pendingDirty;
 }
 
-void DamageAccumulator::finish(SkRect* totalDirty) {
+void DamageAccumulator::finish(SkRect* totalDirty, std::vector<SkRect>* outRects) {
     LOG_ALWAYS_FATAL_IF(mHead->prev != mHead, "Cannot finish, mismatched push/pop calls! %p vs. %p",
                         mHead->prev, mHead);
     // Root node never has a transform, so this is the fully mapped dirty rect
     *totalDirty = mHead->pendingDirty;
     totalDirty->roundOut(totalDirty);
+    if (outRects) {
+        outRects->clear();
+        for (size_t i = 0; i < mHead->dirtyRectCount; i++) {
+            SkRect rect = mHead->dirtyRects[i];
+            rect.roundOut(&rect);
+            outRects->push_back(rect);
+        }
+    }
     mHead->pendingDirty.setEmpty();
+    mHead->dirtyRectCount = 0;
 }
 
 } /* namespace uirenderer */
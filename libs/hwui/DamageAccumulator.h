@@ -22,6 +22,8 @@
 #include <SkMatrix.h>
 #include <SkRect.h>
 
+#include <vector>
+
 #include "utils/Macros.h"
 
 // Smaller than INT_MIN/INT_MAX because we offset these values
@@ -40,6 +42,10 @@ class DamageAccumulator {
     PREVENT_COPY_AND_ASSIGN(DamageAccumulator);
 
 public:
+    // Most rects a frame's damage is tracked as before collapsing to the
+    // bounding union; also bounds the rect count handed to EGL
+    static constexpr size_t kMaxDamageRects = 10;
+
     DamageAccumulator();
     // mAllocator will clean everything up for us, no need for a dtor
 
@@ -60,7 +66,11 @@ public:
 
     ANDROID_API void computeCurrentTransform(Matrix4* outMatrix) const;
 
-    void finish(SkRect* totalDirty);
+    // If outRects is non-null it receives the individual damage rects that
+    // were accumulated at the root, in the same space as totalDirty. The list
+    // is capped at kMaxDamageRects; when damage was too fragmented the list
+    // collapses to the running union, so the rects always cover totalDirty.
+    void finish(SkRect* totalDirty, std::vector<SkRect>* outRects = nullptr);
 
 private:
     void pushCommon();
@@ -74,10 +74,40 @@ void DeferredLayerUpdater::setPaint(const SkPaint* paint) {
 }
 
 void DeferredLayerUpdater::apply() {
+    acquireFrame();
+    applyAcquired();
+}
+
+void DeferredLayerUpdater::applyAll(const std::vector<sp<DeferredLayerUpdater>>& layers) {
+    // Latch every SurfaceTexture first so the buffer fence waits are queued
+    // back to back, then push the latched state into the backing layers.
+    for (const auto& layer : layers) {
+        layer->acquireFrame();
+    }
+    for (const auto& layer : layers) {
+        layer->applyAcquired();
+    }
+}
+
+void DeferredLayerUpdater::acquireFrame() {
     if (!mLayer) {
         mLayer = mCreateLayerFn(mRenderState, mWidth, mHeight, mColorFilter, mAlpha, mMode, mBlend);
     }
 
+    if (mSurfaceTexture.get() && mLayer->getApi() == Layer::Api::OpenGL) {
+        if (!mGLContextAttached) {
+            mGLContextAttached = true;
+            mUpdateTexImage = true;
+            mSurfaceTexture->attachToContext(static_cast<GlLayer*>(mLayer)->getTextureId());
+        }
+        if (mUpdateTexImage) {
+            mUpdateTexImage = false;
+            doUpdateTexImage();
+        }
+    }
+}
+
+void DeferredLayerUpdater::applyAcquired() {
     mLayer->setColorFilter(mColorFilter);
     mLayer->setAlpha(mAlpha, mMode);
 
@@ -91,14 +121,10 @@ void DeferredLayerUpdater::apply() {
             LOG_ALWAYS_FATAL_IF(mLayer->getApi() != Layer::Api::OpenGL,
                                 "apply surfaceTexture with non GL backend %x, GL %x, VK %x",
                                 mLayer->getApi(), Layer::Api::OpenGL, Layer::Api::Vulkan);
-            if (!mGLContextAttached) {
-                mGLContextAttached = true;
-                mUpdateTexImage = true;
-                mSurfaceTexture->attachToContext(static_cast<GlLayer*>(mLayer)->getTextureId());
-            }
-            if (mUpdateTexImage) {
-                mUpdateTexImage = false;
-                doUpdateTexImage();
+            if (mFrameAcquired) {
+                mFrameAcquired = false;
+                updateLayer(mAcquiredForceFilter, mAcquiredTexTransform,
+                            mSurfaceTexture->getCurrentDataSpace());
             }
             GLenum renderTarget = mSurfaceTexture->getCurrentTextureTarget();
             static_cast<GlLayer*>(mLayer)->setRenderTarget(renderTarget);
@@ -115,8 +141,6 @@ void DeferredLayerUpdater::doUpdateTexImage() {
                         "doUpdateTexImage non GL backend %x, GL %x, VK %x", mLayer->getApi(),
                         Layer::Api::OpenGL, Layer::Api::Vulkan);
     if (mSurfaceTexture->updateTexImage() == NO_ERROR) {
-        float transform[16];
-
         int64_t frameNumber = mSurfaceTexture->getFrameNumber();
         // If the GLConsumer queue is in synchronous mode, need to discard all
         // but latest frame, using the frame number to tell when we no longer
@@ -144,9 +168,12 @@ void DeferredLayerUpdater::doUpdateTexImage() {
             RENDERER_LOGD("Dropped %d frames on texture layer update", dropCounter);
         }
 #endif
-        mSurfaceTexture->getTransformMatrix(transform);
+        mSurfaceTexture->getTransformMatrix(mAcquiredTexTransform);
 
-        updateLayer(forceFilter, transform, mSurfaceTexture->getCurrentDataSpace());
+        // The layer state update happens in applyAcquired() so that a batched
+        // pass can latch all the SurfaceTextures before touching any layer
+        mAcquiredForceFilter = forceFilter;
+        mFrameAcquired = true;
     }
 }
 
@@ -26,6 +26,8 @@
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 
+#include <vector>
+
 #include "Layer.h"
 #include "Rect.h"
 #include "renderthread/RenderThread.h"
@@ -93,6 +95,15 @@ public:
 
     void apply();
 
+    /**
+     * Applies a set of layer updates in one batched pass: first latches the
+     * most recent SurfaceTexture frame for every layer, then pushes the
+     * latched state into the backing layers. Latching back to back queues
+     * all the buffer fence waits together instead of interleaving them with
+     * layer state updates.
+     */
+    static void applyAll(const std::vector<sp<DeferredLayerUpdater>>& layers);
+
     Layer* backingLayer() { return mLayer; }
 
     void detachSurfaceTexture();
@@ -122,6 +133,14 @@ private:
     Layer::Api mLayerApi;
     CreateLayerFn mCreateLayerFn;
 
+    // State latched by acquireFrame(), consumed by applyAcquired()
+    bool mFrameAcquired = false;
+    bool mAcquiredForceFilter = false;
+    float mAcquiredTexTransform[16];
+
+    void acquireFrame();
+    void applyAcquired();
+
     void doUpdateTexImage();
     void doUpdateVkTexImage();
 };
@@ -109,11 +109,20 @@ public:
 
     void ref(VirtualLightRefBase* prop) { referenceHolders.push_back(prop); }
 
+    /**
+     * Fingerprint of the recorded op stream, accumulated at record time, or 0
+     * when the recording pipeline doesn't compute one. Two display lists with
+     * the same non-zero fingerprint render identically, so sync can keep the
+     * current list when a re-recording didn't change anything.
+     */
+    uint64_t getContentFingerprint() const { return mContentFingerprint; }
+
     size_t getUsedSize() { return allocator.usedSize(); }
 
     virtual bool isEmpty() const { return ops.empty(); }
     virtual bool hasFunctor() const { return !functors.empty(); }
     virtual bool hasVectorDrawables() const { return !vectorDrawables.empty(); }
+    virtual bool hasAnimatedImages() const { return false; }
     virtual bool isSkiaDL() const { return false; }
     virtual bool reuseDisplayList(RenderNode* node, renderthread::CanvasContext* context) {
         return false;
@@ -150,6 +159,8 @@ private:
     // List of functors
     LsaVector<FunctorContainer> functors;
 
+    uint64_t mContentFingerprint = 0;
+
     // List of VectorDrawables that need to be notified of pushStaging. Note that this list gets
     // nothing
     // but a callback during sync DisplayList, unlike the list of functors defined above, which
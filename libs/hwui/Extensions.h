@@ -36,6 +36,7 @@ public:
     inline bool has4BitStencil() const { return mHas4BitStencil; }
     inline bool hasUnpackRowLength() const { return mVersionMajor >= 3 || mHasUnpackSubImage; }
     inline bool hasPixelBufferObjects() const { return mVersionMajor >= 3; }
+    inline bool hasBufferStorage() const { return mHasBufferStorage; }
     inline bool hasOcclusionQueries() const { return mVersionMajor >= 3; }
     inline bool hasFloatTextures() const { return mVersionMajor >= 3; }
     inline bool hasRenderableFloatTextures() const {
@@ -56,6 +57,7 @@ private:
     bool mHas1BitStencil;
     bool mHas4BitStencil;
     bool mHasUnpackSubImage;
+    bool mHasBufferStorage;
     bool mHasSRGB;
     bool mHasSRGBWriteControl;
     bool mHasLinearBlending;
@@ -27,7 +27,12 @@ namespace uirenderer {
 // Constructors/destructor
 ///////////////////////////////////////////////////////////////////////////////
 
-FboCache::FboCache() : mMaxSize(0) {}
+// FBO names are cheap driver-side objects; keep enough of them warm to
+// cover deeply nested saveLayers without ever hitting glGenFramebuffers
+// in steady state.
+#define DEFAULT_FBO_CACHE_SIZE 32
+
+FboCache::FboCache() : mMaxSize(DEFAULT_FBO_CACHE_SIZE) {}
 
 FboCache::~FboCache() {
     clear();
@@ -34,6 +34,7 @@
 #include <RenderScript.h>
 #include <SkGlyph.h>
 #include <SkUtils.h>
+#include <cutils/compiler.h>
 #include <utils/Log.h>
 #include <algorithm>
 
@@ -92,7 +93,8 @@ FontRenderer::FontRenderer(const uint8_t* gammaTable)
         , mBounds(nullptr)
         , mDrawn(false)
         , mInitialized(false)
-        , mLinearFiltering(false) {
+        , mLinearFiltering(false)
+        , mNeedsHotGlyphRestore(false) {
     if (sLogFontRendererCreate) {
         INIT_LOGD("Creating FontRenderer");
     }
@@ -166,6 +168,7 @@ void FontRenderer::flushAllAndInvalidate() {
     }
 
     mDrawn = false;
+    mNeedsHotGlyphRestore = true;
 }
 
 void FontRenderer::flushLargeCaches(std::vector<CacheTexture*>& cacheTextures) {
@@ -189,6 +192,20 @@ void FontRenderer::flushLargeCaches(std::vector<CacheTexture*>& cacheTextures) {
 void FontRenderer::flushLargeCaches() {
     flushLargeCaches(mACacheTextures);
     flushLargeCaches(mRGBACacheTextures);
+    mNeedsHotGlyphRestore = true;
+}
+
+// Budget for speculatively re-rasterized glyphs; sized so the restored set
+// fits comfortably in the small cache texture that survives flushes
+static constexpr uint32_t kHotGlyphRestoreBudget = 128;
+static constexpr uint32_t kHotGlyphsPerFont = 64;
+
+void FontRenderer::restoreHotGlyphs() {
+    uint32_t budget = kHotGlyphRestoreBudget;
+    LruCache<Font::FontDescription, Font*>::Iterator it(mActiveFonts);
+    while (budget > 0 && it.next()) {
+        budget -= it.value()->precacheHotGlyphs(std::min(budget, kHotGlyphsPerFont));
+    }
 }
 
 CacheTexture* FontRenderer::cacheBitmapInTexture(std::vector<CacheTexture*>& cacheTextures,
@@ -555,7 +572,7 @@ void FontRenderer::setFont(const SkPaint* paint, const SkMatrix& matrix) {
 
 FontRenderer::DropShadow FontRenderer::renderDropShadow(const SkPaint* paint, const glyph_t* glyphs,
                                                         int numGlyphs, float radius,
-                                                        const float* positions) {
+                                                        const float* positions, bool applyBlur) {
     checkInit();
 
     DropShadow image;
@@ -607,7 +624,9 @@ FontRenderer::DropShadow FontRenderer::renderDropShadow(const SkPaint* paint, co
         // Unbind any PBO we might have used
         Caches::getInstance().pixelBufferState().unbind();
 
-        blurImage(&dataBuffer, paddedWidth, paddedHeight, radius);
+        if (applyBlur) {
+            blurImage(&dataBuffer, paddedWidth, paddedHeight, radius);
+        }
     }
 
     image.width = paddedWidth;
@@ -642,6 +661,10 @@ void FontRenderer::precache(const SkPaint* paint, const glyph_t* glyphs, int num
 }
 
 void FontRenderer::endPrecaching() {
+    if (CC_UNLIKELY(mNeedsHotGlyphRestore)) {
+        mNeedsHotGlyphRestore = false;
+        restoreHotGlyphs();
+    }
     checkTextureUpdate();
 }
 
@@ -108,9 +108,16 @@ public:
     };
 
     // After renderDropShadow returns, the called owns the memory in DropShadow.image
-    // and is responsible for releasing it when it's done with it
+    // and is responsible for releasing it when it's done with it.
+    // When applyBlur is false the image contains the unblurred glyph
+    // rasterization; the caller is expected to blur it itself, e.g. on the
+    // GPU via GlShadowBlur.
     DropShadow renderDropShadow(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs,
-                                float radius, const float* positions);
+                                float radius, const float* positions, bool applyBlur = true);
+
+    // Blurs an A8 image in place. May replace the image allocation when
+    // blurring through renderscript.
+    void blurImage(uint8_t** image, int32_t width, int32_t height, float radius);
 
     void setTextureFiltering(bool linearFiltering) { mLinearFiltering = linearFiltering; }
 
@@ -137,6 +144,14 @@ private:
 
     void flushAllAndInvalidate();
 
+    /**
+     * Re-rasterizes the hottest invalidated glyphs of the active fonts, so
+     * the first text-heavy frame after a cache flush doesn't serialize its
+     * misses through cacheBitmap. Runs during the precache phase of the
+     * first frame after a flush.
+     */
+    void restoreHotGlyphs();
+
     void checkInit();
     void initRender(const Rect* clip, Rect* bounds, TextDrawFunctor* functor);
     void finishRender();
@@ -185,6 +200,8 @@ private:
 
     bool mLinearFiltering;
 
+    bool mNeedsHotGlyphRestore;
+
 #ifdef BUGREPORT_FONT_CACHE_USAGE
     FontCacheHistoryTracker mHistoryTracker;
 #endif
@@ -199,9 +216,6 @@ private:
                                int32_t width, int32_t height);
     static void verticalBlur(float* weights, int32_t radius, const uint8_t* source, uint8_t* dest,
                              int32_t width, int32_t height);
-
-    // the input image handle may have its pointer replaced (to avoid copies)
-    void blurImage(uint8_t** image, int32_t width, int32_t height, float radius);
 };
 
 };  // namespace uirenderer
@@ -22,6 +22,9 @@
 #include "VectorDrawable.h"
 #include "hwui/Canvas.h"
 #include "renderstate/OffscreenBufferPool.h"
+#include "thread/Task.h"
+#include "thread/TaskManager.h"
+#include "thread/TaskProcessor.h"
 #include "utils/FatVector.h"
 #include "utils/PaintUtils.h"
 #include "utils/TraceUtils.h"
@@ -32,6 +35,11 @@
 namespace android {
 namespace uirenderer {
 
+// Serializes calls into the shared Caches (path/font/tessellation) while zone FrameBuilders
+// defer concurrently on TaskManager workers; none of those caches lock internally. Uncontended
+// on the serial path.
+static Mutex sPrecacheLock;
+
 FrameBuilder::FrameBuilder(const SkRect& clip, uint32_t viewportWidth, uint32_t viewportHeight,
                            const LightGeometry& lightGeometry, Caches& caches)
         : mStdAllocator(mAllocator)
@@ -102,6 +110,83 @@ void FrameBuilder::deferLayers(const LayerUpdateQueue& layers) {
     }
 }
 
+class FrameBuilder::ZoneTask : public Task<bool> {
+public:
+    ZoneTask(const FrameBuilder::LightGeometry& lightGeometry) : lightGeometry(lightGeometry) {}
+
+    // Subset of the frame's layer entries deferred by this zone, in original queue order.
+    LayerUpdateQueue zoneLayers;
+    FrameBuilder::LightGeometry lightGeometry;
+
+    // Built on the worker thread; owns every LayerBuilder/BakedOpState this zone produced.
+    std::unique_ptr<FrameBuilder> frameBuilder;
+};
+
+class FrameBuilder::ZoneProcessor : public TaskProcessor<bool> {
+public:
+    ZoneProcessor(TaskManager* taskManager, Caches& caches)
+            : TaskProcessor<bool>(taskManager), mCaches(caches) {}
+    ~ZoneProcessor() {}
+
+    virtual void onProcess(const sp<Task<bool> >& task) override {
+        ZoneTask* zoneTask = static_cast<ZoneTask*>(task.get());
+        zoneTask->frameBuilder.reset(
+                new FrameBuilder(zoneTask->zoneLayers, zoneTask->lightGeometry, mCaches));
+        task->setResult(true);
+    }
+
+private:
+    Caches& mCaches;
+};
+
+void FrameBuilder::deferLayersParallel(const LayerUpdateQueue& layers, TaskManager* taskManager) {
+    const size_t entryCount = layers.entries().size();
+    size_t zoneCount = taskManager ? std::min(entryCount, taskManager->workerCount() + 1) : 1;
+    if (!taskManager || !taskManager->canRunTasks() || zoneCount <= 1) {
+        deferLayers(layers);
+        return;
+    }
+    ATRACE_FORMAT("Defer %zu HW Layers in %zu zones", entryCount, zoneCount);
+
+    LightGeometry lightGeometry = {mCanvasState.currentSnapshot()->getRelativeLightCenter(),
+                                   mLightRadius};
+    sp<ZoneProcessor> processor(new ZoneProcessor(taskManager, mCaches));
+
+    // Split entries into contiguous zones, preserving queue order within each.
+    std::vector<sp<ZoneTask> > zoneTasks;
+    zoneTasks.reserve(zoneCount);
+    const size_t chunk = (entryCount + zoneCount - 1) / zoneCount;
+    for (size_t begin = 0; begin < entryCount; begin += chunk) {
+        sp<ZoneTask> zoneTask(new ZoneTask(lightGeometry));
+        const size_t end = std::min(begin + chunk, entryCount);
+        for (size_t i = begin; i < end; i++) {
+            const LayerUpdateQueue::Entry& entry = layers.entries()[i];
+            zoneTask->zoneLayers.enqueueLayerWithDamage(entry.renderNode.get(), entry.damage);
+        }
+        zoneTasks.push_back(zoneTask);
+    }
+    // Schedule all but the first zone; defer that one on the calling thread instead of idling.
+    for (size_t i = 1; i < zoneTasks.size(); i++) {
+        processor->add(zoneTasks[i]);
+    }
+    processor->onProcess(zoneTasks[0]);
+
+    // Merge in reverse zone order so mLayerBuilders matches the serial deferLayers() layout,
+    // and layers are still issued to the renderer in queue order.
+    for (int i = zoneTasks.size() - 1; i >= 0; i--) {
+        zoneTasks[i]->getResult();  // block until the worker is done with the zone
+        mergeZone(std::move(zoneTasks[i]->frameBuilder));
+    }
+}
+
+void FrameBuilder::mergeZone(std::unique_ptr<FrameBuilder> zone) {
+    // Skip the zone's fbo0 entry - layer-queue FrameBuilders never draw into it.
+    for (size_t i = 1; i < zone->mLayerBuilders.size(); i++) {
+        mLayerBuilders.push_back(zone->mLayerBuilders[i]);
+    }
+    mZones.push_back(std::move(zone));
+}
+
 void FrameBuilder::deferRenderNode(RenderNode& renderNode) {
     renderNode.computeOrdering();
 
@@ -439,10 +524,16 @@ void FrameBuilder::deferShadow(const ClipBase* reorderClip, const RenderNodeOp&
         node.applyViewPropertyTransforms(shadowMatrixXY, false);
         node.applyViewPropertyTransforms(shadowMatrixZ, true);
 
-        sp<TessellationCache::ShadowTask> task = mCaches.tessellationCache.getShadowTask(
-                mCanvasState.currentTransform(), mCanvasState.getLocalClipBounds(),
-                casterAlpha >= 1.0f, casterPath, &shadowMatrixXY, &shadowMatrixZ,
-                mCanvasState.currentSnapshot()->getRelativeLightCenter(), mLightRadius);
+        sp<TessellationCache::ShadowTask> task;
+        {
+            // TessellationCache mutates its LruCaches and lazily constructs its
+            // task processors, so zone workers must not race into it
+            Mutex::Autolock lock(sPrecacheLock);
+            task = mCaches.tessellationCache.getShadowTask(
+                    mCanvasState.currentTransform(), mCanvasState.getLocalClipBounds(),
+                    casterAlpha >= 1.0f, casterPath, &shadowMatrixXY, &shadowMatrixZ,
+                    mCanvasState.currentSnapshot()->getRelativeLightCenter(), mLightRadius);
+        }
         ShadowOp* shadowOp = mAllocator.create<ShadowOp>(task, casterAlpha);
         BakedOpState* bakedOpState = BakedOpState::tryShadowOpConstruct(
                 mAllocator, *mCanvasState.writableSnapshot(), shadowOp);
@@ -684,6 +775,7 @@ void FrameBuilder::deferPatchOp(const PatchOp& op) {
 void FrameBuilder::deferPathOp(const PathOp& op) {
     auto state = deferStrokeableOp(op, OpBatchType::AlphaMaskTexture);
     if (CC_LIKELY(state)) {
+        Mutex::Autolock lock(sPrecacheLock);
         mCaches.pathCache.precache(op.path, op.paint);
     }
 }
@@ -701,6 +793,7 @@ void FrameBuilder::deferRoundRectOp(const RoundRectOp& op) {
     auto state = deferStrokeableOp(op, tessBatchId(op));
     if (CC_LIKELY(state && !op.paint->getPathEffect())) {
         // TODO: consider storing tessellation task in BakedOpState
+        Mutex::Autolock lock(sPrecacheLock);
         mCaches.tessellationCache.precacheRoundRect(state->computedState.transform, *(op.paint),
                                                     op.unmappedBounds.getWidth(),
                                                     op.unmappedBounds.getHeight(), op.rx, op.ry);
@@ -743,6 +836,9 @@ void FrameBuilder::deferTextOp(const TextOp& op) {
         currentLayer().deferUnmergeableOp(mAllocator, bakedState, batchId);
     }
 
+    // getFontRenderer() lazily constructs the renderer, so it must be reached
+    // under the lock too
+    Mutex::Autolock lock(sPrecacheLock);
     FontRenderer& fontRenderer = mCaches.fontRenderer.getFontRenderer();
     auto& totalTransform = bakedState->computedState.transform;
     if (totalTransform.isPureTranslate() || totalTransform.isPerspective()) {
@@ -762,6 +858,7 @@ void FrameBuilder::deferTextOnPathOp(const TextOnPathOp& op) {
     if (!bakedState) return;  // quick rejected
     currentLayer().deferUnmergeableOp(mAllocator, bakedState, textBatchId(*(op.paint)));
 
+    Mutex::Autolock lock(sPrecacheLock);
     mCaches.fontRenderer.getFontRenderer().precache(op.paint, op.glyphs, op.glyphCount,
                                                     SkMatrix::I());
 }
@@ -23,6 +23,7 @@
 #include "RecordedOp.h"
 #include "utils/GLUtils.h"
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +36,7 @@ class BakedOpState;
 class LayerUpdateQueue;
 class OffscreenBuffer;
 class Rect;
+class TaskManager;
 
 /**
  * Processes, optimizes, and stores rendering commands from RenderNodes and
@@ -68,6 +70,17 @@ public:
 
     void deferLayers(const LayerUpdateQueue& layers);
 
+    /**
+     * Defers the layer update queue by partitioning its independent entries into zones, and
+     * building each zone's reorder state in a self-contained FrameBuilder on a TaskManager
+     * worker thread. The per-zone LayerBuilders are then spliced back into this FrameBuilder,
+     * preserving the update order the serial path would have produced.
+     *
+     * Falls back to deferLayers() when the task manager can't run tasks, or when there are too
+     * few entries for the split to pay for itself.
+     */
+    void deferLayersParallel(const LayerUpdateQueue& layers, TaskManager* taskManager);
+
     void deferRenderNode(RenderNode& renderNode);
 
     void deferRenderNode(float tx, float ty, Rect clipRect, RenderNode& renderNode);
@@ -166,7 +179,15 @@ public:
     virtual GLuint getTargetFbo() const override { return 0; }
 
 private:
+    class ZoneTask;
+    class ZoneProcessor;
+
     void finishDefer();
+
+    // Appends a completed zone's layer LayerBuilders (everything but its unused fbo0 entry) to
+    // mLayerBuilders, and takes ownership of the zone so its allocations survive until replay.
+    void mergeZone(std::unique_ptr<FrameBuilder> zone);
+
     enum class ChildrenSelectMode { Negative, Positive };
     void saveForLayer(uint32_t layerWidth, uint32_t layerHeight, float contentTranslateX,
                       float contentTranslateY, const Rect& repaintRect, const Vector3& lightCenter,
@@ -238,6 +259,10 @@ private:
     */
     LsaVector<size_t> mLayerStack;
 
+    // Zone FrameBuilders merged via mergeZone() - kept alive because mLayerBuilders references
+    // LayerBuilders (and ops/states) owned by their allocators.
+    std::vector<std::unique_ptr<FrameBuilder> > mZones;
+
     CanvasState mCanvasState;
 
     Caches& mCaches;
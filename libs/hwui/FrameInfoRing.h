@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "FrameInfo.h"
+
+#include <string.h>
+
+#include <atomic>
+
+namespace android {
+namespace uirenderer {
+
+/**
+ * Lock-free single-writer ring of completed FrameInfo records, designed to live
+ * in an ashmem region so an external agent can mmap it read-only and drain
+ * frames without IPC or involving the RenderThread.
+ *
+ * The writer publishes a record by filling the slot head % kCapacity and then
+ * release-storing the incremented head. head counts records ever written, so a
+ * reader tracks the last index it consumed and reads forward from there. A
+ * zero-filled region is a valid empty ring.
+ */
+class FrameInfoRing {
+public:
+    // ~4 seconds worth of frames at 60fps; must keep the ring well below the
+    // typical ashmem region page budget.
+    static constexpr size_t kCapacity = 256;
+    static constexpr size_t kRecordSize =
+            sizeof(int64_t) * static_cast<size_t>(FrameInfoIndex::NumIndexes);
+
+    // Writer side; only called from the RenderThread.
+    void push(const FrameInfo& frame) { push(frame.data()); }
+
+    void push(const int64_t* record) {
+        uint64_t head = mHead.load(std::memory_order_relaxed);
+        memcpy(mRecords[head % kCapacity], record, kRecordSize);
+        mHead.store(head + 1, std::memory_order_release);
+    }
+
+    // Number of records ever written; records newer than head - kCapacity are
+    // safely readable.
+    uint64_t head() const { return mHead.load(std::memory_order_acquire); }
+
+    /**
+     * Reader side: copies the record at "index" into outRecord (NumIndexes
+     * int64_t values). Returns false if the record does not exist yet or was
+     * overwritten while being copied, in which case outRecord must be ignored.
+     */
+    bool read(uint64_t index, int64_t* outRecord) const {
+        if (index >= head()) {
+            return false;
+        }
+        memcpy(outRecord, mRecords[index % kCapacity], kRecordSize);
+        // The writer starts overwriting slot index % kCapacity when head
+        // reaches index + kCapacity; anything older may be torn.
+        return mHead.load(std::memory_order_acquire) - index < kCapacity;
+    }
+
+private:
+    std::atomic<uint64_t> mHead{0};
+    int64_t mRecords[kCapacity][static_cast<size_t>(FrameInfoIndex::NumIndexes)];
+};
+
+} /* namespace uirenderer */
+} /* namespace android */
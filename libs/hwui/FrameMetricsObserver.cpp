@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FrameMetricsObserver.h"
+
+#include "FrameInfoRing.h"
+
+#include <cutils/ashmem.h>
+#include <log/log.h>
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace android {
+namespace uirenderer {
+
+FrameMetricsObserver::~FrameMetricsObserver() {
+    if (mRing) {
+        munmap(mRing, sizeof(FrameInfoRing));
+        close(mRingFd);
+    }
+}
+
+void FrameMetricsObserver::notify(const int64_t* buffer) {}
+
+int FrameMetricsObserver::attachRing() {
+    if (mRing) {
+        return mRingFd;
+    }
+    int fd = ashmem_create_region("FrameMetrics ring", sizeof(FrameInfoRing));
+    if (fd < 0) {
+        int err = errno;
+        ALOGW("Failed to create frame metrics ring, err %d %s", err, strerror(err));
+        return -1;
+    }
+    void* mapped = mmap(nullptr, sizeof(FrameInfoRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        int err = errno;
+        ALOGW("Failed to map frame metrics ring, err %d %s", err, strerror(err));
+        close(fd);
+        return -1;
+    }
+    // ashmem is zero-filled, which is a valid empty ring
+    mRing = reinterpret_cast<FrameInfoRing*>(mapped);
+    mRingFd = fd;
+    return fd;
+}
+
+};  // namespace uirenderer
+};  // namespace android
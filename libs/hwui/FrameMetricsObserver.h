@@ -21,9 +21,32 @@
 namespace android {
 namespace uirenderer {
 
+class FrameInfoRing;
+
 class FrameMetricsObserver : public VirtualLightRefBase {
 public:
+    FrameMetricsObserver() {}
+    virtual ~FrameMetricsObserver();
+
     virtual void notify(const int64_t* buffer);
+
+    /**
+     * Switches this observer to shared-memory delivery: allocates an ashmem
+     * region holding a FrameInfoRing and maps it. Once attached, the reporter
+     * writes completed frames straight into the ring instead of calling
+     * notify(), so the consumer drains on its own cadence without a wakeup
+     * per frame. Must be called before the observer is registered; returns
+     * the region's fd (owned by this observer; readers must dup it and map
+     * read-only), or -1 on failure.
+     */
+    int attachRing();
+
+    FrameInfoRing* ring() const { return mRing; }
+    int ringFd() const { return mRingFd; }
+
+private:
+    FrameInfoRing* mRing = nullptr;
+    int mRingFd = -1;
 };
 
 };  // namespace uirenderer
@@ -20,6 +20,7 @@
 #include <utils/RefBase.h>
 
 #include "FrameInfo.h"
+#include "FrameInfoRing.h"
 #include "FrameMetricsObserver.h"
 
 #include <string.h>
@@ -48,7 +49,15 @@ public:
 
     void reportFrameMetrics(const int64_t* stats) {
         for (size_t i = 0; i < mObservers.size(); i++) {
-            mObservers[i]->notify(stats);
+            FrameMetricsObserver* observer = mObservers[i].get();
+            // Ring-backed observers get the record written straight into
+            // their shared-memory ring; the consumer drains on its own
+            // cadence so there is no per-frame wakeup to pay for.
+            if (FrameInfoRing* ring = observer->ring()) {
+                ring->push(stats);
+            } else {
+                observer->notify(stats);
+            }
         }
     }
 
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GlShadowBlur.h"
+
+#include "Caches.h"
+#include "Texture.h"
+#include "renderstate/RenderState.h"
+#include "utils/Blur.h"
+#include "utils/GLUtils.h"
+
+#include <log/log.h>
+
+#include <string.h>
+
+namespace android {
+namespace uirenderer {
+
+// Radii above this fall back to the CPU path. Must match the loop bounds in
+// the fragment shader below (tap count = 2 * radius + 1).
+static const uint32_t kMaxGpuRadius = 25;
+static const uint32_t kTapCount = 2 * kMaxGpuRadius + 1;
+
+// The weights array alone needs 51 uniform vectors on compilers that don't
+// pack float arrays; require a comfortable margin over the ES2 minimum of 16.
+static const GLint kRequiredUniformVectors = 64;
+
+static const char* kVertexShader =
+        "attribute vec4 position;\n"
+        "attribute vec2 texCoords;\n"
+        "varying vec2 outTexCoords;\n"
+        "void main() {\n"
+        "    gl_Position = position;\n"
+        "    outTexCoords = texCoords;\n"
+        "}\n";
+
+static const char* kFragmentShader =
+        "precision mediump float;\n"
+        "varying vec2 outTexCoords;\n"
+        "uniform sampler2D baseSampler;\n"
+        "uniform vec2 sampleStep;\n"
+        "uniform float weights[51];\n"
+        "void main() {\n"
+        "    float sum = 0.0;\n"
+        "    for (int i = 0; i < 51; i++) {\n"
+        "        vec2 offset = float(i - 25) * sampleStep;\n"
+        "        sum += texture2D(baseSampler, outTexCoords + offset).a * weights[i];\n"
+        "    }\n"
+        "    gl_FragColor = vec4(0.0, 0.0, 0.0, sum);\n"
+        "}\n";
+
+static GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE) {
+        GLchar log[512];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        ALOGE("Error compiling shadow blur shader: %s", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+void GlShadowBlur::terminate() {
+    if (mProgram) {
+        glDeleteProgram(mProgram);
+        mProgram = 0;
+    }
+    mInitAttempted = false;
+}
+
+bool GlShadowBlur::initialize() {
+    if (mProgram) return true;
+    if (mInitAttempted) return false;
+    mInitAttempted = true;
+
+    GLint maxUniformVectors = 0;
+    glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_VECTORS, &maxUniformVectors);
+    if (maxUniformVectors < kRequiredUniformVectors) {
+        ALOGD("Not enough fragment uniforms for GPU shadow blur (%d)", maxUniformVectors);
+        return false;
+    }
+
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, kVertexShader);
+    if (!vertexShader) return false;
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+    if (!fragmentShader) {
+        glDeleteShader(vertexShader);
+        return false;
+    }
+
+    mProgram = glCreateProgram();
+    glAttachShader(mProgram, vertexShader);
+    glAttachShader(mProgram, fragmentShader);
+    glLinkProgram(mProgram);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(mProgram, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        GLchar log[512];
+        glGetProgramInfoLog(mProgram, sizeof(log), nullptr, log);
+        ALOGE("Error linking shadow blur program: %s", log);
+        glDeleteProgram(mProgram);
+        mProgram = 0;
+        return false;
+    }
+
+    mPositionAttrib = glGetAttribLocation(mProgram, "position");
+    mTexCoordsAttrib = glGetAttribLocation(mProgram, "texCoords");
+    mSamplerUniform = glGetUniformLocation(mProgram, "baseSampler");
+    mStepUniform = glGetUniformLocation(mProgram, "sampleStep");
+    mWeightsUniform = glGetUniformLocation(mProgram, "weights");
+
+    return true;
+}
+
+bool GlShadowBlur::blurInto(Texture& outTexture, const uint8_t* src, uint32_t width,
+                            uint32_t height, float radius) {
+    const uint32_t intRadius = Blur::convertRadiusToInt(radius);
+    if (intRadius < 1 || intRadius > kMaxGpuRadius) return false;
+    if (!initialize()) return false;
+
+    Caches& caches = Caches::getInstance();
+
+    // Center the kernel in the fixed-length weights array; the padding taps
+    // have zero weight
+    float kernel[kTapCount];
+    Blur::generateGaussianWeights(kernel, radius);
+    float weights[kTapCount];
+    memset(weights, 0, sizeof(weights));
+    memcpy(weights + (kMaxGpuRadius - intRadius), kernel,
+           (2 * intRadius + 1) * sizeof(float));
+
+    // Our draws bypass the Glop pipeline, so park the tracked GL state the
+    // same way functor invocation does; resuming below restores the render
+    // target, viewport and state caches
+    mRenderState.interruptForFunctorInvoke();
+
+    caches.textureState().activateTexture(0);
+
+    Texture sourceTexture(caches);
+    sourceTexture.upload(GL_ALPHA, width, height, GL_ALPHA, GL_UNSIGNED_BYTE, src);
+    sourceTexture.setFilter(GL_NEAREST);
+    sourceTexture.setWrap(GL_CLAMP_TO_EDGE);
+
+    Texture midTexture(caches);
+    midTexture.resize(width, height, GL_RGBA, GL_RGBA);
+    midTexture.setFilter(GL_NEAREST, true);
+    midTexture.setWrap(GL_CLAMP_TO_EDGE, true);
+
+    outTexture.resize(width, height, GL_RGBA, GL_RGBA);
+
+    // Bind raw so the tracked binding still points at the interrupted target
+    GLuint fbo = mRenderState.createFramebuffer();
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glViewport(0, 0, width, height);
+    glDisable(GL_BLEND);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_STENCIL_TEST);
+
+    glUseProgram(mProgram);
+    glUniform1i(mSamplerUniform, 0);
+    glUniform1fv(mWeightsUniform, kTapCount, weights);
+
+    // clip-space x, y then texture u, v
+    static const float kMesh[] = {
+            -1, -1, 0, 0,
+             1, -1, 1, 0,
+            -1,  1, 0, 1,
+             1,  1, 1, 1,
+    };
+    glEnableVertexAttribArray(mPositionAttrib);
+    glEnableVertexAttribArray(mTexCoordsAttrib);
+    glVertexAttribPointer(mPositionAttrib, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), kMesh);
+    glVertexAttribPointer(mTexCoordsAttrib, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), kMesh + 2);
+
+    // Horizontal pass into the intermediate, vertical pass into the output
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, midTexture.id(),
+                           0);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (complete) {
+        caches.textureState().bindTexture(sourceTexture.id());
+        glUniform2f(mStepUniform, 1.0f / width, 0.0f);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               outTexture.id(), 0);
+        caches.textureState().bindTexture(midTexture.id());
+        glUniform2f(mStepUniform, 0.0f, 1.0f / height);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glDisableVertexAttribArray(mPositionAttrib);
+    glDisableVertexAttribArray(mTexCoordsAttrib);
+
+    sourceTexture.deleteTexture();
+    midTexture.deleteTexture();
+    mRenderState.deleteFramebuffer(fbo);
+
+    mRenderState.resumeFromFunctorInvoke();
+    GL_CHECKPOINT(MODERATE);
+
+    return complete;
+}
+
+};  // namespace uirenderer
+};  // namespace android
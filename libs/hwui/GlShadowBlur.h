@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_HWUI_GL_SHADOW_BLUR_H
+#define ANDROID_HWUI_GL_SHADOW_BLUR_H
+
+#include <GLES2/gl2.h>
+
+namespace android {
+namespace uirenderer {
+
+class RenderState;
+class Texture;
+
+/**
+ * Renders blurred text shadow bitmaps on the GPU with a two pass separable
+ * gaussian, producing the shadow texture directly instead of blurring on the
+ * CPU and uploading the result. Used by TextDropShadowCache; callers fall
+ * back to the CPU blur whenever blurInto() returns false.
+ */
+class GlShadowBlur {
+public:
+    explicit GlShadowBlur(RenderState& renderState) : mRenderState(renderState) {}
+    ~GlShadowBlur() { terminate(); }
+
+    /**
+     * Blurs the A8 source bitmap by the given radius and writes the result
+     * into the alpha channel of outTexture, which is allocated as an RGBA
+     * texture at the source dimensions (alpha-only textures aren't
+     * renderable). Returns false when the GPU path can't service this blur,
+     * in which case the caller should blur on the CPU instead.
+     */
+    bool blurInto(Texture& outTexture, const uint8_t* src, uint32_t width, uint32_t height,
+                  float radius);
+
+    /**
+     * Releases the GL objects. Called when the GL context is going away.
+     */
+    void terminate();
+
+private:
+    bool initialize();
+
+    RenderState& mRenderState;
+
+    GLuint mProgram = 0;
+    bool mInitAttempted = false;
+
+    GLint mPositionAttrib = -1;
+    GLint mTexCoordsAttrib = -1;
+    GLint mSamplerUniform = -1;
+    GLint mStepUniform = -1;
+    GLint mWeightsUniform = -1;
+};  // class GlShadowBlur
+
+};  // namespace uirenderer
+};  // namespace android
+
+#endif  // ANDROID_HWUI_GL_SHADOW_BLUR_H
@@ -29,6 +29,30 @@ Interpolator* Interpolator::createDefaultInterpolator() {
     return new AccelerateDecelerateInterpolator();
 }
 
+float Interpolator::evaluate(Type type, float param, float input) {
+    // Must match the interpolate() implementations below; param packs the derived
+    // constant of each type (the pow() exponent, or the overshoot tension).
+    switch (type) {
+        case Type::AccelerateDecelerate:
+            return (float)(cosf((input + 1) * M_PI) / 2.0f) + 0.5f;
+        case Type::Accelerate:
+            return param == 2.0f ? input * input : pow(input, param);
+        case Type::Decelerate:
+            return param == 2.0f ? 1.0f - (1.0f - input) * (1.0f - input)
+                                 : 1.0f - pow((1.0f - input), param);
+        case Type::Linear:
+            return input;
+        case Type::Overshoot: {
+            float t = input - 1.0f;
+            return t * t * ((param + 1) * t + param) + 1.0f;
+        }
+        case Type::Custom:
+            break;
+    }
+    LOG_ALWAYS_FATAL("Custom interpolators cannot be evaluated from a packed parameter");
+    return input;
+}
+
 float AccelerateDecelerateInterpolator::interpolate(float input) {
     return (float)(cosf((input + 1) * M_PI) / 2.0f) + 0.5f;
 }
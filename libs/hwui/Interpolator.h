@@ -27,24 +27,54 @@ namespace uirenderer {
 
 class Interpolator {
 public:
+    /**
+     * Identifies interpolators whose curve can be evaluated from a packed parameter via
+     * evaluate(), without dispatching through the virtual interpolate(). AnimatorManager
+     * uses this to batch-ease many animators from structure-of-arrays data.
+     */
+    enum class Type : uint8_t {
+        // Must be evaluated through the virtual interpolate().
+        Custom = 0,
+        AccelerateDecelerate,
+        Accelerate,
+        Decelerate,
+        Linear,
+        Overshoot,
+    };
+
     virtual ~Interpolator() {}
 
     virtual float interpolate(float input) = 0;
 
+    Type type() const { return mType; }
+    float param() const { return mParam; }
+
+    // Evaluates a non-custom interpolator type from its packed parameter.
+    static float evaluate(Type type, float param, float input);
+
     static Interpolator* createDefaultInterpolator();
 
 protected:
     Interpolator() {}
+    Interpolator(Type type, float param) : mType(type), mParam(param) {}
+
+private:
+    const Type mType = Type::Custom;
+    const float mParam = 0.0f;
 };
 
 class ANDROID_API AccelerateDecelerateInterpolator : public Interpolator {
 public:
+    AccelerateDecelerateInterpolator() : Interpolator(Type::AccelerateDecelerate, 0) {}
     virtual float interpolate(float input) override;
 };
 
 class ANDROID_API AccelerateInterpolator : public Interpolator {
 public:
-    explicit AccelerateInterpolator(float factor) : mFactor(factor), mDoubleFactor(factor * 2) {}
+    explicit AccelerateInterpolator(float factor)
+            : Interpolator(Type::Accelerate, factor * 2)
+            , mFactor(factor)
+            , mDoubleFactor(factor * 2) {}
     virtual float interpolate(float input) override;
 
 private:
@@ -86,7 +116,8 @@ private:
 
 class ANDROID_API DecelerateInterpolator : public Interpolator {
 public:
-    explicit DecelerateInterpolator(float factor) : mFactor(factor) {}
+    explicit DecelerateInterpolator(float factor)
+            : Interpolator(Type::Decelerate, factor * 2), mFactor(factor) {}
     virtual float interpolate(float input) override;
 
 private:
@@ -95,12 +126,14 @@ private:
 
 class ANDROID_API LinearInterpolator : public Interpolator {
 public:
+    LinearInterpolator() : Interpolator(Type::Linear, 0) {}
     virtual float interpolate(float input) override { return input; }
 };
 
 class ANDROID_API OvershootInterpolator : public Interpolator {
 public:
-    explicit OvershootInterpolator(float tension) : mTension(tension) {}
+    explicit OvershootInterpolator(float tension)
+            : Interpolator(Type::Overshoot, tension), mTension(tension) {}
     virtual float interpolate(float input) override;
 
 private:
@@ -130,6 +130,12 @@ void JankTracker::finishFrame(const FrameInfo& frame) {
     mData->reportFrame(totalDuration);
     (*mGlobalData)->reportFrame(totalDuration);
 
+    // Publish the completed frame timeline for external telemetry readers
+    // draining the shared-memory ring, including frames exempted below.
+    if (FrameInfoRing* ring = mGlobalData->frameRing()) {
+        ring->push(frame);
+    }
+
     // Only things like Surface.lockHardwareCanvas() are exempt from tracking
     if (CC_UNLIKELY(frame[FrameInfoIndex::Flags] & EXEMPT_FRAMES_FLAGS)) {
         return;
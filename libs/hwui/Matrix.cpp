@@ -23,6 +23,11 @@
 #include <SkMatrix.h>
 
 #include "Matrix.h"
+#include "Vertex.h"
+
+#if defined(__ARM_NEON__) || defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace android {
 namespace uirenderer {
@@ -442,6 +447,39 @@ void Matrix4::mapPoint(float& x, float& y) const {
     y = dy * dz;
 }
 
+void Matrix4::mapPoints(Vertex* vertices, int count) const {
+    if (isIdentity() || count <= 0) return;
+
+    if (isSimple()) {
+        // Vertex is a tightly packed x,y pair, so the array can be treated as
+        // interleaved floats and scaled/translated four vertices at a time.
+        float* xy = &vertices[0].x;
+        int i = 0;
+#if defined(__ARM_NEON__) || defined(__aarch64__)
+        const float32x4_t scaleX = vdupq_n_f32(data[kScaleX]);
+        const float32x4_t scaleY = vdupq_n_f32(data[kScaleY]);
+        const float32x4_t translateX = vdupq_n_f32(data[kTranslateX]);
+        const float32x4_t translateY = vdupq_n_f32(data[kTranslateY]);
+        for (; i + 4 <= count; i += 4) {
+            float32x4x2_t points = vld2q_f32(xy + 2 * i);
+            points.val[0] = vmlaq_f32(translateX, points.val[0], scaleX);
+            points.val[1] = vmlaq_f32(translateY, points.val[1], scaleY);
+            vst2q_f32(xy + 2 * i, points);
+        }
+#endif
+        for (; i < count; i++) {
+            MUL_ADD_STORE(xy[2 * i], data[kScaleX], data[kTranslateX]);
+            MUL_ADD_STORE(xy[2 * i + 1], data[kScaleY], data[kTranslateY]);
+        }
+        return;
+    }
+
+    // full transform - the perspective divide prevents vectorizing profitably
+    for (int i = 0; i < count; i++) {
+        mapPoint(vertices[i].x, vertices[i].y);
+    }
+}
+
 /**
  * Set the contents of the rect to be the bounding rect around each of the corners, mapped by the
  * matrix.
@@ -43,6 +43,8 @@ namespace uirenderer {
 // Classes
 ///////////////////////////////////////////////////////////////////////////////
 
+struct Vertex;
+
 class ANDROID_API Matrix4 {
 public:
     float data[16];
@@ -197,8 +199,9 @@ public:
 
     float mapZ(const Vector3& orig) const;
     void mapPoint3d(Vector3& vec) const;
-    void mapPoint(float& x, float& y) const;  // 2d only
-    void mapRect(Rect& r) const;              // 2d only
+    void mapPoint(float& x, float& y) const;           // 2d only
+    void mapPoints(Vertex* vertices, int count) const; // 2d only
+    void mapRect(Rect& r) const;                       // 2d only
 
     float getTranslateX() const;
     float getTranslateY() const;
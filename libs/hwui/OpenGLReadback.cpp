@@ -32,24 +32,20 @@
 namespace android {
 namespace uirenderer {
 
-CopyResult OpenGLReadback::copySurfaceInto(Surface& surface, const Rect& srcRect,
-                                           SkBitmap* bitmap) {
-    ATRACE_CALL();
-    // Setup the source
-    sp<GraphicBuffer> sourceBuffer;
+CopyResult OpenGLReadback::acquireSourceBuffer(Surface& surface, sp<GraphicBuffer>* outBuffer,
+                                               Matrix4* outTransform) {
     sp<Fence> sourceFence;
-    Matrix4 texTransform;
-    status_t err = surface.getLastQueuedBuffer(&sourceBuffer, &sourceFence, texTransform.data);
-    texTransform.invalidateType();
+    status_t err = surface.getLastQueuedBuffer(outBuffer, &sourceFence, outTransform->data);
+    outTransform->invalidateType();
     if (err != NO_ERROR) {
         ALOGW("Failed to get last queued buffer, error = %d", err);
         return CopyResult::UnknownError;
     }
-    if (!sourceBuffer.get()) {
+    if (!outBuffer->get()) {
         ALOGW("Surface doesn't have any previously queued frames, nothing to readback from");
         return CopyResult::SourceEmpty;
     }
-    if (sourceBuffer->getUsage() & GRALLOC_USAGE_PROTECTED) {
+    if ((*outBuffer)->getUsage() & GRALLOC_USAGE_PROTECTED) {
         ALOGW("Surface is protected, unable to copy from it");
         return CopyResult::SourceInvalid;
     }
@@ -58,10 +54,62 @@ CopyResult OpenGLReadback::copySurfaceInto(Surface& surface, const Rect& srcRect
         ALOGE("Timeout (500ms) exceeded waiting for buffer fence, abandoning readback attempt");
         return CopyResult::Timeout;
     }
+    return CopyResult::Success;
+}
+
+CopyResult OpenGLReadback::copySurfaceInto(Surface& surface, const Rect& srcRect,
+                                           SkBitmap* bitmap) {
+    ATRACE_CALL();
+    // Setup the source
+    sp<GraphicBuffer> sourceBuffer;
+    Matrix4 texTransform;
+    CopyResult result = acquireSourceBuffer(surface, &sourceBuffer, &texTransform);
+    if (result != CopyResult::Success) {
+        return result;
+    }
 
     return copyGraphicBufferInto(sourceBuffer.get(), texTransform, srcRect, bitmap);
 }
 
+void OpenGLReadback::copySurfaceIntoAsync(Surface& surface, const Rect& srcRect, SkBitmap* bitmap,
+                                          CopyCallback callback) {
+    ATRACE_CALL();
+    sp<GraphicBuffer> sourceBuffer;
+    Matrix4 texTransform;
+    CopyResult result = acquireSourceBuffer(surface, &sourceBuffer, &texTransform);
+    if (result != CopyResult::Success) {
+        callback(result);
+        return;
+    }
+
+    mRenderThread.eglManager().initialize();
+
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    EGLClientBuffer clientBuffer = (EGLClientBuffer)sourceBuffer->getNativeBuffer();
+    EGLint attrs[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE};
+    EGLImageKHR sourceImage = eglCreateImageKHR(display, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID,
+                                                clientBuffer, attrs);
+    if (sourceImage == EGL_NO_IMAGE_KHR) {
+        ALOGW("eglCreateImageKHR failed (%#x)", eglGetError());
+        callback(CopyResult::UnknownError);
+        return;
+    }
+
+    uint32_t width = sourceBuffer->getWidth();
+    uint32_t height = sourceBuffer->getHeight();
+    if (copyImageIntoAsync(sourceImage, texTransform, width, height, srcRect, bitmap, callback)) {
+        // The pipeline owns the EGLImage now and will invoke the callback
+        // when the GPU is done with the copy.
+        return;
+    }
+
+    // No asynchronous path available; do the copy inline.
+    result = copyImageInto(sourceImage, texTransform, width, height, srcRect, bitmap);
+    glFinish();
+    eglDestroyImageKHR(display, sourceImage);
+    callback(result);
+}
+
 CopyResult OpenGLReadback::copyGraphicBufferInto(GraphicBuffer* graphicBuffer,
                                                  Matrix4& texTransform, const Rect& srcRect,
                                                  SkBitmap* bitmap) {
@@ -231,6 +279,7 @@ inline CopyResult copyTextureInto(Caches& caches, RenderState& renderState, Text
     }
 
     // Cleanup
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
     caches.textureState().deleteTexture(texture);
     renderState.deleteFramebuffer(fbo);
 
@@ -33,6 +33,8 @@ public:
                                        SkBitmap* bitmap) override;
     virtual CopyResult copyGraphicBufferInto(GraphicBuffer* graphicBuffer,
                                              SkBitmap* bitmap) override;
+    virtual void copySurfaceIntoAsync(Surface& surface, const Rect& srcRect, SkBitmap* bitmap,
+                                      CopyCallback callback) override;
 
 protected:
     explicit OpenGLReadback(renderthread::RenderThread& thread) : Readback(thread) {}
@@ -42,7 +44,22 @@ protected:
                                      int imgWidth, int imgHeight, const Rect& srcRect,
                                      SkBitmap* bitmap) = 0;
 
+    /**
+     * Queues the copy on the GPU without waiting for it. Returns false if the
+     * implementation can't service the copy asynchronously, in which case the
+     * caller falls back to the blocking path. On success the implementation
+     * takes ownership of the EGLImage and invokes the callback once the copy
+     * completes.
+     */
+    virtual bool copyImageIntoAsync(EGLImageKHR eglImage, const Matrix4& imgTransform, int imgWidth,
+                                    int imgHeight, const Rect& srcRect, SkBitmap* bitmap,
+                                    CopyCallback& callback) {
+        return false;
+    }
+
 private:
+    CopyResult acquireSourceBuffer(Surface& surface, sp<GraphicBuffer>* outBuffer,
+                                   Matrix4* outTransform);
     CopyResult copyGraphicBufferInto(GraphicBuffer* graphicBuffer, Matrix4& texTransform,
                                      const Rect& srcRect, SkBitmap* bitmap);
 };
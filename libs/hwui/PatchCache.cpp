@@ -47,7 +47,7 @@ PatchCache::~PatchCache() {
 ///////////////////////////////////////////////////////////////////////////////
 
 hash_t PatchCache::PatchDescription::hash() const {
-    uint32_t hash = JenkinsHashMix(0, android::hash_type(mPatch));
+    uint32_t hash = JenkinsHashMix(0, android::hash_type(mPatchContent));
     hash = JenkinsHashMix(hash, mBitmapWidth);
     hash = JenkinsHashMix(hash, mBitmapHeight);
     hash = JenkinsHashMix(hash, mPixelWidth);
@@ -60,6 +60,25 @@ int PatchCache::PatchDescription::compare(const PatchCache::PatchDescription& lh
     return memcmp(&lhs, &rhs, sizeof(PatchDescription));
 }
 
+uint64_t PatchCache::computePatchContent(const Res_png_9patch* patch) {
+    // Two independently-seeded Jenkins passes; 64 bits of digest makes an
+    // accidental collision between distinct patch contents implausible.
+    uint64_t digest = 0;
+    for (uint32_t seed = 0; seed < 2; seed++) {
+        uint32_t hash = JenkinsHashMix(seed, patch->numXDivs);
+        hash = JenkinsHashMix(hash, patch->numYDivs);
+        hash = JenkinsHashMix(hash, patch->numColors);
+        hash = JenkinsHashMixBytes(hash, (uint8_t*)patch->getXDivs(),
+                                   patch->numXDivs * sizeof(int32_t));
+        hash = JenkinsHashMixBytes(hash, (uint8_t*)patch->getYDivs(),
+                                   patch->numYDivs * sizeof(int32_t));
+        hash = JenkinsHashMixBytes(hash, (uint8_t*)patch->getColors(),
+                                   patch->numColors * sizeof(uint32_t));
+        digest = (digest << 32) | JenkinsHashWhiten(hash);
+    }
+    return digest;
+}
+
 void PatchCache::clear() {
     clearCache();
 
@@ -76,6 +95,7 @@ void PatchCache::clearCache() {
         delete i.value();
     }
     mCache.clear();
+    mPatchUsers.clear();
 
     BufferBlock* block = mFreeBlocks;
     while (block) {
@@ -86,11 +106,11 @@ void PatchCache::clearCache() {
     mFreeBlocks = nullptr;
 }
 
-void PatchCache::remove(Vector<patch_pair_t>& patchesToRemove, Res_png_9patch* patch) {
+void PatchCache::remove(Vector<patch_pair_t>& patchesToRemove, uint64_t patchContent) {
     LruCache<PatchDescription, Patch*>::Iterator i(mCache);
     while (i.next()) {
         const PatchDescription& key = i.key();
-        if (key.getPatch() == patch) {
+        if (key.getPatchContent() == patchContent) {
             patchesToRemove.push(patch_pair_t(&key, i.value()));
         }
     }
@@ -120,7 +140,17 @@ void PatchCache::clearGarbage() {
         size_t count = mGarbage.size();
         for (size_t i = 0; i < count; i++) {
             Res_png_9patch* patch = mGarbage[i];
-            remove(patchesToRemove, patch);
+            // Meshes are shared between patch instances with identical
+            // content; only release them once the last instance is gone
+            uint64_t content = computePatchContent(patch);
+            auto users = mPatchUsers.find(content);
+            if (users != mPatchUsers.end()) {
+                users->second.erase(patch);
+                if (users->second.empty()) {
+                    mPatchUsers.erase(users);
+                    remove(patchesToRemove, content);
+                }
+            }
             // A Res_png_9patch is actually an array of byte that's larger
             // than sizeof(Res_png_9patch). It must be freed as an array.
             delete[](int8_t*) patch;
@@ -128,16 +158,12 @@ void PatchCache::clearGarbage() {
         mGarbage.clear();
     }
 
-    // TODO: We could sort patchesToRemove by offset to merge
-    // adjacent free blocks
     for (size_t i = 0; i < patchesToRemove.size(); i++) {
         const patch_pair_t& pair = patchesToRemove[i];
 
-        // Release the patch and mark the space in the free list
+        // Release the patch and return the space to the free list
         Patch* patch = pair.getSecond();
-        BufferBlock* block = new BufferBlock(patch->positionOffset, patch->getSize());
-        block->next = mFreeBlocks;
-        mFreeBlocks = block;
+        insertFreeBlock(patch->positionOffset, patch->getSize());
 
         mSize -= patch->getSize();
 
@@ -152,6 +178,42 @@ void PatchCache::clearGarbage() {
 #endif
 }
 
+void PatchCache::insertFreeBlock(uint32_t offset, uint32_t size) {
+    BufferBlock* previous = nullptr;
+    BufferBlock* current = mFreeBlocks;
+    while (current && current->offset < offset) {
+        previous = current;
+        current = current->next;
+    }
+
+    // Grow the previous block if this range extends it...
+    if (previous && previous->offset + previous->size == offset) {
+        previous->size += size;
+        // ...and swallow the next block if the gap between them just closed
+        if (current && previous->offset + previous->size == current->offset) {
+            previous->size += current->size;
+            previous->next = current->next;
+            delete current;
+        }
+        return;
+    }
+
+    // Or prepend the range to the block that follows it
+    if (current && offset + size == current->offset) {
+        current->offset = offset;
+        current->size += size;
+        return;
+    }
+
+    BufferBlock* block = new BufferBlock(offset, size);
+    block->next = current;
+    if (previous) {
+        previous->next = block;
+    } else {
+        mFreeBlocks = block;
+    }
+}
+
 void PatchCache::createVertexBuffer() {
     mRenderState.meshState().genOrUpdateMeshBuffer(&mMeshBuffer, mMaxSize, nullptr,
                                                    GL_DYNAMIC_DRAW);
@@ -226,7 +288,16 @@ static const UvMapper sIdentity;
 const Patch* PatchCache::get(const uint32_t bitmapWidth, const uint32_t bitmapHeight,
                              const float pixelWidth, const float pixelHeight,
                              const Res_png_9patch* patch) {
-    const PatchDescription description(bitmapWidth, bitmapHeight, pixelWidth, pixelHeight, patch);
+    const uint64_t patchContent = computePatchContent(patch);
+    const PatchDescription description(bitmapWidth, bitmapHeight, pixelWidth, pixelHeight,
+                                       patchContent);
+
+    // Track which patch instances rely on this mesh content, so
+    // clearGarbage() knows when the last one is collected. Like the cache
+    // itself this is only touched on the render thread; removeDeferred()
+    // merely queues into mGarbage.
+    mPatchUsers[patchContent].insert(patch);
+
     const Patch* mesh = mCache.get(description);
 
     if (!mesh) {
@@ -22,6 +22,9 @@
 
 #include <androidfw/ResourceTypes.h>
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "Debug.h"
 #include "utils/Pair.h"
 
@@ -78,7 +81,7 @@ public:
 private:
     struct PatchDescription {
         PatchDescription()
-                : mPatch(nullptr)
+                : mPatchContent(0)
                 , mBitmapWidth(0)
                 , mBitmapHeight(0)
                 , mPixelWidth(0)
@@ -86,8 +89,8 @@ private:
 
         PatchDescription(const uint32_t bitmapWidth, const uint32_t bitmapHeight,
                          const float pixelWidth, const float pixelHeight,
-                         const Res_png_9patch* patch)
-                : mPatch(patch)
+                         const uint64_t patchContent)
+                : mPatchContent(patchContent)
                 , mBitmapWidth(bitmapWidth)
                 , mBitmapHeight(bitmapHeight)
                 , mPixelWidth(pixelWidth)
@@ -95,7 +98,7 @@ private:
 
         hash_t hash() const;
 
-        const Res_png_9patch* getPatch() const { return mPatch; }
+        uint64_t getPatchContent() const { return mPatchContent; }
 
         static int compare(const PatchDescription& lhs, const PatchDescription& rhs);
 
@@ -115,7 +118,9 @@ private:
         friend inline hash_t hash_type(const PatchDescription& entry) { return entry.hash(); }
 
     private:
-        const Res_png_9patch* mPatch;
+        // Digest of the patch's divs and colors; meshes are shared between
+        // distinct Res_png_9patch instances with identical content.
+        uint64_t mPatchContent;
         uint32_t mBitmapWidth;
         uint32_t mBitmapHeight;
         float mPixelWidth;
@@ -146,7 +151,20 @@ private:
 
     void setupMesh(Patch* newMesh);
 
-    void remove(Vector<patch_pair_t>& patchesToRemove, Res_png_9patch* patch);
+    void remove(Vector<patch_pair_t>& patchesToRemove, uint64_t patchContent);
+
+    /**
+     * Computes the content digest used to share meshes between patch
+     * instances with identical divs and colors.
+     */
+    static uint64_t computePatchContent(const Res_png_9patch* patch);
+
+    /**
+     * Returns a range of the mesh buffer to the free list, keeping the list
+     * sorted by offset and merging adjacent blocks so the buffer
+     * defragments incrementally as meshes are released.
+     */
+    void insertFreeBlock(uint32_t offset, uint32_t size);
 
 #if DEBUG_PATCHES
     void dumpFreeBlocks(const char* prefix);
@@ -162,6 +180,10 @@ private:
     // First available free block inside the mesh buffer
     BufferBlock* mFreeBlocks;
 
+    // Patch instances currently relying on each shared mesh content,
+    // so a mesh is only released once its last instance is collected
+    std::unordered_map<uint64_t, std::unordered_set<const Res_png_9patch*>> mPatchUsers;
+
     // Garbage tracking, required to handle GC events on the VM side
     Vector<Res_png_9patch*> mGarbage;
     mutable Mutex mLock;
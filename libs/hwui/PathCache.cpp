@@ -204,6 +204,11 @@ uint32_t PathCache::getMaxSize() {
     return mMaxSize;
 }
 
+void PathCache::setMaxSize(uint32_t maxSize) {
+    mMaxSize = maxSize;
+    trim();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Callbacks
 ///////////////////////////////////////////////////////////////////////////////
@@ -361,6 +366,7 @@ PathTexture* PathCache::get(const SkPath* path, const SkPaint* paint) {
     entry.shape.path.mGenerationID = path->getGenerationID();
 
     PathTexture* texture = mCache.get(entry);
+    texture ? mHits++ : mMisses++;
 
     if (!texture) {
         texture = addTexture(entry, path, paint);
@@ -180,6 +180,22 @@ public:
      */
     uint32_t getSize();
 
+    /**
+     * Sets the maximum size of the cache in bytes, evicting the oldest
+     * entries if the cache is over the new limit. Used by CacheGovernor to
+     * rebalance budgets between caches.
+     */
+    void setMaxSize(uint32_t maxSize);
+
+    /**
+     * Number of lookups since the last resetHitStats() that found a texture
+     * in the cache, and the number that did not. Speculative precache()
+     * lookups are not counted.
+     */
+    uint32_t hitCount() const { return mHits; }
+    uint32_t missCount() const { return mMisses; }
+    void resetHitStats() { mHits = mMisses = 0; }
+
     PathTexture* getRoundRect(float width, float height, float rx, float ry, const SkPaint* paint);
     PathTexture* getCircle(float radius, const SkPaint* paint);
     PathTexture* getOval(float width, float height, const SkPaint* paint);
@@ -225,7 +241,11 @@ private:
     void generateTexture(const PathDescription& entry, Bitmap& bitmap, PathTexture* texture,
                          bool addToCache = true);
 
-    PathTexture* get(const PathDescription& entry) { return mCache.get(entry); }
+    PathTexture* get(const PathDescription& entry) {
+        PathTexture* texture = mCache.get(entry);
+        texture ? mHits++ : mMisses++;
+        return texture;
+    }
 
     /**
      * Ensures there is enough space in the cache for a texture of the specified
@@ -250,9 +270,12 @@ private:
 
     LruCache<PathDescription, PathTexture*> mCache;
     uint32_t mSize;
-    const uint32_t mMaxSize;
+    uint32_t mMaxSize;
     GLuint mMaxTextureSize;
 
+    uint32_t mHits = 0;
+    uint32_t mMisses = 0;
+
     bool mDebugEnabled;
 
     sp<PathProcessor> mProcessor;
@@ -39,6 +39,8 @@
 #include "utils/MathUtils.h"
 
 #include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 #include <SkGeometry.h>  // WARNING: Internal Skia Header
 #include <SkPaint.h>
@@ -47,8 +49,10 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 
+#include <utils/JenkinsHash.h>
 #include <utils/Log.h>
 #include <utils/Trace.h>
 
@@ -60,6 +64,11 @@ namespace uirenderer {
 #define PI 3.1415926535897932f
 #define MAX_DEPTH 15
 
+// Paths with at least this many perimeter points are rebuilt as a deduplicated
+// vertex pool plus a 16-bit index buffer; simpler shapes keep the zero-copy
+// direct tessellation, where indexing overhead isn't worth it.
+#define VERTEX_INDEXING_THRESHOLD 64
+
 /**
  * Extracts the x and y scale from the transform as positive values, and clamps them
  */
@@ -681,6 +690,70 @@ void getStrokeVerticesFromPerimeterAA(const PaintInfo& paintInfo,
     DEBUG_DUMP_ALPHA_BUFFER();
 }
 
+/**
+ * Rebuilds a tessellated triangle strip as a deduplicated vertex pool plus a
+ * 16-bit index buffer, preserving the strip order. The tessellators above
+ * repeat vertices heavily - AA fringes, wrap-around copies and the interior
+ * fill all restate perimeter positions - so complex ornamental paths shrink
+ * substantially, and repeated indices hit the GPU's post-transform cache
+ * instead of re-fetching full vertices.
+ *
+ * Vertices are only merged when bit-identical. Returns true if the dst buffer
+ * holds an indexed mesh; falls back to a plain copy (returning false) when the
+ * pool would overflow 16-bit indices or indexing wouldn't shrink the buffer.
+ */
+template <class TYPE>
+static bool indexVertexBuffer(const VertexBuffer& srcBuffer, VertexBuffer& dstBuffer) {
+    const TYPE* srcVertices = reinterpret_cast<const TYPE*>(srcBuffer.getBuffer());
+    const unsigned int srcCount = srcBuffer.getVertexCount();
+
+    std::vector<TYPE> pool;
+    pool.reserve(srcCount);
+    std::vector<uint16_t> stripIndices;
+    stripIndices.reserve(srcCount);
+    // Maps a hash of the vertex bytes to its pool index; collisions are
+    // resolved by comparing against the pooled vertex.
+    std::unordered_multimap<uint32_t, uint16_t> vertexLookup;
+    vertexLookup.reserve(srcCount);
+
+    for (unsigned int i = 0; i < srcCount; i++) {
+        const TYPE& vertex = srcVertices[i];
+        uint32_t hash = JenkinsHashMixBytes(0, (uint8_t*)&vertex, sizeof(TYPE));
+
+        int poolIndex = -1;
+        auto range = vertexLookup.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (!memcmp(&pool[it->second], &vertex, sizeof(TYPE))) {
+                poolIndex = it->second;
+                break;
+            }
+        }
+        if (poolIndex < 0) {
+            if (CC_UNLIKELY(pool.size() >= UINT16_MAX)) {
+                // too many unique vertices for 16-bit indices, bail to the
+                // plain copy below
+                break;
+            }
+            poolIndex = pool.size();
+            pool.push_back(vertex);
+            vertexLookup.emplace(hash, static_cast<uint16_t>(poolIndex));
+        }
+        stripIndices.push_back(static_cast<uint16_t>(poolIndex));
+    }
+
+    if (stripIndices.size() == srcCount &&
+        pool.size() * sizeof(TYPE) + stripIndices.size() * sizeof(uint16_t) <
+                srcCount * sizeof(TYPE)) {
+        memcpy(dstBuffer.alloc<TYPE>(pool.size()), pool.data(), pool.size() * sizeof(TYPE));
+        memcpy(dstBuffer.allocIndices<uint16_t>(stripIndices.size()), stripIndices.data(),
+               stripIndices.size() * sizeof(uint16_t));
+        return true;
+    }
+
+    memcpy(dstBuffer.alloc<TYPE>(srcCount), srcVertices, srcCount * sizeof(TYPE));
+    return false;
+}
+
 void PathTessellator::tessellatePath(const SkPath& path, const SkPaint* paint,
                                      const mat4& transform, VertexBuffer& vertexBuffer) {
     ATRACE_CALL();
@@ -718,35 +791,50 @@ void PathTessellator::tessellatePath(const SkPath& path, const SkPaint* paint,
     }
 #endif
 
+    // Complex paths are tessellated into a scratch buffer and rebuilt as a
+    // deduplicated vertex pool with an index buffer; simple ones are emitted
+    // directly into the output buffer.
+    VertexBuffer tempBuffer;
+    const bool dedupe = tempVertices.size() >= VERTEX_INDEXING_THRESHOLD;
+    VertexBuffer& targetBuffer = dedupe ? tempBuffer : vertexBuffer;
+
     if (paintInfo.style == SkPaint::kStroke_Style) {
         if (!paintInfo.isAA) {
             if (wasClosed) {
-                getStrokeVerticesFromPerimeter(paintInfo, tempVertices, vertexBuffer);
+                getStrokeVerticesFromPerimeter(paintInfo, tempVertices, targetBuffer);
             } else {
-                getStrokeVerticesFromUnclosedVertices(paintInfo, tempVertices, vertexBuffer);
+                getStrokeVerticesFromUnclosedVertices(paintInfo, tempVertices, targetBuffer);
             }
 
         } else {
             if (wasClosed) {
-                getStrokeVerticesFromPerimeterAA(paintInfo, tempVertices, vertexBuffer);
+                getStrokeVerticesFromPerimeterAA(paintInfo, tempVertices, targetBuffer);
             } else {
-                getStrokeVerticesFromUnclosedVerticesAA(paintInfo, tempVertices, vertexBuffer);
+                getStrokeVerticesFromUnclosedVerticesAA(paintInfo, tempVertices, targetBuffer);
             }
         }
     } else {
         // For kStrokeAndFill style, the path should be adjusted externally.
         // It will be treated as a fill here.
         if (!paintInfo.isAA) {
-            getFillVerticesFromPerimeter(tempVertices, vertexBuffer);
+            getFillVerticesFromPerimeter(tempVertices, targetBuffer);
         } else {
-            getFillVerticesFromPerimeterAA(paintInfo, tempVertices, vertexBuffer);
+            getFillVerticesFromPerimeterAA(paintInfo, tempVertices, targetBuffer);
         }
     }
 
+    bool indexed = false;
+    if (dedupe) {
+        indexed = paintInfo.isAA ? indexVertexBuffer<AlphaVertex>(tempBuffer, vertexBuffer)
+                                 : indexVertexBuffer<Vertex>(tempBuffer, vertexBuffer);
+    }
+
     Rect bounds(path.getBounds());
     paintInfo.expandBoundsForStroke(&bounds);
     vertexBuffer.setBounds(bounds);
-    vertexBuffer.setMeshFeatureFlags(paintInfo.isAA ? VertexBuffer::kAlpha : VertexBuffer::kNone);
+    int meshFeatureFlags = paintInfo.isAA ? VertexBuffer::kAlpha : VertexBuffer::kNone;
+    if (indexed) meshFeatureFlags |= VertexBuffer::kIndices;
+    vertexBuffer.setMeshFeatureFlags(meshFeatureFlags);
 }
 
 template <class TYPE>
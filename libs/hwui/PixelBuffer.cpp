@@ -22,6 +22,7 @@
 #include "renderstate/RenderState.h"
 #include "utils/GLUtils.h"
 
+#include <GLES2/gl2ext.h>
 #include <utils/Log.h>
 
 namespace android {
@@ -141,12 +142,102 @@ void GpuPixelBuffer::upload(uint32_t x, uint32_t y, uint32_t width, uint32_t hei
     mCaches.pixelBufferState().unbind();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Persistently mapped GPU pixel buffer
+///////////////////////////////////////////////////////////////////////////////
+
+class PersistentGpuPixelBuffer : public PixelBuffer {
+public:
+    PersistentGpuPixelBuffer(GLenum format, uint32_t width, uint32_t height);
+    ~PersistentGpuPixelBuffer();
+
+    uint8_t* map(AccessMode mode = kAccessMode_ReadWrite) override;
+
+    void upload(uint32_t x, uint32_t y, uint32_t width, uint32_t height, int offset) override;
+
+protected:
+    void unmap() override;
+
+private:
+    GLuint mBuffer;
+    uint8_t* mMappedPointer;
+    // Fence inserted after the last upload; writes must wait on it so we don't
+    // scribble over pixels the GPU is still reading
+    GLsync mUploadFence;
+    Caches& mCaches;
+};
+
+PersistentGpuPixelBuffer::PersistentGpuPixelBuffer(GLenum format, uint32_t width, uint32_t height)
+        : PixelBuffer(format, width, height)
+        , mMappedPointer(nullptr)
+        , mUploadFence(nullptr)
+        , mCaches(Caches::getInstance()) {
+    glGenBuffers(1, &mBuffer);
+
+    // The mapping stays valid for the life of the buffer, so glyph rasterization
+    // writes land directly in GPU-visible memory with no map/unmap per frame
+    const GLbitfield flags =
+            GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+    mCaches.pixelBufferState().bind(mBuffer);
+    glBufferStorageEXT(GL_PIXEL_UNPACK_BUFFER, getSize(), nullptr, flags);
+    mMappedPointer = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, getSize(), flags);
+    if (CC_UNLIKELY(!mMappedPointer)) {
+        GLUtils::dumpGLErrors();
+        LOG_ALWAYS_FATAL("Failed to persistently map PBO");
+    }
+    mCaches.pixelBufferState().unbind();
+}
+
+PersistentGpuPixelBuffer::~PersistentGpuPixelBuffer() {
+    if (mUploadFence) {
+        glDeleteSync(mUploadFence);
+    }
+    mCaches.pixelBufferState().bind(mBuffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    mCaches.pixelBufferState().unbind();
+    glDeleteBuffers(1, &mBuffer);
+}
+
+uint8_t* PersistentGpuPixelBuffer::map(AccessMode mode) {
+    if (mAccessMode == kAccessMode_None) {
+        if (mUploadFence) {
+            // Writes from previous frames may still be in flight on the GPU
+            glClientWaitSync(mUploadFence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(mUploadFence);
+            mUploadFence = nullptr;
+        }
+        mAccessMode = mode;
+    }
+    return mMappedPointer;
+}
+
+void PersistentGpuPixelBuffer::unmap() {
+    // The mapping is persistent; just drop the access mode
+    mAccessMode = kAccessMode_None;
+}
+
+void PersistentGpuPixelBuffer::upload(uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                                      int offset) {
+    mCaches.pixelBufferState().bind(mBuffer);
+    unmap();
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, mFormat, GL_UNSIGNED_BYTE,
+                    reinterpret_cast<void*>(offset));
+    if (mUploadFence) {
+        glDeleteSync(mUploadFence);
+    }
+    mUploadFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    mCaches.pixelBufferState().unbind();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Factory
 ///////////////////////////////////////////////////////////////////////////////
 
 PixelBuffer* PixelBuffer::create(GLenum format, uint32_t width, uint32_t height, BufferType type) {
     if (type == kBufferType_Auto && Caches::getInstance().gpuPixelBuffersEnabled) {
+        if (Caches::getInstance().extensions().hasBufferStorage()) {
+            return new PersistentGpuPixelBuffer(format, width, height);
+        }
         return new GpuPixelBuffer(format, width, height);
     }
     return new CpuPixelBuffer(format, width, height);
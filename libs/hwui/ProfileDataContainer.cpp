@@ -29,12 +29,14 @@ namespace uirenderer {
 
 void ProfileDataContainer::freeData() {
     if (mIsMapped) {
-        munmap(mData, sizeof(ProfileData));
+        munmap(mData, mMappedSize);
     } else {
         delete mData;
     }
     mIsMapped = false;
+    mMappedSize = 0;
     mData = nullptr;
+    mFrameRing = nullptr;
 }
 
 void ProfileDataContainer::rotateStorage() {
@@ -62,18 +64,28 @@ void ProfileDataContainer::switchStorageToAshmem(int ashmemfd) {
               static_cast<unsigned int>(sizeof(ProfileData)));
         return;
     }
-    ProfileData* newData = reinterpret_cast<ProfileData*>(
-            mmap(NULL, sizeof(ProfileData), PROT_READ | PROT_WRITE, MAP_SHARED, ashmemfd, 0));
-    if (newData == MAP_FAILED) {
+    // Map the whole region; any space after the ProfileData hosts the frame
+    // timeline ring when the region was sized for one.
+    void* mapped = mmap(NULL, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, ashmemfd, 0);
+    if (mapped == MAP_FAILED) {
         int err = errno;
         ALOGW("Failed to move profile data to ashmem fd %d, error = %d", ashmemfd, err);
         return;
     }
+    ProfileData* newData = reinterpret_cast<ProfileData*>(mapped);
 
     newData->mergeWith(*mData);
     freeData();
     mData = newData;
+    mMappedSize = regionSize;
     mIsMapped = true;
+
+    // The ring starts at the first suitably aligned offset past the ProfileData.
+    size_t ringOffset = (sizeof(ProfileData) + alignof(FrameInfoRing) - 1) &
+                        ~(alignof(FrameInfoRing) - 1);
+    if (static_cast<size_t>(regionSize) >= ringOffset + sizeof(FrameInfoRing)) {
+        mFrameRing = reinterpret_cast<FrameInfoRing*>(reinterpret_cast<char*>(mapped) + ringOffset);
+    }
 }
 
 } /* namespace uirenderer */
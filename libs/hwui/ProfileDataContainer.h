@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "FrameInfoRing.h"
 #include "ProfileData.h"
 #include "utils/Macros.h"
 
@@ -36,12 +37,21 @@ public:
     ProfileData* get() { return mData; }
     ProfileData* operator->() { return mData; }
 
+    /**
+     * Frame timeline ring placed after the ProfileData when the ashmem region
+     * is large enough for one; null when malloc-backed or the region is only
+     * sized for the ProfileData.
+     */
+    FrameInfoRing* frameRing() { return mFrameRing; }
+
 private:
     void freeData();
 
     // By default this will use malloc memory. It may be moved later to ashmem
     // if there is shared space for it and a request comes in to do that.
     ProfileData* mData = new ProfileData;
+    FrameInfoRing* mFrameRing = nullptr;
+    size_t mMappedSize = 0;
     bool mIsMapped = false;
 };
 
@@ -14,8 +14,12 @@
  * limitations under the License.
  */
 
+#include <string.h>
+
 #include <utils/Trace.h>
 
+#include <GLES3/gl3.h>
+
 #include "Program.h"
 #include "Vertex.h"
 
@@ -31,6 +35,11 @@ Program::Program(const ProgramDescription& description, const char* vertex, cons
     mHasColorUniform = false;
     mHasSampler = false;
     mUse = false;
+    mHasCachedTransform = false;
+    mHasCachedColor = false;
+    mHasCachedColorFilterBlend = false;
+    mHasCachedColorFilterMatrix = false;
+    mHasCachedRoundRectClip = false;
 
     // No need to cache compiled shaders, rely instead on Android's
     // persistent shaders cache
@@ -79,7 +88,69 @@ Program::Program(const ProgramDescription& description, const char* vertex, cons
     }
 }
 
+Program::Program(const ProgramDescription& description, const void* binary, GLsizei length,
+                 GLenum format) {
+    mInitialized = false;
+    mHasColorUniform = false;
+    mHasSampler = false;
+    mUse = false;
+    mHasCachedTransform = false;
+    mHasCachedColor = false;
+    mHasCachedColorFilterBlend = false;
+    mHasCachedColorFilterMatrix = false;
+    mHasCachedRoundRectClip = false;
+    mVertexShader = 0;
+    mFragmentShader = 0;
+
+    mProgramId = glCreateProgram();
+
+    ATRACE_BEGIN("loadProgramBinary");
+    glProgramBinary(mProgramId, format, binary, length);
+    ATRACE_END();
+
+    GLint status;
+    glGetProgramiv(mProgramId, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        // Stale binary (driver update, different GPU); caller falls back to
+        // compiling from source
+        glDeleteProgram(mProgramId);
+        mProgramId = 0;
+        return;
+    }
+
+    mInitialized = true;
+    texCoords = (description.hasTexture || description.hasExternalTexture) ? kBindingTexCoords : -1;
+    transform = addUniform("transform");
+    projection = addUniform("projection");
+}
+
+bool Program::getBinary(GLenum* outFormat, std::vector<uint8_t>* outBinary) const {
+    if (!mInitialized) return false;
+
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount < 1) return false;
+
+    GLint length = 0;
+    glGetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return false;
+
+    outBinary->resize(length);
+    GLsizei written = 0;
+    glGetProgramBinary(mProgramId, length, &written, outFormat, outBinary->data());
+    if (written <= 0) return false;
+    outBinary->resize(written);
+    return true;
+}
+
 Program::~Program() {
+    if (!mVertexShader && !mFragmentShader) {
+        // built from a program binary; there are no shader objects to detach
+        if (mProgramId) {
+            glDeleteProgram(mProgramId);
+        }
+        return;
+    }
     if (mInitialized) {
         // This would ideally happen after linking the program
         // but Tegra drivers, especially when perfhud is enabled,
@@ -171,7 +242,11 @@ void Program::set(const mat4& projectionMatrix, const mat4& modelViewMatrix,
 
     mat4 t(transformMatrix);
     t.multiply(modelViewMatrix);
-    glUniformMatrix4fv(transform, 1, GL_FALSE, &t.data[0]);
+    if (!mHasCachedTransform || t != mTransform) {
+        glUniformMatrix4fv(transform, 1, GL_FALSE, &t.data[0]);
+        mTransform = t;
+        mHasCachedTransform = true;
+    }
 }
 
 void Program::setColor(FloatColor color) {
@@ -179,7 +254,45 @@ void Program::setColor(FloatColor color) {
         mColorUniform = getUniform("color");
         mHasColorUniform = true;
     }
+    if (mHasCachedColor && color == mCachedColor) return;
     glUniform4f(mColorUniform, color.r, color.g, color.b, color.a);
+    mCachedColor = color;
+    mHasCachedColor = true;
+}
+
+void Program::setColorFilterBlend(const FloatColor& color) {
+    if (mHasCachedColorFilterBlend && color == mCachedColorFilterBlend) return;
+    glUniform4f(getUniform("colorBlend"), color.r, color.g, color.b, color.a);
+    mCachedColorFilterBlend = color;
+    mHasCachedColorFilterBlend = true;
+}
+
+void Program::setColorFilterMatrix(const float* matrix, const float* vector) {
+    if (mHasCachedColorFilterMatrix &&
+        !memcmp(matrix, mCachedColorFilterMatrix, sizeof(mCachedColorFilterMatrix)) &&
+        !memcmp(vector, mCachedColorFilterVector, sizeof(mCachedColorFilterVector))) {
+        return;
+    }
+    glUniformMatrix4fv(getUniform("colorMatrix"), 1, GL_FALSE, matrix);
+    glUniform4fv(getUniform("colorMatrixVector"), 1, vector);
+    memcpy(mCachedColorFilterMatrix, matrix, sizeof(mCachedColorFilterMatrix));
+    memcpy(mCachedColorFilterVector, vector, sizeof(mCachedColorFilterVector));
+    mHasCachedColorFilterMatrix = true;
+}
+
+void Program::setRoundRectClip(const float rectLTWH[4], const mat4& invTransform, float radius) {
+    if (mHasCachedRoundRectClip && radius == mCachedRoundRectRadius &&
+        !memcmp(rectLTWH, mCachedRoundRectLTWH, sizeof(mCachedRoundRectLTWH)) &&
+        invTransform == mCachedRoundRectInvTransform) {
+        return;
+    }
+    glUniform4fv(getUniform("roundRectInnerRectLTWH"), 1, rectLTWH);
+    glUniformMatrix4fv(getUniform("roundRectInvTransform"), 1, GL_FALSE, &invTransform.data[0]);
+    glUniform1f(getUniform("roundRectRadius"), radius);
+    memcpy(mCachedRoundRectLTWH, rectLTWH, sizeof(mCachedRoundRectLTWH));
+    mCachedRoundRectInvTransform = invTransform;
+    mCachedRoundRectRadius = radius;
+    mHasCachedRoundRectClip = true;
 }
 
 void Program::use() {
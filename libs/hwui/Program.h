@@ -24,6 +24,8 @@
 
 #include <SkBlendMode.h>
 
+#include <vector>
+
 #include "Debug.h"
 #include "FloatColor.h"
 #include "Matrix.h"
@@ -94,6 +96,12 @@ namespace uirenderer {
 #define PROGRAM_TRANSFER_FUNCTION 47  // 2 bits for transfer function
 #define PROGRAM_HAS_TRANSLUCENT_CONVERSION 49
 
+#define PROGRAM_GRADIENT_STOP_COUNT_SHIFT 50  // 3 bits for procedural gradient stop count
+
+// Gradients with at most this many stops are evaluated directly in the
+// fragment shader from uniform arrays instead of a GradientCache texture
+#define PROGRAM_MAX_GRADIENT_STOPS 5
+
 ///////////////////////////////////////////////////////////////////////////////
 // Types
 ///////////////////////////////////////////////////////////////////////////////
@@ -139,6 +147,9 @@ struct ProgramDescription {
     bool hasGradient;
     Gradient gradientType;
     bool isSimpleGradient;
+    // Number of stops evaluated procedurally in the fragment shader, or 0
+    // when the gradient uses the texture ramp or the two-stop fast path
+    uint8_t gradientStopCount;
 
     SkBlendMode shadersMode;
 
@@ -192,6 +203,7 @@ struct ProgramDescription {
         hasGradient = false;
         gradientType = kGradientLinear;
         isSimpleGradient = false;
+        gradientStopCount = 0;
 
         shadersMode = SkBlendMode::kClear;
 
@@ -288,6 +300,7 @@ struct ProgramDescription {
         key |= programid(hasColorSpaceConversion) << PROGRAM_HAS_COLOR_SPACE_CONVERSION;
         key |= programid(transferFunction) << PROGRAM_TRANSFER_FUNCTION;
         key |= programid(hasTranslucentConversion) << PROGRAM_HAS_TRANSLUCENT_CONVERSION;
+        key |= programid(gradientStopCount) << PROGRAM_GRADIENT_STOP_COUNT_SHIFT;
         return key;
     }
 
@@ -329,8 +342,23 @@ public:
      * shaders sources.
      */
     Program(const ProgramDescription& description, const char* vertex, const char* fragment);
+
+    /**
+     * Creates a new program from a driver binary previously retrieved with
+     * getBinary(). Attribute bindings are baked into the binary by the
+     * original link. Check isInitialized() to detect a rejected binary.
+     */
+    Program(const ProgramDescription& description, const void* binary, GLsizei length,
+            GLenum format);
+
     virtual ~Program();
 
+    /**
+     * Retrieves this program's binary from the driver. Returns false if the
+     * program is not initialized or the driver exposes no binary formats.
+     */
+    bool getBinary(GLenum* outFormat, std::vector<uint8_t>* outBinary) const;
+
     /**
      * Binds this program to the GL context.
      */
@@ -375,6 +403,22 @@ public:
      */
     void setColor(FloatColor color);
 
+    /**
+     * Sets the color filter blend color uniform.
+     */
+    void setColorFilterBlend(const FloatColor& color);
+
+    /**
+     * Sets the color filter matrix/vector uniforms.
+     */
+    void setColorFilterMatrix(const float* matrix, const float* vector);
+
+    /**
+     * Sets the round rect clip uniforms. The rect is passed as left/top/
+     * width/height, already divided by the rounded-out radius.
+     */
+    void setRoundRectClip(const float rectLTWH[4], const mat4& invTransform, float radius);
+
     /**
      * Name of the texCoords attribute if it exists (kBindingTexCoords), -1 otherwise.
      */
@@ -438,6 +482,26 @@ private:
 
     mat4 mProjection;
     bool mOffset;
+
+    // Last uniform values sent for this program; consecutive draws that
+    // share them skip the glUniform* calls entirely.
+    mat4 mTransform;
+    bool mHasCachedTransform;
+
+    FloatColor mCachedColor;
+    bool mHasCachedColor;
+
+    FloatColor mCachedColorFilterBlend;
+    bool mHasCachedColorFilterBlend;
+
+    float mCachedColorFilterMatrix[16];
+    float mCachedColorFilterVector[4];
+    bool mHasCachedColorFilterMatrix;
+
+    float mCachedRoundRectLTWH[4];
+    mat4 mCachedRoundRectInvTransform;
+    float mCachedRoundRectRadius;
+    bool mHasCachedRoundRectClip;
 };  // class Program
 
 };  // namespace uirenderer
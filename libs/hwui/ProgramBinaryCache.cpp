@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ProgramBinaryCache.h"
+
+#include <log/log.h>
+#include <string.h>
+
+#include "FileBlobCache.h"
+#include "Properties.h"
+#include "utils/TraceUtils.h"
+
+namespace android {
+namespace uirenderer {
+
+// Cache size limits. Program binaries are larger than SKSL blobs, but there
+// are only a few dozen distinct ProgramDescription keys in practice.
+static const size_t maxKeySize = sizeof(programid);
+static const size_t maxValueSize = 128 * 1024;
+static const size_t maxTotalSize = 1024 * 1024;
+
+ProgramBinaryCache::ProgramBinaryCache() {
+    // FileBlobCache is an incomplete type in the header; the ctor lives here.
+}
+
+ProgramBinaryCache ProgramBinaryCache::sCache;
+
+ProgramBinaryCache& ProgramBinaryCache::get() {
+    return sCache;
+}
+
+void ProgramBinaryCache::setFilename(const char* filename) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mFilename = filename;
+}
+
+void ProgramBinaryCache::initProgramDiskCache() {
+    ATRACE_NAME("initProgramDiskCache");
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // Program binaries from the host GPU are useless to an emulator's
+    // translator, and may be actively harmful across snapshot migrations.
+    if (!Properties::runningInEmulator && mFilename.length() > 0) {
+        mBlobCache.reset(new FileBlobCache(maxKeySize, maxValueSize, maxTotalSize, mFilename));
+        mInitialized = true;
+    }
+}
+
+Program* ProgramBinaryCache::load(const ProgramDescription& description, programid key) {
+    ATRACE_NAME("ProgramBinaryCache::load");
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mInitialized) {
+        return nullptr;
+    }
+
+    // Stored value layout: GLenum binary format, followed by the binary
+    uint8_t value[sizeof(GLenum) + maxValueSize];
+    size_t valueSize = mBlobCache->get(&key, sizeof(key), value, sizeof(value));
+    if (valueSize <= sizeof(GLenum) || valueSize > sizeof(value)) {
+        return nullptr;
+    }
+
+    GLenum format;
+    memcpy(&format, value, sizeof(format));
+    Program* program = new Program(description, value + sizeof(GLenum),
+                                   valueSize - sizeof(GLenum), format);
+    if (!program->isInitialized()) {
+        // driver rejected the binary; drop it and recompile from source
+        delete program;
+        return nullptr;
+    }
+    return program;
+}
+
+void ProgramBinaryCache::store(programid key, const Program& program) {
+    ATRACE_NAME("ProgramBinaryCache::store");
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mInitialized) {
+        return;
+    }
+
+    GLenum format;
+    std::vector<uint8_t> binary;
+    if (!program.getBinary(&format, &binary)) {
+        return;
+    }
+    if (binary.size() == 0 || binary.size() > maxValueSize) {
+        ALOGW("ProgramBinaryCache::store: binary size %zu not allowed", binary.size());
+        return;
+    }
+
+    std::vector<uint8_t> value(sizeof(GLenum) + binary.size());
+    memcpy(value.data(), &format, sizeof(format));
+    memcpy(value.data() + sizeof(GLenum), binary.data(), binary.size());
+    mBlobCache->set(&key, sizeof(key), value.data(), value.size());
+    mBlobCache->writeToFile();
+}
+
+};  // namespace uirenderer
+};  // namespace android
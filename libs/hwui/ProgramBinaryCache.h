@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_HWUI_PROGRAM_BINARY_CACHE_H
+#define ANDROID_HWUI_PROGRAM_BINARY_CACHE_H
+
+#include <cutils/compiler.h>
+
+#include <GLES2/gl2.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Program.h"
+
+namespace android {
+
+class FileBlobCache;
+
+namespace uirenderer {
+
+/**
+ * Persists glGetProgramBinary blobs for the legacy OpenGL pipeline's programs,
+ * keyed by ProgramDescription::key(). This is the legacy-pipeline counterpart
+ * of the Skia pipeline's ShaderCache: scenes whose programs were linked in a
+ * previous process start load pre-linked binaries instead of compiling GLSL.
+ */
+class ProgramBinaryCache {
+public:
+    /**
+     * Returns the singleton ProgramBinaryCache object. This singleton object
+     * will never be destroyed.
+     */
+    ANDROID_API static ProgramBinaryCache& get();
+
+    /**
+     * Sets the name of the file used to persist program binaries between
+     * process invocations. Performs no disk access; must be invoked before
+     * initProgramDiskCache().
+     */
+    void setFilename(const char* filename);
+
+    /**
+     * Loads the serialized cache contents from disk and puts the cache in an
+     * initialized state. Before this is called, load and store are no-ops.
+     */
+    void initProgramDiskCache();
+
+    /**
+     * Attempts to build a Program for the given description from a cached
+     * binary. Returns nullptr on a cache miss or if the driver rejects the
+     * binary (e.g. after a driver update).
+     */
+    Program* load(const ProgramDescription& description, programid key);
+
+    /**
+     * Retrieves the program's binary from the driver and persists it under
+     * the given key. No-op if the program exposes no binary.
+     */
+    void store(programid key, const Program& program);
+
+private:
+    ProgramBinaryCache();
+
+    std::mutex mMutex;
+    std::unique_ptr<FileBlobCache> mBlobCache;
+    std::string mFilename;
+    bool mInitialized = false;
+
+    static ProgramBinaryCache sCache;
+};  // class ProgramBinaryCache
+
+};  // namespace uirenderer
+};  // namespace android
+
+#endif  // ANDROID_HWUI_PROGRAM_BINARY_CACHE_H
@@ -17,6 +17,7 @@
 #include <utils/String8.h>
 
 #include "Caches.h"
+#include "ProgramBinaryCache.h"
 #include "ProgramCache.h"
 #include "Properties.h"
 
@@ -120,6 +121,10 @@ const char* gFS_Uniforms_GradientSampler[2] = {
         "uniform vec2 screenSize;\n"
         "uniform vec4 startColor;\n"
         "uniform vec4 endColor;\n"};
+const char* gFS_Uniforms_MultiStopGradient =
+        "uniform vec2 screenSize;\n"
+        "uniform vec4 gradientColors[%d];\n"
+        "uniform float gradientPositions[%d];\n";
 const char* gFS_Uniforms_BitmapSampler = "uniform sampler2D bitmapSampler;\n";
 const char* gFS_Uniforms_BitmapExternalSampler = "uniform samplerExternalOES bitmapSampler;\n";
 const char* gFS_Uniforms_ColorOp[3] = {
@@ -334,6 +339,26 @@ const char* gFS_Main_FetchGradient[6] = {
         "    highp float index = atan(sweep.y, sweep.x) * 0.15915494309; // inv(2 * PI)\n"
         "    vec4 gradientColor = mix(startColor, endColor, clamp(index - floor(index), 0.0, "
         "1.0));\n"};
+const char* gFS_Main_GradientPosition[3] = {
+        // Linear
+        "    highp float gradientPos = linear;\n",
+        // Circular
+        "    highp float gradientPos = length(circular);\n",
+        // Sweep
+        "    highp float index = atan(sweep.y, sweep.x) * 0.15915494309; // inv(2 * PI)\n"
+        "    highp float gradientPos = index - floor(index);\n",
+};
+// The loop bound is baked into the shader source so this stays within the
+// constant-index-expression rules of GLSL ES 2.0; each mix() is a no-op
+// outside its stop interval thanks to the clamp
+const char* gFS_Main_FetchMultiStopGradient =
+        "    vec4 gradientColor = gradientColors[0];\n"
+        "    for (int i = 1; i < %d; i++) {\n"
+        "        gradientColor = mix(gradientColor, gradientColors[i],\n"
+        "                clamp((gradientPos - gradientPositions[i - 1])\n"
+        "                        / max(gradientPositions[i] - gradientPositions[i - 1], 1.0e-5),\n"
+        "                        0.0, 1.0));\n"
+        "    }\n";
 const char* gFS_Main_FetchBitmap =
         "    vec4 bitmapColor = colorConvert(texture2D(bitmapSampler, outBitmapTexCoords));\n";
 const char* gFS_Main_FetchBitmapNpot =
@@ -488,7 +513,15 @@ Program* ProgramCache::get(const ProgramDescription& description) {
     Program* program = nullptr;
     if (iter == mCache.end()) {
         description.log("Could not find program");
-        program = generateProgram(description, key);
+        if (mHasES3) {
+            program = ProgramBinaryCache::get().load(description, key);
+        }
+        if (!program) {
+            program = generateProgram(description, key);
+            if (mHasES3) {
+                ProgramBinaryCache::get().store(key, *program);
+            }
+        }
         mCache[key] = std::unique_ptr<Program>(program);
     } else {
         program = iter->second.get();
@@ -508,7 +541,10 @@ Program* ProgramCache::generateProgram(const ProgramDescription& description, pr
 }
 
 static inline size_t gradientIndex(const ProgramDescription& description) {
-    return description.gradientType * 2 + description.isSimpleGradient;
+    // multi-stop procedural gradients share the simple variants' varyings,
+    // since both evaluate the ramp from an interpolated position
+    return description.gradientType * 2 +
+           (description.isSimpleGradient || description.gradientStopCount > 0);
 }
 
 String8 ProgramCache::generateVertexShader(const ProgramDescription& description) {
@@ -648,7 +684,12 @@ String8 ProgramCache::generateFragmentShader(const ProgramDescription& descripti
         shader.append(gFS_Uniforms_ExternalTextureSampler);
     }
     if (description.hasGradient) {
-        shader.append(gFS_Uniforms_GradientSampler[description.isSimpleGradient]);
+        if (description.gradientStopCount) {
+            shader.appendFormat(gFS_Uniforms_MultiStopGradient, description.gradientStopCount,
+                                description.gradientStopCount);
+        } else {
+            shader.append(gFS_Uniforms_GradientSampler[description.isSimpleGradient]);
+        }
     }
     if (description.hasRoundRectClip) {
         shader.append(gFS_Uniforms_HasRoundRectClip);
@@ -724,7 +765,13 @@ String8 ProgramCache::generateFragmentShader(const ProgramDescription& descripti
             }
         }
         if (description.hasGradient) {
-            shader.append(gFS_Main_FetchGradient[gradientIndex(description)]);
+            if (description.gradientStopCount) {
+                shader.append(gFS_Main_GradientPosition[description.gradientType]);
+                shader.appendFormat(gFS_Main_FetchMultiStopGradient,
+                                    description.gradientStopCount);
+            } else {
+                shader.append(gFS_Main_FetchGradient[gradientIndex(description)]);
+            }
         }
         if (description.hasBitmap) {
             if (!description.useShaderBasedWrap) {
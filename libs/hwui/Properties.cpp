@@ -34,6 +34,8 @@ bool Properties::debugLayersUpdates = false;
 bool Properties::debugOverdraw = false;
 bool Properties::showDirtyRegions = false;
 bool Properties::skipEmptyFrames = true;
+bool Properties::framePipelining = false;
+bool Properties::dynamicRenderScale = false;
 bool Properties::useBufferAge = true;
 bool Properties::enablePartialUpdates = true;
 
@@ -133,6 +135,8 @@ bool Properties::load() {
     debugLevel = (DebugLevel)property_get_int(PROPERTY_DEBUG, kDebugDisabled);
 
     skipEmptyFrames = property_get_bool(PROPERTY_SKIP_EMPTY_DAMAGE, true);
+    framePipelining = property_get_bool(PROPERTY_FRAME_PIPELINING, false);
+    dynamicRenderScale = property_get_bool(PROPERTY_DYNAMIC_RENDER_SCALE, false);
     useBufferAge = property_get_bool(PROPERTY_USE_BUFFER_AGE, true);
     enablePartialUpdates = property_get_bool(PROPERTY_ENABLE_PARTIAL_UPDATES, true);
 
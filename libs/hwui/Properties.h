@@ -136,6 +136,24 @@ enum DebugLevel {
  */
 #define PROPERTY_SKIP_EMPTY_DAMAGE "debug.hwui.skip_empty_damage"
 
+/**
+ * Setting this property to "true" lets the RenderThread queue the draw of a
+ * synced frame instead of drawing it inline, so the next frame's sync can
+ * overtake a draw that hasn't started yet. A queued draw that is overtaken
+ * is dropped, since the newer sync has already replaced its content.
+ * Default is "false".
+ */
+#define PROPERTY_FRAME_PIPELINING "debug.hwui.frame_pipelining"
+
+/**
+ * Setting this property to "true" enables dynamic render scaling: when frames
+ * keep missing their deadline, rendering drops to a reduced-resolution buffer
+ * that the compositor upscales to the window, and returns to full resolution
+ * once there is sustained headroom. Intended for thermally limited devices.
+ * Default is "false".
+ */
+#define PROPERTY_DYNAMIC_RENDER_SCALE "debug.hwui.dynamic_render_scale"
+
 /**
  * Controls whether or not HWUI will use the EGL_EXT_buffer_age extension
  * to do partial invalidates. Setting this to "false" will fall back to
@@ -218,6 +236,8 @@ public:
     static bool showDirtyRegions;
     // TODO: Remove after stabilization period
     static bool skipEmptyFrames;
+    static bool framePipelining;
+    static bool dynamicRenderScale;
     static bool useBufferAge;
     static bool enablePartialUpdates;
 
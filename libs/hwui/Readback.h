@@ -21,6 +21,8 @@
 
 #include <SkBitmap.h>
 
+#include <functional>
+
 namespace android {
 class GraphicBuffer;
 class Surface;
@@ -36,6 +38,11 @@ enum class CopyResult {
     DestinationInvalid = 5,
 };
 
+/**
+ * Invoked on the RenderThread when an asynchronous copy completes.
+ */
+using CopyCallback = std::function<void(CopyResult)>;
+
 class Readback {
 public:
     /**
@@ -44,6 +51,18 @@ public:
     virtual CopyResult copySurfaceInto(Surface& surface, const Rect& srcRect, SkBitmap* bitmap) = 0;
     virtual CopyResult copyGraphicBufferInto(GraphicBuffer* graphicBuffer, SkBitmap* bitmap) = 0;
 
+    /**
+     * Like copySurfaceInto, but returns without waiting for the GPU when the
+     * pipeline supports it; the callback runs on the RenderThread once the
+     * copy has landed in the bitmap. The bitmap must stay valid until then.
+     * Pipelines without an asynchronous path copy synchronously before
+     * invoking the callback.
+     */
+    virtual void copySurfaceIntoAsync(Surface& surface, const Rect& srcRect, SkBitmap* bitmap,
+                                      CopyCallback callback) {
+        callback(copySurfaceInto(surface, srcRect, bitmap));
+    }
+
 protected:
     explicit Readback(renderthread::RenderThread& thread) : mRenderThread(thread) {}
     virtual ~Readback() {}
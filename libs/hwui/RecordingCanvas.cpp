@@ -41,6 +41,8 @@ void RecordingCanvas::resetRecording(int width, int height, RenderNode* node) {
     mState.initializeRecordingSaveStack(width, height);
 
     mDeferredBarrierType = DeferredBarrierType::InOrder;
+    mFingerprint = kFingerprintSeed;
+    mFingerprintValid = true;
 }
 
 DisplayList* RecordingCanvas::finishRecording() {
@@ -49,6 +51,7 @@ DisplayList* RecordingCanvas::finishRecording() {
     mRegionMap.clear();
     mPathMap.clear();
     DisplayList* displayList = mDisplayList;
+    displayList->mContentFingerprint = mFingerprintValid ? mFingerprint : 0;
     mDisplayList = nullptr;
     mSkiaCanvasProxy.reset(nullptr);
     return displayList;
@@ -237,6 +240,8 @@ bool RecordingCanvas::clipPath(const SkPath* path, SkClipOp op) {
 // android/graphics/Canvas draw operations
 // ----------------------------------------------------------------------------
 void RecordingCanvas::drawColor(int color, SkBlendMode mode) {
+    mix(color);
+    mix(mode);
     addOp(alloc().create_trivial<ColorOp>(getRecordedClip(), color, mode));
 }
 
@@ -347,6 +352,8 @@ void RecordingCanvas::drawRoundRect(float left, float top, float right, float bo
     if (CC_UNLIKELY(paint.nothingToDraw())) return;
 
     if (CC_LIKELY(MathUtils::isPositive(rx) || MathUtils::isPositive(ry))) {
+        mix(rx);
+        mix(ry);
         addOp(alloc().create_trivial<RoundRectOp>(Rect(left, top, right, bottom),
                                                   *(mState.currentSnapshot()->transform),
                                                   getRecordedClip(), refPaint(&paint), rx, ry));
@@ -367,6 +374,15 @@ void RecordingCanvas::drawRoundRect(CanvasPropertyPrimitive* left, CanvasPropert
     mDisplayList->ref(ry);
     mDisplayList->ref(paint);
     refBitmapsInShader(paint->value.getShader());
+    // CanvasProperties are stable objects whose values animate without
+    // re-recording, so identity is the content here
+    mix(left);
+    mix(top);
+    mix(right);
+    mix(bottom);
+    mix(rx);
+    mix(ry);
+    mix(paint);
     addOp(alloc().create_trivial<RoundRectPropsOp>(
             *(mState.currentSnapshot()->transform), getRecordedClip(), &paint->value, &left->value,
             &top->value, &right->value, &bottom->value, &rx->value, &ry->value));
@@ -386,6 +402,10 @@ void RecordingCanvas::drawCircle(CanvasPropertyPrimitive* x, CanvasPropertyPrimi
     mDisplayList->ref(radius);
     mDisplayList->ref(paint);
     refBitmapsInShader(paint->value.getShader());
+    mix(x);
+    mix(y);
+    mix(radius);
+    mix(paint);
     addOp(alloc().create_trivial<CirclePropsOp>(*(mState.currentSnapshot()->transform),
                                                 getRecordedClip(), &paint->value, &x->value,
                                                 &y->value, &radius->value));
@@ -407,6 +427,9 @@ void RecordingCanvas::drawArc(float left, float top, float right, float bottom,
     if (fabs(sweepAngle) >= 360.0f) {
         drawOval(left, top, right, bottom, paint);
     } else {
+        mix(startAngle);
+        mix(sweepAngle);
+        mix(useCenter);
         addOp(alloc().create_trivial<ArcOp>(
                 Rect(left, top, right, bottom), *(mState.currentSnapshot()->transform),
                 getRecordedClip(), refPaint(&paint), startAngle, sweepAngle, useCenter));
@@ -424,6 +447,7 @@ void RecordingCanvas::drawPath(const SkPath& path, const SkPaint& paint) {
 void RecordingCanvas::drawVectorDrawable(VectorDrawableRoot* tree) {
     mDisplayList->ref(tree);
     mDisplayList->vectorDrawables.push_back(tree);
+    mix(tree);
     addOp(alloc().create_trivial<VectorDrawableOp>(
             tree, Rect(tree->stagingProperties()->getBounds()),
             *(mState.currentSnapshot()->transform), getRecordedClip()));
@@ -469,6 +493,7 @@ void RecordingCanvas::drawBitmap(Bitmap& bitmap, float srcLeft, float srcTop, fl
         drawBitmap(bitmap, paint);
         restore();
     } else {
+        mix(Rect(srcLeft, srcTop, srcRight, srcBottom));
         addOp(alloc().create_trivial<BitmapRectOp>(
                 Rect(dstLeft, dstTop, dstRight, dstBottom), *(mState.currentSnapshot()->transform),
                 getRecordedClip(), refPaint(paint), refBitmap(bitmap),
@@ -480,6 +505,8 @@ void RecordingCanvas::drawBitmapMesh(Bitmap& bitmap, int meshWidth, int meshHeig
                                      const float* vertices, const int* colors,
                                      const SkPaint* paint) {
     int vertexCount = (meshWidth + 1) * (meshHeight + 1);
+    mix(meshWidth);
+    mix(meshHeight);
     addOp(alloc().create_trivial<BitmapMeshOp>(
             calcBoundsOfPoints(vertices, vertexCount * 2), *(mState.currentSnapshot()->transform),
             getRecordedClip(), refPaint(paint), refBitmap(bitmap), meshWidth, meshHeight,
@@ -509,6 +536,11 @@ void RecordingCanvas::drawGlyphs(ReadGlyphFunc glyphFunc, int glyphCount, const
     float* positions = (float*)alloc().alloc<float>(2 * glyphCount * sizeof(float));
     glyphFunc(glyphs, positions);
 
+    mixBytes(glyphs, glyphCount * sizeof(glyph_t));
+    mixBytes(positions, 2 * glyphCount * sizeof(float));
+    mix(x);
+    mix(y);
+
     // TODO: either must account for text shadow in bounds, or record separate ops for text shadows
     addOp(alloc().create_trivial<TextOp>(Rect(boundsLeft, boundsTop, boundsRight, boundsBottom),
                                          *(mState.currentSnapshot()->transform), getRecordedClip(),
@@ -525,6 +557,8 @@ void RecordingCanvas::drawLayoutOnPath(const minikin::Layout& layout, float hOff
         float x = hOffset + layout.getX(i);
         float y = vOffset + layout.getY(i);
         if (paint.nothingToDraw()) return;
+        mix(x);
+        mix(y);
         const uint16_t* tempGlyphs = refBuffer<glyph_t>(glyphs, 1);
         addOp(alloc().create_trivial<TextOnPathOp>(*(mState.currentSnapshot()->transform),
                                                    getRecordedClip(), refPaint(&paint), tempGlyphs,
@@ -540,6 +574,10 @@ void RecordingCanvas::drawBitmap(Bitmap& bitmap, const SkPaint* paint) {
 
 void RecordingCanvas::drawRenderNode(RenderNode* renderNode) {
     auto&& stagingProps = renderNode->stagingProperties();
+    mix(renderNode);
+    // projectionReceiveIndex is derived from this at record time, so it must
+    // participate in the fingerprint even though it's a property
+    mix(stagingProps.isProjectionReceiver());
     RenderNodeOp* op = alloc().create_trivial<RenderNodeOp>(
             Rect(stagingProps.getWidth(), stagingProps.getHeight()),
             *(mState.currentSnapshot()->transform), getRecordedClip(), renderNode);
@@ -563,6 +601,7 @@ void RecordingCanvas::drawLayer(DeferredLayerUpdater* layerHandle) {
     mDisplayList->ref(layerHandle);
 
     LOG_ALWAYS_FATAL_IF(layerHandle->getBackingLayerApi() != Layer::Api::OpenGL);
+    mix(layerHandle);
     // Note that the backing layer has *not* yet been updated, so don't trust
     // its width, height, transform, etc...!
     addOp(alloc().create_trivial<TextureLayerOp>(
@@ -573,10 +612,35 @@ void RecordingCanvas::drawLayer(DeferredLayerUpdater* layerHandle) {
 void RecordingCanvas::callDrawGLFunction(Functor* functor, GlFunctorLifecycleListener* listener) {
     mDisplayList->functors.push_back({functor, listener});
     mDisplayList->ref(listener);
+    mix(functor);
     addOp(alloc().create_trivial<FunctorOp>(*(mState.currentSnapshot()->transform),
                                             getRecordedClip(), functor));
 }
 
+void RecordingCanvas::mixOp(const RecordedOp& op) {
+    mix(op.opId);
+    mix(op.unmappedBounds);
+    mixBytes(op.localMatrix.data, sizeof(op.localMatrix.data));
+    mix(op.localClip != nullptr);
+    if (op.localClip) {
+        if (CC_UNLIKELY(op.localClip->mode != ClipMode::Rectangle)) {
+            // Rectangle lists and regions aren't cheap to summarize by value,
+            // so poison the fingerprint rather than risk treating two
+            // recordings with different complex clips as identical.
+            mFingerprintValid = false;
+        }
+        mix(op.localClip->mode);
+        mix(op.localClip->intersectWithRoot);
+        mix(op.localClip->rect);
+    }
+    if (op.paint) {
+        // Covers the paint's value fields; paints whose effects (shaders etc.)
+        // are recreated between recordings hash differently, which only costs
+        // us a missed dedup, never a false match
+        mix(op.paint->getHash());
+    }
+}
+
 int RecordingCanvas::addOp(RecordedOp* op) {
     // skip op with empty clip
     if (op->localClip && op->localClip->rect.isEmpty()) {
@@ -586,6 +650,8 @@ int RecordingCanvas::addOp(RecordedOp* op) {
         return -1;
     }
 
+    mixOp(*op);
+
     int insertIndex = mDisplayList->ops.size();
     mDisplayList->ops.push_back(op);
     if (mDeferredBarrierType != DeferredBarrierType::None) {
@@ -597,6 +663,15 @@ int RecordingCanvas::addOp(RecordedOp* op) {
         newChunk.reorderChildren = (mDeferredBarrierType == DeferredBarrierType::OutOfOrder);
         newChunk.reorderClip = mDeferredBarrierClip;
 
+        // chunk boundaries change how children are reordered, so they are
+        // part of the content fingerprint too
+        mix(newChunk.reorderChildren);
+        mix(newChunk.reorderClip != nullptr);
+        if (newChunk.reorderClip) {
+            mix(newChunk.reorderClip->mode);
+            mix(newChunk.reorderClip->rect);
+        }
+
         int nextChildIndex = mDisplayList->children.size();
         newChunk.beginChildIndex = newChunk.endChildIndex = nextChildIndex;
         mDeferredBarrierType = DeferredBarrierType::None;
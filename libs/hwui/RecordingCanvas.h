@@ -205,6 +205,31 @@ private:
     void drawSimpleRects(const float* rects, int vertexCount, const SkPaint* paint);
 
     int addOp(RecordedOp* op);
+
+    // ----------------------------------------------------------------------------
+    // content fingerprint
+    // ----------------------------------------------------------------------------
+
+    /**
+     * Mixes a run of bytes into the content fingerprint (64 bit FNV-1a). The
+     * fingerprint summarizes everything that affects how the recording
+     * renders, so RenderNode sync can detect that a re-recording produced
+     * content identical to the display list it would replace.
+     */
+    void mixBytes(const void* data, size_t byteCount) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < byteCount; i++) {
+            mFingerprint = (mFingerprint ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+
+    template <typename T>
+    void mix(const T& value) {
+        mixBytes(&value, sizeof(T));
+    }
+
+    void mixOp(const RecordedOp& op);
+
     // ----------------------------------------------------------------------------
     // lazy object copy
     // ----------------------------------------------------------------------------
@@ -216,6 +241,7 @@ private:
     inline const T* refBuffer(const T* srcBuffer, int32_t count) {
         if (!srcBuffer) return nullptr;
 
+        mixBytes(srcBuffer, count * sizeof(T));
         T* dstBuffer = (T*)mDisplayList->allocator.alloc<T>(count * sizeof(T));
         memcpy(dstBuffer, srcBuffer, count * sizeof(T));
         return dstBuffer;
@@ -224,6 +250,9 @@ private:
     inline const SkPath* refPath(const SkPath* path) {
         if (!path) return nullptr;
 
+        // The generation ID changes whenever the path's geometry is edited
+        mix(path->getGenerationID());
+
         // The points/verbs within the path are refcounted so this copy operation
         // is inexpensive and maintains the generationID of the original path.
         const SkPath* cachedPath = new SkPath(*path);
@@ -288,6 +317,10 @@ private:
         // contents, and drawing again. The only fix would be to always copy it the first time,
         // which doesn't seem worth the extra cycles for this unlikely case.
 
+        // The generation ID changes whenever the pixels are mutated, which
+        // also covers the mutable-bitmap caveat above for the fingerprint
+        mix(bitmap.getGenerationID());
+
         // this is required because sk_sp's ctor adopts the pointer,
         // but does not increment the refcount,
         bitmap.ref();
@@ -296,6 +329,7 @@ private:
     }
 
     inline const Res_png_9patch* refPatch(const Res_png_9patch* patch) {
+        mix(patch);  // patches are immutable while referenced, so identity suffices
         mDisplayList->patchResources.push_back(patch);
         mResourceCache.incrementRefcount(patch);
         return patch;
@@ -312,6 +346,11 @@ private:
     const ClipBase* mDeferredBarrierClip = nullptr;
     DisplayList* mDisplayList = nullptr;
     sk_sp<SkDrawFilter> mDrawFilter;
+
+    // 64 bit FNV-1a offset basis; rolled forward as ops are recorded
+    static constexpr uint64_t kFingerprintSeed = 1469598103934665603ULL;
+    uint64_t mFingerprint = kFingerprintSeed;
+    bool mFingerprintValid = true;
 };  // class RecordingCanvas
 
 };  // namespace uirenderer
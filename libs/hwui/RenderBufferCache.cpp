@@ -18,6 +18,7 @@
 #include "Debug.h"
 #include "DeviceInfo.h"
 #include "Properties.h"
+#include "renderstate/OffscreenBufferPool.h"
 
 #include <utils/Log.h>
 
@@ -102,7 +103,11 @@ void RenderBufferCache::clear() {
 RenderBuffer* RenderBufferCache::get(GLenum format, const uint32_t width, const uint32_t height) {
     RenderBuffer* buffer = nullptr;
 
-    RenderBufferEntry entry(format, width, height);
+    // Round the request up to the same size classes layer textures use, so
+    // layers whose dimensions differ slightly share pooled buffers instead
+    // of each allocating their own
+    RenderBufferEntry entry(format, OffscreenBuffer::computeIdealDimension(width),
+                            OffscreenBuffer::computeIdealDimension(height));
     auto iter = mCache.find(entry);
 
     if (iter != mCache.end()) {
@@ -115,10 +120,10 @@ RenderBuffer* RenderBufferCache::get(GLenum format, const uint32_t width, const
         RENDER_BUFFER_LOGD("Found %s render buffer (%dx%d)", RenderBuffer::formatName(format),
                            width, height);
     } else {
-        buffer = new RenderBuffer(format, width, height);
+        buffer = new RenderBuffer(format, entry.mWidth, entry.mHeight);
 
         RENDER_BUFFER_LOGD("Created new %s render buffer (%dx%d)", RenderBuffer::formatName(format),
-                           width, height);
+                           entry.mWidth, entry.mHeight);
     }
 
     buffer->bind();
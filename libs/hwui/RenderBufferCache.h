@@ -32,9 +32,10 @@ public:
     ~RenderBufferCache();
 
     /**
-     * Returns a buffer with the exact specified dimensions. If no suitable
-     * buffer can be found, a new one is created and returned. If creating a
-     * new buffer fails, NULL is returned.
+     * Returns a buffer at least as large as the specified dimensions, rounded
+     * up to the size classes used for layer textures. If no suitable buffer
+     * can be found, a new one is created and returned. If creating a new
+     * buffer fails, NULL is returned.
      *
      * When a buffer is obtained from the cache, it is removed and the total
      * size of the cache goes down.
@@ -270,6 +270,18 @@ void RenderNode::pushLayerUpdate(TreeInfo& info) {
  * stencil buffer may be needed. Views that use a functor to draw will be forced onto a layer.
  */
 void RenderNode::prepareTreeImpl(TreeObserver& observer, TreeInfo& info, bool functorsNeedLayer) {
+    if (info.mode == TreeInfo::MODE_RT_ONLY && !mSubtreeNeedsRtPrepare) {
+        // Staging changes are only consumed in MODE_FULL, so on a render
+        // thread-driven frame a subtree without animators, layers, animated
+        // content or position listeners cannot produce damage or any other
+        // side effect. Replay the traversal outputs cached by the last full
+        // descent instead of walking the subtree; the damage contribution of
+        // a clean subtree is by definition empty.
+        info.out.hasFunctors |= mSubtreeHasFunctors;
+        info.hasBackwardProjectedNodes |= mSubtreeHasBackwardProjectedNodes;
+        return;
+    }
+
     info.damageAccumulator->pushTransform(this);
 
     if (info.mode == TreeInfo::MODE_FULL) {
@@ -312,6 +324,27 @@ void RenderNode::prepareTreeImpl(TreeObserver& observer, TreeInfo& info, bool fu
     }
     pushLayerUpdate(info);
 
+    // Refresh the subtree summary that lets MODE_RT_ONLY frames skip this
+    // subtree. Anything with per-frame render thread work - animators,
+    // layers, vector drawables, animated images or position listeners -
+    // forces the next descent.
+    bool subtreeNeedsRtPrepare = mAnimatorManager.hasAnimators() || hasLayer() ||
+                                 properties().effectiveLayerType() != LayerType::None ||
+                                 CC_UNLIKELY(mPositionListener.get());
+    bool subtreeHasFunctors = false;
+    if (mDisplayList) {
+        subtreeNeedsRtPrepare |=
+                mDisplayList->hasVectorDrawables() || mDisplayList->hasAnimatedImages();
+        subtreeHasFunctors = mDisplayList->hasFunctor();
+        mDisplayList->updateChildren([&](RenderNode* child) {
+            subtreeNeedsRtPrepare |= child->mSubtreeNeedsRtPrepare;
+            subtreeHasFunctors |= child->mSubtreeHasFunctors;
+        });
+    }
+    mSubtreeNeedsRtPrepare = subtreeNeedsRtPrepare;
+    mSubtreeHasFunctors = subtreeHasFunctors;
+    mSubtreeHasBackwardProjectedNodes = info.hasBackwardProjectedNodes;
+
     info.damageAccumulator->popTransform();
 }
 
@@ -358,6 +391,22 @@ void RenderNode::syncDisplayList(TreeObserver& observer, TreeInfo* info) {
 void RenderNode::pushStagingDisplayListChanges(TreeObserver& observer, TreeInfo& info) {
     if (mNeedsDisplayListSync) {
         mNeedsDisplayListSync = false;
+        // If the new recording carries the same content fingerprint as the
+        // current display list the frame would render identically, so keep the
+        // current list (and its child/resource refs) and skip damage
+        // generation entirely. This catches clients that re-record unchanged
+        // content every frame, e.g. webview. Functors and VectorDrawables
+        // still get their sync pulse via syncContents() on the kept list,
+        // which references the same objects since the fingerprints matched.
+        if (mStagingDisplayList && mDisplayList &&
+            mStagingDisplayList->getContentFingerprint() != 0 &&
+            mStagingDisplayList->getContentFingerprint() ==
+                    mDisplayList->getContentFingerprint()) {
+            delete mStagingDisplayList;
+            mStagingDisplayList = nullptr;
+            mDisplayList->syncContents();
+            return;
+        }
         // Damage with the old display list first then the new one to catch any
         // changes in isRenderable or, in the future, bounds
         damageSelf(info);
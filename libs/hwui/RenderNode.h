@@ -277,6 +277,15 @@ private:
 
     sp<PositionListener> mPositionListener;
 
+    // Conservative summary of the subtree rooted at this node, refreshed by
+    // every traversal that descends into it. When false, a MODE_RT_ONLY
+    // traversal cannot animate, damage or update anything below this node,
+    // so prepareTreeImpl() skips the descent and replays the cached outputs
+    // below instead. Starts pessimistic so the first traversal always runs.
+    bool mSubtreeNeedsRtPrepare = true;
+    bool mSubtreeHasFunctors = false;
+    bool mSubtreeHasBackwardProjectedNodes = false;
+
     // METHODS & FIELDS ONLY USED BY THE SKIA RENDERER
 public:
     /**
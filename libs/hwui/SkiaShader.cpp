@@ -113,6 +113,16 @@ static bool isSimpleGradient(const SkShader::GradientInfo& gradInfo) {
     return gradInfo.fColorCount == 2 && gradInfo.fTileMode == SkShader::kClamp_TileMode;
 }
 
+/**
+ * A procedural gradient has few enough stops that the ramp can be evaluated
+ * in the fragment shader from uniform arrays, saving the GradientCache
+ * texture upload and the dependent texture fetch per fragment.
+ */
+static bool isProceduralGradient(const SkShader::GradientInfo& gradInfo) {
+    return gradInfo.fColorCount > 2 && gradInfo.fColorCount <= PROGRAM_MAX_GRADIENT_STOPS &&
+           gradInfo.fTileMode == SkShader::kClamp_TileMode;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Store / apply
 ///////////////////////////////////////////////////////////////////////////////
@@ -149,6 +159,7 @@ bool tryStoreGradient(Caches& caches, const SkShader& shader, const Matrix4 mode
     }
     description->hasGradient = true;
     description->isSimpleGradient = isSimpleGradient(gradInfo);
+    description->gradientStopCount = isProceduralGradient(gradInfo) ? gradInfo.fColorCount : 0;
 
     computeScreenSpaceMatrix(outData->screenSpace, unitMatrix, shader.getLocalMatrix(),
                              modelViewMatrix);
@@ -160,18 +171,30 @@ bool tryStoreGradient(Caches& caches, const SkShader& shader, const Matrix4 mode
     gradInfo.fColorOffsets = &colorOffsets[0];
     shader.asAGradient(&gradInfo);
 
-    if (CC_UNLIKELY(!description->isSimpleGradient)) {
-        outData->gradientSampler = (*textureUnit)++;
-
 #ifndef SK_SCALAR_IS_FLOAT
 #error Need to convert gradInfo.fColorOffsets to float!
 #endif
+
+    if (CC_UNLIKELY(!description->isSimpleGradient && !description->gradientStopCount)) {
+        outData->gradientSampler = (*textureUnit)++;
+        outData->stopCount = 0;
+
         outData->gradientTexture = caches.gradientCache.get(
                 gradInfo.fColors, gradInfo.fColorOffsets, gradInfo.fColorCount);
         outData->wrapST = gTileModes[gradInfo.fTileMode];
+    } else if (description->gradientStopCount) {
+        outData->gradientSampler = 0;
+        outData->gradientTexture = nullptr;
+        outData->stopCount = description->gradientStopCount;
+
+        for (int i = 0; i < outData->stopCount; i++) {
+            outData->stopColors[i].set(gradInfo.fColors[i]);
+            outData->stopPositions[i] = gradInfo.fColorOffsets[i];
+        }
     } else {
         outData->gradientSampler = 0;
         outData->gradientTexture = nullptr;
+        outData->stopCount = 0;
 
         outData->startColor.set(gradInfo.fColors[0]);
         outData->endColor.set(gradInfo.fColors[1]);
@@ -186,6 +209,11 @@ void applyGradient(Caches& caches, const SkiaShaderData::GradientShaderData& dat
         caches.textureState().activateTexture(data.gradientSampler);
         bindTexture(&caches, data.gradientTexture, data.wrapST, data.wrapST);
         glUniform1i(caches.program().getUniform("gradientSampler"), data.gradientSampler);
+    } else if (data.stopCount) {
+        glUniform4fv(caches.program().getUniform("gradientColors"), data.stopCount,
+                     reinterpret_cast<const float*>(data.stopColors));
+        glUniform1fv(caches.program().getUniform("gradientPositions"), data.stopCount,
+                     data.stopPositions);
     } else {
         bindUniformColor(caches.program().getUniform("startColor"), data.startColor);
         bindUniformColor(caches.program().getUniform("endColor"), data.endColor);
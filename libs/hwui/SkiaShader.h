@@ -19,6 +19,7 @@
 
 #include "FloatColor.h"
 #include "Matrix.h"
+#include "Program.h"
 
 #include <GLES2/gl2.h>
 #include <SkShader.h>
@@ -30,7 +31,6 @@ namespace uirenderer {
 class Caches;
 class Extensions;
 class Texture;
-struct ProgramDescription;
 
 /**
  * Type of Skia shader in use.
@@ -64,6 +64,11 @@ struct SkiaShaderData {
         FloatColor startColor;
         FloatColor endColor;
 
+        // procedural multi-stop gradient
+        FloatColor stopColors[PROGRAM_MAX_GRADIENT_STOPS];
+        float stopPositions[PROGRAM_MAX_GRADIENT_STOPS];
+        int stopCount;
+
         // complex gradient
         Texture* gradientTexture;
         GLuint gradientSampler;
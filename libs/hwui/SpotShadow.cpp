@@ -45,6 +45,11 @@
 #define PENUMBRA_ALPHA 0.0f
 #define UMBRA_ALPHA 1.0f
 
+// Completed spot shadow tessellations retained keyed by the light-relative
+// caster pose. Entries are a few KB each, so this bounds the cache to a few
+// hundred KB while comfortably covering the casters of a typical scene.
+#define SPOT_SHADOW_POSE_CACHE_SIZE 64
+
 #include "SpotShadow.h"
 
 #include "ShadowTessellator.h"
@@ -54,8 +59,13 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
+#include <utils/JenkinsHash.h>
 #include <utils/Log.h>
+#include <utils/LruCache.h>
 #include <algorithm>
+#include <mutex>
+#include <vector>
 
 // TODO: After we settle down the new algorithm, we can remove the old one and
 // its utility functions.
@@ -354,6 +364,118 @@ float SpotShadow::projectCasterToOutline(Vector2& outline, const Vector3& lightC
     return ratioZ;
 }
 
+/**
+ * Key identifying a tessellated spot shadow by the caster's pose relative to
+ * the light. The generated triangle strip only depends on the positions of the
+ * caster and the light relative to each other: translating both along x/y
+ * moves the strip by the same amount without changing its shape. Poses are
+ * therefore normalized by moving the light's x/y to the origin, so a caster
+ * that merely translated against the same light maps to the same key.
+ */
+struct SpotShadowPose {
+    bool casterOpaque;
+    float lightSize;
+    float lightZ;
+    // Caster centroid and polygon, with the light's x/y at the origin.
+    Vector3 centroid;
+    std::vector<Vector3> poly;
+
+    bool operator==(const SpotShadowPose& rhs) const {
+        return casterOpaque == rhs.casterOpaque && lightSize == rhs.lightSize &&
+               lightZ == rhs.lightZ && memcmp(&centroid, &rhs.centroid, sizeof(centroid)) == 0 &&
+               poly.size() == rhs.poly.size() &&
+               memcmp(poly.data(), rhs.poly.data(), poly.size() * sizeof(Vector3)) == 0;
+    }
+
+    hash_t hash() const {
+        uint32_t hash = JenkinsHashMix(0, casterOpaque);
+        hash = JenkinsHashMix(hash, android::hash_type(lightSize));
+        hash = JenkinsHashMix(hash, android::hash_type(lightZ));
+        hash = JenkinsHashMixBytes(hash, (uint8_t*)&centroid, sizeof(centroid));
+        hash = JenkinsHashMixBytes(hash, (uint8_t*)poly.data(), poly.size() * sizeof(Vector3));
+        return JenkinsHashWhiten(hash);
+    }
+
+    friend inline hash_t hash_type(const SpotShadowPose& pose) { return pose.hash(); }
+};
+
+/**
+ * A tessellated spot shadow in pose-normalized coordinates, replayed into a
+ * VertexBuffer by offsetting every vertex to the light's actual position.
+ */
+struct SpotShadowGeometry {
+    std::vector<AlphaVertex> vertices;
+    std::vector<uint16_t> indices;
+    Rect bounds;
+};
+
+static void writeGeometry(const SpotShadowGeometry& geometry, const Vector2& offset,
+                          VertexBuffer& shadowTriangleStrip) {
+    AlphaVertex* shadowVertices =
+            shadowTriangleStrip.alloc<AlphaVertex>(geometry.vertices.size());
+    for (size_t i = 0; i < geometry.vertices.size(); i++) {
+        AlphaVertex::copyWithOffset(&shadowVertices[i], geometry.vertices[i], offset.x, offset.y);
+    }
+    uint16_t* indexBuffer = shadowTriangleStrip.allocIndices<uint16_t>(geometry.indices.size());
+    memcpy(indexBuffer, geometry.indices.data(), geometry.indices.size() * sizeof(uint16_t));
+
+    shadowTriangleStrip.setMeshFeatureFlags(VertexBuffer::kAlpha | VertexBuffer::kIndices);
+    Rect bounds(geometry.bounds);
+    bounds.translate(offset.x, offset.y);
+    shadowTriangleStrip.setBounds(bounds);
+}
+
+/**
+ * LRU of pose-normalized spot shadow tessellations, shared by all the
+ * tessellation worker threads.
+ */
+class SpotShadowGeometryCache {
+public:
+    static SpotShadowGeometryCache& getInstance() {
+        static SpotShadowGeometryCache sCache;
+        return sCache;
+    }
+
+    /**
+     * On a hit, replays the cached strip offset to the light's position and
+     * returns true; leaves the buffer untouched on a miss.
+     */
+    bool replay(const SpotShadowPose& pose, const Vector2& offset,
+                VertexBuffer& shadowTriangleStrip) {
+        std::lock_guard<std::mutex> lock(mLock);
+        SpotShadowGeometry* geometry = mCache.get(pose);
+        if (!geometry) {
+            return false;
+        }
+        writeGeometry(*geometry, offset, shadowTriangleStrip);
+        return true;
+    }
+
+    // Takes ownership of the geometry.
+    void store(const SpotShadowPose& pose, SpotShadowGeometry* geometry) {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (!mCache.put(pose, geometry)) {
+            // Another worker raced us to this pose; keep the existing entry.
+            delete geometry;
+        }
+    }
+
+private:
+    SpotShadowGeometryCache() : mCache(SPOT_SHADOW_POSE_CACHE_SIZE) {
+        mCache.setOnEntryRemovedListener(&mGeometryRemovedListener);
+    }
+
+    class GeometryRemovedListener : public OnEntryRemoved<SpotShadowPose, SpotShadowGeometry*> {
+        void operator()(SpotShadowPose& pose, SpotShadowGeometry*& geometry) override {
+            delete geometry;
+        }
+    };
+
+    std::mutex mLock;
+    LruCache<SpotShadowPose, SpotShadowGeometry*> mCache;
+    GeometryRemovedListener mGeometryRemovedListener;
+};
+
 /**
  * Generate the shadow spot light of shape lightPoly and a object poly
  *
@@ -378,6 +500,54 @@ void SpotShadow::createSpotShadow(bool isCasterOpaque, const Vector3& lightCente
 #endif
         return;
     }
+
+    // Normalize the pose by moving the light's x/y to the origin, so casters
+    // that only translated relative to the light (the common case for moving
+    // cards) reuse the tessellation computed on their first appearance.
+    SpotShadowPose pose;
+    pose.casterOpaque = isCasterOpaque;
+    pose.lightSize = lightSize;
+    pose.lightZ = lightCenter.z;
+    pose.centroid = (Vector3){polyCentroid.x - lightCenter.x, polyCentroid.y - lightCenter.y,
+                              polyCentroid.z};
+    pose.poly.resize(polyLength);
+    for (int i = 0; i < polyLength; i++) {
+        pose.poly[i] = (Vector3){poly[i].x - lightCenter.x, poly[i].y - lightCenter.y, poly[i].z};
+    }
+
+    const Vector2 lightOffset = {lightCenter.x, lightCenter.y};
+    SpotShadowGeometryCache& cache = SpotShadowGeometryCache::getInstance();
+    if (cache.replay(pose, lightOffset, shadowTriangleStrip)) {
+        return;
+    }
+
+    VertexBuffer normalizedStrip;
+    const Vector3 normalizedLightCenter = {0, 0, lightCenter.z};
+    computeSpotShadow(isCasterOpaque, normalizedLightCenter, lightSize, pose.poly.data(),
+                      polyLength, pose.centroid, normalizedStrip);
+    if (normalizedStrip.getVertexCount() == 0) {
+        // Degenerate input; don't cache failures.
+        return;
+    }
+
+    SpotShadowGeometry* geometry = new SpotShadowGeometry();
+    const AlphaVertex* vertices = reinterpret_cast<const AlphaVertex*>(normalizedStrip.getBuffer());
+    geometry->vertices.assign(vertices, vertices + normalizedStrip.getVertexCount());
+    const uint16_t* indices = reinterpret_cast<const uint16_t*>(normalizedStrip.getIndices());
+    geometry->indices.assign(indices, indices + normalizedStrip.getIndexCount());
+    geometry->bounds = normalizedStrip.getBounds();
+
+    writeGeometry(*geometry, lightOffset, shadowTriangleStrip);
+    cache.store(pose, geometry);
+}
+
+/**
+ * Tessellate the spot shadow for a pose-normalized caster: the light's x/y is
+ * at the origin. The caller has already validated the light and the polygon.
+ */
+void SpotShadow::computeSpotShadow(bool isCasterOpaque, const Vector3& lightCenter, float lightSize,
+                                   const Vector3* poly, int polyLength, const Vector3& polyCentroid,
+                                   VertexBuffer& shadowTriangleStrip) {
     OutlineData outlineData[polyLength];
     Vector2 outlineCentroid;
     // Calculate the projected outline for each polygon's vertices from the light center.
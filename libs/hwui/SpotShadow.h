@@ -34,6 +34,10 @@ public:
 private:
     struct VertexAngleData;
 
+    static void computeSpotShadow(bool isCasterOpaque, const Vector3& lightCenter, float lightSize,
+                                  const Vector3* poly, int polyLength, const Vector3& polyCentroid,
+                                  VertexBuffer& retstrips);
+
     static float projectCasterToOutline(Vector2& outline, const Vector3& lightCenter,
                                         const Vector3& polyVertex);
 
@@ -95,23 +95,25 @@ void TessellationCache::Description::setupMatrixAndPaint(Matrix4* matrix, SkPain
     paint->setStrokeWidth(strokeWidth);
 }
 
-TessellationCache::ShadowDescription::ShadowDescription() : nodeKey(nullptr) {
+TessellationCache::ShadowDescription::ShadowDescription() : nodeKey(nullptr), pathGenerationId(0) {
     memset(&matrixData, 0, sizeof(matrixData));
 }
 
 TessellationCache::ShadowDescription::ShadowDescription(const SkPath* nodeKey,
                                                         const Matrix4* drawTransform)
-        : nodeKey(nodeKey) {
+        : nodeKey(nodeKey), pathGenerationId(nodeKey->getGenerationID()) {
     memcpy(&matrixData, drawTransform->data, sizeof(matrixData));
 }
 
 bool TessellationCache::ShadowDescription::operator==(
         const TessellationCache::ShadowDescription& rhs) const {
-    return nodeKey == rhs.nodeKey && memcmp(&matrixData, &rhs.matrixData, sizeof(matrixData)) == 0;
+    return nodeKey == rhs.nodeKey && pathGenerationId == rhs.pathGenerationId &&
+           memcmp(&matrixData, &rhs.matrixData, sizeof(matrixData)) == 0;
 }
 
 hash_t TessellationCache::ShadowDescription::hash() const {
     uint32_t hash = JenkinsHashMixBytes(0, (uint8_t*)&nodeKey, sizeof(const void*));
+    hash = JenkinsHashMix(hash, pathGenerationId);
     hash = JenkinsHashMixBytes(hash, (uint8_t*)&matrixData, sizeof(matrixData));
     return JenkinsHashWhiten(hash);
 }
@@ -309,17 +311,38 @@ uint32_t TessellationCache::getMaxSize() {
     return mMaxSize;
 }
 
+void TessellationCache::setMaxSize(uint32_t maxSize) {
+    mMaxSize = maxSize;
+    uint32_t size = getSize();
+    while (size > mMaxSize) {
+        size -= mCache.peekOldestValue()->getSize();
+        mCache.removeOldest();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Caching
 ///////////////////////////////////////////////////////////////////////////////
 
+// Completed shadow tessellations retained across frames. Each holds a pair of
+// shadow VertexBuffers (a few KB); the budget bounds the worst case while
+// covering transiently hidden casters like dialogs.
+static const size_t MAX_RETAINED_SHADOW_TASKS = 32;
+
 void TessellationCache::trim() {
     uint32_t size = getSize();
     while (size > mMaxSize) {
         size -= mCache.peekOldestValue()->getSize();
         mCache.removeOldest();
     }
-    mShadowCache.clear();
+
+    // Retain shadow tasks across frames (tasks deep copy their inputs, so
+    // this is safe even for work still in flight) so a caster reappearing
+    // with the same outline and pose skips tessellation entirely. The LRU
+    // cap bounds the retained vertex buffer memory.
+    while (mShadowCache.size() > MAX_RETAINED_SHADOW_TASKS) {
+        mShadowCache.removeOldest();
+    }
 }
 
 void TessellationCache::clear() {
@@ -379,6 +402,7 @@ sp<TessellationCache::ShadowTask> TessellationCache::getShadowTask(
 TessellationCache::Buffer* TessellationCache::getOrCreateBuffer(const Description& entry,
                                                                 Tessellator tessellator) {
     Buffer* buffer = mCache.get(entry);
+    buffer ? mHits++ : mMisses++;
     if (!buffer) {
         // not cached, enqueue a task to fill the buffer
         sp<TessellationTask> task = new TessellationTask(tessellator, entry);
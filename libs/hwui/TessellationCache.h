@@ -81,6 +81,10 @@ public:
     struct ShadowDescription {
         HASHABLE_TYPE(ShadowDescription);
         const SkPath* nodeKey;
+        // Outline contents can be mutated in place, so the key also carries
+        // the path's generation - required now that completed shadow
+        // tessellations are retained across frames
+        uint32_t pathGenerationId;
         float matrixData[16];
 
         ShadowDescription();
@@ -136,6 +140,22 @@ public:
      */
     uint32_t getSize();
 
+    /**
+     * Sets the maximum size of the cache in bytes, evicting the oldest
+     * entries if the cache is over the new limit. Used by CacheGovernor to
+     * rebalance budgets between caches.
+     */
+    void setMaxSize(uint32_t maxSize);
+
+    /**
+     * Number of lookups since the last resetHitStats() that found a buffer
+     * in the cache, and the number that did not. Shadow tasks are not
+     * counted; their cache is bounded by entry count, not bytes.
+     */
+    uint32_t hitCount() const { return mHits; }
+    uint32_t missCount() const { return mMisses; }
+    void resetHitStats() { mHits = mMisses = 0; }
+
     /**
      * Trims the contents of the cache, removing items until it's under its
      * specified limit.
@@ -164,6 +184,16 @@ public:
                                  const Matrix4* transformZ, const Vector3& lightCenter,
                                  float lightRadius);
 
+    /**
+     * Speculatively kicks off shadow tessellation on the TaskManager workers.
+     * Completed tasks are retained across trims (up to a fixed budget), so a
+     * warm-up issued ahead of time - or a previous appearance of the same
+     * caster - avoids first-frame tessellation latency.
+     */
+    void precacheShadows(const Matrix4* drawTransform, const Rect& localClip, bool opaque,
+                         const SkPath* casterPerimeter, const Matrix4* transformXY,
+                         const Matrix4* transformZ, const Vector3& lightCenter, float lightRadius);
+
 private:
     class Buffer;
     class TessellationTask;
@@ -171,10 +201,6 @@ private:
 
     typedef VertexBuffer* (*Tessellator)(const Description&);
 
-    void precacheShadows(const Matrix4* drawTransform, const Rect& localClip, bool opaque,
-                         const SkPath* casterPerimeter, const Matrix4* transformXY,
-                         const Matrix4* transformZ, const Vector3& lightCenter, float lightRadius);
-
     Buffer* getRectBuffer(const Matrix4& transform, const SkPaint& paint, float width,
                           float height);
     Buffer* getRoundRectBuffer(const Matrix4& transform, const SkPaint& paint, float width,
@@ -182,7 +208,10 @@ private:
 
     Buffer* getOrCreateBuffer(const Description& entry, Tessellator tessellator);
 
-    const uint32_t mMaxSize;
+    uint32_t mMaxSize;
+
+    uint32_t mHits = 0;
+    uint32_t mMisses = 0;
 
     bool mDebugEnabled;
 
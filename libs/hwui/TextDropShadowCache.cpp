@@ -152,8 +152,10 @@ ShadowTexture* TextDropShadowCache::get(const SkPaint* paint, const glyph_t* gly
     if (!texture) {
         SkPaint paintCopy(*paint);
         paintCopy.setTextAlign(SkPaint::kLeft_Align);
-        FontRenderer::DropShadow shadow =
-                mRenderer->renderDropShadow(&paintCopy, glyphs, numGlyphs, radius, positions);
+        // Rasterize the glyphs unblurred; the blur is applied on the GPU
+        // when possible, producing the texture directly
+        FontRenderer::DropShadow shadow = mRenderer->renderDropShadow(
+                &paintCopy, glyphs, numGlyphs, radius, positions, false /* applyBlur */);
 
         if (!shadow.image) {
             return nullptr;
@@ -167,7 +169,20 @@ ShadowTexture* TextDropShadowCache::get(const SkPaint* paint, const glyph_t* gly
         texture->generation = 0;
         texture->blend = true;
 
-        const uint32_t size = shadow.width * shadow.height;
+        if (caches.shadowBlur.blurInto(*texture, shadow.image, shadow.width, shadow.height,
+                                       radius)) {
+            caches.textureState().activateTexture(0);
+            caches.textureState().bindTexture(texture->id());
+        } else {
+            // GPU blur unavailable; blur on the CPU and upload as Alpha8
+            mRenderer->blurImage(&shadow.image, shadow.width, shadow.height, radius);
+            texture->upload(GL_ALPHA, shadow.width, shadow.height, GL_ALPHA, GL_UNSIGNED_BYTE,
+                            shadow.image);
+        }
+        texture->setFilter(GL_LINEAR);
+        texture->setWrap(GL_CLAMP_TO_EDGE);
+
+        const uint32_t size = texture->objectSize();
 
         // Don't even try to cache a bitmap that's bigger than the cache
         if (size < mMaxSize) {
@@ -177,22 +192,14 @@ ShadowTexture* TextDropShadowCache::get(const SkPaint* paint, const glyph_t* gly
                                     ", mCache.size() = %zu",
                                     mSize, mCache.size());
             }
-        }
 
-        // Textures are Alpha8
-        texture->upload(GL_ALPHA, shadow.width, shadow.height, GL_ALPHA, GL_UNSIGNED_BYTE,
-                        shadow.image);
-        texture->setFilter(GL_LINEAR);
-        texture->setWrap(GL_CLAMP_TO_EDGE);
-
-        if (size < mMaxSize) {
             if (mDebugEnabled) {
                 ALOGD("Shadow texture created, size = %d", texture->bitmapSize);
             }
 
             entry.copyTextLocally();
 
-            mSize += texture->objectSize();
+            mSize += size;
             mCache.put(entry, texture);
         } else {
             texture->cleanup = true;
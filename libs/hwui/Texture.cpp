@@ -85,6 +85,10 @@ void Texture::deleteTexture() {
     mCaches.textureState().deleteTexture(mId);
     mId = 0;
     mTarget = GL_NONE;
+    if (uploadFence) {
+        glDeleteSync(uploadFence);
+        uploadFence = nullptr;
+    }
     if (mEglImageHandle != EGL_NO_IMAGE_KHR) {
         EGLDisplay eglDisplayHandle = eglGetCurrentDisplay();
         eglDestroyImageKHR(eglDisplayHandle, mEglImageHandle);
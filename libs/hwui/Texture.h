@@ -171,6 +171,13 @@ public:
      */
     void* isInUse = nullptr;
 
+    /**
+     * Fence guarding an in-flight asynchronous upload, or nullptr. The render
+     * thread inserts a server-side wait on it (and deletes it) before handing
+     * the texture out; see TextureCache.
+     */
+    GLsync uploadFence = nullptr;
+
 private:
     // TODO: Temporarily grant private access to GlLayer, remove once
     // GlLayer can be de-tangled from being a dual-purpose render target
@@ -15,6 +15,7 @@
  */
 
 #include <GLES2/gl2.h>
+#include <GLES3/gl3.h>
 
 #include <utils/Mutex.h>
 
@@ -24,11 +25,171 @@
 #include "Texture.h"
 #include "TextureCache.h"
 #include "hwui/Bitmap.h"
+#include "renderthread/EglManager.h"
+#include "renderthread/RenderThread.h"
 #include "utils/TraceUtils.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Software bitmaps smaller than this upload faster synchronously than the
+// round trip to the upload thread costs
+#define MIN_ASYNC_UPLOAD_BYTES (1024 * 1024)
+
 namespace android {
 namespace uirenderer {
 
+///////////////////////////////////////////////////////////////////////////////
+// Async uploads
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Uploads large software bitmaps on a dedicated thread whose EGL context sits
+ * in the render context's share group. The worker only issues raw GL calls -
+ * it must never touch the render thread's cached GL state - and publishes a
+ * fence the render thread waits on server-side before the texture's first use.
+ */
+class AsyncUploadThread {
+public:
+    static std::unique_ptr<AsyncUploadThread> create(renderthread::EglManager& eglManager) {
+        EGLContext context;
+        EGLSurface surface;
+        if (!eglManager.createSharedContext(&context, &surface)) {
+            return nullptr;
+        }
+        return std::unique_ptr<AsyncUploadThread>(
+                new AsyncUploadThread(eglManager, context, surface));
+    }
+
+    ~AsyncUploadThread() {
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mExited = true;
+        }
+        mCondition.notify_all();
+        mThread.join();
+        mEglManager.destroySharedContext(mContext, mSurface);
+    }
+
+    // True if the worker lost its context; callers should re-upload
+    // synchronously on the render thread
+    bool failed() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mFailed;
+    }
+
+    void queue(Texture* texture, Bitmap* bitmap, GLuint textureId, GLint internalFormat,
+               GLenum format) {
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mQueue.push_back(Job{texture, sk_ref_sp(bitmap), textureId, internalFormat, format});
+        }
+        mCondition.notify_all();
+    }
+
+    // Blocks until the texture's upload has been submitted and its fence
+    // created; returns immediately if nothing is pending for the texture
+    void waitForSubmit(Texture* texture) {
+        std::unique_lock<std::mutex> lock(mLock);
+        mCondition.wait(lock, [this, texture] {
+            return texture->uploadFence != nullptr || !isPendingLocked(texture);
+        });
+    }
+
+    // Drops any queued job for the texture and waits out an in-flight one;
+    // must be called before the texture is deleted
+    void cancel(Texture* texture) {
+        std::unique_lock<std::mutex> lock(mLock);
+        for (auto it = mQueue.begin(); it != mQueue.end();) {
+            if (it->texture == texture) {
+                it = mQueue.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        mCondition.wait(lock, [this, texture] { return mInFlight != texture; });
+    }
+
+private:
+    struct Job {
+        Texture* texture;
+        sk_sp<Bitmap> bitmap;
+        GLuint textureId;
+        GLint internalFormat;
+        GLenum format;
+    };
+
+    AsyncUploadThread(renderthread::EglManager& eglManager, EGLContext context, EGLSurface surface)
+            : mEglManager(eglManager), mContext(context), mSurface(surface) {
+        mThread = std::thread(&AsyncUploadThread::threadLoop, this);
+    }
+
+    bool isPendingLocked(Texture* texture) {
+        if (mInFlight == texture) return true;
+        for (const Job& job : mQueue) {
+            if (job.texture == texture) return true;
+        }
+        return false;
+    }
+
+    void threadLoop() {
+        EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (eglMakeCurrent(display, mSurface, mSurface, mContext) == EGL_FALSE) {
+            ALOGW("AsyncUploadThread could not make its context current, falling back to"
+                  " synchronous uploads");
+            std::lock_guard<std::mutex> lock(mLock);
+            mFailed = true;
+            mQueue.clear();
+            mCondition.notify_all();
+            return;
+        }
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mLock);
+                mCondition.wait(lock, [this] { return mExited || !mQueue.empty(); });
+                if (mExited) break;
+                job = std::move(mQueue.front());
+                mQueue.pop_front();
+                mInFlight = job.texture;
+            }
+
+            ATRACE_FORMAT("async upload %ux%u", job.bitmap->width(), job.bitmap->height());
+            glBindTexture(GL_TEXTURE_2D, job.textureId);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexImage2D(GL_TEXTURE_2D, 0, job.internalFormat, job.bitmap->width(),
+                         job.bitmap->height(), 0, job.format, GL_UNSIGNED_BYTE,
+                         job.bitmap->pixels());
+            glBindTexture(GL_TEXTURE_2D, 0);
+            GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            // make sure the commands (and the fence) reach the GPU
+            glFlush();
+
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                job.texture->uploadFence = fence;
+                mInFlight = nullptr;
+            }
+            mCondition.notify_all();
+        }
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+    renderthread::EglManager& mEglManager;
+    EGLContext mContext;
+    EGLSurface mSurface;
+
+    std::thread mThread;
+    std::mutex mLock;
+    std::condition_variable mCondition;
+    std::deque<Job> mQueue;
+    Texture* mInFlight = nullptr;
+    bool mExited = false;
+    bool mFailed = false;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Constructors/destructor
 ///////////////////////////////////////////////////////////////////////////////
@@ -59,6 +220,15 @@ uint32_t TextureCache::getMaxSize() {
     return mMaxSize;
 }
 
+void TextureCache::setMaxSize(uint32_t maxSize) {
+    mMaxSize = maxSize;
+    while (mSize > mMaxSize && mCache.size()) {
+        Texture* oldest = mCache.peekOldestValue();
+        if (oldest && oldest->isInUse) break;
+        mCache.removeOldest();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Callbacks
 ///////////////////////////////////////////////////////////////////////////////
@@ -66,6 +236,10 @@ uint32_t TextureCache::getMaxSize() {
 void TextureCache::operator()(uint32_t&, Texture*& texture) {
     // This will be called already locked
     if (texture) {
+        if (mUploadThread) {
+            // Don't delete a texture the upload thread is still writing
+            mUploadThread->cancel(texture);
+        }
         mSize -= texture->bitmapSize;
         TEXTURE_LOGD("TextureCache::callback: name, removed size, mSize = %d, %d, %d", texture->id,
                      texture->bitmapSize, mSize);
@@ -103,10 +277,51 @@ Texture* TextureCache::createTexture(Bitmap* bitmap) {
     Texture* texture = new Texture(Caches::getInstance());
     texture->bitmapSize = bitmap->rowBytes() * bitmap->height();
     texture->generation = bitmap->getGenerationID();
-    texture->upload(*bitmap);
+    if (shouldUploadAsync(bitmap)) {
+        GLuint textureId;
+        glGenTextures(1, &textureId);
+        texture->blend = !bitmap->isOpaque();
+        texture->wrap(textureId, bitmap->width(), bitmap->height(), GL_RGBA, GL_RGBA,
+                      GL_TEXTURE_2D);
+        mUploadThread->queue(texture, bitmap, textureId, GL_RGBA, GL_RGBA);
+    } else {
+        texture->upload(*bitmap);
+    }
     return texture;
 }
 
+bool TextureCache::shouldUploadAsync(Bitmap* bitmap) {
+    if (bitmap->isHardware() || bitmap->colorType() != kN32_SkColorType) return false;
+    // The worker uses a plain RGBA upload; linear blending would need the
+    // sRGB conversions Texture::upload performs
+    if (Caches::getInstance().extensions().hasLinearBlending()) return false;
+    if (bitmap->rowBytes() != bitmap->width() * 4u) return false;
+    if (bitmap->rowBytes() * bitmap->height() < MIN_ASYNC_UPLOAD_BYTES) return false;
+
+    if (!mUploadThread && !mUploadThreadFailed) {
+        if (renderthread::RenderThread::hasInstance()) {
+            mUploadThread = AsyncUploadThread::create(
+                    renderthread::RenderThread::getInstance().eglManager());
+        }
+        mUploadThreadFailed = !mUploadThread;
+    }
+    return mUploadThread != nullptr && !mUploadThread->failed();
+}
+
+void TextureCache::waitForPendingUpload(Texture* texture) {
+    if (!mUploadThread) return;
+    if (!texture->uploadFence) {
+        mUploadThread->waitForSubmit(texture);
+    }
+    if (texture->uploadFence) {
+        // Server-side wait: the GPU stalls until the upload lands, the
+        // render thread doesn't
+        glWaitSync(texture->uploadFence, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(texture->uploadFence);
+        texture->uploadFence = nullptr;
+    }
+}
+
 // Returns a prepared Texture* that either is already in the cache or can fit
 // in the cache (and is thus added to the cache)
 Texture* TextureCache::getCachedTexture(Bitmap* bitmap) {
@@ -125,6 +340,7 @@ Texture* TextureCache::getCachedTexture(Bitmap* bitmap) {
     }
 
     Texture* texture = mCache.get(bitmap->getStableID());
+    texture ? mHits++ : mMisses++;
 
     if (!texture) {
         if (!canMakeTextureFromBitmap(bitmap)) {
@@ -186,6 +402,15 @@ Texture* TextureCache::get(Bitmap* bitmap) {
         texture->cleanup = true;
     }
 
+    if (mUploadThread) {
+        if (CC_UNLIKELY(mUploadThread->failed() && !texture->uploadFence)) {
+            // The worker lost its context before submitting; redo the upload here
+            texture->upload(*bitmap);
+        } else {
+            waitForPendingUpload(texture);
+        }
+    }
+
     return texture;
 }
 
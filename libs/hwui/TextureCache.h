@@ -26,6 +26,7 @@
 
 #include "Debug.h"
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +36,7 @@ class Bitmap;
 
 namespace uirenderer {
 
+class AsyncUploadThread;
 class Texture;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -113,6 +115,21 @@ public:
      */
     uint32_t getSize();
 
+    /**
+     * Sets the maximum size of the cache in bytes, evicting the oldest
+     * entries if the cache is over the new limit. Used by CacheGovernor to
+     * rebalance budgets between caches.
+     */
+    void setMaxSize(uint32_t maxSize);
+
+    /**
+     * Number of lookups since the last resetHitStats() that found a texture
+     * in the cache, and the number that did not.
+     */
+    uint32_t hitCount() const { return mHits; }
+    uint32_t missCount() const { return mMisses; }
+    void resetHitStats() { mHits = mMisses = 0; }
+
     /**
      * Partially flushes the cache. The amount of memory freed by a flush
      * is defined by the flush rate.
@@ -125,17 +142,38 @@ private:
     Texture* getCachedTexture(Bitmap* bitmap);
     Texture* createTexture(Bitmap* bitmap);
 
+    /**
+     * Returns true if the bitmap is big and simple enough to be worth routing
+     * through the async upload thread, spinning the thread up if needed.
+     */
+    bool shouldUploadAsync(Bitmap* bitmap);
+
+    /**
+     * Blocks until the texture's asynchronous upload (if any) has been
+     * submitted, then queues a server-side GPU wait on its fence. Draws
+     * then wait on the GPU, not the CPU.
+     */
+    void waitForPendingUpload(Texture* texture);
+
     LruCache<uint32_t, Texture*> mCache;
 
     uint32_t mSize;
-    const uint32_t mMaxSize;
+    uint32_t mMaxSize;
     GLint mMaxTextureSize;
 
+    uint32_t mHits = 0;
+    uint32_t mMisses = 0;
+
     const float mFlushRate;
 
     bool mDebugEnabled;
 
     std::unordered_map<uint32_t, std::unique_ptr<Texture>> mHardwareTextures;
+
+    // Lazily created on the first large upload; stays null if a shared EGL
+    // context can't be created on this device
+    std::unique_ptr<AsyncUploadThread> mUploadThread;
+    bool mUploadThreadFailed = false;
 };  // class TextureCache
 
 };  // namespace uirenderer
@@ -65,6 +65,21 @@ const SkPath& Path::getUpdatedPath(bool useStagingData, SkPath* tempStagingPath)
     }
 }
 
+bool Path::updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) {
+    SkPath tempStagingPath;
+    SkRect bounds = getUpdatedPath(false, &tempStagingPath).getBounds();
+    float padding = getBoundsPadding();
+    bounds.outset(padding, padding);
+    parentMatrix.mapRect(&bounds);
+    if (mDamaged) {
+        outDamage->join(mCachedBounds);
+        outDamage->join(bounds);
+        mDamaged = false;
+    }
+    mCachedBounds = bounds;
+    return false;
+}
+
 void Path::syncProperties() {
     if (mStagingPropertiesDirty) {
         mProperties.syncProperties(mStagingProperties);
@@ -147,7 +162,22 @@ inline SkColor applyAlpha(SkColor color, float alpha) {
     return SkColorSetA(color, alphaBytes * alpha);
 }
 
+float FullPath::getBoundsPadding() {
+    if (mProperties.getStrokeGradient() == nullptr &&
+        mProperties.getStrokeColor() == SK_ColorTRANSPARENT) {
+        return 0;
+    }
+    // A miter join can extend up to miterLimit times the half stroke width past the path bounds.
+    return mProperties.getStrokeWidth() * 0.5f * std::max(1.0f, mProperties.getStrokeMiterLimit());
+}
+
 void FullPath::draw(SkCanvas* outCanvas, bool useStagingData) {
+    // Skip subtrees that the last updateDamage() walk placed entirely outside of the damage
+    // clip set up by Tree::updateBitmapCache - their pixels in the cache are still valid.
+    if (!useStagingData &&
+        !mCachedBounds.intersects(SkRect::Make(outCanvas->getDeviceClipBounds()))) {
+        return;
+    }
     const FullPathProperties& properties = useStagingData ? mStagingProperties : mProperties;
     SkPath tempStagingPath;
     const SkPath& renderPath = getUpdatedPath(useStagingData, &tempStagingPath);
@@ -267,11 +297,26 @@ void ClipPath::draw(SkCanvas* outCanvas, bool useStagingData) {
     outCanvas->clipPath(getUpdatedPath(useStagingData, &tempStagingPath));
 }
 
+bool ClipPath::updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) {
+    // A clip path draws nothing by itself, but changing it re-renders every sibling drawn
+    // after it, so report the change to the parent group instead of contributing bounds.
+    bool clipChanged = mDamaged;
+    mDamaged = false;
+    mCachedBounds = SkRect::MakeEmpty();
+    return clipChanged;
+}
+
 Group::Group(const Group& group) : Node(group) {
     mStagingProperties.syncProperties(group.mStagingProperties);
 }
 
 void Group::draw(SkCanvas* outCanvas, bool useStagingData) {
+    // Skip subtrees that the last updateDamage() walk placed entirely outside of the damage
+    // clip set up by Tree::updateBitmapCache - their pixels in the cache are still valid.
+    if (!useStagingData &&
+        !mCachedBounds.intersects(SkRect::Make(outCanvas->getDeviceClipBounds()))) {
+        return;
+    }
     // Save the current clip and matrix information, which is local to this group.
     SkAutoCanvasRestore saver(outCanvas, true);
     // apply the current group's matrix to the canvas
@@ -286,6 +331,29 @@ void Group::draw(SkCanvas* outCanvas, bool useStagingData) {
     // Restore the previous clip and matrix information.
 }
 
+bool Group::updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) {
+    SkMatrix localMatrix;
+    getLocalMatrix(&localMatrix, mProperties);
+    SkMatrix stackedMatrix = SkMatrix::Concat(parentMatrix, localMatrix);
+
+    SkRect childBounds = SkRect::MakeEmpty();
+    bool clipChanged = false;
+    for (auto& child : mChildren) {
+        clipChanged |= child->updateDamage(stackedMatrix, outDamage);
+        childBounds.join(child->cachedBounds());
+    }
+    // A changed group transform (or clip path) affects the entire subtree, so damage both
+    // where the subtree was and where it is now.
+    if (mDamaged || clipChanged) {
+        outDamage->join(mCachedBounds);
+        outDamage->join(childBounds);
+        mDamaged = false;
+    }
+    mCachedBounds = childBounds;
+    // The clip is restored when this group's draw() returns, so it never affects the parent.
+    return false;
+}
+
 void Group::dump() {
     ALOGD("Group %s has %zu children: ", mName.c_str(), mChildren.size());
     ALOGD("Group translateX, Y : %f, %f, scaleX, Y: %f, %f", mProperties.getTranslateX(),
@@ -487,6 +555,10 @@ SkPaint* Tree::updatePaint(SkPaint* outPaint, TreeProperties* prop) {
 Bitmap& Tree::getBitmapUpdateIfDirty() {
     bool redrawNeeded = allocateBitmapIfNeeded(mCache, mProperties.getScaledWidth(),
                                                mProperties.getScaledHeight());
+    if (redrawNeeded) {
+        // A freshly allocated bitmap has undefined content.
+        mCacheNeedsFullRedraw = true;
+    }
     if (redrawNeeded || mCache.dirty) {
         updateBitmapCache(*mCache.bitmap, false);
         mCache.dirty = false;
@@ -582,8 +654,6 @@ void Tree::updateBitmapCache(Bitmap& bitmap, bool useStagingData) {
     bitmap.getSkBitmap(&outCache);
     int cacheWidth = outCache.width();
     int cacheHeight = outCache.height();
-    ATRACE_FORMAT("VectorDrawable repaint %dx%d", cacheWidth, cacheHeight);
-    outCache.eraseColor(SK_ColorTRANSPARENT);
     SkCanvas outCanvas(outCache);
     float viewportWidth =
             useStagingData ? mStagingProperties.getViewportWidth() : mProperties.getViewportWidth();
@@ -591,6 +661,36 @@ void Tree::updateBitmapCache(Bitmap& bitmap, bool useStagingData) {
                                           : mProperties.getViewportHeight();
     float scaleX = cacheWidth / viewportWidth;
     float scaleY = cacheHeight / viewportHeight;
+    if (!useStagingData) {
+        // Refresh every node's cached bounds and collect the damage from the nodes whose
+        // render thread properties changed since the last repaint.
+        SkRect damage = SkRect::MakeEmpty();
+        mRootNode->updateDamage(SkMatrix::MakeScale(scaleX, scaleY), &damage);
+        if (!mCacheNeedsFullRedraw) {
+            if (damage.isEmpty()) {
+                return;
+            }
+            SkIRect deviceDamage;
+            damage.roundOut(&deviceDamage);
+            // Outset by a pixel to also replace the anti-aliased edges of the old content.
+            deviceDamage.outset(1, 1);
+            if (!deviceDamage.intersect(SkIRect::MakeWH(cacheWidth, cacheHeight))) {
+                return;  // The changed nodes don't touch the visible part of the cache.
+            }
+            ATRACE_FORMAT("VectorDrawable repaint %dx%d of %dx%d", deviceDamage.width(),
+                          deviceDamage.height(), cacheWidth, cacheHeight);
+            // Erase and re-render only the damaged area. Nodes whose bounds don't intersect
+            // the clip are culled in draw(), so static content outside the damage is free.
+            outCanvas.clipRect(SkRect::Make(deviceDamage));
+            outCanvas.clear(SK_ColorTRANSPARENT);
+            outCanvas.scale(scaleX, scaleY);
+            mRootNode->draw(&outCanvas, false);
+            return;
+        }
+        mCacheNeedsFullRedraw = false;
+    }
+    ATRACE_FORMAT("VectorDrawable repaint %dx%d", cacheWidth, cacheHeight);
+    outCache.eraseColor(SK_ColorTRANSPARENT);
     outCanvas.scale(scaleX, scaleY);
     mRootNode->draw(&outCanvas, useStagingData);
 }
@@ -617,7 +717,9 @@ void Tree::onPropertyChanged(TreeProperties* prop) {
     if (prop == &mStagingProperties) {
         mStagingCache.dirty = true;
     } else {
+        // Tree-level properties (root alpha, viewport, color filter) affect every pixel.
         mCache.dirty = true;
+        mCacheNeedsFullRedraw = true;
     }
 }
 
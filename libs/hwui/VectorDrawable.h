@@ -116,6 +116,17 @@ public:
     Node(const Node& node) { mName = node.mName; }
     Node() {}
     virtual void draw(SkCanvas* outCanvas, bool useStagingData) = 0;
+    /**
+     * Walks the subtree with the accumulated parent matrix and refreshes each node's cached
+     * bounds (in bitmap cache pixels) from the render thread properties. For every node whose
+     * render thread properties changed since the last walk, the union of its previous and new
+     * bounds is joined into outDamage, so only that part of the bitmap cache needs to be
+     * re-rendered. Returns true when the parent group has to treat its whole subtree as
+     * damaged (a changed clip path affects every sibling drawn after it). This should always
+     * be called from RT.
+     */
+    virtual bool updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) = 0;
+    const SkRect& cachedBounds() const { return mCachedBounds; }
     virtual void dump() = 0;
     void setName(const char* name) { mName = name; }
     virtual void setPropertyChangedListener(PropertyChangedListener* listener) {
@@ -129,6 +140,12 @@ public:
 protected:
     std::string mName;
     PropertyChangedListener* mPropertyChangedListener = nullptr;
+    // Set when the render thread properties change, cleared by the next updateDamage() walk.
+    // This should only be accessed from RT.
+    bool mDamaged = true;
+    // Bounds this node drew into the bitmap cache (in cache pixels) as of the last
+    // updateDamage() walk. This should only be accessed from RT.
+    SkRect mCachedBounds = SkRect::MakeEmpty();
 };
 
 class ANDROID_API Path : public Node {
@@ -180,11 +197,13 @@ public:
             }
         } else if (prop == &mProperties) {
             mSkPathDirty = true;
+            mDamaged = true;
             if (mPropertyChangedListener) {
                 mPropertyChangedListener->onPropertyChanged();
             }
         }
     }
+    virtual bool updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) override;
     PathProperties* mutateStagingProperties() { return &mStagingProperties; }
     const PathProperties* stagingProperties() { return &mStagingProperties; }
 
@@ -193,6 +212,9 @@ public:
 
 protected:
     virtual const SkPath& getUpdatedPath(bool useStagingData, SkPath* tempStagingPath);
+    // How far drawing can extend past the path bounds, in path coordinates. Used to pad the
+    // bounds reported by updateDamage().
+    virtual float getBoundsPadding() { return 0; }
 
     // Internal data, render thread only.
     bool mSkPathDirty = true;
@@ -350,6 +372,7 @@ public:
                 mPropertyChangedListener->onStagingPropertyChanged();
             }
         } else if (properties == &mProperties) {
+            mDamaged = true;
             if (mPropertyChangedListener) {
                 mPropertyChangedListener->onPropertyChanged();
             }
@@ -359,6 +382,7 @@ public:
 
 protected:
     const SkPath& getUpdatedPath(bool useStagingData, SkPath* tempStagingPath) override;
+    float getBoundsPadding() override;
 
 private:
     FullPathProperties mProperties = FullPathProperties(this);
@@ -377,6 +401,7 @@ public:
     ClipPath(const char* path, size_t strLength) : Path(path, strLength) {}
     ClipPath() : Path() {}
     void draw(SkCanvas* outCanvas, bool useStagingData) override;
+    bool updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) override;
     virtual void setAntiAlias(bool aa) {}
 };
 
@@ -464,6 +489,7 @@ public:
 
     // Methods below could be called from either UI thread or Render Thread.
     virtual void draw(SkCanvas* outCanvas, bool useStagingData) override;
+    bool updateDamage(const SkMatrix& parentMatrix, SkRect* outDamage) override;
     void getLocalMatrix(SkMatrix* outMatrix, const GroupProperties& properties);
     void dump() override;
     static bool isValidProperty(int propertyId);
@@ -475,6 +501,7 @@ public:
                 mPropertyChangedListener->onStagingPropertyChanged();
             }
         } else {
+            mDamaged = true;
             if (mPropertyChangedListener) {
                 mPropertyChangedListener->onPropertyChanged();
             }
@@ -516,16 +543,19 @@ public:
     SkPaint* getPaint();
     void syncProperties() {
         if (mStagingProperties.mNonAnimatablePropertiesDirty) {
-            mCache.dirty |= (mProperties.mNonAnimatableProperties.viewportWidth !=
-                             mStagingProperties.mNonAnimatableProperties.viewportWidth) ||
-                            (mProperties.mNonAnimatableProperties.viewportHeight !=
-                             mStagingProperties.mNonAnimatableProperties.viewportHeight) ||
-                            (mProperties.mNonAnimatableProperties.scaledWidth !=
-                             mStagingProperties.mNonAnimatableProperties.scaledWidth) ||
-                            (mProperties.mNonAnimatableProperties.scaledHeight !=
-                             mStagingProperties.mNonAnimatableProperties.scaledHeight) ||
-                            (mProperties.mNonAnimatableProperties.bounds !=
-                             mStagingProperties.mNonAnimatableProperties.bounds);
+            bool changed = (mProperties.mNonAnimatableProperties.viewportWidth !=
+                            mStagingProperties.mNonAnimatableProperties.viewportWidth) ||
+                           (mProperties.mNonAnimatableProperties.viewportHeight !=
+                            mStagingProperties.mNonAnimatableProperties.viewportHeight) ||
+                           (mProperties.mNonAnimatableProperties.scaledWidth !=
+                            mStagingProperties.mNonAnimatableProperties.scaledWidth) ||
+                           (mProperties.mNonAnimatableProperties.scaledHeight !=
+                            mStagingProperties.mNonAnimatableProperties.scaledHeight) ||
+                           (mProperties.mNonAnimatableProperties.bounds !=
+                            mStagingProperties.mNonAnimatableProperties.bounds);
+            mCache.dirty |= changed;
+            // The viewport scale is baked into the cache, so a size change invalidates all of it.
+            mCacheNeedsFullRedraw |= changed;
             mProperties.syncNonAnimatableProperties(mStagingProperties);
             mStagingProperties.mNonAnimatablePropertiesDirty = false;
         }
@@ -635,7 +665,10 @@ public:
     const TreeProperties& properties() const { return mProperties; }
 
     // This should always be called from RT.
-    void markDirty() { mCache.dirty = true; }
+    void markDirty() {
+        mCache.dirty = true;
+        mCacheNeedsFullRedraw = true;
+    }
     bool isDirty() const { return mCache.dirty; }
     bool getPropertyChangeWillBeConsumed() const { return mWillBeConsumed; }
     void setPropertyChangeWillBeConsumed(bool willBeConsumed) { mWillBeConsumed = willBeConsumed; }
@@ -709,6 +742,11 @@ private:
     Cache mStagingCache;
     Cache mCache;
 
+    // When set, the next update of mCache repaints the whole bitmap; otherwise only the damage
+    // collected by the nodes' updateDamage() walk is re-rendered. The staging cache is always
+    // fully repainted. This should only be accessed from RT.
+    bool mCacheNeedsFullRedraw = true;
+
     PropertyChangedListener mPropertyChangedListener =
             PropertyChangedListener(&mCache.dirty, &mStagingCache.dirty);
 
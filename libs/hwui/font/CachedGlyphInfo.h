@@ -47,6 +47,9 @@ struct CachedGlyphInfo {
     // Auto-kerning; represents a 2.6 fixed-point value with range [-1, 1].
     int8_t mLsbDelta;
     int8_t mRsbDelta;
+    // How often the glyph has been drawn; used to pick which glyphs are
+    // worth re-rasterizing speculatively after a cache flush
+    uint32_t mUseCount;
     CacheTexture* mCacheTexture;
 };
 
@@ -16,6 +16,9 @@
 
 #include <cutils/compiler.h>
 
+#include <algorithm>
+#include <utility>
+
 #include <utils/JenkinsHash.h>
 #include <utils/Trace.h>
 
@@ -39,7 +42,7 @@ namespace uirenderer {
 ///////////////////////////////////////////////////////////////////////////////
 
 Font::Font(FontRenderer* state, const Font::FontDescription& desc)
-        : mState(state), mDescription(desc) {}
+        : mState(state), mDescription(desc), mHasLastPaint(false) {}
 
 Font::FontDescription::FontDescription(const SkPaint* paint, const SkMatrix& rasterMatrix)
         : mLookupTransform(rasterMatrix) {
@@ -283,11 +286,17 @@ CachedGlyphInfo* Font::getCachedGlyph(const SkPaint* paint, glyph_t textUnit, bo
         cachedGlyph = cacheGlyph(paint, textUnit, precaching);
     }
 
+    if (!precaching) {
+        cachedGlyph->mUseCount++;
+    }
+
     return cachedGlyph;
 }
 
 void Font::render(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs, int x, int y,
                   const float* positions) {
+    mLastPaint = *paint;
+    mHasLastPaint = true;
     render(paint, glyphs, numGlyphs, x, y, FRAMEBUFFER, nullptr, 0, 0, nullptr, positions);
 }
 
@@ -297,6 +306,9 @@ void Font::render(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs, co
         return;
     }
 
+    mLastPaint = *paint;
+    mHasLastPaint = true;
+
     int glyphsCount = 0;
     int prevRsbDelta = 0;
 
@@ -368,6 +380,32 @@ void Font::precache(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs)
     }
 }
 
+uint32_t Font::precacheHotGlyphs(uint32_t maxCount) {
+    if (!mHasLastPaint || maxCount == 0) {
+        return 0;
+    }
+
+    // Gather invalidated glyphs that earned their place; glyphs drawn once
+    // aren't worth re-rasterizing speculatively
+    std::vector<std::pair<uint32_t, glyph_t>> hotGlyphs;
+    for (uint32_t i = 0; i < mCachedGlyphs.size(); i++) {
+        CachedGlyphInfo* glyph = mCachedGlyphs.valueAt(i);
+        if (!glyph->mIsValid && glyph->mUseCount >= 2) {
+            hotGlyphs.emplace_back(glyph->mUseCount, mCachedGlyphs.keyAt(i));
+        }
+    }
+
+    const uint32_t count = std::min(maxCount, static_cast<uint32_t>(hotGlyphs.size()));
+    std::partial_sort(hotGlyphs.begin(), hotGlyphs.begin() + count, hotGlyphs.end(),
+                      [](const std::pair<uint32_t, glyph_t>& lhs,
+                         const std::pair<uint32_t, glyph_t>& rhs) { return lhs.first > rhs.first; });
+
+    for (uint32_t i = 0; i < count; i++) {
+        getCachedGlyph(&mLastPaint, hotGlyphs[i].second, true);
+    }
+    return count;
+}
+
 void Font::render(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs, int x, int y,
                   RenderMode mode, uint8_t* bitmap, uint32_t bitmapW, uint32_t bitmapH,
                   Rect* bounds, const float* positions) {
@@ -106,6 +106,13 @@ private:
 
     void precache(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs);
 
+    /**
+     * Re-rasterizes up to maxCount of the most frequently drawn glyphs whose
+     * cache entries were invalidated by a flush, using the paint of the last
+     * real render. Returns the number of glyphs restored.
+     */
+    uint32_t precacheHotGlyphs(uint32_t maxCount);
+
     void render(const SkPaint* paint, const glyph_t* glyphs, int numGlyphs, int x, int y,
                 RenderMode mode, uint8_t* bitmap, uint32_t bitmapW, uint32_t bitmapH, Rect* bounds,
                 const float* positions);
@@ -140,6 +147,11 @@ private:
     // Cache of glyphs
     DefaultKeyedVector<glyph_t, CachedGlyphInfo*> mCachedGlyphs;
 
+    // Paint seen by the most recent render; kept so hot glyphs can be
+    // re-rasterized after a flush without waiting for the next text draw
+    SkPaint mLastPaint;
+    bool mHasLastPaint;
+
     bool mIdentityTransform;
 };
 
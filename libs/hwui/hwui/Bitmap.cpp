@@ -16,6 +16,7 @@
 #include "Bitmap.h"
 
 #include "Caches.h"
+#include "HardwareBufferPool.h"
 #include "renderthread/EglManager.h"
 #include "renderthread/RenderProxy.h"
 #include "renderthread/RenderThread.h"
@@ -88,6 +89,10 @@ sk_sp<Bitmap> Bitmap::allocateHardwareBitmap(SkBitmap& bitmap) {
     return uirenderer::renderthread::RenderProxy::allocateHardwareBitmap(bitmap);
 }
 
+std::vector<sk_sp<Bitmap>> Bitmap::allocateHardwareBitmaps(const std::vector<SkBitmap*>& bitmaps) {
+    return uirenderer::renderthread::RenderProxy::allocateHardwareBitmaps(bitmaps);
+}
+
 sk_sp<Bitmap> Bitmap::allocateHeapBitmap(SkBitmap* bitmap) {
     return allocateBitmap(bitmap, &android::allocateHeapBitmap);
 }
@@ -227,6 +232,13 @@ Bitmap::~Bitmap() {
             break;
         case PixelStorageType::Hardware:
             auto buffer = mPixelStorage.hardware.buffer;
+            // Drop the cached SkImage's reference first; if ours is then the
+            // last reference nothing (cached SkImage copies, EGLImages) can
+            // still be sampling from the buffer and it is safe to recycle.
+            mImage.reset();
+            if (buffer->getStrongCount() == 1) {
+                HardwareBufferPool::getInstance().recycle(buffer);
+            }
             buffer->decStrong(buffer);
             mPixelStorage.hardware.buffer = nullptr;
             break;
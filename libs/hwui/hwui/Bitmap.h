@@ -25,6 +25,8 @@
 #include <cutils/compiler.h>
 #include <ui/GraphicBuffer.h>
 
+#include <vector>
+
 namespace android {
 
 enum class PixelStorageType {
@@ -51,6 +53,10 @@ public:
 
     static sk_sp<Bitmap> allocateHardwareBitmap(SkBitmap& bitmap);
 
+    // Uploads a whole batch in a single RenderThread round trip; entries that
+    // fail to allocate come back as nullptr.
+    static std::vector<sk_sp<Bitmap>> allocateHardwareBitmaps(const std::vector<SkBitmap*>& bitmaps);
+
     static sk_sp<Bitmap> allocateAshmemBitmap(SkBitmap* bitmap);
     static sk_sp<Bitmap> allocateAshmemBitmap(size_t allocSize, const SkImageInfo& info,
                                               size_t rowBytes);
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HardwareBufferPool.h"
+
+#include <log/log.h>
+
+namespace android {
+
+// Enough for a screenful of large thumbnails without letting a burst of
+// full-resolution photos pin tens of megabytes of gralloc memory.
+static constexpr size_t kMaxPoolSizeInBytes = 16 * 1024 * 1024;
+static constexpr size_t kMaxPoolEntries = 16;
+
+HardwareBufferPool& HardwareBufferPool::getInstance() {
+    static HardwareBufferPool sInstance;
+    return sInstance;
+}
+
+size_t HardwareBufferPool::bufferSizeInBytes(const sp<GraphicBuffer>& buffer) {
+    size_t bytesPerPixel;
+    switch (buffer->getPixelFormat()) {
+        case PIXEL_FORMAT_RGBA_FP16:
+            bytesPerPixel = 8;
+            break;
+        case PIXEL_FORMAT_RGB_565:
+            bytesPerPixel = 2;
+            break;
+        default:
+            bytesPerPixel = 4;
+            break;
+    }
+    return static_cast<size_t>(buffer->getStride()) * buffer->getHeight() * bytesPerPixel;
+}
+
+sp<GraphicBuffer> HardwareBufferPool::obtain(uint32_t width, uint32_t height, PixelFormat format,
+                                             uint64_t usage, const std::string& name) {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        for (auto it = mPool.begin(); it != mPool.end(); ++it) {
+            GraphicBuffer* candidate = it->buffer.get();
+            if (candidate->getWidth() == width && candidate->getHeight() == height &&
+                candidate->getPixelFormat() == format && candidate->getUsage() == usage) {
+                sp<GraphicBuffer> buffer = std::move(it->buffer);
+                mSizeInBytes -= it->sizeInBytes;
+                mPool.erase(it);
+                return buffer;
+            }
+        }
+    }
+
+    sp<GraphicBuffer> buffer = new GraphicBuffer(width, height, format, usage, name);
+    status_t error = buffer->initCheck();
+    if (error < 0) {
+        ALOGW("HardwareBufferPool failed to allocate a %ux%u buffer (error %d)", width, height,
+              error);
+        return nullptr;
+    }
+    return buffer;
+}
+
+void HardwareBufferPool::recycle(const sp<GraphicBuffer>& buffer) {
+    const size_t sizeInBytes = bufferSizeInBytes(buffer);
+    if (sizeInBytes > kMaxPoolSizeInBytes) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mLock);
+    mPool.push_back(Entry{buffer, sizeInBytes});
+    mSizeInBytes += sizeInBytes;
+    while (mPool.size() > kMaxPoolEntries || mSizeInBytes > kMaxPoolSizeInBytes) {
+        mSizeInBytes -= mPool.front().sizeInBytes;
+        mPool.pop_front();
+    }
+}
+
+void HardwareBufferPool::clear() {
+    std::lock_guard<std::mutex> lock(mLock);
+    mPool.clear();
+    mSizeInBytes = 0;
+}
+
+size_t HardwareBufferPool::getCount() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mPool.size();
+}
+
+size_t HardwareBufferPool::getSizeInBytes() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mSizeInBytes;
+}
+
+}  // namespace android
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <ui/GraphicBuffer.h>
+
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace android {
+
+/**
+ * Process-wide pool of GraphicBuffers backing hardware Bitmaps.
+ *
+ * Allocating a GraphicBuffer is a binder round trip to the allocator service,
+ * which dominates the cost of creating a hardware bitmap for apps that churn
+ * through many of them (photo grids, thumbnail strips).  When the last
+ * reference to a hardware Bitmap is dropped its buffer is offered back here
+ * instead of being freed, and the next allocation with the same dimensions,
+ * format and usage reuses it without leaving the process.
+ *
+ * Buffers are only recycled when the Bitmap held the sole reference, so a
+ * buffer still referenced by a cached SkImage or EGLImage is never handed out
+ * for reuse while the GPU may still sample from it.
+ */
+class HardwareBufferPool {
+public:
+    static HardwareBufferPool& getInstance();
+
+    /**
+     * Returns a pooled or freshly allocated buffer, or nullptr if allocation
+     * failed.  The returned buffer has passed initCheck().
+     */
+    sp<GraphicBuffer> obtain(uint32_t width, uint32_t height, PixelFormat format, uint64_t usage,
+                             const std::string& name);
+
+    /**
+     * Offers a buffer back to the pool.  The caller must guarantee that no
+     * other reference to the buffer remains.  The pool may drop the buffer
+     * immediately if it is over budget.
+     */
+    void recycle(const sp<GraphicBuffer>& buffer);
+
+    /**
+     * Frees all pooled buffers, e.g. on memory pressure.
+     */
+    void clear();
+
+    size_t getCount();
+    size_t getSizeInBytes();
+
+private:
+    HardwareBufferPool() {}
+
+    struct Entry {
+        sp<GraphicBuffer> buffer;
+        size_t sizeInBytes;
+    };
+
+    static size_t bufferSizeInBytes(const sp<GraphicBuffer>& buffer);
+
+    std::mutex mLock;
+    // Most-recently recycled buffers live at the back; eviction pops the front.
+    std::deque<Entry> mPool;
+    size_t mSizeInBytes = 0;
+};
+
+}  // namespace android
@@ -53,6 +53,19 @@ public:
             , mComposeLayer(composeLayer)
             , mInReorderingSection(inReorderingSection) {}
 
+    /**
+     * Takes over the render node of a wrapper built by a previous recording,
+     * avoiding the wrapper rebuild (and render node ref churn) when a parent
+     * re-records an unchanged child. Only valid when the child would be
+     * recorded under the same canvas transform, since the recorded transform
+     * is carried over as-is.
+     */
+    RenderNodeDrawable(RenderNodeDrawable&& other, bool inReorderingSection)
+            : mRenderNode(std::move(other.mRenderNode))
+            , mRecordedTransform(other.mRecordedTransform)
+            , mComposeLayer(other.mComposeLayer)
+            , mInReorderingSection(inReorderingSection) {}
+
     /**
      * Draws into the canvas this render node and its children. If the node is marked as a
      * projection receiver then all projected children (excluding direct children) will be drawn
@@ -17,6 +17,7 @@
 #include "ShaderCache.h"
 #include <algorithm>
 #include <log/log.h>
+#include <string.h>
 #include <thread>
 #include "FileBlobCache.h"
 #include "Properties.h"
@@ -31,6 +32,33 @@ static const size_t maxKeySize = 1024;
 static const size_t maxValueSize = 64 * 1024;
 static const size_t maxTotalSize = 512 * 1024;
 
+// Each value blob carries a trailing CRC-32C of its contents, so a corrupt
+// entry is detected individually instead of relying only on the file-level
+// checksum, which cannot tell which entry went bad.
+static const size_t entryChecksumSize = sizeof(uint32_t);
+
+namespace {
+
+// Bitwise CRC-32C, same flavor FileBlobCache uses to guard the cache file as
+// a whole. Entries are at most maxValueSize so the simple loop is fine.
+uint32_t crc32c(const uint8_t* buf, size_t len) {
+    const uint32_t polyBits = 0x82F63B78;
+    uint32_t r = 0;
+    for (size_t i = 0; i < len; i++) {
+        r ^= buf[i];
+        for (int j = 0; j < 8; j++) {
+            if (r & 1) {
+                r = (r >> 1) ^ polyBits;
+            } else {
+                r >>= 1;
+            }
+        }
+    }
+    return r;
+}
+
+}  // namespace
+
 ShaderCache::ShaderCache() {
     // There is an "incomplete FileBlobCache type" compilation error, if ctor is moved to header.
 }
@@ -72,32 +100,31 @@ sk_sp<SkData> ShaderCache::load(const SkData& key) {
         return nullptr;
     }
 
-    // mObservedBlobValueSize is reasonably big to avoid memory reallocation
+    BlobCache* bc = getBlobCacheLocked();
+    // Query the entry size first so the value buffer is allocated exactly
+    // once, instead of guessing a size and growing it on retry.
+    size_t valueSize = bc->get(key.data(), keySize, nullptr, 0);
+    if (valueSize <= entryChecksumSize) {
+        return nullptr;
+    }
+
     // Allocate a buffer with malloc. SkData takes ownership of that allocation and will call free.
-    void* valueBuffer = malloc(mObservedBlobValueSize);
+    void* valueBuffer = malloc(valueSize);
     if (!valueBuffer) {
         return nullptr;
     }
-    BlobCache* bc = getBlobCacheLocked();
-    size_t valueSize = bc->get(key.data(), keySize, valueBuffer, mObservedBlobValueSize);
-    int maxTries = 3;
-    while (valueSize > mObservedBlobValueSize && maxTries > 0) {
-        mObservedBlobValueSize = std::min(valueSize, maxValueSize);
-        void *newValueBuffer = realloc(valueBuffer, mObservedBlobValueSize);
-        if (!newValueBuffer) {
-            free(valueBuffer);
-            return nullptr;
-        }
-        valueBuffer = newValueBuffer;
-        valueSize = bc->get(key.data(), keySize, valueBuffer, mObservedBlobValueSize);
-        maxTries--;
-    }
-    if (!valueSize) {
+    if (bc->get(key.data(), keySize, valueBuffer, valueSize) != valueSize) {
         free(valueBuffer);
         return nullptr;
     }
-    if (valueSize > mObservedBlobValueSize) {
-        ALOGE("ShaderCache::load value size is too big %d", (int) valueSize);
+
+    // Verify and strip the per-entry checksum; hand Skia nothing that could
+    // be a corrupt program binary.
+    valueSize -= entryChecksumSize;
+    uint32_t storedCrc;
+    memcpy(&storedCrc, static_cast<uint8_t*>(valueBuffer) + valueSize, sizeof(storedCrc));
+    if (storedCrc != crc32c(static_cast<const uint8_t*>(valueBuffer), valueSize)) {
+        ALOGW("ShaderCache::load dropping entry with mismatched checksum");
         free(valueBuffer);
         return nullptr;
     }
@@ -114,15 +141,19 @@ void ShaderCache::store(const SkData& key, const SkData& data) {
 
     size_t valueSize = data.size();
     size_t keySize = key.size();
-    if (keySize == 0 || valueSize == 0 || valueSize >= maxValueSize) {
+    if (keySize == 0 || valueSize == 0 || valueSize >= maxValueSize - entryChecksumSize) {
         ALOGW("ShaderCache::store: sizes %d %d not allowed", (int)keySize, (int)valueSize);
         return;
     }
 
-    const void* value = data.data();
+    // Append the checksum load() uses to detect a corrupt or truncated entry.
+    std::unique_ptr<uint8_t[]> value(new uint8_t[valueSize + entryChecksumSize]);
+    memcpy(value.get(), data.data(), valueSize);
+    uint32_t crc = crc32c(value.get(), valueSize);
+    memcpy(value.get() + valueSize, &crc, sizeof(crc));
 
     BlobCache* bc = getBlobCacheLocked();
-    bc->set(key.data(), keySize, value, valueSize);
+    bc->set(key.data(), keySize, value.get(), valueSize + entryChecksumSize);
 
     if (!mSavePending && mDeferredSaveDelay > 0) {
         mSavePending = true;
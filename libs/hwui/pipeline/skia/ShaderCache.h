@@ -119,11 +119,6 @@ private:
      */
     bool mSavePending = false;
 
-    /**
-     *  "mObservedBlobValueSize" is the maximum value size observed by the cache reading function.
-     */
-    size_t mObservedBlobValueSize = 20*1024;
-
     /**
      *  The time in seconds to wait before saving newly inserted cache entries.
      */
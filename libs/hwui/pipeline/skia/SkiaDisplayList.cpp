@@ -130,7 +130,11 @@ void SkiaDisplayList::reset() {
     mVectorDrawables.clear();
     mAnimatedImages.clear();
     mChildFunctors.clear();
-    mChildNodes.clear();
+
+    // Keep the child wrappers around so the next recording can splice
+    // unchanged children back in; see SkiaRecordingCanvas::drawRenderNode.
+    mReusableChildren.clear();
+    mReusableChildren.swap(mChildNodes);
 
     projectionReceiveIndex = -1;
     allocator.~LinearAllocator();
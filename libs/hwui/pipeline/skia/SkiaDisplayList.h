@@ -85,6 +85,11 @@ public:
      */
     bool hasVectorDrawables() const override { return !mVectorDrawables.empty(); }
 
+    /**
+     * Returns true if this list directly contains an AnimatedImageDrawable drawing command.
+     */
+    bool hasAnimatedImages() const override { return !mAnimatedImages.empty(); }
+
     /**
      * Attempts to reset and reuse this DisplayList.
      *
@@ -142,6 +147,15 @@ public:
      * cannot relocate.
      */
     std::deque<RenderNodeDrawable> mChildNodes;
+
+    /**
+     * Child wrappers retained by reset() from the previous recording of this
+     * node. SkiaRecordingCanvas::drawRenderNode splices a wrapper from here
+     * into mChildNodes when the same child is re-recorded unchanged, instead
+     * of rebuilding it. Any leftovers are dropped when recording finishes.
+     */
+    std::deque<RenderNodeDrawable> mReusableChildren;
+
     std::deque<GLFunctorDrawable> mChildFunctors;
     std::vector<SkImage*> mMutableImages;
     std::vector<VectorDrawableRoot*> mVectorDrawables;
@@ -22,6 +22,7 @@
 #include "SkiaPipeline.h"
 #include "SkiaProfileRenderer.h"
 #include "hwui/Bitmap.h"
+#include "hwui/HardwareBufferPool.h"
 #include "renderstate/RenderState.h"
 #include "renderthread/EglManager.h"
 #include "renderthread/Frame.h"
@@ -60,13 +61,16 @@ Frame SkiaOpenGLPipeline::getFrame() {
 }
 
 bool SkiaOpenGLPipeline::draw(const Frame& frame, const SkRect& screenDirty, const SkRect& dirty,
+                              const std::vector<SkRect>& dirtyRects,
                               const FrameBuilder::LightGeometry& lightGeometry,
                               LayerUpdateQueue* layerUpdateQueue, const Rect& contentDrawBounds,
                               bool opaque, bool wideColorGamut,
                               const BakedOpRenderer::LightInfo& lightInfo,
                               const std::vector<sp<RenderNode>>& renderNodes,
                               FrameInfoVisualizer* profiler) {
-    mEglManager.damageFrame(frame, dirty);
+    // renderFrame clips drawing to the individual rects, so they can be
+    // declared as the damage region instead of their bounding box
+    mEglManager.damageFrame(frame, dirty, dirtyRects);
 
     // setup surface for fbo0
     GrGLFramebufferInfo fboInfo;
@@ -85,7 +89,7 @@ bool SkiaOpenGLPipeline::draw(const Frame& frame, const SkRect& screenDirty, con
 
     SkiaPipeline::updateLighting(lightGeometry, lightInfo);
     renderFrame(*layerUpdateQueue, dirty, renderNodes, opaque, wideColorGamut, contentDrawBounds,
-                surface);
+                surface, dirtyRects);
     layerUpdateQueue->clear();
 
     // Draw visual debugging features
@@ -106,6 +110,7 @@ bool SkiaOpenGLPipeline::draw(const Frame& frame, const SkRect& screenDirty, con
 }
 
 bool SkiaOpenGLPipeline::swapBuffers(const Frame& frame, bool drew, const SkRect& screenDirty,
+                                     const std::vector<SkRect>& screenDirtyRects,
                                      FrameInfo* currentFrameInfo, bool* requireSwap) {
     GL_CHECKPOINT(LOW);
 
@@ -115,7 +120,8 @@ bool SkiaOpenGLPipeline::swapBuffers(const Frame& frame, bool drew, const SkRect
 
     *requireSwap = drew || mEglManager.damageRequiresSwap();
 
-    if (*requireSwap && (CC_UNLIKELY(!mEglManager.swapBuffers(frame, screenDirty)))) {
+    if (*requireSwap &&
+        (CC_UNLIKELY(!mEglManager.swapBuffers(frame, screenDirty, screenDirtyRects)))) {
         return false;
     }
 
@@ -382,15 +388,14 @@ sk_sp<Bitmap> SkiaOpenGLPipeline::allocateHardwareBitmap(renderthread::RenderThr
         }
     }
 
-    sp<GraphicBuffer> buffer = new GraphicBuffer(
+    sp<GraphicBuffer> buffer = HardwareBufferPool::getInstance().obtain(
             info.width(), info.height(), pixelFormat,
             GraphicBuffer::USAGE_HW_TEXTURE | GraphicBuffer::USAGE_SW_WRITE_NEVER |
                     GraphicBuffer::USAGE_SW_READ_NEVER,
             std::string("Bitmap::allocateSkiaHardwareBitmap pid [") + std::to_string(getpid()) +
                     "]");
 
-    status_t error = buffer->initCheck();
-    if (error < 0) {
+    if (!buffer) {
         ALOGW("createGraphicBuffer() failed in GraphicBuffer.create()");
         return nullptr;
     }
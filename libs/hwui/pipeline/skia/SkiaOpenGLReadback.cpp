@@ -16,17 +16,21 @@
 
 #include "SkiaOpenGLReadback.h"
 
-#include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
+#include <GLES3/gl3.h>
 #include <GrBackendSurface.h>
 #include <SkCanvas.h>
 #include <SkSurface.h>
 #include <gl/GrGLInterface.h>
 #include <gl/GrGLTypes.h>
+#include <string.h>
 #include "DeviceInfo.h"
 #include "Matrix.h"
 #include "Properties.h"
+#include "renderthread/EglManager.h"
 #include "utils/MathUtils.h"
+#include "utils/TimeUtils.h"
+#include "utils/TraceUtils.h"
 
 using namespace android::uirenderer::renderthread;
 
@@ -34,6 +38,63 @@ namespace android {
 namespace uirenderer {
 namespace skiapipeline {
 
+// How often to check whether an in-flight asynchronous copy has completed
+static constexpr nsecs_t kFencePollInterval = 2_ms;
+
+/**
+ * Draws the source image cropped to srcRect and scaled to fill dest, undoing
+ * the buffer's texture transform. Returns false if the crop misses the buffer
+ * entirely. Shared between the blocking and the asynchronous readback paths.
+ */
+static bool renderImageScaled(const sk_sp<SkImage>& image, const Matrix4& imgTransform,
+                              int imgWidth, int imgHeight, const Rect& srcRect, SkSurface* dest) {
+    int displayedWidth = imgWidth, displayedHeight = imgHeight;
+    // If this is a 90 or 270 degree rotation we need to swap width/height to get the device
+    // size.
+    if (imgTransform[Matrix4::kSkewX] >= 0.5f || imgTransform[Matrix4::kSkewX] <= -0.5f) {
+        std::swap(displayedWidth, displayedHeight);
+    }
+    SkRect skiaDestRect = SkRect::MakeWH(dest->width(), dest->height());
+    SkRect skiaSrcRect = srcRect.toSkRect();
+    if (skiaSrcRect.isEmpty()) {
+        skiaSrcRect = SkRect::MakeIWH(displayedWidth, displayedHeight);
+    }
+    if (!skiaSrcRect.intersect(SkRect::MakeIWH(displayedWidth, displayedHeight))) {
+        return false;
+    }
+
+    SkMatrix textureMatrixInv;
+    imgTransform.copyTo(textureMatrixInv);
+    // TODO: after skia bug https://bugs.chromium.org/p/skia/issues/detail?id=7075 is fixed
+    // use bottom left origin and remove flipV and invert transformations.
+    SkMatrix flipV;
+    flipV.setAll(1, 0, 0, 0, -1, 1, 0, 0, 1);
+    textureMatrixInv.preConcat(flipV);
+    textureMatrixInv.preScale(1.0f / displayedWidth, 1.0f / displayedHeight);
+    textureMatrixInv.postScale(imgWidth, imgHeight);
+    SkMatrix textureMatrix;
+    if (!textureMatrixInv.invert(&textureMatrix)) {
+        textureMatrix = textureMatrixInv;
+    }
+
+    textureMatrixInv.mapRect(&skiaSrcRect);
+    textureMatrixInv.mapRect(&skiaDestRect);
+
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    // Apply a filter, which is matching OpenGL pipeline readback behaviour. Filter usage
+    // is codified by tests using golden images like DecodeAccuracyTest.
+    bool disableFilter = MathUtils::areEqual(skiaSrcRect.width(), skiaDestRect.width()) &&
+                         MathUtils::areEqual(skiaSrcRect.height(), skiaDestRect.height());
+    if (!disableFilter) {
+        paint.setFilterQuality(kLow_SkFilterQuality);
+    }
+    dest->getCanvas()->concat(textureMatrix);
+    dest->getCanvas()->drawImageRect(image, skiaSrcRect, skiaDestRect, &paint,
+                                     SkCanvas::kFast_SrcRectConstraint);
+    return true;
+}
+
 CopyResult SkiaOpenGLReadback::copyImageInto(EGLImageKHR eglImage, const Matrix4& imgTransform,
                                              int imgWidth, int imgHeight, const Rect& srcRect,
                                              SkBitmap* bitmap) {
@@ -78,54 +139,13 @@ CopyResult SkiaOpenGLReadback::copyImageInto(EGLImageKHR eglImage, const Matrix4
     sk_sp<SkImage> image(SkImage::MakeFromAdoptedTexture(grContext.get(), backendTexture,
                                                          kTopLeft_GrSurfaceOrigin));
     if (image) {
-        int displayedWidth = imgWidth, displayedHeight = imgHeight;
-        // If this is a 90 or 270 degree rotation we need to swap width/height to get the device
-        // size.
-        if (imgTransform[Matrix4::kSkewX] >= 0.5f || imgTransform[Matrix4::kSkewX] <= -0.5f) {
-            std::swap(displayedWidth, displayedHeight);
-        }
-        SkRect skiaDestRect = SkRect::MakeWH(bitmap->width(), bitmap->height());
-        SkRect skiaSrcRect = srcRect.toSkRect();
-        if (skiaSrcRect.isEmpty()) {
-            skiaSrcRect = SkRect::MakeIWH(displayedWidth, displayedHeight);
-        }
-        bool srcNotEmpty = skiaSrcRect.intersect(SkRect::MakeIWH(displayedWidth, displayedHeight));
-
-        if (srcNotEmpty) {
-            SkMatrix textureMatrixInv;
-            imgTransform.copyTo(textureMatrixInv);
-            // TODO: after skia bug https://bugs.chromium.org/p/skia/issues/detail?id=7075 is fixed
-            // use bottom left origin and remove flipV and invert transformations.
-            SkMatrix flipV;
-            flipV.setAll(1, 0, 0, 0, -1, 1, 0, 0, 1);
-            textureMatrixInv.preConcat(flipV);
-            textureMatrixInv.preScale(1.0f / displayedWidth, 1.0f / displayedHeight);
-            textureMatrixInv.postScale(imgWidth, imgHeight);
-            SkMatrix textureMatrix;
-            if (!textureMatrixInv.invert(&textureMatrix)) {
-                textureMatrix = textureMatrixInv;
-            }
-
-            textureMatrixInv.mapRect(&skiaSrcRect);
-            textureMatrixInv.mapRect(&skiaDestRect);
-
-            // we render in an offscreen buffer to scale and to avoid an issue b/62262733
-            // with reading incorrect data from EGLImage backed SkImage (likely a driver bug)
-            sk_sp<SkSurface> scaledSurface =
-                    SkSurface::MakeRenderTarget(grContext.get(), SkBudgeted::kYes, bitmap->info());
-            SkPaint paint;
-            paint.setBlendMode(SkBlendMode::kSrc);
-            // Apply a filter, which is matching OpenGL pipeline readback behaviour. Filter usage
-            // is codified by tests using golden images like DecodeAccuracyTest.
-            bool disableFilter = MathUtils::areEqual(skiaSrcRect.width(), skiaDestRect.width())
-                    && MathUtils::areEqual(skiaSrcRect.height(), skiaDestRect.height());
-            if (!disableFilter) {
-                paint.setFilterQuality(kLow_SkFilterQuality);
-            }
-            scaledSurface->getCanvas()->concat(textureMatrix);
-            scaledSurface->getCanvas()->drawImageRect(image, skiaSrcRect, skiaDestRect, &paint,
-                                                      SkCanvas::kFast_SrcRectConstraint);
+        // we render in an offscreen buffer to scale and to avoid an issue b/62262733
+        // with reading incorrect data from EGLImage backed SkImage (likely a driver bug)
+        sk_sp<SkSurface> scaledSurface =
+                SkSurface::MakeRenderTarget(grContext.get(), SkBudgeted::kYes, bitmap->info());
 
+        if (renderImageScaled(image, imgTransform, imgWidth, imgHeight, srcRect,
+                              scaledSurface.get())) {
             image = scaledSurface->makeImageSnapshot();
 
             if (image->readPixels(bitmap->info(), bitmap->getPixels(), bitmap->rowBytes(), 0, 0)) {
@@ -141,6 +161,208 @@ CopyResult SkiaOpenGLReadback::copyImageInto(EGLImageKHR eglImage, const Matrix4
     return copyResult;
 }
 
+bool SkiaOpenGLReadback::copyImageIntoAsync(EGLImageKHR eglImage, const Matrix4& imgTransform,
+                                            int imgWidth, int imgHeight, const Rect& srcRect,
+                                            SkBitmap* bitmap, CopyCallback& callback) {
+    if (Properties::getRenderPipelineType() != RenderPipelineType::SkiaGL) {
+        // When running on Vulkan this class uses a one-shot GL GrContext that
+        // can't outlive the call, so copies can't be left in flight.
+        return false;
+    }
+    if (bitmap->colorType() != kN32_SkColorType) {
+        // The PBO pack format is fixed to RGBA8888
+        return false;
+    }
+    GrContext* grContext = mRenderThread.getGrContext();
+    if (!grContext) {
+        return false;
+    }
+
+    int pboIndex = -1;
+    for (int i = 0; i < kPboRingSize; i++) {
+        if (!mPboInFlight[i]) {
+            pboIndex = i;
+            break;
+        }
+    }
+    if (pboIndex < 0) {
+        // Ring exhausted; let this capture block rather than queue unbounded
+        return false;
+    }
+
+    GLuint sourceTexId;
+    glGenTextures(1, &sourceTexId);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, sourceTexId);
+    glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, eglImage);
+
+    // Render target the GPU can pack from: our own texture + FBO, wrapped as
+    // an SkSurface below so Skia performs the scaled draw into it.
+    GLuint destTex, destFbo;
+    glGenTextures(1, &destTex);
+    glBindTexture(GL_TEXTURE_2D, destTex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, bitmap->width(), bitmap->height(), 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+    glGenFramebuffers(1, &destFbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, destFbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, destTex, 0);
+
+    grContext->resetContext();
+
+    GrGLTextureInfo externalTexture;
+    externalTexture.fTarget = GL_TEXTURE_EXTERNAL_OES;
+    externalTexture.fID = sourceTexId;
+    GrBackendTexture backendTexture(imgWidth, imgHeight, kRGBA_8888_GrPixelConfig, externalTexture);
+    sk_sp<SkImage> image(
+            SkImage::MakeFromAdoptedTexture(grContext, backendTexture, kTopLeft_GrSurfaceOrigin));
+
+    GrGLFramebufferInfo fboInfo;
+    fboInfo.fFBOID = destFbo;
+    GrBackendRenderTarget backendRT(bitmap->width(), bitmap->height(), 0, 0,
+                                    kRGBA_8888_GrPixelConfig, fboInfo);
+    SkSurfaceProps props(0, kUnknown_SkPixelGeometry);
+    sk_sp<SkSurface> scaledSurface(SkSurface::MakeFromBackendRenderTarget(
+            grContext, backendRT, kTopLeft_GrSurfaceOrigin, nullptr, &props));
+
+    if (!image || !scaledSurface) {
+        image.reset();
+        glDeleteFramebuffers(1, &destFbo);
+        glDeleteTextures(1, &destTex);
+        grContext->resetContext();
+        return false;
+    }
+
+    bool srcNotEmpty =
+            renderImageScaled(image, imgTransform, imgWidth, imgHeight, srcRect,
+                              scaledSurface.get());
+    grContext->flush();
+    scaledSurface.reset();
+
+    if (!srcNotEmpty) {
+        image.reset();
+        glDeleteFramebuffers(1, &destFbo);
+        glDeleteTextures(1, &destTex);
+        grContext->resetContext();
+        eglDestroyImageKHR(eglGetDisplay(EGL_DEFAULT_DISPLAY), eglImage);
+        callback(CopyResult::UnknownError);
+        return true;
+    }
+
+    // Queue the pack into the PBO and fence it; nothing here waits on the GPU
+    const size_t bufferSize = bitmap->width() * bitmap->height() * 4;
+    if (!mPboRing[pboIndex]) {
+        glGenBuffers(1, &mPboRing[pboIndex]);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, destFbo);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPboRing[pboIndex]);
+    if (mPboSize[pboIndex] != bufferSize) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, bufferSize, nullptr, GL_STREAM_READ);
+        mPboSize[pboIndex] = bufferSize;
+    }
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, bitmap->width(), bitmap->height(), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // The pack is queued; the driver keeps the storage alive until it executes
+    glDeleteFramebuffers(1, &destFbo);
+    glDeleteTextures(1, &destTex);
+    if (!fence) {
+        // Very unlikely; without a fence there is nothing to poll, so drain
+        // the pipe now and let the poll below find the copy already done.
+        glFinish();
+    }
+    glFlush();
+    grContext->resetContext();
+
+    mPboInFlight[pboIndex] = true;
+    mPendingCopies.push_back(
+            PendingCopy{pboIndex, fence, eglImage, std::move(image), bitmap, std::move(callback)});
+    schedulePoll();
+    return true;
+}
+
+void SkiaOpenGLReadback::schedulePoll() {
+    if (mPollScheduled) return;
+    mPollScheduled = true;
+    mRenderThread.queue().postDelayed(kFencePollInterval, [this]() { processPendingCopies(); });
+}
+
+void SkiaOpenGLReadback::processPendingCopies() {
+    ATRACE_CALL();
+    mPollScheduled = false;
+    if (!mRenderThread.eglManager().hasEglContext()) {
+        // The context went away with our copies still in flight; the GL
+        // objects died with it, all we can do is report the failures.
+        for (PendingCopy& copy : mPendingCopies) {
+            mPboInFlight[copy.pboIndex] = false;
+            copy.callback(CopyResult::UnknownError);
+        }
+        mPendingCopies.clear();
+        for (int i = 0; i < kPboRingSize; i++) {
+            mPboRing[i] = 0;
+            mPboSize[i] = 0;
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < mPendingCopies.size();) {
+        PendingCopy& copy = mPendingCopies[i];
+        GLenum status =
+                copy.fence ? glClientWaitSync(copy.fence, 0, 0) : GL_ALREADY_SIGNALED;
+        if (status == GL_TIMEOUT_EXPIRED) {
+            i++;
+            continue;
+        }
+        finishPendingCopy(copy, status == GL_WAIT_FAILED ? CopyResult::UnknownError
+                                                         : CopyResult::Success);
+        mPendingCopies.erase(mPendingCopies.begin() + i);
+    }
+
+    if (GrContext* grContext = mRenderThread.getGrContext()) {
+        // We touched raw GL state while mapping the buffers
+        grContext->resetContext();
+    }
+    if (!mPendingCopies.empty()) {
+        schedulePoll();
+    }
+}
+
+void SkiaOpenGLReadback::finishPendingCopy(PendingCopy& copy, CopyResult result) {
+    if (result == CopyResult::Success) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mPboRing[copy.pboIndex]);
+        const size_t rowBytes = copy.bitmap->width() * 4;
+        const size_t bufferSize = rowBytes * copy.bitmap->height();
+        void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bufferSize, GL_MAP_READ_BIT);
+        if (mapped) {
+            if (copy.bitmap->rowBytes() == rowBytes) {
+                memcpy(copy.bitmap->getPixels(), mapped, bufferSize);
+            } else {
+                for (int y = 0; y < copy.bitmap->height(); y++) {
+                    memcpy(reinterpret_cast<uint8_t*>(copy.bitmap->getPixels()) +
+                                   y * copy.bitmap->rowBytes(),
+                           reinterpret_cast<const uint8_t*>(mapped) + y * rowBytes, rowBytes);
+                }
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            copy.bitmap->notifyPixelsChanged();
+        } else {
+            result = CopyResult::UnknownError;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+    if (copy.fence) {
+        glDeleteSync(copy.fence);
+    }
+    // Deleting the SkImage deletes the adopted source texture; only then is
+    // it safe to destroy the EGLImage it samples from
+    copy.image.reset();
+    eglDestroyImageKHR(eglGetDisplay(EGL_DEFAULT_DISPLAY), copy.sourceImage);
+    mPboInFlight[copy.pboIndex] = false;
+    copy.callback(result);
+}
+
 } /* namespace skiapipeline */
 } /* namespace uirenderer */
 } /* namespace android */
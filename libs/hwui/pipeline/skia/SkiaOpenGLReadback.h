@@ -18,6 +18,11 @@
 
 #include "OpenGLReadback.h"
 
+#include <GLES3/gl3.h>
+#include <SkImage.h>
+
+#include <vector>
+
 namespace android {
 namespace uirenderer {
 namespace skiapipeline {
@@ -30,6 +35,47 @@ protected:
     virtual CopyResult copyImageInto(EGLImageKHR eglImage, const Matrix4& imgTransform,
                                      int imgWidth, int imgHeight, const Rect& srcRect,
                                      SkBitmap* bitmap) override;
+
+    /**
+     * Asynchronous variant: renders the scaled copy, queues a glReadPixels
+     * into a PBO from a small ring and returns without waiting. A fence is
+     * polled from the RenderThread queue; when it signals, the PBO is mapped,
+     * copied into the bitmap and the callback invoked. Returns false - so the
+     * caller falls back to the blocking path - when the ring is exhausted or
+     * the copy isn't expressible as an RGBA8888 pack.
+     */
+    virtual bool copyImageIntoAsync(EGLImageKHR eglImage, const Matrix4& imgTransform, int imgWidth,
+                                    int imgHeight, const Rect& srcRect, SkBitmap* bitmap,
+                                    CopyCallback& callback) override;
+
+private:
+    /**
+     * One glReadPixels still in flight on the GPU.
+     */
+    struct PendingCopy {
+        int pboIndex;
+        GLsync fence;
+        EGLImageKHR sourceImage;
+        // Keeps the adopted source texture alive until the fence signals
+        sk_sp<SkImage> image;
+        SkBitmap* bitmap;
+        CopyCallback callback;
+    };
+
+    void schedulePoll();
+    void processPendingCopies();
+    void finishPendingCopy(PendingCopy& copy, CopyResult result);
+
+    // Three slots cover capture at frame rate: one being written by the GPU,
+    // one waiting for the poll, one free for the next request.
+    static const int kPboRingSize = 3;
+
+    GLuint mPboRing[kPboRingSize] = {0, 0, 0};
+    size_t mPboSize[kPboRingSize] = {0, 0, 0};
+    bool mPboInFlight[kPboRingSize] = {false, false, false};
+
+    std::vector<PendingCopy> mPendingCopies;
+    bool mPollScheduled = false;
 };
 
 } /* namespace skiapipeline */
@@ -16,6 +16,8 @@
 
 #include "SkiaPipeline.h"
 
+#include <math.h>
+
 #include <SkImageEncoder.h>
 #include <SkImagePriv.h>
 #include <SkOverdrawCanvas.h>
@@ -323,7 +325,7 @@ void SkiaPipeline::endCapture(SkSurface* surface) {
 void SkiaPipeline::renderFrame(const LayerUpdateQueue& layers, const SkRect& clip,
                                const std::vector<sp<RenderNode>>& nodes, bool opaque,
                                bool wideColorGamut, const Rect& contentDrawBounds,
-                               sk_sp<SkSurface> surface) {
+                               sk_sp<SkSurface> surface, const std::vector<SkRect>& clipRects) {
     renderVectorDrawableCache();
 
     // draw all layers up front
@@ -334,7 +336,20 @@ void SkiaPipeline::renderFrame(const LayerUpdateQueue& layers, const SkRect& cli
     std::unique_ptr<SkPictureRecorder> recorder;
     SkCanvas* canvas = tryCapture(surface.get());
 
-    renderFrameImpl(layers, clip, nodes, opaque, wideColorGamut, contentDrawBounds, canvas);
+    if (CC_UNLIKELY(mRenderScale != 1.0f)) {
+        // The surface is smaller than the window; scale the canvas so content
+        // recorded in logical coordinates shrinks into the buffer. Partial
+        // updates are disabled in this mode, so repaint the whole frame.
+        SkAutoCanvasRestore saver(canvas, true);
+        canvas->scale(mRenderScale, mRenderScale);
+        SkRect logicalClip = SkRect::MakeWH(ceilf(surface->width() / mRenderScale),
+                                            ceilf(surface->height() / mRenderScale));
+        renderFrameImpl(layers, logicalClip, nodes, opaque, wideColorGamut, contentDrawBounds,
+                        canvas, clipRects);
+    } else {
+        renderFrameImpl(layers, clip, nodes, opaque, wideColorGamut, contentDrawBounds, canvas,
+                        clipRects);
+    }
 
     endCapture(surface.get());
 
@@ -356,9 +371,19 @@ static Rect nodeBounds(RenderNode& node) {
 void SkiaPipeline::renderFrameImpl(const LayerUpdateQueue& layers, const SkRect& clip,
                                    const std::vector<sp<RenderNode>>& nodes, bool opaque,
                                    bool wideColorGamut, const Rect& contentDrawBounds,
-                                   SkCanvas* canvas) {
+                                   SkCanvas* canvas, const std::vector<SkRect>& clipRects) {
     SkAutoCanvasRestore saver(canvas, true);
     canvas->androidFramework_setDeviceClipRestriction(clip.roundOut());
+    if (clipRects.size() > 1) {
+        // The damage is made of several distinct areas; clip drawing to them
+        // so the declared EGL damage region stays truthful. Applied before
+        // any save so content draws cannot escape it.
+        SkRegion clipRegion;
+        for (const SkRect& rect : clipRects) {
+            clipRegion.op(rect.roundOut(), SkRegion::kUnion_Op);
+        }
+        canvas->clipRegion(clipRegion);
+    }
 
     // STOPSHIP: Revert, temporary workaround to clear always F16 frame buffer for b/74976293
     if (!opaque || wideColorGamut) {
@@ -494,7 +519,8 @@ void SkiaPipeline::renderOverdraw(const LayerUpdateQueue& layers, const SkRect&
     // each time a pixel would have been drawn.
     // Pass true for opaque so we skip the clear - the overdrawCanvas is already zero
     // initialized.
-    renderFrameImpl(layers, clip, nodes, true, false, contentDrawBounds, &overdrawCanvas);
+    renderFrameImpl(layers, clip, nodes, true, false, contentDrawBounds, &overdrawCanvas,
+                    std::vector<SkRect>());
     sk_sp<SkImage> counts = offscreen->makeImageSnapshot();
 
     // Draw overdraw colors to the canvas.  The color filter will convert counts to colors.
@@ -49,9 +49,15 @@ public:
     bool createOrUpdateLayer(RenderNode* node, const DamageAccumulator& damageAccumulator,
                              bool wideColorGamut, ErrorHandler* errorHandler) override;
 
+    // When clipRects holds more than one rect, drawing is additionally
+    // clipped to their union so the rects can back a multi-rect EGL damage
+    // region; an empty or single-entry list leaves only the clip rect.
     void renderFrame(const LayerUpdateQueue& layers, const SkRect& clip,
                      const std::vector<sp<RenderNode>>& nodes, bool opaque, bool wideColorGamut,
-                     const Rect& contentDrawBounds, sk_sp<SkSurface> surface);
+                     const Rect& contentDrawBounds, sk_sp<SkSurface> surface,
+                     const std::vector<SkRect>& clipRects = std::vector<SkRect>());
+
+    void setRenderScale(float renderScale) override { mRenderScale = renderScale; }
 
     std::vector<VectorDrawableRoot*>* getVectorDrawables() { return &mVectorDrawables; }
 
@@ -110,10 +116,15 @@ protected:
 
     renderthread::RenderThread& mRenderThread;
 
+    // Scale between the logical frame size content was recorded against and
+    // the reduced-size buffer backing the surface; see setRenderScale().
+    float mRenderScale = 1.0f;
+
 private:
     void renderFrameImpl(const LayerUpdateQueue& layers, const SkRect& clip,
                          const std::vector<sp<RenderNode>>& nodes, bool opaque, bool wideColorGamut,
-                         const Rect& contentDrawBounds, SkCanvas* canvas);
+                         const Rect& contentDrawBounds, SkCanvas* canvas,
+                         const std::vector<SkRect>& clipRects);
 
     /**
      *  Debugging feature.  Draws a semi-transparent overlay on each pixel, indicating
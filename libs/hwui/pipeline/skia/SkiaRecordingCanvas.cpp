@@ -51,6 +51,8 @@ uirenderer::DisplayList* SkiaRecordingCanvas::finishRecording() {
     // close any existing chunks if necessary
     insertReorderBarrier(false);
     mRecorder.restoreToCount(1);
+    // drop any wrappers that were not re-recorded, so their nodes can be freed
+    mDisplayList->mReusableChildren.clear();
     return mDisplayList.release();
 }
 
@@ -103,7 +105,17 @@ void SkiaRecordingCanvas::drawLayer(uirenderer::DeferredLayerUpdater* layerUpdat
 
 void SkiaRecordingCanvas::drawRenderNode(uirenderer::RenderNode* renderNode) {
     // Record the child node. Drawable dtor will be invoked when mChildNodes deque is cleared.
-    mDisplayList->mChildNodes.emplace_back(renderNode, asSkCanvas(), true, mCurrentBarrier);
+    auto& reusable = mDisplayList->mReusableChildren;
+    if (!reusable.empty() && reusable.front().getRenderNode() == renderNode &&
+        reusable.front().getRecordedMatrix() == asSkCanvas()->getTotalMatrix()) {
+        // The child shows up in the same order under the same transform as in the previous
+        // recording of this node, so splice the existing wrapper in rather than rebuilding it.
+        mDisplayList->mChildNodes.emplace_back(std::move(reusable.front()),
+                                               nullptr != mCurrentBarrier);
+        reusable.pop_front();
+    } else {
+        mDisplayList->mChildNodes.emplace_back(renderNode, asSkCanvas(), true, mCurrentBarrier);
+    }
     auto& renderNodeDrawable = mDisplayList->mChildNodes.back();
     drawDrawable(&renderNodeDrawable);
 
@@ -21,6 +21,7 @@
 #include "SkiaPipeline.h"
 #include "SkiaProfileRenderer.h"
 #include "VkLayer.h"
+#include "hwui/HardwareBufferPool.h"
 #include "renderstate/RenderState.h"
 #include "renderthread/Frame.h"
 
@@ -62,6 +63,7 @@ Frame SkiaVulkanPipeline::getFrame() {
 }
 
 bool SkiaVulkanPipeline::draw(const Frame& frame, const SkRect& screenDirty, const SkRect& dirty,
+                              const std::vector<SkRect>& dirtyRects,
                               const FrameBuilder::LightGeometry& lightGeometry,
                               LayerUpdateQueue* layerUpdateQueue, const Rect& contentDrawBounds,
                               bool opaque, bool wideColorGamut,
@@ -95,6 +97,7 @@ bool SkiaVulkanPipeline::draw(const Frame& frame, const SkRect& screenDirty, con
 }
 
 bool SkiaVulkanPipeline::swapBuffers(const Frame& frame, bool drew, const SkRect& screenDirty,
+                                     const std::vector<SkRect>& screenDirtyRects,
                                      FrameInfo* currentFrameInfo, bool* requireSwap) {
     *requireSwap = drew;
 
@@ -161,14 +164,13 @@ sk_sp<Bitmap> SkiaVulkanPipeline::allocateHardwareBitmap(renderthread::RenderThr
                                                          SkBitmap& skBitmap) {
     // TODO: implement this function for Vulkan pipeline
     // code below is a hack to avoid crashing because of missing HW Bitmap support
-    sp<GraphicBuffer> buffer = new GraphicBuffer(
+    sp<GraphicBuffer> buffer = HardwareBufferPool::getInstance().obtain(
             skBitmap.info().width(), skBitmap.info().height(), PIXEL_FORMAT_RGBA_8888,
             GraphicBuffer::USAGE_HW_TEXTURE | GraphicBuffer::USAGE_SW_WRITE_NEVER |
                     GraphicBuffer::USAGE_SW_READ_NEVER,
             std::string("SkiaVulkanPipeline::allocateHardwareBitmap pid [") +
                     std::to_string(getpid()) + "]");
-    status_t error = buffer->initCheck();
-    if (error < 0) {
+    if (!buffer) {
         ALOGW("SkiaVulkanPipeline::allocateHardwareBitmap() failed in GraphicBuffer.create()");
         return nullptr;
     }
@@ -41,8 +41,9 @@ void VectorDrawableAtlas::prepareForDraw(GrContext* context) {
             mPixelAllocated = 0;
             mConsecutiveFailures = 0;
             mFreeRects.clear();
+            mMigrationStalled = false;
         } else {
-            if (isFragmented()) {
+            if (isFragmented() || (mStandaloneCandidates > 0 && !mMigrationStalled)) {
                 // Invoke repack outside renderFrame to avoid jank.
                 renderthread::RenderProxy::repackVectorDrawableAtlas();
             }
@@ -52,6 +53,12 @@ void VectorDrawableAtlas::prepareForDraw(GrContext* context) {
 
 #define MAX_CONSECUTIVE_FAILURES 5
 #define MAX_UNUSED_RATIO 2.0f
+// Remainders of a split free slot smaller than this in either dimension are dropped,
+// because no useful VD slot fits in them. Repack reclaims the dropped pixels.
+#define MIN_SPLIT_DIMENSION 4
+// Upper bound of standalone surfaces moved back into the atlas per repackIfNeeded call,
+// keeping each migration pass cheap enough to run between frames.
+#define MAX_MIGRATIONS_PER_PASS 4
 
 bool VectorDrawableAtlas::isFragmented() {
     return mConsecutiveFailures > MAX_CONSECUTIVE_FAILURES &&
@@ -64,6 +71,8 @@ void VectorDrawableAtlas::repackIfNeeded(GrContext* context) {
     // used by atlas VDs.
     if (isFragmented() && mSurface) {
         repack(context);
+    } else if (mSurface && mStandaloneCandidates > 0 && !mMigrationStalled) {
+        migrateStandaloneEntries(context);
     }
 }
 
@@ -147,6 +156,87 @@ void VectorDrawableAtlas::repack(GrContext* context) {
     context->flush();
     mSurface = newSurface;
     mConsecutiveFailures = 0;
+    // Entries may have moved between the atlas and standalone surfaces in both directions,
+    // so recount the candidates for incremental migration.
+    mStandaloneCandidates = 0;
+    for (CacheEntry& entry : mRects) {
+        if (isMigrationCandidate(entry)) {
+            mStandaloneCandidates++;
+        }
+    }
+    mMigrationStalled = false;
+}
+
+bool VectorDrawableAtlas::isMigrationCandidate(const CacheEntry& entry) {
+    return entry.surface && fitInAtlas(entry.VDrect.width(), entry.VDrect.height());
+}
+
+bool VectorDrawableAtlas::allocateSlot(int width, int height, bool tryRectanizer, SkRect* slot) {
+    if (tryRectanizer) {
+        SkIPoint16 pos;
+        if (mRectanizer->addRect(width, height, &pos)) {
+            *slot = SkRect::MakeXYWH(pos.fX, pos.fY, width, height);
+            mPixelAllocated += width * height;
+            return true;
+        }
+    }
+
+    // Try to reuse atlas memory from rectangles freed by "releaseEntry". The multimap is
+    // ordered by area, so the first fitting rectangle wastes the least pixels.
+    auto freeRectIt = mFreeRects.lower_bound((size_t)(width * height));
+    while (freeRectIt != mFreeRects.end()) {
+        SkRect freeRect = freeRectIt->second;
+        if (freeRect.width() >= width && freeRect.height() >= height) {
+            mFreeRects.erase(freeRectIt);
+            *slot = SkRect::MakeXYWH(freeRect.fLeft, freeRect.fTop, width, height);
+            // Return the unused remainder of the slot to the free list (guillotine split),
+            // so a small VD cannot permanently pin a much larger freed slot.
+            SkRect right = SkRect::MakeLTRB(freeRect.fLeft + width, freeRect.fTop,
+                                            freeRect.fRight, freeRect.fTop + height);
+            SkRect bottom = SkRect::MakeLTRB(freeRect.fLeft, freeRect.fTop + height,
+                                             freeRect.fRight, freeRect.fBottom);
+            if (right.width() >= MIN_SPLIT_DIMENSION && right.height() >= MIN_SPLIT_DIMENSION) {
+                mFreeRects.emplace((size_t)(right.width() * right.height()), right);
+            }
+            if (bottom.width() >= MIN_SPLIT_DIMENSION && bottom.height() >= MIN_SPLIT_DIMENSION) {
+                mFreeRects.emplace((size_t)(bottom.width() * bottom.height()), bottom);
+            }
+            return true;
+        }
+        freeRectIt++;
+    }
+    return false;
+}
+
+void VectorDrawableAtlas::migrateStandaloneEntries(GrContext* context) {
+    ATRACE_CALL();
+    SkCanvas* canvas = mSurface->getCanvas();
+    int budget = MAX_MIGRATIONS_PER_PASS;
+    for (CacheEntry& entry : mRects) {
+        if (0 == budget) {
+            break;
+        }
+        if (!isMigrationCandidate(entry)) {
+            continue;
+        }
+        int width = entry.VDrect.width();
+        int height = entry.VDrect.height();
+        SkRect slot;
+        if (!allocateSlot(width, height, true, &slot)) {
+            // The atlas has no room; stop scheduling passes until space is freed or repacked.
+            mMigrationStalled = true;
+            break;
+        }
+        sk_sp<SkImage> sourceImage = entry.surface->makeImageSnapshot();
+        canvas->drawImageRect(sourceImage.get(), entry.VDrect, slot, nullptr);
+        entry.VDrect = slot;
+        entry.rect = slot;
+        entry.surface = nullptr;
+        mPixelUsedByVDs += width * height;
+        mStandaloneCandidates--;
+        budget--;
+    }
+    context->flush();
 }
 
 AtlasEntry VectorDrawableAtlas::requestNewEntry(int width, int height, GrContext* context) {
@@ -158,13 +248,12 @@ AtlasEntry VectorDrawableAtlas::requestNewEntry(int width, int height, GrContext
     if (mSurface) {
         const size_t area = width * height;
 
-        // Use a rectanizer to allocate unused space from the atlas surface.
+        // Allocate unused space from the atlas surface or reuse a freed slot.
         bool notTooBig = fitInAtlas(width, height);
-        SkIPoint16 pos;
-        if (notTooBig && mRectanizer->addRect(width, height, &pos)) {
+        SkRect slot;
+        if (allocateSlot(width, height, notTooBig, &slot)) {
             mPixelUsedByVDs += area;
-            mPixelAllocated += area;
-            result.rect = SkRect::MakeXYWH(pos.fX, pos.fY, width, height);
+            result.rect = slot;
             result.surface = mSurface;
             auto eraseIt = mRects.emplace(mRects.end(), result.rect, result.rect, nullptr);
             CacheEntry* entry = &(*eraseIt);
@@ -174,25 +263,6 @@ AtlasEntry VectorDrawableAtlas::requestNewEntry(int width, int height, GrContext
             return result;
         }
 
-        // Try to reuse atlas memory from rectangles freed by "releaseEntry".
-        auto freeRectIt = mFreeRects.lower_bound(area);
-        while (freeRectIt != mFreeRects.end()) {
-            SkRect& freeRect = freeRectIt->second;
-            if (freeRect.width() >= width && freeRect.height() >= height) {
-                result.rect = SkRect::MakeXYWH(freeRect.fLeft, freeRect.fTop, width, height);
-                result.surface = mSurface;
-                auto eraseIt = mRects.emplace(mRects.end(), result.rect, freeRect, nullptr);
-                CacheEntry* entry = &(*eraseIt);
-                entry->eraseIt = eraseIt;
-                result.key = reinterpret_cast<AtlasKey>(entry);
-                mPixelUsedByVDs += area;
-                mFreeRects.erase(freeRectIt);
-                mConsecutiveFailures = 0;
-                return result;
-            }
-            freeRectIt++;
-        }
-
         if (notTooBig && mConsecutiveFailures <= MAX_CONSECUTIVE_FAILURES) {
             mConsecutiveFailures++;
         }
@@ -206,6 +276,9 @@ AtlasEntry VectorDrawableAtlas::requestNewEntry(int width, int height, GrContext
         CacheEntry* entry = &(*eraseIt);
         entry->eraseIt = eraseIt;
         result.key = reinterpret_cast<AtlasKey>(entry);
+        if (isMigrationCandidate(*entry)) {
+            mStandaloneCandidates++;
+        }
     }
 
     return result;
@@ -247,6 +320,10 @@ void VectorDrawableAtlas::releaseEntry(AtlasKey atlasKey) {
             size_t VDRectArea = removedVDRect.width() * removedVDRect.height();
             mPixelUsedByVDs -= VDRectArea;
             mConsecutiveFailures = 0;
+            // Freed atlas space may unblock a stalled migration pass.
+            mMigrationStalled = false;
+        } else if (isMigrationCandidate(*entry)) {
+            mStandaloneCandidates--;
         }
         auto eraseIt = entry->eraseIt;
         mRects.erase(eraseIt);
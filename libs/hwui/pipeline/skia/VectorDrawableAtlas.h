@@ -73,7 +73,10 @@ public:
 
     /**
      * Repack the atlas if needed, by moving used rectangles into a new atlas surface.
-     * The goal of repacking is to fix a fragmented atlas.
+     * The goal of repacking is to fix a fragmented atlas. If the atlas is not fragmented,
+     * this incrementally migrates a few standalone surfaces back into the atlas instead,
+     * so VDs that spilled out while the atlas was full do not stay on their own render
+     * targets forever.
      */
     void repackIfNeeded(GrContext* context);
 
@@ -178,6 +181,18 @@ private:
      */
     int mConsecutiveFailures = 0;
 
+    /**
+     * Number of standalone surface entries small enough to live in the atlas. They are created
+     * when the atlas is full and are migrated back a few at a time by "migrateStandaloneEntries".
+     */
+    int mStandaloneCandidates = 0;
+
+    /**
+     * Set when a migration pass could not place any candidate, so we stop scheduling passes
+     * until atlas space is freed or the atlas is repacked.
+     */
+    bool mMigrationStalled = false;
+
     /**
      * mStorageMode allows using a shared surface to store small vector drawables.
      * Using a shared surface can boost the performance by allowing GL ops to be batched, but may
@@ -204,6 +219,23 @@ private:
 
     void repack(GrContext* context);
 
+    /**
+     * Move a bounded number of standalone surface entries into free atlas space. Bounding the
+     * work keeps each pass cheap enough to run between frames, unlike a full repack.
+     */
+    void migrateStandaloneEntries(GrContext* context);
+
+    /**
+     * Claim a width x height slot from the rectanizer or from the free list. Free slots larger
+     * than the request are split and their remainder is returned to the free list.
+     */
+    bool allocateSlot(int width, int height, bool tryRectanizer, SkRect* slot);
+
+    /**
+     * Returns true if the entry draws into its own surface but would fit in the atlas.
+     */
+    bool isMigrationCandidate(const CacheEntry& entry);
+
     static bool compareCacheEntry(const CacheEntry& first, const CacheEntry& second);
 };
 
@@ -108,6 +108,15 @@ OffscreenBuffer::~OffscreenBuffer() {
     ATRACE_FORMAT("Destroy %ux%u HW Layer", texture.width(), texture.height());
     texture.deleteTexture();
     renderState.meshState().deleteMeshBuffer(vbo);
+    if (stencil) {
+        // Hand the stencil back for reuse by other layers of the same size
+        if (Caches::hasInstance()) {
+            Caches::getInstance().renderBufferCache.put(stencil);
+        } else {
+            delete stencil;
+        }
+        stencil = nullptr;
+    }
     elementCount = 0;
     vbo = 0;
 }
@@ -20,6 +20,7 @@
 #include <GpuMemoryTracker.h>
 #include <ui/Region.h>
 #include "Caches.h"
+#include "RenderBuffer.h"
 #include "Texture.h"
 #include "utils/Macros.h"
 
@@ -60,7 +61,9 @@ public:
 
     static uint32_t computeIdealDimension(uint32_t dimension);
 
-    uint32_t getSizeInBytes() { return texture.objectSize(); }
+    uint32_t getSizeInBytes() {
+        return texture.objectSize() + (stencil ? stencil->getSize() : 0);
+    }
 
     RenderState& renderState;
 
@@ -68,6 +71,11 @@ public:
     uint32_t viewportHeight;
     Texture texture;
 
+    // Stencil buffer sized to the texture, kept with the layer once clipping
+    // has required one, so reuse from the pool comes with a warm stencil.
+    // Released to the RenderBufferCache when the layer is destroyed.
+    RenderBuffer* stencil = nullptr;
+
     bool wideColorGamut = false;
 
     // Portion of layer that has been drawn to. Used to minimize drawing area when
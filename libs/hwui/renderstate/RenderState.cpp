@@ -150,6 +150,9 @@ void RenderState::bindFramebuffer(GLuint fbo) {
 }
 
 GLuint RenderState::createFramebuffer() {
+    if (mCaches) {
+        return mCaches->fboCache.get();
+    }
     GLuint ret;
     glGenFramebuffers(1, &ret);
     return ret;
@@ -161,6 +164,12 @@ void RenderState::deleteFramebuffer(GLuint fbo) {
         // Reflect this in our cached value.
         mFramebuffer = 0;
     }
+    if (mCaches) {
+        // Callers detach their attachments before releasing the FBO, so the
+        // name can be handed out again as-is.
+        mCaches->fboCache.put(fbo);
+        return;
+    }
     glDeleteFramebuffers(1, &fbo);
 }
 
@@ -263,21 +272,16 @@ void RenderState::render(const Glop& glop, const Matrix4& orthoMatrix,
     fill.program->set(orthoMatrix, glop.transform.modelView, glop.transform.meshTransform(),
                       glop.transform.transformFlags & TransformFlags::OffsetByFudgeFactor);
 
-    // Color filter uniforms
+    // Color filter uniforms. The program caches the last values sent, so
+    // runs of glops sharing a filter only pay for the first draw.
     if (fill.filterMode == ProgramDescription::ColorFilterMode::Blend) {
-        const FloatColor& color = fill.filter.color;
-        glUniform4f(mCaches->program().getUniform("colorBlend"), color.r, color.g, color.b,
-                    color.a);
+        fill.program->setColorFilterBlend(fill.filter.color);
     } else if (fill.filterMode == ProgramDescription::ColorFilterMode::Matrix) {
-        glUniformMatrix4fv(mCaches->program().getUniform("colorMatrix"), 1, GL_FALSE,
-                           fill.filter.matrix.matrix);
-        glUniform4fv(mCaches->program().getUniform("colorMatrixVector"), 1,
-                     fill.filter.matrix.vector);
+        fill.program->setColorFilterMatrix(fill.filter.matrix.matrix, fill.filter.matrix.vector);
     }
 
     // Round rect clipping uniforms
     if (glop.roundRectClipState) {
-        // TODO: avoid query, and cache values (or RRCS ptr) in program
         const RoundRectClipState* state = glop.roundRectClipState;
         const Rect& innerRect = state->innerRect;
 
@@ -286,15 +290,11 @@ void RenderState::render(const Glop& glop, const Matrix4& orthoMatrix,
 
         // Divide by the radius to simplify the calculations in the fragment shader
         // roundRectPos is also passed from vertex shader relative to top/left & radius
-        glUniform4f(fill.program->getUniform("roundRectInnerRectLTWH"),
-                    innerRect.left / roundedOutRadius, innerRect.top / roundedOutRadius,
-                    (innerRect.right - innerRect.left) / roundedOutRadius,
-                    (innerRect.bottom - innerRect.top) / roundedOutRadius);
-
-        glUniformMatrix4fv(fill.program->getUniform("roundRectInvTransform"), 1, GL_FALSE,
-                           &state->matrix.data[0]);
-
-        glUniform1f(fill.program->getUniform("roundRectRadius"), roundedOutRadius);
+        const float rectLTWH[4] = {innerRect.left / roundedOutRadius,
+                                   innerRect.top / roundedOutRadius,
+                                   (innerRect.right - innerRect.left) / roundedOutRadius,
+                                   (innerRect.bottom - innerRect.top) / roundedOutRadius};
+        fill.program->setRoundRectClip(rectLTWH, state->matrix, roundedOutRadius);
     }
 
     GL_CHECKPOINT(MODERATE);
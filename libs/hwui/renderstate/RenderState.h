@@ -56,6 +56,7 @@ class RenderState {
     PREVENT_COPY_AND_ASSIGN(RenderState);
     friend class renderthread::RenderThread;
     friend class Caches;
+    friend class GlShadowBlur;
     friend class renderthread::CacheManager;
 
 public:
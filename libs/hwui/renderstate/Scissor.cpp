@@ -17,6 +17,9 @@
 
 #include "Rect.h"
 
+#include <cutils/compiler.h>
+#include <math.h>
+
 #include <utils/Log.h>
 
 namespace android {
@@ -38,7 +41,20 @@ bool Scissor::setEnabled(bool enabled) {
     return false;
 }
 
+void Scissor::applyRenderScale(GLint& x, GLint& y, GLint& width, GLint& height) const {
+    // round outward so scaled clips never cut into content they should keep
+    GLint right = (GLint)ceilf((x + width) * mRenderScale);
+    GLint top = (GLint)ceilf((y + height) * mRenderScale);
+    x = (GLint)floorf(x * mRenderScale);
+    y = (GLint)floorf(y * mRenderScale);
+    width = right - x;
+    height = top - y;
+}
+
 bool Scissor::set(GLint x, GLint y, GLint width, GLint height) {
+    if (CC_UNLIKELY(mRenderScale != 1.0f)) {
+        applyRenderScale(x, y, width, height);
+    }
     if (mEnabled &&
         (x != mScissorX || y != mScissorY || width != mScissorWidth || height != mScissorHeight)) {
         if (x < 0) {
@@ -73,6 +89,9 @@ void Scissor::set(int viewportHeight, const Rect& clip) {
     GLint y = std::max(0, viewportHeight - (int)clip.bottom);
     GLint width = std::max(0, ((int)clip.right) - x);
     GLint height = std::max(0, (viewportHeight - (int)clip.top) - y);
+    if (CC_UNLIKELY(mRenderScale != 1.0f)) {
+        applyRenderScale(x, y, width, height);
+    }
 
     if (x != mScissorX || y != mScissorY || width != mScissorWidth || height != mScissorHeight) {
         glScissor(x, y, width, height);
@@ -35,14 +35,23 @@ public:
     bool isEnabled() { return mEnabled; }
     void dump();
 
+    /**
+     * Sets the scale applied to incoming scissor rects, used when rendering
+     * logical-resolution content into a reduced-resolution buffer. Rects are
+     * scaled conservatively (rounded outward).
+     */
+    void setRenderScale(float renderScale) { mRenderScale = renderScale; }
+
 private:
     Scissor();
     void invalidate();
+    void applyRenderScale(GLint& x, GLint& y, GLint& width, GLint& height) const;
     bool mEnabled;
     GLint mScissorX;
     GLint mScissorY;
     GLint mScissorWidth;
     GLint mScissorHeight;
+    float mRenderScale = 1.0f;
 };
 
 } /* namespace uirenderer */
@@ -17,15 +17,20 @@
 #include "CacheManager.h"
 
 #include "Layer.h"
+#include "ProgramBinaryCache.h"
 #include "Properties.h"
 #include "RenderThread.h"
+#include "hwui/HardwareBufferPool.h"
 #include "pipeline/skia/ShaderCache.h"
 #include "pipeline/skia/SkiaMemoryTracer.h"
 #include "renderstate/RenderState.h"
+#include "utils/LinearAllocator.h"
+#include "utils/TimeUtils.h"
 
 #include <GrContextOptions.h>
 #include <SkExecutor.h>
 #include <SkGraphics.h>
+#include <cutils/properties.h>
 #include <gui/Surface.h>
 #include <math.h>
 #include <set>
@@ -46,12 +51,23 @@ namespace renderthread {
 #define FONT_CACHE_MIN_MB (0.5f)
 #define FONT_CACHE_MAX_MB (4.0f)
 
-CacheManager::CacheManager(const DisplayInfo& display) : mMaxSurfaceArea(display.w * display.h) {
+// A frame gap this long means the window content has gone static, so cached
+// GPU resources can be compacted without risking a rebuild mid-animation
+static constexpr nsecs_t kIdleCompactionDelay = 4_s;
+// Resources untouched for this long are unlikely to be needed by the next
+// frame of a static window
+static constexpr auto kIdleResourceAge = std::chrono::seconds(10);
+
+CacheManager::CacheManager(RenderThread& thread, const DisplayInfo& display)
+        : mRenderThread(thread), mMaxSurfaceArea(display.w * display.h) {
     mVectorDrawableAtlas = new skiapipeline::VectorDrawableAtlas(
             mMaxSurfaceArea / 2,
             skiapipeline::VectorDrawableAtlas::StorageMode::disallowSharedSurface);
+    mShrinkCacheWhileIdle = property_get_bool("ro.config.low_ram", false);
     if (Properties::isSkiaEnabled()) {
         skiapipeline::ShaderCache::get().initShaderDiskCache();
+    } else {
+        ProgramBinaryCache::get().initProgramDiskCache();
     }
 }
 
@@ -77,11 +93,23 @@ void CacheManager::destroy() {
 
 void CacheManager::updateContextCacheSizes() {
     mMaxResourceBytes = mMaxSurfaceArea * SURFACE_SIZE_MULTIPLIER;
+    if (mMemoryCeiling) {
+        mMaxResourceBytes = std::min(mMaxResourceBytes, mMemoryCeiling);
+    }
     mBackgroundResourceBytes = mMaxResourceBytes * BACKGROUND_RETENTION_PERCENTAGE;
 
     mGrContext->setResourceCacheLimits(mMaxResources, mMaxResourceBytes);
 }
 
+void CacheManager::setMemoryCeiling(size_t ceilingBytes) {
+    mMemoryCeiling = ceilingBytes;
+    if (mGrContext) {
+        // setResourceCacheLimits purges in LRU order if the cache is over
+        // the new budget, so a shrinking ceiling takes effect immediately
+        updateContextCacheSizes();
+    }
+}
+
 class CacheManager::SkiaTaskProcessor : public TaskProcessor<bool>, public SkExecutor {
 public:
     explicit SkiaTaskProcessor(TaskManager* taskManager) : TaskProcessor<bool>(taskManager) {}
@@ -139,6 +167,15 @@ void CacheManager::configureContext(GrContextOptions* contextOptions) {
 }
 
 void CacheManager::trimMemory(TrimMemoryMode mode) {
+    // Pooled gralloc buffers are pure speculation once we're trimming.
+    HardwareBufferPool::getInstance().clear();
+
+    if (mode == TrimMemoryMode::Complete) {
+        // Drop the RenderThread's recycled LinearAllocator pages; an idle
+        // process shouldn't pin the record path's slab high watermark
+        LinearAllocator::purgePool();
+    }
+
     if (!mGrContext) {
         return;
     }
@@ -161,6 +198,55 @@ void CacheManager::trimMemory(TrimMemoryMode mode) {
     }
 }
 
+void CacheManager::onFrameCompleted() {
+    mLastFrameCompleteTime = systemTime(CLOCK_MONOTONIC);
+    mIdleCompactionDone = false;
+    scheduleIdleCompaction();
+}
+
+void CacheManager::scheduleIdleCompaction() {
+    if (mIdleCompactionPending) return;
+    mIdleCompactionPending = true;
+    // CacheManager is owned by the RenderThread and never destroyed, so the
+    // captured this is safe; performIdleCompaction copes with a GrContext
+    // that went away in the meantime
+    mRenderThread.queue().postDelayed(kIdleCompactionDelay, [this]() {
+        mIdleCompactionPending = false;
+        nsecs_t sinceLastFrame = systemTime(CLOCK_MONOTONIC) - mLastFrameCompleteTime;
+        if (sinceLastFrame < kIdleCompactionDelay) {
+            // frames were produced after this task was posted; wait for the
+            // window to actually go idle
+            scheduleIdleCompaction();
+            return;
+        }
+        if (!mIdleCompactionDone) {
+            mIdleCompactionDone = true;
+            performIdleCompaction();
+        }
+    });
+}
+
+void CacheManager::performIdleCompaction() {
+    if (!mGrContext) {
+        return;
+    }
+    mGrContext->flush();
+
+    // Drop resources no recent frame touched; anything the static content
+    // still draws every frame stays resident
+    mGrContext->purgeResourcesNotUsedInMs(kIdleResourceAge);
+
+    if (mShrinkCacheWhileIdle) {
+        // Temporarily lowering the budget purges persistent resources in LRU
+        // order down to the background retention level, the same way UiHidden
+        // trims do. This roughly halves what an idle window pins without
+        // waiting for a memory pressure signal; resources rebuild lazily if
+        // the window animates again.
+        mGrContext->setResourceCacheLimits(mMaxResources, mBackgroundResourceBytes);
+        mGrContext->setResourceCacheLimits(mMaxResources, mMaxResourceBytes);
+    }
+}
+
 void CacheManager::trimStaleResources() {
     if (!mGrContext) {
         return;
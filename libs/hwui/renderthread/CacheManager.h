@@ -21,6 +21,7 @@
 #include <SkSurface.h>
 #include <ui/DisplayInfo.h>
 #include <utils/String8.h>
+#include <utils/Timers.h>
 #include <vector>
 
 #include "pipeline/skia/VectorDrawableAtlas.h"
@@ -46,6 +47,13 @@ public:
 
     void configureContext(GrContextOptions* context);
     void trimMemory(TrimMemoryMode mode);
+
+    /**
+     * Called once per completed frame; (re)arms the idle compaction pass that
+     * shrinks the GrContext resource cache once frames stop coming.
+     */
+    void onFrameCompleted();
+    void setMemoryCeiling(size_t ceilingBytes);
     void trimStaleResources();
     void dumpMemoryUsage(String8& log, const RenderState* renderState = nullptr);
 
@@ -59,18 +67,31 @@ public:
 private:
     friend class RenderThread;
 
-    CacheManager(const DisplayInfo& display);
+    CacheManager(RenderThread& thread, const DisplayInfo& display);
 
     void reset(sk_sp<GrContext> grContext);
     void destroy();
     void updateContextCacheSizes();
+    void scheduleIdleCompaction();
+    void performIdleCompaction();
 
+    RenderThread& mRenderThread;
     const size_t mMaxSurfaceArea;
     sk_sp<GrContext> mGrContext;
 
     int mMaxResources = 0;
     size_t mMaxResourceBytes = 0;
     size_t mBackgroundResourceBytes = 0;
+    // Optional per-process cap on the GrContext resource cache; 0 means the
+    // surface-area based default applies
+    size_t mMemoryCeiling = 0;
+
+    // Whether idle compaction additionally drops the cache down to the
+    // background retention budget; enabled on low-RAM devices
+    bool mShrinkCacheWhileIdle = false;
+    nsecs_t mLastFrameCompleteTime = 0;
+    bool mIdleCompactionPending = false;
+    bool mIdleCompactionDone = false;
 
     struct PipelineProps {
         const void* pipelineKey = nullptr;
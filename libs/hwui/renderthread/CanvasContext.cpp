@@ -42,6 +42,7 @@
 #include <strings.h>
 
 #include <fcntl.h>
+#include <math.h>
 #include <sys/stat.h>
 #include <algorithm>
 
@@ -155,6 +156,8 @@ CanvasContext::CanvasContext(RenderThread& thread, bool translucent, RenderNode*
 }
 
 CanvasContext::~CanvasContext() {
+    // neutralize any queued draw that hasn't run yet
+    *mAlive = false;
     destroy();
     mRenderThread.renderState().unregisterCanvasContext(this);
     for (auto& node : mRenderNodes) {
@@ -188,6 +191,14 @@ void CanvasContext::setSurface(sp<Surface>&& surface) {
 
     mNativeSurface = std::move(surface);
 
+    if (mRenderScaleLevel != 0) {
+        // scale state is tied to the old surface's buffer dimensions
+        mRenderScaleLevel = 0;
+        mRenderPipeline->setRenderScale(1.0f);
+    }
+    mFramesOverBudget = 0;
+    mFramesUnderBudget = 0;
+
     ColorMode colorMode = mWideColorGamut ? ColorMode::WideColorGamut : ColorMode::Srgb;
     bool hasSurface = mRenderPipeline->setSurface(mNativeSurface.get(), mSwapBehavior, colorMode);
 
@@ -312,6 +323,13 @@ void CanvasContext::prepareTree(TreeInfo& info, int64_t* uiFrameInfo, int64_t sy
                                 RenderNode* target) {
     mRenderThread.removeFrameCallback(this);
 
+    mSyncGeneration++;
+    if (CC_UNLIKELY(mQueuedDraws > 0)) {
+        // This sync is overtaking a queued draw that hasn't started; that
+        // frame's content is being replaced, so it counts as skipped.
+        mCurrentFrameInfo->addFlag(FrameInfoFlags::SkippedFrame);
+    }
+
     // If the previous frame was dropped we don't need to hold onto it, so
     // just keep using the previous frame's structure instead
     if (!wasSkipped(mCurrentFrameInfo)) {
@@ -438,7 +456,20 @@ void CanvasContext::notifyFramePending() {
 
 void CanvasContext::draw() {
     SkRect dirty;
-    mDamageAccumulator.finish(&dirty);
+    std::vector<SkRect> dirtyRects;
+    mDamageAccumulator.finish(&dirty, &dirtyRects);
+
+    if (CC_UNLIKELY(mRenderScaleLevel != 0)) {
+        // partial updates are disabled while rendering at reduced resolution;
+        // an empty dirty rect makes computeDirtyRect repaint the whole frame
+        dirty.setEmpty();
+    }
+    if (CC_UNLIKELY(dirty.isEmpty() || Properties::showDirtyRegions ||
+                    Properties::debugOverdraw)) {
+        // The debug overlays draw across the full repaint bounds, so the
+        // individual rects would understate the damage
+        dirtyRects.clear();
+    }
 
     // TODO: Re-enable after figuring out cause of b/22592975
     //    if (dirty.isEmpty() && Properties::skipEmptyFrames) {
@@ -450,19 +481,20 @@ void CanvasContext::draw() {
 
     Frame frame = mRenderPipeline->getFrame();
 
-    SkRect windowDirty = computeDirtyRect(frame, &dirty);
+    std::vector<SkRect> windowDirtyRects;
+    SkRect windowDirty = computeDirtyRect(frame, &dirty, &dirtyRects, &windowDirtyRects);
 
-    bool drew = mRenderPipeline->draw(frame, windowDirty, dirty, mLightGeometry, &mLayerUpdateQueue,
-                                      mContentDrawBounds, mOpaque, mWideColorGamut, mLightInfo,
-                                      mRenderNodes, &(profiler()));
+    bool drew = mRenderPipeline->draw(frame, windowDirty, dirty, dirtyRects, mLightGeometry,
+                                      &mLayerUpdateQueue, mContentDrawBounds, mOpaque,
+                                      mWideColorGamut, mLightInfo, mRenderNodes, &(profiler()));
 
     int64_t frameCompleteNr = mFrameCompleteCallbacks.size() ? getFrameNumber() : -1;
 
     waitOnFences();
 
     bool requireSwap = false;
-    bool didSwap =
-            mRenderPipeline->swapBuffers(frame, drew, windowDirty, mCurrentFrameInfo, &requireSwap);
+    bool didSwap = mRenderPipeline->swapBuffers(frame, drew, windowDirty, windowDirtyRects,
+                                                mCurrentFrameInfo, &requireSwap);
 
     mIsDirty = false;
 
@@ -472,6 +504,7 @@ void CanvasContext::draw() {
         }
         SwapHistory& swap = mSwapHistory.next();
         swap.damage = windowDirty;
+        swap.damageRects = std::move(windowDirtyRects);
         swap.swapCompletedTime = systemTime(CLOCK_MONOTONIC);
         swap.vsyncTime = mRenderThread.timeLord().latestVsync();
         if (mNativeSurface.get()) {
@@ -503,6 +536,11 @@ void CanvasContext::draw() {
     // TODO: Use a fence for real completion?
     mCurrentFrameInfo->markFrameCompleted();
 
+    // Feed the adaptive deadline model; this span covers the work a frame
+    // has to fit between its sync finishing and the next vsync
+    mRenderThread.timeLord().frameDurationObserved(mCurrentFrameInfo->duration(
+            FrameInfoIndex::IssueDrawCommandsStart, FrameInfoIndex::FrameCompleted));
+
 #if LOG_FRAMETIME_MMA
     float thisFrame = mCurrentFrameInfo->duration(FrameInfoIndex::IssueDrawCommandsStart,
                                                   FrameInfoIndex::FrameCompleted) /
@@ -530,7 +568,15 @@ void CanvasContext::draw() {
         mFrameMetricsReporter->reportFrameMetrics(mCurrentFrameInfo->data());
     }
 
+    if (CC_UNLIKELY(Properties::dynamicRenderScale) && requireSwap) {
+        updateRenderScale();
+    }
+
     GpuMemoryTracker::onFrameCompleted();
+    mRenderThread.cacheManager().onFrameCompleted();
+    if (Caches::hasInstance()) {
+        Caches::getInstance().cacheGovernor.onFrameCompleted();
+    }
 #ifdef BUGREPORT_FONT_CACHE_USAGE
     auto renderType = Properties::getRenderPipelineType();
     if (RenderPipelineType::OpenGL == renderType) {
@@ -540,6 +586,81 @@ void CanvasContext::draw() {
 #endif
 }
 
+void CanvasContext::updateRenderScale() {
+    static const float kRenderScaleLevels[] = {1.0f, 0.8f, 0.65f, 0.5f};
+    static const int kRenderScaleLevelCount =
+            sizeof(kRenderScaleLevels) / sizeof(kRenderScaleLevels[0]);
+    // consecutive frames past the deadline before stepping resolution down
+    static const int kScaleDownThreshold = 8;
+    // consecutive frames with ample headroom before stepping back up
+    static const int kScaleUpThreshold = 120;
+
+    // Vulkan surfaces manage their own buffer dimensions
+    if (Properties::getRenderPipelineType() == RenderPipelineType::SkiaVulkan) return;
+    if (!mNativeSurface.get()) return;
+
+    nsecs_t frameInterval = mRenderThread.timeLord().frameIntervalNanos();
+    nsecs_t frameDuration = mCurrentFrameInfo->duration(FrameInfoIndex::IntendedVsync,
+                                                        FrameInfoIndex::FrameCompleted);
+    if (frameDuration > frameInterval) {
+        mFramesOverBudget++;
+        mFramesUnderBudget = 0;
+    } else if (frameDuration < frameInterval / 2) {
+        mFramesUnderBudget++;
+        mFramesOverBudget = 0;
+    } else {
+        mFramesOverBudget = 0;
+        mFramesUnderBudget = 0;
+    }
+
+    int level = mRenderScaleLevel;
+    if (mFramesOverBudget >= kScaleDownThreshold && level < kRenderScaleLevelCount - 1) {
+        level++;
+    } else if (mFramesUnderBudget >= kScaleUpThreshold && level > 0) {
+        level--;
+    }
+    if (level == mRenderScaleLevel) return;
+
+    int width, height;
+    mNativeSurface->query(NATIVE_WINDOW_DEFAULT_WIDTH, &width);
+    mNativeSurface->query(NATIVE_WINDOW_DEFAULT_HEIGHT, &height);
+
+    float scale = kRenderScaleLevels[level];
+    if (level == 0) {
+        // restore the buffers to the window's size
+        native_window_set_buffers_dimensions(mNativeSurface.get(), 0, 0);
+    } else {
+        native_window_set_buffers_dimensions(mNativeSurface.get(), (int)ceilf(width * scale),
+                                             (int)ceilf(height * scale));
+    }
+    ALOGD("%s render scale %.2f (%dx%d window, frame vs budget %.2f/%.2fms)", mName.c_str(), scale,
+          width, height, frameDuration / 1000000.0f, frameInterval / 1000000.0f);
+
+    mRenderPipeline->setRenderScale(scale);
+    mRenderScaleLevel = level;
+    mFramesOverBudget = 0;
+    mFramesUnderBudget = 0;
+}
+
+void CanvasContext::queueDraw() {
+    mQueuedDraws++;
+    // Posted at the current time rather than time 0, so a sync posted by the
+    // UI thread can be inserted ahead of this draw in the work queue.
+    mRenderThread.queue().postAt(WorkQueue::Priority::FrameCritical, WorkQueue::clock::now(),
+                                 [this, alive = mAlive, syncGeneration = mSyncGeneration]() {
+        if (!*alive) return;
+        mQueuedDraws--;
+        if (syncGeneration != mSyncGeneration || !hasSurface()) {
+            // A newer sync replaced this frame's content before we got to draw
+            // it (or the surface went away); drop the frame but still wait on
+            // fences so tasks don't overlap the next frame.
+            waitOnFences();
+            return;
+        }
+        draw();
+    });
+}
+
 // Called by choreographer to do an RT-driven animation
 void CanvasContext::doFrame() {
     if (!mRenderPipeline->isSurfaceReady()) return;
@@ -745,32 +866,45 @@ int64_t CanvasContext::getFrameNumber() {
     return mFrameNumber;
 }
 
-SkRect CanvasContext::computeDirtyRect(const Frame& frame, SkRect* dirty) {
+SkRect CanvasContext::computeDirtyRect(const Frame& frame, SkRect* dirty,
+                                       std::vector<SkRect>* dirtyRects,
+                                       std::vector<SkRect>* windowDirtyRects) {
     if (frame.width() != mLastFrameWidth || frame.height() != mLastFrameHeight) {
         // can't rely on prior content of window if viewport size changes
         dirty->setEmpty();
+        dirtyRects->clear();
         mLastFrameWidth = frame.width();
         mLastFrameHeight = frame.height();
     } else if (mHaveNewSurface || frame.bufferAge() == 0) {
         // New surface needs a full draw
         dirty->setEmpty();
+        dirtyRects->clear();
     } else {
+        SkRect requested(*dirty);
         if (!dirty->isEmpty() && !dirty->intersect(0, 0, frame.width(), frame.height())) {
             ALOGW("Dirty " RECT_STRING " doesn't intersect with 0 0 %d %d ?", SK_RECT_ARGS(*dirty),
                   frame.width(), frame.height());
             dirty->setEmpty();
         }
         profiler().unionDirty(dirty);
+        if (*dirty != requested) {
+            // The rects no longer match the dirty area (the window clip
+            // shrank the bounding box, or the profiler added its bars);
+            // fall back to the bounds
+            dirtyRects->clear();
+        }
     }
 
     if (dirty->isEmpty()) {
         dirty->set(0, 0, frame.width(), frame.height());
+        dirtyRects->clear();
     }
 
     // At this point dirty is the area of the window to update. However,
     // the area of the frame we need to repaint is potentially different, so
     // stash the screen area for later
     SkRect windowDirty(*dirty);
+    *windowDirtyRects = *dirtyRects;
 
     // If the buffer age is 0 we do a full-screen repaint (handled above)
     // If the buffer age is 1 the buffer contents are the same as they were
@@ -781,13 +915,28 @@ SkRect CanvasContext::computeDirtyRect(const Frame& frame, SkRect* dirty) {
             // We don't have enough history to handle this old of a buffer
             // Just do a full-draw
             dirty->set(0, 0, frame.width(), frame.height());
+            dirtyRects->clear();
         } else {
             // At this point we haven't yet added the latest frame
             // to the damage history (happens below)
             // So we need to damage
             for (int i = mSwapHistory.size() - 1;
                  i > ((int)mSwapHistory.size()) - frame.bufferAge(); i--) {
-                dirty->join(mSwapHistory[i].damage);
+                const SwapHistory& swap = mSwapHistory[i];
+                dirty->join(swap.damage);
+                if (!dirtyRects->empty()) {
+                    // Extend the repaint rect list with that frame's rects,
+                    // falling back to the bounding box past the cap
+                    if (swap.damageRects.empty()) {
+                        dirtyRects->push_back(swap.damage);
+                    } else {
+                        dirtyRects->insert(dirtyRects->end(), swap.damageRects.begin(),
+                                           swap.damageRects.end());
+                    }
+                    if (dirtyRects->size() > DamageAccumulator::kMaxDamageRects) {
+                        dirtyRects->clear();
+                    }
+                }
             }
         }
     }
@@ -130,6 +130,13 @@ public:
     bool makeCurrent();
     void prepareTree(TreeInfo& info, int64_t* uiFrameInfo, int64_t syncQueued, RenderNode* target);
     void draw();
+    /**
+     * Queues draw() on the work queue instead of running it inline, so the next
+     * frame's sync can overtake it. If a newer sync lands before the queued
+     * draw runs, the queued draw is dropped since the active tree now holds the
+     * newer frame's content. Used when Properties::framePipelining is enabled.
+     */
+    void queueDraw();
     void destroy();
 
     // IFrameCallback, Choreographer-driven frame callback entry point
@@ -207,7 +214,22 @@ private:
 
     bool isSwapChainStuffed();
 
-    SkRect computeDirtyRect(const Frame& frame, SkRect* dirty);
+    /**
+     * Feedback controller for dynamic render scaling: steps the render target
+     * down to a reduced resolution after sustained frame deadline misses and
+     * back up once frames show sustained headroom. The compositor upscales
+     * the smaller buffer to the window. Only active when
+     * Properties::dynamicRenderScale is set; not used with Vulkan.
+     */
+    void updateRenderScale();
+
+    // dirtyRects comes in holding this frame's damage rects and leaves
+    // holding the rects for the whole repaint area (including buffer age
+    // history); windowDirtyRects receives this frame's rects only, matching
+    // the returned window damage. Either list is emptied when the matching
+    // rect could not be kept as individual rects.
+    SkRect computeDirtyRect(const Frame& frame, SkRect* dirty, std::vector<SkRect>* dirtyRects,
+                            std::vector<SkRect>* windowDirtyRects);
 
     EGLint mLastFrameWidth = 0;
     EGLint mLastFrameHeight = 0;
@@ -226,6 +248,9 @@ private:
     SwapBehavior mSwapBehavior = SwapBehavior::kSwap_default;
     struct SwapHistory {
         SkRect damage;
+        // Individual rects making up damage, when they were tracked; used to
+        // rebuild a multi-rect repaint region from buffer age
+        std::vector<SkRect> damageRects;
         nsecs_t vsyncTime;
         nsecs_t swapCompletedTime;
         nsecs_t dequeueDuration;
@@ -238,6 +263,21 @@ private:
     // last vsync for a dropped frame due to stuffed queue
     nsecs_t mLastDropVsync = 0;
 
+    // Frame pipelining state, only touched on the RenderThread. The sync
+    // generation counts prepareTree calls so a queued draw can detect that a
+    // newer sync replaced its content; the queued draw count lets prepareTree
+    // flag the frame it is superseding as skipped. The alive token guards the
+    // queued lambda against outliving this context.
+    uint32_t mSyncGeneration = 0;
+    int mQueuedDraws = 0;
+    std::shared_ptr<bool> mAlive = std::make_shared<bool>(true);
+
+    // Dynamic render scale state; see updateRenderScale(). The level indexes
+    // a fixed table of scale factors, 0 being full resolution.
+    int mRenderScaleLevel = 0;
+    int mFramesOverBudget = 0;
+    int mFramesUnderBudget = 0;
+
     bool mOpaque;
     bool mWideColorGamut = false;
     BakedOpRenderer::LightInfo mLightInfo;
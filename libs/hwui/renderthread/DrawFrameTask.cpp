@@ -21,6 +21,7 @@
 
 #include "../DeferredLayerUpdater.h"
 #include "../DisplayList.h"
+#include "../Properties.h"
 #include "../RenderNode.h"
 #include "CanvasContext.h"
 #include "RenderThread.h"
@@ -77,7 +78,7 @@ int DrawFrameTask::drawFrame() {
 
 void DrawFrameTask::postAndWait() {
     AutoMutex _lock(mLock);
-    mRenderThread->queue().post([this]() { run(); });
+    mRenderThread->queue().post(WorkQueue::Priority::FrameCritical, [this]() { run(); });
     mSignal.wait(mLock);
 }
 
@@ -115,7 +116,17 @@ void DrawFrameTask::run() {
     }
 
     if (CC_LIKELY(canDrawThisFrame)) {
-        context->draw();
+        if (CC_UNLIKELY(Properties::framePipelining && canUnblockUiThread &&
+                        mRenderThread->timeLord().vsyncSlackNanos() > 0)) {
+            // Queue the draw instead of running it inline so the next frame's
+            // sync can overtake it; the UI thread has already been unblocked
+            // and can start recording frame N+1 while frame N renders.
+            // Queueing adds scheduling latency, so frames without vsync slack
+            // draw inline instead of risking the deadline.
+            context->queueDraw();
+        } else {
+            context->draw();
+        }
     } else {
         // wait on fences so tasks don't overlap next frame
         context->waitOnFences();
@@ -133,9 +144,7 @@ bool DrawFrameTask::syncFrameState(TreeInfo& info) {
     bool canDraw = mContext->makeCurrent();
     mContext->unpinImages();
 
-    for (size_t i = 0; i < mLayers.size(); i++) {
-        mLayers[i]->apply();
-    }
+    DeferredLayerUpdater::applyAll(mLayers);
     mLayers.clear();
     mContext->setContentDrawBounds(mContentDrawBounds);
     mContext->prepareTree(info, mFrameInfo, mSyncQueued, mTargetNode);
@@ -23,6 +23,7 @@
 #include "utils/StringUtils.h"
 
 #include "Caches.h"
+#include "DamageAccumulator.h"
 #include "DeviceInfo.h"
 #include "Frame.h"
 #include "Properties.h"
@@ -275,6 +276,42 @@ void EglManager::createPBufferSurface() {
     }
 }
 
+bool EglManager::createSharedContext(EGLContext* outContext, EGLSurface* outSurface) {
+    if (mEglDisplay == EGL_NO_DISPLAY || mEglContext == EGL_NO_CONTEXT) {
+        return false;
+    }
+
+    EGLint contextAttributes[] = {EGL_CONTEXT_CLIENT_VERSION, GLES_VERSION, EGL_NONE};
+    EGLContext context = eglCreateContext(
+            mEglDisplay, EglExtensions.noConfigContext ? ((EGLConfig) nullptr) : mEglConfig,
+            mEglContext, contextAttributes);
+    if (context == EGL_NO_CONTEXT) {
+        ALOGW("Failed to create shared context, error = %s", eglErrorString());
+        return false;
+    }
+
+    EGLint attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    EGLSurface surface = eglCreatePbufferSurface(mEglDisplay, mEglConfig, attribs);
+    if (surface == EGL_NO_SURFACE) {
+        ALOGW("Failed to create pbuffer for shared context, error = %s", eglErrorString());
+        eglDestroyContext(mEglDisplay, context);
+        return false;
+    }
+
+    *outContext = context;
+    *outSurface = surface;
+    return true;
+}
+
+void EglManager::destroySharedContext(EGLContext context, EGLSurface surface) {
+    if (surface != EGL_NO_SURFACE) {
+        eglDestroySurface(mEglDisplay, surface);
+    }
+    if (context != EGL_NO_CONTEXT) {
+        eglDestroyContext(mEglDisplay, context);
+    }
+}
+
 EGLSurface EglManager::createSurface(EGLNativeWindowType window, bool wideColorGamut) {
     initialize();
 
@@ -414,12 +451,34 @@ Frame EglManager::beginFrame(EGLSurface surface) {
     return frame;
 }
 
+// Maps dirtyRects (or dirty, if the list is empty or over-long) into EGL
+// coordinates; rects must have room for 4 * DamageAccumulator::kMaxDamageRects
+// values. Returns the number of rects written.
+static EGLint mapDamageRects(const Frame& frame, const SkRect& dirty,
+                             const std::vector<SkRect>& dirtyRects, EGLint* rects) {
+    if (dirtyRects.empty() || dirtyRects.size() > DamageAccumulator::kMaxDamageRects) {
+        frame.map(dirty, rects);
+        return 1;
+    }
+    EGLint count = 0;
+    for (const SkRect& rect : dirtyRects) {
+        frame.map(rect, rects + count * 4);
+        count++;
+    }
+    return count;
+}
+
 void EglManager::damageFrame(const Frame& frame, const SkRect& dirty) {
+    damageFrame(frame, dirty, std::vector<SkRect>());
+}
+
+void EglManager::damageFrame(const Frame& frame, const SkRect& dirty,
+                             const std::vector<SkRect>& dirtyRects) {
 #ifdef EGL_KHR_partial_update
     if (EglExtensions.setDamage && mSwapBehavior == SwapBehavior::BufferAge) {
-        EGLint rects[4];
-        frame.map(dirty, rects);
-        if (!eglSetDamageRegionKHR(mEglDisplay, frame.mSurface, rects, 1)) {
+        EGLint rects[4 * DamageAccumulator::kMaxDamageRects];
+        EGLint count = mapDamageRects(frame, dirty, dirtyRects, rects);
+        if (!eglSetDamageRegionKHR(mEglDisplay, frame.mSurface, rects, count)) {
             LOG_ALWAYS_FATAL("Failed to set damage region on surface %p, error=%s",
                              (void*)frame.mSurface, eglErrorString());
         }
@@ -431,15 +490,22 @@ bool EglManager::damageRequiresSwap() {
     return EglExtensions.setDamage && mSwapBehavior == SwapBehavior::BufferAge;
 }
 
-bool EglManager::swapBuffers(const Frame& frame, const SkRect& screenDirty) {
+bool EglManager::swapBuffers(const Frame& frame, const SkRect& screenDirty,
+                             const std::vector<SkRect>& screenDirtyRects) {
     if (CC_UNLIKELY(Properties::waitForGpuCompletion)) {
         ATRACE_NAME("Finishing GPU work");
         fence();
     }
 
-    EGLint rects[4];
-    frame.map(screenDirty, rects);
-    eglSwapBuffersWithDamageKHR(mEglDisplay, frame.mSurface, rects, screenDirty.isEmpty() ? 0 : 1);
+    // Unlike the damage region, the swap rects are only a hint about which
+    // pixels changed, so handing the compositor the individual rects is safe
+    // even though drawing was clipped to their bounding box.
+    EGLint rects[4 * DamageAccumulator::kMaxDamageRects];
+    EGLint count = mapDamageRects(frame, screenDirty, screenDirtyRects, rects);
+    if (screenDirtyRects.empty() && screenDirty.isEmpty()) {
+        count = 0;
+    }
+    eglSwapBuffersWithDamageKHR(mEglDisplay, frame.mSurface, rects, count);
 
     EGLint err = eglGetError();
     if (CC_LIKELY(err == EGL_SUCCESS)) {
@@ -22,6 +22,8 @@
 #include <ui/GraphicBuffer.h>
 #include <utils/StrongPointer.h>
 
+#include <vector>
+
 namespace android {
 namespace uirenderer {
 namespace renderthread {
@@ -49,15 +51,27 @@ public:
     bool makeCurrent(EGLSurface surface, EGLint* errOut = nullptr);
     Frame beginFrame(EGLSurface surface);
     void damageFrame(const Frame& frame, const SkRect& dirty);
+    // Variant taking the individual damage rects; they must cover exactly the
+    // area the caller will render to, so only pipelines that clip drawing to
+    // the rect list may use it. An empty list falls back to the single rect.
+    void damageFrame(const Frame& frame, const SkRect& dirty, const std::vector<SkRect>& dirtyRects);
     // If this returns true it is mandatory that swapBuffers is called
     // if damageFrame is called without subsequent calls to damageFrame().
     // See EGL_KHR_partial_update for more information
     bool damageRequiresSwap();
-    bool swapBuffers(const Frame& frame, const SkRect& screenDirty);
+    bool swapBuffers(const Frame& frame, const SkRect& screenDirty,
+                     const std::vector<SkRect>& screenDirtyRects = std::vector<SkRect>());
 
     // Returns true iff the surface is now preserving buffers.
     bool setPreserveBuffer(EGLSurface surface, bool preserve);
 
+    // Creates a context in the render context's share group, along with a 1x1
+    // pbuffer it can be made current on. Used by the async texture upload
+    // thread. Must be called on the render thread after initialize(); the
+    // returned objects may be made current on any thread.
+    bool createSharedContext(EGLContext* outContext, EGLSurface* outSurface);
+    void destroySharedContext(EGLContext context, EGLSurface surface);
+
     void fence();
 
 private:
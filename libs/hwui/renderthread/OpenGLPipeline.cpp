@@ -22,10 +22,12 @@
 #include "GlLayer.h"
 #include "OpenGLReadback.h"
 #include "ProfileRenderer.h"
+#include "hwui/HardwareBufferPool.h"
 #include "renderstate/RenderState.h"
 #include "TreeInfo.h"
 
 #include <cutils/properties.h>
+#include <math.h>
 #include <strings.h>
 
 namespace android {
@@ -55,26 +57,42 @@ Frame OpenGLPipeline::getFrame() {
 }
 
 bool OpenGLPipeline::draw(const Frame& frame, const SkRect& screenDirty, const SkRect& dirty,
+                          const std::vector<SkRect>& dirtyRects,
                           const FrameBuilder::LightGeometry& lightGeometry,
                           LayerUpdateQueue* layerUpdateQueue, const Rect& contentDrawBounds,
                           bool opaque, bool wideColorGamut,
                           const BakedOpRenderer::LightInfo& lightInfo,
                           const std::vector<sp<RenderNode>>& renderNodes,
                           FrameInfoVisualizer* profiler) {
+    // FrameBuilder repaints the full bounding box of the damage, so the
+    // declared damage region must stay the single rect; the individual rects
+    // are still reported at swap time.
     mEglManager.damageFrame(frame, dirty);
 
     bool drew = false;
 
     auto& caches = Caches::getInstance();
-    FrameBuilder frameBuilder(dirty, frame.width(), frame.height(), lightGeometry, caches);
+    SkRect frameDirty = dirty;
+    uint32_t viewportWidth = frame.width();
+    uint32_t viewportHeight = frame.height();
+    if (CC_UNLIKELY(mRenderScale != 1.0f)) {
+        // The buffer is smaller than the window; build the frame against the
+        // logical viewport and let BakedOpRenderer shrink it into the buffer.
+        // Partial updates are disabled in this mode, so repaint everything.
+        viewportWidth = (uint32_t)ceilf(frame.width() / mRenderScale);
+        viewportHeight = (uint32_t)ceilf(frame.height() / mRenderScale);
+        frameDirty = SkRect::MakeWH(viewportWidth, viewportHeight);
+    }
+    FrameBuilder frameBuilder(frameDirty, viewportWidth, viewportHeight, lightGeometry, caches);
 
-    frameBuilder.deferLayers(*layerUpdateQueue);
+    frameBuilder.deferLayersParallel(*layerUpdateQueue, &caches.tasks);
     layerUpdateQueue->clear();
 
     frameBuilder.deferRenderNodeScene(renderNodes, contentDrawBounds);
 
     BakedOpRenderer renderer(caches, mRenderThread.renderState(), opaque, wideColorGamut,
                              lightInfo);
+    renderer.setRenderScale(mRenderScale);
     frameBuilder.replayBakedOps<BakedOpDispatcher>(renderer);
     ProfileRenderer profileRenderer(renderer);
     profiler->draw(profileRenderer);
@@ -97,6 +115,7 @@ bool OpenGLPipeline::draw(const Frame& frame, const SkRect& screenDirty, const S
 }
 
 bool OpenGLPipeline::swapBuffers(const Frame& frame, bool drew, const SkRect& screenDirty,
+                                 const std::vector<SkRect>& screenDirtyRects,
                                  FrameInfo* currentFrameInfo, bool* requireSwap) {
     GL_CHECKPOINT(LOW);
 
@@ -106,7 +125,8 @@ bool OpenGLPipeline::swapBuffers(const Frame& frame, bool drew, const SkRect& sc
 
     *requireSwap = drew || mEglManager.damageRequiresSwap();
 
-    if (*requireSwap && (CC_UNLIKELY(!mEglManager.swapBuffers(frame, screenDirty)))) {
+    if (*requireSwap &&
+        (CC_UNLIKELY(!mEglManager.swapBuffers(frame, screenDirty, screenDirtyRects)))) {
         return false;
     }
 
@@ -420,14 +440,13 @@ sk_sp<Bitmap> OpenGLPipeline::allocateHardwareBitmap(RenderThread& renderThread,
                                                     &format, &type);
 
     PixelFormat pixelFormat = internalFormatToPixelFormat(internalFormat);
-    sp<GraphicBuffer> buffer = new GraphicBuffer(
+    sp<GraphicBuffer> buffer = HardwareBufferPool::getInstance().obtain(
             info.width(), info.height(), pixelFormat,
             GraphicBuffer::USAGE_HW_TEXTURE | GraphicBuffer::USAGE_SW_WRITE_NEVER |
                     GraphicBuffer::USAGE_SW_READ_NEVER,
             std::string("Bitmap::allocateHardwareBitmap pid [") + std::to_string(getpid()) + "]");
 
-    status_t error = buffer->initCheck();
-    if (error < 0) {
+    if (!buffer) {
         ALOGW("createGraphicBuffer() failed in GraphicBuffer.create()");
         return nullptr;
     }
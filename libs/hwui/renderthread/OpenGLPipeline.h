@@ -34,16 +34,19 @@ public:
     MakeCurrentResult makeCurrent() override;
     Frame getFrame() override;
     bool draw(const Frame& frame, const SkRect& screenDirty, const SkRect& dirty,
+              const std::vector<SkRect>& dirtyRects,
               const FrameBuilder::LightGeometry& lightGeometry, LayerUpdateQueue* layerUpdateQueue,
               const Rect& contentDrawBounds, bool opaque, bool wideColorGamut,
               const BakedOpRenderer::LightInfo& lightInfo,
               const std::vector<sp<RenderNode>>& renderNodes,
               FrameInfoVisualizer* profiler) override;
     bool swapBuffers(const Frame& frame, bool drew, const SkRect& screenDirty,
-                     FrameInfo* currentFrameInfo, bool* requireSwap) override;
+                     const std::vector<SkRect>& screenDirtyRects, FrameInfo* currentFrameInfo,
+                     bool* requireSwap) override;
     bool copyLayerInto(DeferredLayerUpdater* layer, SkBitmap* bitmap) override;
     DeferredLayerUpdater* createTextureLayer() override;
     bool setSurface(Surface* window, SwapBehavior swapBehavior, ColorMode colorMode) override;
+    void setRenderScale(float renderScale) override { mRenderScale = renderScale; }
     void onStop() override;
     bool isSurfaceReady() override;
     bool isContextReady() override;
@@ -67,6 +70,7 @@ private:
     EglManager& mEglManager;
     EGLSurface mEglSurface = EGL_NO_SURFACE;
     bool mBufferPreserved = false;
+    float mRenderScale = 1.0f;
     RenderThread& mRenderThread;
 };
 
@@ -16,6 +16,7 @@
 
 #include "RenderProxy.h"
 
+#include "Caches.h"
 #include "DeferredLayerUpdater.h"
 #include "DisplayList.h"
 #include "Properties.h"
@@ -186,7 +187,22 @@ void RenderProxy::trimMemory(int level) {
     // Avoid creating a RenderThread to do a trimMemory.
     if (RenderThread::hasInstance()) {
         RenderThread& thread = RenderThread::getInstance();
-        thread.queue().post([&thread, level]() { CanvasContext::trimMemory(thread, level); });
+        thread.queue().post(WorkQueue::Priority::Background,
+                            [&thread, level]() { CanvasContext::trimMemory(thread, level); });
+    }
+}
+
+void RenderProxy::setCacheMemoryCeiling(size_t ceilingBytes) {
+    // As with trimMemory, don't create a RenderThread just to store a limit;
+    // a process that never rendered has nothing to cap.
+    if (RenderThread::hasInstance()) {
+        RenderThread& thread = RenderThread::getInstance();
+        thread.queue().post([&thread, ceilingBytes]() {
+            thread.cacheManager().setMemoryCeiling(ceilingBytes);
+            if (Caches::hasInstance()) {
+                Caches::getInstance().cacheGovernor.setMemoryCeiling(ceilingBytes);
+            }
+        });
     }
 }
 
@@ -307,6 +323,18 @@ int RenderProxy::copySurfaceInto(sp<Surface>& surface, int left, int top, int ri
     }));
 }
 
+void RenderProxy::copySurfaceIntoAsync(sp<Surface> surface, int left, int top, int right,
+                                       int bottom, SkBitmap* bitmap,
+                                       std::function<void(int)>&& callback) {
+    auto& thread = RenderThread::getInstance();
+    thread.queue().post([&thread, surface, srcRect = Rect(left, top, right, bottom), bitmap,
+                         callback = std::move(callback)]() {
+        thread.readback().copySurfaceIntoAsync(
+                *surface, srcRect, bitmap,
+                [callback](CopyResult result) { callback(static_cast<int>(result)); });
+    });
+}
+
 void RenderProxy::prepareToDraw(Bitmap& bitmap) {
     // If we haven't spun up a hardware accelerated window yet, there's no
     // point in precaching these bitmaps as it can't impact jank.
@@ -339,6 +367,21 @@ sk_sp<Bitmap> RenderProxy::allocateHardwareBitmap(SkBitmap& bitmap) {
     return thread.queue().runSync([&]() -> auto { return thread.allocateHardwareBitmap(bitmap); });
 }
 
+std::vector<sk_sp<Bitmap>> RenderProxy::allocateHardwareBitmaps(
+        const std::vector<SkBitmap*>& bitmaps) {
+    auto& thread = RenderThread::getInstance();
+    std::vector<sk_sp<Bitmap>> results(bitmaps.size());
+    // One round trip for the whole batch; the uploads themselves still run on
+    // the RenderThread, but the per-bitmap queue/wake/wait overhead is paid
+    // once instead of N times.
+    thread.queue().runSync([&]() {
+        for (size_t i = 0; i < bitmaps.size(); i++) {
+            results[i] = thread.allocateHardwareBitmap(*bitmaps[i]);
+        }
+    });
+    return results;
+}
+
 int RenderProxy::copyGraphicBufferInto(GraphicBuffer* buffer, SkBitmap* bitmap) {
     RenderThread& thread = RenderThread::getInstance();
     if (Properties::isSkiaEnabled() && gettid() == thread.getTid()) {
@@ -364,7 +407,7 @@ void RenderProxy::disableVsync() {
 
 void RenderProxy::repackVectorDrawableAtlas() {
     RenderThread& thread = RenderThread::getInstance();
-    thread.queue().post([&thread]() {
+    thread.queue().post(WorkQueue::Priority::Background, [&thread]() {
         // The context may be null if trimMemory executed, but then the atlas was deleted too.
         if (thread.getGrContext() != nullptr) {
             thread.cacheManager().acquireVectorDrawableAtlas()->repackIfNeeded(
@@ -375,7 +418,7 @@ void RenderProxy::repackVectorDrawableAtlas() {
 
 void RenderProxy::releaseVDAtlasEntries() {
     RenderThread& thread = RenderThread::getInstance();
-    thread.queue().post([&thread]() {
+    thread.queue().post(WorkQueue::Priority::Background, [&thread]() {
         // The context may be null if trimMemory executed, but then the atlas was deleted too.
         if (thread.getGrContext() != nullptr) {
             thread.cacheManager().acquireVectorDrawableAtlas()->delayedReleaseEntries();
@@ -93,6 +93,9 @@ public:
 
     ANDROID_API void destroyHardwareResources();
     ANDROID_API static void trimMemory(int level);
+    // Caps the process' GPU cache memory; the render thread rebalances the
+    // individual cache budgets underneath the cap. 0 removes the cap.
+    ANDROID_API static void setCacheMemoryCeiling(size_t ceilingBytes);
     ANDROID_API static void overrideProperty(const char* name, const char* value);
 
     ANDROID_API void fence();
@@ -125,10 +128,20 @@ public:
 
     ANDROID_API static int copySurfaceInto(sp<Surface>& surface, int left, int top, int right,
                                            int bottom, SkBitmap* bitmap);
+    /**
+     * Asynchronous variant of copySurfaceInto. Returns immediately; the
+     * callback is invoked on the RenderThread with a CopyResult code once the
+     * copy has completed. The bitmap must stay valid until then.
+     */
+    ANDROID_API static void copySurfaceIntoAsync(sp<Surface> surface, int left, int top, int right,
+                                                 int bottom, SkBitmap* bitmap,
+                                                 std::function<void(int)>&& callback);
     ANDROID_API static void prepareToDraw(Bitmap& bitmap);
 
     static sk_sp<Bitmap> allocateHardwareBitmap(SkBitmap& bitmap);
 
+    static std::vector<sk_sp<Bitmap>> allocateHardwareBitmaps(const std::vector<SkBitmap*>& bitmaps);
+
     static int copyGraphicBufferInto(GraphicBuffer* buffer, SkBitmap* bitmap);
 
     static void onBitmapDestroyed(uint32_t pixelRefId);
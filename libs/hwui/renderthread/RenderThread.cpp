@@ -168,7 +168,7 @@ void RenderThread::initThreadLocals() {
     mEglManager = new EglManager(*this);
     mRenderState = new RenderState(*this);
     mVkManager = new VulkanManager(*this);
-    mCacheManager = new CacheManager(mDisplayInfo);
+    mCacheManager = new CacheManager(*this, mDisplayInfo);
 }
 
 void RenderThread::dumpGraphicsMemory(int fd) {
@@ -19,10 +19,24 @@ namespace android {
 namespace uirenderer {
 namespace renderthread {
 
-TimeLord::TimeLord() : mFrameIntervalNanos(milliseconds_to_nanoseconds(16)), mFrameTimeNanos(0) {}
+TimeLord::TimeLord()
+        : mFrameIntervalNanos(milliseconds_to_nanoseconds(16))
+        , mRefreshIntervalNanos(mFrameIntervalNanos)
+        , mFrameTimeNanos(0)
+        , mDrawDurationNanos(0) {}
 
 bool TimeLord::vsyncReceived(nsecs_t vsync) {
     if (vsync > mFrameTimeNanos) {
+        if (mFrameTimeNanos > 0) {
+            // Adaptive-refresh panels stretch the vsync spacing at runtime,
+            // so fold plausible deltas into the live interval estimate.
+            // A delta beyond ~2.5x the estimate is an idle gap between
+            // animations, not a rate change, and is ignored.
+            nsecs_t delta = vsync - mFrameTimeNanos;
+            if (delta < mRefreshIntervalNanos * 5 / 2) {
+                mRefreshIntervalNanos = (mRefreshIntervalNanos * 3 + delta) / 4;
+            }
+        }
         mFrameTimeNanos = vsync;
         return true;
     }
@@ -33,13 +47,29 @@ nsecs_t TimeLord::computeFrameTimeNanos() {
     // Logic copied from Choreographer.java
     nsecs_t now = systemTime(CLOCK_MONOTONIC);
     nsecs_t jitterNanos = now - mFrameTimeNanos;
-    if (jitterNanos >= mFrameIntervalNanos) {
-        nsecs_t lastFrameOffset = jitterNanos % mFrameIntervalNanos;
+    if (jitterNanos >= mRefreshIntervalNanos) {
+        nsecs_t lastFrameOffset = jitterNanos % mRefreshIntervalNanos;
         mFrameTimeNanos = now - lastFrameOffset;
     }
     return mFrameTimeNanos;
 }
 
+void TimeLord::frameDurationObserved(nsecs_t drawDurationNanos) {
+    if (drawDurationNanos <= 0) return;
+    if (mDrawDurationNanos == 0) {
+        mDrawDurationNanos = drawDurationNanos;
+    } else {
+        mDrawDurationNanos = (mDrawDurationNanos * 3 + drawDurationNanos) / 4;
+    }
+}
+
+nsecs_t TimeLord::vsyncSlackNanos() const {
+    // The frame must be queued by the vsync after the one it was scheduled
+    // against; whatever remains after the predicted draw duration is slack
+    nsecs_t deadline = mFrameTimeNanos + mRefreshIntervalNanos;
+    return deadline - systemTime(CLOCK_MONOTONIC) - mDrawDurationNanos;
+}
+
 } /* namespace renderthread */
 } /* namespace uirenderer */
 } /* namespace android */
@@ -28,22 +28,42 @@ class RenderThread;
 // ensuring that time flows linearly and smoothly
 class TimeLord {
 public:
-    void setFrameInterval(nsecs_t intervalNanos) { mFrameIntervalNanos = intervalNanos; }
-    nsecs_t frameIntervalNanos() const { return mFrameIntervalNanos; }
+    void setFrameInterval(nsecs_t intervalNanos) {
+        mFrameIntervalNanos = intervalNanos;
+        mRefreshIntervalNanos = intervalNanos;
+    }
+    // The live frame interval estimate. Starts at the configured display
+    // refresh interval and tracks the observed vsync spacing, so adaptive
+    // refresh panels that stretch the interval at runtime are followed.
+    nsecs_t frameIntervalNanos() const { return mRefreshIntervalNanos; }
 
     // returns true if the vsync is newer, false if it was rejected for staleness
     bool vsyncReceived(nsecs_t vsync);
     nsecs_t latestVsync() { return mFrameTimeNanos; }
     nsecs_t computeFrameTimeNanos();
 
+    // Feeds an observed issue-draw duration into the deadline model
+    void frameDurationObserved(nsecs_t drawDurationNanos);
+
+    // Estimated headroom left to start drawing and still make the next
+    // display deadline, based on the live frame interval and the running
+    // average of recent draw durations. Negative means the frame is
+    // already borderline.
+    nsecs_t vsyncSlackNanos() const;
+
 private:
     friend class RenderThread;
 
     TimeLord();
     ~TimeLord() {}
 
+    // Interval configured from DisplayInfo
     nsecs_t mFrameIntervalNanos;
+    // Live estimate from observed vsync spacing; see frameIntervalNanos()
+    nsecs_t mRefreshIntervalNanos;
     nsecs_t mFrameTimeNanos;
+    // Moving average of recent issue-draw durations
+    nsecs_t mDrawDurationNanos;
 };
 
 } /* namespace renderthread */
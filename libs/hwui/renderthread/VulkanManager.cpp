@@ -250,8 +250,13 @@ SkSurface* VulkanManager::getBackbufferSurface(VulkanSurface* surface) {
 }
 
 void VulkanManager::destroyBuffers(VulkanSurface* surface) {
+    destroyBackbuffers(surface);
+    destroyImages(surface);
+}
+
+void VulkanManager::destroyBackbuffers(VulkanSurface* surface) {
     if (surface->mBackbuffers) {
-        for (uint32_t i = 0; i < surface->mImageCount + 1; ++i) {
+        for (uint32_t i = 0; i < surface->mBackbufferCount; ++i) {
             mWaitForFences(mBackendContext->fDevice, 2, surface->mBackbuffers[i].mUsageFences, true,
                            UINT64_MAX);
             surface->mBackbuffers[i].mImageIndex = -1;
@@ -268,6 +273,10 @@ void VulkanManager::destroyBuffers(VulkanSurface* surface) {
 
     delete[] surface->mBackbuffers;
     surface->mBackbuffers = nullptr;
+    surface->mBackbufferCount = 0;
+}
+
+void VulkanManager::destroyImages(VulkanSurface* surface) {
     delete[] surface->mImageInfos;
     surface->mImageInfos = nullptr;
     delete[] surface->mImages;
@@ -325,6 +334,31 @@ void VulkanManager::createBuffers(VulkanSurface* surface, VkFormat format, VkExt
 
     SkASSERT(mCommandPool != VK_NULL_HANDLE);
 
+    // we create one additional backbuffer structure here, because we want to
+    // give the command buffers they contain a chance to finish before we cycle back
+    uint32_t backbufferCount = surface->mImageCount + 1;
+    if (surface->mBackbuffers && surface->mBackbufferCount != backbufferCount) {
+        destroyBackbuffers(surface);
+    }
+    if (surface->mBackbuffers) {
+        // Swapchain recreation with an unchanged image count: recycle the
+        // backbuffer ring instead of reallocating its command buffers,
+        // semaphores and fences. The device was idled before the old images
+        // were released, so none of these objects have pending work. An
+        // aborted acquire may have left fences reset without a matching
+        // submission, so normalize every fence back to the signaled state the
+        // ring starts out in.
+        for (uint32_t i = 0; i < backbufferCount; ++i) {
+            VulkanSurface::BackbufferInfo& backbuffer = surface->mBackbuffers[i];
+            backbuffer.mImageIndex = -1;
+            mResetFences(mBackendContext->fDevice, 2, backbuffer.mUsageFences);
+            mQueueSubmit(mBackendContext->fQueue, 0, nullptr, backbuffer.mUsageFences[0]);
+            mQueueSubmit(mBackendContext->fQueue, 0, nullptr, backbuffer.mUsageFences[1]);
+        }
+        surface->mCurrentBackbufferIndex = surface->mImageCount;
+        return;
+    }
+
     // set up the backbuffers
     VkSemaphoreCreateInfo semaphoreInfo;
     memset(&semaphoreInfo, 0, sizeof(VkSemaphoreCreateInfo));
@@ -344,10 +378,9 @@ void VulkanManager::createBuffers(VulkanSurface* surface, VkFormat format, VkExt
     fenceInfo.pNext = nullptr;
     fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-    // we create one additional backbuffer structure here, because we want to
-    // give the command buffers they contain a chance to finish before we cycle back
-    surface->mBackbuffers = new VulkanSurface::BackbufferInfo[surface->mImageCount + 1];
-    for (uint32_t i = 0; i < surface->mImageCount + 1; ++i) {
+    surface->mBackbuffers = new VulkanSurface::BackbufferInfo[backbufferCount];
+    surface->mBackbufferCount = backbufferCount;
+    for (uint32_t i = 0; i < backbufferCount; ++i) {
         SkDEBUGCODE(VkResult res);
         surface->mBackbuffers[i].mImageIndex = -1;
         SkDEBUGCODE(res =) mCreateSemaphore(mBackendContext->fDevice, &semaphoreInfo, nullptr,
@@ -505,7 +538,9 @@ bool VulkanManager::createSwapchain(VulkanSurface* surface) {
     if (swapchainCreateInfo.oldSwapchain != VK_NULL_HANDLE) {
         mDeviceWaitIdle(mBackendContext->fDevice);
 
-        destroyBuffers(surface);
+        // Only release the per-image objects here; createBuffers() recycles
+        // the backbuffer ring when the new swapchain has the same image count.
+        destroyImages(surface);
 
         mDestroySwapchainKHR(mBackendContext->fDevice, swapchainCreateInfo.oldSwapchain, nullptr);
     }
@@ -60,6 +60,7 @@ private:
     VkSwapchainKHR mSwapchain = VK_NULL_HANDLE;
 
     BackbufferInfo* mBackbuffers = nullptr;
+    uint32_t mBackbufferCount = 0;
     uint32_t mCurrentBackbufferIndex;
 
     uint32_t mImageCount;
@@ -112,6 +113,8 @@ private:
     ~VulkanManager() { destroy(); }
 
     void destroyBuffers(VulkanSurface* surface);
+    void destroyBackbuffers(VulkanSurface* surface);
+    void destroyImages(VulkanSurface* surface);
 
     bool createSwapchain(VulkanSurface* surface);
     void createBuffers(VulkanSurface* surface, VkFormat format, VkExtent2D extent);
@@ -127,18 +127,15 @@ bool GraphicsStatsService::parseFromFile(const std::string& path,
         return false;
     }
     void* addr = mmap(nullptr, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
-    if (!addr) {
+    if (addr == MAP_FAILED) {
         int err = errno;
-        // The file not existing is normal for addToDump(), so only log if
-        // we get an unexpected error
-        if (err != ENOENT) {
-            ALOGW("Failed to mmap '%s', errno=%d (%s)", path.c_str(), err, strerror(err));
-        }
+        ALOGW("Failed to mmap '%s', errno=%d (%s)", path.c_str(), err, strerror(err));
         return false;
     }
     uint32_t file_version = *reinterpret_cast<uint32_t*>(addr);
     if (file_version != sCurrentFileVersion) {
         ALOGW("file_version mismatch! expected %d got %d", sCurrentFileVersion, file_version);
+        munmap(addr, sb.st_size);
         return false;
     }
 
@@ -150,6 +147,7 @@ bool GraphicsStatsService::parseFromFile(const std::string& path,
         ALOGW("Parse failed on '%s' error='%s'", path.c_str(),
               output->InitializationErrorString().c_str());
     }
+    munmap(addr, sb.st_size);
     return success;
 }
 
@@ -212,16 +210,25 @@ bool mergeProfileDataIntoProto(protos::GraphicsStatsProto* proto, const std::str
     return !hitMergeError;
 }
 
-static int32_t findPercentile(protos::GraphicsStatsProto* proto, int percentile) {
-    int32_t pos = percentile * proto->summary().total_frames() / 100;
-    int32_t remaining = proto->summary().total_frames() - pos;
-    for (auto it = proto->histogram().rbegin(); it != proto->histogram().rend(); ++it) {
-        remaining -= it->frame_count();
-        if (remaining <= 0) {
-            return it->render_millis();
+// Extracts several percentiles in one walk of the histogram. The percentiles
+// must be passed in increasing order; walking from the slowest bucket down
+// satisfies the highest percentile first, so a single traversal fills them all.
+static void findPercentiles(protos::GraphicsStatsProto* proto, const int* percentiles,
+                            int32_t* results, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        results[i] = 0;
+    }
+    int32_t totalFrames = proto->summary().total_frames();
+    int32_t cumulative = 0;
+    size_t remaining = count;
+    for (auto it = proto->histogram().rbegin();
+         it != proto->histogram().rend() && remaining > 0; ++it) {
+        cumulative += it->frame_count();
+        while (remaining > 0 &&
+               cumulative >= totalFrames - (percentiles[remaining - 1] * totalFrames / 100)) {
+            results[--remaining] = it->render_millis();
         }
     }
-    return 0;
 }
 
 void dumpAsTextToFd(protos::GraphicsStatsProto* proto, int fd) {
@@ -239,10 +246,14 @@ void dumpAsTextToFd(protos::GraphicsStatsProto* proto, int fd) {
     dprintf(fd, "\nTotal frames rendered: %d", summary.total_frames());
     dprintf(fd, "\nJanky frames: %d (%.2f%%)", summary.janky_frames(),
             (float)summary.janky_frames() / (float)summary.total_frames() * 100.0f);
-    dprintf(fd, "\n50th percentile: %dms", findPercentile(proto, 50));
-    dprintf(fd, "\n90th percentile: %dms", findPercentile(proto, 90));
-    dprintf(fd, "\n95th percentile: %dms", findPercentile(proto, 95));
-    dprintf(fd, "\n99th percentile: %dms", findPercentile(proto, 99));
+    static constexpr int kPercentiles[] = {50, 90, 95, 99};
+    constexpr size_t kNumPercentiles = sizeof(kPercentiles) / sizeof(kPercentiles[0]);
+    int32_t percentileValues[kNumPercentiles];
+    findPercentiles(proto, kPercentiles, percentileValues, kNumPercentiles);
+    dprintf(fd, "\n50th percentile: %dms", percentileValues[0]);
+    dprintf(fd, "\n90th percentile: %dms", percentileValues[1]);
+    dprintf(fd, "\n95th percentile: %dms", percentileValues[2]);
+    dprintf(fd, "\n99th percentile: %dms", percentileValues[3]);
     dprintf(fd, "\nNumber Missed Vsync: %d", summary.missed_vsync_count());
     dprintf(fd, "\nNumber High input latency: %d", summary.high_input_latency_count());
     dprintf(fd, "\nNumber Slow UI thread: %d", summary.slow_ui_thread_count());
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RegressionReport.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <sstream>
+
+namespace android {
+namespace uirenderer {
+namespace test {
+
+const int RegressionReport::kPercentiles[RegressionReport::kPercentileCount] = {50, 90, 95, 99};
+
+// Slowdown tolerated when there aren't enough runs for a significance test
+static const double kFallbackThreshold = 1.05;
+
+// One-sided 95% critical values of Student's t distribution, indexed by
+// degrees of freedom - 1. Beyond the table the normal approximation is used.
+static const double kCriticalT[] = {
+        6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+        1.796, 1.782, 1.771, 1.761, 1.753, 1.746, 1.740, 1.734, 1.729, 1.725,
+        1.721, 1.717, 1.714, 1.711, 1.708, 1.706, 1.703, 1.701, 1.699, 1.697,
+};
+static const double kCriticalTNormal = 1.645;
+
+static double criticalT(double degreesOfFreedom) {
+    int df = int(degreesOfFreedom);
+    if (df < 1) df = 1;
+    if (df > int(sizeof(kCriticalT) / sizeof(kCriticalT[0]))) {
+        return kCriticalTNormal;
+    }
+    return kCriticalT[df - 1];
+}
+
+static double mean(const std::vector<double>& samples) {
+    double sum = 0;
+    for (double s : samples) sum += s;
+    return sum / samples.size();
+}
+
+static double variance(const std::vector<double>& samples, double sampleMean) {
+    double sum = 0;
+    for (double s : samples) {
+        sum += (s - sampleMean) * (s - sampleMean);
+    }
+    return sum / (samples.size() - 1);
+}
+
+/*
+ * Minimal scanner for the JSON this tool writes itself. Only the constructs
+ * used by writeBaseline() are supported, plus value skipping so newer
+ * versions can add fields without breaking older binaries.
+ */
+class JsonScanner {
+public:
+    explicit JsonScanner(const std::string& data) : mData(data) {}
+
+    bool expect(char c) {
+        skipWhitespace();
+        if (mPos >= mData.size() || mData[mPos] != c) return false;
+        mPos++;
+        return true;
+    }
+
+    bool peek(char c) {
+        skipWhitespace();
+        return mPos < mData.size() && mData[mPos] == c;
+    }
+
+    bool parseString(std::string* out) {
+        if (!expect('"')) return false;
+        out->clear();
+        while (mPos < mData.size() && mData[mPos] != '"') {
+            // writeBaseline never emits escapes; reject rather than mis-parse
+            if (mData[mPos] == '\\') return false;
+            out->push_back(mData[mPos++]);
+        }
+        return expect('"');
+    }
+
+    bool parseNumber(double* out) {
+        skipWhitespace();
+        size_t end = mPos;
+        while (end < mData.size() && (isdigit(mData[end]) || strchr("+-.eE", mData[end]))) {
+            end++;
+        }
+        if (end == mPos) return false;
+        *out = strtod(mData.c_str() + mPos, nullptr);
+        mPos = end;
+        return true;
+    }
+
+    bool parseNumberArray(std::vector<double>* out) {
+        if (!expect('[')) return false;
+        out->clear();
+        if (expect(']')) return true;
+        do {
+            double value;
+            if (!parseNumber(&value)) return false;
+            out->push_back(value);
+        } while (expect(','));
+        return expect(']');
+    }
+
+    bool skipValue() {
+        skipWhitespace();
+        if (mPos >= mData.size()) return false;
+        char c = mData[mPos];
+        if (c == '"') {
+            std::string ignored;
+            return parseString(&ignored);
+        }
+        if (c == '{' || c == '[') {
+            int depth = 0;
+            while (mPos < mData.size()) {
+                c = mData[mPos];
+                if (c == '"') {
+                    std::string ignored;
+                    if (!parseString(&ignored)) return false;
+                    continue;
+                }
+                if (c == '{' || c == '[') depth++;
+                if (c == '}' || c == ']') depth--;
+                mPos++;
+                if (depth == 0) return true;
+            }
+            return false;
+        }
+        double ignored;
+        return parseNumber(&ignored);
+    }
+
+private:
+    void skipWhitespace() {
+        while (mPos < mData.size() && isspace(mData[mPos])) mPos++;
+    }
+
+    const std::string& mData;
+    size_t mPos = 0;
+};
+
+void RegressionReport::addRun(const std::string& scene,
+                              const double (&percentileMs)[kPercentileCount]) {
+    SceneSamples& samples = mScenes[scene];
+    for (int i = 0; i < kPercentileCount; i++) {
+        samples.samples[i].push_back(percentileMs[i]);
+    }
+}
+
+bool RegressionReport::writeBaseline(const char* path) const {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Unable to write baseline to '%s'\n", path);
+        return false;
+    }
+    fprintf(file, "{\n  \"version\": 1,\n  \"scenes\": {\n");
+    bool firstScene = true;
+    for (auto& pair : mScenes) {
+        fprintf(file, "%s    \"%s\": {\n", firstScene ? "" : ",\n", pair.first.c_str());
+        for (int i = 0; i < kPercentileCount; i++) {
+            fprintf(file, "      \"p%d\": [", kPercentiles[i]);
+            const std::vector<double>& samples = pair.second.samples[i];
+            for (size_t j = 0; j < samples.size(); j++) {
+                fprintf(file, "%s%.3f", j ? ", " : "", samples[j]);
+            }
+            fprintf(file, "]%s\n", i == kPercentileCount - 1 ? "" : ",");
+        }
+        fprintf(file, "    }");
+        firstScene = false;
+    }
+    fprintf(file, "\n  }\n}\n");
+    bool success = !ferror(file);
+    fclose(file);
+    return success;
+}
+
+/*
+ * Returns true if current is slower than baseline with 95% confidence,
+ * using Welch's t-test when both sides carry enough samples.
+ */
+static bool isRegression(const std::vector<double>& baseline, const std::vector<double>& current,
+                         double* outStatistic) {
+    double baseMean = mean(baseline);
+    double curMean = mean(current);
+    *outStatistic = 0;
+    if (baseline.size() < 2 || current.size() < 2) {
+        return curMean > baseMean * kFallbackThreshold;
+    }
+    double vb = variance(baseline, baseMean) / baseline.size();
+    double vc = variance(current, curMean) / current.size();
+    if (vb + vc == 0) {
+        // No spread at all (common with ms-quantized identical runs); fall
+        // back to the threshold rather than divide by zero
+        return curMean > baseMean * kFallbackThreshold;
+    }
+    double t = (curMean - baseMean) / sqrt(vb + vc);
+    double df = (vb + vc) * (vb + vc) /
+                (vb * vb / (baseline.size() - 1) + vc * vc / (current.size() - 1));
+    *outStatistic = t;
+    return t > criticalT(df);
+}
+
+int RegressionReport::compareToBaseline(const char* path) const {
+    std::ifstream stream(path);
+    if (!stream) {
+        fprintf(stderr, "Unable to read baseline from '%s'\n", path);
+        return -1;
+    }
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    const std::string data = buffer.str();
+
+    std::map<std::string, SceneSamples> baseline;
+    JsonScanner scanner(data);
+    bool ok = scanner.expect('{');
+    std::string key;
+    while (ok && !scanner.peek('}')) {
+        ok = scanner.parseString(&key) && scanner.expect(':');
+        if (!ok) break;
+        if (key != "scenes") {
+            ok = scanner.skipValue();
+        } else {
+            ok = scanner.expect('{');
+            std::string scene;
+            while (ok && !scanner.peek('}')) {
+                ok = scanner.parseString(&scene) && scanner.expect(':') && scanner.expect('{');
+                std::string field;
+                while (ok && !scanner.peek('}')) {
+                    ok = scanner.parseString(&field) && scanner.expect(':');
+                    if (!ok) break;
+                    int index = -1;
+                    for (int i = 0; i < kPercentileCount; i++) {
+                        char name[8];
+                        snprintf(name, sizeof(name), "p%d", kPercentiles[i]);
+                        if (field == name) index = i;
+                    }
+                    if (index >= 0) {
+                        ok = scanner.parseNumberArray(&baseline[scene].samples[index]);
+                    } else {
+                        ok = scanner.skipValue();
+                    }
+                    scanner.expect(',');
+                }
+                ok = ok && scanner.expect('}');
+                scanner.expect(',');
+            }
+            ok = ok && scanner.expect('}');
+        }
+        scanner.expect(',');
+    }
+    if (!ok) {
+        fprintf(stderr, "Malformed baseline file '%s'\n", path);
+        return -1;
+    }
+
+    int regressions = 0;
+    printf("Comparing against baseline %s\n", path);
+    for (auto& pair : mScenes) {
+        auto baselineIter = baseline.find(pair.first);
+        if (baselineIter == baseline.end()) {
+            printf("%-20s not in baseline, skipped\n", pair.first.c_str());
+            continue;
+        }
+        for (int i = 0; i < kPercentileCount; i++) {
+            const std::vector<double>& baseSamples = baselineIter->second.samples[i];
+            const std::vector<double>& curSamples = pair.second.samples[i];
+            if (baseSamples.empty() || curSamples.empty()) continue;
+            double t;
+            bool regressed = isRegression(baseSamples, curSamples, &t);
+            printf("%-20s p%-3d base %7.3fms (n=%zu)  current %7.3fms (n=%zu)  t=%6.2f  %s\n",
+                   pair.first.c_str(), kPercentiles[i], mean(baseSamples), baseSamples.size(),
+                   mean(curSamples), curSamples.size(), t, regressed ? "REGRESSED" : "ok");
+            if (regressed) regressions++;
+        }
+    }
+    if (regressions) {
+        printf("%d regression(s) detected\n", regressions);
+    }
+    return regressions;
+}
+
+}  // namespace test
+}  // namespace uirenderer
+}  // namespace android
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace android {
+namespace uirenderer {
+namespace test {
+
+/**
+ * Collects per-scene frame time percentiles across repeated runs, persists
+ * them as JSON, and compares a later session against such a baseline.
+ *
+ * Each repeat of a scene contributes one sample per tracked percentile, so
+ * with --runs=N the baseline stores N samples per percentile. A comparison
+ * declares a regression when the current samples are slower than the
+ * baseline's with 95% confidence (one-sided Welch's t-test). With a single
+ * run on either side there is no variance to test against, so a fixed 5%
+ * slowdown threshold applies instead.
+ */
+class RegressionReport {
+public:
+    static constexpr int kPercentileCount = 4;
+    static const int kPercentiles[kPercentileCount];
+
+    /**
+     * Records the percentile frame times, in ms, of one run of a scene.
+     */
+    void addRun(const std::string& scene, const double (&percentileMs)[kPercentileCount]);
+
+    /**
+     * Writes all recorded runs to path. Returns false on I/O failure.
+     */
+    bool writeBaseline(const char* path) const;
+
+    /**
+     * Compares the recorded runs against a previously written baseline,
+     * printing one line per scene and percentile. Scenes missing from the
+     * baseline are reported but don't gate. Returns the number of
+     * regressions, or -1 if the baseline could not be read.
+     */
+    int compareToBaseline(const char* path) const;
+
+private:
+    struct SceneSamples {
+        std::vector<double> samples[kPercentileCount];
+    };
+
+    std::map<std::string, SceneSamples> mScenes;
+};
+
+}  // namespace test
+}  // namespace uirenderer
+}  // namespace android
@@ -15,6 +15,7 @@
  */
 
 #include "AnimationContext.h"
+#include "RegressionReport.h"
 #include "RenderNode.h"
 #include "renderthread/RenderProxy.h"
 #include "renderthread/RenderTask.h"
@@ -107,7 +108,7 @@ void outputBenchmarkReport(const TestScene::Info& info, const TestScene::Options
 }
 
 void run(const TestScene::Info& info, const TestScene::Options& opts,
-         benchmark::BenchmarkReporter* reporter) {
+         benchmark::BenchmarkReporter* reporter, RegressionReport* regressionReport) {
     // Switch to the real display
     gDisplay = getBuiltInDisplay();
 
@@ -182,4 +183,12 @@ void run(const TestScene::Info& info, const TestScene::Options& opts,
     } else {
         proxy->dumpProfileInfo(STDOUT_FILENO, DumpFlags::JankStats);
     }
+
+    if (regressionReport) {
+        double percentileMs[RegressionReport::kPercentileCount];
+        for (int i = 0; i < RegressionReport::kPercentileCount; i++) {
+            percentileMs[i] = proxy->frameTimePercentile(RegressionReport::kPercentiles[i]);
+        }
+        regressionReport->addRun(info.name, percentileMs);
+    }
 }
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "RegressionReport.h"
 #include "tests/common/LeakChecker.h"
 #include "tests/common/TestScene.h"
 
@@ -43,9 +44,12 @@ static int gRepeatCount = 1;
 static std::vector<TestScene::Info> gRunTests;
 static TestScene::Options gOpts;
 std::unique_ptr<benchmark::BenchmarkReporter> gBenchmarkReporter;
+static RegressionReport gRegressionReport;
+static std::string gBaselineOutPath;
+static std::string gBaselineComparePath;
 
 void run(const TestScene::Info& info, const TestScene::Options& opts,
-         benchmark::BenchmarkReporter* reporter);
+         benchmark::BenchmarkReporter* reporter, RegressionReport* regressionReport);
 
 static void printHelp() {
     printf(R"(
@@ -68,6 +72,12 @@ OPTIONS:
                        are offscreen rendered
   --benchmark_format   Set output format. Possible values are tabular, json, csv
   --renderer=TYPE      Sets the render pipeline to use. May be opengl, skiagl, or skiavk
+  --baseline=FILE      After all runs, write the per-scene frame time percentile
+                       samples to FILE as JSON; one sample per --runs repeat
+  --compare=FILE       After all runs, compare against a baseline previously
+                       written with --baseline and exit with a failure code if
+                       any scene regressed with 95%% confidence. Use the same
+                       --runs count as the baseline for a meaningful test
 )");
 }
 
@@ -173,6 +183,8 @@ enum {
     Onscreen,
     Offscreen,
     Renderer,
+    Baseline,
+    Compare,
 };
 }
 
@@ -188,6 +200,8 @@ static const struct option LONG_OPTIONS[] = {
         {"onscreen", no_argument, nullptr, LongOpts::Onscreen},
         {"offscreen", no_argument, nullptr, LongOpts::Offscreen},
         {"renderer", required_argument, nullptr, LongOpts::Renderer},
+        {"baseline", required_argument, nullptr, LongOpts::Baseline},
+        {"compare", required_argument, nullptr, LongOpts::Compare},
         {0, 0, 0, 0}};
 
 static const char* SHORT_OPTIONS = "c:r:h";
@@ -278,6 +292,22 @@ void parseOptions(int argc, char* argv[]) {
                 }
                 break;
 
+            case LongOpts::Baseline:
+                if (!optarg) {
+                    error = true;
+                    break;
+                }
+                gBaselineOutPath = optarg;
+                break;
+
+            case LongOpts::Compare:
+                if (!optarg) {
+                    error = true;
+                    break;
+                }
+                gBaselineComparePath = optarg;
+                break;
+
             case LongOpts::Onscreen:
                 gOpts.renderOffscreen = false;
                 break;
@@ -348,9 +378,11 @@ int main(int argc, char* argv[]) {
         gBenchmarkReporter->ReportContext(context);
     }
 
+    const bool recordRegressionSamples = !gBaselineOutPath.empty() || !gBaselineComparePath.empty();
     for (int i = 0; i < gRepeatCount; i++) {
         for (auto&& test : gRunTests) {
-            run(test, gOpts, gBenchmarkReporter.get());
+            run(test, gOpts, gBenchmarkReporter.get(),
+                recordRegressionSamples ? &gRegressionReport : nullptr);
         }
     }
 
@@ -358,6 +390,15 @@ int main(int argc, char* argv[]) {
         gBenchmarkReporter->Finalize();
     }
 
+    int exitCode = EXIT_SUCCESS;
+    if (!gBaselineOutPath.empty() && !gRegressionReport.writeBaseline(gBaselineOutPath.c_str())) {
+        exitCode = EXIT_FAILURE;
+    }
+    if (!gBaselineComparePath.empty() &&
+        gRegressionReport.compareToBaseline(gBaselineComparePath.c_str()) != 0) {
+        exitCode = EXIT_FAILURE;
+    }
+
     LeakChecker::checkForLeaks();
-    return 0;
+    return exitCode;
 }
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "ClipArea.h"
+#include "Matrix.h"
+#include "Rect.h"
+#include "utils/LinearAllocator.h"
+
+#include <SkRegion.h>
+
+using namespace android;
+using namespace android::uirenderer;
+
+constexpr int kViewportSize = 2048;
+
+static void BM_ClipArea_rectangleMode(benchmark::State& state) {
+    Rect rect(0, 0, 500, 500);
+    while (state.KeepRunning()) {
+        ClipArea area;
+        area.setViewportDimensions(kViewportSize, kViewportSize);
+        for (int i = 0; i < RectangleList::kMaxTransformedRectangles; i++) {
+            Matrix4 transform;
+            transform.loadTranslate(i, i, 0);
+            area.clipRectWithTransform(rect, &transform, SkRegion::kIntersect_Op);
+        }
+        LinearAllocator allocator;
+        benchmark::DoNotOptimize(area.serializeClip(allocator));
+    }
+}
+BENCHMARK(BM_ClipArea_rectangleMode);
+
+static void BM_ClipArea_rectangleListMode(benchmark::State& state) {
+    Rect rect(0, 0, 500, 500);
+    while (state.KeepRunning()) {
+        ClipArea area;
+        area.setViewportDimensions(kViewportSize, kViewportSize);
+        area.clipRectWithTransform(rect, &Matrix4::identity(), SkRegion::kIntersect_Op);
+        // each rotation is a new transform, so the list fills up to capacity
+        for (int i = 1; i < RectangleList::kMaxTransformedRectangles; i++) {
+            Matrix4 transform;
+            transform.loadRotate(2.0f * i);
+            area.clipRectWithTransform(rect, &transform, SkRegion::kIntersect_Op);
+        }
+        LinearAllocator allocator;
+        benchmark::DoNotOptimize(area.serializeClip(allocator));
+    }
+}
+BENCHMARK(BM_ClipArea_rectangleListMode);
+
+static void BM_ClipArea_regionMode(benchmark::State& state) {
+    Rect rect(0, 0, 500, 500);
+    while (state.KeepRunning()) {
+        ClipArea area;
+        area.setViewportDimensions(kViewportSize, kViewportSize);
+        area.clipRectWithTransform(rect, &Matrix4::identity(), SkRegion::kIntersect_Op);
+        // one more distinct rotation than the list can hold forces region mode
+        for (int i = 1; i <= RectangleList::kMaxTransformedRectangles + 1; i++) {
+            Matrix4 transform;
+            transform.loadRotate(2.0f * i);
+            area.clipRectWithTransform(rect, &transform, SkRegion::kIntersect_Op);
+        }
+        LinearAllocator allocator;
+        benchmark::DoNotOptimize(area.serializeClip(allocator));
+    }
+}
+BENCHMARK(BM_ClipArea_regionMode);
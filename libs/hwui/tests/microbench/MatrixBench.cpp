@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Matrix.h"
+#include "Vertex.h"
+
+#include <vector>
+
+using namespace android;
+using namespace android::uirenderer;
+
+static const int kVertexCount = 1024;
+
+static std::vector<Vertex> createVertices() {
+    std::vector<Vertex> vertices(kVertexCount);
+    for (int i = 0; i < kVertexCount; i++) {
+        Vertex::set(&vertices[i], i * 0.25f, i * 0.5f);
+    }
+    return vertices;
+}
+
+static void BM_Matrix_mapPoint_loop(benchmark::State& state) {
+    Matrix4 matrix;
+    matrix.loadScale(2.5f, 1.5f, 1.0f);
+    matrix.translate(10.0f, 20.0f);
+    std::vector<Vertex> vertices = createVertices();
+    while (state.KeepRunning()) {
+        for (int i = 0; i < kVertexCount; i++) {
+            matrix.mapPoint(vertices[i].x, vertices[i].y);
+        }
+        benchmark::DoNotOptimize(vertices.data());
+    }
+}
+BENCHMARK(BM_Matrix_mapPoint_loop);
+
+static void BM_Matrix_mapPoints(benchmark::State& state) {
+    Matrix4 matrix;
+    matrix.loadScale(2.5f, 1.5f, 1.0f);
+    matrix.translate(10.0f, 20.0f);
+    std::vector<Vertex> vertices = createVertices();
+    while (state.KeepRunning()) {
+        matrix.mapPoints(vertices.data(), kVertexCount);
+        benchmark::DoNotOptimize(vertices.data());
+    }
+}
+BENCHMARK(BM_Matrix_mapPoints);
+
+static void BM_Matrix_mapPoints_nonSimple(benchmark::State& state) {
+    Matrix4 matrix;
+    matrix.loadRotate(30.0f, 0.0f, 1.0f, 0.0f);
+    std::vector<Vertex> vertices = createVertices();
+    while (state.KeepRunning()) {
+        matrix.mapPoints(vertices.data(), kVertexCount);
+        benchmark::DoNotOptimize(vertices.data());
+    }
+}
+BENCHMARK(BM_Matrix_mapPoints_nonSimple);
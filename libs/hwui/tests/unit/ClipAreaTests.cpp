@@ -85,6 +85,27 @@ TEST(RectangleList, basics) {
     EXPECT_FALSE(rgn.isEmpty());
 }
 
+TEST(RectangleList, convertToRegionMixedTransforms) {
+    // mixes axis-aligned entries (converted without an SkPath) with a
+    // rotated entry (which still goes through scan conversion)
+    RectangleList list;
+    list.set(Rect(0, 0, 100, 100), Matrix4::identity());
+    Matrix4 translate;
+    translate.loadTranslate(10, 10, 0);
+    list.intersectWith(Rect(0, 0, 100, 100), translate);
+    Matrix4 m45;
+    m45.loadRotate(45);
+    list.intersectWith(Rect(-200, -200, 200, 200), m45);
+    EXPECT_EQ(3, list.getTransformedRectanglesCount());
+
+    SkRegion clip;
+    clip.setRect(0, 0, 2000, 2000);
+    SkRegion rgn(list.convertToRegion(clip));
+    // the rotated rect covers both axis-aligned entries, so the result is
+    // their intersection
+    EXPECT_EQ(SkIRect::MakeLTRB(10, 10, 100, 100), rgn.getBounds());
+}
+
 TEST(ClipArea, basics) {
     ClipArea area(createClipArea());
     EXPECT_FALSE(area.isEmpty());
@@ -101,6 +101,82 @@ TEST(DamageAccumulator, basicRenderNode) {
     ASSERT_EQ(SkRect::MakeLTRB(100, 100, 125, 125), dirty);
 }
 
+// Test that computeCurrentTransform answers correctly at several depths and
+// that the cached world transform is dropped when a frame is recycled by a
+// later push
+TEST(DamageAccumulator, computeCurrentTransform) {
+    DamageAccumulator da;
+    Matrix4 translate;
+    translate.loadTranslate(25, 25, 0);
+    Matrix4 result;
+    da.pushTransform(&translate);
+    {
+        da.computeCurrentTransform(&result);
+        ASSERT_EQ(translate, result);
+        da.pushTransform(&translate);
+        da.computeCurrentTransform(&result);
+        Matrix4 expected;
+        expected.loadTranslate(50, 50, 0);
+        ASSERT_EQ(expected, result);
+        da.popTransform();
+
+        // The sibling push recycles the previous frame, which must not answer
+        // with the stale transform
+        Matrix4 scale;
+        scale.loadScale(2, 2, 1);
+        da.pushTransform(&scale);
+        da.computeCurrentTransform(&result);
+        expected = translate;
+        expected.multiply(scale);
+        ASSERT_EQ(expected, result);
+        da.popTransform();
+    }
+    da.popTransform();
+    SkRect dirty;
+    da.finish(&dirty);
+}
+
+// Test that disjoint damage popped through translates survives as individual
+// rects while the total stays the bounding union
+TEST(DamageAccumulator, damageRects) {
+    DamageAccumulator da;
+    Matrix4 translate;
+    translate.loadTranslate(25, 25, 0);
+    da.pushTransform(&translate);
+    {
+        da.pushTransform(&Matrix4::identity());
+        da.dirty(0, 0, 10, 10);
+        da.popTransform();
+        da.pushTransform(&Matrix4::identity());
+        da.dirty(100, 100, 110, 110);
+        da.popTransform();
+    }
+    da.popTransform();
+    SkRect dirty;
+    std::vector<SkRect> rects;
+    da.finish(&dirty, &rects);
+    ASSERT_EQ(SkRect::MakeLTRB(25, 25, 135, 135), dirty);
+    ASSERT_EQ(2u, rects.size());
+    EXPECT_EQ(SkRect::MakeLTRB(25, 25, 35, 35), rects[0]);
+    EXPECT_EQ(SkRect::MakeLTRB(125, 125, 135, 135), rects[1]);
+}
+
+// Test that overly fragmented damage collapses to the union, reported as an
+// empty rect list
+TEST(DamageAccumulator, damageRectsOverflow) {
+    DamageAccumulator da;
+    da.pushTransform(&Matrix4::identity());
+    for (size_t i = 0; i <= DamageAccumulator::kMaxDamageRects; i++) {
+        da.dirty(i * 20, 0, i * 20 + 10, 10);
+    }
+    da.popTransform();
+    SkRect dirty;
+    std::vector<SkRect> rects;
+    da.finish(&dirty, &rects);
+    ASSERT_EQ(SkRect::MakeLTRB(0, 0, DamageAccumulator::kMaxDamageRects * 20 + 10, 10), dirty);
+    ASSERT_TRUE(rects.empty());
+}
+
 TEST(DamageAccumulator, perspectiveTransform) {
     DamageAccumulator da;
     RenderNode node1;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "FrameInfoRing.h"
+
+using namespace android;
+using namespace android::uirenderer;
+
+static FrameInfo makeFrame(int64_t seed) {
+    int64_t buffer[UI_THREAD_FRAME_INFO_SIZE];
+    for (int i = 0; i < UI_THREAD_FRAME_INFO_SIZE; i++) {
+        buffer[i] = seed + i;
+    }
+    FrameInfo frame;
+    frame.importUiThreadInfo(buffer);
+    return frame;
+}
+
+TEST(FrameInfoRing, pushAndRead) {
+    auto ring = std::make_unique<FrameInfoRing>();
+    ASSERT_EQ(0u, ring->head());
+
+    int64_t record[static_cast<size_t>(FrameInfoIndex::NumIndexes)];
+    ASSERT_FALSE(ring->read(0, record));
+
+    ring->push(makeFrame(100));
+    ring->push(makeFrame(200));
+    ASSERT_EQ(2u, ring->head());
+
+    ASSERT_TRUE(ring->read(0, record));
+    EXPECT_EQ(100, record[static_cast<size_t>(FrameInfoIndex::Flags)]);
+    ASSERT_TRUE(ring->read(1, record));
+    EXPECT_EQ(200, record[static_cast<size_t>(FrameInfoIndex::Flags)]);
+    ASSERT_FALSE(ring->read(2, record));
+}
+
+TEST(FrameInfoRing, overwriteInvalidatesOldest) {
+    auto ring = std::make_unique<FrameInfoRing>();
+    for (size_t i = 0; i < FrameInfoRing::kCapacity + 1; i++) {
+        ring->push(makeFrame(i));
+    }
+    ASSERT_EQ(FrameInfoRing::kCapacity + 1, ring->head());
+
+    int64_t record[static_cast<size_t>(FrameInfoIndex::NumIndexes)];
+    // Record 0 was overwritten by record kCapacity.
+    ASSERT_FALSE(ring->read(0, record));
+    // Record 1's slot may be mid-overwrite at this head, so it is
+    // conservatively rejected; record 2 is the oldest safely readable one.
+    ASSERT_FALSE(ring->read(1, record));
+    ASSERT_TRUE(ring->read(2, record));
+    EXPECT_EQ(2, record[static_cast<size_t>(FrameInfoIndex::Flags)]);
+    ASSERT_TRUE(ring->read(FrameInfoRing::kCapacity, record));
+    EXPECT_EQ(static_cast<int64_t>(FrameInfoRing::kCapacity),
+              record[static_cast<size_t>(FrameInfoIndex::Flags)]);
+}
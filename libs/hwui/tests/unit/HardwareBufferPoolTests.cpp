@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <hwui/HardwareBufferPool.h>
+
+using namespace android;
+
+static const uint64_t kUsage = GraphicBuffer::USAGE_HW_TEXTURE |
+                               GraphicBuffer::USAGE_SW_WRITE_NEVER |
+                               GraphicBuffer::USAGE_SW_READ_NEVER;
+
+TEST(HardwareBufferPool, recycleAndReuse) {
+    HardwareBufferPool& pool = HardwareBufferPool::getInstance();
+    pool.clear();
+
+    sp<GraphicBuffer> buffer =
+            pool.obtain(64, 64, PIXEL_FORMAT_RGBA_8888, kUsage, "recycleAndReuse");
+    ASSERT_NE(nullptr, buffer.get());
+    EXPECT_EQ(0u, pool.getCount());
+
+    GraphicBuffer* raw = buffer.get();
+    pool.recycle(buffer);
+    buffer.clear();
+    EXPECT_EQ(1u, pool.getCount());
+
+    // Same dimensions, format and usage come back out of the pool.
+    sp<GraphicBuffer> reused =
+            pool.obtain(64, 64, PIXEL_FORMAT_RGBA_8888, kUsage, "recycleAndReuse");
+    EXPECT_EQ(raw, reused.get());
+    EXPECT_EQ(0u, pool.getCount());
+
+    pool.clear();
+}
+
+TEST(HardwareBufferPool, mismatchedSizeNotReused) {
+    HardwareBufferPool& pool = HardwareBufferPool::getInstance();
+    pool.clear();
+
+    sp<GraphicBuffer> buffer =
+            pool.obtain(64, 64, PIXEL_FORMAT_RGBA_8888, kUsage, "mismatchedSizeNotReused");
+    ASSERT_NE(nullptr, buffer.get());
+    GraphicBuffer* raw = buffer.get();
+    pool.recycle(buffer);
+    buffer.clear();
+
+    sp<GraphicBuffer> other =
+            pool.obtain(32, 32, PIXEL_FORMAT_RGBA_8888, kUsage, "mismatchedSizeNotReused");
+    ASSERT_NE(nullptr, other.get());
+    EXPECT_NE(raw, other.get());
+    // The 64x64 buffer is still waiting in the pool.
+    EXPECT_EQ(1u, pool.getCount());
+
+    pool.clear();
+}
+
+TEST(HardwareBufferPool, clearDropsBuffers) {
+    HardwareBufferPool& pool = HardwareBufferPool::getInstance();
+    pool.clear();
+
+    sp<GraphicBuffer> buffer =
+            pool.obtain(64, 64, PIXEL_FORMAT_RGBA_8888, kUsage, "clearDropsBuffers");
+    ASSERT_NE(nullptr, buffer.get());
+    pool.recycle(buffer);
+    buffer.clear();
+    EXPECT_EQ(1u, pool.getCount());
+    EXPECT_GT(pool.getSizeInBytes(), 0u);
+
+    pool.clear();
+    EXPECT_EQ(0u, pool.getCount());
+    EXPECT_EQ(0u, pool.getSizeInBytes());
+}
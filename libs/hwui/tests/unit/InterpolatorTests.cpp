@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <Interpolator.h>
+
+#include <memory>
+
+namespace android {
+namespace uirenderer {
+
+// The packed evaluation used for batched animators must match the virtual
+// interpolate() of every non-custom interpolator class.
+TEST(Interpolator, packedEvaluationMatchesVirtual) {
+    std::unique_ptr<Interpolator> interpolators[] = {
+            std::make_unique<AccelerateDecelerateInterpolator>(),
+            std::make_unique<AccelerateInterpolator>(1.0f),
+            std::make_unique<AccelerateInterpolator>(1.7f),
+            std::make_unique<DecelerateInterpolator>(1.0f),
+            std::make_unique<DecelerateInterpolator>(2.5f),
+            std::make_unique<LinearInterpolator>(),
+            std::make_unique<OvershootInterpolator>(2.0f),
+    };
+    for (auto& interpolator : interpolators) {
+        ASSERT_NE(Interpolator::Type::Custom, interpolator->type());
+        for (float input : {0.0f, 0.25f, 0.5f, 0.75f, 1.0f}) {
+            EXPECT_EQ(interpolator->interpolate(input),
+                      Interpolator::evaluate(interpolator->type(), interpolator->param(), input));
+        }
+    }
+}
+
+// Interpolators without a packed form must report Type::Custom so that the
+// batch path falls back to virtual dispatch.
+TEST(Interpolator, customTypes) {
+    EXPECT_EQ(Interpolator::Type::Custom, BounceInterpolator().type());
+    EXPECT_EQ(Interpolator::Type::Custom, CycleInterpolator(1.0f).type());
+    EXPECT_EQ(Interpolator::Type::Custom, AnticipateInterpolator(2.0f).type());
+    EXPECT_EQ(Interpolator::Type::Custom, AnticipateOvershootInterpolator(2.0f).type());
+}
+
+}  // namespace uirenderer
+}  // namespace android
@@ -130,3 +130,25 @@ TEST(LsaVector, dtorCheck) {
         EXPECT_EQ(size, destroyed);
     }
 }
+
+TEST(LinearAllocator, pagePoolReuse) {
+    LinearAllocator::purgePool();
+    void* firstPage = nullptr;
+    {
+        LinearAllocator la;
+        firstPage = la.alloc<char>(64);
+    }
+    // The freed page parks in the thread's pool; an identically-sized
+    // allocator should get the exact same buffer back
+    {
+        LinearAllocator la;
+        EXPECT_EQ(firstPage, la.alloc<char>(64));
+    }
+    LinearAllocator::purgePool();
+    // After a purge the pool can't hand the old page back (it may still
+    // alias it if malloc recycles the address, so just smoke-test alloc)
+    {
+        LinearAllocator la;
+        EXPECT_NE(nullptr, la.alloc<char>(64));
+    }
+}
@@ -18,6 +18,7 @@
 
 #include "Matrix.h"
 #include "Rect.h"
+#include "Vertex.h"
 
 using namespace android::uirenderer;
 
@@ -46,3 +47,46 @@ TEST(Matrix, mapRect_emptyRotate) {
     skewMatrix.mapRect(lineRect);
     EXPECT_FALSE(lineRect.isEmpty()) << "Empty 'line' rect doesn't remain empty when rotated.";
 }
+
+TEST(Matrix, mapPoints_matchesMapPoint) {
+    Vertex vertices[7];
+    Vertex expected[7];
+    for (int i = 0; i < 7; i++) {
+        Vertex::set(&vertices[i], i * 1.5f, 20.0f - i);
+        expected[i] = vertices[i];
+    }
+
+    // Skew, so the batch path can't take the scale/translate shortcut
+    Matrix4 matrix;
+    matrix.loadScale(3, 5, 1);
+    matrix.skew(0.2f, 0.4f);
+    matrix.translate(7, -9);
+
+    for (int i = 0; i < 7; i++) {
+        matrix.mapPoint(expected[i].x, expected[i].y);
+    }
+    matrix.mapPoints(vertices, 7);
+    for (int i = 0; i < 7; i++) {
+        EXPECT_FLOAT_EQ(expected[i].x, vertices[i].x) << "x mismatch at " << i;
+        EXPECT_FLOAT_EQ(expected[i].y, vertices[i].y) << "y mismatch at " << i;
+    }
+}
+
+TEST(Matrix, mapPoints_simple) {
+    // Odd count, so the vector path (if taken) leaves a scalar tail
+    Vertex vertices[5];
+    for (int i = 0; i < 5; i++) {
+        Vertex::set(&vertices[i], i, 2.0f * i);
+    }
+
+    Matrix4 matrix;
+    matrix.loadScale(2, 4, 1);
+    matrix.translate(10, 100);
+    ASSERT_TRUE(matrix.isSimple());
+
+    matrix.mapPoints(vertices, 5);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_FLOAT_EQ(i * 2.0f + 10.0f, vertices[i].x);
+        EXPECT_FLOAT_EQ(i * 8.0f + 100.0f, vertices[i].y);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Matrix.h"
+#include "PathTessellator.h"
+#include "Vertex.h"
+#include "VertexBuffer.h"
+
+#include <SkPaint.h>
+#include <SkPath.h>
+
+#include <string.h>
+
+using namespace android;
+using namespace android::uirenderer;
+
+TEST(PathTessellator, indexedComplexPath) {
+    // A large circle approximates to well over the perimeter point threshold,
+    // so the tessellation is emitted as a deduplicated pool plus indices.
+    SkPath path;
+    path.addCircle(200, 200, 200);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+
+    VertexBuffer buffer;
+    PathTessellator::tessellatePath(path, &paint, Matrix4::identity(), buffer);
+
+    ASSERT_TRUE(buffer.getMeshFeatureFlags() & VertexBuffer::kIndices);
+    ASSERT_TRUE(buffer.getMeshFeatureFlags() & VertexBuffer::kAlpha);
+    ASSERT_NE(nullptr, buffer.getIndices());
+    // The strip restates vertices, so there must be more indices than pooled
+    // vertices, and the indexed mesh must be smaller than the flat strip.
+    EXPECT_GT(buffer.getIndexCount(), buffer.getVertexCount());
+    EXPECT_LT(buffer.getVertexCount() * sizeof(AlphaVertex) +
+                      buffer.getIndexCount() * sizeof(uint16_t),
+              buffer.getIndexCount() * sizeof(AlphaVertex));
+
+    // every index must address the pool
+    const uint16_t* indices = reinterpret_cast<const uint16_t*>(buffer.getIndices());
+    for (unsigned int i = 0; i < buffer.getIndexCount(); i++) {
+        EXPECT_LT(indices[i], buffer.getVertexCount());
+    }
+
+    // the pool must be fully deduplicated
+    const AlphaVertex* vertices = reinterpret_cast<const AlphaVertex*>(buffer.getBuffer());
+    for (unsigned int i = 0; i < buffer.getVertexCount(); i++) {
+        for (unsigned int j = i + 1; j < buffer.getVertexCount(); j++) {
+            EXPECT_TRUE(memcmp(&vertices[i], &vertices[j], sizeof(AlphaVertex)) != 0)
+                    << "duplicate pooled vertices at " << i << " and " << j;
+        }
+    }
+}
+
+TEST(PathTessellator, simplePathNotIndexed) {
+    // Simple shapes stay on the direct, non-indexed tessellation path.
+    SkPath path;
+    path.addRect(0, 0, 50, 50);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+
+    VertexBuffer buffer;
+    PathTessellator::tessellatePath(path, &paint, Matrix4::identity(), buffer);
+
+    EXPECT_GT(buffer.getVertexCount(), 0u);
+    EXPECT_FALSE(buffer.getMeshFeatureFlags() & VertexBuffer::kIndices);
+    EXPECT_EQ(0u, buffer.getIndexCount());
+}
@@ -21,6 +21,7 @@
 #include "DamageAccumulator.h"
 #include "IContextFactory.h"
 #include "pipeline/skia/SkiaDisplayList.h"
+#include "pipeline/skia/SkiaRecordingCanvas.h"
 #include "renderthread/CanvasContext.h"
 #include "tests/common/TestUtils.h"
 
@@ -173,3 +174,31 @@ TEST(SkiaDisplayList, updateChildren) {
     skiaDL.mChildNodes.emplace_back(renderNode.get(), &dummyCanvas);
     skiaDL.updateChildren([renderNode](RenderNode* n) { ASSERT_EQ(renderNode.get(), n); });
 }
+
+TEST(SkiaDisplayList, spliceUnchangedChild) {
+    sp<RenderNode> parent = new RenderNode();
+    sp<RenderNode> child = new RenderNode();
+
+    // the first recording builds a fresh wrapper for the child
+    SkiaRecordingCanvas canvas(parent.get(), 100, 100);
+    canvas.drawRenderNode(child.get());
+    SkiaDisplayList* firstList = static_cast<SkiaDisplayList*>(canvas.finishRecording());
+    ASSERT_EQ(1u, firstList->mChildNodes.size());
+    ASSERT_TRUE(firstList->mReusableChildren.empty());
+
+    // hand the list back for reuse, as the render thread would at frame end
+    ASSERT_TRUE(firstList->reuseDisplayList(parent.get(), nullptr));
+    ASSERT_TRUE(firstList->mChildNodes.empty());
+    ASSERT_EQ(1u, firstList->mReusableChildren.size());
+
+    // re-recording the same child under the same transform splices the
+    // retained wrapper back in rather than building a new one
+    SkiaRecordingCanvas secondCanvas(parent.get(), 100, 100);
+    secondCanvas.drawRenderNode(child.get());
+    std::unique_ptr<SkiaDisplayList> secondList(
+            static_cast<SkiaDisplayList*>(secondCanvas.finishRecording()));
+    ASSERT_EQ(firstList, secondList.get());
+    ASSERT_EQ(1u, secondList->mChildNodes.size());
+    ASSERT_TRUE(secondList->mReusableChildren.empty());
+    ASSERT_EQ(child.get(), secondList->mChildNodes.front().getRenderNode());
+}
@@ -23,6 +23,19 @@
 using namespace android;
 using namespace android::uirenderer;
 
+RENDERTHREAD_OPENGL_PIPELINE_TEST(TextureCache, setMaxSize) {
+    TextureCache cache;
+    sk_sp<Bitmap> bitmap(TestUtils::createBitmap(100, 100));
+    cache.get(bitmap.get());
+    EXPECT_EQ(1u, cache.missCount());
+    cache.get(bitmap.get());
+    EXPECT_EQ(1u, cache.hitCount());
+    EXPECT_GT(cache.getSize(), 0u);
+    // Shrinking the limit evicts immediately
+    cache.setMaxSize(0);
+    EXPECT_EQ(0u, cache.getSize());
+}
+
 RENDERTHREAD_OPENGL_PIPELINE_TEST(TextureCache, clear) {
     TextureCache cache;
     ASSERT_EQ(cache.getSize(), 0u);
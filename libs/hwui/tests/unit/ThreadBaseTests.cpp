@@ -60,6 +60,40 @@ TEST(ThreadBase, postDelay) {
     ASSERT_TRUE(ranAfter > 90_us) << "Ran after " << ns2us(ranAfter) << "us <= 90us";
 }
 
+TEST(ThreadBase, priorityOrder) {
+    std::mutex mutex;
+    std::atomic_bool blocked(false);
+    std::atomic_int sequence(0);
+    std::atomic_int frameCriticalAt(-1);
+    std::atomic_int defaultAt(-1);
+    std::atomic_int backgroundAt(-1);
+
+    // Stall the queue so the prioritized items below all become due together.
+    std::unique_lock mainLock{mutex};
+    queue().post([&]() {
+        blocked = true;
+        std::unique_lock lock{mutex};
+    });
+    for (int i = 0; !blocked && i < 1000; i++) {
+        usleep(1);
+    }
+    ASSERT_TRUE(blocked) << "Failed to stall the queue after 1ms";
+
+    queue().post(WorkQueue::Priority::Background, [&]() { backgroundAt = sequence++; });
+    queue().post([&]() { defaultAt = sequence++; });
+    queue().post(WorkQueue::Priority::FrameCritical, [&]() { frameCriticalAt = sequence++; });
+    mainLock.unlock();
+
+    for (int i = 0; (frameCriticalAt < 0 || defaultAt < 0 || backgroundAt < 0) && i < 1000; i++) {
+        usleep(1);
+    }
+    // Frame-critical work runs first even though it was posted last, and
+    // background work is held back behind the due frame-critical work.
+    ASSERT_EQ(0, frameCriticalAt.load());
+    ASSERT_EQ(1, defaultAt.load());
+    ASSERT_EQ(2, backgroundAt.load());
+}
+
 TEST(ThreadBase, runSync) {
     pid_t thisTid = gettid();
     pid_t otherTid = thisTid;
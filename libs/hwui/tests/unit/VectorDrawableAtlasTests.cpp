@@ -148,10 +148,10 @@ RENDERTHREAD_SKIA_PIPELINE_TEST(VectorDrawableAtlas, repack) {
 
     ASSERT_FALSE(atlas.isFragmented());
 
-    // allocate 4x4 rects, which will fragment the atlas badly, because each entry occupies a 10x10
-    // area
+    // allocate 6x6 rects, which will fragment the atlas badly, because each entry occupies a
+    // freed 10x10 slot and the split remainders are too narrow for another 6x6
     for (uint32_t i = 0; i < 4 * MAX_RECTS; i++) {
-        AtlasEntry entry = atlas.requestNewEntry(4, 4, renderThread.getGrContext());
+        AtlasEntry entry = atlas.requestNewEntry(6, 6, renderThread.getGrContext());
         ASSERT_TRUE(entry.key != INVALID_ATLAS_KEY);
     }
 
@@ -160,4 +160,37 @@ RENDERTHREAD_SKIA_PIPELINE_TEST(VectorDrawableAtlas, repack) {
     atlas.repackIfNeeded(renderThread.getGrContext());
 
     ASSERT_FALSE(atlas.isFragmented());
+}
+
+RENDERTHREAD_SKIA_PIPELINE_TEST(VectorDrawableAtlas, migrateStandalone) {
+    VectorDrawableAtlas atlas(100 * 100);
+    atlas.prepareForDraw(renderThread.getGrContext());
+    // create 70 rects 10x10, which won't all fit in the atlas
+    const int MAX_RECTS = 70;
+    AtlasEntry VDRects[MAX_RECTS];
+
+    for (uint32_t i = 0; i < MAX_RECTS; i++) {
+        VDRects[i] = atlas.requestNewEntry(10, 10, renderThread.getGrContext());
+        ASSERT_TRUE(VDRects[i].key != INVALID_ATLAS_KEY);
+    }
+
+    sk_sp<SkSurface> atlasSurface = VDRects[0].surface;
+    // the last entry did not fit and was given a standalone surface
+    ASSERT_NE(VDRects[MAX_RECTS - 1].surface.get(), atlasSurface.get());
+
+    // release some atlas entries to free up space
+    for (uint32_t i = 0; i < 10; i++) {
+        atlas.releaseEntry(VDRects[i].key);
+    }
+
+    ASSERT_FALSE(atlas.isFragmented());
+
+    // incremental migration passes move the standalone entries into the freed atlas space
+    for (int i = 0; i < 5; i++) {
+        atlas.repackIfNeeded(renderThread.getGrContext());
+    }
+
+    AtlasEntry migrated = atlas.getEntry(VDRects[MAX_RECTS - 1].key);
+    ASSERT_EQ(migrated.surface.get(), atlasSurface.get());
+    ASSERT_TRUE(migrated.rect.width() == 10 && migrated.rect.height() == 10);
 }
\ No newline at end of file
@@ -386,6 +386,34 @@ TEST(VectorDrawable, groupProperties) {
     EXPECT_EQ(1.0f, properties->getPivotY());
 }
 
+TEST(VectorDrawable, updateDamage) {
+    const char* pathStr = "M0,0 l10,0 l0,10 l-10,0 z";
+    VectorDrawable::FullPath* path = new VectorDrawable::FullPath(pathStr, strlen(pathStr));
+    path->mutateStagingProperties()->setFillColor(SK_ColorBLUE);
+    VectorDrawable::Group group;
+    group.addChild(path);
+    // Push the staging properties over to the render thread properties.
+    group.syncProperties();
+
+    // The first walk reports everything as damaged.
+    SkRect damage = SkRect::MakeEmpty();
+    group.updateDamage(SkMatrix::I(), &damage);
+    EXPECT_EQ(SkRect::MakeWH(10, 10), damage);
+    EXPECT_EQ(SkRect::MakeWH(10, 10), group.cachedBounds());
+
+    // A walk over a clean tree reports no damage.
+    damage = SkRect::MakeEmpty();
+    group.updateDamage(SkMatrix::I(), &damage);
+    EXPECT_TRUE(damage.isEmpty());
+
+    // Moving the group damages both the old and the new location of its subtree.
+    group.mutateProperties()->setTranslateX(20);
+    damage = SkRect::MakeEmpty();
+    group.updateDamage(SkMatrix::I(), &damage);
+    EXPECT_EQ(SkRect::MakeLTRB(0, 0, 30, 10), damage);
+    EXPECT_EQ(SkRect::MakeLTRB(20, 0, 30, 10), group.cachedBounds());
+}
+
 TEST(VectorDrawable, drawPathWithoutIncrementingShaderRefCount) {
     VectorDrawable::FullPath path("m1 1", 4);
     SkBitmap bitmap;
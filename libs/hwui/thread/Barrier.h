@@ -41,6 +41,11 @@ public:
         }
     }
 
+    bool isOpen() const {
+        Mutex::Autolock l(mLock);
+        return mOpened;
+    }
+
 private:
     Condition::WakeUpType mType;
     volatile bool mOpened;
@@ -40,6 +40,11 @@ public:
         return mResult;
     }
 
+    /**
+     * Returns true if the result has been produced, without blocking.
+     */
+    bool isReady() const { return mBarrier.isOpen(); }
+
     /**
      * This method must be called only once.
      */
@@ -39,6 +39,8 @@ public:
 
     T getResult() const { return mFuture->get(); }
 
+    bool isReady() const { return mFuture->isReady(); }
+
     void setResult(T result) { mFuture->produce(result); }
 
 protected:
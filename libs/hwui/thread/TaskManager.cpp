@@ -39,7 +39,7 @@ TaskManager::TaskManager() {
     for (int i = 0; i < workerCount; i++) {
         String8 name;
         name.appendFormat("hwuiTask%d", i + 1);
-        mThreads.push_back(new WorkerThread(name));
+        mThreads.push_back(new WorkerThread(this, name));
     }
 }
 
@@ -78,6 +78,23 @@ bool TaskManager::addTaskBase(const sp<TaskBase>& task, const sp<TaskProcessorBa
     return false;
 }
 
+bool TaskManager::stealTask(const WorkerThread* thief, TaskWrapper* outTask) {
+    // Steal from the sibling with the deepest queue, so a thread stuck on a
+    // long task (large shadow tessellations, big paths) doesn't strand the
+    // work queued behind it while other workers idle.
+    size_t maxQueueSize = 0;
+    sp<WorkerThread> victim;
+    for (size_t i = 0; i < mThreads.size(); i++) {
+        if (mThreads[i].get() == thief) continue;
+        size_t queueSize = mThreads[i]->getTaskCount();
+        if (queueSize > maxQueueSize) {
+            victim = mThreads[i];
+            maxQueueSize = queueSize;
+        }
+    }
+    return victim != nullptr && victim->stealTask(outTask);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Thread
 ///////////////////////////////////////////////////////////////////////////////
@@ -100,6 +117,22 @@ bool TaskManager::WorkerThread::threadLoop() {
         task.mProcessor->process(task.mTask);
     }
 
+    // Out of local work - steal pending tasks from busy siblings until every
+    // queue is drained, then go back to waiting on the signal.
+    TaskWrapper stolen;
+    while (!exitPending() && mManager->stealTask(this, &stolen)) {
+        stolen.mProcessor->process(stolen.mTask);
+        stolen = TaskWrapper();
+    }
+
+    return true;
+}
+
+bool TaskManager::WorkerThread::stealTask(TaskWrapper* outTask) {
+    Mutex::Autolock l(mLock);
+    if (mTasks.empty()) return false;
+    *outTask = mTasks.front();
+    mTasks.erase(mTasks.begin());
     return true;
 }
 
@@ -48,6 +48,11 @@ public:
      */
     bool canRunTasks() const;
 
+    /**
+     * Returns the number of worker threads available to run tasks.
+     */
+    size_t workerCount() const { return mThreads.size(); }
+
     /**
      * Stops all allocated threads. Adding tasks will start
      * the threads again as necessary.
@@ -77,12 +82,17 @@ private:
 
     class WorkerThread : public Thread {
     public:
-        explicit WorkerThread(const String8& name) : mSignal(Condition::WAKE_UP_ONE), mName(name) {}
+        WorkerThread(TaskManager* manager, const String8& name)
+                : mSignal(Condition::WAKE_UP_ONE), mManager(manager), mName(name) {}
 
         bool addTask(const TaskWrapper& task);
         size_t getTaskCount() const;
         void exit();
 
+        // Removes the oldest pending task from this thread's queue so an idle
+        // sibling can run it. Returns false if the queue is empty.
+        bool stealTask(TaskWrapper* outTask);
+
     private:
         virtual status_t readyToRun() override;
         virtual bool threadLoop() override;
@@ -95,9 +105,14 @@ private:
         // task is available in the list
         mutable Signal mSignal;
 
+        TaskManager* const mManager;
         const String8 mName;
     };
 
+    // Called by an idle WorkerThread to grab pending work queued on a sibling
+    // thread. Returns false when every queue is empty.
+    bool stealTask(const WorkerThread* thief, TaskWrapper* outTask);
+
     std::vector<sp<WorkerThread> > mThreads;
 };
 
@@ -22,6 +22,7 @@
 #include <log/log.h>
 #include <utils/Timers.h>
 
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
 #include <future>
@@ -41,6 +42,20 @@ class WorkQueue {
 public:
     using clock = MonotonicClock;
 
+    /**
+     * Lanes items can be posted to. Due items are processed lane by lane in this
+     * order. Background work is additionally held back for as long as there is due
+     * frame-critical work, so a cache trim posted just before a vsync cannot delay
+     * the frame; it runs on the next loop iteration instead.
+     */
+    enum class Priority {
+        FrameCritical = 0,
+        Default,
+        Background,
+
+        Count,
+    };
+
 private:
     struct WorkItem {
         WorkItem() = delete;
@@ -65,14 +80,13 @@ public:
         std::vector<WorkItem> toProcess;
         {
             std::unique_lock _lock{mLock};
-            if (mWorkQueue.empty()) return;
-            toProcess = std::move(mWorkQueue);
-            auto moveBack = find_if(std::begin(toProcess), std::end(toProcess),
-                                    [&now](WorkItem& item) { return item.runAt > now; });
-            if (moveBack != std::end(toProcess)) {
-                mWorkQueue.reserve(std::distance(moveBack, std::end(toProcess)) + 5);
-                std::move(moveBack, std::end(toProcess), std::back_inserter(mWorkQueue));
-                toProcess.erase(moveBack, std::end(toProcess));
+            bool hasFrameWork =
+                    collectDueLocked(laneFor(Priority::FrameCritical), now, toProcess);
+            collectDueLocked(laneFor(Priority::Default), now, toProcess);
+            if (!hasFrameWork) {
+                // Defer background work behind frame-critical work; the looper wakes
+                // immediately after this pass, so it runs once the frame is handled.
+                collectDueLocked(laneFor(Priority::Background), now, toProcess);
             }
         }
         for (auto& item : toProcess) {
@@ -82,12 +96,23 @@ public:
 
     template <class F>
     void postAt(nsecs_t time, F&& func) {
-        enqueue(WorkItem{time, std::function<void()>(std::forward<F>(func))});
+        postAt(Priority::Default, time, std::forward<F>(func));
+    }
+
+    template <class F>
+    void postAt(Priority priority, nsecs_t time, F&& func) {
+        enqueue(WorkItem{time, std::function<void()>(std::forward<F>(func))}, priority);
     }
 
     template <class F>
     void postDelayed(nsecs_t delay, F&& func) {
-        enqueue(WorkItem{clock::now() + delay, std::function<void()>(std::forward<F>(func))});
+        postDelayed(Priority::Default, delay, std::forward<F>(func));
+    }
+
+    template <class F>
+    void postDelayed(Priority priority, nsecs_t delay, F&& func) {
+        enqueue(WorkItem{clock::now() + delay, std::function<void()>(std::forward<F>(func))},
+                priority);
     }
 
     template <class F>
@@ -95,6 +120,11 @@ public:
         postAt(0, std::forward<F>(func));
     }
 
+    template <class F>
+    void post(Priority priority, F&& func) {
+        postAt(priority, 0, std::forward<F>(func));
+    }
+
     template <class F>
     auto async(F&& func) -> std::future<decltype(func())> {
         typedef std::packaged_task<decltype(func())()> task_t;
@@ -111,23 +141,44 @@ public:
     };
 
     nsecs_t nextWakeup(std::unique_lock<std::mutex>& lock) {
-        if (mWorkQueue.empty()) {
-            return std::numeric_limits<nsecs_t>::max();
-        } else {
-            return std::begin(mWorkQueue)->runAt;
+        nsecs_t next = std::numeric_limits<nsecs_t>::max();
+        for (auto& lane : mWorkQueues) {
+            if (!lane.empty()) {
+                next = std::min(next, std::begin(lane)->runAt);
+            }
         }
+        return next;
     }
 
 private:
-    void enqueue(WorkItem&& item) {
+    std::vector<WorkItem>& laneFor(Priority priority) {
+        return mWorkQueues[static_cast<int>(priority)];
+    }
+
+    // Moves items that are due at "now" from the lane into toProcess, keeping their
+    // runAt order. Returns true if any item was due.
+    bool collectDueLocked(std::vector<WorkItem>& lane, nsecs_t now,
+                          std::vector<WorkItem>& toProcess) {
+        if (lane.empty() || std::begin(lane)->runAt > now) {
+            return false;
+        }
+        auto moveBack = std::find_if(std::begin(lane), std::end(lane),
+                                     [&now](WorkItem& item) { return item.runAt > now; });
+        std::move(std::begin(lane), moveBack, std::back_inserter(toProcess));
+        lane.erase(std::begin(lane), moveBack);
+        return true;
+    }
+
+    void enqueue(WorkItem&& item, Priority priority) {
         bool needsWakeup;
         {
             std::unique_lock _lock{mLock};
-            auto insertAt = std::find_if(
-                    std::begin(mWorkQueue), std::end(mWorkQueue),
-                    [time = item.runAt](WorkItem & item) { return item.runAt > time; });
-            needsWakeup = std::begin(mWorkQueue) == insertAt;
-            mWorkQueue.emplace(insertAt, std::move(item));
+            auto& lane = laneFor(priority);
+            auto insertAt =
+                    std::find_if(std::begin(lane), std::end(lane),
+                                 [time = item.runAt](WorkItem & item) { return item.runAt > time; });
+            needsWakeup = std::begin(lane) == insertAt;
+            lane.emplace(insertAt, std::move(item));
         }
         if (needsWakeup) {
             mWakeFunc();
@@ -137,7 +188,7 @@ private:
     std::function<void()> mWakeFunc;
 
     std::mutex& mLock;
-    std::vector<WorkItem> mWorkQueue;
+    std::vector<WorkItem> mWorkQueues[static_cast<int>(Priority::Count)];
 };
 
 }  // namespace android::uirenderer
@@ -30,6 +30,8 @@
 #include <stdlib.h>
 #include <utils/Log.h>
 
+#include <vector>
+
 // The ideal size of a page allocation (these need to be multiples of 8)
 #define INITIAL_PAGE_SIZE ((size_t)512)  // 512b
 #define MAX_PAGE_SIZE ((size_t)131072)   // 128kb
@@ -80,6 +82,10 @@ static void _addAllocation(int count) {
 
 #define min(x, y) (((x) < (y)) ? (x) : (y))
 
+// The most recycled page memory a thread will hold onto before
+// returning pages to the system
+#define MAX_POOLED_BYTES ((size_t)1048576)  // 1MB
+
 namespace android {
 namespace uirenderer {
 
@@ -96,11 +102,70 @@ public:
 
     void* end(int pageSize) { return (void*)(((size_t)start()) + pageSize); }
 
+    void setAllocatedSize(size_t size) { mAllocatedSize = size; }
+    size_t allocatedSize() const { return mAllocatedSize; }
+
 private:
     Page(const Page& /*other*/) {}
     Page* mNextPage;
+    size_t mAllocatedSize;
 };
 
+// Per-thread pool of page buffers released by ~LinearAllocator. DisplayList
+// rebuilds alloc/free the same handful of page sizes every frame; recycling
+// them keeps the record path off malloc/free entirely in steady state.
+namespace {
+
+struct PagePool {
+    struct Entry {
+        void* buffer;
+        size_t size;
+    };
+
+    ~PagePool() { purge(); }
+
+    void* acquire(size_t size) {
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (entries[i].size == size) {
+                void* buffer = entries[i].buffer;
+                totalBytes -= size;
+                entries[i] = entries.back();
+                entries.pop_back();
+                return buffer;
+            }
+        }
+        return nullptr;
+    }
+
+    bool release(void* buffer, size_t size) {
+        if (totalBytes + size > MAX_POOLED_BYTES) {
+            return false;
+        }
+        entries.push_back(Entry{buffer, size});
+        totalBytes += size;
+        return true;
+    }
+
+    void purge() {
+        for (size_t i = 0; i < entries.size(); i++) {
+            free(entries[i].buffer);
+        }
+        entries.clear();
+        totalBytes = 0;
+    }
+
+    std::vector<Entry> entries;
+    size_t totalBytes = 0;
+};
+
+thread_local PagePool gPagePool;
+
+}  // namespace
+
+void LinearAllocator::purgePool() {
+    gPagePool.purge();
+}
+
 LinearAllocator::LinearAllocator()
         : mPageSize(INITIAL_PAGE_SIZE)
         , mMaxAllocSize(INITIAL_PAGE_SIZE * MAX_WASTE_RATIO)
@@ -121,9 +186,12 @@ LinearAllocator::~LinearAllocator(void) {
     Page* p = mPages;
     while (p) {
         Page* next = p->next();
+        size_t allocatedSize = p->allocatedSize();
         p->~Page();
-        free(p);
-        RM_ALLOCATION();
+        if (!gPagePool.release(p, allocatedSize)) {
+            free(p);
+            RM_ALLOCATION();
+        }
         p = next;
     }
 }
@@ -226,11 +294,16 @@ void LinearAllocator::rewindIfLastAlloc(void* ptr, size_t allocSize) {
 
 LinearAllocator::Page* LinearAllocator::newPage(size_t pageSize) {
     pageSize = ALIGN(pageSize + sizeof(LinearAllocator::Page));
-    ADD_ALLOCATION();
     mTotalAllocated += pageSize;
     mPageCount++;
-    void* buf = malloc(pageSize);
-    return new (buf) Page();
+    void* buf = gPagePool.acquire(pageSize);
+    if (!buf) {
+        ADD_ALLOCATION();
+        buf = malloc(pageSize);
+    }
+    Page* page = new (buf) Page();
+    page->setAllocatedSize(pageSize);
+    return page;
 }
 
 static const char* toSize(size_t value, float& result) {
@@ -110,6 +110,13 @@ public:
      */
     void dumpMemoryStats(const char* prefix = "");
 
+    /**
+     * Frees every page parked in the calling thread's recycled page pool.
+     * Wired into memory trim so an idle process doesn't pin the pool's
+     * high watermark.
+     */
+    static void purgePool();
+
     /**
      * The number of bytes used for buffers allocated in the LinearAllocator (does not count space
      * wasted)
@@ -271,6 +271,7 @@ void PointerController::setPresentation(Presentation presentation) {
     if (presentation == PRESENTATION_POINTER && mLocked.additionalMouseResources.empty()) {
         mPolicy->loadAdditionalMouseResources(&mLocked.additionalMouseResources,
                                               &mLocked.animationResources);
+        prerenderAnimationFramesLocked();
     }
 
     if (mLocked.presentation != presentation) {
@@ -363,6 +364,7 @@ void PointerController::reloadPointerResources() {
         mPolicy->loadPointerIcon(&mLocked.pointerIcon);
         mPolicy->loadAdditionalMouseResources(&mLocked.additionalMouseResources,
                                               &mLocked.animationResources);
+        prerenderAnimationFramesLocked();
     }
 
     mLocked.presentationChanged = true;
@@ -590,6 +592,26 @@ bool PointerController::doBitmapAnimationLocked(nsecs_t timestamp) {
     return true;
 }
 
+void PointerController::prerenderAnimationFramesLocked() {
+    // Convert every animation frame to the sprite surface's pixel format up
+    // front, so flipping frames while an animation plays copies pixels into
+    // the surface without converting them each time.
+    for (auto& entry : mLocked.animationResources) {
+        for (SpriteIcon& frame : entry.second.animationFrames) {
+            SkBitmap& bitmap = frame.bitmap;
+            if (bitmap.isNull() || bitmap.colorType() == kN32_SkColorType) {
+                continue;
+            }
+            SkBitmap converted;
+            if (converted.tryAllocPixels(bitmap.info().makeColorType(kN32_SkColorType))
+                    && bitmap.readPixels(converted.info(), converted.getPixels(),
+                            converted.rowBytes(), 0, 0)) {
+                bitmap = converted;
+            }
+        }
+    }
+}
+
 void PointerController::doInactivityTimeout() {
     fade(TRANSITION_GRADUAL);
 }
@@ -193,6 +193,7 @@ private:
     void doAnimate(nsecs_t timestamp);
     bool doFadingAnimationLocked(nsecs_t timestamp);
     bool doBitmapAnimationLocked(nsecs_t timestamp);
+    void prerenderAnimationFramesLocked();
     void doInactivityTimeout();
 
     void startAnimationLocked();
@@ -121,6 +121,7 @@ void SpriteController::doUpdateSprites() {
         AutoMutex _l(mLock);
 
         numSprites = mLocked.invalidatedSprites.size();
+        updates.setCapacity(numSprites);
         for (size_t i = 0; i < numSprites; i++) {
             const sp<SpriteImpl>& sprite = mLocked.invalidatedSprites.itemAt(i);
 
@@ -130,14 +131,23 @@ void SpriteController::doUpdateSprites() {
         mLocked.invalidatedSprites.clear();
     } // release lock
 
-    // Create missing surfaces.
+    // Create missing surfaces and resize existing ones if needed, batching the
+    // resizes into one transaction. This must be committed before the surfaces
+    // are drawn so that the locked buffers have the new size.
     bool surfaceChanged = false;
+    SurfaceComposerClient::Transaction t;
+    bool needApplyTransaction = false;
     for (size_t i = 0; i < numSprites; i++) {
         SpriteUpdate& update = updates.editItemAt(i);
 
-        if (update.state.surfaceControl == NULL && update.state.wantSurfaceVisible()) {
-            update.state.surfaceWidth = update.state.icon.bitmap.width();
-            update.state.surfaceHeight = update.state.icon.bitmap.height();
+        if (!update.state.wantSurfaceVisible()) {
+            continue;
+        }
+        int32_t desiredWidth = update.state.icon.bitmap.width();
+        int32_t desiredHeight = update.state.icon.bitmap.height();
+        if (update.state.surfaceControl == NULL) {
+            update.state.surfaceWidth = desiredWidth;
+            update.state.surfaceHeight = desiredHeight;
             update.state.surfaceDrawn = false;
             update.state.surfaceVisible = false;
             update.state.surfaceControl = obtainSurface(
@@ -145,33 +155,20 @@ void SpriteController::doUpdateSprites() {
             if (update.state.surfaceControl != NULL) {
                 update.surfaceChanged = surfaceChanged = true;
             }
-        }
-    }
-
-    // Resize sprites if needed.
-    SurfaceComposerClient::Transaction t;
-    bool needApplyTransaction = false;
-    for (size_t i = 0; i < numSprites; i++) {
-        SpriteUpdate& update = updates.editItemAt(i);
+        } else if (update.state.surfaceWidth < desiredWidth
+                || update.state.surfaceHeight < desiredHeight) {
+            needApplyTransaction = true;
 
-        if (update.state.surfaceControl != NULL && update.state.wantSurfaceVisible()) {
-            int32_t desiredWidth = update.state.icon.bitmap.width();
-            int32_t desiredHeight = update.state.icon.bitmap.height();
-            if (update.state.surfaceWidth < desiredWidth
-                    || update.state.surfaceHeight < desiredHeight) {
-                needApplyTransaction = true;
-
-                t.setSize(update.state.surfaceControl,
-                        desiredWidth, desiredHeight);
-                update.state.surfaceWidth = desiredWidth;
-                update.state.surfaceHeight = desiredHeight;
-                update.state.surfaceDrawn = false;
-                update.surfaceChanged = surfaceChanged = true;
+            t.setSize(update.state.surfaceControl,
+                    desiredWidth, desiredHeight);
+            update.state.surfaceWidth = desiredWidth;
+            update.state.surfaceHeight = desiredHeight;
+            update.state.surfaceDrawn = false;
+            update.surfaceChanged = surfaceChanged = true;
 
-                if (update.state.surfaceVisible) {
-                    t.hide(update.state.surfaceControl);
-                    update.state.surfaceVisible = false;
-                }
+            if (update.state.surfaceVisible) {
+                t.hide(update.state.surfaceControl);
+                update.state.surfaceVisible = false;
             }
         }
     }
@@ -179,7 +176,13 @@ void SpriteController::doUpdateSprites() {
         t.apply();
     }
 
-    // Redraw sprites if needed.
+    // Redraw sprites if needed. The paints are shared by every sprite drawn
+    // this pass; in multi-pointer scenarios several sprites redraw per frame.
+    SkPaint bitmapPaint;
+    bitmapPaint.setBlendMode(SkBlendMode::kSrc);
+    SkPaint fillPaint;
+    fillPaint.setBlendMode(SkBlendMode::kSrc);
+    fillPaint.setColor(0); // transparent fill color
     for (size_t i = 0; i < numSprites; i++) {
         SpriteUpdate& update = updates.editItemAt(i);
 
@@ -203,19 +206,15 @@ void SpriteController::doUpdateSprites() {
 
                 SkCanvas surfaceCanvas(surfaceBitmap);
 
-                SkPaint paint;
-                paint.setBlendMode(SkBlendMode::kSrc);
-                surfaceCanvas.drawBitmap(update.state.icon.bitmap, 0, 0, &paint);
+                surfaceCanvas.drawBitmap(update.state.icon.bitmap, 0, 0, &bitmapPaint);
 
                 if (outBuffer.width > update.state.icon.bitmap.width()) {
-                    paint.setColor(0); // transparent fill color
                     surfaceCanvas.drawRect(SkRect::MakeLTRB(update.state.icon.bitmap.width(), 0,
-                            outBuffer.width, update.state.icon.bitmap.height()), paint);
+                            outBuffer.width, update.state.icon.bitmap.height()), fillPaint);
                 }
                 if (outBuffer.height > update.state.icon.bitmap.height()) {
-                    paint.setColor(0); // transparent fill color
                     surfaceCanvas.drawRect(SkRect::MakeLTRB(0, update.state.icon.bitmap.height(),
-                            outBuffer.width, outBuffer.height), paint);
+                            outBuffer.width, outBuffer.height), fillPaint);
                 }
 
                 status = surface->unlockAndPost();
@@ -377,8 +376,16 @@ void SpriteController::SpriteImpl::setIcon(const SpriteIcon& icon) {
 
     uint32_t dirty;
     if (icon.isValid()) {
+        // Animated pointers set a new icon once per frame. Reuse the existing
+        // pixel allocation when it has the right geometry and nothing else
+        // (such as a pending update record) still references it.
         SkBitmap* bitmapCopy = &mLocked.state.icon.bitmap;
-        if (bitmapCopy->tryAllocPixels(icon.bitmap.info().makeColorType(kN32_SkColorType))) {
+        SkImageInfo copyInfo = icon.bitmap.info().makeColorType(kN32_SkColorType);
+        if (bitmapCopy->getPixels() == NULL || bitmapCopy->info() != copyInfo
+                || !bitmapCopy->pixelRef()->unique()) {
+            bitmapCopy->tryAllocPixels(copyInfo);
+        }
+        if (bitmapCopy->getPixels() != NULL && bitmapCopy->info() == copyInfo) {
             icon.bitmap.readPixels(bitmapCopy->info(), bitmapCopy->getPixels(),
                     bitmapCopy->rowBytes(), 0, 0);
         }
@@ -95,6 +95,11 @@ public:
      */
     void writeRawByte(uint8_t val);
 
+    /**
+     * Write a buffer of bytes to the buffer, copying chunk by chunk.
+     */
+    void writeRawBuffer(uint8_t const* val, size_t size);
+
     /**
      * Write a varint32 into the buffer. Return the size of the varint.
      */
@@ -203,6 +208,15 @@ public:
          */
         uint64_t readRawVarint();
 
+        /**
+         * Writes the remaining unread bytes to the given fd, gathering the chunk
+         * list into iovecs so a large payload goes out in a few writev calls
+         * instead of one write per chunk, with no intermediate copies.
+         * Moves the read pointer to the end of the buffer. Returns false on
+         * write failure with errno set by writev.
+         */
+        bool writeToFd(int fd);
+
     private:
         const EncodedBuffer& mData;
         Pointer mRp;
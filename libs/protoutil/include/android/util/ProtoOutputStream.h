@@ -20,6 +20,7 @@
 #include <android/util/EncodedBuffer.h>
 
 #include <string>
+#include <vector>
 
 namespace android {
 namespace util {
@@ -132,6 +133,7 @@ public:
     void writeRawVarint(uint64_t varint);
     void writeLengthDelimitedHeader(uint32_t id, size_t size);
     void writeRawByte(uint8_t byte);
+    void writeRawBuffer(uint8_t const* buf, size_t size);
 
 private:
     EncodedBuffer mBuffer;
@@ -141,6 +143,13 @@ private:
     uint32_t mObjectId;
     uint64_t mExpectedObjectToken;
 
+    // One entry per open start() session: the number of bytes the raw bytes of
+    // that message shrink by once its descendants' 8-byte size placeholders
+    // are compacted to varints. Maintained incrementally so the encoded size
+    // of each message is known the moment end() is called, letting compact()
+    // skip a full measuring re-parse of the buffer.
+    std::vector<int> mSizeAdjustStack;
+
     inline void writeDoubleImpl(uint32_t id, double val);
     inline void writeFloatImpl(uint32_t id, float val);
     inline void writeInt64Impl(uint32_t id, long long val);
@@ -159,7 +168,6 @@ private:
     inline void writeMessageBytesImpl(uint32_t id, const char* val, size_t size);
 
     bool compact();
-    size_t editEncodedSize(size_t rawSize);
     bool compactSize(size_t rawSize);
 };
 
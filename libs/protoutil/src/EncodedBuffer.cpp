@@ -16,6 +16,11 @@
 #define LOG_TAG "libprotoutil"
 
 #include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <mutex>
 
 #include <android/util/EncodedBuffer.h>
 #include <android/util/protobuf.h>
@@ -26,6 +31,41 @@ namespace util {
 
 const size_t BUFFER_SIZE = 8 * 1024; // 8 KB
 
+// Process-wide pool of standard-sized chunks. Proto dumps allocate and free
+// the same 8 KB chunks over and over, so recycle them instead of hitting the
+// allocator each time. Only chunks of BUFFER_SIZE are pooled; custom-sized
+// buffers keep using malloc/free directly.
+static const size_t MAX_POOLED_CHUNKS = 64;
+static std::mutex sPoolLock;
+static std::vector<uint8_t*> sChunkPool;
+
+static uint8_t*
+obtainChunk(size_t chunkSize)
+{
+    if (chunkSize == BUFFER_SIZE) {
+        std::lock_guard<std::mutex> lock(sPoolLock);
+        if (!sChunkPool.empty()) {
+            uint8_t* buf = sChunkPool.back();
+            sChunkPool.pop_back();
+            return buf;
+        }
+    }
+    return (uint8_t*)malloc(chunkSize);
+}
+
+static void
+recycleChunk(size_t chunkSize, uint8_t* buf)
+{
+    if (chunkSize == BUFFER_SIZE) {
+        std::lock_guard<std::mutex> lock(sPoolLock);
+        if (sChunkPool.size() < MAX_POOLED_CHUNKS) {
+            sChunkPool.push_back(buf);
+            return;
+        }
+    }
+    free(buf);
+}
+
 EncodedBuffer::Pointer::Pointer() : Pointer(BUFFER_SIZE)
 {
 }
@@ -97,8 +137,7 @@ EncodedBuffer::EncodedBuffer(size_t chunkSize)
 EncodedBuffer::~EncodedBuffer()
 {
     for (size_t i=0; i<mBuffers.size(); i++) {
-        uint8_t* buf = mBuffers[i];
-        free(buf);
+        recycleChunk(mChunkSize, mBuffers[i]);
     }
 }
 
@@ -135,7 +174,7 @@ EncodedBuffer::writeBuffer()
     if (mWp.index() > mBuffers.size()) return NULL;
     uint8_t* buf = NULL;
     if (mWp.index() == mBuffers.size()) {
-        buf = (uint8_t*)malloc(mChunkSize);
+        buf = obtainChunk(mChunkSize);
 
         if (buf == NULL) return NULL; // This indicates NO_MEMORY
 
@@ -157,6 +196,21 @@ EncodedBuffer::writeRawByte(uint8_t val)
     mWp.move();
 }
 
+void
+EncodedBuffer::writeRawBuffer(uint8_t const* val, size_t size)
+{
+    while (size > 0) {
+        uint8_t* buf = writeBuffer();
+        if (buf == NULL) return;
+        size_t amt = currentToWrite();
+        if (amt > size) amt = size;
+        memcpy(buf, val, amt);
+        mWp.move(amt);
+        val += amt;
+        size -= amt;
+    }
+}
+
 size_t
 EncodedBuffer::writeRawVarint64(uint64_t val)
 {
@@ -354,5 +408,34 @@ EncodedBuffer::iterator::readRawVarint()
     return val;
 }
 
+bool
+EncodedBuffer::iterator::writeToFd(int fd)
+{
+    static const int MAX_IOVS = 128;
+    struct iovec iov[MAX_IOVS];
+
+    while (hasNext()) {
+        // Gather the remaining chunks into iovecs, starting from rp. writev
+        // may return short, in which case rp is advanced by what was written
+        // and the gather restarts from the new position.
+        int n = 0;
+        Pointer p = mRp.copy();
+        while (n < MAX_IOVS && p.pos() < mData.mWp.pos()) {
+            size_t amt = mData.mChunkSize - p.offset();
+            if (p.pos() + amt > mData.mWp.pos()) {
+                amt = mData.mWp.pos() - p.pos();
+            }
+            iov[n].iov_base = mData.mBuffers[p.index()] + p.offset();
+            iov[n].iov_len = amt;
+            p.move(amt);
+            n++;
+        }
+        ssize_t amt = TEMP_FAILURE_RETRY(writev(fd, iov, n));
+        if (amt < 0) return false;
+        mRp.move(amt);
+    }
+    return true;
+}
+
 } // util
 } // android
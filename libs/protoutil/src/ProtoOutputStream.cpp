@@ -48,6 +48,7 @@ ProtoOutputStream::clear()
     mDepth = 0;
     mObjectId = 0;
     mExpectedObjectToken = UINT64_C(-1);
+    mSizeAdjustStack.clear();
 }
 
 bool
@@ -271,6 +272,8 @@ ProtoOutputStream::start(uint64_t fieldId)
     mObjectId++;
     mBuffer.writeRawFixed64(mExpectedObjectToken); // push previous token into stack.
 
+    mSizeAdjustStack.push_back(0);
+
     mExpectedObjectToken = makeToken(sizePos - prevPos,
         (bool)(fieldId & FIELD_COUNT_REPEATED), mDepth, mObjectId, sizePos);
     return mExpectedObjectToken;
@@ -299,10 +302,25 @@ ProtoOutputStream::end(uint64_t token)
     mBuffer.ep()->rewind()->move(sizePos);
     mExpectedObjectToken = mBuffer.readRawFixed64();
 
-    // If raw size is larger than 0, write the negative value here to indicate a compact is needed.
+    // How much this message's raw bytes shrink once the already-ended
+    // descendants' size placeholders are compacted to varints.
+    int adjust = 0;
+    if (!mSizeAdjustStack.empty()) {
+        adjust = mSizeAdjustStack.back();
+        mSizeAdjustStack.pop_back();
+    }
+
+    // If raw size is larger than 0, write the negative value here to indicate a compact is needed,
+    // along with the final encoded size which is already known at this point.
     if (childRawSize > 0) {
+        const int childEncodedSize = childRawSize + adjust;
         mBuffer.editRawFixed32(sizePos, -childRawSize);
-        mBuffer.editRawFixed32(sizePos+4, -1);
+        mBuffer.editRawFixed32(sizePos+4, childEncodedSize);
+        if (!mSizeAdjustStack.empty()) {
+            // Propagate to the parent: this message's own placeholder also
+            // turns into a varint when compacted.
+            mSizeAdjustStack.back() += adjust + (int)get_varint_size(childEncodedSize) - 8;
+        }
     } else {
         // reset wp which erase the header tag of the message when its size is 0.
         mBuffer.wp()->rewind()->move(sizePos - getTagSizeFromToken(token));
@@ -326,14 +344,9 @@ ProtoOutputStream::compact() {
     size_t rawBufferSize = mBuffer.size();
     if (rawBufferSize == 0) return true; // nothing to do if the buffer is empty;
 
-    // reset edit pointer and recursively compute encoded size of messages.
-    mBuffer.ep()->rewind();
-    if (editEncodedSize(rawBufferSize) == 0) {
-        ALOGE("Failed to editEncodedSize.");
-        return false;
-    }
-
-    // reset both edit pointer and write pointer, and compact recursively.
+    // Encoded sizes were computed incrementally as each end() was called, so
+    // no measuring pass is needed; reset both pointers and compact in a
+    // single forward pass.
     mBuffer.ep()->rewind();
     mBuffer.wp()->rewind();
     if (!compactSize(rawBufferSize)) {
@@ -351,62 +364,7 @@ ProtoOutputStream::compact() {
 }
 
 /**
- * First compaction pass.  Iterate through the data, and fill in the
- * nested object sizes so the next pass can compact them.
- */
-size_t
-ProtoOutputStream::editEncodedSize(size_t rawSize)
-{
-    size_t objectStart = mBuffer.ep()->pos();
-    size_t objectEnd = objectStart + rawSize;
-    size_t encodedSize = 0;
-    int childRawSize, childEncodedSize;
-    size_t childEncodedSizePos;
-
-    while (mBuffer.ep()->pos() < objectEnd) {
-        uint32_t tag = (uint32_t)mBuffer.readRawVarint();
-        encodedSize += get_varint_size(tag);
-        switch (read_wire_type(tag)) {
-            case WIRE_TYPE_VARINT:
-                do {
-                    encodedSize++;
-                } while ((mBuffer.readRawByte() & 0x80) != 0);
-                break;
-            case WIRE_TYPE_FIXED64:
-                encodedSize += 8;
-                mBuffer.ep()->move(8);
-                break;
-            case WIRE_TYPE_LENGTH_DELIMITED:
-                childRawSize = (int)mBuffer.readRawFixed32();
-                childEncodedSizePos = mBuffer.ep()->pos();
-                childEncodedSize = (int)mBuffer.readRawFixed32();
-                if (childRawSize >= 0 && childRawSize == childEncodedSize) {
-                    mBuffer.ep()->move(childRawSize);
-                } else if (childRawSize < 0 && childEncodedSize == -1){
-                    childEncodedSize = editEncodedSize(-childRawSize);
-                    mBuffer.editRawFixed32(childEncodedSizePos, childEncodedSize);
-                } else {
-                    ALOGE("Bad raw or encoded values: raw=%d, encoded=%d at %zu",
-                            childRawSize, childEncodedSize, childEncodedSizePos);
-                    return 0;
-                }
-                encodedSize += get_varint_size(childEncodedSize) + childEncodedSize;
-                break;
-            case WIRE_TYPE_FIXED32:
-                encodedSize += 4;
-                mBuffer.ep()->move(4);
-                break;
-            default:
-                ALOGE("Unexpected wire type %d in editEncodedSize at [%zu, %zu]",
-                        read_wire_type(tag), objectStart, objectEnd);
-                return 0;
-        }
-    }
-    return encodedSize;
-}
-
-/**
- * Second compaction pass.  Iterate through the data, and copy the data
+ * Compaction pass.  Iterate through the data, and copy the data
  * forward in the buffer, converting the pairs of uint32s into a single
  * unsigned varint of the size.
  */
@@ -467,19 +425,6 @@ ProtoOutputStream::size()
     return mBuffer.size();
 }
 
-static bool write_all(int fd, uint8_t const* buf, size_t size)
-{
-    while (size > 0) {
-        ssize_t amt = ::write(fd, buf, size);
-        if (amt < 0) {
-            return false;
-        }
-        size -= amt;
-        buf += amt;
-    }
-    return true;
-}
-
 bool
 ProtoOutputStream::flush(int fd)
 {
@@ -487,11 +432,7 @@ ProtoOutputStream::flush(int fd)
     if (!compact()) return false;
 
     EncodedBuffer::iterator it = mBuffer.begin();
-    while (it.readBuffer() != NULL) {
-        if (!write_all(fd, it.readBuffer(), it.currentToRead())) return false;
-        it.rp()->move(it.currentToRead());
-    }
-    return true;
+    return it.writeToFd(fd);
 }
 
 EncodedBuffer::iterator
@@ -517,6 +458,11 @@ ProtoOutputStream::writeLengthDelimitedHeader(uint32_t id, size_t size)
     // reserves 64 bits for length delimited fields, if first field is negative, compact it.
     mBuffer.writeRawFixed32(size);
     mBuffer.writeRawFixed32(size);
+    if (!mSizeAdjustStack.empty()) {
+        // The 8-byte size placeholder above compacts down to a varint, so the
+        // enclosing message's encoded size shrinks by the difference.
+        mSizeAdjustStack.back() += (int)get_varint_size(size) - 8;
+    }
 }
 
 void
@@ -525,6 +471,12 @@ ProtoOutputStream::writeRawByte(uint8_t byte)
     mBuffer.writeRawByte(byte);
 }
 
+void
+ProtoOutputStream::writeRawBuffer(uint8_t const* buf, size_t size)
+{
+    mBuffer.writeRawBuffer(buf, size);
+}
+
 
 // =========================================================================
 // Private functions
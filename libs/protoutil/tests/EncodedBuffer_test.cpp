@@ -15,6 +15,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace android::util;
 
 TEST(EncodedBufferTest, ReadVarint) {
@@ -23,3 +25,20 @@ TEST(EncodedBufferTest, ReadVarint) {
     buffer.writeRawVarint64(val);
     EXPECT_EQ(val, buffer.begin().readRawVarint());
 }
+
+TEST(EncodedBufferTest, WriteRawBufferAcrossChunks) {
+    EncodedBuffer buffer(16);  // tiny chunks so the copy spans several of them
+    std::vector<uint8_t> data;
+    for (int i = 0; i < 100; i++) {
+        data.push_back((uint8_t)i);
+    }
+    buffer.writeRawBuffer(data.data(), data.size());
+    EXPECT_EQ(data.size(), buffer.size());
+
+    EncodedBuffer::iterator it = buffer.begin();
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(it.hasNext());
+        EXPECT_EQ((uint8_t)i, it.next());
+    }
+    EXPECT_FALSE(it.hasNext());
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <android/util/ProtoOutputStream.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace android::util;
+
+static std::vector<uint8_t> readAll(ProtoOutputStream* proto) {
+    std::vector<uint8_t> bytes;
+    EncodedBuffer::iterator it = proto->data();
+    while (it.hasNext()) {
+        bytes.push_back(it.next());
+    }
+    return bytes;
+}
+
+TEST(ProtoOutputStreamTest, NestedMessageWithString) {
+    ProtoOutputStream proto;
+    uint64_t token = proto.start(FIELD_TYPE_MESSAGE | 1);
+    EXPECT_TRUE(proto.write(FIELD_TYPE_STRING | 2, std::string("ab")));
+    proto.end(token);
+
+    std::vector<uint8_t> expected = {
+            0x0a, 0x04,            // field 1: message, 4 bytes
+            0x12, 0x02, 'a', 'b',  // field 2: string "ab"
+    };
+    EXPECT_EQ(expected, readAll(&proto));
+}
+
+TEST(ProtoOutputStreamTest, DoublyNestedMessageWithString) {
+    ProtoOutputStream proto;
+    uint64_t outer = proto.start(FIELD_TYPE_MESSAGE | 1);
+    uint64_t inner = proto.start(FIELD_TYPE_MESSAGE | 1);
+    EXPECT_TRUE(proto.write(FIELD_TYPE_STRING | 2, std::string("hi")));
+    proto.end(inner);
+    proto.end(outer);
+
+    std::vector<uint8_t> expected = {
+            0x0a, 0x06,            // field 1: message, 6 bytes
+            0x0a, 0x04,            // field 1: message, 4 bytes
+            0x12, 0x02, 'h', 'i',  // field 2: string "hi"
+    };
+    EXPECT_EQ(expected, readAll(&proto));
+}
@@ -80,6 +80,17 @@ public:
     void setBufferHeight(int height) { mHeight = height; }
     int getBufferHeight() { return mHeight; }
 
+    // Cache of the crop/transform/scaling mode last applied to the producer. The window
+    // state sticks between queueBuffer calls, so a burst of images sharing one
+    // configuration only needs to send it once.
+    bool hasQueuedState() { return mHasQueuedState; }
+    const android_native_rect_t& getLastCrop() { return mLastCrop; }
+    void setLastCrop(const android_native_rect_t& crop) { mLastCrop = crop; mHasQueuedState = true; }
+    int getLastTransform() { return mLastTransform; }
+    void setLastTransform(int transform) { mLastTransform = transform; }
+    int getLastScalingMode() { return mLastScalingMode; }
+    void setLastScalingMode(int scalingMode) { mLastScalingMode = scalingMode; }
+
 private:
     static JNIEnv* getJNIEnv(bool* needsDetach);
     static void detachJNI();
@@ -90,6 +101,10 @@ private:
     int mFormat;
     int mWidth;
     int mHeight;
+    bool mHasQueuedState;
+    android_native_rect_t mLastCrop;
+    int mLastTransform;
+    int mLastScalingMode;
 };
 
 JNIImageWriterContext::JNIImageWriterContext(JNIEnv* env, jobject weakThiz, jclass clazz) :
@@ -97,7 +112,11 @@ JNIImageWriterContext::JNIImageWriterContext(JNIEnv* env, jobject weakThiz, jcla
     mClazz((jclass)env->NewGlobalRef(clazz)),
     mFormat(0),
     mWidth(-1),
-    mHeight(-1) {
+    mHeight(-1),
+    mHasQueuedState(false),
+    mLastCrop(),
+    mLastTransform(-1),
+    mLastScalingMode(-1) {
 }
 
 JNIImageWriterContext::~JNIImageWriterContext() {
@@ -430,6 +449,58 @@ static void ImageWriter_cancelImage(JNIEnv* env, jobject thiz, jlong nativeCtx,
     Image_setNativeContext(env, image, NULL, -1);
 }
 
+// Applies the per-buffer state ahead of a queueBuffer call. The timestamp changes for
+// every image and is always sent; crop, transform and scaling mode persist on the
+// producer side, so values unchanged since the previous queue are skipped. A burst of
+// images sharing one configuration then pays for a single timestamp update per image
+// instead of the full set.
+static status_t ImageWriter_setQueuedBufferState(JNIEnv* env, JNIImageWriterContext* ctx,
+        ANativeWindow* anw, jlong timestampNs, jint left, jint top, jint right, jint bottom,
+        jint transform, jint scalingMode) {
+    ALOGV("timestamp to be queued: %" PRId64, timestampNs);
+    status_t res = native_window_set_buffers_timestamp(anw, timestampNs);
+    if (res != OK) {
+        jniThrowRuntimeException(env, "Set timestamp failed");
+        return res;
+    }
+
+    android_native_rect_t cropRect;
+    cropRect.left = left;
+    cropRect.top = top;
+    cropRect.right = right;
+    cropRect.bottom = bottom;
+    const android_native_rect_t& lastCrop = ctx->getLastCrop();
+    if (!ctx->hasQueuedState() || cropRect.left != lastCrop.left || cropRect.top != lastCrop.top ||
+            cropRect.right != lastCrop.right || cropRect.bottom != lastCrop.bottom) {
+        res = native_window_set_crop(anw, &cropRect);
+        if (res != OK) {
+            jniThrowRuntimeException(env, "Set crop rect failed");
+            return res;
+        }
+        ctx->setLastCrop(cropRect);
+    }
+
+    if (transform != ctx->getLastTransform()) {
+        res = native_window_set_buffers_transform(anw, transform);
+        if (res != OK) {
+            jniThrowRuntimeException(env, "Set transform failed");
+            return res;
+        }
+        ctx->setLastTransform(transform);
+    }
+
+    if (scalingMode != ctx->getLastScalingMode()) {
+        res = native_window_set_scaling_mode(anw, scalingMode);
+        if (res != OK) {
+            jniThrowRuntimeException(env, "Set scaling mode failed");
+            return res;
+        }
+        ctx->setLastScalingMode(scalingMode);
+    }
+
+    return OK;
+}
+
 static void ImageWriter_queueImage(JNIEnv* env, jobject thiz, jlong nativeCtx, jobject image,
         jlong timestampNs, jint left, jint top, jint right, jint bottom, jint transform,
         jint scalingMode) {
@@ -456,35 +527,11 @@ static void ImageWriter_queueImage(JNIEnv* env, jobject thiz, jlong nativeCtx, j
     // Unlock image if it was locked.
     Image_unlockIfLocked(env, image);
 
-    // Set timestamp
-    ALOGV("timestamp to be queued: %" PRId64, timestampNs);
-    res = native_window_set_buffers_timestamp(anw.get(), timestampNs);
-    if (res != OK) {
-        jniThrowRuntimeException(env, "Set timestamp failed");
-        return;
-    }
-
-    // Set crop
-    android_native_rect_t cropRect;
-    cropRect.left = left;
-    cropRect.top = top;
-    cropRect.right = right;
-    cropRect.bottom = bottom;
-    res = native_window_set_crop(anw.get(), &cropRect);
-    if (res != OK) {
-        jniThrowRuntimeException(env, "Set crop rect failed");
-        return;
-    }
-
-    res = native_window_set_buffers_transform(anw.get(), transform);
-    if (res != OK) {
-        jniThrowRuntimeException(env, "Set transform failed");
-        return;
-    }
-
-    res = native_window_set_scaling_mode(anw.get(), scalingMode);
+    // Set timestamp, crop, transform and scaling mode; unchanged values are not resent.
+    res = ImageWriter_setQueuedBufferState(env, ctx, anw.get(), timestampNs, left, top, right,
+            bottom, transform, scalingMode);
     if (res != OK) {
-        jniThrowRuntimeException(env, "Set scaling mode failed");
+        // Exception already thrown.
         return;
     }
 
@@ -554,34 +601,11 @@ static jint ImageWriter_attachAndQueueImage(JNIEnv* env, jobject thiz, jlong nat
     sp < ANativeWindow > anw = surface;
 
     // Step 2. Set timestamp, crop, transform and scaling mode. Note that we do not need unlock the
-    // image because it was not locked.
-    ALOGV("timestamp to be queued: %" PRId64, timestampNs);
-    res = native_window_set_buffers_timestamp(anw.get(), timestampNs);
-    if (res != OK) {
-        jniThrowRuntimeException(env, "Set timestamp failed");
-        return res;
-    }
-
-    android_native_rect_t cropRect;
-    cropRect.left = left;
-    cropRect.top = top;
-    cropRect.right = right;
-    cropRect.bottom = bottom;
-    res = native_window_set_crop(anw.get(), &cropRect);
-    if (res != OK) {
-        jniThrowRuntimeException(env, "Set crop rect failed");
-        return res;
-    }
-
-    res = native_window_set_buffers_transform(anw.get(), transform);
-    if (res != OK) {
-        jniThrowRuntimeException(env, "Set transform failed");
-        return res;
-    }
-
-    res = native_window_set_scaling_mode(anw.get(), scalingMode);
+    // image because it was not locked. Unchanged values are not resent.
+    res = ImageWriter_setQueuedBufferState(env, ctx, anw.get(), timestampNs, left, top, right,
+            bottom, transform, scalingMode);
     if (res != OK) {
-        jniThrowRuntimeException(env, "Set scaling mode failed");
+        // Exception already thrown.
         return res;
     }
 
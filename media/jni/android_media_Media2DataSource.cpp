@@ -31,7 +31,9 @@
 
 namespace android {
 
-static const size_t kBufferSize = 64 * 1024;
+// Caps how much a single readAt crossing can move; keep it large enough that
+// bulk streaming isn't crossing-bound.
+static const size_t kBufferSize = 256 * 1024;
 
 JMedia2DataSource::JMedia2DataSource(JNIEnv* env, jobject source)
     : mJavaObjStatus(OK),
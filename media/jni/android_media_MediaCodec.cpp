@@ -203,6 +203,11 @@ void JMediaCodec::registerSelf() {
 }
 
 void JMediaCodec::release() {
+    JNIEnv *env = AndroidRuntime::getJNIEnv();
+    if (env != NULL) {
+        clearCachedByteBuffers(env);
+    }
+
     if (mCodec != NULL) {
         mCodec->release();
         mCodec.clear();
@@ -242,6 +247,8 @@ JMediaCodec::~JMediaCodec() {
 }
 
 void JMediaCodec::deleteJavaObjects(JNIEnv *env) {
+    clearCachedByteBuffers(env);
+
     env->DeleteGlobalRef(mByteBufferClass);
     mByteBufferClass = NULL;
     env->DeleteGlobalRef(mNativeByteOrderObj);
@@ -325,6 +332,12 @@ status_t JMediaCodec::start() {
 status_t JMediaCodec::stop() {
     mSurfaceTextureClient.clear();
 
+    // The cached ByteBuffers wrap storage that goes away with the codec buffers.
+    JNIEnv *env = AndroidRuntime::getJNIEnv();
+    if (env != NULL) {
+        clearCachedByteBuffers(env);
+    }
+
     return mCodec->stop();
 }
 
@@ -333,6 +346,11 @@ status_t JMediaCodec::flush() {
 }
 
 status_t JMediaCodec::reset() {
+    JNIEnv *env = AndroidRuntime::getJNIEnv();
+    if (env != NULL) {
+        clearCachedByteBuffers(env);
+    }
+
     return mCodec->reset();
 }
 
@@ -374,6 +392,10 @@ status_t JMediaCodec::dequeueOutputBuffer(
             index, &offset, &size, &timeUs, &flags, timeoutUs);
 
     if (err != OK) {
+        if (err == INFO_OUTPUT_BUFFERS_CHANGED || err == INFO_FORMAT_CHANGED) {
+            // The cached wrappers may refer to freed storage once buffers change.
+            clearCachedByteBuffers(env);
+        }
         return err;
     }
 
@@ -520,8 +542,51 @@ status_t JMediaCodec::getBuffer(
         return err;
     }
 
-    return createByteBufferFromABuffer(
+    KeyedVector<size_t, CachedBufferRef> &cache = mCachedByteBuffers[input ? 1 : 0];
+    if (buffer != NULL && buffer->base() != NULL) {
+        ssize_t i = cache.indexOfKey(index);
+        if (i >= 0) {
+            const CachedBufferRef &entry = cache.valueAt(i);
+            if (entry.mBase == buffer->base() && entry.mCapacity == buffer->capacity()) {
+                // Cache hit: only limit and position need refreshing, the byte order
+                // and read-only view stick with the object.
+                jobject me = env->CallObjectMethod(
+                        entry.mByteBuffer, mByteBufferLimitMethodID,
+                        input ? buffer->capacity() : (buffer->offset() + buffer->size()));
+                env->DeleteLocalRef(me);
+                me = env->CallObjectMethod(
+                        entry.mByteBuffer, mByteBufferPositionMethodID,
+                        input ? 0 : buffer->offset());
+                env->DeleteLocalRef(me);
+                *buf = env->NewLocalRef(entry.mByteBuffer);
+                return OK;
+            }
+            // The index was recycled with different storage, drop the stale wrapper.
+            env->DeleteGlobalRef(entry.mByteBuffer);
+            cache.removeItemsAt(i);
+        }
+    }
+
+    err = createByteBufferFromABuffer(
             env, !input /* readOnly */, input /* clearBuffer */, buffer, buf);
+    if (err == OK && *buf != NULL) {
+        CachedBufferRef entry;
+        entry.mBase = buffer->base();
+        entry.mCapacity = buffer->capacity();
+        entry.mByteBuffer = env->NewGlobalRef(*buf);
+        cache.add(index, entry);
+    }
+    return err;
+}
+
+void JMediaCodec::clearCachedByteBuffers(JNIEnv *env) {
+    for (size_t which = 0; which < 2; ++which) {
+        KeyedVector<size_t, CachedBufferRef> &cache = mCachedByteBuffers[which];
+        for (size_t i = 0; i < cache.size(); ++i) {
+            env->DeleteGlobalRef(cache.valueAt(i).mByteBuffer);
+        }
+        cache.clear();
+    }
 }
 
 status_t JMediaCodec::getImage(
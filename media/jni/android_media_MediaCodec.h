@@ -24,6 +24,7 @@
 #include <media/stagefright/foundation/ABase.h>
 #include <media/stagefright/foundation/AHandler.h>
 #include <utils/Errors.h>
+#include <utils/KeyedVector.h>
 
 namespace android {
 
@@ -159,6 +160,20 @@ private:
 
     status_t mInitStatus;
 
+    // getInputBuffer/getOutputBuffer hand out direct ByteBuffers wrapping codec-owned
+    // memory. Steady-state decode loops fetch the same indices over and over, so the
+    // wrappers are cached here instead of being recreated on every call. Entries are
+    // keyed on the backing storage as well as the index, so an index recycled with
+    // different memory gets a fresh wrapper.
+    struct CachedBufferRef {
+        void *mBase;
+        size_t mCapacity;
+        jobject mByteBuffer;  // global reference
+    };
+    mutable KeyedVector<size_t, CachedBufferRef> mCachedByteBuffers[2];  // output, input
+
+    void clearCachedByteBuffers(JNIEnv *env);
+
     template <typename T>
     status_t createByteBufferFromABuffer(
             JNIEnv *env, bool readOnly, bool clearBuffer, const sp<T> &buffer,
@@ -35,7 +35,10 @@ namespace android {
 class JMediaDataSource : public BnDataSource {
 public:
     enum {
-        kBufferSize = 64 * 1024,
+        // Sizes both the Java transfer array and the shared memory read into by
+        // the remote side; it caps how much a single readAt crossing can move,
+        // so keep it large enough that bulk streaming isn't crossing-bound.
+        kBufferSize = 256 * 1024,
     };
 
     JMediaDataSource(JNIEnv *env, jobject source);
@@ -53,6 +53,11 @@ struct fields_t {
 
     jmethodID cryptoInfoSetID;
     jmethodID cryptoInfoSetPatternID;
+
+    // readSampleData runs once per sample, don't look these up per call.
+    jmethodID byteBufferArrayID;
+    jmethodID byteBufferPositionID;
+    jmethodID byteBufferLimitID;
 };
 
 static fields_t gFields;
@@ -171,16 +176,9 @@ status_t JMediaExtractor::readSampleData(
     size_t dstSize;
     jbyteArray byteArray = NULL;
 
-    ScopedLocalRef<jclass> byteBufClass(env, env->FindClass("java/nio/ByteBuffer"));
-    CHECK(byteBufClass.get() != NULL);
-
     if (dst == NULL) {
-        jmethodID arrayID =
-            env->GetMethodID(byteBufClass.get(), "array", "()[B");
-        CHECK(arrayID != NULL);
-
         byteArray =
-            (jbyteArray)env->CallObjectMethod(byteBuf, arrayID);
+            (jbyteArray)env->CallObjectMethod(byteBuf, gFields.byteBufferArrayID);
 
         if (byteArray == NULL) {
             return INVALID_OPERATION;
@@ -216,21 +214,11 @@ status_t JMediaExtractor::readSampleData(
 
     *sampleSize = buffer->size();
 
-    jmethodID positionID = env->GetMethodID(
-            byteBufClass.get(), "position", "(I)Ljava/nio/Buffer;");
-
-    CHECK(positionID != NULL);
-
-    jmethodID limitID = env->GetMethodID(
-            byteBufClass.get(), "limit", "(I)Ljava/nio/Buffer;");
-
-    CHECK(limitID != NULL);
-
     jobject me = env->CallObjectMethod(
-            byteBuf, limitID, offset + *sampleSize);
+            byteBuf, gFields.byteBufferLimitID, offset + *sampleSize);
     env->DeleteLocalRef(me);
     me = env->CallObjectMethod(
-            byteBuf, positionID, offset);
+            byteBuf, gFields.byteBufferPositionID, offset);
     env->DeleteLocalRef(me);
     me = NULL;
 
@@ -683,6 +671,20 @@ static void android_media_MediaExtractor_native_init(JNIEnv *env) {
 
     gFields.cryptoInfoSetPatternID =
         env->GetMethodID(clazz, "setPattern", "(II)V");
+
+    clazz = env->FindClass("java/nio/ByteBuffer");
+    CHECK(clazz != NULL);
+
+    gFields.byteBufferArrayID = env->GetMethodID(clazz, "array", "()[B");
+    CHECK(gFields.byteBufferArrayID != NULL);
+
+    gFields.byteBufferPositionID =
+        env->GetMethodID(clazz, "position", "(I)Ljava/nio/Buffer;");
+    CHECK(gFields.byteBufferPositionID != NULL);
+
+    gFields.byteBufferLimitID =
+        env->GetMethodID(clazz, "limit", "(I)Ljava/nio/Buffer;");
+    CHECK(gFields.byteBufferLimitID != NULL);
 }
 
 static void android_media_MediaExtractor_native_setup(
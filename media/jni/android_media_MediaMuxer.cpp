@@ -112,7 +112,8 @@ static void android_media_MediaMuxer_writeSampleData(
         ALOGE("writeSampleData saw wrong dstSize %lld, size  %d, offset %d",
               (long long)dstSize, size, offset);
         if (byteArray != NULL) {
-            env->ReleaseByteArrayElements(byteArray, (jbyte *)dst, 0);
+            // The sample was only read, don't copy the array contents back.
+            env->ReleaseByteArrayElements(byteArray, (jbyte *)dst, JNI_ABORT);
         }
         jniThrowException(env, "java/lang/IllegalArgumentException",
                           "sample has a wrong size");
@@ -124,7 +125,8 @@ static void android_media_MediaMuxer_writeSampleData(
     status_t err = muxer->writeSampleData(buffer, trackIndex, timeUs, flags);
 
     if (byteArray != NULL) {
-        env->ReleaseByteArrayElements(byteArray, (jbyte *)dst, 0);
+        // The sample was only read, don't copy the array contents back.
+        env->ReleaseByteArrayElements(byteArray, (jbyte *)dst, JNI_ABORT);
     }
 
     if (err != OK) {
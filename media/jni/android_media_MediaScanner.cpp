@@ -17,6 +17,9 @@
 
 //#define LOG_NDEBUG 0
 #define LOG_TAG "MediaScannerJNI"
+#include <map>
+#include <string>
+
 #include <utils/Log.h>
 #include <utils/threads.h>
 #include <media/mediascanner.h>
@@ -45,9 +48,47 @@ static const char* const kIllegalArgumentException =
 
 struct fields_t {
     jfieldID    context;
+
+    // MediaScannerClient callbacks run once per file (and once per metadata
+    // tag), resolve them up front instead of per client instance.
+    jmethodID   scanFileMethodID;
+    jmethodID   handleStringTagMethodID;
+    jmethodID   setMimeTypeMethodID;
 };
 static fields_t fields;
 
+// Metadata tag names come from a small fixed set but were converted to a
+// fresh Java string for every tag of every scanned file. Intern them once
+// as global references instead; the set is bounded so entries live for the
+// process lifetime.
+static Mutex sTagNameCacheLock;
+static std::map<std::string, jstring> sTagNameCache;
+static const size_t kMaxCachedTagNames = 64;
+
+// Returns a cached global reference, or NULL if the caller should fall back
+// to building its own string.
+static jstring internTagName(JNIEnv* env, const char* name) {
+    Mutex::Autolock lock(&sTagNameCacheLock);
+    std::map<std::string, jstring>::iterator it = sTagNameCache.find(name);
+    if (it != sTagNameCache.end()) {
+        return it->second;
+    }
+    if (sTagNameCache.size() >= kMaxCachedTagNames) {
+        return NULL;
+    }
+    jstring local = env->NewStringUTF(name);
+    if (local == NULL) {
+        return NULL;
+    }
+    jstring global = (jstring)env->NewGlobalRef(local);
+    env->DeleteLocalRef(local);
+    if (global == NULL) {
+        return NULL;
+    }
+    sTagNameCache[name] = global;
+    return global;
+}
+
 static status_t checkAndClearExceptionFromCallback(JNIEnv* env, const char* methodName) {
     if (env->ExceptionCheck()) {
         ALOGE("An exception was thrown by callback '%s'.", methodName);
@@ -111,32 +152,11 @@ public:
     MyMediaScannerClient(JNIEnv *env, jobject client)
         :   mEnv(env),
             mClient(env->NewGlobalRef(client)),
-            mScanFileMethodID(0),
-            mHandleStringTagMethodID(0),
-            mSetMimeTypeMethodID(0)
+            mScanFileMethodID(fields.scanFileMethodID),
+            mHandleStringTagMethodID(fields.handleStringTagMethodID),
+            mSetMimeTypeMethodID(fields.setMimeTypeMethodID)
     {
         ALOGV("MyMediaScannerClient constructor");
-        jclass mediaScannerClientInterface =
-                env->FindClass(kClassMediaScannerClient);
-
-        if (mediaScannerClientInterface == NULL) {
-            ALOGE("Class %s not found", kClassMediaScannerClient);
-        } else {
-            mScanFileMethodID = env->GetMethodID(
-                                    mediaScannerClientInterface,
-                                    "scanFile",
-                                    "(Ljava/lang/String;JJZZ)V");
-
-            mHandleStringTagMethodID = env->GetMethodID(
-                                    mediaScannerClientInterface,
-                                    "handleStringTag",
-                                    "(Ljava/lang/String;Ljava/lang/String;)V");
-
-            mSetMimeTypeMethodID = env->GetMethodID(
-                                    mediaScannerClientInterface,
-                                    "setMimeType",
-                                    "(Ljava/lang/String;)V");
-        }
     }
 
     virtual ~MyMediaScannerClient()
@@ -167,10 +187,19 @@ public:
     virtual status_t handleStringTag(const char* name, const char* value)
     {
         ALOGV("handleStringTag: name(%s) and value(%s)", name, value);
-        jstring nameStr, valueStr;
-        if ((nameStr = mEnv->NewStringUTF(name)) == NULL) {
-            mEnv->ExceptionClear();
-            return NO_MEMORY;
+        jstring valueStr;
+        jstring nameStr = internTagName(mEnv, name);
+        bool nameIsLocal = false;
+        if (nameStr == NULL) {
+            if (mEnv->ExceptionCheck()) {
+                mEnv->ExceptionClear();
+                return NO_MEMORY;
+            }
+            if ((nameStr = mEnv->NewStringUTF(name)) == NULL) {
+                mEnv->ExceptionClear();
+                return NO_MEMORY;
+            }
+            nameIsLocal = true;
         }
         char *cleaned = NULL;
         if (!isValidUtf8(value)) {
@@ -188,7 +217,9 @@ public:
         valueStr = mEnv->NewStringUTF(value);
         free(cleaned);
         if (valueStr == NULL) {
-            mEnv->DeleteLocalRef(nameStr);
+            if (nameIsLocal) {
+                mEnv->DeleteLocalRef(nameStr);
+            }
             mEnv->ExceptionClear();
             return NO_MEMORY;
         }
@@ -196,7 +227,9 @@ public:
         mEnv->CallVoidMethod(
             mClient, mHandleStringTagMethodID, nameStr, valueStr);
 
-        mEnv->DeleteLocalRef(nameStr);
+        if (nameIsLocal) {
+            mEnv->DeleteLocalRef(nameStr);
+        }
         mEnv->DeleteLocalRef(valueStr);
         return checkAndClearExceptionFromCallback(mEnv, "handleStringTag");
     }
@@ -385,6 +418,19 @@ android_media_MediaScanner_native_init(JNIEnv *env)
     if (fields.context == NULL) {
         return;
     }
+
+    jclass clientInterface = env->FindClass(kClassMediaScannerClient);
+    if (clientInterface == NULL) {
+        ALOGE("Class %s not found", kClassMediaScannerClient);
+        return;
+    }
+
+    fields.scanFileMethodID = env->GetMethodID(
+            clientInterface, "scanFile", "(Ljava/lang/String;JJZZ)V");
+    fields.handleStringTagMethodID = env->GetMethodID(
+            clientInterface, "handleStringTag", "(Ljava/lang/String;Ljava/lang/String;)V");
+    fields.setMimeTypeMethodID = env->GetMethodID(
+            clientInterface, "setMimeType", "(Ljava/lang/String;)V");
 }
 
 static void
@@ -21,6 +21,9 @@
 #include <utils/Log.h>
 #include "android_media_Utils.h"
 
+#include <mutex>
+#include <set>
+
 #include <media/stagefright/foundation/ADebug.h>
 #include <media/stagefright/foundation/ABuffer.h>
 #include <media/stagefright/foundation/AMessage.h>
@@ -853,6 +856,13 @@ status_t getLockedImageInfo(LockedImage* buffer, int idx,
     return OK;
 }
 
+// Formats that gralloc refused to lock as flexible YCbCr. Consumers that lock a
+// buffer per frame (e.g. an ImageReader feeding a camera analysis pipeline)
+// would otherwise pay for a failing lockAsyncYCbCr trip into gralloc before
+// every successful plain lock.
+static std::mutex sNonFlexibleLockFormatsLock;
+static std::set<int> sNonFlexibleLockFormats;
+
 status_t lockImageFromBuffer(sp<GraphicBuffer> buffer, uint32_t inUsage,
         const Rect& rect, int fenceFd, LockedImage* outputImage) {
     ALOGV("%s: Try to lock the GraphicBuffer", __FUNCTION__);
@@ -871,10 +881,23 @@ status_t lockImageFromBuffer(sp<GraphicBuffer> buffer, uint32_t inUsage,
     status_t res;
     int format = buffer->getPixelFormat();
     int flexFormat = format;
-    if (isPossiblyYUV(format)) {
+    bool tryYCbCr = isPossiblyYUV(format);
+    if (tryYCbCr) {
+        std::lock_guard<std::mutex> lock(sNonFlexibleLockFormatsLock);
+        tryYCbCr = sNonFlexibleLockFormats.count(format) == 0;
+    }
+    if (tryYCbCr) {
         res = buffer->lockAsyncYCbCr(inUsage, rect, &ycbcr, fenceFd);
-        pData = ycbcr.y;
-        flexFormat = HAL_PIXEL_FORMAT_YCbCr_420_888;
+        if (res == BAD_VALUE || res == INVALID_OPERATION) {
+            // Gralloc doesn't support flexible locking of this format; remember
+            // that so later locks go straight to the plain lock below.
+            std::lock_guard<std::mutex> lock(sNonFlexibleLockFormatsLock);
+            sNonFlexibleLockFormats.insert(format);
+        }
+        if (res == OK && ycbcr.y != NULL) {
+            pData = ycbcr.y;
+            flexFormat = HAL_PIXEL_FORMAT_YCbCr_420_888;
+        }
     }
 
     // lockAsyncYCbCr for YUV is unsuccessful.
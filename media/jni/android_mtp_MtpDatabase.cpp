@@ -48,6 +48,7 @@ extern "C" {
 #include <fcntl.h>
 #include <inttypes.h>
 #include <limits.h>
+#include <map>
 #include <stdio.h>
 #include <unistd.h>
 
@@ -104,6 +105,20 @@ private:
     jlongArray      mLongBuffer;
     jcharArray      mStringBuffer;
 
+    // Thumbnail metadata is parsed out of the media file itself during
+    // getObjectInfo, which dominates enumeration of large libraries since
+    // hosts walk every object, often repeatedly. Remember the parsed values
+    // per handle and only re-read the file when the object's modification
+    // time changes.
+    struct ThumbnailInfo {
+        int64_t         dateModified;
+        uint32_t        thumbCompressedSize;
+        uint16_t        thumbFormat;
+        uint32_t        imagePixWidth;
+        uint32_t        imagePixHeight;
+    };
+    std::map<MtpObjectHandle, ThumbnailInfo> mThumbnailInfoCache;
+
 public:
                                     MtpDatabase(JNIEnv *env, jobject client);
     virtual                         ~MtpDatabase();
@@ -258,6 +273,8 @@ MtpObjectHandle MtpDatabase::beginSendObject(const char* path,
 }
 
 void MtpDatabase::endSendObject(MtpObjectHandle handle, bool succeeded) {
+    mThumbnailInfoCache.erase(handle);
+
     JNIEnv* env = AndroidRuntime::getJNIEnv();
     env->CallVoidMethod(mDatabase, method_endSendObject, (jint)handle, (jboolean)succeeded);
 
@@ -266,6 +283,8 @@ void MtpDatabase::endSendObject(MtpObjectHandle handle, bool succeeded) {
 
 void MtpDatabase::rescanFile(const char* path, MtpObjectHandle handle,
                                   MtpObjectFormat format) {
+    mThumbnailInfoCache.erase(handle);
+
     JNIEnv* env = AndroidRuntime::getJNIEnv();
     jstring pathStr = env->NewStringUTF(path);
     env->CallVoidMethod(mDatabase, method_rescanFile, pathStr,
@@ -866,6 +885,20 @@ MtpResponseCode MtpDatabase::getObjectInfo(MtpObjectHandle handle,
     info.mName = strdup(temp);
     env->ReleaseCharArrayElements(mStringBuffer, str, 0);
 
+    // Reuse previously parsed thumbnail information if the object is unchanged.
+    std::map<MtpObjectHandle, ThumbnailInfo>::iterator cached =
+            mThumbnailInfoCache.find(handle);
+    if (cached != mThumbnailInfoCache.end()
+            && cached->second.dateModified == (int64_t)info.mDateModified) {
+        info.mThumbCompressedSize = cached->second.thumbCompressedSize;
+        info.mThumbFormat = cached->second.thumbFormat;
+        info.mImagePixWidth = cached->second.imagePixWidth;
+        info.mImagePixHeight = cached->second.imagePixHeight;
+
+        checkAndClearExceptionFromCallback(env, __FUNCTION__);
+        return MTP_RESPONSE_OK;
+    }
+
     // read EXIF data for thumbnail information
     switch (info.mFormat) {
         case MTP_FORMAT_EXIF_JPEG:
@@ -919,6 +952,14 @@ MtpResponseCode MtpDatabase::getObjectInfo(MtpObjectHandle handle,
         }
     }
 
+    ThumbnailInfo entry;
+    entry.dateModified = (int64_t)info.mDateModified;
+    entry.thumbCompressedSize = info.mThumbCompressedSize;
+    entry.thumbFormat = info.mThumbFormat;
+    entry.imagePixWidth = info.mImagePixWidth;
+    entry.imagePixHeight = info.mImagePixHeight;
+    mThumbnailInfoCache[handle] = entry;
+
     checkAndClearExceptionFromCallback(env, __FUNCTION__);
     return MTP_RESPONSE_OK;
 }
@@ -1028,6 +1069,8 @@ MtpResponseCode MtpDatabase::beginDeleteObject(MtpObjectHandle handle) {
 }
 
 void MtpDatabase::endDeleteObject(MtpObjectHandle handle, bool succeeded) {
+    mThumbnailInfoCache.erase(handle);
+
     JNIEnv* env = AndroidRuntime::getJNIEnv();
     env->CallVoidMethod(mDatabase, method_endDeleteObject, (jint)handle, (jboolean) succeeded);
 
@@ -18,6 +18,9 @@
 #define LOG_TAG "SoundPool"
 
 #include <inttypes.h>
+#include <sys/stat.h>
+
+#include <map>
 
 #include <utils/Log.h>
 
@@ -660,12 +663,121 @@ static status_t decode(int fd, int64_t offset, int64_t length,
     return UNKNOWN_ERROR;
 }
 
+// ----------------------------------------------------------------------------
+// Decoded sample cache
+//
+// Apps commonly tear down and recreate SoundPool instances that load the same
+// short effects. Decoded PCM is remembered process-wide, keyed on the identity
+// of the underlying file (device, inode, modification time) plus the byte
+// range, so reloading an unchanged sample reuses the memory instead of running
+// the codec again. Heaps are shared read-only between the cache and samples.
+
+struct DecodedSampleKey {
+    dev_t   dev;
+    ino_t   ino;
+    int64_t mtime;   // seconds and nanoseconds folded together
+    int64_t offset;
+    int64_t length;
+
+    bool operator<(const DecodedSampleKey& other) const {
+        if (dev != other.dev) return dev < other.dev;
+        if (ino != other.ino) return ino < other.ino;
+        if (mtime != other.mtime) return mtime < other.mtime;
+        if (offset != other.offset) return offset < other.offset;
+        return length < other.length;
+    }
+};
+
+struct DecodedSampleEntry {
+    sp<MemoryHeapBase> heap;
+    size_t          size;
+    uint32_t        sampleRate;
+    int             numChannels;
+    audio_format_t  format;
+    uint64_t        lastUse;
+};
+
+static const size_t kDecodedCacheMaxBytes = 16 * 1024 * 1024;
+
+static Mutex sDecodedCacheLock;
+static std::map<DecodedSampleKey, DecodedSampleEntry> sDecodedCache;
+static size_t sDecodedCacheBytes;
+static uint64_t sDecodedCacheUseCounter;
+
+static bool makeDecodedSampleKey(int fd, int64_t offset, int64_t length,
+        DecodedSampleKey* key) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return false;
+    }
+    key->dev = st.st_dev;
+    key->ino = st.st_ino;
+    key->mtime = int64_t(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    key->offset = offset;
+    key->length = length;
+    return true;
+}
+
+static bool getDecodedSample(const DecodedSampleKey& key, DecodedSampleEntry* entry) {
+    Mutex::Autolock lock(&sDecodedCacheLock);
+    std::map<DecodedSampleKey, DecodedSampleEntry>::iterator it = sDecodedCache.find(key);
+    if (it == sDecodedCache.end()) {
+        return false;
+    }
+    it->second.lastUse = ++sDecodedCacheUseCounter;
+    *entry = it->second;
+    return true;
+}
+
+static void putDecodedSample(const DecodedSampleKey& key, const DecodedSampleEntry& entry) {
+    Mutex::Autolock lock(&sDecodedCacheLock);
+    if (entry.size > kDecodedCacheMaxBytes || sDecodedCache.count(key) != 0) {
+        return;
+    }
+    // evict least recently used entries until the new one fits
+    while (sDecodedCacheBytes + entry.size > kDecodedCacheMaxBytes && !sDecodedCache.empty()) {
+        std::map<DecodedSampleKey, DecodedSampleEntry>::iterator lru = sDecodedCache.begin();
+        for (std::map<DecodedSampleKey, DecodedSampleEntry>::iterator it = sDecodedCache.begin();
+                it != sDecodedCache.end(); ++it) {
+            if (it->second.lastUse < lru->second.lastUse) {
+                lru = it;
+            }
+        }
+        sDecodedCacheBytes -= lru->second.size;
+        sDecodedCache.erase(lru);
+    }
+    DecodedSampleEntry& stored = sDecodedCache[key];
+    stored = entry;
+    stored.lastUse = ++sDecodedCacheUseCounter;
+    sDecodedCacheBytes += entry.size;
+}
+
 status_t Sample::doLoad()
 {
     uint32_t sampleRate;
     int numChannels;
     audio_format_t format;
     status_t status;
+
+    DecodedSampleKey cacheKey;
+    bool haveCacheKey = makeDecodedSampleKey(mFd, mOffset, mLength, &cacheKey);
+    if (haveCacheKey) {
+        DecodedSampleEntry cached;
+        if (getDecodedSample(cacheKey, &cached)) {
+            ALOGV("reusing cached decode");
+            ::close(mFd);
+            mFd = -1;
+            mHeap = cached.heap;
+            mSize = cached.size;
+            mData = new MemoryBase(mHeap, 0, mSize);
+            mSampleRate = cached.sampleRate;
+            mNumChannels = cached.numChannels;
+            mFormat = cached.format;
+            mState = READY;
+            return NO_ERROR;
+        }
+    }
+
     mHeap = new MemoryHeapBase(kDefaultHeapSize);
 
     ALOGV("Start decode");
@@ -698,6 +810,17 @@ status_t Sample::doLoad()
     mNumChannels = numChannels;
     mFormat = format;
     mState = READY;
+
+    if (haveCacheKey) {
+        DecodedSampleEntry entry;
+        entry.heap = mHeap;
+        entry.size = mSize;
+        entry.sampleRate = sampleRate;
+        entry.numChannels = numChannels;
+        entry.format = format;
+        entry.lastUse = 0;
+        putDecodedSample(cacheKey, entry);
+    }
     return NO_ERROR;
 
 error:
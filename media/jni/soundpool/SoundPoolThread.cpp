@@ -18,6 +18,8 @@
 #define LOG_TAG "SoundPoolThread"
 #include "utils/Log.h"
 
+#include <unistd.h>
+
 #include "SoundPoolThread.h"
 
 namespace android {
@@ -31,7 +33,7 @@ void SoundPoolThread::write(SoundPoolMsg msg) {
     // if thread is quitting, don't add to queue
     if (mRunning) {
         mMsgQueue.push(msg);
-        mCondition.signal();
+        mCondition.broadcast();
     }
 }
 
@@ -42,7 +44,7 @@ const SoundPoolMsg SoundPoolThread::read() {
     }
     SoundPoolMsg msg = mMsgQueue[0];
     mMsgQueue.removeAt(0);
-    mCondition.signal();
+    mCondition.broadcast();
     return msg;
 }
 
@@ -51,18 +53,36 @@ void SoundPoolThread::quit() {
     if (mRunning) {
         mRunning = false;
         mMsgQueue.clear();
-        mMsgQueue.push(SoundPoolMsg(SoundPoolMsg::KILL, 0));
-        mCondition.signal();
-        mCondition.wait(mLock);
+        // one KILL per worker, each worker consumes exactly one
+        for (int i = 0; i < mNumThreads; i++) {
+            mMsgQueue.push(SoundPoolMsg(SoundPoolMsg::KILL, 0));
+        }
+        mCondition.broadcast();
+        while (mThreadsRunning > 0) {
+            mCondition.wait(mLock);
+        }
     }
     ALOGV("return from quit");
 }
 
 SoundPoolThread::SoundPoolThread(SoundPool* soundPool) :
-    mSoundPool(soundPool)
+    mSoundPool(soundPool),
+    mNumThreads(0),
+    mThreadsRunning(0),
+    mRunning(false)
 {
     mMsgQueue.setCapacity(maxMessages);
-    if (createThreadEtc(beginThread, this, "SoundPoolThread")) {
+
+    long numCores = sysconf(_SC_NPROCESSORS_ONLN);
+    int numThreads = numCores < 1 ? 1 : (numCores > maxThreads ? maxThreads : (int)numCores);
+    for (int i = 0; i < numThreads; i++) {
+        if (createThreadEtc(beginThread, this, "SoundPoolThread")) {
+            mNumThreads++;
+        }
+    }
+    Mutex::Autolock lock(&mLock);
+    mThreadsRunning = mNumThreads;
+    if (mNumThreads > 0) {
         mRunning = true;
     }
 }
@@ -86,6 +106,11 @@ int SoundPoolThread::run() {
         switch (msg.mMessageType) {
         case SoundPoolMsg::KILL:
             ALOGV("goodbye");
+            {
+                Mutex::Autolock lock(&mLock);
+                mThreadsRunning--;
+                mCondition.broadcast();
+            }
             return NO_ERROR;
         case SoundPoolMsg::LOAD_SAMPLE:
             doLoadSample(msg.mData);
@@ -36,7 +36,9 @@ public:
 };
 
 /*
- * This class handles background requests from the SoundPool
+ * This class handles background requests from the SoundPool. Samples are
+ * decoded by a small pool of worker threads sized to the number of cores,
+ * so a burst of load() calls doesn't serialize behind a single decoder.
  */
 class SoundPoolThread {
 public:
@@ -48,6 +50,7 @@ public:
 
 private:
     static const size_t maxMessages = 128;
+    static const int maxThreads = 4;
 
     static int beginThread(void* arg);
     int run();
@@ -58,6 +61,8 @@ private:
     Condition               mCondition;
     Vector<SoundPoolMsg>    mMsgQueue;
     SoundPool*              mSoundPool;
+    int                     mNumThreads;
+    int                     mThreadsRunning;
     bool                    mRunning;
 };
 
@@ -212,3 +212,35 @@ int AAsset_isAllocated(AAsset* asset)
 {
     return asset->mAsset->isAllocated() ? 1 : 0;
 }
+
+int AAsset_advise(AAsset* asset, int mode)
+{
+    Asset::AccessMode amMode;
+    switch (mode) {
+    case AASSET_MODE_UNKNOWN:
+        amMode = Asset::ACCESS_UNKNOWN;
+        break;
+    case AASSET_MODE_RANDOM:
+        amMode = Asset::ACCESS_RANDOM;
+        break;
+    case AASSET_MODE_STREAMING:
+        amMode = Asset::ACCESS_STREAMING;
+        break;
+    case AASSET_MODE_BUFFER:
+        amMode = Asset::ACCESS_BUFFER;
+        break;
+    default:
+        return -1;
+    }
+    return asset->mAsset->advise(amMode) == NO_ERROR ? 0 : -1;
+}
+
+int AAsset_prefetch(AAsset* asset, off_t offset, off_t length)
+{
+    return asset->mAsset->prefetch(offset, length) == NO_ERROR ? 0 : -1;
+}
+
+int AAsset_prefetch64(AAsset* asset, off64_t offset, off64_t length)
+{
+    return asset->mAsset->prefetch(offset, length) == NO_ERROR ? 0 : -1;
+}
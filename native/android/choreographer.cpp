@@ -112,8 +112,10 @@ void Choreographer::postFrameCallbackDelayed(
         AChoreographer_frameCallback cb, void* data, nsecs_t delay) {
     nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
     FrameCallback callback{cb, data, now + delay};
+    bool isNewEarliest;
     {
         AutoMutex _l{mLock};
+        isNewEarliest = mCallbacks.empty() || callback.dueTime < mCallbacks.top().dueTime;
         mCallbacks.push(callback);
     }
     if (callback.dueTime <= now) {
@@ -123,7 +125,10 @@ void Choreographer::postFrameCallbackDelayed(
         } else {
             scheduleVsync();
         }
-    } else {
+    } else if (isNewEarliest) {
+        // One pending wakeup covers the whole queue: it fires for the earliest
+        // callback, and the dispatch and scheduling paths re-arm it for the
+        // next head. Callbacks due later don't need messages of their own.
         Message m{MSG_SCHEDULE_CALLBACKS};
         mLooper->sendMessageDelayed(delay, this, m);
     }
@@ -131,11 +136,19 @@ void Choreographer::postFrameCallbackDelayed(
 
 void Choreographer::scheduleCallbacks() {
     AutoMutex _{mLock};
+    if (mCallbacks.empty()) {
+        // Everything due was already handed off by a vsync dispatch.
+        return;
+    }
     nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
-    if (mCallbacks.top().dueTime <= now) {
+    nsecs_t dueTime = mCallbacks.top().dueTime;
+    if (dueTime <= now) {
         ALOGV("choreographer %p ~ scheduling vsync", this);
         scheduleVsync();
-        return;
+    } else {
+        // Woke up before the earliest callback is due; try again when it is.
+        Message m{MSG_SCHEDULE_CALLBACKS};
+        mLooper->sendMessageDelayed(dueTime - now, this, m);
     }
 }
 
@@ -154,6 +167,12 @@ void Choreographer::dispatchVsync(nsecs_t timestamp, int32_t id, uint32_t) {
             callbacks.push_back(mCallbacks.top());
             mCallbacks.pop();
         }
+        if (!mCallbacks.empty()) {
+            // Later callbacks were coalesced behind the dispatched head's
+            // wakeup; re-arm for the new head of the queue.
+            Message m{MSG_SCHEDULE_CALLBACKS};
+            mLooper->sendMessageDelayed(mCallbacks.top().dueTime - now, this, m);
+        }
     }
     for (const auto& cb : callbacks) {
         cb.callback(timestamp, cb.data);
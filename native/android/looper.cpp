@@ -68,6 +68,9 @@ int ALooper_pollAll(int timeoutMillis, int* outFd, int* outEvents, void** outDat
     }
 
     IPCThreadState::self()->flushCommands();
+    // Looper::pollAll gathers every ready fd from a single epoll_wait and
+    // invokes all of their callbacks before returning, so callback dispatch
+    // is already batched per wakeup rather than one fd per poll round.
     return looper->pollAll(timeoutMillis, outFd, outEvents, outData);
 }
 
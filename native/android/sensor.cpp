@@ -267,6 +267,11 @@ int ASensorEventQueue_hasEvents(ASensorEventQueue* queue) {
     return (nfd == 0) ? 0 : 1;
 }
 
+// High-rate consumers for whom the per-batch read here shows up should use a
+// direct report channel instead: ASensorManager_createSharedMemoryDirectChannel
+// (or the AHardwareBuffer variant) plus ASensorManager_configureDirectReport
+// gives a shared memory ring the HAL writes and the client reads lock-free,
+// with no queue round trip per batch.
 ssize_t ASensorEventQueue_getEvents(ASensorEventQueue* queue, ASensorEvent* events, size_t count) {
     RETURN_IF_QUEUE_IS_NULL(android::BAD_VALUE);
     if (events == nullptr) {
@@ -1319,6 +1319,117 @@ nAllocationGenerateMipmaps(JNIEnv *_env, jobject _this, jlong con, jlong alloc)
     rsAllocationGenerateMipmaps((RsContext)con, (RsAllocation)alloc);
 }
 
+// Opcodes understood by nAllocationBatchedOps. Must stay in sync with the
+// constants in android.renderscript.RenderScript. Each opcode is followed in
+// the command array by its fixed number of jlong arguments; allocation and
+// script handles are passed as-is, everything else is an integer widened to
+// jlong by the recording side.
+enum RsBatchOp {
+    RS_BATCH_OP_SYNC_ALL         = 1,  // alloc, srcLocation
+    RS_BATCH_OP_IO_SEND          = 2,  // alloc
+    RS_BATCH_OP_GENERATE_MIPMAPS = 3,  // alloc
+    RS_BATCH_OP_COPY_2D          = 4,  // dst, dstXoff, dstYoff, dstMip, dstFace,
+                                       // w, h, src, srcXoff, srcYoff, srcMip, srcFace
+    RS_BATCH_OP_COPY_3D          = 5,  // dst, dstXoff, dstYoff, dstZoff, dstMip,
+                                       // w, h, d, src, srcXoff, srcYoff, srcZoff, srcMip
+    RS_BATCH_OP_SCRIPT_INVOKE    = 6,  // script, slot
+    RS_BATCH_OP_SCRIPT_FOR_EACH  = 7,  // script, slot, ain (0 for none), aout (0 for none)
+};
+
+// Replays a sequence of recorded allocation/script operations in a single
+// JNI crossing. Only operations whose arguments are native handles or plain
+// integers can be batched; copies to or from Java arrays and bitmaps still go
+// through their individual entry points.
+static void
+nAllocationBatchedOps(JNIEnv *_env, jobject _this, jlong con, jlongArray ops)
+{
+    jsize len = _env->GetArrayLength(ops);
+    jlong *cmd = _env->GetLongArrayElements(ops, nullptr);
+    if (cmd == nullptr) {
+        ALOGE("Failed to get Java array elements");
+        return;
+    }
+    if (kLogApi) {
+        ALOGD("nAllocationBatchedOps, con(%p), len(%i)", (RsContext)con, (int)len);
+    }
+
+    jsize i = 0;
+    while (i < len) {
+        const jlong op = cmd[i];
+        const jsize remaining = len - i - 1;
+        switch (op) {
+        case RS_BATCH_OP_SYNC_ALL:
+            if (remaining < 2) goto truncated;
+            rsAllocationSyncAll((RsContext)con, (RsAllocation)cmd[i+1],
+                                (RsAllocationUsageType)cmd[i+2]);
+            i += 3;
+            break;
+        case RS_BATCH_OP_IO_SEND:
+            if (remaining < 1) goto truncated;
+            rsAllocationIoSend((RsContext)con, (RsAllocation)cmd[i+1]);
+            i += 2;
+            break;
+        case RS_BATCH_OP_GENERATE_MIPMAPS:
+            if (remaining < 1) goto truncated;
+            rsAllocationGenerateMipmaps((RsContext)con, (RsAllocation)cmd[i+1]);
+            i += 2;
+            break;
+        case RS_BATCH_OP_COPY_2D:
+            if (remaining < 12) goto truncated;
+            rsAllocationCopy2DRange((RsContext)con,
+                                    (RsAllocation)cmd[i+1],
+                                    (uint32_t)cmd[i+2], (uint32_t)cmd[i+3],
+                                    (uint32_t)cmd[i+4], (RsAllocationCubemapFace)cmd[i+5],
+                                    (uint32_t)cmd[i+6], (uint32_t)cmd[i+7],
+                                    (RsAllocation)cmd[i+8],
+                                    (uint32_t)cmd[i+9], (uint32_t)cmd[i+10],
+                                    (uint32_t)cmd[i+11], (RsAllocationCubemapFace)cmd[i+12]);
+            i += 13;
+            break;
+        case RS_BATCH_OP_COPY_3D:
+            if (remaining < 13) goto truncated;
+            rsAllocationCopy3DRange((RsContext)con,
+                                    (RsAllocation)cmd[i+1],
+                                    (uint32_t)cmd[i+2], (uint32_t)cmd[i+3],
+                                    (uint32_t)cmd[i+4], (uint32_t)cmd[i+5],
+                                    (uint32_t)cmd[i+6], (uint32_t)cmd[i+7],
+                                    (uint32_t)cmd[i+8],
+                                    (RsAllocation)cmd[i+9],
+                                    (uint32_t)cmd[i+10], (uint32_t)cmd[i+11],
+                                    (uint32_t)cmd[i+12], (uint32_t)cmd[i+13]);
+            i += 14;
+            break;
+        case RS_BATCH_OP_SCRIPT_INVOKE:
+            if (remaining < 2) goto truncated;
+            rsScriptInvoke((RsContext)con, (RsScript)cmd[i+1], (uint32_t)cmd[i+2]);
+            i += 3;
+            break;
+        case RS_BATCH_OP_SCRIPT_FOR_EACH: {
+            if (remaining < 4) goto truncated;
+            RsAllocation in_alloc = (RsAllocation)cmd[i+3];
+            rsScriptForEachMulti((RsContext)con, (RsScript)cmd[i+1], (uint32_t)cmd[i+2],
+                                 in_alloc != nullptr ? &in_alloc : nullptr,
+                                 in_alloc != nullptr ? 1 : 0,
+                                 (RsAllocation)cmd[i+4],
+                                 nullptr, 0, nullptr, 0);
+            i += 5;
+            break;
+        }
+        default:
+            ALOGE("nAllocationBatchedOps: unknown opcode %" PRId64 " at %i.",
+                  (int64_t)op, (int)i);
+            goto bail;
+        }
+    }
+    goto bail;
+
+truncated:
+    ALOGE("nAllocationBatchedOps: truncated command buffer at %i.", (int)i);
+
+bail:
+    _env->ReleaseLongArrayElements(ops, cmd, JNI_ABORT);
+}
+
 static jlong
 nAllocationCreateFromBitmap(JNIEnv *_env, jobject _this, jlong con, jlong type, jint mip,
                             jobject jbitmap, jint usage)
@@ -2895,6 +3006,7 @@ static const JNINativeMethod methods[] = {
 {"rsnAllocationGetType",             "(JJ)J",                                 (void*)nAllocationGetType},
 {"rsnAllocationResize1D",            "(JJI)V",                                (void*)nAllocationResize1D },
 {"rsnAllocationGenerateMipmaps",     "(JJ)V",                                 (void*)nAllocationGenerateMipmaps },
+{"rsnAllocationBatchedOps",          "(J[J)V",                                (void*)nAllocationBatchedOps },
 
 {"rsnAllocationAdapterCreate",       "(JJJ)J",                                (void*)nAllocationAdapterCreate },
 {"rsnAllocationAdapterOffset",       "(JJIIIIIIIII)V",                        (void*)nAllocationAdapterOffset },
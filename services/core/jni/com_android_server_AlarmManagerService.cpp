@@ -25,6 +25,7 @@
 
 #include <dirent.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/epoll.h>
@@ -41,6 +42,7 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 
 namespace android {
 
@@ -75,7 +77,8 @@ class AlarmImpl
 {
 public:
     AlarmImpl(const TimerFds &fds, int epollfd, int rtc_id) :
-        fds{fds}, epollfd{epollfd}, rtc_id{rtc_id} { }
+        fds{fds}, epollfd{epollfd}, rtc_id{rtc_id},
+        armed{}, armedDeadlines{}, rearmsProgrammed{0}, rearmsSkipped{0} { }
     ~AlarmImpl();
 
     int set(int type, struct timespec *ts);
@@ -86,6 +89,16 @@ private:
     const TimerFds fds;
     const int epollfd;
     const int rtc_id;
+
+    /* The upper layer rebatches its pending alarms often and frequently
+       re-delivers a type's head deadline unchanged; remember what each
+       timerfd is armed with so those rearms don't hit the kernel. Guarded
+       by lock: set() and waitForAlarm() run on different threads. */
+    std::mutex lock;
+    std::array<bool, ANDROID_ALARM_TYPE_COUNT> armed;
+    std::array<struct timespec, ANDROID_ALARM_TYPE_COUNT> armedDeadlines;
+    uint64_t rearmsProgrammed;
+    uint64_t rearmsSkipped;
 };
 
 AlarmImpl::~AlarmImpl()
@@ -111,11 +124,27 @@ int AlarmImpl::set(int type, struct timespec *ts)
     /* timerfd interprets 0 = disarm, so replace with a practically
        equivalent deadline of 1 ns */
 
+    std::lock_guard<std::mutex> guard(lock);
+    if (static_cast<size_t>(type) < ANDROID_ALARM_TYPE_COUNT && armed[type] &&
+            armedDeadlines[type].tv_sec == ts->tv_sec &&
+            armedDeadlines[type].tv_nsec == ts->tv_nsec) {
+        rearmsSkipped++;
+        ALOGV("skipped no-op rearm of type %d (%" PRIu64 " skipped / %" PRIu64 " programmed)",
+                type, rearmsSkipped, rearmsProgrammed);
+        return 0;
+    }
+
     struct itimerspec spec;
     memset(&spec, 0, sizeof(spec));
     memcpy(&spec.it_value, ts, sizeof(spec.it_value));
 
-    return timerfd_settime(fds[type], TFD_TIMER_ABSTIME, &spec, NULL);
+    int result = timerfd_settime(fds[type], TFD_TIMER_ABSTIME, &spec, NULL);
+    if (result == 0 && static_cast<size_t>(type) < ANDROID_ALARM_TYPE_COUNT) {
+        armed[type] = true;
+        armedDeadlines[type] = *ts;
+        rearmsProgrammed++;
+    }
+    return result;
 }
 
 int AlarmImpl::setTime(struct timeval *tv)
@@ -191,6 +220,11 @@ int AlarmImpl::waitForAlarm()
             }
         } else {
             result |= (1 << alarm_idx);
+            if (alarm_idx < ANDROID_ALARM_TYPE_COUNT) {
+                // The timerfd disarmed itself by firing.
+                std::lock_guard<std::mutex> guard(lock);
+                armed[alarm_idx] = false;
+            }
         }
     }
 
@@ -25,6 +25,7 @@
 #include <android/hardware/thermal/1.0/IThermal.h>
 #include <utils/Log.h>
 #include <utils/String8.h>
+#include <utils/Timers.h>
 
 #include "core_jni_helpers.h"
 
@@ -64,6 +65,14 @@ static void getThermalHalLocked();
 static std::mutex gThermalHalMutex;
 static sp<IThermal> gThermalHal = nullptr;
 
+// One thermal polling pass queries several (type, source) combinations back to
+// back, and each used to make its own getTemperatures() HAL transaction for the
+// same sensor list. Cache the list briefly so a polling pass costs one
+// crossing. Guarded by gThermalHalMutex.
+static const nsecs_t kTemperatureCacheTtl = ms2ns(100);
+static hidl_vec<Temperature> gCachedTemperatures;
+static nsecs_t gCachedTemperaturesAt = -1;
+
 // struct ThermalHalDeathRecipient;
 struct ThermalHalDeathRecipient : virtual public hidl_death_recipient {
       // hidl_death_recipient interface
@@ -71,6 +80,7 @@ struct ThermalHalDeathRecipient : virtual public hidl_death_recipient {
           std::lock_guard<std::mutex> lock(gThermalHalMutex);
           ALOGE("ThermalHAL just died");
           gThermalHal = nullptr;
+          gCachedTemperaturesAt = -1;
           getThermalHalLocked();
       }
 };
@@ -149,19 +159,20 @@ static jfloatArray nativeGetFanSpeeds(JNIEnv *env, jclass /* clazz */) {
     return fanSpeeds;
 }
 
-static jfloatArray nativeGetDeviceTemperatures(JNIEnv *env, jclass /* clazz */, int type,
-                                               int source) {
-    std::lock_guard<std::mutex> lock(gThermalHalMutex);
-    getThermalHalLocked();
-    if (gThermalHal == nullptr) {
-        ALOGE("Couldn't get device temperatures because of HAL error.");
-        return env->NewFloatArray(0);
+// Returns the HAL temperature list, refreshing the cached copy if it is older
+// than kTemperatureCacheTtl. The caller must be holding gThermalHalMutex.
+static const hidl_vec<Temperature>& getTemperaturesLocked() {
+    nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+    if (gCachedTemperaturesAt >= 0 && now - gCachedTemperaturesAt < kTemperatureCacheTtl) {
+        return gCachedTemperatures;
     }
     hidl_vec<Temperature> list;
+    bool success = false;
     Return<void> ret = gThermalHal->getTemperatures(
-            [&list](ThermalStatus status, hidl_vec<Temperature> temperatures) {
+            [&list, &success](ThermalStatus status, hidl_vec<Temperature> temperatures) {
                 if (status.code == ThermalStatusCode::SUCCESS) {
                     list = std::move(temperatures);
+                    success = true;
                 } else {
                     ALOGE("Couldn't get temperatures because of HAL error: %s",
                           status.debugMessage.c_str());
@@ -172,6 +183,23 @@ static jfloatArray nativeGetDeviceTemperatures(JNIEnv *env, jclass /* clazz */,
         ALOGE("getDeviceTemperatures failed status: %s", ret.description().c_str());
     }
 
+    gCachedTemperatures = std::move(list);
+    // Only start the TTL on a successful query; errors stay uncached so the
+    // next call retries the HAL.
+    gCachedTemperaturesAt = success ? now : -1;
+    return gCachedTemperatures;
+}
+
+static jfloatArray nativeGetDeviceTemperatures(JNIEnv *env, jclass /* clazz */, int type,
+                                               int source) {
+    std::lock_guard<std::mutex> lock(gThermalHalMutex);
+    getThermalHalLocked();
+    if (gThermalHal == nullptr) {
+        ALOGE("Couldn't get device temperatures because of HAL error.");
+        return env->NewFloatArray(0);
+    }
+    const hidl_vec<Temperature>& list = getTemperaturesLocked();
+
     jfloat values[list.size()];
     size_t length = 0;
     for (size_t i = 0; i < list.size(); ++i) {
@@ -7,6 +7,7 @@
 #include "AaptUtil.h"
 #include "Main.h"
 #include "ResourceFilter.h"
+#include "WorkQueue.h"
 
 #include <utils/misc.h>
 #include <utils/SortedVector.h>
@@ -15,6 +16,8 @@
 #include <dirent.h>
 #include <errno.h>
 
+#include <algorithm>
+
 static const char* kAssetDir = "assets";
 static const char* kResourceDir = "res";
 static const char* kValuesDir = "values";
@@ -62,7 +65,12 @@ const char * const gDefaultIgnoreAssets =
 // The ignore pattern that can be passed via --ignore-assets in Main.cpp
 const char * gUserIgnoreAssets = NULL;
 
-static bool isHidden(const char *root, const char *path)
+// 'type' may be passed by callers that have already stat'ed the entry to
+// avoid a redundant stat here; kFileTypeUnknown means "look it up".
+// This function must stay thread-safe: the parallel directory scanner
+// below calls it from work queue threads.
+static bool isHidden(const char *root, const char *path,
+        FileType type = kFileTypeUnknown)
 {
     // Patterns syntax:
     // - Delimiter is :
@@ -95,16 +103,23 @@ static bool isHidden(const char *root, const char *path)
     bool chatty = true;
     char *matchedPattern = NULL;
 
-    String8 fullPath(root);
-    fullPath.appendPath(path);
-    FileType type = getFileType(fullPath);
+    if (type == kFileTypeUnknown) {
+        String8 fullPath(root);
+        fullPath.appendPath(path);
+        type = getFileType(fullPath);
+    }
 
     int plen = strlen(path);
 
-    // Note: we don't have strtok_r under mingw.
-    for(char *token = strtok(patterns, delim);
-            !ignore && token != NULL;
-            token = strtok(NULL, delim)) {
+    // Note: we don't have strtok_r under mingw, and strtok keeps global
+    // state, so tokenize by hand to stay thread-safe.
+    char *nextToken = NULL;
+    for(char *token = patterns; !ignore && token != NULL; token = nextToken) {
+        nextToken = strchr(token, delim[0]);
+        if (nextToken != NULL) {
+            *nextToken++ = '\0';
+        }
+        if (token[0] == '\0') continue;
         chatty = token[0] != '!';
         if (!chatty) token++; // skip !
         if (strncasecmp(token, "<dir>" , 5) == 0) {
@@ -145,6 +160,121 @@ static bool isHidden(const char *root, const char *path)
     return ignore;
 }
 
+// =========================================================================
+
+static const size_t kScanThreads = 4;
+
+/**
+ * AaptDirScanner walks a directory tree ahead of slurpFullTree, fanning the
+ * readdir/stat work for each level of the tree out across a work queue. The
+ * slurp itself stays single-threaded and builds AaptDir/AaptGroup structures
+ * in sorted name order from this snapshot, so the resulting tree is
+ * deterministic regardless of how the scan was scheduled.
+ */
+class AaptDirScanner {
+public:
+    struct Entry {
+        String8 name;
+        FileType type;
+    };
+
+    struct ScannedDir {
+        ScannedDir() : openError(0) { }
+        int openError;          // errno from opendir, or 0 on success
+        Vector<Entry> entries;  // visible entries, sorted by name
+    };
+
+    // Scans the tree rooted at 'root' level by level; each level's
+    // directories are read and stat'ed in parallel.
+    void scan(const String8& root) {
+        Vector<String8> frontier;
+        frontier.push(root);
+        while (frontier.size() > 0) {
+            if (frontier.size() == 1) {
+                scanOneDir(frontier[0]);
+            } else {
+                WorkQueue wq(kScanThreads, false);
+                for (size_t i = 0; i < frontier.size(); i++) {
+                    ScanDirWorkUnit* w = new ScanDirWorkUnit(this, frontier[i]);
+                    if (wq.schedule(w, 0) != NO_ERROR) {
+                        delete w;
+                        scanOneDir(frontier[i]);
+                    }
+                }
+                wq.finish();
+            }
+
+            Vector<String8> next;
+            for (size_t i = 0; i < frontier.size(); i++) {
+                const ScannedDir* sd = dirFor(frontier[i]);
+                if (sd == NULL) continue;
+                for (size_t j = 0; j < sd->entries.size(); j++) {
+                    if (sd->entries[j].type == kFileTypeDirectory) {
+                        next.push(frontier[i].appendPathCopy(sd->entries[j].name));
+                    }
+                }
+            }
+            frontier = next;
+        }
+    }
+
+    // Returns the snapshot for 'path', or NULL if it wasn't scanned.
+    const ScannedDir* dirFor(const String8& path) const {
+        ssize_t i = mDirs.indexOfKey(path);
+        return i >= 0 ? &mDirs.valueAt(i) : NULL;
+    }
+
+private:
+    static bool compareEntries(const Entry& a, const Entry& b) {
+        return a.name < b.name;
+    }
+
+    class ScanDirWorkUnit : public WorkQueue::WorkUnit {
+    public:
+        ScanDirWorkUnit(AaptDirScanner* scanner, const String8& path)
+            : mScanner(scanner), mPath(path) { }
+        virtual bool run() {
+            mScanner->scanOneDir(mPath);
+            return true;
+        }
+    private:
+        AaptDirScanner* mScanner;
+        String8 mPath;
+    };
+
+    void scanOneDir(const String8& path) {
+        ScannedDir sd;
+
+        DIR* dir = opendir(path.string());
+        if (dir == NULL) {
+            sd.openError = errno;
+        } else {
+            struct dirent* entry;
+            while ((entry = readdir(dir)) != NULL) {
+                Entry e;
+                e.name = String8(entry->d_name);
+                e.type = getFileType(path.appendPathCopy(e.name).string());
+                if (isHidden(path.string(), e.name.string(), e.type)) {
+                    continue;
+                }
+                sd.entries.add(e);
+            }
+            closedir(dir);
+
+            // Sort by name so the slurp is deterministic; readdir order
+            // depends on the filesystem.
+            std::sort(sd.entries.editArray(), sd.entries.editArray() + sd.entries.size(),
+                    compareEntries);
+        }
+
+        Mutex::Autolock lock(mLock);
+        mDirs.add(path, sd);
+    }
+
+    Mutex mLock;
+    KeyedVector<String8, ScannedDir> mDirs;
+};
+
 // =========================================================================
 // =========================================================================
 // =========================================================================
@@ -655,10 +785,33 @@ status_t AaptDir::addLeafFile(const String8& leafName, const sp<AaptFile>& file,
 
 ssize_t AaptDir::slurpFullTree(Bundle* bundle, const String8& srcDir,
                             const AaptGroupEntry& kind, const String8& resType,
-                            sp<FilePathStore>& fullResPaths, const bool overwrite)
+                            sp<FilePathStore>& fullResPaths, const bool overwrite,
+                            const AaptDirScanner* scanner)
 {
     Vector<String8> fileNames;
-    {
+    Vector<FileType> fileTypes;
+    const AaptDirScanner::ScannedDir* scanned =
+            scanner != NULL ? scanner->dirFor(srcDir) : NULL;
+    if (scanned != NULL) {
+        /*
+         * Use the pre-scanned snapshot of this directory; the scanner has
+         * already filtered hidden entries and stat'ed everything.
+         */
+        if (scanned->openError != 0) {
+            fprintf(stderr, "ERROR: opendir(%s): %s\n", srcDir.string(),
+                    strerror(scanned->openError));
+            return UNKNOWN_ERROR;
+        }
+        for (size_t i = 0; i < scanned->entries.size(); i++) {
+            fileNames.add(scanned->entries[i].name);
+            fileTypes.add(scanned->entries[i].type);
+            // Add fully qualified path for dependency purposes
+            // if we're collecting them
+            if (fullResPaths != NULL) {
+                fullResPaths->add(srcDir.appendPathCopy(scanned->entries[i].name));
+            }
+        }
+    } else {
         DIR* dir = NULL;
 
         dir = opendir(srcDir.string());
@@ -682,6 +835,7 @@ ssize_t AaptDir::slurpFullTree(Bundle* bundle, const String8& srcDir,
 
             String8 name(entry->d_name);
             fileNames.add(name);
+            fileTypes.add(getFileType(srcDir.appendPathCopy(name).string()));
             // Add fully qualified path for dependency purposes
             // if we're collecting them
             if (fullResPaths != NULL) {
@@ -700,10 +854,9 @@ ssize_t AaptDir::slurpFullTree(Bundle* bundle, const String8& srcDir,
     size_t i;
     for (i = 0; i < N; i++) {
         String8 pathName(srcDir);
-        FileType type;
 
         pathName.appendPath(fileNames[i].string());
-        type = getFileType(pathName.string());
+        FileType type = fileTypes[i];
         if (type == kFileTypeDirectory) {
             sp<AaptDir> subdir;
             bool notAdded = false;
@@ -714,7 +867,7 @@ ssize_t AaptDir::slurpFullTree(Bundle* bundle, const String8& srcDir,
                 notAdded = true;
             }
             ssize_t res = subdir->slurpFullTree(bundle, pathName, kind,
-                                                resType, fullResPaths, overwrite);
+                                                resType, fullResPaths, overwrite, scanner);
             if (res < NO_ERROR) {
                 return res;
             }
@@ -1006,8 +1159,10 @@ ssize_t AaptAssets::slurpFromArgs(Bundle* bundle)
         String8 assetRoot(assetDirs[i]);
         sp<AaptDir> assetAaptDir = makeDir(String8(kAssetDir));
         AaptGroupEntry group;
+        AaptDirScanner scanner;
+        scanner.scan(assetRoot);
         count = assetAaptDir->slurpFullTree(bundle, assetRoot, group,
-                                            String8(), mFullAssetPaths, true);
+                                            String8(), mFullAssetPaths, true, &scanner);
         if (count < 0) {
             totalCount = count;
             goto bail;
@@ -1081,11 +1236,13 @@ ssize_t AaptAssets::slurpFromArgs(Bundle* bundle)
             printf("Processing raw dir '%s'\n", (const char*) assetDir);
 
         /*
-         * Do a recursive traversal of subdir tree.  We don't make any
-         * guarantees about ordering, so we're okay with an inorder search
-         * using whatever order the OS happens to hand back to us.
+         * Do a recursive traversal of subdir tree. The scanner reads and
+         * stats each level of the tree in parallel ahead of the slurp.
          */
-        count = slurpFullTree(bundle, assetRoot, AaptGroupEntry(), String8(), mFullAssetPaths);
+        AaptDirScanner scanner;
+        scanner.scan(assetRoot);
+        count = slurpFullTree(bundle, assetRoot, AaptGroupEntry(), String8(), mFullAssetPaths,
+                false, &scanner);
         if (count < 0) {
             /* failure; report error and remove archive */
             totalCount = count;
@@ -1118,9 +1275,11 @@ ssize_t AaptAssets::slurpFullTree(Bundle* bundle, const String8& srcDir,
                                     const AaptGroupEntry& kind,
                                     const String8& resType,
                                     sp<FilePathStore>& fullResPaths,
-                                    const bool overwrite)
+                                    const bool overwrite,
+                                    const AaptDirScanner* scanner)
 {
-    ssize_t res = AaptDir::slurpFullTree(bundle, srcDir, kind, resType, fullResPaths, overwrite);
+    ssize_t res = AaptDir::slurpFullTree(bundle, srcDir, kind, resType, fullResPaths, overwrite,
+            scanner);
     if (res > 0) {
         mGroupEntries.add(kind);
     }
@@ -1132,6 +1291,11 @@ ssize_t AaptAssets::slurpResourceTree(Bundle* bundle, const String8& srcDir)
 {
     ssize_t err = 0;
 
+    // Pre-scan the whole res tree so the per-config slurps below read from
+    // an in-memory snapshot instead of hitting the filesystem serially.
+    AaptDirScanner scanner;
+    scanner.scan(srcDir);
+
     DIR* dir = opendir(srcDir.string());
     if (dir == NULL) {
         fprintf(stderr, "ERROR: opendir(%s): %s\n", srcDir.string(), strerror(errno));
@@ -1182,7 +1346,7 @@ ssize_t AaptAssets::slurpResourceTree(Bundle* bundle, const String8& srcDir)
         if (type == kFileTypeDirectory) {
             sp<AaptDir> dir = makeDir(resType);
             ssize_t res = dir->slurpFullTree(bundle, subdirName, group,
-                                                resType, mFullResPaths);
+                                                resType, mFullResPaths, false, &scanner);
             if (res < 0) {
                 count = res;
                 goto bail;
@@ -136,6 +136,7 @@ inline int strictly_order_type(const AaptGroupEntry& lhs, const AaptGroupEntry&
     return compare_type(lhs, rhs) < 0;
 }
 
+class AaptDirScanner;
 class AaptGroup;
 class FilePathStore;
 
@@ -288,12 +289,15 @@ private:
     status_t addLeafFile(const String8& leafName,
                          const sp<AaptFile>& file,
                          const bool overwrite=false);
+    // If 'scanner' is non-NULL, directory listings and file types are taken
+    // from its pre-scanned snapshot instead of hitting the filesystem.
     virtual ssize_t slurpFullTree(Bundle* bundle,
                                   const String8& srcDir,
                                   const AaptGroupEntry& kind,
                                   const String8& resType,
                                   sp<FilePathStore>& fullResPaths,
-                                  const bool overwrite=false);
+                                  const bool overwrite=false,
+                                  const AaptDirScanner* scanner=NULL);
 
     String8 mLeaf;
     String8 mPath;
@@ -590,7 +594,8 @@ private:
                                   const AaptGroupEntry& kind,
                                   const String8& resType,
                                   sp<FilePathStore>& fullResPaths,
-                                  const bool overwrite=false);
+                                  const bool overwrite=false,
+                                  const AaptDirScanner* scanner=NULL);
 
     ssize_t slurpResourceTree(Bundle* bundle, const String8& srcDir);
     ssize_t slurpResourceZip(Bundle* bundle, const char* filename);
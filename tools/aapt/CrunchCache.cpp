@@ -5,6 +5,11 @@
 // This file defines functions laid out and documented in
 // CrunchCache.h
 
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
 #include <utils/Compat.h>
 #include <utils/Vector.h>
 #include <utils/String8.h>
@@ -13,31 +18,72 @@
 #include "FileFinder.h"
 #include "CacheUpdater.h"
 #include "CrunchCache.h"
+#include "WorkQueue.h"
 
 using namespace android;
 
+static const size_t MAX_THREADS = 4;
+
+const char* CrunchCache::kDigestIndexFileName = "crunch.digests";
+
+namespace {
+
+/** CrunchImageWorkUnit
+ * Runs a single processImage call on the work queue. Image processing is
+ * isolated per file, and SystemCacheUpdater's directory creation tolerates
+ * concurrent mkdir of the same path, so units are safe to run in parallel.
+ */
+class CrunchImageWorkUnit : public WorkQueue::WorkUnit {
+public:
+    CrunchImageWorkUnit(CacheUpdater* cu, const String8& source, const String8& dest)
+        : mCacheUpdater(cu), mSource(source), mDest(dest) {
+    }
+
+    virtual bool run() {
+        mCacheUpdater->processImage(mSource, mDest);
+        return true;
+    }
+
+private:
+    CacheUpdater* mCacheUpdater;
+    String8 mSource;
+    String8 mDest;
+};
+
+} // namespace
+
 CrunchCache::CrunchCache(String8 sourcePath, String8 destPath, FileFinder* ff)
-    : mSourcePath(sourcePath), mDestPath(destPath), mSourceFiles(0), mDestFiles(0), mFileFinder(ff)
+    : mSourcePath(sourcePath), mDestPath(destPath), mSourceFiles(0), mDestFiles(0),
+      mOldDigests(0), mFileFinder(ff)
 {
     // We initialize the default value to return to 0 so if a file doesn't exist
-    // then all files are automatically "newer" than it.
+    // then all files are automatically "newer" than it. Similarly a missing
+    // digest index entry reads as 0, which never matches a real digest.
 
     // Set file extensions to look for. Right now just pngs.
     mExtensions.push(String8(".png"));
 
     // Load files into our data members
     loadFiles();
+
+    // Load the content digests recorded by the previous crunch, if any.
+    loadDigestIndex();
 }
 
 size_t CrunchCache::crunch(CacheUpdater* cu, bool forceOverwrite)
 {
     size_t numFilesUpdated = 0;
 
+    mNewDigests.clear();
+
     // Iterate through the source files and compare to cache.
-    // After processing a file, remove it from the source files and
-    // from the dest files.
+    // After examining a file, remove it from the source files and
+    // from the dest files. Files that need re-crunching are queued up
+    // and processed in parallel once the full list is known.
     // We're done when we're out of files in source.
     String8 relativePath;
+    Vector<String8> staleSources;
+    Vector<String8> staleDests;
     while (mSourceFiles.size() > 0) {
         // Get the full path to the source file, then convert to a c-string
         // and offset our beginning pointer to the length of the sourcePath
@@ -51,11 +97,15 @@ size_t CrunchCache::crunch(CacheUpdater* cu, bool forceOverwrite)
             offset = 1;
         relativePath = String8(rPathPtr + offset);
 
-        if (forceOverwrite || needsUpdating(relativePath)) {
-            cu->processImage(mSourcePath.appendPathCopy(relativePath),
-                             mDestPath.appendPathCopy(relativePath));
+        uint64_t sourceDigest = digestFile(mSourceFiles.keyAt(0));
+        if (sourceDigest != 0) {
+            mNewDigests.add(relativePath, sourceDigest);
+        }
+
+        if (forceOverwrite || needsUpdating(relativePath, sourceDigest)) {
+            staleSources.push(mSourcePath.appendPathCopy(relativePath));
+            staleDests.push(mDestPath.appendPathCopy(relativePath));
             numFilesUpdated++;
-            // crunchFile(relativePath);
         }
         // Delete this file from the source files and (if it exists) from the
         // dest files.
@@ -63,12 +113,34 @@ size_t CrunchCache::crunch(CacheUpdater* cu, bool forceOverwrite)
         mDestFiles.removeItem(mDestPath.appendPathCopy(relativePath));
     }
 
+    // Re-crunch the stale files, fanning out across the work queue when
+    // there's more than one.
+    const size_t numStale = staleSources.size();
+    if (numStale == 1) {
+        cu->processImage(staleSources[0], staleDests[0]);
+    } else if (numStale > 1) {
+        WorkQueue wq(MAX_THREADS, false);
+        for (size_t i = 0; i < numStale; i++) {
+            CrunchImageWorkUnit* w = new CrunchImageWorkUnit(cu, staleSources[i], staleDests[i]);
+            if (wq.schedule(w) != NO_ERROR) {
+                // Queue is wedged; fall back to crunching inline.
+                delete w;
+                cu->processImage(staleSources[i], staleDests[i]);
+            }
+        }
+        wq.finish();
+    }
+
     // Iterate through what's left of destFiles and delete leftovers
     while (mDestFiles.size() > 0) {
         cu->deleteFile(mDestFiles.keyAt(0));
         mDestFiles.removeItemsAt(0);
     }
 
+    // Record the digests we saw so the next build can skip unchanged
+    // content regardless of modification times.
+    writeDigestIndex();
+
     // Update our knowledge of the files cache
     // both source and dest should be empty by now.
     loadFiles();
@@ -94,12 +166,110 @@ void CrunchCache::loadFiles()
     delete dw;
 }
 
-bool CrunchCache::needsUpdating(const String8& relativePath) const
+bool CrunchCache::needsUpdating(const String8& relativePath, uint64_t sourceDigest) const
 {
-    // Retrieve modification dates for this file entry under the source and
-    // cache directory trees. The vectors will return a modification date of 0
-    // if the file doesn't exist.
-    time_t sourceDate = mSourceFiles.valueFor(mSourcePath.appendPathCopy(relativePath));
+    // A file missing from the cache always needs crunching. The vector
+    // returns a modification date of 0 if the file doesn't exist.
     time_t destDate = mDestFiles.valueFor(mDestPath.appendPathCopy(relativePath));
+    if (destDate == 0) {
+        return true;
+    }
+
+    // When we know the source content digest, compare it against the one
+    // recorded when the cached copy was produced. This is immune to the
+    // mtime churn of fresh checkouts. A missing index entry reads as 0 and
+    // falls through to the mtime comparison below.
+    if (sourceDigest != 0) {
+        uint64_t oldDigest = mOldDigests.valueFor(relativePath);
+        if (oldDigest != 0) {
+            return sourceDigest != oldDigest;
+        }
+    }
+
+    // Retrieve the modification date for this file entry under the source
+    // tree and compare against the cached copy.
+    time_t sourceDate = mSourceFiles.valueFor(mSourcePath.appendPathCopy(relativePath));
     return sourceDate > destDate;
 }
+
+uint64_t CrunchCache::digestFile(const String8& path)
+{
+    FILE* fin = fopen(path.string(), "rb");
+    if (fin == NULL) {
+        return 0;
+    }
+
+    // 64-bit FNV-1a. Plenty for change detection; we're not defending
+    // against adversarial collisions in our own resource tree.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint8_t buf[4096];
+    size_t bytesRead;
+    while ((bytesRead = fread(buf, 1, sizeof(buf), fin)) > 0) {
+        for (size_t i = 0; i < bytesRead; i++) {
+            hash = (hash ^ buf[i]) * 0x100000001b3ULL;
+        }
+    }
+    bool ok = !ferror(fin);
+    fclose(fin);
+    if (!ok) {
+        return 0;
+    }
+    // Reserve 0 to mean "no digest available".
+    return hash != 0 ? hash : 1;
+}
+
+void CrunchCache::loadDigestIndex()
+{
+    mOldDigests.clear();
+
+    String8 indexPath = mDestPath.appendPathCopy(kDigestIndexFileName);
+    FILE* fin = fopen(indexPath.string(), "r");
+    if (fin == NULL) {
+        return;
+    }
+
+    // One entry per line: "<16 hex digest> <path relative to source root>".
+    char line[1024];
+    while (fgets(line, sizeof(line), fin) != NULL) {
+        char* sep = strchr(line, ' ');
+        if (sep == NULL) {
+            continue;
+        }
+        *sep = '\0';
+        uint64_t digest = strtoull(line, NULL, 16);
+        if (digest == 0) {
+            continue;
+        }
+        char* path = sep + 1;
+        size_t len = strlen(path);
+        while (len > 0 && (path[len - 1] == '\n' || path[len - 1] == '\r')) {
+            path[--len] = '\0';
+        }
+        if (len > 0) {
+            mOldDigests.add(String8(path), digest);
+        }
+    }
+    fclose(fin);
+}
+
+void CrunchCache::writeDigestIndex() const
+{
+    // The index is an optimization; if we can't write it the next build is
+    // just slower, so failures here are not fatal. Don't drop an index file
+    // into a destination directory we never wrote anything else to.
+    if (mNewDigests.size() == 0) {
+        return;
+    }
+
+    String8 indexPath = mDestPath.appendPathCopy(kDigestIndexFileName);
+    FILE* fout = fopen(indexPath.string(), "w");
+    if (fout == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < mNewDigests.size(); i++) {
+        fprintf(fout, "%016" PRIx64 " %s\n", mNewDigests.valueAt(i),
+                mNewDigests.keyAt(i).string());
+    }
+    fclose(fout);
+}
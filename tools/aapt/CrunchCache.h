@@ -9,6 +9,8 @@
 #ifndef CRUNCHCACHE_H
 #define CRUNCHCACHE_H
 
+#include <stdint.h>
+
 #include <utils/KeyedVector.h>
 #include <utils/String8.h>
 #include "FileFinder.h"
@@ -21,6 +23,13 @@ using namespace android;
  *  them in a mirror-cache. It's capable of doing incremental updates to its
  *  cache.
  *
+ *  Staleness is decided primarily by a content digest index stored alongside
+ *  the cache (see kDigestIndexFileName below): a source file whose digest
+ *  matches the one recorded for its cached counterpart is skipped even if its
+ *  modification time changed, which keeps fresh checkouts of unchanged trees
+ *  from re-crunching everything. When no digest is available (e.g. the index
+ *  hasn't been written yet) the old modification-time comparison is used.
+ *
  *  Usage:
  *      Create an instance initialized with the root of the source tree, the
  *      root location to store the cache files, and an instance of a file finder.
@@ -41,9 +50,10 @@ public:
      * them to the cached versions in the destPath. If the optional
      * argument forceOverwrite is set to true, then all source files are
      * re-crunched even if they have not been modified recently. Otherwise,
-     * source files are only crunched when they needUpdating. Afterwards,
+     * source files are only crunched when they needUpdating. Files that do
+     * need crunching are processed in parallel on a work queue. Afterwards,
      * we delete any leftover files in the cache that are no longer present
-     * in source.
+     * in source, and write out a refreshed digest index.
      *
      * PRECONDITIONS:
      *      No setup besides construction is needed
@@ -65,23 +75,34 @@ private:
      */
     void loadFiles();
 
-    /** needsUpdating takes a file path
-     * and returns true if the file represented by this path is newer in the
-     * sourceFiles than in the cache (mDestFiles).
+    /** needsUpdating takes a file path and the content digest of the source
+     * file (0 if it couldn't be computed) and returns true if the cached copy
+     * of the file is stale.
      *
      * PRECONDITIONS:
-     *      mSourceFiles and mDestFiles must be initialized and filled.
+     *      mSourceFiles, mDestFiles and mOldDigests must be initialized.
      * POSTCONDITIONS:
-     *      returns true if and only if source file's modification time
-     *      is greater than the cached file's mod-time. Otherwise returns false.
-     *
-     * USAGE:
-     *      Should be used something like the following:
-     *      if (needsUpdating(filePath))
-     *          // Recrunch sourceFile out to destFile.
-     *
+     *      returns true if the cached file is missing, or its recorded digest
+     *      differs from sourceDigest. When no digest information is available
+     *      on either side, falls back to returning true if and only if the
+     *      source file's modification time is greater than the cached file's
+     *      mod-time.
      */
-    bool needsUpdating(const String8& relativePath) const;
+    bool needsUpdating(const String8& relativePath, uint64_t sourceDigest) const;
+
+    /** digestFile computes a 64-bit FNV-1a digest over the contents of the
+     * file at path. Returns 0 if the file could not be read; a real digest
+     * is never 0.
+     */
+    static uint64_t digestFile(const String8& path);
+
+    // Load the digest index written by a previous crunch (if any) into
+    // mOldDigests, and write mNewDigests back out.
+    void loadDigestIndex();
+    void writeDigestIndex() const;
+
+    // Name of the digest index file, stored directly under mDestPath.
+    static const char* kDigestIndexFileName;
 
     // DATA MEMBERS ====================================================
 
@@ -95,6 +116,12 @@ private:
     DefaultKeyedVector<String8,time_t> mSourceFiles;
     DefaultKeyedVector<String8,time_t> mDestFiles;
 
+    // Source content digests keyed by path relative to the source root.
+    // mOldDigests holds the index from the previous crunch; mNewDigests is
+    // rebuilt during crunch and written back out. A missing entry reads as 0.
+    DefaultKeyedVector<String8,uint64_t> mOldDigests;
+    KeyedVector<String8,uint64_t> mNewDigests;
+
     // Pointer to a FileFinder to use
     FileFinder* mFileFinder;
 };
@@ -5,6 +5,7 @@
 #define MOCKCACHEUPDATER_H
 
 #include <utils/String8.h>
+#include <utils/threads.h>
 #include "CacheUpdater.h"
 
 using namespace android;
@@ -23,11 +24,14 @@ public:
 
     // Delete a file
     virtual void deleteFile(String8 path) {
+        Mutex::Autolock lock(mLock);
         deleteCount++;
     };
 
-    // Process an image from source out to dest
+    // Process an image from source out to dest.
+    // May be called from CrunchCache's work queue threads.
     virtual void processImage(String8 source, String8 dest) {
+        Mutex::Autolock lock(mLock);
         processCount++;
     };
 
@@ -35,6 +39,7 @@ public:
     int deleteCount;
     int processCount;
 private:
+    Mutex mLock;
 };
 
 #endif // MOCKCACHEUPDATER_H
\ No newline at end of file
@@ -20,6 +20,8 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "android-base/macros.h"
 #include "androidfw/StringPiece.h"
@@ -142,6 +144,28 @@ class SourcePathDiagnostics : public IDiagnostics {
   DISALLOW_COPY_AND_ASSIGN(SourcePathDiagnostics);
 };
 
+// Collects diagnostics in memory so that worker threads can log without interleaving their
+// messages. The buffers are replayed on the real diagnostics once the workers are joined.
+class BufferedDiagnostics : public IDiagnostics {
+ public:
+  BufferedDiagnostics() = default;
+
+  void Log(Level level, DiagMessageActual& actual_msg) override {
+    messages_.push_back(std::make_pair(level, actual_msg));
+  }
+
+  void ReplayTo(IDiagnostics* diag) {
+    for (auto& msg : messages_) {
+      diag->Log(msg.first, msg.second);
+    }
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(BufferedDiagnostics);
+
+  std::vector<std::pair<Level, DiagMessageActual>> messages_;
+};
+
 }  // namespace aapt
 
 #endif /* AAPT_DIAGNOSTICS_H */
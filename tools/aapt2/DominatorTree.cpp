@@ -48,36 +48,46 @@ bool DominatorTree::Node::TryAddChild(std::unique_ptr<Node> new_child) {
 }
 
 bool DominatorTree::Node::AddChild(std::unique_ptr<Node> new_child) {
-  bool has_dominated_children = false;
-  // Demote children dominated by the new config.
-  for (auto& child : children_) {
-    if (new_child->Dominates(child.get())) {
-      child->parent_ = new_child.get();
-      new_child->children_.push_back(std::move(child));
-      child = {};
-      has_dominated_children = true;
+  // Walk the tree iteratively. Domination chains can get long when many
+  // configurations differ in a single ordered qualifier (version, smallest
+  // width), and recursing once per level makes construction stack-bound.
+  Node* node = this;
+  while (true) {
+    bool has_dominated_children = false;
+    // Demote children dominated by the new config.
+    for (auto& child : node->children_) {
+      if (new_child->Dominates(child.get())) {
+        child->parent_ = new_child.get();
+        new_child->children_.push_back(std::move(child));
+        child = {};
+        has_dominated_children = true;
+      }
     }
-  }
-  // Remove dominated children.
-  if (has_dominated_children) {
-    children_.erase(
-        std::remove_if(children_.begin(), children_.end(),
-                       [](const std::unique_ptr<Node>& child) -> bool {
-                         return child == nullptr;
-                       }),
-        children_.end());
-  }
-  // Add the new config to a child if a child dominates the new config.
-  for (auto& child : children_) {
-    if (child->Dominates(new_child.get())) {
-      child->AddChild(std::move(new_child));
+    // Remove dominated children.
+    if (has_dominated_children) {
+      node->children_.erase(
+          std::remove_if(node->children_.begin(), node->children_.end(),
+                         [](const std::unique_ptr<Node>& child) -> bool {
+                           return child == nullptr;
+                         }),
+          node->children_.end());
+    }
+    // Descend into a child if it dominates the new config.
+    Node* dominating_child = nullptr;
+    for (auto& child : node->children_) {
+      if (child->Dominates(new_child.get())) {
+        dominating_child = child.get();
+        break;
+      }
+    }
+    if (dominating_child == nullptr) {
+      // The new config is not dominated by a child, so add it here.
+      new_child->parent_ = node;
+      node->children_.push_back(std::move(new_child));
       return true;
     }
+    node = dominating_child;
   }
-  // The new config is not dominated by a child, so add it here.
-  new_child->parent_ = this;
-  children_.push_back(std::move(new_child));
-  return true;
 }
 
 bool DominatorTree::Node::Dominates(const Node* other) const {
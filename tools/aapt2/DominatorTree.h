@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ResourceTable.h"
@@ -96,11 +97,21 @@ class DominatorTree {
     virtual void VisitConfig(Node* node) = 0;
 
    private:
+    // Post-order traversal with an explicit stack, so that deep domination
+    // chains do not recurse once per tree level.
     void VisitNode(Node* node) {
-      for (auto& child : node->children()) {
-        VisitNode(child.get());
+      std::vector<std::pair<Node*, size_t>> stack;
+      stack.emplace_back(node, 0u);
+      while (!stack.empty()) {
+        std::pair<Node*, size_t>& top = stack.back();
+        if (top.second < top.first->children().size()) {
+          Node* child = top.first->children()[top.second++].get();
+          stack.emplace_back(child, 0u);
+        } else {
+          VisitConfig(top.first);
+          stack.pop_back();
+        }
       }
-      VisitConfig(node);
     }
   };
 
@@ -149,6 +149,43 @@ TEST(DominatorTreeTest, MoreSpecificConfigurationsAreDominated) {
   EXPECT_EQ(expected, printer.ToString(&tree));
 }
 
+TEST(DominatorTreeTest, DeepVersionChainsBuildAndVisitIteratively) {
+  // Versioned configurations each dominate the next, so the tree degenerates
+  // into one long chain. Construction and the bottom-up visitor must both
+  // handle this without recursing once per level.
+  constexpr size_t kChainLength = 1000u;
+
+  std::vector<std::unique_ptr<ResourceConfigValue>> configs;
+  configs.push_back(util::make_unique<ResourceConfigValue>(ConfigDescription::DefaultConfig(), ""));
+  for (size_t i = 0; i < kChainLength; i++) {
+    ConfigDescription config;
+    config.sdkVersion = static_cast<uint16_t>(i + 2);
+    configs.push_back(util::make_unique<ResourceConfigValue>(config, ""));
+  }
+
+  DominatorTree tree(configs);
+
+  class CountingVisitor : public DominatorTree::BottomUpVisitor {
+   public:
+    void VisitConfig(DominatorTree::Node* node) override {
+      count++;
+    }
+
+    size_t count = 0;
+  } visitor;
+  tree.Accept(&visitor);
+  EXPECT_EQ(kChainLength + 1u, visitor.count);
+
+  size_t depth = 0;
+  const DominatorTree::Node* node = &tree.product_roots().begin()->second;
+  while (!node->children().empty()) {
+    EXPECT_EQ(1u, node->children().size());
+    node = node->children().front().get();
+    depth++;
+  }
+  EXPECT_EQ(kChainLength + 1u, depth);
+}
+
 TEST(DominatorTreeTest, LocalesAreNeverDominated) {
   const ConfigDescription fr_config = test::ParseConfigOrDie("fr");
   const ConfigDescription fr_rCA_config = test::ParseConfigOrDie("fr-rCA");
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResourceParser.h"
+
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "Diagnostics.h"
+#include "ResourceTable.h"
+#include "io/StringStream.h"
+#include "xml/XmlPullParser.h"
+
+using ::aapt::io::StringInputStream;
+
+namespace aapt {
+
+// Generates a <resources> document with the given number of string entries,
+// standing in for a large values file from a real app.
+static std::string BuildStringsXml(size_t count) {
+  std::stringstream ss;
+  ss << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<resources>\n";
+  for (size_t i = 0; i < count; i++) {
+    ss << "  <string name=\"string_" << i << "\">This is string number " << i << "</string>\n";
+  }
+  ss << "</resources>\n";
+  return ss.str();
+}
+
+static void BM_ResourceParserParseStrings(benchmark::State& state) {
+  const std::string input = BuildStringsXml(state.range(0));
+  StdErrDiagnostics diag;
+  while (state.KeepRunning()) {
+    ResourceTable table;
+    ResourceParser parser(&diag, &table, Source("benchmark"), ConfigDescription::DefaultConfig(),
+                          ResourceParserOptions{});
+
+    StringInputStream in(input);
+    xml::XmlPullParser xml_parser(&in);
+    parser.Parse(&xml_parser);
+  }
+}
+BENCHMARK(BM_ResourceParserParseStrings)->Range(1024, 100 * 1024);
+
+}  // namespace aapt
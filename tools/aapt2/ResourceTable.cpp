@@ -592,7 +592,26 @@ bool ResourceTable::SetOverlayableImpl(const ResourceNameRef& name, const Overla
   return true;
 }
 
+static uint64_t LookupCacheKey(const ResourceNameRef& name) {
+  const std::hash<StringPiece> hasher;
+  uint64_t hash = hasher(name.package);
+  hash = hash * 33 + static_cast<uint64_t>(name.type);
+  hash = hash * 33 + hasher(name.entry);
+  return hash;
+}
+
 Maybe<ResourceTable::SearchResult> ResourceTable::FindResource(const ResourceNameRef& name) const {
+  const uint64_t cache_key = LookupCacheKey(name);
+  const auto cache_iter = lookup_cache_.find(cache_key);
+  if (cache_iter != lookup_cache_.end()) {
+    const SearchResult& result = cache_iter->second;
+    // Guard against a hash collision; on mismatch fall through to the binary searches.
+    if (result.type->type == name.type && result.entry->name == name.entry &&
+        result.package->name == name.package) {
+      return result;
+    }
+  }
+
   ResourceTablePackage* package = FindPackage(name.package);
   if (package == nullptr) {
     return {};
@@ -607,7 +626,15 @@ Maybe<ResourceTable::SearchResult> ResourceTable::FindResource(const ResourceNam
   if (entry == nullptr) {
     return {};
   }
-  return SearchResult{package, type, entry};
+
+  // Only memoize hits: a later addition of this name must not be masked by a cached miss.
+  SearchResult result{package, type, entry};
+  lookup_cache_[cache_key] = result;
+  return result;
+}
+
+void ResourceTable::InvalidateLookupCache() {
+  lookup_cache_.clear();
 }
 
 std::unique_ptr<ResourceTable> ResourceTable::Clone() const {
@@ -233,6 +233,11 @@ class ResourceTable {
 
   Maybe<SearchResult> FindResource(const ResourceNameRef& name) const;
 
+  // Drops the memoized name-lookup cache maintained by FindResource. Must be called after
+  // removing packages, types or entries from the table, or moving entries between types;
+  // plain additions are picked up automatically.
+  void InvalidateLookupCache();
+
   // Returns the package struct with the given name, or nullptr if such a package does not
   // exist. The empty string is a valid package and typically is used to represent the
   // 'current' package before it is known to the ResourceTable.
@@ -299,6 +304,13 @@ class ResourceTable {
                           const Visibility& symbol, NameValidator name_validator,
                           IDiagnostics* diag);
 
+  // Memo of successful FindResource lookups, keyed by a hash of the full resource name and
+  // verified against the found entry on hit (a collision just falls back to the binary
+  // searches). Package, type and entry objects are individually heap-allocated, so cached
+  // pointers stay valid as the sorted vectors grow; removals must go through
+  // InvalidateLookupCache().
+  mutable std::unordered_map<uint64_t, SearchResult> lookup_cache_;
+
   DISALLOW_COPY_AND_ASSIGN(ResourceTable);
 };
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResourceTable.h"
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "android-base/stringprintf.h"
+
+#include "Diagnostics.h"
+#include "ResourceValues.h"
+#include "util/Util.h"
+
+using ::android::base::StringPrintf;
+
+namespace aapt {
+
+static std::vector<ResourceName> BuildNames(size_t count) {
+  std::vector<ResourceName> names;
+  names.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    names.push_back(ResourceName("com.app", ResourceType::kId, StringPrintf("entry_%zu", i)));
+  }
+  return names;
+}
+
+static void BM_ResourceTableAddResources(benchmark::State& state) {
+  const std::vector<ResourceName> names = BuildNames(state.range(0));
+  StdErrDiagnostics diag;
+  while (state.KeepRunning()) {
+    ResourceTable table;
+    for (const ResourceName& name : names) {
+      table.AddResource(name, ConfigDescription::DefaultConfig(), {}, util::make_unique<Id>(),
+                        &diag);
+    }
+  }
+}
+BENCHMARK(BM_ResourceTableAddResources)->Range(1024, 100 * 1024);
+
+static void BM_ResourceTableFindResource(benchmark::State& state) {
+  const std::vector<ResourceName> names = BuildNames(state.range(0));
+  StdErrDiagnostics diag;
+  ResourceTable table;
+  for (const ResourceName& name : names) {
+    table.AddResource(name, ConfigDescription::DefaultConfig(), {}, util::make_unique<Id>(),
+                      &diag);
+  }
+
+  while (state.KeepRunning()) {
+    for (const ResourceName& name : names) {
+      benchmark::DoNotOptimize(table.FindResource(name));
+    }
+  }
+}
+BENCHMARK(BM_ResourceTableFindResource)->Range(1024, 100 * 1024);
+
+}  // namespace aapt
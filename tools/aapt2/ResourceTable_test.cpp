@@ -99,6 +99,35 @@ TEST(ResourceTableTest, AddMultipleResources) {
   EXPECT_THAT(test::GetValueForConfig<BinaryPrimitive>(&table, "android:string/ok", language_config), NotNull());
 }
 
+TEST(ResourceTableTest, RepeatedLookupsAndLaterAdditionsResolve) {
+  ResourceTable table;
+
+  EXPECT_TRUE(table.AddResource(
+      test::ParseNameOrDie("android:attr/id"), ConfigDescription{}, "",
+      test::ValueBuilder<Id>().SetSource("test/path/file.xml", 23u).Build(),
+      test::GetDiagnostics()));
+
+  // A repeated lookup must resolve to the same entry (second hit is served
+  // from the memo cache).
+  auto first = table.FindResource(test::ParseNameOrDie("android:attr/id"));
+  auto second = table.FindResource(test::ParseNameOrDie("android:attr/id"));
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_THAT(second.value().entry, Eq(first.value().entry));
+
+  // A miss must not be memoized: adding the name later makes it resolvable.
+  EXPECT_FALSE(table.FindResource(test::ParseNameOrDie("android:attr/other")));
+  EXPECT_TRUE(table.AddResource(
+      test::ParseNameOrDie("android:attr/other"), ConfigDescription{}, "",
+      test::ValueBuilder<Id>().SetSource("test/path/file.xml", 24u).Build(),
+      test::GetDiagnostics()));
+  EXPECT_TRUE(table.FindResource(test::ParseNameOrDie("android:attr/other")));
+
+  // Invalidation keeps lookups working.
+  table.InvalidateLookupCache();
+  EXPECT_TRUE(table.FindResource(test::ParseNameOrDie("android:attr/id")));
+}
+
 TEST(ResourceTableTest, OverrideWeakResourceValue) {
   ResourceTable table;
 
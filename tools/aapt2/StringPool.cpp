@@ -31,6 +31,13 @@ using ::android::StringPiece;
 
 namespace aapt {
 
+namespace {
+
+// Smallest size of the open-addressing index. Must be a power of two.
+constexpr size_t kMinIndexCapacity = 64u;
+
+}  // namespace
+
 StringPool::Ref::Ref() : entry_(nullptr) {}
 
 StringPool::Ref::Ref(const StringPool::Ref& rhs) : entry_(rhs.entry_) {
@@ -171,12 +178,11 @@ StringPool::Ref StringPool::MakeRef(const StringPiece& str, const Context& conte
 
 StringPool::Ref StringPool::MakeRefImpl(const StringPiece& str, const Context& context,
                                         bool unique) {
+  const uint32_t hash = static_cast<uint32_t>(std::hash<StringPiece>()(str));
   if (unique) {
-    auto range = indexed_strings_.equal_range(str);
-    for (auto iter = range.first; iter != range.second; ++iter) {
-      if (context.priority == iter->second->context.priority) {
-        return Ref(iter->second);
-      }
+    Entry* existing = FindEntry(hash, str, context.priority);
+    if (existing != nullptr) {
+      return Ref(existing);
     }
   }
 
@@ -185,14 +191,80 @@ StringPool::Ref StringPool::MakeRefImpl(const StringPiece& str, const Context& c
   entry->context = context;
   entry->index_ = strings_.size();
   entry->ref_ = 0;
+  entry->hash_ = hash;
   entry->pool_ = this;
 
   Entry* borrow = entry.get();
   strings_.emplace_back(std::move(entry));
-  indexed_strings_.insert(std::make_pair(StringPiece(borrow->value), borrow));
+  InsertEntry(borrow);
   return Ref(borrow);
 }
 
+StringPool::Entry* StringPool::FindEntry(uint32_t hash, const StringPiece& str,
+                                         uint32_t priority) const {
+  if (index_.empty()) {
+    return nullptr;
+  }
+
+  const size_t mask = index_.size() - 1;
+  size_t slot = hash & mask;
+  while (index_[slot] != nullptr) {
+    Entry* entry = index_[slot];
+    if (entry->hash_ == hash && entry->context.priority == priority &&
+        StringPiece(entry->value) == str) {
+      return entry;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return nullptr;
+}
+
+void StringPool::InsertEntry(Entry* entry) {
+  ReserveIndex(index_size_ + 1);
+
+  const size_t mask = index_.size() - 1;
+  size_t slot = entry->hash_ & mask;
+  while (index_[slot] != nullptr) {
+    slot = (slot + 1) & mask;
+  }
+  index_[slot] = entry;
+  index_size_++;
+}
+
+void StringPool::ReserveIndex(size_t count) {
+  // Grow when the table would exceed 75% load, so probe chains stay short.
+  size_t capacity = std::max(index_.size(), kMinIndexCapacity);
+  while (count * 4 > capacity * 3) {
+    capacity *= 2;
+  }
+  if (capacity == index_.size()) {
+    return;
+  }
+
+  std::vector<Entry*> old_index = std::move(index_);
+  index_.assign(capacity, nullptr);
+  const size_t mask = capacity - 1;
+  for (Entry* entry : old_index) {
+    if (entry == nullptr) {
+      continue;
+    }
+    size_t slot = entry->hash_ & mask;
+    while (index_[slot] != nullptr) {
+      slot = (slot + 1) & mask;
+    }
+    index_[slot] = entry;
+  }
+}
+
+void StringPool::RebuildIndex() {
+  index_.clear();
+  index_size_ = 0;
+  ReserveIndex(strings_.size());
+  for (const std::unique_ptr<Entry>& entry : strings_) {
+    InsertEntry(entry.get());
+  }
+}
+
 StringPool::Ref StringPool::MakeRef(const Ref& ref) {
   if (ref.entry_->pool_ == this) {
     return ref;
@@ -254,13 +326,23 @@ void StringPool::Merge(StringPool&& pool) {
     entry->pool_ = this;
   }
 
-  // Now move the styles, strings, and indices over.
+  // Now move the styles and strings over.
+  const size_t old_string_count = strings_.size();
   std::move(pool.styles_.begin(), pool.styles_.end(), std::back_inserter(styles_));
   pool.styles_.clear();
   std::move(pool.strings_.begin(), pool.strings_.end(), std::back_inserter(strings_));
   pool.strings_.clear();
-  indexed_strings_.insert(pool.indexed_strings_.begin(), pool.indexed_strings_.end());
-  pool.indexed_strings_.clear();
+
+  // Bulk hash-join of the incoming index: make room for the combined size
+  // once, then slot the moved entries in using their precomputed hashes.
+  // No string bytes are hashed or compared, and duplicates between the two
+  // pools keep coexisting as before.
+  ReserveIndex(index_size_ + (strings_.size() - old_string_count));
+  for (size_t i = old_string_count; i < strings_.size(); i++) {
+    InsertEntry(strings_[i].get());
+  }
+  pool.index_.clear();
+  pool.index_size_ = 0;
 
   ReAssignIndices();
 }
@@ -268,19 +350,10 @@ void StringPool::Merge(StringPool&& pool) {
 void StringPool::HintWillAdd(size_t string_count, size_t style_count) {
   strings_.reserve(strings_.size() + string_count);
   styles_.reserve(styles_.size() + style_count);
+  ReserveIndex(index_size_ + string_count);
 }
 
 void StringPool::Prune() {
-  const auto iter_end = indexed_strings_.end();
-  auto index_iter = indexed_strings_.begin();
-  while (index_iter != iter_end) {
-    if (index_iter->second->ref_ <= 0) {
-      index_iter = indexed_strings_.erase(index_iter);
-    } else {
-      ++index_iter;
-    }
-  }
-
   auto end_iter2 =
       std::remove_if(strings_.begin(), strings_.end(),
                      [](const std::unique_ptr<Entry>& entry) -> bool { return entry->ref_ <= 0; });
@@ -292,9 +365,20 @@ void StringPool::Prune() {
   strings_.erase(end_iter2, strings_.end());
   styles_.erase(end_iter3, styles_.end());
 
+  // The index holds raw pointers into strings_, so rebuild it from the
+  // survivors (their hashes are stored, so nothing is re-hashed).
+  RebuildIndex();
+
   ReAssignIndices();
 }
 
+void StringPool::Clear() {
+  strings_.clear();
+  styles_.clear();
+  std::fill(index_.begin(), index_.end(), nullptr);
+  index_size_ = 0;
+}
+
 template <typename E>
 static void SortEntries(
     std::vector<std::unique_ptr<E>>& entries,
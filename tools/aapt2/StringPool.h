@@ -20,7 +20,6 @@
 #include <functional>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "android-base/macros.h"
@@ -130,6 +129,7 @@ class StringPool {
 
     size_t index_;
     int ref_;
+    uint32_t hash_;
     const StringPool* pool_;
   };
 
@@ -205,6 +205,11 @@ class StringPool {
   // Removes any strings that have no references.
   void Prune();
 
+  // Removes all strings and styles. The index allocation is retained, so a
+  // cleared pool can cheaply intern a similar set of strings again. Callers
+  // must not hold Refs across this call.
+  void Clear();
+
  private:
   DISALLOW_COPY_AND_ASSIGN(StringPool);
 
@@ -213,9 +218,29 @@ class StringPool {
   Ref MakeRefImpl(const android::StringPiece& str, const Context& context, bool unique);
   void ReAssignIndices();
 
+  // Returns the indexed entry matching the hash, string and priority, or nullptr.
+  Entry* FindEntry(uint32_t hash, const android::StringPiece& str, uint32_t priority) const;
+
+  // Adds the entry (with its hash already computed) to the index, growing it if needed.
+  void InsertEntry(Entry* entry);
+
+  // Grows the index so that count entries fit below the maximum load factor.
+  // Existing entries are re-slotted using their stored hashes.
+  void ReserveIndex(size_t count);
+
+  // Rebuilds the index from strings_, using the stored hashes.
+  void RebuildIndex();
+
   std::vector<std::unique_ptr<Entry>> strings_;
   std::vector<std::unique_ptr<StyleEntry>> styles_;
-  std::unordered_multimap<android::StringPiece, Entry*> indexed_strings_;
+
+  // Open-addressing index over strings_, used to unique strings in MakeRef.
+  // Each entry stores the hash of its bytes, so probe comparisons, growth and
+  // pool merges never re-hash string data. Slots hold null when empty; the
+  // table size is always a power of two and duplicate strings (differing
+  // priority, or added with unique=false) simply occupy separate slots.
+  std::vector<Entry*> index_;
+  size_t index_size_ = 0;
 };
 
 }  // namespace aapt
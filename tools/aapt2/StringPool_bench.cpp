@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StringPool.h"
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "android-base/stringprintf.h"
+
+using ::android::base::StringPrintf;
+
+namespace aapt {
+
+static std::vector<std::string> BuildStrings(size_t count) {
+  std::vector<std::string> strings;
+  strings.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    strings.push_back(StringPrintf("res/drawable-xxhdpi-v4/some_file_name_%zu.xml", i));
+  }
+  return strings;
+}
+
+static void BM_StringPoolInternUniqueStrings(benchmark::State& state) {
+  const std::vector<std::string> strings = BuildStrings(state.range(0));
+  while (state.KeepRunning()) {
+    StringPool pool;
+    for (const std::string& str : strings) {
+      benchmark::DoNotOptimize(pool.MakeRef(str));
+    }
+  }
+}
+BENCHMARK(BM_StringPoolInternUniqueStrings)->Range(1024, 100 * 1024);
+
+static void BM_StringPoolInternDuplicateStrings(benchmark::State& state) {
+  const std::vector<std::string> strings = BuildStrings(state.range(0));
+  while (state.KeepRunning()) {
+    StringPool pool;
+    // Intern every string twice: the second pass exercises the lookup-only
+    // path the compiler hits when many files reference the same names.
+    for (const std::string& str : strings) {
+      benchmark::DoNotOptimize(pool.MakeRef(str));
+    }
+    for (const std::string& str : strings) {
+      benchmark::DoNotOptimize(pool.MakeRef(str));
+    }
+  }
+}
+BENCHMARK(BM_StringPoolInternDuplicateStrings)->Range(1024, 100 * 1024);
+
+static void BM_StringPoolMerge(benchmark::State& state) {
+  const std::vector<std::string> strings = BuildStrings(state.range(0));
+  while (state.KeepRunning()) {
+    StringPool dst;
+    StringPool src;
+    for (const std::string& str : strings) {
+      benchmark::DoNotOptimize(src.MakeRef(str));
+    }
+    dst.Merge(std::move(src));
+  }
+}
+BENCHMARK(BM_StringPoolMerge)->Range(1024, 100 * 1024);
+
+}  // namespace aapt
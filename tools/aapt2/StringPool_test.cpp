@@ -72,6 +72,23 @@ TEST(StringPoolTest, DoNotDedupeSameStringDifferentPriority) {
   EXPECT_THAT(pool.size(), Eq(2u));
 }
 
+TEST(StringPoolTest, DedupeAgainstMergedStrings) {
+  StringPool pool_a;
+  StringPool::Ref ref_a = pool_a.MakeRef("wut");
+
+  StringPool pool_b;
+  pool_b.MakeRef("hey");
+
+  pool_a.Merge(std::move(pool_b));
+  EXPECT_THAT(pool_a.size(), Eq(2u));
+
+  // New refs must find the strings carried over by the merge.
+  StringPool::Ref ref_b = pool_a.MakeRef("hey");
+  EXPECT_THAT(*ref_b, Eq("hey"));
+  EXPECT_THAT(pool_a.size(), Eq(2u));
+  EXPECT_THAT(*ref_a, Eq("wut"));
+}
+
 TEST(StringPoolTest, MaintainInsertionOrderIndex) {
   StringPool pool;
 
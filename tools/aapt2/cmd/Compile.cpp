@@ -16,7 +16,12 @@
 
 #include <dirent.h>
 
+#include <atomic>
+#include <cstdio>
+#include <iomanip>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "android-base/errors.h"
 #include "android-base/file.h"
@@ -124,8 +129,10 @@ struct CompileOptions {
   std::string output_path;
   Maybe<std::string> res_dir;
   Maybe<std::string> generate_text_symbols_path;
+  Maybe<std::string> png_crunch_cache_dir;
   bool pseudolocalize = false;
   bool no_png_crunch = false;
+  bool fast_png_crunch = false;
   bool legacy_mode = false;
   bool verbose = false;
 };
@@ -500,6 +507,31 @@ static bool CompileXml(IAaptContext* context, const CompileOptions& options,
   return true;
 }
 
+// 64-bit FNV-1a over the raw bytes of a PNG file. A collision between two
+// distinct images in the same project is vanishingly unlikely, and a false hit
+// only substitutes the crunched form of byte-identical input, so a
+// cryptographic hash is not required here.
+static uint64_t HashPngContents(const std::string& data) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (const char c : data) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+// Builds the path at which the crunched form of a PNG with the given contents
+// is cached. The crunched output depends only on the input bytes, the
+// extension (9-patch or not) and the crunch options, all of which are folded
+// into the file name.
+static std::string BuildPngCrunchCachePath(const std::string& cache_dir,
+                                           const std::string& content,
+                                           const std::string& extension, bool fast_crunch) {
+  std::stringstream path;
+  path << cache_dir << file::sDirSep << std::hex << std::setw(16) << std::setfill('0')
+       << HashPngContents(content) << std::dec << (fast_crunch ? ".fast." : ".") << extension;
+  return path.str();
+}
+
 static bool CompilePng(IAaptContext* context, const CompileOptions& options,
                        const ResourcePathData& path_data, IArchiveWriter* writer,
                        const std::string& output_path) {
@@ -524,83 +556,117 @@ static bool CompilePng(IAaptContext* context, const CompileOptions& options,
       return false;
     }
 
-    BigBuffer crunched_png_buffer(4096);
-    io::BigBufferOutputStream crunched_png_buffer_out(&crunched_png_buffer);
-
-    // Ensure that we only keep the chunks we care about if we end up
-    // using the original PNG instead of the crunched one.
-    PngChunkFilter png_chunk_filter(content);
-    std::unique_ptr<Image> image = ReadPng(context, path_data.source, &png_chunk_filter);
-    if (!image) {
-      return false;
+    std::string cache_path;
+    std::string cached_png;
+    if (options.png_crunch_cache_dir) {
+      cache_path = BuildPngCrunchCachePath(options.png_crunch_cache_dir.value(), content,
+                                           path_data.extension, options.fast_png_crunch);
     }
 
-    std::unique_ptr<NinePatch> nine_patch;
-    if (path_data.extension == "9.png") {
-      std::string err;
-      nine_patch = NinePatch::Create(image->rows.get(), image->width, image->height, &err);
-      if (!nine_patch) {
-        context->GetDiagnostics()->Error(DiagMessage() << err);
+    if (!cache_path.empty() && android::base::ReadFileToString(cache_path, &cached_png)) {
+      // The image was crunched by an earlier build and hasn't changed since.
+      if (context->IsVerbose()) {
+        context->GetDiagnostics()->Note(DiagMessage(path_data.source)
+                                        << "reusing cached crunched PNG");
+      }
+
+      memcpy(buffer.NextBlock<uint8_t>(cached_png.size()), cached_png.data(), cached_png.size());
+    } else {
+      BigBuffer crunched_png_buffer(4096);
+      io::BigBufferOutputStream crunched_png_buffer_out(&crunched_png_buffer);
+
+      // Ensure that we only keep the chunks we care about if we end up
+      // using the original PNG instead of the crunched one.
+      PngChunkFilter png_chunk_filter(content);
+      std::unique_ptr<Image> image = ReadPng(context, path_data.source, &png_chunk_filter);
+      if (!image) {
         return false;
       }
 
-      // Remove the 1px border around the NinePatch.
-      // Basically the row array is shifted up by 1, and the length is treated
-      // as height - 2.
-      // For each row, shift the array to the left by 1, and treat the length as
-      // width - 2.
-      image->width -= 2;
-      image->height -= 2;
-      memmove(image->rows.get(), image->rows.get() + 1, image->height * sizeof(uint8_t**));
-      for (int32_t h = 0; h < image->height; h++) {
-        memmove(image->rows[h], image->rows[h] + 4, image->width * 4);
+      std::unique_ptr<NinePatch> nine_patch;
+      if (path_data.extension == "9.png") {
+        std::string err;
+        nine_patch = NinePatch::Create(image->rows.get(), image->width, image->height, &err);
+        if (!nine_patch) {
+          context->GetDiagnostics()->Error(DiagMessage() << err);
+          return false;
+        }
+
+        // Remove the 1px border around the NinePatch.
+        // Basically the row array is shifted up by 1, and the length is treated
+        // as height - 2.
+        // For each row, shift the array to the left by 1, and treat the length as
+        // width - 2.
+        image->width -= 2;
+        image->height -= 2;
+        memmove(image->rows.get(), image->rows.get() + 1, image->height * sizeof(uint8_t**));
+        for (int32_t h = 0; h < image->height; h++) {
+          memmove(image->rows[h], image->rows[h] + 4, image->width * 4);
+        }
+
+        if (context->IsVerbose()) {
+          context->GetDiagnostics()->Note(DiagMessage(path_data.source) << "9-patch: "
+                                                                        << *nine_patch);
+        }
       }
 
-      if (context->IsVerbose()) {
-        context->GetDiagnostics()->Note(DiagMessage(path_data.source) << "9-patch: "
-                                                                      << *nine_patch);
+      PngOptions png_options;
+      png_options.fast_crunch = options.fast_png_crunch;
+
+      // Write the crunched PNG.
+      if (!WritePng(context, image.get(), nine_patch.get(), &crunched_png_buffer_out,
+                    png_options)) {
+        return false;
       }
-    }
 
-    // Write the crunched PNG.
-    if (!WritePng(context, image.get(), nine_patch.get(), &crunched_png_buffer_out, {})) {
-      return false;
-    }
+      if (nine_patch != nullptr ||
+          crunched_png_buffer_out.ByteCount() <= png_chunk_filter.ByteCount()) {
+        // No matter what, we must use the re-encoded PNG, even if it is larger.
+        // 9-patch images must be re-encoded since their borders are stripped.
+        buffer.AppendBuffer(std::move(crunched_png_buffer));
+      } else {
+        // The re-encoded PNG is larger than the original, and there is
+        // no mandatory transformation. Use the original.
+        if (context->IsVerbose()) {
+          context->GetDiagnostics()->Note(DiagMessage(path_data.source)
+                                          << "original PNG is smaller than crunched PNG"
+                                          << ", using original");
+        }
 
-    if (nine_patch != nullptr ||
-        crunched_png_buffer_out.ByteCount() <= png_chunk_filter.ByteCount()) {
-      // No matter what, we must use the re-encoded PNG, even if it is larger.
-      // 9-patch images must be re-encoded since their borders are stripped.
-      buffer.AppendBuffer(std::move(crunched_png_buffer));
-    } else {
-      // The re-encoded PNG is larger than the original, and there is
-      // no mandatory transformation. Use the original.
-      if (context->IsVerbose()) {
-        context->GetDiagnostics()->Note(DiagMessage(path_data.source)
-                                        << "original PNG is smaller than crunched PNG"
-                                        << ", using original");
+        png_chunk_filter.Rewind();
+        BigBuffer filtered_png_buffer(4096);
+        io::BigBufferOutputStream filtered_png_buffer_out(&filtered_png_buffer);
+        io::Copy(&filtered_png_buffer_out, &png_chunk_filter);
+        buffer.AppendBuffer(std::move(filtered_png_buffer));
       }
 
-      png_chunk_filter.Rewind();
-      BigBuffer filtered_png_buffer(4096);
-      io::BigBufferOutputStream filtered_png_buffer_out(&filtered_png_buffer);
-      io::Copy(&filtered_png_buffer_out, &png_chunk_filter);
-      buffer.AppendBuffer(std::move(filtered_png_buffer));
-    }
+      if (context->IsVerbose()) {
+        // For debugging only, use the legacy PNG cruncher and compare the resulting file sizes.
+        // This will help catch exotic cases where the new code may generate larger PNGs.
+        std::stringstream legacy_stream(content);
+        BigBuffer legacy_buffer(4096);
+        Png png(context->GetDiagnostics());
+        if (!png.process(path_data.source, &legacy_stream, &legacy_buffer, {})) {
+          return false;
+        }
 
-    if (context->IsVerbose()) {
-      // For debugging only, use the legacy PNG cruncher and compare the resulting file sizes.
-      // This will help catch exotic cases where the new code may generate larger PNGs.
-      std::stringstream legacy_stream(content);
-      BigBuffer legacy_buffer(4096);
-      Png png(context->GetDiagnostics());
-      if (!png.process(path_data.source, &legacy_stream, &legacy_buffer, {})) {
-        return false;
+        context->GetDiagnostics()->Note(DiagMessage(path_data.source)
+                                        << "legacy=" << legacy_buffer.size()
+                                        << " new=" << buffer.size());
       }
 
-      context->GetDiagnostics()->Note(DiagMessage(path_data.source)
-                                      << "legacy=" << legacy_buffer.size()
-                                      << " new=" << buffer.size());
+      if (!cache_path.empty()) {
+        // Write through a temporary file and rename so that concurrent compile
+        // workers never observe a partially written cache entry. Best effort:
+        // any failure here only costs a recompression on the next build.
+        std::stringstream temp_path;
+        temp_path << cache_path << ".tmp." << std::this_thread::get_id();
+        if (android::base::WriteStringToFile(buffer.to_string(), temp_path.str())) {
+          if (std::rename(temp_path.str().c_str(), cache_path.c_str()) != 0) {
+            std::remove(temp_path.str().c_str());
+          }
+        }
+      }
     }
   }
 
@@ -694,9 +760,111 @@ class CompileContext : public IAaptContext {
   bool verbose_ = false;
 };
 
+// Serializes Log calls to the wrapped diagnostics so messages from compile
+// workers don't interleave mid-line.
+class ThreadSafeDiagnostics : public IDiagnostics {
+ public:
+  explicit ThreadSafeDiagnostics(IDiagnostics* delegate) : delegate_(delegate) {
+  }
+
+  void Log(Level level, DiagMessageActual& actual_msg) override {
+    std::lock_guard<std::mutex> lock(lock_);
+    delegate_->Log(level, actual_msg);
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(ThreadSafeDiagnostics);
+
+  IDiagnostics* delegate_;
+  std::mutex lock_;
+};
+
+// Buffers compiled entries in memory, so workers can compile files in parallel
+// while the real archive is written afterwards, serially and in input order.
+class MemoryArchiveWriter : public IArchiveWriter {
+ public:
+  struct Entry {
+    std::string path;
+    uint32_t flags;
+    std::string data;
+  };
+
+  MemoryArchiveWriter() = default;
+
+  bool StartEntry(const StringPiece& path, uint32_t flags) override {
+    entries_.push_back(Entry{path.to_string(), flags, {}});
+    return true;
+  }
+
+  bool Write(const void* data, int len) override {
+    entries_.back().data.append(reinterpret_cast<const char*>(data), static_cast<size_t>(len));
+    return true;
+  }
+
+  bool FinishEntry() override {
+    return true;
+  }
+
+  bool WriteFile(const StringPiece& path, uint32_t flags, io::InputStream* in) override {
+    if (!StartEntry(path, flags)) {
+      return false;
+    }
+
+    const void* data = nullptr;
+    size_t len = 0;
+    while (in->Next(&data, &len)) {
+      if (!Write(data, static_cast<int>(len))) {
+        return false;
+      }
+    }
+    return !in->HadError();
+  }
+
+  bool HadError() const override {
+    return false;
+  }
+
+  std::string GetError() const override {
+    return {};
+  }
+
+  const std::vector<Entry>& entries() const {
+    return entries_;
+  }
+
+ private:
+  std::vector<Entry> entries_;
+};
+
+// Replays the buffered entries into the real archive.
+static bool FlushMemoryArchive(const MemoryArchiveWriter& mem_writer, IArchiveWriter* writer,
+                               IDiagnostics* diag) {
+  for (const MemoryArchiveWriter::Entry& entry : mem_writer.entries()) {
+    if (!writer->StartEntry(entry.path, entry.flags) ||
+        !writer->Write(entry.data.data(), static_cast<int>(entry.data.size())) ||
+        !writer->FinishEntry()) {
+      diag->Error(DiagMessage() << "failed to write " << entry.path
+                                << " to archive: " << writer->GetError());
+      return false;
+    }
+  }
+  return true;
+}
+
+using CompileFunction = bool (*)(IAaptContext*, const CompileOptions&, const ResourcePathData&,
+                                 IArchiveWriter*, const std::string&);
+
+// A file to compile, with its compile function already resolved.
+struct CompileJob {
+  ResourcePathData path_data;
+  CompileFunction func;
+  std::string out_path;
+};
+
 // Entry point for compilation phase. Parses arguments and dispatches to the correct steps.
 int Compile(const std::vector<StringPiece>& args, IDiagnostics* diagnostics) {
-  CompileContext context(diagnostics);
+  ThreadSafeDiagnostics safe_diagnostics(diagnostics);
+  CompileContext context(&safe_diagnostics);
   CompileOptions options;
 
   bool verbose = false;
@@ -713,6 +881,15 @@ int Compile(const std::vector<StringPiece>& args, IDiagnostics* diagnostics) {
                           "(en-XA and ar-XB)",
                           &options.pseudolocalize)
           .OptionalSwitch("--no-crunch", "Disables PNG processing", &options.no_png_crunch)
+          .OptionalSwitch("--fast-crunch",
+                          "Crunches PNGs faster at the cost of slightly larger output.\n"
+                          "Intended for debug builds",
+                          &options.fast_png_crunch)
+          .OptionalFlag("--crunch-cache",
+                        "Directory in which to cache crunched PNGs, keyed by the content\n"
+                        "of the input. Unchanged images skip recompression on subsequent\n"
+                        "builds",
+                        &options.png_crunch_cache_dir)
           .OptionalSwitch("--legacy", "Treat errors that used to be valid in AAPT as warnings",
                           &options.legacy_mode)
           .OptionalSwitch("-v", "Enables verbose logging", &verbose);
@@ -761,6 +938,8 @@ int Compile(const std::vector<StringPiece>& args, IDiagnostics* diagnostics) {
   }
 
   bool error = false;
+  std::vector<CompileJob> jobs;
+  jobs.reserve(input_data.size());
   for (ResourcePathData& path_data : input_data) {
     if (options.verbose) {
       context.GetDiagnostics()->Note(DiagMessage(path_data.source) << "processing");
@@ -806,9 +985,53 @@ int Compile(const std::vector<StringPiece>& args, IDiagnostics* diagnostics) {
       continue;
     }
 
-    // Compile the file.
-    const std::string out_path = BuildIntermediateContainerFilename(path_data);
-    error |= !compile_func(&context, options, path_data, archive_writer.get(), out_path);
+    std::string out_path = BuildIntermediateContainerFilename(path_data);
+    jobs.push_back(CompileJob{std::move(path_data), compile_func, std::move(out_path)});
+  }
+
+  // Compile the files. With multiple jobs and cores, the per-file work (PNG
+  // crunching, XML parsing, flattening) runs on a worker pool; each job's
+  // output is buffered and flushed to the archive in input order afterwards,
+  // so the resulting container is byte-identical to a sequential run.
+  size_t thread_count = std::thread::hardware_concurrency();
+  if (thread_count <= 1 || jobs.size() <= 1) {
+    for (const CompileJob& job : jobs) {
+      error |= !job.func(&context, options, job.path_data, archive_writer.get(), job.out_path);
+    }
+  } else {
+    thread_count = std::min(thread_count, jobs.size());
+
+    std::vector<MemoryArchiveWriter> outputs(jobs.size());
+    std::vector<uint8_t> job_failed(jobs.size(), 0);
+    std::atomic<size_t> next_job(0);
+
+    std::vector<std::thread> workers;
+    workers.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; i++) {
+      workers.emplace_back([&]() {
+        while (true) {
+          const size_t job_index = next_job.fetch_add(1);
+          if (job_index >= jobs.size()) {
+            return;
+          }
+          const CompileJob& job = jobs[job_index];
+          if (!job.func(&context, options, job.path_data, &outputs[job_index], job.out_path)) {
+            job_failed[job_index] = 1;
+          }
+        }
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+
+    for (size_t i = 0; i < jobs.size(); i++) {
+      if (job_failed[i]) {
+        error = true;
+        continue;
+      }
+      error |= !FlushMemoryArchive(outputs[i], archive_writer.get(), context.GetDiagnostics());
+    }
   }
   return error ? 1 : 0;
 }
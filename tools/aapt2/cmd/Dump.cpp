@@ -130,11 +130,23 @@ static bool TryDumpFile(IAaptContext* context, const std::string& file_path,
   std::string err;
   std::unique_ptr<io::ZipFileCollection> zip = io::ZipFileCollection::Create(file_path, &err);
   if (zip) {
+    const bool proto = zip->FindFile("resources.pb") != nullptr;
+
+    // A targeted file dump never touches the resource table, so skip deserializing it and go
+    // straight to the requested file.
+    if (options.file_to_dump_path) {
+      io::IFile* file = zip->FindFile(options.file_to_dump_path.value());
+      if (file == nullptr) {
+        context->GetDiagnostics()->Error(DiagMessage(file_path)
+                                         << "file '" << options.file_to_dump_path.value()
+                                         << "' not found in APK");
+        return false;
+      }
+      return DumpXmlFile(context, file, proto, &printer);
+    }
+
     ResourceTable table;
-    bool proto = false;
     if (io::IFile* file = zip->FindFile("resources.pb")) {
-      proto = true;
-
       std::unique_ptr<io::IData> data = file->OpenAsData();
       if (data == nullptr) {
         context->GetDiagnostics()->Error(DiagMessage(file_path) << "failed to open resources.pb");
@@ -166,24 +178,13 @@ static bool TryDumpFile(IAaptContext* context, const std::string& file_path,
       }
     }
 
-    if (!options.file_to_dump_path) {
-      if (proto) {
-        printer.Println("Proto APK");
-      } else {
-        printer.Println("Binary APK");
-      }
-      Debug::PrintTable(table, options.print_options, &printer);
-      return true;
-    }
-
-    io::IFile* file = zip->FindFile(options.file_to_dump_path.value());
-    if (file == nullptr) {
-      context->GetDiagnostics()->Error(DiagMessage(file_path)
-                                       << "file '" << options.file_to_dump_path.value()
-                                       << "' not found in APK");
-      return false;
+    if (proto) {
+      printer.Println("Proto APK");
+    } else {
+      printer.Println("Binary APK");
     }
-    return DumpXmlFile(context, file, proto, &printer);
+    Debug::PrintTable(table, options.print_options, &printer);
+    return true;
   }
 
   err.clear();
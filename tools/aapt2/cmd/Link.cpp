@@ -64,6 +64,7 @@
 #include "process/IResourceTableConsumer.h"
 #include "process/SymbolTable.h"
 #include "split/TableSplitter.h"
+#include "util/BigBuffer.h"
 #include "util/Files.h"
 #include "xml/XmlDom.h"
 
@@ -270,9 +271,12 @@ class FeatureSplitSymbolTableDelegate : public DefaultSymbolTableDelegate {
   IAaptContext* context_;
 };
 
+// Flattens an XML file to the archive. If 'flattener' is non-null it is used for the kApk format,
+// allowing one flattener (and its string interning scratch) to be shared across many files.
 static bool FlattenXml(IAaptContext* context, const xml::XmlResource& xml_res,
                        const StringPiece& path, bool keep_raw_values, bool utf16,
-                       OutputFormat format, IArchiveWriter* writer) {
+                       OutputFormat format, IArchiveWriter* writer,
+                       XmlFlattener* flattener = nullptr) {
   if (context->IsVerbose()) {
     context->GetDiagnostics()->Note(DiagMessage(path) << "writing to archive (keep_raw_values="
                                                       << (keep_raw_values ? "true" : "false")
@@ -285,8 +289,9 @@ static bool FlattenXml(IAaptContext* context, const xml::XmlResource& xml_res,
       XmlFlattenerOptions options = {};
       options.keep_raw_values = keep_raw_values;
       options.use_utf16 = utf16;
-      XmlFlattener flattener(&buffer, options);
-      if (!flattener.Consume(context, &xml_res)) {
+      XmlFlattener local_flattener(&buffer, options);
+      if (!(flattener ? flattener->Consume(context, &xml_res, &buffer)
+                      : local_flattener.Consume(context, &xml_res))) {
         return false;
       }
 
@@ -536,6 +541,13 @@ bool ResourceFileFlattener::Flatten(ResourceTable* table, IArchiveWriter* archiv
   bool error = false;
   std::map<std::pair<ConfigDescription, StringPiece>, FileOperation> config_sorted_files;
 
+  // One flattener is shared by all the XML files written below, so that common
+  // strings ("layout_width", the android namespace URI, ...) are interned into
+  // pools whose allocations are recycled from one document to the next.
+  XmlFlattenerOptions xml_flattener_options;
+  xml_flattener_options.keep_raw_values = options_.keep_raw_values;
+  XmlFlattener xml_flattener(nullptr, xml_flattener_options);
+
   proguard::CollectResourceReferences(context_, table, keep_set_);
 
   for (auto& pkg : table->packages) {
@@ -661,7 +673,8 @@ bool ResourceFileFlattener::Flatten(ResourceTable* table, IArchiveWriter* archiv
             }
 
             error |= !FlattenXml(context_, *doc, dst_path, options_.keep_raw_values,
-                                 false /*utf16*/, options_.output_format, archive_writer);
+                                 false /*utf16*/, options_.output_format, archive_writer,
+                                 &xml_flattener);
           }
         } else {
           error |= !io::CopyFileToArchive(context_, file_op.file_to_copy, file_op.dst_path,
@@ -1028,6 +1041,8 @@ class LinkCommand {
     auto new_end_iter = std::remove_if(final_table_.packages.begin(), final_table_.packages.end(),
                                        is_ext_package_func);
     final_table_.packages.erase(new_end_iter, final_table_.packages.end());
+    // Packages were removed behind the table's back; drop any memoized lookups.
+    final_table_.InvalidateLookupCache();
     return !error;
   }
 
@@ -1499,7 +1514,8 @@ class LinkCommand {
           return false;
         }
 
-        if (!table_merger_->Merge(src, &table, override)) {
+        // The deserialized table is discarded after the merge, so let the merger consume it.
+        if (!table_merger_->MergeAndConsume(src, &table, override)) {
           context_->GetDiagnostics()->Error(DiagMessage(src) << "failed to merge resource table");
           return false;
         }
@@ -1557,7 +1573,8 @@ class LinkCommand {
     for (auto& entry : merged_assets) {
       uint32_t compression_flags = ArchiveEntry::kCompress;
       std::string extension = file::GetExtension(entry.first).to_string();
-      if (options_.extensions_to_not_compress.count(extension) > 0) {
+      if (options_.do_not_compress_anything ||
+          options_.extensions_to_not_compress.count(extension) > 0) {
         compression_flags = 0u;
       }
 
@@ -1993,6 +2010,16 @@ class LinkCommand {
                            proguard_main_dex_keep_set)) {
       return 1;
     }
+
+    if (context_->IsVerbose()) {
+      const BigBuffer::PoolStats pool_stats = BigBuffer::GetPoolStats();
+      const uint64_t total_allocations = pool_stats.hits + pool_stats.misses;
+      if (total_allocations > 0) {
+        context_->GetDiagnostics()->Note(DiagMessage()
+                                         << "buffer block pool: recycled " << pool_stats.hits
+                                         << " of " << total_allocations << " block allocations");
+      }
+    }
     return 0;
   }
 
@@ -2180,6 +2207,10 @@ int Link(const std::vector<StringPiece>& args, IDiagnostics* diagnostics) {
                         &options.manifest_fixer_options.rename_instrumentation_target_package)
           .OptionalFlagList("-0", "File extensions not to compress.",
                             &options.extensions_to_not_compress)
+          .OptionalSwitch("--no-compress",
+                          "Do not compress any resources. Speeds up debug builds at the cost\n"
+                          "of a larger APK.",
+                          &options.do_not_compress_anything)
           .OptionalSwitch("--warn-manifest-validation",
                           "Treat manifest validation errors as warnings.",
                           &options.manifest_fixer_options.warn_validation)
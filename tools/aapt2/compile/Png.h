@@ -36,6 +36,12 @@ constexpr size_t kPngSignatureSize = 8u;
 
 struct PngOptions {
   int grayscale_tolerance = 0;
+
+  // When true, trade output size for encode speed: use the default deflate
+  // level and a single scanline filter instead of the exhaustive filter
+  // search. Intended for debug builds, where compile time matters more than
+  // a few percent of APK size.
+  bool fast_crunch = false;
 };
 
 /**
@@ -513,8 +513,10 @@ bool WritePng(IAaptContext* context, const Image* image,
   // Set up the write functions which write to our custom data sources.
   png_set_write_fn(write_ptr, (png_voidp)out, WriteDataToStream, nullptr);
 
-  // We want small files and can take the performance hit to achieve this goal.
-  png_set_compression_level(write_ptr, Z_BEST_COMPRESSION);
+  // We want small files and can take the performance hit to achieve this goal,
+  // unless the caller asked for a fast crunch.
+  png_set_compression_level(
+      write_ptr, options.fast_crunch ? Z_DEFAULT_COMPRESSION : Z_BEST_COMPRESSION);
 
   // Begin analysis of the image data.
   // Scan the entire image and determine if:
@@ -623,6 +625,10 @@ bool WritePng(IAaptContext* context, const Image* image,
     // libpng writePtr.
     WritePalette(write_ptr, write_info_ptr, &color_palette, &alpha_palette);
     png_set_filter(write_ptr, 0, PNG_NO_FILTERS);
+  } else if (options.fast_crunch) {
+    // Skip the exhaustive per-row filter search. SUB alone is a decent
+    // compromise for the typical image and is much cheaper to encode.
+    png_set_filter(write_ptr, 0, PNG_FILTER_SUB);
   } else {
     png_set_filter(write_ptr, 0, PNG_ALL_FILTERS);
   }
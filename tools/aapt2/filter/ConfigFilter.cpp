@@ -36,6 +36,9 @@ void AxisConfigFilter::AddConfig(ConfigDescription config) {
 
   configs_.insert(std::make_pair(config, diff_mask));
   config_mask_ |= diff_mask;
+
+  // Cached results were computed against the old set of axes.
+  match_cache_.clear();
 }
 
 // Returns true if the locale script of the config should be considered matching
@@ -76,6 +79,16 @@ static bool ScriptsMatch(const ConfigDescription& config, const ConfigDescriptio
 }
 
 bool AxisConfigFilter::Match(const ConfigDescription& config) const {
+  const auto cached = match_cache_.find(config);
+  if (cached != match_cache_.end()) {
+    return cached->second;
+  }
+  const bool result = MatchImpl(config);
+  match_cache_[config] = result;
+  return result;
+}
+
+bool AxisConfigFilter::MatchImpl(const ConfigDescription& config) const {
   const uint32_t mask = ConfigDescription::DefaultConfig().diff(config);
   if ((config_mask_ & mask) == 0) {
     // The two configurations don't have any common axis.
@@ -17,6 +17,7 @@
 #ifndef AAPT_FILTER_CONFIGFILTER_H
 #define AAPT_FILTER_CONFIGFILTER_H
 
+#include <map>
 #include <set>
 #include <utility>
 
@@ -48,11 +49,20 @@ class AxisConfigFilter : public IConfigFilter {
  public:
   void AddConfig(ConfigDescription config);
 
+  /**
+   * Match results are memoized per distinct configuration: a table holds many
+   * values spread over a small set of configurations, and each axis check may
+   * need to compute locale scripts. Because of the cache, a single filter must
+   * not be shared across threads.
+   */
   bool Match(const ConfigDescription& config) const override;
 
  private:
+  bool MatchImpl(const ConfigDescription& config) const;
+
   std::set<std::pair<ConfigDescription, uint32_t>> configs_;
   uint32_t config_mask_ = 0;
+  mutable std::map<ConfigDescription, bool> match_cache_;
 };
 
 }  // namespace aapt
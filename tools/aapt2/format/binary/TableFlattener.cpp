@@ -69,6 +69,9 @@ static bool cmp_style_entries(const Style::Entry& a, const Style::Entry& b) {
   return false;
 }
 
+// The hardcoded string uses characters which make it an invalid resource name.
+constexpr const char* kObfuscatedResourceName = "0_resource_name_obfuscated";
+
 struct FlatEntry {
   ResourceEntry* entry;
   Value* value;
@@ -217,6 +220,66 @@ class MapFlattenVisitor : public ValueVisitor {
   size_t entry_count_ = 0;
 };
 
+// Counts the number of ResTable_map entries that MapFlattenVisitor will write
+// for a value, without writing anything. Keep in sync with MapFlattenVisitor.
+class MapEntryCountVisitor : public ValueVisitor {
+ public:
+  using ValueVisitor::Visit;
+
+  void Visit(Attribute* attr) override {
+    // ATTR_TYPE is always written.
+    entry_count_ = 1;
+    if (attr->min_int != std::numeric_limits<int32_t>::min()) {
+      entry_count_++;
+    }
+
+    if (attr->max_int != std::numeric_limits<int32_t>::max()) {
+      entry_count_++;
+    }
+    entry_count_ += attr->symbols.size();
+  }
+
+  void Visit(Style* style) override {
+    entry_count_ = style->entries.size();
+  }
+
+  void Visit(Styleable* styleable) override {
+    entry_count_ = styleable->entries.size();
+  }
+
+  void Visit(Array* array) override {
+    entry_count_ = array->elements.size();
+  }
+
+  void Visit(Plural* plural) override {
+    entry_count_ = 0;
+    for (const auto& value : plural->values) {
+      if (value) {
+        entry_count_++;
+      }
+    }
+  }
+
+  size_t entry_count() const {
+    return entry_count_;
+  }
+
+ private:
+  size_t entry_count_ = 0;
+};
+
+// Measures the exact number of bytes that FlattenValue() will write for an
+// entry, so that entry offsets can be emitted ahead of the entries themselves.
+static size_t MeasureValue(Value* value) {
+  if (ValueCast<Item>(value) != nullptr) {
+    return sizeof(ResTable_entry) + sizeof(Res_value);
+  }
+
+  MapEntryCountVisitor counter;
+  value->Accept(&counter);
+  return sizeof(ResTable_entry_ext) + counter.entry_count() * sizeof(ResTable_map);
+}
+
 class PackageFlattener {
  public:
   PackageFlattener(IAaptContext* context, ResourceTablePackage* package,
@@ -249,10 +312,19 @@ class PackageFlattener {
     // Copy the package name in device endianness.
     strcpy16_htod(pkg_header->name, arraysize(pkg_header->name), util::Utf8ToUtf16(package_->name));
 
-    // Serialize the types. We do this now so that our type and key strings
-    // are populated. We write those first.
-    BigBuffer type_buffer(1024);
-    FlattenTypes(&type_buffer);
+    // Collect and sort the types and their entries once; both the string pool
+    // population pass and the type flattening pass walk the same order.
+    std::vector<ResourceTableType*> sorted_types = CollectAndSortTypes();
+    std::vector<std::vector<ResourceEntry*>> sorted_entries;
+    sorted_entries.reserve(sorted_types.size());
+    for (ResourceTableType* type : sorted_types) {
+      sorted_entries.push_back(CollectAndSortEntries(type));
+    }
+
+    // Populate the type and key string pools first, so that they can be
+    // flattened ahead of the type chunks and the types can then be written
+    // forward in a single pass, without staging them in a side buffer.
+    PopulateTypeAndKeyPools(sorted_types, sorted_entries);
 
     pkg_header->typeStrings = util::HostToDevice32(pkg_writer.size());
     StringPool::FlattenUtf16(pkg_writer.buffer(), type_pool_, diag_);
@@ -260,8 +332,9 @@ class PackageFlattener {
     pkg_header->keyStrings = util::HostToDevice32(pkg_writer.size());
     StringPool::FlattenUtf8(pkg_writer.buffer(), key_pool_, diag_);
 
-    // Append the types.
-    buffer->AppendBuffer(std::move(type_buffer));
+    if (!FlattenTypes(sorted_types, sorted_entries, buffer)) {
+      return false;
+    }
 
     // If there are libraries (or if the package ID is 0x00), encode a library chunk.
     if (package_->id.value() == 0x00 || !shared_libs_->empty()) {
@@ -328,20 +401,17 @@ class PackageFlattener {
     type_header->config = config;
     type_header->config.swapHtoD();
 
+    // Measure the entries first, so that the offset table can be emitted
+    // before the entries themselves and the values can then flatten forward
+    // into the type chunk without staging them in a side buffer.
     std::vector<uint32_t> offsets;
     offsets.resize(num_total_entries, 0xffffffffu);
 
-    BigBuffer values_buffer(512);
+    size_t values_size = 0;
     for (FlatEntry& flat_entry : *entries) {
       CHECK(static_cast<size_t>(flat_entry.entry->id.value()) < num_total_entries);
-      offsets[flat_entry.entry->id.value()] = values_buffer.size();
-      if (!FlattenValue(&flat_entry, &values_buffer)) {
-        diag_->Error(DiagMessage()
-                     << "failed to flatten resource '"
-                     << ResourceNameRef(package_->name, type->type, flat_entry.entry->name)
-                     << "' for configuration '" << config << "'");
-        return false;
-      }
+      offsets[flat_entry.entry->id.value()] = values_size;
+      values_size += MeasureValue(flat_entry.value);
     }
 
     bool sparse_encode = use_sparse_entries_;
@@ -352,7 +422,7 @@ class PackageFlattener {
 
     // Only sparse encode if the offsets are representable in 2 bytes.
     sparse_encode =
-        sparse_encode && (values_buffer.size() / 4u) <= std::numeric_limits<uint16_t>::max();
+        sparse_encode && (values_size / 4u) <= std::numeric_limits<uint16_t>::max();
 
     // Only sparse encode if the ratio of populated entries to total entries is below some
     // threshold.
@@ -381,7 +451,21 @@ class PackageFlattener {
     }
 
     type_header->entriesStart = util::HostToDevice32(type_writer.size());
-    type_writer.buffer()->AppendBuffer(std::move(values_buffer));
+
+    // Write the entries. Each one must land exactly where the measuring pass
+    // said it would, since the offsets are already flattened.
+    const size_t entries_start = type_writer.size();
+    for (FlatEntry& flat_entry : *entries) {
+      CHECK(type_writer.size() - entries_start == offsets[flat_entry.entry->id.value()])
+          << "entry written at an offset different from the one measured";
+      if (!FlattenValue(&flat_entry, buffer)) {
+        diag_->Error(DiagMessage()
+                     << "failed to flatten resource '"
+                     << ResourceNameRef(package_->name, type->type, flat_entry.entry->name)
+                     << "' for configuration '" << config << "'");
+        return false;
+      }
+    }
     type_writer.Finish();
     return true;
   }
@@ -414,14 +498,14 @@ class PackageFlattener {
     return sorted_entries;
   }
 
-  bool FlattenTypeSpec(ResourceTableType* type, std::vector<ResourceEntry*>* sorted_entries,
-                       BigBuffer* buffer) {
+  bool FlattenTypeSpec(ResourceTableType* type,
+                       const std::vector<ResourceEntry*>& sorted_entries, BigBuffer* buffer) {
     ChunkWriter type_spec_writer(buffer);
     ResTable_typeSpec* spec_header =
         type_spec_writer.StartChunk<ResTable_typeSpec>(RES_TABLE_TYPE_SPEC_TYPE);
     spec_header->id = type->id.value();
 
-    if (sorted_entries->empty()) {
+    if (sorted_entries.empty()) {
       type_spec_writer.Finish();
       return true;
     }
@@ -429,7 +513,7 @@ class PackageFlattener {
     // We can't just take the size of the vector. There may be holes in the
     // entry ID space.
     // Since the entries are sorted by ID, the last one will be the biggest.
-    const size_t num_entries = sorted_entries->back()->id.value() + 1;
+    const size_t num_entries = sorted_entries.back()->id.value() + 1;
 
     spec_header->entryCount = util::HostToDevice32(num_entries);
 
@@ -437,9 +521,9 @@ class PackageFlattener {
     // show for which configuration axis the resource changes.
     uint32_t* config_masks = type_spec_writer.NextBlock<uint32_t>(num_entries);
 
-    const size_t actual_num_entries = sorted_entries->size();
+    const size_t actual_num_entries = sorted_entries.size();
     for (size_t entryIndex = 0; entryIndex < actual_num_entries; entryIndex++) {
-      ResourceEntry* entry = sorted_entries->at(entryIndex);
+      ResourceEntry* entry = sorted_entries.at(entryIndex);
 
       // Populate the config masks for this entry.
 
@@ -465,35 +549,52 @@ class PackageFlattener {
     return true;
   }
 
-  bool FlattenTypes(BigBuffer* buffer) {
-    // Sort the types by their IDs. They will be inserted into the StringPool in
-    // this order.
-    std::vector<ResourceTableType*> sorted_types = CollectAndSortTypes();
-
+  // Makes the type and key string pool references that flattening the types
+  // will need, without writing any chunks. Must mirror the MakeRef calls in
+  // FlattenTypes() so that both passes see the same pool indices.
+  void PopulateTypeAndKeyPools(const std::vector<ResourceTableType*>& sorted_types,
+                               const std::vector<std::vector<ResourceEntry*>>& sorted_entries) {
     size_t expected_type_id = 1;
-    for (ResourceTableType* type : sorted_types) {
+    for (size_t i = 0; i < sorted_types.size(); i++) {
       // If there is a gap in the type IDs, fill in the StringPool
       // with empty values until we reach the ID we expect.
-      while (type->id.value() > expected_type_id) {
+      while (sorted_types[i]->id.value() > expected_type_id) {
         std::stringstream type_name;
         type_name << "?" << expected_type_id;
         type_pool_.MakeRef(type_name.str());
         expected_type_id++;
       }
       expected_type_id++;
-      type_pool_.MakeRef(to_string(type->type));
+      type_pool_.MakeRef(to_string(sorted_types[i]->type));
+
+      for (ResourceEntry* entry : sorted_entries[i]) {
+        if (!collapse_key_stringpool_ ||
+            whitelisted_resources_.find(entry->name) != whitelisted_resources_.end()) {
+          key_pool_.MakeRef(entry->name);
+        } else {
+          // resource isn't whitelisted, add it as obfuscated value
+          key_pool_.MakeRef(kObfuscatedResourceName);
+        }
+      }
+    }
+  }
 
-      std::vector<ResourceEntry*> sorted_entries = CollectAndSortEntries(type);
-      if (sorted_entries.empty()) {
+  bool FlattenTypes(const std::vector<ResourceTableType*>& sorted_types,
+                    const std::vector<std::vector<ResourceEntry*>>& sorted_entries,
+                    BigBuffer* buffer) {
+    for (size_t i = 0; i < sorted_types.size(); i++) {
+      ResourceTableType* type = sorted_types[i];
+      const std::vector<ResourceEntry*>& entries = sorted_entries[i];
+      if (entries.empty()) {
         continue;
       }
 
-      if (!FlattenTypeSpec(type, &sorted_entries, buffer)) {
+      if (!FlattenTypeSpec(type, entries, buffer)) {
         return false;
       }
 
       // Since the entries are sorted by ID, the last ID will be the largest.
-      const size_t num_entries = sorted_entries.back()->id.value() + 1;
+      const size_t num_entries = entries.back()->id.value() + 1;
 
       // The binary resource table lists resource entries for each
       // configuration.
@@ -503,17 +604,15 @@ class PackageFlattener {
       // table.
       std::map<ConfigDescription, std::vector<FlatEntry>> config_to_entry_list_map;
 
-      // hardcoded string uses characters which make it an invalid resource name
-      const std::string obfuscated_resource_name = "0_resource_name_obfuscated";
-
-      for (ResourceEntry* entry : sorted_entries) {
+      for (ResourceEntry* entry : entries) {
         uint32_t local_key_index;
         if (!collapse_key_stringpool_ ||
             whitelisted_resources_.find(entry->name) != whitelisted_resources_.end()) {
+          // This is a dedupe hit; the string was added by the population pass.
           local_key_index = (uint32_t)key_pool_.MakeRef(entry->name).index();
         } else {
           // resource isn't whitelisted, add it as obfuscated value
-          local_key_index = (uint32_t)key_pool_.MakeRef(obfuscated_resource_name).index();
+          local_key_index = (uint32_t)key_pool_.MakeRef(kObfuscatedResourceName).index();
         }
         // Group values by configuration.
         for (auto& config_value : entry->values) {
@@ -593,9 +692,8 @@ bool TableFlattener::Consume(IAaptContext* context, ResourceTable* table) {
   StringPool::FlattenUtf8(table_writer.buffer(), table->string_pool,
       context->GetDiagnostics());
 
-  BigBuffer package_buffer(1024);
-
-  // Flatten each package.
+  // Flatten each package directly after the string pool. Like the type chunks
+  // within a package, packages flatten forward in a single pass.
   for (auto& package : table->packages) {
     if (context->GetPackageType() == PackageType::kApp) {
       // Write a self mapping entry for this package if the ID is non-standard (0x7f).
@@ -616,13 +714,11 @@ bool TableFlattener::Consume(IAaptContext* context, ResourceTable* table) {
     PackageFlattener flattener(context, package.get(), &table->included_packages_,
                                options_.use_sparse_entries, options_.collapse_key_stringpool,
                                options_.whitelisted_resources);
-    if (!flattener.FlattenPackage(&package_buffer)) {
+    if (!flattener.FlattenPackage(table_writer.buffer())) {
       return false;
     }
   }
 
-  // Finally merge all the packages into the main buffer.
-  table_writer.buffer()->AppendBuffer(std::move(package_buffer));
   table_writer.Finish();
   return true;
 }
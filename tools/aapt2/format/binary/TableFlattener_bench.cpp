@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2018 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "format/binary/TableFlattener.h"
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "android-base/logging.h"
+#include "android-base/stringprintf.h"
+
+#include "Diagnostics.h"
+#include "ResourceTable.h"
+#include "ResourceValues.h"
+#include "process/IResourceTableConsumer.h"
+#include "util/BigBuffer.h"
+#include "util/Util.h"
+
+using ::android::base::StringPrintf;
+
+namespace aapt {
+
+namespace {
+
+class BenchmarkContext : public IAaptContext {
+ public:
+  PackageType GetPackageType() override {
+    return PackageType::kApp;
+  }
+
+  IDiagnostics* GetDiagnostics() override {
+    return &diagnostics_;
+  }
+
+  NameMangler* GetNameMangler() override {
+    UNIMPLEMENTED(FATAL);
+    return nullptr;
+  }
+
+  const std::string& GetCompilationPackage() override {
+    static std::string package = "com.app";
+    return package;
+  }
+
+  uint8_t GetPackageId() override {
+    return 0x7f;
+  }
+
+  SymbolTable* GetExternalSymbols() override {
+    UNIMPLEMENTED(FATAL);
+    return nullptr;
+  }
+
+  bool IsVerbose() override {
+    return false;
+  }
+
+  int GetMinSdkVersion() override {
+    return 0;
+  }
+
+ private:
+  StdErrDiagnostics diagnostics_;
+};
+
+}  // namespace
+
+static std::unique_ptr<ResourceTable> BuildTable(size_t entry_count) {
+  StdErrDiagnostics diag;
+  std::unique_ptr<ResourceTable> table = util::make_unique<ResourceTable>();
+  for (size_t i = 0; i < entry_count; i++) {
+    const ResourceName name("com.app", ResourceType::kString, StringPrintf("string_%zu", i));
+    const ResourceId id(0x7f, 0x01, static_cast<uint16_t>(i));
+    std::unique_ptr<String> value = util::make_unique<String>(
+        table->string_pool.MakeRef(StringPrintf("This is string number %zu", i)));
+    table->AddResourceWithId(name, id, ConfigDescription::DefaultConfig(), {}, std::move(value),
+                             &diag);
+  }
+  return table;
+}
+
+static void BM_TableFlattenerFlattenStrings(benchmark::State& state) {
+  std::unique_ptr<ResourceTable> table = BuildTable(state.range(0));
+  BenchmarkContext context;
+  TableFlattenerOptions options;
+  while (state.KeepRunning()) {
+    BigBuffer buffer(1024u);
+    TableFlattener flattener(options, &buffer);
+    flattener.Consume(&context, table.get());
+  }
+}
+// Entry ids are 16 bits, so a single type tops out at 64K entries.
+BENCHMARK(BM_TableFlattenerFlattenStrings)->Range(1024, 64 * 1024);
+
+}  // namespace aapt
@@ -64,9 +64,6 @@ class XmlFlattenerVisitor : public xml::ConstVisitor {
  public:
   using xml::ConstVisitor::Visit;
 
-  StringPool pool;
-  std::map<uint8_t, StringPool> package_pools;
-
   struct StringFlattenDest {
     StringPool::Ref ref;
     ResStringPool_ref* dest;
@@ -74,8 +71,9 @@ class XmlFlattenerVisitor : public xml::ConstVisitor {
 
   std::vector<StringFlattenDest> string_refs;
 
-  XmlFlattenerVisitor(BigBuffer* buffer, XmlFlattenerOptions options)
-      : buffer_(buffer), options_(options) {
+  XmlFlattenerVisitor(BigBuffer* buffer, XmlFlattenerOptions options, StringPool* pool,
+                      std::map<uint8_t, StringPool>* package_pools)
+      : buffer_(buffer), options_(options), pool_(pool), package_pools_(package_pools) {
   }
 
   void Visit(const xml::Text* node) override {
@@ -175,7 +173,7 @@ class XmlFlattenerVisitor : public xml::ConstVisitor {
       dest->index = util::DeviceToHost32(-1);
     } else {
       string_refs.push_back(
-          StringFlattenDest{pool.MakeRef(str, StringPool::Context(priority)), dest});
+          StringFlattenDest{pool_->MakeRef(str, StringPool::Context(priority)), dest});
     }
   }
 
@@ -259,7 +257,7 @@ class XmlFlattenerVisitor : public xml::ConstVisitor {
         // Lookup the StringPool for this package and make the reference there.
         const xml::AaptAttribute& aapt_attr = xml_attr->compiled_attribute.value();
 
-        StringPool::Ref name_ref = package_pools[aapt_attr.id.value().package_id()].MakeRef(
+        StringPool::Ref name_ref = (*package_pools_)[aapt_attr.id.value().package_id()].MakeRef(
             xml_attr->name, StringPool::Context(aapt_attr.id.value().id));
 
         // Add it to the list of strings to flatten.
@@ -309,24 +307,36 @@ class XmlFlattenerVisitor : public xml::ConstVisitor {
   BigBuffer* buffer_;
   XmlFlattenerOptions options_;
 
+  // Interning pools, owned by the XmlFlattener so their allocations survive
+  // across documents.
+  StringPool* pool_;
+  std::map<uint8_t, StringPool>* package_pools_;
+
   // Scratch vector to filter attributes. We avoid allocations making this a member.
   std::vector<const xml::Attribute*> filtered_attrs_;
 };
 
 }  // namespace
 
-bool XmlFlattener::Flatten(IAaptContext* context, const xml::Node* node) {
+bool XmlFlattener::Flatten(IAaptContext* context, const xml::Node* node, BigBuffer* buffer) {
+  // Clear the interning scratch left over from any previously consumed
+  // document. The allocations (notably the pool indices) are retained.
+  pool_.Clear();
+  for (auto& package_pool_entry : package_pools_) {
+    package_pool_entry.second.Clear();
+  }
+
   BigBuffer node_buffer(1024);
-  XmlFlattenerVisitor visitor(&node_buffer, options_);
+  XmlFlattenerVisitor visitor(&node_buffer, options_, &pool_, &package_pools_);
   node->Accept(&visitor);
 
   // Merge the package pools into the main pool.
-  for (auto& package_pool_entry : visitor.package_pools) {
-    visitor.pool.Merge(std::move(package_pool_entry.second));
+  for (auto& package_pool_entry : package_pools_) {
+    pool_.Merge(std::move(package_pool_entry.second));
   }
 
   // Sort the string pool so that attribute resource IDs show up first.
-  visitor.pool.Sort([](const StringPool::Context& a, const StringPool::Context& b) -> int {
+  pool_.Sort([](const StringPool::Context& a, const StringPool::Context& b) -> int {
     return util::compare(a.priority, b.priority);
   });
 
@@ -336,21 +346,21 @@ bool XmlFlattener::Flatten(IAaptContext* context, const xml::Node* node) {
   }
 
   // Write the XML header.
-  ChunkWriter xml_header_writer(buffer_);
+  ChunkWriter xml_header_writer(buffer);
   xml_header_writer.StartChunk<ResXMLTree_header>(RES_XML_TYPE);
 
   // Flatten the StringPool.
   if (options_.use_utf16) {
-    StringPool::FlattenUtf16(buffer_, visitor.pool, context->GetDiagnostics());
+    StringPool::FlattenUtf16(buffer, pool_, context->GetDiagnostics());
   } else {
-    StringPool::FlattenUtf8(buffer_, visitor.pool, context->GetDiagnostics());
+    StringPool::FlattenUtf8(buffer, pool_, context->GetDiagnostics());
   }
 
   {
     // Write the array of resource IDs, indexed by StringPool order.
-    ChunkWriter res_id_map_writer(buffer_);
+    ChunkWriter res_id_map_writer(buffer);
     res_id_map_writer.StartChunk<ResChunk_header>(RES_XML_RESOURCE_MAP_TYPE);
-    for (const auto& str : visitor.pool.strings()) {
+    for (const auto& str : pool_.strings()) {
       ResourceId id(str->context.priority);
       if (str->context.priority == kLowPriority || !id.is_valid()) {
         // When we see the first non-resource ID, we're done.
@@ -362,7 +372,7 @@ bool XmlFlattener::Flatten(IAaptContext* context, const xml::Node* node) {
   }
 
   // Move the nodeBuffer and append it to the out buffer.
-  buffer_->AppendBuffer(std::move(node_buffer));
+  buffer->AppendBuffer(std::move(node_buffer));
 
   // Finish the xml header.
   xml_header_writer.Finish();
@@ -370,10 +380,15 @@ bool XmlFlattener::Flatten(IAaptContext* context, const xml::Node* node) {
 }
 
 bool XmlFlattener::Consume(IAaptContext* context, const xml::XmlResource* resource) {
+  return Consume(context, resource, buffer_);
+}
+
+bool XmlFlattener::Consume(IAaptContext* context, const xml::XmlResource* resource,
+                           BigBuffer* out_buffer) {
   if (!resource->root) {
     return false;
   }
-  return Flatten(context, resource->root.get());
+  return Flatten(context, resource->root.get(), out_buffer);
 }
 
 }  // namespace aapt
@@ -17,8 +17,11 @@
 #ifndef AAPT_FORMAT_BINARY_XMLFLATTENER_H
 #define AAPT_FORMAT_BINARY_XMLFLATTENER_H
 
+#include <map>
+
 #include "android-base/macros.h"
 
+#include "StringPool.h"
 #include "process/IResourceTableConsumer.h"
 #include "util/BigBuffer.h"
 #include "xml/XmlDom.h"
@@ -42,13 +45,25 @@ class XmlFlattener {
 
   bool Consume(IAaptContext* context, const xml::XmlResource* resource);
 
+  // Same as Consume(), but flattens into out_buffer instead of the buffer
+  // given at construction. A single flattener may consume many documents this
+  // way; its string interning scratch is reused from one document to the next,
+  // which is much cheaper than building fresh pools per file. The output is
+  // unchanged: binary XML embeds its string pool per document, so every
+  // document still carries its own pool.
+  bool Consume(IAaptContext* context, const xml::XmlResource* resource, BigBuffer* out_buffer);
+
  private:
   DISALLOW_COPY_AND_ASSIGN(XmlFlattener);
 
-  bool Flatten(IAaptContext* context, const xml::Node* node);
+  bool Flatten(IAaptContext* context, const xml::Node* node, BigBuffer* buffer);
 
   BigBuffer* buffer_;
   XmlFlattenerOptions options_;
+
+  // Interning scratch, reused across consumed documents.
+  StringPool pool_;
+  std::map<uint8_t, StringPool> package_pools_;
 };
 
 }  // namespace aapt
@@ -534,3 +534,32 @@ TEST_F(XmlFlattenerTest, FlattenCompiledValueExcludesRawValueWithKeepRawOptionTr
 }
 
 }  // namespace aapt
+
+TEST_F(XmlFlattenerTest, ReusedFlattenerProducesSelfContainedDocuments) {
+  std::unique_ptr<xml::XmlResource> first = test::BuildXmlDom(R"(<View foo="bar" />)");
+  std::unique_ptr<xml::XmlResource> second = test::BuildXmlDom(R"(<TextView baz="quux" />)");
+
+  XmlFlattener flattener(nullptr, {});
+
+  BigBuffer first_buffer(1024);
+  ASSERT_TRUE(flattener.Consume(context_.get(), first.get(), &first_buffer));
+
+  BigBuffer second_buffer(1024);
+  ASSERT_TRUE(flattener.Consume(context_.get(), second.get(), &second_buffer));
+
+  // The second document must not contain strings left over from the first.
+  android::ResXMLTree tree;
+  std::unique_ptr<uint8_t[]> data = util::Copy(second_buffer);
+  ASSERT_THAT(tree.setTo(data.get(), second_buffer.size(), true), Eq(android::NO_ERROR));
+
+  while (tree.next() != android::ResXMLTree::START_TAG) {
+    ASSERT_THAT(tree.getEventType(), Ne(android::ResXMLTree::BAD_DOCUMENT));
+    ASSERT_THAT(tree.getEventType(), Ne(android::ResXMLTree::END_DOCUMENT));
+  }
+
+  size_t len;
+  EXPECT_THAT(tree.getElementName(&len), StrEq(u"TextView"));
+  ASSERT_THAT(tree.getAttributeCount(), Eq(1u));
+  EXPECT_THAT(tree.getAttributeName(0, &len), StrEq(u"baz"));
+  EXPECT_THAT(tree.getAttributeStringValue(0, &len), StrEq(u"quux"));
+}
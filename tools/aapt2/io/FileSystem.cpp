@@ -44,6 +44,12 @@ std::unique_ptr<IData> RegularFile::OpenAsData() {
 }
 
 std::unique_ptr<io::InputStream> RegularFile::OpenInputStream() {
+  // Prefer the memory mapped view. Consumers like the container parser walk the whole file,
+  // and reading from the map avoids staging each block through a copy buffer.
+  if (std::unique_ptr<IData> data = OpenAsData()) {
+    return data;
+  }
+  // Fall back to buffered reads if the file could not be mapped.
   return util::make_unique<FileInputStream>(source_.path);
 }
 
@@ -77,6 +77,8 @@ bool NoDefaultResourceRemover::Consume(IAaptContext* context, ResourceTable* tab
       type->entries.erase(new_end_iter, type->entries.end());
     }
   }
+  // Entries were removed behind the table's back; drop any memoized lookups.
+  table->InvalidateLookupCache();
   return true;
 }
 
@@ -83,6 +83,9 @@ bool PrivateAttributeMover::Consume(IAaptContext* context, ResourceTable* table)
     ResourceTableType* priv_attr_type = package->FindOrCreateType(ResourceType::kAttrPrivate);
     CHECK(priv_attr_type->entries.empty());
     priv_attr_type->entries = std::move(private_attr_entries);
+
+    // Entries changed type behind the table's back; drop any memoized lookups.
+    table->InvalidateLookupCache();
   }
   return true;
 }
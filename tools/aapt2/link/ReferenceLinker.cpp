@@ -16,6 +16,12 @@
 
 #include "link/ReferenceLinker.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "android-base/logging.h"
 #include "androidfw/ResourceTypes.h"
 
@@ -47,13 +53,17 @@ class ReferenceLinkerVisitor : public DescendingValueVisitor {
  public:
   using DescendingValueVisitor::Visit;
 
+  // string_pool_lock may be null when only one thread links; when set, it guards the shared
+  // string pool against concurrent interning from other linking threads.
   ReferenceLinkerVisitor(const CallSite& callsite, IAaptContext* context, SymbolTable* symbols,
-                         StringPool* string_pool, xml::IPackageDeclStack* decl)
+                         StringPool* string_pool, xml::IPackageDeclStack* decl,
+                         std::mutex* string_pool_lock = nullptr)
       : callsite_(callsite),
         context_(context),
         symbols_(symbols),
         package_decls_(decl),
-        string_pool_(string_pool) {}
+        string_pool_(string_pool),
+        string_pool_lock_(string_pool_lock) {}
 
   void Visit(Reference* ref) override {
     if (!ReferenceLinker::LinkReference(callsite_, ref, context_, symbols_, package_decls_)) {
@@ -137,8 +147,14 @@ class ReferenceLinkerVisitor : public DescendingValueVisitor {
         StringBuilder string_builder;
         string_builder.AppendText(*raw_string->value);
         if (string_builder) {
-          transformed =
-              util::make_unique<String>(string_pool_->MakeRef(string_builder.to_string()));
+          StringPool::Ref ref;
+          if (string_pool_lock_ != nullptr) {
+            std::lock_guard<std::mutex> lock(*string_pool_lock_);
+            ref = string_pool_->MakeRef(string_builder.to_string());
+          } else {
+            ref = string_pool_->MakeRef(string_builder.to_string());
+          }
+          transformed = util::make_unique<String>(ref);
         }
       }
 
@@ -154,9 +170,57 @@ class ReferenceLinkerVisitor : public DescendingValueVisitor {
   SymbolTable* symbols_;
   xml::IPackageDeclStack* package_decls_;
   StringPool* string_pool_;
+  std::mutex* string_pool_lock_;
   bool error_ = false;
 };
 
+// Forwards everything to the wrapped context except for diagnostics, which go to a per-thread
+// buffer instead.
+class ThreadContext : public IAaptContext {
+ public:
+  ThreadContext(IAaptContext* context, IDiagnostics* diagnostics)
+      : context_(context), diagnostics_(diagnostics) {
+  }
+
+  PackageType GetPackageType() override {
+    return context_->GetPackageType();
+  }
+
+  SymbolTable* GetExternalSymbols() override {
+    return context_->GetExternalSymbols();
+  }
+
+  IDiagnostics* GetDiagnostics() override {
+    return diagnostics_;
+  }
+
+  const std::string& GetCompilationPackage() override {
+    return context_->GetCompilationPackage();
+  }
+
+  uint8_t GetPackageId() override {
+    return context_->GetPackageId();
+  }
+
+  NameMangler* GetNameMangler() override {
+    return context_->GetNameMangler();
+  }
+
+  bool IsVerbose() override {
+    return context_->IsVerbose();
+  }
+
+  int GetMinSdkVersion() override {
+    return context_->GetMinSdkVersion();
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(ThreadContext);
+
+  IAaptContext* context_;
+  IDiagnostics* diagnostics_;
+};
+
 class EmptyDeclStack : public xml::IPackageDeclStack {
  public:
   EmptyDeclStack() = default;
@@ -355,6 +419,16 @@ bool ReferenceLinker::LinkReference(const CallSite& callsite, Reference* referen
 bool ReferenceLinker::Consume(IAaptContext* context, ResourceTable* table) {
   EmptyDeclStack decl_stack;
   bool error = false;
+
+  // A single entry to link. Once the symbol table is frozen, entries are independent of one
+  // another and can be linked from any thread.
+  struct LinkJob {
+    // The context of this resource is the package in which it is defined.
+    CallSite callsite;
+    ResourceEntry* entry;
+  };
+
+  std::vector<LinkJob> jobs;
   for (auto& package : table->packages) {
     // Since we're linking, each package must have a name.
     CHECK(!package->name.empty()) << "all packages being linked must have a name";
@@ -372,20 +446,69 @@ bool ReferenceLinker::Consume(IAaptContext* context, ResourceTable* table) {
           error = true;
         }
 
-        // The context of this resource is the package in which it is defined.
-        const CallSite callsite{name.package};
-        ReferenceLinkerVisitor visitor(callsite, context, context->GetExternalSymbols(),
-                                       &table->string_pool, &decl_stack);
+        jobs.push_back(LinkJob{CallSite{name.package}, entry.get()});
+      }
+    }
+  }
 
-        for (auto& config_value : entry->values) {
-          config_value->value->Accept(&visitor);
-        }
+  const auto link_entry = [&](IAaptContext* job_context, const LinkJob& job,
+                              std::mutex* string_pool_lock) -> bool {
+    ReferenceLinkerVisitor visitor(job.callsite, job_context, job_context->GetExternalSymbols(),
+                                   &table->string_pool, &decl_stack, string_pool_lock);
+    for (auto& config_value : job.entry->values) {
+      config_value->value->Accept(&visitor);
+    }
+    return !visitor.HasError();
+  };
 
-        if (visitor.HasError()) {
-          error = true;
+  size_t thread_count = std::thread::hardware_concurrency();
+  if (thread_count > jobs.size()) {
+    thread_count = jobs.size();
+  }
+
+  if (thread_count <= 1) {
+    for (const LinkJob& job : jobs) {
+      error |= !link_entry(context, job, nullptr);
+    }
+    return !error;
+  }
+
+  // Freeze the symbol table so that lookups are safe from the worker threads, then shard the
+  // entries across them. Each worker buffers its diagnostics; the buffers are replayed in worker
+  // order once everything is linked.
+  SymbolTable* symbols = context->GetExternalSymbols();
+  symbols->Freeze();
+
+  std::mutex string_pool_lock;
+  std::atomic<size_t> next_job(0);
+  std::vector<BufferedDiagnostics> worker_diagnostics(thread_count);
+  std::vector<uint8_t> worker_failed(thread_count, 0);
+
+  std::vector<std::thread> workers;
+  workers.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; i++) {
+    workers.emplace_back([&, i]() {
+      ThreadContext thread_context(context, &worker_diagnostics[i]);
+      while (true) {
+        const size_t job_index = next_job.fetch_add(1);
+        if (job_index >= jobs.size()) {
+          break;
+        }
+        if (!link_entry(&thread_context, jobs[job_index], &string_pool_lock)) {
+          worker_failed[i] = 1;
         }
       }
-    }
+    });
+  }
+
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  symbols->Unfreeze();
+
+  for (size_t i = 0; i < thread_count; i++) {
+    worker_diagnostics[i].ReplayTo(context->GetDiagnostics());
+    error |= worker_failed[i] != 0;
   }
   return !error;
 }
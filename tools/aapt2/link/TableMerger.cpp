@@ -40,11 +40,25 @@ TableMerger::TableMerger(IAaptContext* context, ResourceTable* out_table,
 bool TableMerger::Merge(const Source& src, ResourceTable* table, bool overlay) {
   // We allow adding new resources if this is not an overlay, or if the options allow overlays
   // to add new resources.
-  return MergeImpl(src, table, overlay, options_.auto_add_overlay || !overlay /*allow_new*/);
+  return MergeImpl(src, table, overlay, options_.auto_add_overlay || !overlay /*allow_new*/,
+                   false /*consume*/);
+}
+
+bool TableMerger::MergeAndConsume(const Source& src, ResourceTable* table, bool overlay) {
+  return MergeImpl(src, table, overlay, options_.auto_add_overlay || !overlay /*allow_new*/,
+                   true /*consume*/);
 }
 
 // This will merge packages with the same package name (or no package name).
-bool TableMerger::MergeImpl(const Source& src, ResourceTable* table, bool overlay, bool allow_new) {
+bool TableMerger::MergeImpl(const Source& src, ResourceTable* table, bool overlay, bool allow_new,
+                            bool consume) {
+  if (consume) {
+    // Adopt the source pool up front so that any string references held by moved values are
+    // owned by the master table before the source table goes away. Strings that end up
+    // unreferenced are dropped when the pool is pruned before flattening.
+    master_table_->string_pool.Merge(std::move(table->string_pool));
+  }
+
   bool error = false;
   for (auto& package : table->packages) {
     // Only merge an empty package or the package we're building.
@@ -56,7 +70,7 @@ bool TableMerger::MergeImpl(const Source& src, ResourceTable* table, bool overla
       // valid. This is because un-mangled references are mangled, then looked up at resolution
       // time. Also, when linking, we convert references with no package name to use the compilation
       // package name.
-      error |= !DoMerge(src, table, package.get(), false /*mangle*/, overlay, allow_new);
+      error |= !DoMerge(src, table, package.get(), false /*mangle*/, overlay, allow_new, consume);
     }
   }
   return !error;
@@ -76,7 +90,8 @@ bool TableMerger::MergeAndMangle(const Source& src, const StringPiece& package_n
 
     bool mangle = package_name != context_->GetCompilationPackage();
     merged_packages_.insert(package->name);
-    error |= !DoMerge(src, table, package.get(), mangle, false /*overlay*/, true /*allow_new*/);
+    error |= !DoMerge(src, table, package.get(), mangle, false /*overlay*/, true /*allow_new*/,
+                      false /*consume*/);
   }
   return !error;
 }
@@ -199,7 +214,7 @@ static ResourceTable::CollisionResult MergeConfigValue(IAaptContext* context,
 
 bool TableMerger::DoMerge(const Source& src, ResourceTable* src_table,
                           ResourceTablePackage* src_package, bool mangle_package, bool overlay,
-                          bool allow_new_resources) {
+                          bool allow_new_resources, bool consume) {
   bool error = false;
 
   for (auto& src_type : src_package->types) {
@@ -261,15 +276,13 @@ bool TableMerger::DoMerge(const Source& src, ResourceTable* src_table,
 
         // Continue if we're taking the new resource.
 
-        if (FileReference* f = ValueCast<FileReference>(src_config_value->value.get())) {
-          std::unique_ptr<FileReference> new_file_ref;
-          if (mangle_package) {
-            new_file_ref = CloneAndMangleFile(src_package->name, *f);
-          } else {
-            new_file_ref = std::unique_ptr<FileReference>(f->Clone(&master_table_->string_pool));
-          }
-          dst_config_value->value = std::move(new_file_ref);
-
+        FileReference* f = ValueCast<FileReference>(src_config_value->value.get());
+        if (f != nullptr && mangle_package) {
+          dst_config_value->value = CloneAndMangleFile(src_package->name, *f);
+        } else if (consume) {
+          // The source pool was merged into the master pool before the values were visited, so
+          // any string references held by this value already point into the master table.
+          dst_config_value->value = std::move(src_config_value->value);
         } else {
           dst_config_value->value = std::unique_ptr<Value>(
               src_config_value->value->Clone(&master_table_->string_pool));
@@ -312,8 +325,10 @@ bool TableMerger::MergeFile(const ResourceFile& file_desc, bool overlay, io::IFi
       ->FindOrCreateValue(file_desc.config, {})
       ->value = std::move(file_ref);
 
+  // The table is local to this function, so consume it rather than cloning out of it.
+  master_table_->string_pool.Merge(std::move(table.string_pool));
   return DoMerge(file->GetSource(), &table, pkg, false /*mangle*/, overlay /*overlay*/,
-                 true /*allow_new*/);
+                 true /*allow_new*/, true /*consume*/);
 }
 
 }  // namespace aapt
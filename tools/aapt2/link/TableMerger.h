@@ -65,6 +65,11 @@ class TableMerger {
   // If overlay is true, the resources are treated as overlays.
   bool Merge(const Source& src, ResourceTable* table, bool overlay);
 
+  // Same as Merge, but consumes the given table: values and the string pool are moved into the
+  // master table instead of cloned. Only valid when the caller owns the table and discards it
+  // after this call, as the table is left gutted.
+  bool MergeAndConsume(const Source& src, ResourceTable* table, bool overlay);
+
   // Merges resources from the given package, mangling the name. This is for static libraries.
   // All FileReference values must have their io::IFile set.
   bool MergeAndMangle(const Source& src, const android::StringPiece& package, ResourceTable* table);
@@ -81,10 +86,11 @@ class TableMerger {
   ResourceTablePackage* master_package_;
   std::set<std::string> merged_packages_;
 
-  bool MergeImpl(const Source& src, ResourceTable* src_table, bool overlay, bool allow_new);
+  bool MergeImpl(const Source& src, ResourceTable* src_table, bool overlay, bool allow_new,
+                 bool consume);
 
   bool DoMerge(const Source& src, ResourceTable* src_table, ResourceTablePackage* src_package,
-               bool mangle_package, bool overlay, bool allow_new_resources);
+               bool mangle_package, bool overlay, bool allow_new_resources, bool consume);
 
   std::unique_ptr<FileReference> CloneAndMangleFile(const std::string& package,
                                                     const FileReference& value);
@@ -86,6 +86,27 @@ TEST_F(TableMergerTest, SimpleMerge) {
   EXPECT_TRUE(final_table.FindResource(test::ParseNameOrDie("com.app.a:id/com.app.b$foo")));
 }
 
+TEST_F(TableMergerTest, MergeAndConsumeMovesValues) {
+  std::unique_ptr<ResourceTable> table_a = test::ResourceTableBuilder()
+                                               .SetPackageId("com.app.a", 0x7f)
+                                               .AddString("com.app.a:string/foo", "purple")
+                                               .AddReference("com.app.a:id/foo", "com.app.a:id/bar")
+                                               .Build();
+
+  ResourceTable final_table;
+  TableMerger merger(context_.get(), &final_table, TableMergerOptions{});
+
+  ASSERT_TRUE(merger.MergeAndConsume({}, table_a.get(), false /*overlay*/));
+
+  // The consumed table must no longer be needed for the merged values to be valid.
+  table_a.reset();
+
+  String* str = test::GetValue<String>(&final_table, "com.app.a:string/foo");
+  ASSERT_THAT(str, NotNull());
+  EXPECT_EQ(std::string("purple"), *str->value);
+  EXPECT_TRUE(final_table.FindResource(test::ParseNameOrDie("com.app.a:id/foo")));
+}
+
 TEST_F(TableMergerTest, MergeFile) {
   ResourceTable final_table;
   TableMergerOptions options;
@@ -17,8 +17,11 @@
 #include "MultiApkGenerator.h"
 
 #include <algorithm>
+#include <atomic>
 #include <regex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "androidfw/StringPiece.h"
 
@@ -94,8 +97,11 @@ class ContextWrapper : public IAaptContext {
   }
 
   void SetSource(const std::string& source) {
-    source_diag_ =
-        util::make_unique<SourcePathDiagnostics>(Source{source}, context_->GetDiagnostics());
+    SetSource(source, context_->GetDiagnostics());
+  }
+
+  void SetSource(const std::string& source, IDiagnostics* diag) {
+    source_diag_ = util::make_unique<SourcePathDiagnostics>(Source{source}, diag);
   }
 
  private:
@@ -124,13 +130,10 @@ bool MultiApkGenerator::FromBaseApk(const MultiApkGeneratorOptions& options) {
   std::unordered_set<std::string> filtered_artifacts;
   std::unordered_set<std::string> kept_artifacts;
 
-  // For now, just write out the stripped APK since ABI splitting doesn't modify anything else.
+  // Decide up front which artifacts to generate so the workers only see artifacts that passed
+  // the keep filter, and the bookkeeping of kept and filtered artifacts stays in artifact order.
+  std::vector<const OutputArtifact*> artifacts;
   for (const OutputArtifact& artifact : options.apk_artifacts) {
-    FilterChain filters;
-
-    ContextWrapper wrapped_context{context_};
-    wrapped_context.SetSource(artifact.name);
-
     if (!options.kept_artifacts.empty()) {
       const auto& it = artifacts_to_keep.find(artifact.name);
       if (it == artifacts_to_keep.end()) {
@@ -144,40 +147,55 @@ bool MultiApkGenerator::FromBaseApk(const MultiApkGeneratorOptions& options) {
         kept_artifacts.insert(artifact.name);
       }
     }
+    artifacts.push_back(&artifact);
+  }
 
-    std::unique_ptr<ResourceTable> table =
-        FilterTable(context_, artifact, *apk_->GetResourceTable(), &filters);
-    if (!table) {
-      return false;
-    }
-
-    IDiagnostics* diag = wrapped_context.GetDiagnostics();
+  if (!artifacts.empty() && !file::mkdirs(options.out_dir)) {
+    context_->GetDiagnostics()->Warn(DiagMessage()
+                                     << "could not create out dir: " << options.out_dir);
+  }
 
-    std::unique_ptr<XmlResource> manifest;
-    if (!UpdateManifest(artifact, &manifest, diag)) {
-      diag->Error(DiagMessage() << "could not update AndroidManifest.xml for output artifact");
-      return false;
+  // Each artifact filters its own clone of the base table and writes to its own archive, so
+  // generation fans out across threads. The base APK is only read.
+  size_t thread_count = std::thread::hardware_concurrency();
+  thread_count = std::min(thread_count, artifacts.size());
+  if (thread_count <= 1 || artifacts.size() <= 1) {
+    for (const OutputArtifact* artifact : artifacts) {
+      if (!GenerateArtifact(*artifact, options, context_->GetDiagnostics())) {
+        return false;
+      }
     }
-
-    std::string out = options.out_dir;
-    if (!file::mkdirs(out)) {
-      diag->Warn(DiagMessage() << "could not create out dir: " << out);
+  } else {
+    std::atomic<size_t> next_job(0);
+    std::vector<BufferedDiagnostics> artifact_diagnostics(artifacts.size());
+    std::vector<uint8_t> artifact_failed(artifacts.size(), 0);
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < thread_count; i++) {
+      workers.emplace_back([&]() {
+        while (true) {
+          const size_t job = next_job.fetch_add(1);
+          if (job >= artifacts.size()) {
+            return;
+          }
+          if (!GenerateArtifact(*artifacts[job], options, &artifact_diagnostics[job])) {
+            artifact_failed[job] = 1;
+          }
+        }
+      });
     }
-    file::AppendPath(&out, artifact.name);
 
-    if (context_->IsVerbose()) {
-      diag->Note(DiagMessage() << "Generating split: " << out);
+    for (std::thread& worker : workers) {
+      worker.join();
     }
 
-    std::unique_ptr<IArchiveWriter> writer = CreateZipFileArchiveWriter(diag, out);
-
-    if (context_->IsVerbose()) {
-      diag->Note(DiagMessage() << "Writing output: " << out);
+    // Replay the diagnostics in artifact order so the output reads as if generation were serial.
+    bool error = false;
+    for (size_t i = 0; i < artifacts.size(); i++) {
+      artifact_diagnostics[i].ReplayTo(context_->GetDiagnostics());
+      error |= artifact_failed[i] != 0;
     }
-
-    filters.AddFilter(util::make_unique<SignatureFilter>());
-    if (!apk_->WriteToArchive(&wrapped_context, table.get(), options.table_flattener_options,
-                              &filters, writer.get(), manifest.get())) {
+    if (error) {
       return false;
     }
   }
@@ -209,6 +227,46 @@ bool MultiApkGenerator::FromBaseApk(const MultiApkGeneratorOptions& options) {
   return true;
 }
 
+bool MultiApkGenerator::GenerateArtifact(const OutputArtifact& artifact,
+                                         const MultiApkGeneratorOptions& options,
+                                         IDiagnostics* base_diag) {
+  FilterChain filters;
+
+  ContextWrapper wrapped_context{context_};
+  wrapped_context.SetSource(artifact.name, base_diag);
+
+  std::unique_ptr<ResourceTable> table =
+      FilterTable(&wrapped_context, artifact, *apk_->GetResourceTable(), &filters);
+  if (!table) {
+    return false;
+  }
+
+  IDiagnostics* diag = wrapped_context.GetDiagnostics();
+
+  std::unique_ptr<XmlResource> manifest;
+  if (!UpdateManifest(artifact, &manifest, diag)) {
+    diag->Error(DiagMessage() << "could not update AndroidManifest.xml for output artifact");
+    return false;
+  }
+
+  std::string out = options.out_dir;
+  file::AppendPath(&out, artifact.name);
+
+  if (context_->IsVerbose()) {
+    diag->Note(DiagMessage() << "Generating split: " << out);
+  }
+
+  std::unique_ptr<IArchiveWriter> writer = CreateZipFileArchiveWriter(diag, out);
+
+  if (context_->IsVerbose()) {
+    diag->Note(DiagMessage() << "Writing output: " << out);
+  }
+
+  filters.AddFilter(util::make_unique<SignatureFilter>());
+  return apk_->WriteToArchive(&wrapped_context, table.get(), options.table_flattener_options,
+                              &filters, writer.get(), manifest.get());
+}
+
 std::unique_ptr<ResourceTable> MultiApkGenerator::FilterTable(IAaptContext* context,
                                                               const OutputArtifact& artifact,
                                                               const ResourceTable& old_table,
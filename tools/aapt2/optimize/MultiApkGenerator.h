@@ -60,6 +60,13 @@ class MultiApkGenerator {
     return context_->GetDiagnostics();
   }
 
+  /**
+   * Generates a single artifact, reporting problems to the given diagnostics. Safe to call from
+   * multiple threads for different artifacts as long as each call gets its own diagnostics.
+   */
+  bool GenerateArtifact(const configuration::OutputArtifact& artifact,
+                        const MultiApkGeneratorOptions& options, IDiagnostics* diag);
+
   bool UpdateManifest(const configuration::OutputArtifact& artifact,
                       std::unique_ptr<xml::XmlResource>* updated_manifest, IDiagnostics* diag);
 
@@ -17,14 +17,141 @@
 #include "optimize/ResourceDeduper.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 #include "DominatorTree.h"
 #include "ResourceTable.h"
+#include "ValueVisitor.h"
 
 namespace aapt {
 
 namespace {
 
+inline size_t CombineHash(size_t seed, size_t value) {
+  return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/**
+ * Computes a cheap content hash of a value. Values that are Equals() hash to
+ * the same result, so differing hashes prove two values are different and the
+ * deep comparison can be skipped. The hash may be coarser than Equals(); a
+ * collision merely costs the comparison that would have happened anyway.
+ */
+class ValueHasher : public ConstValueVisitor {
+ public:
+  static size_t Hash(const Value* value) {
+    ValueHasher hasher;
+    value->Accept(&hasher);
+    return hasher.hash_;
+  }
+
+  void Visit(const Reference* ref) override {
+    hash_ = HashReference(*ref);
+  }
+
+  void Visit(const RawString* str) override {
+    hash_ = HashString('w', *str->value);
+  }
+
+  void Visit(const String* str) override {
+    hash_ = HashString('s', *str->value);
+  }
+
+  void Visit(const StyledString* str) override {
+    // Spans are ignored; they rarely differ between identical strings.
+    hash_ = HashString('S', str->value->value);
+  }
+
+  void Visit(const FileReference* file) override {
+    hash_ = HashString('f', *file->path);
+  }
+
+  void Visit(const Id* id) override {
+    // Any two Ids compare equal.
+    hash_ = 'i';
+  }
+
+  void Visit(const BinaryPrimitive* primitive) override {
+    hash_ = CombineHash(CombineHash('b', primitive->value.dataType), primitive->value.data);
+  }
+
+  void Visit(const Attribute* attr) override {
+    size_t hash = CombineHash('a', attr->type_mask);
+    hash = CombineHash(hash, static_cast<uint32_t>(attr->min_int));
+    hash = CombineHash(hash, static_cast<uint32_t>(attr->max_int));
+    hash = CombineHash(hash, attr->symbols.size());
+
+    // Symbol order does not matter to Attribute::Equals, so mix the symbols
+    // with an order-independent XOR.
+    size_t symbols_hash = 0;
+    for (const Attribute::Symbol& symbol : attr->symbols) {
+      symbols_hash ^= CombineHash(HashReference(symbol.symbol), symbol.value);
+    }
+    hash_ = CombineHash(hash, symbols_hash);
+  }
+
+  void Visit(const Style* style) override {
+    size_t hash = 'y';
+    if (style->parent) {
+      hash = CombineHash(hash, HashReference(style->parent.value()));
+    }
+    hash = CombineHash(hash, style->entries.size());
+
+    // Entry order does not matter to Style::Equals, so mix the entries with
+    // an order-independent XOR.
+    size_t entries_hash = 0;
+    for (const Style::Entry& entry : style->entries) {
+      entries_hash ^= CombineHash(HashReference(entry.key), Hash(entry.value.get()));
+    }
+    hash_ = CombineHash(hash, entries_hash);
+  }
+
+  void Visit(const Array* array) override {
+    size_t hash = CombineHash('A', array->elements.size());
+    for (const std::unique_ptr<Item>& element : array->elements) {
+      hash = CombineHash(hash, Hash(element.get()));
+    }
+    hash_ = hash;
+  }
+
+  void Visit(const Plural* plural) override {
+    size_t hash = 'p';
+    for (const std::unique_ptr<Item>& item : plural->values) {
+      hash = CombineHash(hash, item ? Hash(item.get()) : 0);
+    }
+    hash_ = hash;
+  }
+
+  void Visit(const Styleable* styleable) override {
+    size_t hash = CombineHash('Y', styleable->entries.size());
+    for (const Reference& entry : styleable->entries) {
+      hash = CombineHash(hash, HashReference(entry));
+    }
+    hash_ = hash;
+  }
+
+  void VisitAny(const Value* value) override {
+    // Unknown value type: bucket everything together and let Equals() decide.
+    hash_ = 0;
+  }
+
+ private:
+  static size_t HashString(char tag, const std::string& str) {
+    return CombineHash(tag, std::hash<std::string>()(str));
+  }
+
+  static size_t HashReference(const Reference& reference) {
+    size_t hash = CombineHash('r', static_cast<size_t>(reference.reference_type));
+    hash = CombineHash(hash, reference.private_reference ? 1 : 0);
+    hash = CombineHash(hash, reference.id ? std::hash<ResourceId>()(reference.id.value()) : 0);
+    hash = CombineHash(hash,
+                       reference.name ? std::hash<ResourceName>()(reference.name.value()) : 0);
+    return hash;
+  }
+
+  size_t hash_ = 0;
+};
+
 /**
  * Remove duplicated key-value entries from dominated resources.
  *
@@ -40,8 +167,9 @@ class DominatedKeyValueRemover : public DominatorTree::BottomUpVisitor {
  public:
   using Node = DominatorTree::Node;
 
-  explicit DominatedKeyValueRemover(IAaptContext* context, ResourceEntry* entry)
-      : context_(context), entry_(entry) {}
+  DominatedKeyValueRemover(IAaptContext* context, ResourceEntry* entry,
+                           const std::unordered_map<const ResourceConfigValue*, size_t>* hashes)
+      : context_(context), entry_(entry), hashes_(hashes) {}
 
   void VisitConfig(Node* node) {
     Node* parent = node->parent();
@@ -53,7 +181,11 @@ class DominatedKeyValueRemover : public DominatorTree::BottomUpVisitor {
     if (!node_value || !parent_value) {
       return;
     }
-    if (!node_value->value->Equals(parent_value->value.get())) {
+    // Differing content hashes prove the values differ without a deep
+    // comparison.
+    const size_t node_hash = hashes_->at(node_value);
+    if (node_hash != hashes_->at(parent_value) ||
+        !node_value->value->Equals(parent_value->value.get())) {
       return;
     }
 
@@ -66,7 +198,8 @@ class DominatedKeyValueRemover : public DominatorTree::BottomUpVisitor {
         continue;
       }
       if (node_configuration.IsCompatibleWith(sibling->config) &&
-          !node_value->value->Equals(sibling->value.get())) {
+          (node_hash != hashes_->at(sibling.get()) ||
+           !node_value->value->Equals(sibling->value.get()))) {
         // The configurations are compatible, but the value is
         // different, so we can't remove this value.
         return;
@@ -88,11 +221,22 @@ class DominatedKeyValueRemover : public DominatorTree::BottomUpVisitor {
 
   IAaptContext* context_;
   ResourceEntry* entry_;
+  const std::unordered_map<const ResourceConfigValue*, size_t>* hashes_;
 };
 
 static void DedupeEntry(IAaptContext* context, ResourceEntry* entry) {
+  // Hash each value once up front so that the dominator walk only runs the
+  // deep Equals() on candidates whose content hashes match.
+  std::unordered_map<const ResourceConfigValue*, size_t> hashes;
+  hashes.reserve(entry->values.size());
+  for (const auto& config_value : entry->values) {
+    if (config_value->value) {
+      hashes[config_value.get()] = ValueHasher::Hash(config_value->value.get());
+    }
+  }
+
   DominatorTree tree(entry->values);
-  DominatedKeyValueRemover remover(context, entry);
+  DominatedKeyValueRemover remover(context, entry, &hashes);
   tree.Accept(&remover);
 
   // Erase the values that were removed.
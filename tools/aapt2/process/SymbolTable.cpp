@@ -65,6 +65,26 @@ void SymbolTable::PrependSource(std::unique_ptr<ISymbolSource> source) {
   cache_.clear();
 }
 
+std::shared_ptr<SymbolTable::Symbol> SymbolTable::LookUpSymbolByName(
+    const ResourceName& name_with_package) {
+  // Mangle the name (if necessary) and find it in our sources.
+  // Here we use a Maybe<> object to reserve storage if we need to mangle.
+  const ResourceName* mangled_name = &name_with_package;
+  Maybe<ResourceName> mangled_name_impl;
+  if (mangler_->ShouldMangle(name_with_package.package)) {
+    mangled_name_impl = mangler_->MangleName(name_with_package);
+    mangled_name = &mangled_name_impl.value();
+  }
+
+  // Take ownership of the symbol into a shared_ptr. We do this because
+  // LruCache doesn't support unique_ptr.
+  return std::shared_ptr<Symbol>(delegate_->FindByName(*mangled_name, sources_));
+}
+
+std::shared_ptr<SymbolTable::Symbol> SymbolTable::LookUpSymbolById(const ResourceId& id) {
+  return std::shared_ptr<Symbol>(delegate_->FindById(id, sources_));
+}
+
 const SymbolTable::Symbol* SymbolTable::FindByName(const ResourceName& name) {
   const ResourceName* name_with_package = &name;
 
@@ -77,29 +97,38 @@ const SymbolTable::Symbol* SymbolTable::FindByName(const ResourceName& name) {
     name_with_package = &name_with_package_impl.value();
   }
 
+  if (frozen_) {
+    std::lock_guard<std::mutex> lock(frozen_lock_);
+    auto iter = frozen_cache_.find(*name_with_package);
+    if (iter != frozen_cache_.end()) {
+      return iter->second.get();
+    }
+
+    std::shared_ptr<Symbol> shared_symbol = LookUpSymbolByName(*name_with_package);
+    if (shared_symbol == nullptr) {
+      return nullptr;
+    }
+
+    if (shared_symbol->id) {
+      frozen_id_cache_[shared_symbol->id.value()] = shared_symbol;
+    }
+
+    // Since we look in the cache with the unmangled, but package prefixed
+    // name, we must put the same name into the cache.
+    frozen_cache_[*name_with_package] = shared_symbol;
+    return shared_symbol.get();
+  }
+
   // We store the name unmangled in the cache, so look it up as-is.
   if (const std::shared_ptr<Symbol>& s = cache_.get(*name_with_package)) {
     return s.get();
   }
 
-  // The name was not found in the cache. Mangle it (if necessary) and find it in our sources.
-  // Again, here we use a Maybe<> object to reserve storage if we need to mangle.
-  const ResourceName* mangled_name = name_with_package;
-  Maybe<ResourceName> mangled_name_impl;
-  if (mangler_->ShouldMangle(name_with_package->package)) {
-    mangled_name_impl = mangler_->MangleName(*name_with_package);
-    mangled_name = &mangled_name_impl.value();
-  }
-
-  std::unique_ptr<Symbol> symbol = delegate_->FindByName(*mangled_name, sources_);
-  if (symbol == nullptr) {
+  std::shared_ptr<Symbol> shared_symbol = LookUpSymbolByName(*name_with_package);
+  if (shared_symbol == nullptr) {
     return nullptr;
   }
 
-  // Take ownership of the symbol into a shared_ptr. We do this because
-  // LruCache doesn't support unique_ptr.
-  std::shared_ptr<Symbol> shared_symbol(std::move(symbol));
-
   // Since we look in the cache with the unmangled, but package prefixed
   // name, we must put the same name into the cache.
   cache_.put(*name_with_package, shared_symbol);
@@ -115,19 +144,30 @@ const SymbolTable::Symbol* SymbolTable::FindByName(const ResourceName& name) {
 }
 
 const SymbolTable::Symbol* SymbolTable::FindById(const ResourceId& id) {
+  if (frozen_) {
+    std::lock_guard<std::mutex> lock(frozen_lock_);
+    auto iter = frozen_id_cache_.find(id);
+    if (iter != frozen_id_cache_.end()) {
+      return iter->second.get();
+    }
+
+    std::shared_ptr<Symbol> shared_symbol = LookUpSymbolById(id);
+    if (shared_symbol == nullptr) {
+      return nullptr;
+    }
+    frozen_id_cache_[id] = shared_symbol;
+    return shared_symbol.get();
+  }
+
   if (const std::shared_ptr<Symbol>& s = id_cache_.get(id)) {
     return s.get();
   }
 
   // We did not find it in the cache, so look through the sources.
-  std::unique_ptr<Symbol> symbol = delegate_->FindById(id, sources_);
-  if (symbol == nullptr) {
+  std::shared_ptr<Symbol> shared_symbol = LookUpSymbolById(id);
+  if (shared_symbol == nullptr) {
     return nullptr;
   }
-
-  // Take ownership of the symbol into a shared_ptr. We do this because LruCache
-  // doesn't support unique_ptr.
-  std::shared_ptr<Symbol> shared_symbol(std::move(symbol));
   id_cache_.put(id, shared_symbol);
 
   // Returns the raw pointer. Callers are not expected to hold on to this
@@ -135,6 +175,18 @@ const SymbolTable::Symbol* SymbolTable::FindById(const ResourceId& id) {
   return shared_symbol.get();
 }
 
+void SymbolTable::Freeze() {
+  CHECK(!frozen_) << "symbol table is already frozen";
+  frozen_ = true;
+}
+
+void SymbolTable::Unfreeze() {
+  CHECK(frozen_) << "symbol table is not frozen";
+  frozen_ = false;
+  frozen_cache_.clear();
+  frozen_id_cache_.clear();
+}
+
 const SymbolTable::Symbol* SymbolTable::FindByReference(const Reference& ref) {
   // First try the ID. This is because when we lookup by ID, we only fill in the ID cache.
   // Looking up by name fills in the name and ID cache. So a cache miss will cause a failed
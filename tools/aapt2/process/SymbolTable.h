@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "android-base/macros.h"
@@ -99,7 +101,22 @@ class SymbolTable {
   // results are stored in a cache which may evict entries on subsequent calls.
   const Symbol* FindByReference(const Reference& ref);
 
+  // Freezes the table so that FindByXXX may be called from multiple threads.
+  // While frozen, lookups are serialized internally and results are pinned
+  // (never evicted), so a Symbol returned to one thread cannot be destroyed by
+  // lookups on another. Sources and the delegate must not be changed while
+  // frozen.
+  void Freeze();
+
+  // Unfreezes the table. Must only be called once the threads that were doing
+  // lookups have been joined; any Symbol returned while frozen is invalidated.
+  void Unfreeze();
+
  private:
+  // Looks past the caches, into the sources. Returns null if not found.
+  std::shared_ptr<Symbol> LookUpSymbolByName(const ResourceName& name_with_package);
+  std::shared_ptr<Symbol> LookUpSymbolById(const ResourceId& id);
+
   NameMangler* mangler_;
   std::unique_ptr<ISymbolTableDelegate> delegate_;
   std::vector<std::unique_ptr<ISymbolSource>> sources_;
@@ -109,6 +126,13 @@ class SymbolTable {
   android::LruCache<ResourceName, std::shared_ptr<Symbol>> cache_;
   android::LruCache<ResourceId, std::shared_ptr<Symbol>> id_cache_;
 
+  // While frozen, lookups bypass the LruCaches (which both mutate on reads and
+  // evict) and go through these unbounded maps under the lock instead.
+  bool frozen_ = false;
+  std::mutex frozen_lock_;
+  std::unordered_map<ResourceName, std::shared_ptr<Symbol>> frozen_cache_;
+  std::unordered_map<ResourceId, std::shared_ptr<Symbol>> frozen_id_cache_;
+
   DISALLOW_COPY_AND_ASSIGN(SymbolTable);
 };
 
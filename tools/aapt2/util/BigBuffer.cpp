@@ -17,13 +17,81 @@
 #include "util/BigBuffer.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "android-base/logging.h"
 
 namespace aapt {
 
+namespace {
+
+// Maximum number of bytes a thread keeps in its block pool. Blocks released
+// beyond this limit go back to the heap.
+constexpr size_t kMaxPooledBytes = 8 * 1024 * 1024;
+
+/**
+ * A free list of buffer blocks, bucketed by allocation size. Flattening
+ * creates and destroys many short-lived BigBuffers whose blocks share a
+ * handful of sizes, so after warm-up most block allocations are served from
+ * recycled blocks instead of the heap.
+ */
+class BlockPool {
+ public:
+  std::unique_ptr<uint8_t[]> Acquire(size_t size) {
+    auto iter = free_blocks_.find(size);
+    if (iter != free_blocks_.end() && !iter->second.empty()) {
+      std::unique_ptr<uint8_t[]> buffer = std::move(iter->second.back());
+      iter->second.pop_back();
+      pooled_bytes_ -= size;
+
+      // Callers expect zero-initialized memory.
+      memset(buffer.get(), 0, size);
+      stats_.hits++;
+      return buffer;
+    }
+    stats_.misses++;
+    return std::unique_ptr<uint8_t[]>(new uint8_t[size]());
+  }
+
+  void Release(std::unique_ptr<uint8_t[]> buffer, size_t size) {
+    if (pooled_bytes_ + size > kMaxPooledBytes) {
+      return;
+    }
+    pooled_bytes_ += size;
+    free_blocks_[size].push_back(std::move(buffer));
+  }
+
+  const BigBuffer::PoolStats& stats() const {
+    return stats_;
+  }
+
+ private:
+  std::unordered_map<size_t, std::vector<std::unique_ptr<uint8_t[]>>> free_blocks_;
+  size_t pooled_bytes_ = 0;
+  BigBuffer::PoolStats stats_;
+};
+
+BlockPool& GetThreadBlockPool() {
+  thread_local BlockPool pool;
+  return pool;
+}
+
+}  // namespace
+
+BigBuffer::~BigBuffer() {
+  BlockPool& pool = GetThreadBlockPool();
+  for (Block& block : blocks_) {
+    pool.Release(std::move(block.buffer), block.block_size_);
+  }
+}
+
+BigBuffer::PoolStats BigBuffer::GetPoolStats() {
+  return GetThreadBlockPool().stats();
+}
+
 void* BigBuffer::NextBlockImpl(size_t size) {
   if (!blocks_.empty()) {
     Block& block = blocks_.back();
@@ -39,8 +107,8 @@ void* BigBuffer::NextBlockImpl(size_t size) {
 
   Block block = {};
 
-  // Zero-allocate the block's buffer.
-  block.buffer = std::unique_ptr<uint8_t[]>(new uint8_t[actual_size]());
+  // The pool hands out zeroed buffers.
+  block.buffer = GetThreadBlockPool().Acquire(actual_size);
   CHECK(block.buffer);
 
   block.size = size;
@@ -64,9 +132,9 @@ void* BigBuffer::NextBlock(size_t* out_size) {
     }
   }
 
-  // Zero-allocate the block's buffer.
+  // The pool hands out zeroed buffers.
   Block block = {};
-  block.buffer = std::unique_ptr<uint8_t[]>(new uint8_t[block_size_]());
+  block.buffer = GetThreadBlockPool().Acquire(block_size_);
   CHECK(block.buffer);
   block.size = block_size_;
   block.block_size_ = block_size_;
@@ -17,6 +17,7 @@
 #ifndef AAPT_BIG_BUFFER_H
 #define AAPT_BIG_BUFFER_H
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -62,6 +63,15 @@ class BigBuffer {
 
   typedef std::vector<Block>::const_iterator const_iterator;
 
+  /**
+   * Statistics for the thread-local block pool. Hits are block allocations
+   * served from a recycled block, misses went to the heap.
+   */
+  struct PoolStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+  };
+
   /**
    * Create a BigBuffer with block allocation sizes
    * of block_size.
@@ -70,6 +80,16 @@ class BigBuffer {
 
   BigBuffer(BigBuffer&& rhs);
 
+  /**
+   * Releases the blocks back to the calling thread's block pool.
+   */
+  ~BigBuffer();
+
+  /**
+   * Returns the block pool statistics for the calling thread.
+   */
+  static PoolStats GetPoolStats();
+
   /**
    * Number of occupied bytes in all the allocated blocks.
    */
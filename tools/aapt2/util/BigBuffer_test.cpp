@@ -82,6 +82,28 @@ TEST(BigBufferTest, AppendAndMoveBlock) {
   ASSERT_EQ(b, buffer.end());
 }
 
+TEST(BigBufferTest, RecycleBlocksThroughThreadPool) {
+  const BigBuffer::PoolStats before = BigBuffer::GetPoolStats();
+
+  {
+    BigBuffer buffer(16);
+    char* b1 = buffer.NextBlock<char>(16);
+    ASSERT_THAT(b1, NotNull());
+    memset(b1, 0xff, 16);
+  }
+
+  // The released block should be reused, and handed out zeroed.
+  BigBuffer buffer(16);
+  char* b2 = buffer.NextBlock<char>(16);
+  ASSERT_THAT(b2, NotNull());
+  for (size_t i = 0; i < 16; i++) {
+    EXPECT_EQ(0, b2[i]);
+  }
+
+  const BigBuffer::PoolStats after = BigBuffer::GetPoolStats();
+  EXPECT_GT(after.hits, before.hits);
+}
+
 TEST(BigBufferTest, PadAndAlignProperly) {
   BigBuffer buffer(16);
 
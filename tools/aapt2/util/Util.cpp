@@ -17,6 +17,8 @@
 #include "util/Util.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -297,7 +299,56 @@ bool VerifyJavaStringFormat(const StringPiece& str) {
   return true;
 }
 
+// Returns true if every byte of the string is ASCII, checking a word at a time. The vast
+// majority of resource names and values are plain ASCII, and for those the conversion
+// helpers below can widen/narrow directly instead of running the branchy per-byte UTF
+// machinery twice (once for the length, once for the conversion).
+static bool IsAllAscii(const StringPiece& str) {
+  const char* data = str.data();
+  size_t len = str.length();
+  uint64_t word = 0;
+  while (len >= sizeof(word)) {
+    memcpy(&word, data, sizeof(word));
+    if ((word & 0x8080808080808080ull) != 0) {
+      return false;
+    }
+    data += sizeof(word);
+    len -= sizeof(word);
+  }
+  for (size_t i = 0; i < len; i++) {
+    if ((static_cast<uint8_t>(data[i]) & 0x80) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Same as above for UTF-16: true if every code unit is ASCII.
+static bool IsAllAscii(const StringPiece16& str) {
+  const char16_t* data = str.data();
+  size_t len = str.length();
+  uint64_t word = 0;
+  while (len >= sizeof(word) / sizeof(char16_t)) {
+    memcpy(&word, data, sizeof(word));
+    if ((word & 0xff80ff80ff80ff80ull) != 0) {
+      return false;
+    }
+    data += sizeof(word) / sizeof(char16_t);
+    len -= sizeof(word) / sizeof(char16_t);
+  }
+  for (size_t i = 0; i < len; i++) {
+    if ((data[i] & 0xff80) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 std::u16string Utf8ToUtf16(const StringPiece& utf8) {
+  if (IsAllAscii(utf8)) {
+    return std::u16string(utf8.begin(), utf8.end());
+  }
+
   ssize_t utf16_length = utf8_to_utf16_length(
       reinterpret_cast<const uint8_t*>(utf8.data()), utf8.length());
   if (utf16_length <= 0) {
@@ -312,6 +363,10 @@ std::u16string Utf8ToUtf16(const StringPiece& utf8) {
 }
 
 std::string Utf16ToUtf8(const StringPiece16& utf16) {
+  if (IsAllAscii(utf16)) {
+    return std::string(utf16.begin(), utf16.end());
+  }
+
   ssize_t utf8_length = utf16_to_utf8_length(utf16.data(), utf16.length());
   if (utf8_length <= 0) {
     return {};
@@ -157,4 +157,21 @@ TEST(UtilTest, VerifyJavaStringFormat) {
   ASSERT_FALSE(util::VerifyJavaStringFormat("%09f %08s"));
 }
 
+TEST(UtilTest, Utf8ToUtf16AndBack) {
+  // Pure ASCII takes the fast widening path; lengths chosen to cover both the
+  // word-at-a-time scan and the byte tail.
+  EXPECT_THAT(util::Utf8ToUtf16("abcdefghij"), Eq(std::u16string(u"abcdefghij")));
+  EXPECT_THAT(util::Utf16ToUtf8(u"abcdefghij"), Eq(std::string("abcdefghij")));
+  EXPECT_THAT(util::Utf8ToUtf16("abc"), Eq(std::u16string(u"abc")));
+  EXPECT_THAT(util::Utf16ToUtf8(u"abc"), Eq(std::string("abc")));
+  EXPECT_THAT(util::Utf8ToUtf16(""), Eq(std::u16string()));
+  EXPECT_THAT(util::Utf16ToUtf8(u""), Eq(std::string()));
+
+  // Multi-byte sequences anywhere in the string force the scalar conversion.
+  EXPECT_THAT(util::Utf8ToUtf16("caf\xc3\xa9"), Eq(std::u16string(u"café")));
+  EXPECT_THAT(util::Utf16ToUtf8(u"café"), Eq(std::string("caf\xc3\xa9")));
+  EXPECT_THAT(util::Utf8ToUtf16("1234567\xc3\xa9"), Eq(std::u16string(u"1234567é")));
+  EXPECT_THAT(util::Utf16ToUtf8(u"123é"), Eq(std::string("123\xc3\xa9")));
+}
+
 }  // namespace aapt
@@ -42,6 +42,11 @@ class Node {
  public:
   virtual ~Node() = default;
 
+  // Node allocation goes through a thread-local recycler (see XmlDom.cpp) so that parsing and
+  // discarding many documents reuses the same memory instead of churning the heap allocator.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   Element* parent = nullptr;
   size_t line_number = 0u;
   size_t column_number = 0u;
@@ -15,7 +15,9 @@
  */
 
 #include <algorithm>
+#include <cctype>
 #include <cstdio>
+#include <cstring>
 
 #include "aapt/AaptUtil.h"
 
@@ -38,10 +40,14 @@ static void usage() {
     fprintf(stderr,
             "split-select --help\n"
             "split-select --target <config> --base <path/to/apk> [--split <path/to/apk> [...]]\n"
+            "split-select --target-file <path> --base <path/to/apk> [--split <path/to/apk> [...]]\n"
             "split-select --generate --base <path/to/apk> [--split <path/to/apk> [...]]\n"
             "\n"
             "  --help                   Displays more information about this program.\n"
             "  --target <config>        Performs the Split APK selection on the given configuration.\n"
+            "  --target-file <path>     Performs the selection for every configuration listed in the\n"
+            "                           given file (one per line, '-' for stdin) against the same\n"
+            "                           loaded set of APKs. Each match is emitted as '<config>\\t<path>'.\n"
             "  --generate               Generates the logic for selecting the Split APK, in JSON format.\n"
             "  --base <path/to/apk>     Specifies the base APK, from which all Split APKs must be based off.\n"
             "  --split <path/to/apk>    Includes a Split APK in the selection process.\n"
@@ -63,9 +69,29 @@ static void help() {
             "  via JSON.\n");
 }
 
-Vector<SplitDescription> select(const SplitDescription& target, const Vector<SplitDescription>& splits) {
-    const SplitSelector selector(splits);
-    return selector.getBestSplits(target);
+// Emits the Split APK paths matching the given target, one per line. When
+// prefix is non-NULL each line is '<prefix>\t<path>' so batch output stays
+// attributable to its configuration.
+static void printMatchingSplits(const SplitSelector& selector, const SplitDescription& target,
+        const KeyedVector<SplitDescription, String8>& splitApkPathMap, const String8& baseApkPath,
+        const char* prefix) {
+    const Vector<SplitDescription> matchingConfigs = selector.getBestSplits(target);
+    const size_t matchingConfigCount = matchingConfigs.size();
+    SortedVector<String8> matchingSplitPaths;
+    for (size_t i = 0; i < matchingConfigCount; i++) {
+        matchingSplitPaths.add(splitApkPathMap.valueFor(matchingConfigs[i]));
+    }
+
+    const size_t matchingSplitApkPathCount = matchingSplitPaths.size();
+    for (size_t i = 0; i < matchingSplitApkPathCount; i++) {
+        if (matchingSplitPaths[i] != baseApkPath) {
+            if (prefix != NULL) {
+                fprintf(stdout, "%s\t%s\n", prefix, matchingSplitPaths[i].string());
+            } else {
+                fprintf(stdout, "%s\n", matchingSplitPaths[i].string());
+            }
+        }
+    }
 }
 
 void generate(const KeyedVector<String8, Vector<SplitDescription> >& splits, const String8& base) {
@@ -244,6 +270,7 @@ static int main(int argc, char** argv) {
 
     bool generateFlag = false;
     String8 targetConfigStr;
+    String8 targetConfigFile;
     Vector<String8> splitApkPaths;
     String8 baseApkPath;
     while (argc > 0) {
@@ -257,6 +284,15 @@ static int main(int argc, char** argv) {
                 return 1;
             }
             targetConfigStr.setTo(*argv);
+        } else if (arg == "--target-file") {
+            argc--;
+            argv++;
+            if (argc < 1) {
+                fprintf(stderr, "error: missing parameter for --target-file.\n");
+                usage();
+                return 1;
+            }
+            targetConfigFile.setTo(*argv);
         } else if (arg == "--split") {
             argc--;
             argv++;
@@ -295,7 +331,13 @@ static int main(int argc, char** argv) {
         argv++;
     }
 
-    if (!generateFlag && targetConfigStr == "") {
+    if (!generateFlag && targetConfigStr == "" && targetConfigFile == "") {
+        usage();
+        return 1;
+    }
+
+    if (targetConfigStr != "" && targetConfigFile != "") {
+        fprintf(stderr, "error: --target and --target-file are mutually exclusive.\n");
         usage();
         return 1;
     }
@@ -314,7 +356,7 @@ static int main(int argc, char** argv) {
     }
 
     SplitDescription targetSplit;
-    if (!generateFlag) {
+    if (!generateFlag && targetConfigStr != "") {
         if (!SplitDescription::parse(targetConfigStr, &targetSplit)) {
             fprintf(stderr, "error: invalid --target config: '%s'.\n",
                     targetConfigStr.string());
@@ -349,22 +391,50 @@ static int main(int argc, char** argv) {
         splitConfigs.appendVector(splits);
     }
 
-    if (!generateFlag) {
-        Vector<SplitDescription> matchingConfigs = select(targetSplit, splitConfigs);
-        const size_t matchingConfigCount = matchingConfigs.size();
-        SortedVector<String8> matchingSplitPaths;
-        for (size_t i = 0; i < matchingConfigCount; i++) {
-            matchingSplitPaths.add(splitApkPathMap.valueFor(matchingConfigs[i]));
+    if (generateFlag) {
+        generate(apkPathSplitMap, baseApkPath);
+        return 0;
+    }
+
+    // Group the splits and build the selection rules once; every target
+    // configuration is evaluated against this same loaded rule set.
+    const SplitSelector selector(splitConfigs);
+
+    if (targetConfigFile == "") {
+        printMatchingSplits(selector, targetSplit, splitApkPathMap, baseApkPath, NULL);
+        return 0;
+    }
+
+    FILE* fin = (targetConfigFile == "-") ? stdin : fopen(targetConfigFile.string(), "r");
+    if (fin == NULL) {
+        fprintf(stderr, "error: failed to open --target-file: '%s'.\n",
+                targetConfigFile.string());
+        return 1;
+    }
+
+    char line[1024];
+    while (fgets(line, sizeof(line), fin) != NULL) {
+        // Trim the newline and skip blank lines and comments.
+        size_t len = strlen(line);
+        while (len > 0 && isspace(static_cast<unsigned char>(line[len - 1]))) {
+            line[--len] = '\0';
+        }
+        if (len == 0 || line[0] == '#') {
+            continue;
         }
 
-        const size_t matchingSplitApkPathCount = matchingSplitPaths.size();
-        for (size_t i = 0; i < matchingSplitApkPathCount; i++) {
-            if (matchingSplitPaths[i] != baseApkPath) {
-                fprintf(stdout, "%s\n", matchingSplitPaths[i].string());
-            }
+        SplitDescription lineSplit;
+        if (!SplitDescription::parse(String8(line), &lineSplit)) {
+            fprintf(stderr, "warning: skipping invalid target config: '%s'.\n", line);
+            continue;
         }
-    } else {
-        generate(apkPathSplitMap, baseApkPath);
+        removeRuntimeQualifiers(&lineSplit.config);
+
+        printMatchingSplits(selector, lineSplit, splitApkPathMap, baseApkPath, line);
+    }
+
+    if (fin != stdin) {
+        fclose(fin);
     }
     return 0;
 }